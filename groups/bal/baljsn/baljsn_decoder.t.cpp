@@ -34,6 +34,7 @@
 #include <bslmt_threadutil.h>
 
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_vector.h>
 #include <bsl_sstream.h>
 #include <bsl_cstdlib.h>
@@ -71,6 +72,8 @@ namespace test = BloombergLP::s_baltst;
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, &options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, &options);
+// [11] int decode(const bsl::string_view& input, TYPE *v, options);
+// [11] int decode(const bsl::string_view& input, TYPE *v, &options);
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
@@ -36508,6 +36511,95 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING CONTIGUOUS INPUT
+        //
+        // Concerns:
+        //: 1 Decoding from a 'bsl::string_view' gives the same result, return
+        //:   code, and logged messages as decoding the same data from a
+        //:   'streambuf'.
+        //:
+        //: 2 The 'validateInputIsUtf8' option is honored.
+        //:
+        //: 3 A null options pointer is equivalent to default options.
+        //
+        // Plan:
+        //: 1 For a table of valid and invalid JSON documents, decode each
+        //:   both from a 'streambuf' and from a 'bsl::string_view', with and
+        //:   without UTF-8 validation, and compare the results.  (C-1..2)
+        //:
+        //: 2 Repeat, passing a null options pointer to the 'bsl::string_view'
+        //:   overload and default options to the 'streambuf' overload.  (C-3)
+        //
+        // Testing:
+        //   int decode(const bsl::string_view& input, TYPE *v, options);
+        //   int decode(const bsl::string_view& input, TYPE *v, &options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DECODING CONTIGUOUS INPUT" << endl
+                          << "=================================" << endl;
+
+        static const struct {
+            int         d_line;    // source line number
+            const char *d_input_p; // JSON input
+        } DATA[] = {
+            { L_, "{\"name\":\"Bob\",\"homeAddress\":{\"street\":"
+                  "\"Lexington Ave\",\"city\":\"New York City\","
+                  "\"state\":\"New York\"},\"age\":21}" },
+            { L_, "  {  \"name\" : \"B\\\"o\\\\b\" , \"age\" : 21 }  " },
+            { L_, "{\"name\":\"\\u00e9\xc3\xa9\"}" },
+            { L_, "{\"name\":\"\xff\"}" },
+            { L_, "{\"name\":\"Bob\",\"age\":21} \xe2\x82" },
+            { L_, "{\"name\":\"Bob\",\"unknown\":[1,{\"a\":2}],\"age\":21}" },
+            { L_, "{\"name\":\"Bob\",\"age\":\"twenty\"}" },
+            { L_, "{\"name\":\"Bob\",\"age\":21" },
+            { L_, "{\"name\":\"Bob" },
+            { L_, "[]" },
+            { L_, "" },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            const int              LINE = DATA[ti].d_line;
+            const bsl::string_view INPUT(DATA[ti].d_input_p);
+
+            for (int tj = 0; tj < 3; ++tj) {
+                baljsn::DecoderOptions options;
+                options.setSkipUnknownElements(true);
+                options.setValidateInputIsUtf8(1 == tj);
+
+                test::Employee  expected;
+                Obj             expDecoder;
+
+                bdlsb::FixedMemInStreamBuf isb(INPUT.data(), INPUT.length());
+                const int EXP_RC = expDecoder.decode(&isb,
+                                                     &expected,
+                                                     options);
+
+                test::Employee  value;
+                Obj             decoder;
+
+                const int RC = 2 == tj
+                             ? decoder.decode(INPUT,
+                                              &value,
+                                              (baljsn::DecoderOptions *)0)
+                             : decoder.decode(INPUT, &value, options);
+
+                if (veryVerbose) { P_(LINE); P_(tj); P_(RC); P(value); }
+
+                ASSERTV(LINE, tj, EXP_RC, RC, EXP_RC == RC);
+                ASSERTV(LINE, tj, expected, value, expected == value);
+                ASSERTV(LINE,
+                        tj,
+                        expDecoder.loggedMessages(),
+                        decoder.loggedMessages(),
+                        expDecoder.loggedMessages() ==
+                                                     decoder.loggedMessages());
+            }
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
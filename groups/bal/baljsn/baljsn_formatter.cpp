@@ -7,8 +7,34 @@ BSLS_IDENT_RCSID(baljsn_formatter_cpp,"$Id$ $CSID$")
 #include <baljsn_encoderoptions.h>
 #include <baljsn_printutil.h>
 
+#include <bslstl_stringref.h>
+
+#include <bsl_cstring.h>
+
 namespace BloombergLP {
 namespace baljsn {
+namespace {
+
+const bsl::size_t k_MAX_BUFFERED_NAME_LENGTH = 128;
+    // maximum length of a member name that 'openMember' assembles, together
+    // with its quotes and separator, in a local buffer
+
+bool isPlainName(const bsl::string_view& name)
+    // Return 'true' if the specified 'name' consists solely of printable
+    // ASCII characters that are written to JSON without escaping, and 'false'
+    // otherwise.
+{
+    const char *end = name.data() + name.length();
+    for (const char *iter = name.data(); iter != end; ++iter) {
+        const unsigned char ch = static_cast<unsigned char>(*iter);
+        if (ch < 0x20 || ch > 0x7e || '"' == ch || '\\' == ch || '/' == ch) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
 
                           // ---------------
                           // class Formatter
@@ -47,10 +73,10 @@ void Formatter::openObject()
         indent();
     }
 
-    d_outputStream << '{';
+    write('{');
 
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
+        write('\n');
         ++d_indentLevel;
         d_callSequence.append(false);
     }
@@ -60,14 +86,14 @@ void Formatter::closeObject()
 {
     if (d_usePrettyStyle) {
         --d_indentLevel;
-        d_outputStream << '\n';
+        write('\n');
         indent();
 
         BSLS_ASSERT(false == isArrayElement());
         d_callSequence.remove(d_callSequence.length() - 1);
     }
 
-    d_outputStream << '}';
+    write('}');
 }
 
 void Formatter::openArray(bool formatAsEmptyArrayFlag)
@@ -77,10 +103,10 @@ void Formatter::openArray(bool formatAsEmptyArrayFlag)
         indent();
     }
 
-    d_outputStream << '[';
+    write('[');
 
     if (d_usePrettyStyle && !formatAsEmptyArrayFlag) {
-        d_outputStream << '\n';
+        write('\n');
         ++d_indentLevel;
         d_callSequence.append(true);
     }
@@ -90,45 +116,78 @@ void Formatter::closeArray(bool formatAsEmptyArrayFlag)
 {
     if (d_usePrettyStyle && !formatAsEmptyArrayFlag) {
         --d_indentLevel;
-        d_outputStream << '\n';
+        write('\n');
         indent();
 
         BSLS_ASSERT(true == isArrayElement());
         d_callSequence.remove(d_callSequence.length() - 1);
     }
 
-    d_outputStream << ']';
+    write(']');
 }
 
-int Formatter::openMember(const bsl::string& name)
+int Formatter::openMember(const bsl::string_view& name)
 {
     if (d_usePrettyStyle) {
         indent();
     }
 
-    const int rc = PrintUtil::printValue(d_outputStream, name);
-    if (rc) {
-        return rc;                                                    // RETURN
+    const char        *separator       = d_usePrettyStyle ? " : " : ":";
+    const bsl::size_t  separatorLength = d_usePrettyStyle ? 3 : 1;
+
+    if (!isPlainName(name)) {
+        // Validation and escaping of the name are left to 'PrintUtil'.
+
+        const int rc = PrintUtil::printValue(
+                              d_outputStream,
+                              bslstl::StringRef(name.data(), name.length()));
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+
+        write(separator, separatorLength);
+        return 0;                                                     // RETURN
+    }
+
+    if (name.length() > k_MAX_BUFFERED_NAME_LENGTH) {
+        write('"');
+        write(name.data(), name.length());
+        write('"');
+        write(separator, separatorLength);
+        return 0;                                                     // RETURN
     }
 
-    d_outputStream << (d_usePrettyStyle ? " : " : ":");
+    char  buffer[k_MAX_BUFFERED_NAME_LENGTH + 5];
+    char *next = buffer;
+
+    *next++ = '"';
+    bsl::memcpy(next, name.data(), name.length());
+    next += name.length();
+    *next++ = '"';
+    bsl::memcpy(next, separator, separatorLength);
+    next += separatorLength;
 
+    write(buffer, static_cast<bsl::size_t>(next - buffer));
     return 0;
 }
 
 void Formatter::closeMember()
 {
-    d_outputStream << ',';
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
+        write(",\n", 2);
+    }
+    else {
+        write(',');
     }
 }
 
 void Formatter::addArrayElementSeparator()
 {
-    d_outputStream << ',';
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
+        write(",\n", 2);
+    }
+    else {
+        write(',');
     }
 }
 
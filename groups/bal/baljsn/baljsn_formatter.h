@@ -189,7 +189,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlc_bitarray.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_ostream.h>
+#include <bsl_string_view.h>
 
 #include <bsls_assert.h>
 #include <bsls_review.h>
@@ -233,6 +235,14 @@ class Formatter {
         // element at the current indentation level.  Note that this method
         // does not check that 'd_usePrettyStyle' is 'true' before indenting.
 
+    void write(char character);
+    void write(const char *data, bsl::size_t length);
+        // Write the specified 'character', or the specified 'length' bytes
+        // starting at the specified 'data', directly to the stream buffer of
+        // the stream supplied at construction, and set 'badbit' on that
+        // stream if they cannot all be written.  Do nothing if that stream is
+        // not in a good state.
+
     // PRIVATE ACCESSORS
     bool isArrayElement() const;
         // Return 'true' if the value being encoded is an element of an array,
@@ -303,11 +313,14 @@ class Formatter {
         // relevant only if this formatter encodes in the pretty style and is
         // ignored otherwise.
 
-    int openMember(const bsl::string& name);
+    int openMember(const bsl::string_view& name);
         // Print onto the stream supplied at construction the sequence of
         // characters designating the start of a member (referred to as a
         // "name/value pair" in JSON) having the specified 'name'.  Return 0 on
-        // success and a non-zero value otherwise.
+        // success and a non-zero value otherwise.  Note that a 'name'
+        // consisting solely of printable ASCII characters that need no
+        // escaping is written, together with its quotes and the following
+        // separator, in a single write to the underlying stream buffer.
 
     void putNullValue();
         // Print onto the stream supplied at construction the value
@@ -348,6 +361,30 @@ void Formatter::indent()
     bdlb::Print::indent(d_outputStream, d_indentLevel, d_spacesPerLevel);
 }
 
+inline
+void Formatter::write(char character)
+{
+    typedef bsl::ostream::traits_type Traits;
+
+    if (d_outputStream.good() &&
+        Traits::eq_int_type(Traits::eof(),
+                            d_outputStream.rdbuf()->sputc(character))) {
+        d_outputStream.setstate(bsl::ios_base::badbit);
+    }
+}
+
+inline
+void Formatter::write(const char *data, bsl::size_t length)
+{
+    if (d_outputStream.good() &&
+        static_cast<bsl::streamsize>(length) !=
+                      d_outputStream.rdbuf()->sputn(
+                                     data,
+                                     static_cast<bsl::streamsize>(length))) {
+        d_outputStream.setstate(bsl::ios_base::badbit);
+    }
+}
+
 // PRIVATE ACCESSORS
 inline
 bool Formatter::isArrayElement() const
@@ -364,7 +401,7 @@ void Formatter::putNullValue()
     if (d_usePrettyStyle && isArrayElement()) {
         indent();
     }
-    d_outputStream << "null";
+    write("null", 4);
 }
 
 template <class TYPE>
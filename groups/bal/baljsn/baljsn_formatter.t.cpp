@@ -21,6 +21,7 @@
 #include <bdlde_utf8util.h>
 
 #include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_fixedmemoutstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bdlat_typetraits.h>
@@ -81,14 +82,15 @@ namespace test = BloombergLP::s_baltst;
 // [ 4] void closeObject();
 // [ 5] void openArray();
 // [ 6] void closeArray();
-// [ 7] int openMember();
+// [ 7] int openMember(const bsl::string_view& name);
 // [ 8] int putValue(const TYPE& value, const EncoderOptions *options);
 // [ 8] int putNullValue();
 // [ 9] void closeMember();
 // [11] void addArrayElementSeparator();
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [12] USAGE EXAMPLE
+// [12] OUTPUT ERRORS
+// [13] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -243,7 +245,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -399,6 +401,87 @@ int main(int argc, char *argv[])
     ASSERT(EXPECTED == os.str());
 //..
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // OUTPUT ERRORS
+        //
+        // Concerns:
+        //: 1 If the stream buffer underlying the output stream cannot accept
+        //:   all of the characters written by a manipulator, the stream is
+        //:   left in a bad state.
+        //:
+        //: 2 The characters that are accepted by the stream buffer are a
+        //:   prefix of the characters that would otherwise have been written.
+        //:
+        //: 3 A formatter whose stream is in a bad state writes nothing.
+        //
+        // Plan:
+        //: 1 For each length less than the length of a short JSON document,
+        //:   create a fixed-length stream buffer of that length and an output
+        //:   stream using it, and format the document into that stream.
+        //:   Verify that the stream is not in a good state and that the
+        //:   contents of the buffer are a prefix of the document.  (C-1..2)
+        //:
+        //: 2 Format the document into a stream in a bad state and verify that
+        //:   nothing is written.  (C-3)
+        //
+        // Testing:
+        //   OUTPUT ERRORS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "OUTPUT ERRORS" << endl
+                          << "=============" << endl;
+
+        for (int style = 0; style < 2; ++style) {
+            const bsl::string EXP = style
+                    ? "{\n  \"name\" : 1,\n  \"x\\/y\" : [\n    null\n  ]\n}"
+                    : "{\"name\":1,\"x\\/y\":[null]}";
+            const int         LEN = static_cast<int>(EXP.length());
+
+            for (int len = 0; len <= LEN; ++len) {
+                char                        buffer[64];
+                bdlsb::FixedMemOutStreamBuf sb(buffer, len);
+                bsl::ostream                os(&sb);
+
+                Obj mX(os, style, 0, 2);
+
+                mX.openObject();
+                mX.openMember("name");
+                mX.putValue(1);
+                mX.closeMember();
+                mX.openMember("x/y");
+                mX.openArray();
+                mX.putNullValue();
+                mX.closeArray();
+                mX.closeObject();
+
+                const int LENGTH = static_cast<int>(sb.length());
+
+                ASSERTV(style, len, LENGTH, LENGTH <= len);
+                ASSERTV(style, len, (len == LEN) == os.good());
+                ASSERTV(style, len, bsl::string(buffer, LENGTH),
+                        EXP.compare(0, LENGTH, buffer, LENGTH) == 0);
+            }
+
+            bsl::ostringstream os;
+            os.setstate(bsl::ios_base::failbit);
+
+            Obj mX(os, style, 0, 2);
+
+            mX.openObject();
+            mX.openMember("name");
+            mX.putValue(1);
+            mX.closeMember();
+            mX.openMember("x/y");
+            mX.openArray();
+            mX.putNullValue();
+            mX.closeArray();
+            mX.closeObject();
+
+            ASSERTV(style, os.str(), os.str().empty());
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING 'addArrayElementSeparator' METHOD
@@ -932,16 +1015,27 @@ int main(int argc, char *argv[])
         //: 3 Providing an invalid (non-UTF8) element name results in a
         //:   non-zero value being returned.  Otherwise 0 is returned.
         //:
+        //: 4 Element names containing characters that must be escaped, and
+        //:   element names containing non-ASCII characters, are output as
+        //:   'PrintUtil' outputs them.
+        //:
+        //: 5 Element names longer than the internal buffer used for names that
+        //:   need no escaping are output correctly.
+        //:
         // Plan:
         //: 1 Using a table-based approach specify the encoding style,
         //:   indentation level, spaces per level, element name, expected
         //:   return value, and the expected output after calling
         //:   'openMember'.  Create a formatter object using the specified
         //:   parameters and invoke 'openMember' on it.  Verify that the
-        //:   output written to the stream is as expected.
+        //:   output written to the stream is as expected.  (C-1..4)
+        //:
+        //: 2 For a set of lengths around the length of the internal buffer,
+        //:   invoke 'openMember' with element names of that length and
+        //:   verify the output.  (C-5)
         //
         // Testing:
-        //   void openMember(const bsl::string& name);
+        //   int openMember(const bsl::string_view& name);
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -985,6 +1079,17 @@ int main(int argc, char *argv[])
      {   L_,     1,      1,    2,   "name",     0,   "  \"name\" : "      },
      {   L_,     1,      2,    3,   "name",     0,   "      \"name\" : "  },
 
+     {   L_,     0,     -1,   -1,   "a\"b",     0,   "\"a\\\"b\":"        },
+     {   L_,     0,     -1,   -1,   "a\\b",     0,   "\"a\\\\b\":"        },
+     {   L_,     0,     -1,   -1,   "a/b",      0,   "\"a\\/b\":"         },
+     {   L_,     0,     -1,   -1,   "a\tb",     0,   "\"a\\tb\":"         },
+     {   L_,     0,     -1,   -1,   "\x01",     0,   "\"\\u0001\":"       },
+     {   L_,     0,     -1,   -1,   "a\x7f",    0,   "\"a\x7f\":"         },
+     {   L_,     0,     -1,   -1,   "\xc3\xa9", 0,   "\"\xc3\xa9\":"      },
+     {   L_,     1,      1,    2,   "a/b",      0,   "  \"a\\/b\" : "     },
+
+     {   L_,     0,     -1,   -1,   "\xff",    -1,   ""                   },
+     {   L_,     1,      1,    2,   "a\xff",   -1,   "  "                 },
         };
         const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -1008,6 +1113,25 @@ int main(int argc, char *argv[])
             ASSERTV(LINE, EXP_RC, rc, EXP_RC == rc);
             ASSERTV(LINE, EXP, os.str(), EXP == os.str());
         }
+
+        if (verbose) cout << "Testing long element names" << endl;
+
+        for (int len = 120; len < 140; ++len) {
+            for (int style = 0; style < 2; ++style) {
+                const bsl::string NAME(len, 'x');
+                const char        *SEP = style ? " : " : ":";
+                const bsl::string  EXP = '"' + NAME + '"' + SEP;
+
+                bsl::ostringstream os;
+
+                Obj mX(os, style);
+
+                const int rc = mX.openMember(NAME);
+
+                ASSERTV(len, style, rc, 0 == rc);
+                ASSERTV(len, style, os.str(), EXP == os.str());
+            }
+        }
 #undef NL
       } break;
       case 6: {
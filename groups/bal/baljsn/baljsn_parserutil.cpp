@@ -22,8 +22,7 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bsl_algorithm.h>
 #include <bsl_cmath.h>
 #include <bsl_cctype.h>
-#include <bsl_cerrno.h>
-#include <bsl_cstdlib.h>
+#include <bsl_charconv.h>
 #include <bsl_cstring.h>
 #include <bsl_iosfwd.h>
 #include <bsl_limits.h>
@@ -363,24 +362,19 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
         return loadInfOrNan(value, data);                             // RETURN
     }
 
-    const int k_MAX_STRING_LENGTH = 63;
-    char      buffer[k_MAX_STRING_LENGTH + 1];
+    // Unlike 'strtod', 'from_chars' does not skip leading whitespace or
+    // accept hexadecimal input, neither of which is valid JSON.  Numbers too
+    // large to represent, or too small to represent other than by zero, are
+    // reported as out of range, and are rejected as before.
 
-    bdlma::BufferedSequentialAllocator allocator(buffer,
-                                                 k_MAX_STRING_LENGTH + 1);
-    bsl::string                        dataString(data.data(),
-                                                  data.length(),
-                                                  &allocator);
-
-    char   *endPtr = 0;
-    errno          = 0;
-    double  tmp    = bsl::strtod(dataString.c_str(), &endPtr);
-
-    if (endPtr    != dataString.end()
-     || (0        == tmp && 0 != errno)
-     ||  HUGE_VAL == tmp
-     || -HUGE_VAL == tmp
-     || !bdlb::CharType::isDigit(*(dataString.end() - 1))) {
+    const char *end = data.data() + data.length();
+
+    double                 tmp;
+    bsl::from_chars_result sts = bsl::from_chars(data.data(), end, tmp);
+
+    if (bsl::ErrcEnum() != sts.ec
+     || end             != sts.ptr
+     || !bdlb::CharType::isDigit(*(end - 1))) {
         return -1;                                                    // RETURN
     }
 
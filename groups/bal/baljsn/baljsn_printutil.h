@@ -90,10 +90,11 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_iso8601util.h>
 #include <bdlt_datetimeinterval.h>
 
+#include <bslalg_numericformatterutil.h>
+
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
-#include <bsl_c_stdio.h>
 #include <bsl_cmath.h>
 #include <bsl_iomanip.h>
 #include <bsl_ios.h>
@@ -299,23 +300,23 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         }
       } break;
       default: {
-        const int k_SIZE = 32;
-        char      buffer[k_SIZE];
+        typedef bslalg::NumericFormatterUtil FormatterUtil;
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+        // Format as "%.*g" would, but without the overhead of 'snprintf'.
 
-        const int len = snprintf(buffer,
-                                 k_SIZE,
-                                 "%-1.*g",
-                                 maxStreamPrecision<TYPE>(options),
-                                 value);
+        const int k_SIZE = 32;
+        char      buffer[k_SIZE];
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-        stream.write(buffer, len);
+        const char *end = FormatterUtil::toChars(
+                                            buffer,
+                                            buffer + k_SIZE,
+                                            value,
+                                            FormatterUtil::e_GENERAL,
+                                            maxStreamPrecision<TYPE>(options));
+        if (!end) {
+            return -1;                                                // RETURN
+        }
+        stream.write(buffer, end - buffer);
       }
     }
     return 0;
@@ -6,13 +6,21 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
 #include <baljsn_parserutil.h>                 // for testing only
 
+#include <bdlb_bitutil.h>
 #include <bdlb_chartype.h>
 #include <bdlde_utf8util.h>
 #include <bdlsb_fixedmemoutstreambuf.h>
 
+#include <bsls_platform.h>
+
+#include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 #include <bsl_ios.h>
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 // IMPLEMENTATION NOTES
 // --------------------
 // The following table provides the various transitions that need to be handled
@@ -53,12 +61,55 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 //   END_OBJECT                   '}'         ']'              END_ARRAY
 //   END_ARRAY                    ']'         ']'              END_ARRAY
 //..
+//
+// The scanning functions operate on 'd_data_p' and 'd_dataLength', which
+// refer either to the internal string buffer, into which data is read from
+// the 'streambuf', or, when the tokenizer is reset to a 'bsl::string_view', to
+// the caller's contiguous input.  In the latter case the whole input is made
+// available by the first "read" (after being validated as UTF-8, if required),
+// and every subsequent "read" reports the end of input, so the scanning code
+// is shared between the two modes and never copies contiguous input.
+//
+// Most of the time spent tokenizing typical JSON is spent scanning the
+// contents of string literals for their closing quote, so that scan examines
+// 16 characters at a time where SSE2 is available.
 
 namespace BloombergLP {
 namespace {
 
-    static const char *WHITESPACE = " \n\t\v\f\r";
-    static const char *TOKENS     = "{}[]:,";
+    static const char *TOKENS = "{}[]:,";
+
+bsl::size_t numPlainStringChars(const char *begin, const char *end)
+    // Return the number of characters at the beginning of the specified
+    // range '[begin, end)' that are neither '"' nor '\\'.
+{
+    const char *position = begin;
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i quote     = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+
+    for (; end - position >= 16; position += 16) {
+        const __m128i chunk = _mm_loadu_si128(
+                                 reinterpret_cast<const __m128i *>(position));
+        const int     mask  = _mm_movemask_epi8(
+                                   _mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                                                _mm_cmpeq_epi8(chunk,
+                                                               backslash)));
+        if (mask) {
+            position += bdlb::BitUtil::numTrailingUnsetBits(
+                                            static_cast<bsl::uint32_t>(mask));
+            return position - begin;                                  // RETURN
+        }
+    }
+#endif
+
+    while (position < end && '"' != *position && '\\' != *position) {
+        ++position;
+    }
+
+    return position - begin;
+}
 
 }  // close unnamed namespace
 
@@ -69,8 +120,45 @@ namespace baljsn {
                               // ----------------
 
 // PRIVATE MANIPULATORS
+bool Tokenizer::readContiguousInput()
+{
+    bsl::size_t numRead = 0;
+    if (0 == d_readStatus && 0 == d_bufEndStatus && !d_input.empty()) {
+        numRead = d_input.length();
+
+        if (!d_allowNonUtf8StringLiterals) {
+            const char   *invalid = 0;
+            const IntPtr  sts     = bdlde::Utf8Util::numCodePointsIfValid(
+                                                             &invalid,
+                                                             d_input.data(),
+                                                             d_input.length());
+            if (sts < 0) {
+                d_bufEndStatus = static_cast<int>(sts);
+                numRead        = invalid - d_input.data();
+            }
+        }
+
+        d_data_p     = d_input.data();
+        d_dataLength = numRead;
+        d_input      = bsl::string_view();
+    }
+
+    if (0 == d_readStatus && 0 == numRead) {
+        d_readStatus = 0 == d_bufEndStatus
+                     ? k_EOF
+                     : d_bufEndStatus;
+    }
+
+    d_readOffset += numRead;
+    return 0 != numRead;
+}
+
 int Tokenizer::reloadStringBuffer()
 {
+    if (!d_streambuf_p) {
+        return readContiguousInput() ? 1 : 0;                         // RETURN
+    }
+
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
 
     bsl::size_t numRead;
@@ -108,11 +196,16 @@ int Tokenizer::reloadStringBuffer()
     d_readOffset += numRead;
     d_cursor = 0;
     d_stringBuffer.resize(numRead);
+    synchronizeData();
     return static_cast<int>(numRead);
 }
 
 int Tokenizer::expandBufferForLargeValue()
 {
+    if (!d_streambuf_p) {
+        return readContiguousInput() ? 0 : -1;                        // RETURN
+    }
+
     const bsl::string::size_type currLength = d_stringBuffer.length();
     d_stringBuffer.resize(currLength + k_MAX_STRING_SIZE);
 
@@ -149,11 +242,16 @@ int Tokenizer::expandBufferForLargeValue()
 
     d_readOffset += numRead;
     d_stringBuffer.resize(currLength + numRead);
+    synchronizeData();
     return numRead ? 0 : -1;
 }
 
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (!d_streambuf_p) {
+        return readContiguousInput() ? 1 : 0;                         // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -195,6 +293,7 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 
     d_readOffset += numRead;
     d_stringBuffer.resize(d_valueIter + numRead);
+    synchronizeData();
 
     return static_cast<int>(numRead);
 }
@@ -205,21 +304,33 @@ int Tokenizer::extractStringValue()
     char previousChar = 0;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
-
-            if ('\\' == d_stringBuffer[d_valueIter]
-             && '\\' == previousChar) {
-                previousChar = 0;
+        while (d_valueIter < d_dataLength) {
+            // Skip the characters that are neither quotes nor backslashes in
+            // bulk.  Only whether the previous character is a backslash
+            // matters, so 'previousChar' need not be the actual character.
+
+            const bsl::size_t numPlain = numPlainStringChars(
+                                                   d_data_p + d_valueIter,
+                                                   d_data_p + d_dataLength);
+            if (numPlain) {
+                d_valueIter  += numPlain;
+                previousChar  = 0;
+                if (d_valueIter >= d_dataLength) {
+                    break;
+                }
             }
-            else {
-                previousChar = d_stringBuffer[d_valueIter];
+
+            if ('"' == d_data_p[d_valueIter]) {
+                break;
             }
 
+            // The current character is a backslash.
+
+            previousChar = '\\' == previousChar ? 0 : '\\';
             ++d_valueIter;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= d_dataLength) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -266,13 +377,13 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
+        while (d_valueIter < d_dataLength
+            && !bdlb::CharType::isSpace(d_data_p[d_valueIter])
+            && !bsl::strchr(TOKENS, d_data_p[d_valueIter])) {
             ++d_valueIter;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= d_dataLength) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -310,10 +421,12 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
+        while (d_cursor < d_dataLength
+            && bdlb::CharType::isSpace(d_data_p[d_cursor])) {
+            ++d_cursor;
+        }
+
+        if (d_cursor < d_dataLength) {
             break;
         }
 
@@ -332,7 +445,7 @@ int Tokenizer::advanceToNextToken()
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= d_dataLength) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -351,7 +464,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        switch (d_stringBuffer[d_cursor]) {
+        switch (d_data_p[d_cursor]) {
           case '{': {
             if ((e_ELEMENT_NAME == d_tokenType && ':' == previousChar)
              || e_START_ARRAY   == d_tokenType
@@ -671,6 +784,10 @@ int Tokenizer::advanceToNextToken()
 
 int Tokenizer::resetStreamBufGetPointer()
 {
+    if (!d_streambuf_p) {
+        return -1;                                                    // RETURN
+    }
+
     if (d_cursor >= d_stringBuffer.size()) {
         return 0;                                                     // RETURN
     }
@@ -693,8 +810,7 @@ int Tokenizer::value(bslstl::StringRef *data) const
 {
     if ((e_ELEMENT_NAME == d_tokenType || e_ELEMENT_VALUE == d_tokenType) &&
         d_valueBegin != d_valueEnd) {
-        data->assign(&d_stringBuffer[d_valueBegin],
-                     &d_stringBuffer[d_valueEnd]);
+        data->assign(d_data_p + d_valueBegin, d_data_p + d_valueEnd);
         return 0;                                                     // RETURN
     }
     return -1;
@@ -19,6 +19,15 @@ BSLS_IDENT("$Id: $")
 // 'bsl::streambuf' containing JSON data with a tokenizer object and then call
 // the 'advanceToNextToken' function to extract individual data values.
 //
+// Alternatively, a tokenizer can be associated with JSON data that is already
+// in memory by passing a 'bsl::string_view' to 'reset'.  In that case the
+// data is tokenized in place: it is not copied into the tokenizer's internal
+// buffer, and the string references returned by 'value' refer directly into
+// the supplied data, which must therefore remain valid, and unmodified, until
+// the tokenizer is reset or destroyed.  Note that, when 'value' is used to
+// obtain an element name or a string value, no unescaping is performed by the
+// tokenizer in either case.
+//
 // This 'class' was created to be used by other components in the 'baljsn'
 // package and in most cases clients should use the 'baljsn_decoder' component
 // instead of using this 'class'.
@@ -138,6 +147,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -149,8 +159,9 @@ namespace baljsn {
 
 class Tokenizer {
     // This 'class' provides a mechanism for traversing JSON data stored in a
-    // 'bsl::streambuf' one node at a time and allows clients to access the
-    // data associated with that node, including its type and data value.
+    // 'bsl::streambuf', or in a contiguous region of memory, one node at a
+    // time and allows clients to access the data associated with that node,
+    // including its type and data value.
 
   public:
     // TYPES
@@ -220,7 +231,20 @@ class Tokenizer {
 
     bsl::string         d_stringBuffer;     // string buffer
 
-    bsl::streambuf     *d_streambuf_p;      // streambuf (held, not owned)
+    bsl::streambuf     *d_streambuf_p;      // streambuf (held, not owned),
+                                            // or 0 if tokenizing contiguous
+                                            // input
+
+    bsl::string_view    d_input;            // contiguous input (held, not
+                                            // owned) not yet made available
+                                            // for tokenizing
+
+    const char         *d_data_p;           // data being tokenized: the
+                                            // contents of 'd_stringBuffer' or
+                                            // the contiguous input (held, not
+                                            // owned)
+
+    bsl::size_t         d_dataLength;       // length of 'd_data_p'
 
     bsl::size_t         d_cursor;           // current cursor
 
@@ -290,6 +314,20 @@ class Tokenizer {
         // 'd_streambuf_p') to the end of the current sequence of characters.
         // Return 0 on success and a non-zero value otherwise.
 
+    bool readContiguousInput();
+        // Make the contiguous input, 'd_input', available for tokenizing,
+        // unless it has already been made available or a read error has
+        // occurred.  Return 'true' if any input was made available, and
+        // 'false' otherwise, in which case the read status is set to indicate
+        // the end of input or the UTF-8 error that was encountered.  Note that
+        // if UTF-8 checking is enabled only the valid prefix of the input is
+        // made available.
+
+    void synchronizeData();
+        // Set the data being tokenized, 'd_data_p' and 'd_dataLength', to the
+        // contents of the internal string buffer, 'd_stringBuffer'.  This
+        // function must be called whenever 'd_stringBuffer' is modified.
+
     ContextType popContext();
         // If the 'd_contextStack' is empty, return 'e_NO_CONTEXT', otherwise
         // pop the top context from the 'd_contextStack' stack, and return it.
@@ -336,6 +374,16 @@ class Tokenizer {
         // change the value of the 'allowStandAloneValues',
         // 'allowHeterogenousArrays', or 'allowNonUtf8StringLiterals' options.
 
+    void reset(const bsl::string_view& input);
+        // Reset this tokenizer to read data from the specified contiguous
+        // 'input'.  The string references returned by the 'value' accessor
+        // refer into 'input', which must remain valid, and unmodified, until
+        // this tokenizer is reset or destroyed.  Note that the reader will not
+        // be on a valid node until 'advanceToNextToken' is called.  Note that
+        // this function does not change the value of the
+        // 'allowStandAloneValues', 'allowHeterogenousArrays', or
+        // 'allowNonUtf8StringLiterals' options.
+
     int advanceToNextToken();
         // Move to the next token in the data steam.  Return 0 on success and a
         // non-zero value otherwise.  Each call to 'advanceToNextToken'
@@ -354,7 +402,8 @@ class Tokenizer {
         // from where this object stopped.  Also note that this call implies
         // the end of processing for this object and any subsequent methods
         // invoked on this object should only be done after calling 'reset' and
-        // specifying a new 'streambuf'.
+        // specifying a new 'streambuf'.  Also note that a non-zero value is
+        // returned if this tokenizer was last reset to read contiguous input.
 
     void setAllowHeterogenousArrays(bool value);
         // Set the 'allowHeterogenousArrays' option to the specified 'value'.
@@ -429,6 +478,13 @@ class Tokenizer {
 // ============================================================================
 
 // PRIVATE MANIPULATORS
+inline
+void Tokenizer::synchronizeData()
+{
+    d_data_p     = d_stringBuffer.data();
+    d_dataLength = d_stringBuffer.length();
+}
+
 inline
 Tokenizer::ContextType Tokenizer::popContext()
 {
@@ -464,6 +520,9 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 , d_stackAllocator(d_stackBuffer.buffer(), k_STACKBUFSIZE, basicAllocator)
 , d_stringBuffer(&d_allocator)
 , d_streambuf_p(0)
+, d_input()
+, d_data_p(0)
+, d_dataLength(0)
 , d_cursor(0)
 , d_valueBegin(0)
 , d_valueEnd(0)
@@ -478,6 +537,7 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 , d_allowNonUtf8StringLiterals(true)
 {
     d_stringBuffer.reserve(k_MAX_STRING_SIZE);
+    synchronizeData();
     d_contextStack.clear();
     pushContext(e_OBJECT_CONTEXT);
 }
@@ -492,7 +552,29 @@ inline
 void Tokenizer::reset(bsl::streambuf *streambuf)
 {
     d_streambuf_p  = streambuf;
+    d_input        = bsl::string_view();
+    d_stringBuffer.clear();
+    synchronizeData();
+    d_cursor       = 0;
+    d_valueBegin   = 0;
+    d_valueEnd     = 0;
+    d_valueIter    = 0;
+    d_readOffset   = 0;
+    d_tokenType    = e_BEGIN;
+    d_readStatus   = 0;
+    d_bufEndStatus = 0;
+
+    d_contextStack.clear();
+    pushContext(e_OBJECT_CONTEXT);
+}
+
+inline
+void Tokenizer::reset(const bsl::string_view& input)
+{
+    d_streambuf_p  = 0;
+    d_input        = input;
     d_stringBuffer.clear();
+    synchronizeData();
     d_cursor       = 0;
     d_valueBegin   = 0;
     d_valueEnd     = 0;
@@ -20,6 +20,7 @@
 #include <bsl_limits.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_vector.h>
 
 #include <bsl_cstring.h>
@@ -50,6 +51,7 @@ using bsl::endl;
 //
 // MANIPULATORS
 // [ 9] void reset(bsl::streambuf &streamBuf);
+// [19] void reset(const bsl::string_view& input);
 // [12] void resetStreamBufGetPointer();
 // [13] void setAllowStandAloneValues(bool value);
 // [14] void setAllowHeterogenousArrays(bool value);
@@ -67,6 +69,7 @@ using bsl::endl;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [18] USAGE EXAMPLE
+// [19] CONTIGUOUS INPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -326,6 +329,36 @@ void confirmStreamBufReset(bsl::streambuf     *sb,
     }
 }
 
+bsl::string tokenizeAll(Obj *tokenizer, const bsl::string_view& input)
+    // Advance the specified 'tokenizer' until 'advanceToNextToken' fails, and
+    // return a description of each token visited, followed by the final
+    // 'readStatus' and 'readOffset' of 'tokenizer'.  If the specified 'input'
+    // is not empty, also verify that every value refers into 'input'.
+{
+    bsl::ostringstream oss;
+
+    int rc;
+    do {
+        rc = tokenizer->advanceToNextToken();
+        oss << rc << ' ' << tokenizer->tokenType();
+
+        bslstl::StringRef value;
+        if (0 == tokenizer->value(&value)) {
+            oss << " <" << value << '>';
+
+            if (!input.empty()) {
+                ASSERTV(input.data() <= value.data());
+                ASSERTV(value.data() + value.length() <=
+                                                input.data() + input.length());
+            }
+        }
+        oss << '\n';
+    } while (0 == rc);
+
+    oss << tokenizer->readStatus() << ' ' << tokenizer->readOffset();
+    return oss.str();
+}
+
 const Utf8Util::ErrorStatus EIT = Utf8Util::k_END_OF_INPUT_TRUNCATION;
 const Utf8Util::ErrorStatus UCO = Utf8Util::k_UNEXPECTED_CONTINUATION_OCTET;
 const Utf8Util::ErrorStatus NCO = Utf8Util::k_NON_CONTINUATION_OCTET;
@@ -489,6 +522,223 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING CONTIGUOUS INPUT
+        //
+        // Concerns:
+        //: 1 A tokenizer reset to contiguous input produces the same tokens,
+        //:   values, errors, read status, and read offset as a tokenizer
+        //:   reading the same data from a 'streambuf', for every combination
+        //:   of options.
+        //:
+        //: 2 The values of tokens read from contiguous input refer into that
+        //:   input.
+        //:
+        //: 3 Escaped quotes and backslashes in string literals are handled
+        //:   correctly wherever they occur, in both modes.
+        //:
+        //: 4 Invalid UTF-8 in contiguous input is detected, at the same
+        //:   offset as in a 'streambuf', if UTF-8 checking is enabled.
+        //:
+        //: 5 A tokenizer can be reset from contiguous input to a 'streambuf'
+        //:   and vice versa.
+        //
+        // Plan:
+        //: 1 Tokenize a table of valid and invalid JSON documents both from a
+        //:   'streambuf' and from contiguous input, for every combination of
+        //:   options, using a single object for both, and compare the
+        //:   results.  Verify that each value obtained from contiguous input
+        //:   refers into that input.  (C-1..2, 5)
+        //:
+        //: 2 Generate string literals containing escape sequences at every
+        //:   offset, tokenize documents containing them as both names and
+        //:   values, in both modes, and verify the values.  (C-3)
+        //:
+        //: 3 Embed each string of the 'UTF8_DATA' table in a document and
+        //:   verify that tokenizing it with UTF-8 checking enabled gives the
+        //:   same results in both modes.  (C-4)
+        //:
+        //: 4 Verify that 'resetStreamBufGetPointer' fails for contiguous
+        //:   input.
+        //
+        // Testing:
+        //   void reset(const bsl::string_view& input);
+        //   CONTIGUOUS INPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONTIGUOUS INPUT" << endl
+                          << "========================" << endl;
+
+        static const struct {
+            int         d_line;   // source line number
+            const char *d_json_p; // JSON input
+        } DATA[] = {
+            { L_, "" },
+            { L_, WS },
+            { L_, "{}" },
+            { L_, "[]" },
+            { L_, "{\"a\":1}" },
+            { L_, WS "{" WS "\"a\"" WS ":" WS "1" WS "}" WS },
+            { L_, "{ \"name\" : \"value\", \"n\" : -1.5e3, \"t\" : true }" },
+            { L_, "{\"arr\":[1, 2, \"x\", {\"y\": null}], \"z\": []}" },
+            { L_, "[\"esc\\\"aped\", \"back\\\\slash\\\\\", \"\\u00e9\"]" },
+            { L_, "[\"a\", 1, {}, []]" },
+            { L_, "{\"a\":{\"b\":[[],[{}]]}}" },
+            { L_, "  \"standalone\"  " },
+            { L_, "12345" },
+            { L_, "12345   " },
+            { L_, "{\"a\" 1}" },
+            { L_, "[1,,2]" },
+            { L_, "{\"unterminated" },
+            { L_, "[\"unterminated\\\"" },
+            { L_, "[1, 2" },
+            { L_, "{} x" },
+            { L_, "{\"k\": \"\xc3\xa9\"}" },
+            { L_, "{\"k\": \"\xff\"}" },
+            { L_, "{\"k\": \"abc\xe2\x82\"}" },
+            { L_, "{\"k\": \"abc\"} \xe2\x82" },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        Obj mX;  const Obj& X = mX;
+
+        if (verbose) cout << "Compare with 'streambuf' input.\n";
+        {
+            for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+                const int              LINE = DATA[ti].d_line;
+                const bsl::string_view JSON(DATA[ti].d_json_p);
+
+                for (int options = 0; options < 8; ++options) {
+                    mX.setAllowStandAloneValues(options & 1);
+                    mX.setAllowHeterogenousArrays(options & 2);
+                    mX.setAllowNonUtf8StringLiterals(options & 4);
+
+                    bdlsb::FixedMemInStreamBuf isb(JSON.data(),
+                                                   JSON.length());
+                    mX.reset(&isb);
+                    const bsl::string EXP = tokenizeAll(&mX,
+                                                        bsl::string_view());
+
+                    mX.reset(JSON);
+                    const bsl::string RESULT = tokenizeAll(&mX, JSON);
+
+                    if (veryVerbose) { P_(LINE); P(RESULT); }
+
+                    ASSERTV(LINE, options, EXP, RESULT, EXP == RESULT);
+                    ASSERTV(LINE, 0 != mX.resetStreamBufGetPointer());
+                    ASSERTV(LINE, X.allowNonUtf8StringLiterals(),
+                            !(options & 4) ==
+                                             !X.allowNonUtf8StringLiterals());
+                }
+            }
+        }
+
+        if (verbose) cout << "Escape sequences.\n";
+        {
+            static const char *const ESCAPES[] = {
+                "\\\"", "\\\\", "\\\\\\\"", "\\\\\\\\", "\\n", "\\u0041", "\\/"
+            };
+            enum { k_NUM_ESCAPES = sizeof ESCAPES / sizeof *ESCAPES };
+
+            for (int ti = 0; ti < k_NUM_ESCAPES; ++ti) {
+                for (int length = 0; length <= 40; ++length) {
+                    for (int offset = 0; offset <= length; ++offset) {
+                        bsl::string content(offset, 'x');
+                        content += ESCAPES[ti];
+                        content.append(length - offset, 'y');
+
+                        const bsl::string JSON = "{\"" + content + "\":\""
+                                               + content + "\"}";
+
+                        for (int mode = 0; mode < 2; ++mode) {
+                            bdlsb::FixedMemInStreamBuf isb(JSON.data(),
+                                                           JSON.length());
+                            if (mode) {
+                                mX.reset(bsl::string_view(JSON));
+                            }
+                            else {
+                                mX.reset(&isb);
+                            }
+
+                            bslstl::StringRef value;
+
+                            ASSERTV(0 == mX.advanceToNextToken());
+                            ASSERTV(Obj::e_START_OBJECT == X.tokenType());
+
+                            ASSERTV(0 == mX.advanceToNextToken());
+                            ASSERTV(Obj::e_ELEMENT_NAME == X.tokenType());
+                            ASSERTV(0 == X.value(&value));
+                            ASSERTV(ti, offset, mode, value,
+                                    content == value);
+
+                            ASSERTV(0 == mX.advanceToNextToken());
+                            ASSERTV(Obj::e_ELEMENT_VALUE == X.tokenType());
+                            ASSERTV(0 == X.value(&value));
+                            ASSERTV(ti, offset, mode, value,
+                                    '"' + content + '"' == value);
+
+                            ASSERTV(0 == mX.advanceToNextToken());
+                            ASSERTV(Obj::e_END_OBJECT == X.tokenType());
+
+                            ASSERTV(0 != mX.advanceToNextToken());
+                            ASSERTV(Obj::k_EOF == X.readStatus());
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "Large values.\n";
+        {
+            bsl::string content;
+            for (int i = 0; content.length() < 20000; ++i) {
+                content += "abcdefghijklmnopqrstuvwxyz"
+                           "ABCDEFGHIJKLMNOPQRSTUVWXYZ" + i % 52;
+                if (0 == i % 5) {
+                    content += "\\\"";
+                }
+            }
+
+            const bsl::string JSON = "[\"" + content + "\", 12345]";
+
+            bdlsb::FixedMemInStreamBuf isb(JSON.data(), JSON.length());
+            mX.reset(&isb);
+            const bsl::string EXP = tokenizeAll(&mX, bsl::string_view());
+
+            mX.reset(bsl::string_view(JSON));
+            const bsl::string RESULT = tokenizeAll(&mX, JSON);
+
+            ASSERTV(EXP == RESULT);
+            ASSERTV(bsl::string::npos != RESULT.find(content));
+        }
+
+        if (verbose) cout << "Invalid UTF-8.\n";
+        {
+            mX.setAllowStandAloneValues(true);
+            mX.setAllowHeterogenousArrays(true);
+            mX.setAllowNonUtf8StringLiterals(false);
+
+            for (int ti = 0; ti < k_NUM_UTF8_DATA; ++ti) {
+                const int         LINE = UTF8_DATA[ti].d_lineNum;
+                const bsl::string JSON = bsl::string("[\"")
+                                       + UTF8_DATA[ti].d_utf8_p
+                                       + "\", 1]";
+
+                bdlsb::FixedMemInStreamBuf isb(JSON.data(), JSON.length());
+                mX.reset(&isb);
+                const bsl::string EXP = tokenizeAll(&mX, bsl::string_view());
+
+                mX.reset(bsl::string_view(JSON));
+                const bsl::string RESULT = tokenizeAll(&mX, JSON);
+
+                ASSERTV(LINE, EXP, RESULT, EXP == RESULT);
+                ASSERTV(LINE, X.readStatus(), UTF8_DATA[ti].d_status,
+                        (UTF8_DATA[ti].d_status < 0) == (X.readStatus() < 0));
+            }
+        }
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
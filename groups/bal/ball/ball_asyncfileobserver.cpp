@@ -42,7 +42,9 @@ namespace {
 
 enum {
     k_DEFAULT_FIXED_QUEUE_SIZE = 8192,
-    k_FORCE_WARN_THRESHOLD     = 5000
+    k_FORCE_WARN_THRESHOLD     = 5000,
+    k_MAX_BATCH_SIZE           = 256   // maximum number of records published
+                                       // per flush of the log file
 };
 
 static const char *const k_LOG_CATEGORY = "BALL.ASYNCFILEOBSERVER";
@@ -86,18 +88,36 @@ void AsyncFileObserver::publishThreadEntryPoint()
                                           bslmt::ThreadUtil::selfIdAsUint64());
 
     while (!done) {
+        // Block for the next log record, then drain (without blocking) any
+        // further records already on the queue, so that the whole batch is
+        // written to the log file with a single flush.  Records are batched
+        // only while the observer is not shutting down.
+
         AsyncFileObserver_Record asyncRecord = d_recordQueue.popFront();
 
-        // Publish the next log record on the queue only if the observer is not
-        // shutting down.
+        while (true) {
+            if (Transmission::e_END ==
+                                    asyncRecord.d_context.transmissionCause()
+             || d_shuttingDownFlag) {
+                done = true;
+                break;
+            }
+
+            d_batch.push_back(asyncRecord.d_record);
 
-        if (Transmission::e_END == asyncRecord.d_context.transmissionCause()
-            || d_shuttingDownFlag) {
-            done = true;
+            if (k_MAX_BATCH_SIZE <= static_cast<int>(d_batch.size())
+             || 0 != d_recordQueue.tryPopFront(&asyncRecord)) {
+                break;
+            }
         }
-        else {
-            d_fileObserver.publish(*asyncRecord.d_record,
-                                   asyncRecord.d_context);
+
+        if (!d_batch.empty()) {
+            d_fileObserver.publishBatch(d_batch.data(),
+                                        static_cast<int>(d_batch.size()));
+
+            // Release the shared references to the published records.
+
+            d_batch.clear();
         }
 
         // Publish the count of dropped records.  To avoid repeatedly
@@ -182,6 +202,7 @@ void AsyncFileObserver::construct()
             bsl::allocator<bsl::function<void()> >(d_allocator_p),
             bdlf::MemFnUtil::memFn(&AsyncFileObserver::publishThreadEntryPoint,
                                    this));
+    d_batch.reserve(k_MAX_BATCH_SIZE);
     d_droppedRecordWarning.fixedFields().setFileName(__FILE__);
     d_droppedRecordWarning.fixedFields().setCategory(k_LOG_CATEGORY);
     d_droppedRecordWarning.fixedFields().setSeverity(Severity::e_WARN);
@@ -195,6 +216,7 @@ AsyncFileObserver::AsyncFileObserver(bslma::Allocator *basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
 , d_droppedRecordWarning(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -207,6 +229,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
 , d_droppedRecordWarning(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -220,6 +243,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
 , d_droppedRecordWarning(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -234,6 +258,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
 , d_droppedRecordWarning(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -250,6 +275,7 @@ AsyncFileObserver::AsyncFileObserver(
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
+, d_batch(basicAllocator)
 , d_droppedRecordWarning(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
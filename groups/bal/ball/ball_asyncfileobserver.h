@@ -164,6 +164,15 @@ BSLS_IDENT("$Id: $")
 // record count is reset to 0 after each such warning is published, so each
 // dropped record is counted only once.
 //
+// The publication thread drains the queue in batches: after blocking for the
+// next record, it removes (without blocking) any further records that are
+// already on the queue, up to an implementation-defined maximum batch size,
+// and publishes them together.  The records of a batch are written to the log
+// file with a single flush (and so, typically, a single 'write' system call),
+// rather than one flush per record, which substantially increases the rate at
+// which the publication thread can drain a backlog of records.  The order,
+// format, and rotation behavior of published records are unaffected.
+//
 ///Log Record Formatting
 ///---------------------
 // By default, the output format of published log records (whether to 'stdout'
@@ -487,6 +496,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace ball {
@@ -550,6 +560,13 @@ class AsyncFileObserver : public Observer {
                                                      // publication thread
                                                      // entry point functor
 
+    bsl::vector<bsl::shared_ptr<const Record> >
+                                   d_batch;          // records removed from
+                                                     // the queue and awaiting
+                                                     // publication (used only
+                                                     // by the publication
+                                                     // thread)
+
     Record                         d_droppedRecordWarning;
                                                      // cached record used for
                                                      // publishing the count of
@@ -128,7 +128,8 @@ using bsl::flush;
 // [ 7] CONCERN: LOGGING TO A FAILING STREAM
 // [ 5] CONCERN: LOG MESSAGE DROP
 // [ 9] CONCERN: ROTATION
-// [12] USAGE EXAMPLE
+// [12] CONCERN: BATCHED PUBLICATION
+// [13] USAGE EXAMPLE
 
 // Note assert and debug macros all output to 'cerr' instead of cout, unlike
 // most other test drivers.  This is necessary because test case 2 plays tricks
@@ -623,7 +624,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -775,6 +776,88 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // CONCERN: BATCHED PUBLICATION
+        //
+        // Concerns:
+        //: 1 When the publication thread drains a backlog of queued records in
+        //:   batches, every record is written to the log file exactly once,
+        //:   in the order in which it was published.
+        //:
+        //: 2 Records remaining on the queue when 'stopPublicationThread' is
+        //:   called are published before the thread exits.
+        //
+        // Plan:
+        //: 1 Create an async file observer, configure a log format that
+        //:   writes only the line number of each record, and publish a
+        //:   sequence of records having consecutive line numbers (spanning
+        //:   many batches) while the publication thread is not running.
+        //:
+        //: 2 Start and then immediately stop the publication thread, and
+        //:   verify that the log file contains exactly the published line
+        //:   numbers, in order.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: BATCHED PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: BATCHED PUBLICATION"
+                          << "\n============================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        enum { k_NUM_RECORDS = 3000, k_MAX_QUEUE_LENGTH = 4096 };
+
+        Obj        mX(ball::Severity::e_OFF,
+                      false,
+                      k_MAX_QUEUE_LENGTH,
+                      ball::Severity::e_TRACE,
+                      &ta);
+        const Obj& X = mX;
+
+        mX.setLogFormat("%l\n", "%l\n");
+        ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+        ball::Context context;
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, &ta);
+            record->fixedFields().setSeverity(ball::Severity::e_ERROR);
+            record->fixedFields().setLineNumber(i);
+
+            mX.publish(record, context);
+        }
+        ASSERTV(X.recordQueueLength(), k_NUM_RECORDS == X.recordQueueLength());
+
+        ASSERT(0 == mX.startPublicationThread());
+        ASSERT(0 == mX.stopPublicationThread());
+
+        ASSERTV(X.recordQueueLength(), 0 == X.recordQueueLength());
+
+        mX.disableFileLogging();
+
+        bsl::ifstream fs(fileName.c_str());
+        ASSERT(fs.is_open());
+
+        bsl::string line;
+        int         numLines = 0;
+        while (getline(fs, line)) {
+            const int lineNumber = bsl::atoi(line.c_str());
+
+            ASSERTV(numLines, lineNumber, numLines == lineNumber);
+            ++numLines;
+        }
+        fs.close();
+
+        ASSERTV(numLines, k_NUM_RECORDS == numLines);
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING 'recordQueueLength'
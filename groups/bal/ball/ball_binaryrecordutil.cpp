@@ -0,0 +1,374 @@
+// ball_binaryrecordutil.cpp                                          -*-C++-*-
+#include <ball_binaryrecordutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_binaryrecordutil_cpp,"$Id$ $CSID$")
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_userfields.h>
+#include <ball_userfieldtype.h>
+#include <ball_userfieldvalue.h>
+
+#include <bdlma_localsequentialallocator.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+
+#include <bslx_byteinstream.h>
+#include <bslx_byteoutstream.h>
+#include <bslx_marshallingutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_istream.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+const int k_VERSION_SELECTOR    = 20170401;
+    // BDEX version selector used to externalize records; it selects version 2
+    // of the 'bdlt::Datetime' and 'bdlt::DatetimeTz' formats, which encode
+    // microseconds
+
+const int k_DATETIME_VERSION    = 2;
+    // BDEX version of the 'bdlt::Datetime' and 'bdlt::DatetimeTz' formats
+
+const int k_HEADER_SIZE         = bslx::MarshallingUtil::k_SIZEOF_INT32;
+    // number of bytes in the length that precedes each record
+
+const int k_LOCAL_BUFFER_SIZE   = 512;
+    // size of the stack buffers used to write and read typical records
+    // without allocating
+
+const int k_READ_CHUNK_SIZE     = 4096;
+    // maximum number of bytes of a record reserved before they are read,
+    // bounding the memory allocated for a record having a corrupt length
+
+void putBytes(bslx::ByteOutStream& stream, const char *data, int length)
+    // Write to the specified 'stream' the specified 'length' followed by the
+    // specified 'length' bytes at the specified 'data'.
+{
+    stream.putLength(length);
+    if (length) {
+        stream.putArrayInt8(data, length);
+    }
+}
+
+void getBytes(bsl::string *value, bslx::ByteInStream& stream)
+    // Read from the specified 'stream' a length followed by that many bytes,
+    // and load the bytes into the specified 'value'.  If the length exceeds
+    // the number of unread bytes of 'stream', invalidate 'stream'.
+{
+    int length;
+    stream.getLength(length);
+    if (!stream) {
+        return;                                                       // RETURN
+    }
+    if (stream.length() - stream.cursor() < static_cast<bsl::size_t>(length)) {
+        stream.invalidate();
+        return;                                                       // RETURN
+    }
+    value->resize(length);
+    if (length) {
+        stream.getArrayInt8(&(*value)[0], length);
+    }
+}
+
+int readBody(bsl::vector<char> *body, bsl::istream& input)
+    // Read from the specified 'input' the length of the next record followed
+    // by that many bytes, and load the bytes into the specified 'body'.
+    // Return 0 on success, 1 if 'input' has no more data, and -1 if the data
+    // is truncated.
+{
+    char header[k_HEADER_SIZE];
+
+    input.read(header, k_HEADER_SIZE);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                        k_HEADER_SIZE != input.gcount())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0 == input.gcount() && input.eof() ? 1 : -1;           // RETURN
+    }
+
+    int length;
+    bslx::MarshallingUtil::getInt32(&length, header);
+    if (length < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    // Grow 'body' only as its bytes are actually read, so that a corrupt
+    // length does not provoke a huge allocation.
+
+    body->clear();
+    while (static_cast<int>(body->size()) < length) {
+        const bsl::size_t offset = body->size();
+        const int         chunk  = bsl::min(length - static_cast<int>(offset),
+                                            k_READ_CHUNK_SIZE);
+
+        body->resize(offset + chunk);
+        input.read(body->data() + offset, chunk);
+        if (chunk != input.gcount()) {
+            return -1;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                          // -----------------------
+                          // struct BinaryRecordUtil
+                          // -----------------------
+
+// CLASS METHODS
+int BinaryRecordUtil::formatRecords(bsl::ostream&          stream,
+                                    bsl::istream&          input,
+                                    const RecordFormatter& formatter,
+                                    int                   *numRecords)
+{
+    BSLS_ASSERT(formatter);
+
+    Record record;
+    int    count = 0;
+    int    rc;
+
+    while (0 == (rc = readRecord(&record, input))) {
+        formatter(stream, record);
+        ++count;
+    }
+
+    if (numRecords) {
+        *numRecords = count;
+    }
+    return 1 == rc ? 0 : rc;
+}
+
+int BinaryRecordUtil::readRecord(Record *record, bsl::istream& input)
+{
+    BSLS_ASSERT(record);
+
+    bdlma::LocalSequentialAllocator<k_LOCAL_BUFFER_SIZE> allocator;
+
+    bsl::vector<char> body(&allocator);
+    body.reserve(k_LOCAL_BUFFER_SIZE / 2);
+
+    int rc = readBody(&body, input);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    bslx::ByteInStream in(body.data(), body.size());
+
+    char version;
+    in.getInt8(version);
+    if (!in) {
+        return -1;                                                    // RETURN
+    }
+    if (k_FORMAT_VERSION != version) {
+        return -2;                                                    // RETURN
+    }
+
+    bdlt::Datetime      timestamp;
+    int                 processID;
+    bsls::Types::Uint64 threadID;
+    int                 severity;
+    int                 lineNumber;
+
+    timestamp.bdexStreamIn(in, k_DATETIME_VERSION);
+    in.getInt32(processID);
+    in.getUint64(threadID);
+    in.getInt32(severity);
+    in.getInt32(lineNumber);
+    if (!in) {
+        return -1;                                                    // RETURN
+    }
+
+    RecordAttributes& attributes = record->fixedFields();
+
+    attributes.setTimestamp(timestamp);
+    attributes.setProcessID(processID);
+    attributes.setThreadID(threadID);
+    attributes.setSeverity(severity);
+    attributes.setLineNumber(lineNumber);
+
+    bsl::string text(&allocator);
+
+    getBytes(&text, in);
+    if (!in) {
+        return -1;                                                    // RETURN
+    }
+    attributes.setFileName(text.c_str());
+
+    getBytes(&text, in);
+    if (!in) {
+        return -1;                                                    // RETURN
+    }
+    attributes.setCategory(text.c_str());
+
+    getBytes(&text, in);
+    if (!in) {
+        return -1;                                                    // RETURN
+    }
+    attributes.clearMessage();
+    attributes.messageStreamBuf().sputn(text.data(), text.length());
+
+    UserFields& userFields = record->customFields();
+    userFields.removeAll();
+
+    int numUserFields;
+    in.getLength(numUserFields);
+    if (!in) {
+        return -1;                                                    // RETURN
+    }
+
+    for (int i = 0; i < numUserFields; ++i) {
+        char type;
+        in.getInt8(type);
+        if (!in) {
+            return -1;                                                // RETURN
+        }
+
+        switch (type) {
+          case ball::UserFieldType::e_VOID: {
+            userFields.appendNull();
+          } break;
+          case ball::UserFieldType::e_INT64: {
+            bsls::Types::Int64 value;
+            in.getInt64(value);
+            userFields.appendInt64(value);
+          } break;
+          case ball::UserFieldType::e_DOUBLE: {
+            double value;
+            in.getFloat64(value);
+            userFields.appendDouble(value);
+          } break;
+          case ball::UserFieldType::e_STRING: {
+            getBytes(&text, in);
+            userFields.appendString(text);
+          } break;
+          case ball::UserFieldType::e_DATETIMETZ: {
+            bdlt::DatetimeTz value;
+            value.bdexStreamIn(in, k_DATETIME_VERSION);
+            userFields.appendDatetimeTz(value);
+          } break;
+          case ball::UserFieldType::e_CHAR_ARRAY: {
+            getBytes(&text, in);
+            userFields.appendCharArray(
+                    bsl::vector<char>(text.begin(), text.end(), &allocator));
+          } break;
+          default: {
+            in.invalidate();
+          }
+        }
+        if (!in) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    // Any bytes remaining in 'body' were written by a later version of the
+    // format, and are ignored.
+
+    return 0;
+}
+
+void BinaryRecordUtil::writeRecord(bsl::ostream& stream, const Record& record)
+{
+    bdlma::LocalSequentialAllocator<k_LOCAL_BUFFER_SIZE> allocator;
+
+    bslx::ByteOutStream out(k_VERSION_SELECTOR,
+                            k_LOCAL_BUFFER_SIZE / 2,
+                            &allocator);
+
+    const RecordAttributes& attributes = record.fixedFields();
+
+    out.putInt8(k_FORMAT_VERSION);
+    attributes.timestamp().bdexStreamOut(out, k_DATETIME_VERSION);
+    out.putInt32(attributes.processID());
+    out.putUint64(attributes.threadID());
+    out.putInt32(attributes.severity());
+    out.putInt32(attributes.lineNumber());
+
+    const char *fileName = attributes.fileName();
+    const char *category = attributes.category();
+
+    putBytes(out, fileName, static_cast<int>(bsl::strlen(fileName)));
+    putBytes(out, category, static_cast<int>(bsl::strlen(category)));
+
+    const bslstl::StringRef message = attributes.messageRef();
+    putBytes(out, message.data(), static_cast<int>(message.length()));
+
+    const UserFields& userFields = record.customFields();
+
+    out.putLength(userFields.length());
+    for (int i = 0; i < userFields.length(); ++i) {
+        const UserFieldValue& value = userFields.value(i);
+
+        out.putInt8(value.type());
+
+        switch (value.type()) {
+          case ball::UserFieldType::e_VOID: {
+          } break;
+          case ball::UserFieldType::e_INT64: {
+            out.putInt64(value.theInt64());
+          } break;
+          case ball::UserFieldType::e_DOUBLE: {
+            out.putFloat64(value.theDouble());
+          } break;
+          case ball::UserFieldType::e_STRING: {
+            const bsl::string& string = value.theString();
+            putBytes(out,
+                     string.data(),
+                     static_cast<int>(string.length()));
+          } break;
+          case ball::UserFieldType::e_DATETIMETZ: {
+            value.theDatetimeTz().bdexStreamOut(out, k_DATETIME_VERSION);
+          } break;
+          case ball::UserFieldType::e_CHAR_ARRAY: {
+            const bsl::vector<char>& array = value.theCharArray();
+            putBytes(out, array.data(), static_cast<int>(array.size()));
+          } break;
+        }
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!out)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        stream.setstate(bsl::ios_base::badbit);
+        return;                                                       // RETURN
+    }
+
+    char header[k_HEADER_SIZE];
+    bslx::MarshallingUtil::putInt32(header, static_cast<int>(out.length()));
+
+    stream.write(header, k_HEADER_SIZE);
+    stream.write(out.data(), out.length());
+    stream.flush();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
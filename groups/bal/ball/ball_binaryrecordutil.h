@@ -0,0 +1,196 @@
+// ball_binaryrecordutil.h                                            -*-C++-*-
+#ifndef INCLUDED_BALL_BINARYRECORDUTIL
+#define INCLUDED_BALL_BINARYRECORDUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to write and read log records in binary form.
+//
+//@CLASSES:
+//  ball::BinaryRecordUtil: namespace for binary log record utilities
+//
+//@SEE_ALSO: ball_fileobserver2, ball_record, ball_recordstringformatter
+//
+//@DESCRIPTION: This component provides a 'struct', 'ball::BinaryRecordUtil',
+// that provides a namespace for functions that write 'ball::Record' objects
+// to a stream in a compact, length-prefixed binary format, and that read such
+// records back, for example to render them as text using a
+// 'ball::RecordStringFormatter'.
+//
+// Formatting a record as text (in particular, rendering its timestamp) is a
+// significant part of the cost of publishing it to a file.  Writing records in
+// the binary format instead moves that cost from the process that logs the
+// records to whichever (possibly offline) process later reads the log file.
+//
+// 'BinaryRecordUtil::writeRecord' has the signature of the log record
+// formatting functor of 'ball::FileObserver2' (see 'setLogFileFunctor'), so a
+// file observer writes binary log files (with the usual log file rotation)
+// once it is configured as follows:
+//..
+//  fileObserver.setLogFileFunctor(&ball::BinaryRecordUtil::writeRecord);
+//..
+// 'BinaryRecordUtil::formatRecords' then reads the records of such a file and
+// renders each of them using any formatting functor having that same
+// signature, such as a 'ball::RecordStringFormatter'.  Note that binary log
+// files must be opened in binary mode to be read.
+//
+///Binary Record Format
+///--------------------
+// Each record is written as a four-byte, big-endian length, followed by that
+// many bytes of record data streamed in the BDEX format (see 'bslx'):
+//..
+//  Field              BDEX Encoding
+//  -----------------  ------------------------------------------------------
+//  format version     'putInt8' (the current format version is 1)
+//  timestamp          'bdlt::Datetime' (BDEX version 2)
+//  process ID         'putInt32'
+//  thread ID          'putUint64'
+//  severity           'putInt32'
+//  line number        'putInt32'
+//  file name          'putLength' followed by 'putArrayInt8'
+//  category           'putLength' followed by 'putArrayInt8'
+//  message            'putLength' followed by 'putArrayInt8'
+//  user fields        'putLength' (the number of fields), followed by, for
+//                     each field, 'putInt8' (the 'ball::UserFieldType') and
+//                     the value: 'putInt64', 'putFloat64', 'putLength' and
+//                     'putArrayInt8' (for both strings and character arrays),
+//                     or 'bdlt::DatetimeTz' (BDEX version 2)
+//..
+// Readers ignore any bytes that follow the user fields within the length of a
+// record, so that fields can be appended in later versions of the format
+// without invalidating existing readers.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing and Formatting a Binary Log
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, a service writes its log records in binary form, and the
+// records are rendered as text later, e.g., when the log is inspected.
+//
+// First, we create a record, such as the one that a file observer would be
+// given to publish:
+//..
+//  ball::Record record;
+//
+//  ball::RecordAttributes& attributes = record.fixedFields();
+//
+//  attributes.setTimestamp(bdlt::Datetime(2021, 4, 1, 12, 30, 45, 123));
+//  attributes.setProcessID(1234);
+//  attributes.setThreadID(5);
+//  attributes.setSeverity(ball::Severity::e_WARN);
+//  attributes.setFileName("server.cpp");
+//  attributes.setLineNumber(42);
+//  attributes.setCategory("SERVER");
+//  attributes.setMessage("queue depth exceeds 1000");
+//..
+// Then, we write the record to a stream in binary form.  A
+// 'ball::FileObserver2' configured with 'BinaryRecordUtil::writeRecord' as its
+// log record formatting functor does the same for each record it publishes,
+// the stream being its log file:
+//..
+//  bsl::stringstream log;
+//
+//  ball::BinaryRecordUtil::writeRecord(log, record);
+//  assert(log.good());
+//..
+// Finally, we render the binary log as text using a
+// 'ball::RecordStringFormatter':
+//..
+//  bsl::ostringstream text;
+//  int                numRecords;
+//
+//  int rc = ball::BinaryRecordUtil::formatRecords(
+//                           text,
+//                           log,
+//                           ball::RecordStringFormatter("%d %s %c %m\n"),
+//                           &numRecords);
+//
+//  assert(0 == rc);
+//  assert(1 == numRecords);
+//  assert(text.str() ==
+//            "01APR2021_12:30:45.123 WARN SERVER queue depth exceeds 1000\n");
+//..
+
+#include <balscm_version.h>
+
+#include <bsl_functional.h>
+#include <bsl_iosfwd.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Record;
+
+                          // =======================
+                          // struct BinaryRecordUtil
+                          // =======================
+
+struct BinaryRecordUtil {
+    // This 'struct' provides a namespace for functions that write log records
+    // to, and read log records from, streams in the binary format described
+    // in the component-level documentation.
+
+    // TYPES
+    typedef bsl::function<void(bsl::ostream&, const Record&)>
+                                                             RecordFormatter;
+        // 'RecordFormatter' is an alias for the type of a functor that
+        // renders a log record to a stream (e.g., a
+        // 'ball::RecordStringFormatter').
+
+    enum {
+        k_FORMAT_VERSION = 1  // version of the binary format that is written
+    };
+
+    // CLASS METHODS
+    static int formatRecords(bsl::ostream&          stream,
+                             bsl::istream&          input,
+                             const RecordFormatter& formatter,
+                             int                   *numRecords = 0);
+        // Read each record, in the binary format, from the specified 'input'
+        // until its end, and render it to the specified 'stream' using the
+        // specified 'formatter'.  Optionally specify 'numRecords' to load the
+        // number of records that were rendered.  Return 0 if all of 'input'
+        // was read, and a non-zero value (having the meaning described for
+        // 'readRecord') if a record could not be read, in which case the
+        // records preceding it have been rendered.
+
+    static int readRecord(Record *record, bsl::istream& input);
+        // Load into the specified 'record' the next record read, in the binary
+        // format, from the specified 'input'.  Return 0 on success, 1 if
+        // 'input' has no more data, -1 if the data is truncated or malformed,
+        // and -2 if the record was written in an unsupported version of the
+        // format.  If -2 is returned, 'input' is positioned at the next
+        // record; otherwise, if a non-zero value is returned, the position of
+        // 'input' is unspecified.  If a non-zero value is returned, 'record'
+        // is left in a valid, but unspecified state.
+
+    static void writeRecord(bsl::ostream& stream, const Record& record);
+        // Write the specified 'record', in the binary format, to the specified
+        // 'stream', and flush 'stream'.  If the write fails, 'stream' is left
+        // in a failed state.  Note that this function can be installed as the
+        // log record formatting functor of a 'ball::FileObserver2'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
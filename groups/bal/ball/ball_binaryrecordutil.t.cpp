@@ -0,0 +1,920 @@
+// ball_binaryrecordutil.t.cpp                                        -*-C++-*-
+#include <ball_binaryrecordutil.h>
+
+#include <ball_context.h>
+#include <ball_fileobserver2.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_recordstringformatter.h>
+#include <ball_severity.h>
+#include <ball_userfields.h>
+#include <ball_userfieldtype.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // atoi()
+#include <bsl_cstring.h>     // strlen()
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility that writes 'ball::Record' objects to
+// a stream in a binary format, and reads them back.  The primary concern is
+// that every field of a record, including each type of user field, survives
+// the round trip exactly.  We also verify that malformed and truncated input
+// is detected, that records written in an unsupported format version are
+// skipped, and that 'formatRecords' renders records exactly as the formatter
+// would have rendered the original records.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] int formatRecords(ostream&, istream&, const Formatter&, int *);
+// [ 2] int readRecord(Record *record, istream& input);
+// [ 2] void writeRecord(ostream& stream, const Record& record);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] MALFORMED INPUT
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::BinaryRecordUtil Obj;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string       d_dirName;      // path to the created directory
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TempDirectoryGuard,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TempDirectoryGuard(bslma::Allocator *basicAllocator = 0)
+        // Create temporary directory in the system-wide temp or current
+        // directory.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+    : d_dirName(bslma::Default::allocator(basicAllocator))
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        bsl::string tmpPath(d_allocator_p);
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        char tmpPathBuf[MAX_PATH];
+        GetTempPath(MAX_PATH, tmpPathBuf);
+        tmpPath.assign(tmpPathBuf);
+#else
+        const char *envTmpPath = bsl::getenv("TMPDIR");
+        if (envTmpPath) {
+            tmpPath.assign(envTmpPath);
+        }
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "ball_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = bdls::FilesystemUtil::createTemporaryDirectory(&d_dirName,
+                                                             tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        bdls::FilesystemUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& getTempDirName() const
+        // Return a 'const' reference to the name of the created temporary
+        // directory.
+    {
+        return d_dirName;
+    }
+};
+
+void setMessage(ball::Record *record, const char *message, int length)
+    // Set the message of the specified 'record' to the specified 'length'
+    // bytes at the specified 'message', which may contain null characters.
+{
+    record->fixedFields().clearMessage();
+    record->fixedFields().messageStreamBuf().sputn(message, length);
+}
+
+void makeRecord(ball::Record *record, int index)
+    // Load into the specified 'record' an arbitrary value that is unique for
+    // the specified 'index'.
+{
+    ball::RecordAttributes& attributes = record->fixedFields();
+
+    attributes.setTimestamp(bdlt::Datetime(2020, 2, 29, 23, 59, 58,
+                                           index % 1000, index % 1000));
+    attributes.setProcessID(100 + index);
+    attributes.setThreadID(1000 + index);
+    attributes.setSeverity(ball::Severity::e_INFO);
+    attributes.setFileName("makeRecord.cpp");
+    attributes.setLineNumber(index);
+    attributes.setCategory("TEST.CATEGORY");
+
+    bsl::ostringstream message;
+    message << "message " << index;
+    attributes.setMessage(message.str().c_str());
+
+    record->customFields().removeAll();
+    record->customFields().appendInt64(index);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;  // Suppress compiler warning.
+    (void) veryVeryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+///Example 1: Writing and Formatting a Binary Log
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, a service writes its log records in binary form, and the
+// records are rendered as text later, e.g., when the log is inspected.
+//
+// First, we create a record, such as the one that a file observer would be
+// given to publish:
+//..
+    ball::Record record;
+
+    ball::RecordAttributes& attributes = record.fixedFields();
+
+    attributes.setTimestamp(bdlt::Datetime(2021, 4, 1, 12, 30, 45, 123));
+    attributes.setProcessID(1234);
+    attributes.setThreadID(5);
+    attributes.setSeverity(ball::Severity::e_WARN);
+    attributes.setFileName("server.cpp");
+    attributes.setLineNumber(42);
+    attributes.setCategory("SERVER");
+    attributes.setMessage("queue depth exceeds 1000");
+//..
+// Then, we write the record to a stream in binary form.  A
+// 'ball::FileObserver2' configured with 'BinaryRecordUtil::writeRecord' as its
+// log record formatting functor does the same for each record it publishes,
+// the stream being its log file:
+//..
+    bsl::stringstream log;
+
+    ball::BinaryRecordUtil::writeRecord(log, record);
+    ASSERT(log.good());
+//..
+// Finally, we render the binary log as text using a
+// 'ball::RecordStringFormatter':
+//..
+    bsl::ostringstream text;
+    int                numRecords;
+
+    int rc = ball::BinaryRecordUtil::formatRecords(
+                             text,
+                             log,
+                             ball::RecordStringFormatter("%d %s %c %m\n"),
+                             &numRecords);
+
+    ASSERT(0 == rc);
+    ASSERT(1 == numRecords);
+    ASSERT(text.str() ==
+              "01APR2021_12:30:45.123 WARN SERVER queue depth exceeds 1000\n");
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FORMAT RECORDS
+        //
+        // Concerns:
+        //: 1 'formatRecords' renders each record of its input, in order, as
+        //:   the formatter renders the record that was written.
+        //:
+        //: 2 'formatRecords' returns 0 once all of its input is read, and
+        //:   loads the number of rendered records if requested.
+        //:
+        //: 3 If a record cannot be read, 'formatRecords' returns the status of
+        //:   'readRecord' and the preceding records are rendered.
+        //:
+        //: 4 The log files written by a 'ball::FileObserver2' configured with
+        //:   'writeRecord' as its formatting functor can be rendered.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Write sequences of various lengths of distinct records to a
+        //:   stream, and render them using a 'ball::RecordStringFormatter'.
+        //:   Compare the output to that of the formatter applied directly to
+        //:   the records.  (C-1..2)
+        //:
+        //: 2 Truncate the stream of P-1, and verify that the complete records
+        //:   are rendered and -1 is returned.  (C-3)
+        //:
+        //: 3 Publish records to a 'ball::FileObserver2' configured with
+        //:   'writeRecord' and render the resulting file.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an empty formatter.  (C-5)
+        //
+        // Testing:
+        //   int formatRecords(ostream&, istream&, const Formatter&, int *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nFORMAT RECORDS"
+                          << "\n==============" << endl;
+
+        const ball::RecordStringFormatter formatter(
+                                           "%d %p:%t %s %f:%l %c %m %u\n");
+
+        if (verbose) cout << "\nRendering sequences of records." << endl;
+
+        for (int n = 0; n < 5; ++n) {
+            bsl::stringstream  binary;
+            bsl::ostringstream expected;
+
+            for (int i = 0; i < n; ++i) {
+                ball::Record record;
+                makeRecord(&record, i);
+
+                Obj::writeRecord(binary, record);
+                formatter(expected, record);
+            }
+
+            const bsl::string complete = binary.str();
+
+            bsl::ostringstream output;
+            int                numRecords = -1;
+
+            ASSERTV(n, 0 == Obj::formatRecords(output,
+                                               binary,
+                                               formatter,
+                                               &numRecords));
+            ASSERTV(n, numRecords, n == numRecords);
+            ASSERTV(n, expected.str(), output.str(),
+                    expected.str() == output.str());
+
+            bsl::istringstream input(complete);
+            bsl::ostringstream output2;
+
+            ASSERTV(n, 0 == Obj::formatRecords(output2, input, formatter));
+            ASSERTV(n, expected.str() == output2.str());
+
+            if (0 == n) {
+                continue;                                           // CONTINUE
+            }
+
+            // Truncate the last record.
+
+            bsl::istringstream truncated(complete.substr(0,
+                                                     complete.length() - 1));
+            bsl::ostringstream partial;
+
+            ASSERTV(n, -1 == Obj::formatRecords(partial,
+                                                truncated,
+                                                formatter,
+                                                &numRecords));
+            ASSERTV(n, numRecords, n - 1 == numRecords);
+            ASSERTV(n, 0 == expected.str().find(partial.str()));
+        }
+
+        if (verbose) cout << "\nRendering a file observer log." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "binary.log");
+
+            ball::FileObserver2 observer;
+            observer.setLogFileFunctor(&Obj::writeRecord);
+            ASSERT(0 == observer.enableFileLogging(fileName.c_str()));
+
+            const int          NUM_RECORDS = 10;
+            bsl::ostringstream expected;
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                ball::Record record;
+                makeRecord(&record, i);
+
+                observer.publish(record, ball::Context());
+                formatter(expected, record);
+            }
+            observer.disableFileLogging();
+
+            bsl::ifstream      file(fileName.c_str(),
+                                    bsl::ios_base::in | bsl::ios_base::binary);
+            bsl::ostringstream output;
+            int                numRecords;
+
+            ASSERT(file.is_open());
+            ASSERT(0 == Obj::formatRecords(output,
+                                           file,
+                                           formatter,
+                                           &numRecords));
+            ASSERTV(numRecords, NUM_RECORDS == numRecords);
+            ASSERTV(expected.str(), output.str(),
+                    expected.str() == output.str());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::istringstream  input;
+            bsl::ostringstream  output;
+            Obj::RecordFormatter empty;
+
+            ASSERT_PASS(Obj::formatRecords(output, input, formatter));
+            ASSERT_FAIL(Obj::formatRecords(output, input, empty));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MALFORMED INPUT
+        //
+        // Concerns:
+        //: 1 'readRecord' returns 1 for input having no more data.
+        //:
+        //: 2 'readRecord' returns -1 for a record truncated at any point,
+        //:   including within its length.
+        //:
+        //: 3 'readRecord' returns -1 for a record whose fields are truncated
+        //:   or malformed even though its length is consistent with the
+        //:   data that follows it.
+        //:
+        //: 4 'readRecord' returns -2 for a record written in an unsupported
+        //:   format version, and the next record can then be read.
+        //:
+        //: 5 Bytes following the fields of a record, within its length, are
+        //:   ignored.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Read from an empty stream.  (C-1)
+        //:
+        //: 2 Write a record, and read each proper prefix of the result.
+        //:   (C-2)
+        //:
+        //: 3 Write a record, and reduce its length (and the data that follows)
+        //:   to each smaller value; also corrupt the type of a user field.
+        //:   (C-3)
+        //:
+        //: 4 Write two records, change the version of the first, and verify
+        //:   that the first read returns -2 and the second returns 0.  (C-4)
+        //:
+        //: 5 Append bytes to the body of a record and increase its length
+        //:   accordingly.  (C-5)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null 'record'.  (C-6)
+        //
+        // Testing:
+        //   MALFORMED INPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nMALFORMED INPUT"
+                          << "\n===============" << endl;
+
+        ball::Record original;
+        makeRecord(&original, 7);
+        original.customFields().appendString("user field");
+
+        bsl::stringstream stream;
+        Obj::writeRecord(stream, original);
+
+        const bsl::string DATA = stream.str();
+        const int         LEN  = static_cast<int>(DATA.length());
+
+        // The body follows a four-byte length; the user field type of the
+        // string field is followed by its length (1 byte) and 10 characters.
+
+        const int HEADER_SIZE = 4;
+        const int TYPE_OFFSET = LEN - 12;
+
+        ASSERT(LEN - HEADER_SIZE == (((DATA[0] & 0xff) << 24)
+                                   | ((DATA[1] & 0xff) << 16)
+                                   | ((DATA[2] & 0xff) <<  8)
+                                   |  (DATA[3] & 0xff)));
+        ASSERT(ball::UserFieldType::e_STRING == DATA[TYPE_OFFSET]);
+
+        if (verbose) cout << "\nEmpty input." << endl;
+        {
+            ball::Record       record;
+            bsl::istringstream input;
+
+            ASSERT(1 == Obj::readRecord(&record, input));
+        }
+
+        if (verbose) cout << "\nTruncated input." << endl;
+
+        for (int len = 1; len < LEN; ++len) {
+            ball::Record       record;
+            bsl::istringstream input(DATA.substr(0, len));
+
+            ASSERTV(len, -1 == Obj::readRecord(&record, input));
+        }
+
+        if (verbose) cout << "\nTruncated fields." << endl;
+
+        for (int len = 0; len < LEN - HEADER_SIZE; ++len) {
+            ball::Record record;
+            bsl::string  data(DATA.substr(0, HEADER_SIZE + len));
+
+            data[0] = static_cast<char>((len >> 24) & 0xff);
+            data[1] = static_cast<char>((len >> 16) & 0xff);
+            data[2] = static_cast<char>((len >>  8) & 0xff);
+            data[3] = static_cast<char>( len        & 0xff);
+
+            bsl::istringstream input(data);
+
+            ASSERTV(len, -1 == Obj::readRecord(&record, input));
+        }
+
+        if (verbose) cout << "\nInvalid user field type." << endl;
+        {
+            ball::Record record;
+            bsl::string  data(DATA);
+
+            data[TYPE_OFFSET] = 99;
+
+            bsl::istringstream input(data);
+
+            ASSERT(-1 == Obj::readRecord(&record, input));
+        }
+
+        if (verbose) cout << "\nInvalid length." << endl;
+        {
+            ball::Record record;
+            bsl::string  data(DATA);
+
+            data[0] = static_cast<char>(0x80);
+
+            bsl::istringstream input(data);
+
+            ASSERT(-1 == Obj::readRecord(&record, input));
+        }
+
+        if (verbose) cout << "\nUnsupported version." << endl;
+        {
+            ball::Record record;
+            bsl::string  data(DATA);
+
+            data[HEADER_SIZE] = Obj::k_FORMAT_VERSION + 1;
+            data += DATA;
+
+            bsl::istringstream input(data);
+
+            ASSERT(-2 == Obj::readRecord(&record, input));
+            ASSERT( 0 == Obj::readRecord(&record, input));
+            ASSERT(original == record);
+            ASSERT( 1 == Obj::readRecord(&record, input));
+        }
+
+        if (verbose) cout << "\nTrailing bytes." << endl;
+        {
+            ball::Record record;
+            bsl::string  data(DATA);
+
+            data.append("extra", 5);
+            data[3] = static_cast<char>(data[3] + 5);
+            data += DATA;
+
+            bsl::istringstream input(data);
+
+            ASSERT(0 == Obj::readRecord(&record, input));
+            ASSERT(original == record);
+            ASSERT(0 == Obj::readRecord(&record, input));
+            ASSERT(original == record);
+            ASSERT(1 == Obj::readRecord(&record, input));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ball::Record       record;
+            bsl::istringstream input;
+
+            ASSERT_PASS(Obj::readRecord(&record, input));
+            ASSERT_FAIL(Obj::readRecord(0,       input));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // WRITE AND READ RECORDS
+        //
+        // Concerns:
+        //: 1 Every field of a record written by 'writeRecord' is restored by
+        //:   'readRecord'.
+        //:
+        //: 2 Each type of user field, including null fields, is restored.
+        //:
+        //: 3 Strings that are empty, long, or that contain null characters
+        //:   (in messages, string fields, and character arrays) are restored.
+        //:
+        //: 4 Timestamps, including the default value and microseconds, are
+        //:   restored.
+        //:
+        //: 5 Records are written and read one after another, and the values
+        //:   of a record previously loaded by 'readRecord' do not affect the
+        //:   next record.
+        //:
+        //: 6 'writeRecord' flushes the stream it is given.
+        //:
+        //: 7 Typical records are written and read without using the default
+        //:   allocator.
+        //:
+        //: 8 If the stream fails, 'writeRecord' leaves it in a failed state.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, create a set of records having
+        //:   distinct attributes and user fields.  Write all of them to a
+        //:   stream, then read them back, in order, into a single record, and
+        //:   compare each to its original.  (C-1..5)
+        //:
+        //: 2 Write a record to a stream whose stream buffer is a
+        //:   'bsl::filebuf', and verify that the file contains the record
+        //:   before the stream is closed.  (C-6)
+        //:
+        //: 3 Install a test allocator as the default allocator while writing
+        //:   and reading records of moderate size, and verify that it is not
+        //:   used.  (C-7)
+        //:
+        //: 4 Write a record to a stream having no stream buffer.  (C-8)
+        //
+        // Testing:
+        //   int readRecord(Record *record, istream& input);
+        //   void writeRecord(ostream& stream, const Record& record);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nWRITE AND READ RECORDS"
+                          << "\n======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const bsl::string LONG(1000, 'x');
+        const char        NULS[] = "a\0b\0";
+
+        bsl::vector<char> emptyArray;
+        bsl::vector<char> array(NULS, NULS + sizeof NULS);
+
+        static const struct {
+            int         d_line;
+            int         d_year;      // 0 for default timestamp
+            int         d_usec;
+            const char *d_category;
+            const char *d_fileName;
+            int         d_severity;
+            const char *d_fields;    // one character per user field:
+                                     // 'n' null, 'i' int64, 'd' double,
+                                     // 's' string, 'l' long string,
+                                     // 'e' empty string, 't' DatetimeTz,
+                                     // 'a' char array, 'z' empty array
+        } DATA[] = {
+            //LN  YEAR  USEC  CATEGORY    FILENAME      SEV  FIELDS
+            //--  ----  ----  ----------  ------------  ---  --------
+            { L_,    0,    0, "",         "",             0, ""        },
+            { L_, 2021,    0, "A",        "a.cpp",       32, ""        },
+            { L_, 2021,  999, "A.B.C",    "dir/b.cpp",   64, "n"       },
+            { L_, 1999,    1, "CATEGORY", "c.cpp",      255, "i"       },
+            { L_, 9999,  500, "X",        "d.cpp",       96, "d"       },
+            { L_,    1,    0, "Y",        "e.cpp",      128, "s"       },
+            { L_, 2000,   10, "Z",        "f.cpp",      160, "t"       },
+            { L_, 2000,   20, "Z",        "f.cpp",      192, "a"       },
+            { L_, 2000,   30, "Z",        "f.cpp",      224, "elz"     },
+            { L_, 2001,   40, "ALL",      "g.cpp",       -1, "nidstaez"},
+            { L_, 2002,   50, "ALL",      "h.cpp",       17, "iiiiiiii"},
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int MESSAGE_LENGTHS[] = { 0, 1, 127, 128, 1000 };
+        const int NUM_MESSAGE_LENGTHS = sizeof  MESSAGE_LENGTHS
+                                      / sizeof *MESSAGE_LENGTHS;
+
+        bsl::vector<ball::Record> records(&ta);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            for (int mi = 0; mi < NUM_MESSAGE_LENGTHS; ++mi) {
+                ball::Record            record(&ta);
+                ball::RecordAttributes& attributes = record.fixedFields();
+
+                if (DATA[ti].d_year) {
+                    attributes.setTimestamp(bdlt::Datetime(DATA[ti].d_year,
+                                                           12, 31, 23, 59, 59,
+                                                           ti,
+                                                           DATA[ti].d_usec));
+                }
+                attributes.setProcessID(ti * 1000 + mi);
+                attributes.setThreadID(0xFFFFFFFF00000000ULL + ti);
+                attributes.setSeverity(DATA[ti].d_severity);
+                attributes.setFileName(DATA[ti].d_fileName);
+                attributes.setLineNumber(DATA[ti].d_line);
+                attributes.setCategory(DATA[ti].d_category);
+
+                // Embed a null character in messages of length 3 or more.
+
+                bsl::string message(MESSAGE_LENGTHS[mi], 'm');
+                if (3 <= message.length()) {
+                    message[1] = '\0';
+                }
+                setMessage(&record,
+                           message.data(),
+                           static_cast<int>(message.length()));
+
+                ball::UserFields& fields = record.customFields();
+
+                for (const char *f = DATA[ti].d_fields; *f; ++f) {
+                    switch (*f) {
+                      case 'n': fields.appendNull();                   break;
+                      case 'i': fields.appendInt64(-(1LL << 40) | ti); break;
+                      case 'd': fields.appendDouble(-1.0 / 3);         break;
+                      case 's': fields.appendString(
+                                          bslstl::StringRef(NULS, 3)); break;
+                      case 'l': fields.appendString(LONG);             break;
+                      case 'e': fields.appendString("");               break;
+                      case 't': fields.appendDatetimeTz(
+                                  bdlt::DatetimeTz(
+                                      bdlt::Datetime(2019, 1, 2, 3, 4, 5,
+                                                     6, 7),
+                                      -300));                          break;
+                      case 'a': fields.appendCharArray(array);         break;
+                      case 'z': fields.appendCharArray(emptyArray);    break;
+                      default: ASSERTV(*f, !"Bad field specification");
+                    }
+                }
+
+                records.push_back(record);
+            }
+        }
+
+        bsl::stringstream stream;
+
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            Obj::writeRecord(stream, records[i]);
+            ASSERTV(i, stream.good());
+        }
+
+        if (veryVerbose) {
+            P_(records.size()) P(stream.str().length());
+        }
+
+        ball::Record record(&ta);
+
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            ASSERTV(i, 0 == Obj::readRecord(&record, stream));
+            ASSERTV(i, records[i], record, records[i] == record);
+        }
+        ASSERT(1 == Obj::readRecord(&record, stream));
+
+        if (verbose) cout << "\nTesting that the stream is flushed." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "flush.log");
+
+            bsl::ofstream output(fileName.c_str(),
+                                 bsl::ios_base::out | bsl::ios_base::binary);
+            ASSERT(output.is_open());
+
+            Obj::writeRecord(output, records.back());
+            ASSERT(output.good());
+
+            bsl::ifstream input(fileName.c_str(),
+                                bsl::ios_base::in | bsl::ios_base::binary);
+
+            ASSERT(0 == Obj::readRecord(&record, input));
+            ASSERT(records.back() == record);
+        }
+
+        if (verbose) cout << "\nTesting default allocator use." << endl;
+        {
+            bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+            ball::Record original(&ta);
+            makeRecord(&original, 12345);
+            original.customFields().appendString("a user field");
+            original.customFields().appendDatetimeTz(bdlt::DatetimeTz());
+
+            bsl::stringstream stream(&ta);
+            ball::Record      record(&ta);
+
+            {
+                bslma::DefaultAllocatorGuard dag(&da);
+
+                Obj::writeRecord(stream, original);
+                ASSERT(0 == Obj::readRecord(&record, stream));
+            }
+
+            ASSERT(original == record);
+            ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nTesting a failed stream." << endl;
+        {
+            bsl::ostream stream(0);
+
+            Obj::writeRecord(stream, records.back());
+            ASSERT(!stream.good());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a record to a stream, read it back, and compare it to the
+        //:   original record.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        ball::Record record;
+        makeRecord(&record, 1);
+
+        bsl::stringstream stream;
+        Obj::writeRecord(stream, record);
+        ASSERT(stream.good());
+
+        if (veryVerbose) {
+            P(stream.str().length());
+        }
+
+        ball::Record copy;
+        ASSERT(0 == Obj::readRecord(&copy, stream));
+        ASSERTV(record, copy, record == copy);
+
+        ASSERT(1 == Obj::readRecord(&copy, stream));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -13,6 +13,8 @@ BSLS_IDENT_RCSID(ball_fileobserver_cpp,"$Id$ $CSID$")
 
 #include <bslmt_lockguard.h>
 
+#include <bsls_assert.h>
+
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>                      // for 'bsl::strcmp'
 #include <bsl_sstream.h>
@@ -236,6 +238,38 @@ void FileObserver::publish(const Record& record, const Context& context)
     d_fileObserver2.publish(record, context);
 }
 
+void FileObserver::publishBatch(
+                               const bsl::shared_ptr<const Record> *records,
+                               int                                  numRecords)
+{
+    BSLS_ASSERT(0 <= numRecords);
+    BSLS_ASSERT(records || 0 == numRecords);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    bool stdoutWritten = false;
+
+    for (int i = 0; i < numRecords; ++i) {
+        const Record& record = *records[i];
+
+        if (record.fixedFields().severity() <= d_stdoutThreshold) {
+            bsl::ostringstream oss;
+            d_stdoutFormatter(oss, record);
+
+            // Use 'fwrite' to specify the length to write.
+
+            bsl::fwrite(oss.str().c_str(), 1, oss.str().length(), stdout);
+            stdoutWritten = true;
+        }
+    }
+
+    if (stdoutWritten) {
+        bsl::fflush(stdout);
+    }
+
+    d_fileObserver2.publishBatch(records, numRecords);
+}
+
 void FileObserver::setLogFormat(const char *logFileFormat,
                                 const char *stdoutFormat)
 {
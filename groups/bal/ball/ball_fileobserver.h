@@ -30,6 +30,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableStdoutLoggingPrefix
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setOnFileRotationCallback
@@ -625,6 +626,16 @@ class FileObserver : public Observer {
         // 'record' is at least as severe as the value returned by
         // 'stdoutThreshold'.
 
+    void publishBatch(const bsl::shared_ptr<const Record> *records,
+                      int                                   numRecords);
+        // Process, in order, the specified 'numRecords' records referenced by
+        // the shared pointers in the specified 'records' array as if by
+        // calling 'publish' for each of them, except that the log file and
+        // 'stdout' are flushed once per batch rather than once per record
+        // (see 'FileObserver2::publishBatch').  The behavior is undefined
+        // unless '0 <= numRecords' and 'records' refers to an array of at
+        // least 'numRecords' non-null pointers.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
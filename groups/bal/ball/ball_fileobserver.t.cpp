@@ -39,6 +39,7 @@
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdio.h>      // 'remove'
@@ -50,6 +51,7 @@
 #include <bsl_memory.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdio.h>
 #include <bsl_c_stdlib.h>    // 'unsetenv'
@@ -111,6 +113,7 @@ using bsl::flush;
 // [ 1] void enableUserFieldsLogging();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
+// [ 7] void publishBatch(const shared_ptr<const Record> *, int);
 // [ 2] void forceRotation();
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
 // [ 2] void rotateOnSize(int size);
@@ -136,7 +139,7 @@ using bsl::flush;
 // [ 6] CONCERN: 'FileObserver' can be created using 'allocate_shared'.
 // [ 5] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [ 4] CONCERN: ROTATION CALLBACK INVOCATION
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 
 // Note assert and debug macros all output to cerr instead of cout, unlike
 // most other test drivers.  This is necessary because test case 1 plays
@@ -687,7 +690,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -800,6 +803,92 @@ int main(int argc, char *argv[])
         observer->disableSizeRotation();
 //..
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes the same output to the log file as calling
+        //:   'publish' for each record of the batch in turn.
+        //:
+        //: 2 An empty batch has no effect.
+        //
+        // Plan:
+        //: 1 Publish a sequence of records to one observer using 'publish'
+        //:   and to another using 'publishBatch', and verify that the two log
+        //:   files are identical.  (C-1)
+        //:
+        //: 2 Publish an empty batch and verify that nothing is logged.  (C-2)
+        //
+        // Testing:
+        //   void publishBatch(const shared_ptr<const Record> *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        enum { k_NUM_RECORDS = 50, k_BATCH_SIZE = 16 };
+
+        bsl::vector<bsl::shared_ptr<const ball::Record> > records(&ta);
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        i,
+                                        "CATEGORY",
+                                        ball::Severity::e_WARN,
+                                        "message",
+                                        &ta);
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, attr, ball::UserFields(&ta), &ta);
+            records.push_back(record);
+        }
+
+        const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        TempDirectoryGuard tempDirGuard(&ta);
+
+        bsl::string expName(tempDirGuard.getTempDirName(), &ta);
+        bdls::PathUtil::appendRaw(&expName, "expected.log");
+        bsl::string batchName(tempDirGuard.getTempDirName(), &ta);
+        bdls::PathUtil::appendRaw(&batchName, "batch.log");
+
+        Obj mE(ball::Severity::e_OFF, &ta);
+        Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+        ASSERT(0 == mE.enableFileLogging(expName.c_str()));
+        ASSERT(0 == mX.enableFileLogging(batchName.c_str()));
+
+        mX.publishBatch(records.data(), 0);
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            mE.publish(records[i], context);
+        }
+        for (int i = 0; i < k_NUM_RECORDS; i += k_BATCH_SIZE) {
+            const int n = bsl::min(static_cast<int>(k_BATCH_SIZE),
+                                   k_NUM_RECORDS - i);
+            mX.publishBatch(&records[i], n);
+        }
+
+        ASSERT(X.isFileLoggingEnabled());
+
+        mE.disableFileLogging();
+        mX.disableFileLogging();
+
+        bsl::string expected(&ta);
+        bsl::string actual(&ta);
+
+        const int expLines = readFileIntoString(__LINE__, expName, expected);
+        const int actLines = readFileIntoString(__LINE__, batchName, actual);
+
+        ASSERTV(expLines, 2 * k_NUM_RECORDS == expLines);
+        ASSERTV(actLines, 2 * k_NUM_RECORDS == actLines);
+        ASSERTV(expected, actual, expected == actual);
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // CONSTRUCTOR, MAKE_SHARED, AND ALLOCATE_SHARED TEST
@@ -399,6 +399,25 @@ static bdlt::Datetime computeNextRotationTime(
                           // -------------------
 
 // PRIVATE MANIPULATORS
+void FileObserver2::checkLogOutStream()
+{
+    if (!d_logOutStream) {
+        char errorBuffer[k_ERROR_BUFFER_SIZE];
+
+        snprintf(errorBuffer,
+                 sizeof errorBuffer,
+                 "Error on file stream for %s: %s.",
+                 d_logFileName.c_str(),
+                 bsl::strerror(getErrorCode()));
+        bsls::Log::platformDefaultMessageHandler(bsls::LogSeverity::e_ERROR,
+                                                 __FILE__,
+                                                 __LINE__,
+                                                 errorBuffer);
+
+        d_logStreamBuf.clear();
+    }
+}
+
 void FileObserver2::logRecordDefault(bsl::ostream& stream,
                                      const Record& record)
 
@@ -585,6 +604,8 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  false,
                  basicAllocator)
 , d_logOutStream(&d_logStreamBuf)
+, d_recordStreamBuf(basicAllocator)
+, d_recordOutStream(&d_recordStreamBuf)
 , d_logFilePattern(basicAllocator)
 , d_logFileName(basicAllocator)
 , d_logFileFunctor(
@@ -731,23 +752,7 @@ void FileObserver2::publish(const Record& record, const Context&)
 
         if (d_logStreamBuf.isOpened()) {
             d_logFileFunctor(d_logOutStream, record);
-
-            if (!d_logOutStream) {
-                char errorBuffer[k_ERROR_BUFFER_SIZE];
-
-                snprintf(errorBuffer,
-                         sizeof errorBuffer,
-                         "Error on file stream for %s: %s.",
-                         d_logFileName.c_str(),
-                         bsl::strerror(getErrorCode()));
-                bsls::Log::platformDefaultMessageHandler(
-                                                    bsls::LogSeverity::e_ERROR,
-                                                    __FILE__,
-                                                    __LINE__,
-                                                    errorBuffer);
-
-                d_logStreamBuf.clear();
-            }
+            checkLogOutStream();
         }
     }
 
@@ -760,6 +765,68 @@ void FileObserver2::publish(const Record& record, const Context&)
     }
 }
 
+void FileObserver2::publishBatch(
+                               const bsl::shared_ptr<const Record> *records,
+                               int                                  numRecords)
+{
+    BSLS_ASSERT(0 <= numRecords);
+    BSLS_ASSERT(records || 0 == numRecords);
+
+    // The formatting functor flushes the stream it is given after each record,
+    // which, applied to 'd_logOutStream', costs one 'write' system call per
+    // record.  Instead, each record is formatted into 'd_recordOutStream'
+    // (where a flush is a no-op) and its bytes are appended to the buffer of
+    // 'd_logStreamBuf', which is flushed once for the whole batch.  Since
+    // 'tellp' on 'd_logOutStream' accounts for buffered output, the size-based
+    // rotation check behaves exactly as it does for 'publish'.  The lock is
+    // released (after flushing) following each rotation attempt so that the
+    // rotation callback is invoked with 'd_mutex' unlocked, as in 'publish'.
+
+    int i = 0;
+    while (i < numRecords) {
+        bsl::string rotatedFileName;
+        int         rotationStatus = 1;
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            while (i < numRecords && 0 < rotationStatus) {
+                BSLS_ASSERT(records[i]);
+
+                const Record& record = *records[i];
+                ++i;
+
+                rotationStatus = rotateIfNecessary(
+                                            &rotatedFileName,
+                                            record.fixedFields().timestamp());
+
+                if (d_logStreamBuf.isOpened()) {
+                    d_recordStreamBuf.pubseekpos(0, bsl::ios_base::out);
+                    d_logFileFunctor(d_recordOutStream, record);
+                    d_logOutStream.write(
+                         d_recordStreamBuf.data(),
+                         static_cast<bsl::streamsize>(
+                                                  d_recordStreamBuf.length()));
+                    checkLogOutStream();
+                }
+            }
+
+            if (d_logStreamBuf.isOpened()) {
+                d_logOutStream.flush();
+                checkLogOutStream();
+            }
+        }
+
+        if (0 >= rotationStatus) {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+
+            if (d_onRotationCb) {
+                d_onRotationCb(rotationStatus, rotatedFileName);
+            }
+        }
+    }
+}
+
 void FileObserver2::rotateOnLifetime(
                                     const bdlt::DatetimeInterval& timeInterval)
 {
@@ -30,6 +30,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableFileLogging
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setLogFileFunctor
@@ -124,6 +125,11 @@ BSLS_IDENT("$Id: $")
 // instead, consider using either the '%D' or '%O' format specification
 // supported by 'ball_recordstringformatter'.
 //
+// Finally note that records can be logged in a compact binary format, and
+// rendered as text offline, by supplying 'ball::BinaryRecordUtil::writeRecord'
+// to 'setLogFileFunctor' (see {'ball_binaryrecordutil'}).  Timestamps are then
+// written in UTC regardless of 'enablePublishInLocalTime'.
+//
 ///Log Record Timestamps
 ///---------------------
 // By default, the timestamp attributes of published records are written in UTC
@@ -307,6 +313,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdls_fdstreambuf.h>
 
+#include <bdlsb_memoutstreambuf.h>
+
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
@@ -369,6 +377,15 @@ class FileObserver2 : public Observer {
                                                        // file logging (refers
                                                        // to 'd_logStreamBuf')
 
+    bdlsb::MemOutStreamBuf d_recordStreamBuf;          // stream buffer into
+                                                       // which 'publishBatch'
+                                                       // formats each record
+
+    bsl::ostream           d_recordOutStream;          // output stream for
+                                                       // batch formatting
+                                                       // (refers to
+                                                       // 'd_recordStreamBuf')
+
     bsl::string            d_logFilePattern;           // log filename pattern
 
     bsl::string            d_logFileName;              // current log filename
@@ -426,6 +443,11 @@ class FileObserver2 : public Observer {
 
   private:
     // PRIVATE MANIPULATORS
+    void checkLogOutStream();
+        // Report an error and close the current log file of this file
+        // observer if the log file stream is in a failed state.  The behavior
+        // is undefined unless the caller acquired the lock for this object.
+
     void logRecordDefault(bsl::ostream& stream, const Record& record);
         // Write the specified log 'record' to the specified output 'stream'
         // using the default record format of this file observer.
@@ -565,6 +587,21 @@ class FileObserver2 : public Observer {
         // enabled for this file observer.  The method has no effect if file
         // logging is not enabled, in which case 'record' is dropped.
 
+    void publishBatch(const bsl::shared_ptr<const Record> *records,
+                      int                                   numRecords);
+        // Process, in order, the specified 'numRecords' records referenced by
+        // the shared pointers in the specified 'records' array by writing
+        // them to the current log file if file logging is enabled for this
+        // file observer.  The records are formatted exactly as by 'publish',
+        // and log file rotation is performed (and the rotation callback
+        // invoked) exactly as if 'publish' were called for each record in
+        // turn, but the log file is flushed once per batch rather than once
+        // per record.  Records are dropped if file logging is not enabled.
+        // The behavior is undefined unless '0 <= numRecords' and 'records'
+        // refers to an array of at least 'numRecords' non-null pointers.
+        // Note that the publishing context of a record is not used by this
+        // observer, and so is not supplied.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
@@ -43,6 +43,7 @@
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
@@ -51,7 +52,9 @@
 #include <bsl_ctime.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
+#include <bsl_memory.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <glob.h>
@@ -101,6 +104,7 @@ using bsl::flush;
 // [ 1] void enablePublishInLocalTime();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
+// [14] void publishBatch(const shared_ptr<const Record> *, int);
 // [ 2] void forceRotation();
 // [ 2] void rotateOnSize(int size);
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
@@ -116,7 +120,7 @@ using bsl::flush;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -712,7 +716,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -788,6 +792,206 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes exactly the same bytes to the log file as
+        //:   calling 'publish' for each record of the batch in turn.
+        //:
+        //: 2 Size-based rotation occurs at the same points in the record
+        //:   sequence as with 'publish', and the rotation callback is invoked
+        //:   once per rotation attempt.
+        //:
+        //: 3 An empty batch has no effect.
+        //:
+        //: 4 Records are dropped if file logging is not enabled.
+        //:
+        //: 5 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Publish a sequence of records to one observer using 'publish'
+        //:   and to another using 'publishBatch' (in batches of varying
+        //:   size), and verify that the two log files are identical.  (C-1)
+        //:
+        //: 2 Repeat P-1 with rotation-on-size enabled and a rotation callback
+        //:   installed, and verify that both observers rotate the same number
+        //:   of times and produce the same total output.  (C-2)
+        //:
+        //: 3 Publish an empty batch, and a batch to an observer with file
+        //:   logging disabled, and verify there is no effect.  (C-3..4)
+        //:
+        //: 4 Install a test allocator as the default and verify that it is
+        //:   not used.  (C-5)
+        //
+        // Testing:
+        //   void publishBatch(const shared_ptr<const Record> *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        enum { k_NUM_RECORDS = 100 };
+
+        bsl::vector<bsl::shared_ptr<const ball::Record> > records(&ta);
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::string message(&ta);
+            message.assign(static_cast<bsl::size_t>(i % 37 + 1),
+                           static_cast<char>('a' + i % 26));
+
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        i,
+                                        "CATEGORY",
+                                        32,
+                                        message.c_str(),
+                                        &ta);
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, attr, ball::UserFields(&ta), &ta);
+            records.push_back(record);
+        }
+
+        const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        const int BATCH_SIZES[] = { 1, 2, 7, 64, k_NUM_RECORDS };
+        enum { k_NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES };
+
+        if (verbose) cout << "\tComparing output with 'publish'." << endl;
+        {
+            bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+            for (int ti = 0; ti < k_NUM_BATCH_SIZES; ++ti) {
+                const int BATCH_SIZE = BATCH_SIZES[ti];
+
+                if (veryVerbose) { T_; P(BATCH_SIZE); }
+
+                TempDirectoryGuard tempDirGuard(&ta);
+
+                bsl::string expName(tempDirGuard.getTempDirName(), &ta);
+                bdls::PathUtil::appendRaw(&expName, "expected.log");
+                bsl::string batchName(tempDirGuard.getTempDirName(), &ta);
+                bdls::PathUtil::appendRaw(&batchName, "batch.log");
+
+                Obj mE(&ta);  const Obj& E = mE;
+                Obj mX(&ta);  const Obj& X = mX;
+
+                ASSERTV(BATCH_SIZE,
+                        0 == mE.enableFileLogging(expName.c_str()));
+                ASSERTV(BATCH_SIZE,
+                        0 == mX.enableFileLogging(batchName.c_str()));
+
+                for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                    mE.publish(records[i], context);
+                }
+                {
+                    bslma::DefaultAllocatorGuard dag(&da);
+
+                    for (int i = 0; i < k_NUM_RECORDS; i += BATCH_SIZE) {
+                        const int n = bsl::min(BATCH_SIZE, k_NUM_RECORDS - i);
+                        mX.publishBatch(&records[i], n);
+                    }
+                }
+
+                ASSERTV(BATCH_SIZE, E.isFileLoggingEnabled());
+                ASSERTV(BATCH_SIZE, X.isFileLoggingEnabled());
+
+                mE.disableFileLogging();
+                mX.disableFileLogging();
+
+                bsl::string expected(&ta);
+                bsl::string actual(&ta);
+
+                const int expLines = readFileIntoString(__LINE__,
+                                                        expName,
+                                                        expected);
+                const int actLines = readFileIntoString(__LINE__,
+                                                        batchName,
+                                                        actual);
+
+                ASSERTV(BATCH_SIZE, expLines, actLines, expLines == actLines);
+                ASSERTV(BATCH_SIZE, expected == actual);
+            }
+
+            ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\tTesting rotation on size." << endl;
+        {
+            for (int ti = 0; ti < k_NUM_BATCH_SIZES; ++ti) {
+                const int BATCH_SIZE = BATCH_SIZES[ti];
+
+                if (veryVerbose) { T_; P(BATCH_SIZE); }
+
+                TempDirectoryGuard tempDirGuard(&ta);
+
+                bsl::string expName(tempDirGuard.getTempDirName(), &ta);
+                bdls::PathUtil::appendRaw(&expName, "expected.log");
+                bsl::string batchName(tempDirGuard.getTempDirName(), &ta);
+                bdls::PathUtil::appendRaw(&batchName, "batch.log");
+
+                RotCb expCb(&ta);
+                RotCb batchCb(&ta);
+
+                Obj mE(&ta);
+                Obj mX(&ta);
+
+                mE.setOnFileRotationCallback(expCb);
+                mX.setOnFileRotationCallback(batchCb);
+                mE.rotateOnSize(1);
+                mX.rotateOnSize(1);
+
+                ASSERTV(BATCH_SIZE,
+                        0 == mE.enableFileLogging(expName.c_str()));
+                ASSERTV(BATCH_SIZE,
+                        0 == mX.enableFileLogging(batchName.c_str()));
+
+                for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                    mE.publish(records[i], context);
+                }
+                for (int i = 0; i < k_NUM_RECORDS; i += BATCH_SIZE) {
+                    const int n = bsl::min(BATCH_SIZE, k_NUM_RECORDS - i);
+                    mX.publishBatch(&records[i], n);
+                }
+
+                mE.disableFileLogging();
+                mX.disableFileLogging();
+
+                ASSERTV(BATCH_SIZE, 0 < expCb.numInvocations());
+                ASSERTV(BATCH_SIZE,
+                        expCb.numInvocations(),
+                        batchCb.numInvocations(),
+                        expCb.numInvocations() == batchCb.numInvocations());
+                ASSERTV(BATCH_SIZE, batchCb.status(), 0 == batchCb.status());
+            }
+        }
+
+        if (verbose) cout << "\tTesting degenerate batches." << endl;
+        {
+            TempDirectoryGuard tempDirGuard(&ta);
+
+            bsl::string fileName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName, "test.log");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.publishBatch(records.data(), k_NUM_RECORDS);
+            ASSERT(!X.isFileLoggingEnabled());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            mX.publishBatch(0, 0);
+            mX.publishBatch(records.data(), 0);
+
+            ASSERT(X.isFileLoggingEnabled());
+            ASSERT(0 == getNumLines(fileName.c_str()));
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 123123158
@@ -23,12 +23,20 @@ BSLS_IDENT_RCSID(ball_log_cpp,"$Id$ $CSID$")
 #include <ball_streamobserver.h>              // for testing only
 #include <ball_testobserver.h>                // for testing only
 
+#include <bslma_destructionutil.h>
+#include <bslma_newdeleteallocator.h>
+
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
+#include <bslmt_once.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
 
 #include <bsls_assert.h>
 
 #include <bsl_cstdarg.h>
+#include <bsl_ios.h>
+#include <bsl_locale.h>
 #include <bsl_new.h>
 #include <bsl_ostream.h>
 #include <bsl_cstdio.h>
@@ -39,6 +47,211 @@ BSLS_IDENT_RCSID(ball_log_cpp,"$Id$ $CSID$")
 
 namespace BloombergLP {
 namespace ball {
+namespace {
+
+int threadLogStreamIndex()
+    // Return the index of the 'bsl::ios_base::pword' slot in which the
+    // logging stream of each thread refers to the 'ThreadLogStream' that
+    // holds it.
+{
+    static int s_index;
+    BSLMT_ONCE_DO {
+        s_index = bsl::ios_base::xalloc();
+    }
+    return s_index;
+}
+
+                          // ======================
+                          // struct ThreadLogStream
+                          // ======================
+
+struct ThreadLogStream {
+    // This 'struct' holds the stream that a thread uses to stream log messages
+    // (see 'Log_Stream').  A thread creates its stream the first time that it
+    // streams a message, and the stream is destroyed when the thread exits.
+    // Reusing the stream avoids constructing an 'bsl::ostream' (and so
+    // copying the global locale, whose reference count is shared by all
+    // threads) for each log message.  A locale imbued while streaming a
+    // message is detected by an event callback registered on the stream, so
+    // that the locale need be restored only when it has actually changed.
+
+    // DATA
+    bsl::ostream d_stream;  // stream attached to the record being logged, if
+                            // any
+
+    bsl::locale  d_locale;  // locale of 'd_stream' when it was created
+
+    bool         d_inUse;   // 'true' while 'd_stream' is loaned out
+
+    bool         d_imbued;  // 'true' if a locale was imbued into 'd_stream'
+                            // since its locale was last restored
+
+    // CLASS METHODS
+    static void onEvent(bsl::ios_base::event  event,
+                        bsl::ios_base&        stream,
+                        int                   index)
+        // Note that a locale was imbued into the specified 'stream' if the
+        // specified 'event' is 'bsl::ios_base::imbue_event', where the
+        // specified 'index' identifies the 'pword' slot of 'stream' that
+        // refers to the 'ThreadLogStream' holding 'stream'.  Note that this
+        // function is registered as an event callback of 'd_stream'.
+    {
+        if (bsl::ios_base::imbue_event == event) {
+            ThreadLogStream *threadStream = static_cast<ThreadLogStream *>(
+                                                         stream.pword(index));
+            if (threadStream) {
+                threadStream->d_imbued = true;
+            }
+        }
+    }
+
+    // CREATORS
+    ThreadLogStream()
+    : d_stream(0)
+    , d_locale(d_stream.getloc())
+    , d_inUse(false)
+    , d_imbued(false)
+        // Create an unattached stream that is not in use.
+    {
+        watch();
+    }
+
+    // MANIPULATORS
+    void watch()
+        // Make 'd_stream' refer to this object and register 'onEvent' as its
+        // event callback, so that a locale imbued into 'd_stream' is noted.
+    {
+        const int index = threadLogStreamIndex();
+
+        d_stream.pword(index) = this;
+        d_stream.register_callback(&onEvent, index);
+    }
+};
+
+// On supported platforms, define a thread-local variable,
+// 'g_threadLogStream', to serve as the cache for
+// 'bslmt::ThreadUtil::getSpecific'.  Note that the memory is managed by
+// 'bslmt::ThreadUtil' thread-specific storage.
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(ThreadLogStream *, g_threadLogStream, 0);
+#endif
+
+void destroyThreadLogStream(void *threadStream)
+    // Destroy the specified 'threadStream'.  The behavior is undefined unless
+    // 'threadStream' is null or was created by 'obtainThreadLogStream'.  Note
+    // that this function is installed as the destructor of the
+    // thread-specific storage key returned by 'threadLogStreamKey', and so is
+    // invoked on thread exit.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_threadLogStream = 0;
+#endif
+
+    // The streams outlive any logger manager, and so are supplied by the
+    // 'new'/'delete' allocator rather than by the global allocator.
+
+    bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+    allocator->deleteObject(static_cast<ThreadLogStream *>(threadStream));
+}
+
+const bslmt::ThreadUtil::Key& threadLogStreamKey()
+    // Return a reference providing non-modifiable access to the
+    // thread-specific storage key under which the 'ThreadLogStream' of each
+    // thread is stored.
+{
+    static bslmt::ThreadUtil::Key s_key;
+    BSLMT_ONCE_DO {
+        bslmt::ThreadUtil::createKey(&s_key,
+                                     (bslmt::ThreadUtil::Destructor)
+                                     &destroyThreadLogStream);
+    }
+    return s_key;
+}
+
+ThreadLogStream *lookupThreadLogStream()
+    // Return the address of the logging stream of the calling thread, or 0 if
+    // the calling thread has no logging stream.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    return g_threadLogStream;
+#else
+    return static_cast<ThreadLogStream *>(
+                        bslmt::ThreadUtil::getSpecific(threadLogStreamKey()));
+#endif
+}
+
+bsl::ostream *obtainThreadLogStream(bsl::streambuf *streamBuf)
+    // Return the address of the logging stream of the calling thread, marked
+    // as in use, after attaching it to the specified 'streamBuf'.  Return 0 if
+    // the stream of the calling thread is already in use (e.g., if a message
+    // is streamed from within the streaming of another message), or if the
+    // stream could not be registered in thread-specific storage.
+{
+    ThreadLogStream *threadStream = lookupThreadLogStream();
+
+    if (!threadStream) {
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        threadStream = new (*allocator) ThreadLogStream();
+
+        if (0 != bslmt::ThreadUtil::setSpecific(threadLogStreamKey(),
+                                                threadStream)) {
+            allocator->deleteObject(threadStream);
+            return 0;                                                 // RETURN
+        }
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+        g_threadLogStream = threadStream;
+#endif
+    }
+    else if (threadStream->d_inUse) {
+        return 0;                                                     // RETURN
+    }
+
+    threadStream->d_inUse = true;
+    threadStream->d_stream.rdbuf(streamBuf);  // also clears the stream state
+
+    return &threadStream->d_stream;
+}
+
+void releaseThreadLogStream()
+    // Detach the logging stream of the calling thread, restore its default
+    // formatting state and its original locale, and mark it as no longer in
+    // use.  The behavior is
+    // undefined unless the stream of the calling thread was obtained by a call
+    // to 'obtainThreadLogStream' and has not yet been released.
+{
+    ThreadLogStream *threadStream = lookupThreadLogStream();
+
+    BSLS_ASSERT(threadStream);
+    BSLS_ASSERT(threadStream->d_inUse);
+
+    bsl::ostream& stream = threadStream->d_stream;
+
+    stream.flags(bsl::ios_base::skipws | bsl::ios_base::dec);
+    stream.precision(6);
+    stream.width(0);
+    stream.fill(' ');
+    stream.exceptions(bsl::ios_base::goodbit);
+    stream.rdbuf(0);
+
+    // A 'copyfmt' into the stream replaces its 'pword' slots and callbacks,
+    // in which case a changed locale can no longer be detected, and so the
+    // locale is restored unconditionally.
+
+    if (threadStream->d_imbued
+     || threadStream != stream.pword(threadLogStreamIndex())) {
+        stream.imbue(threadStream->d_locale);
+        if (threadStream != stream.pword(threadLogStreamIndex())) {
+            threadStream->watch();
+        }
+        threadStream->d_imbued = false;
+    }
+
+    threadStream->d_inUse = false;
+}
+
+}  // close unnamed namespace
 
                          // ----------
                          // struct Log
@@ -227,12 +440,28 @@ Log_Stream::Log_Stream(const Category *category,
 : d_category_p(category)
 , d_record_p(Log::getRecord(category, fileName, lineNumber))
 , d_severity(severity)
-, d_stream(&d_record_p->fixedFields().messageStreamBuf())
+, d_stream_p(0)
 {
+    bsl::streambuf *streamBuf = &d_record_p->fixedFields().messageStreamBuf();
+
+    d_stream_p = obtainThreadLogStream(streamBuf);
+    if (!d_stream_p) {
+        d_stream_p = new (d_localStream.buffer()) bsl::ostream(streamBuf);
+    }
 }
 
 Log_Stream::~Log_Stream() BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
 {
+    // Release the stream before logging the record, as an observer may itself
+    // log messages.
+
+    if (d_localStream.address() == d_stream_p) {
+        bslma::DestructionUtil::destroy(d_stream_p);
+    }
+    else {
+        releaseThreadLogStream();
+    }
+
     Log::logMessage(d_category_p, d_severity, d_record_p);
 }
 
@@ -367,6 +367,12 @@ BSLS_IDENT("$Id: $")
 //  Within the logging code block a special macro, 'BALL_LOG_OUTPUT_STREAM',
 //  provides access to the log stream.
 //
+//  Note that the log stream is reused by successive log messages of a thread.
+//  Its format flags, precision, width, fill character, exception mask, and
+//  locale are restored after each message, but any other state (e.g., the
+//  'iword' and 'pword' slots and the callbacks registered with the stream)
+//  persists from one log message to the next.
+//
 //  Note that code within a logging code block must not produce any side
 //  effects because it may or may not be executed based on run-time
 //  configuration of the 'ball' logging subsystem.
@@ -934,6 +940,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_annotation.h>
 #include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
 
@@ -1600,22 +1607,34 @@ class Log_Stream {
     //  - severity at which to log the record
     //  - stream to which the user log message is put
     //..
-    // As a side-effect of creating an object of this class, the record and
-    // stream are also constructed.  As a side-effect of destroying the
-    // object, the record is logged.
+    // As a side-effect of creating an object of this class, the record is
+    // also constructed and the stream is attached to it.  As a side-effect of
+    // destroying the object, the record is logged.  The stream is the logging
+    // stream of the calling thread, which is created once per thread, unless
+    // that stream is already in use (e.g., when a log message is streamed
+    // from within the streaming of another log message), in which case a
+    // stream local to this object is constructed.  The formatting state and
+    // locale of the stream of the calling thread are restored when the object
+    // is destroyed, but its 'iword' and 'pword' slots and registered
+    // callbacks are not.
     //
     // This class should *not* be used directly by client code.  It is an
     // implementation detail of the macros provided by this component.
 
     // DATA
-    const Category *d_category_p;  // category to which record is logged
-                                   // (held, not owned)
+    const Category  *d_category_p;  // category to which record is logged
+                                    // (held, not owned)
+
+    Record          *d_record_p;    // logged record (held, not owned)
 
-    Record         *d_record_p;    // logged record (held, not owned)
+    const int        d_severity;    // severity at which record is logged
 
-    const int       d_severity;    // severity at which record is logged
+    bsl::ostream    *d_stream_p;    // stream to which log message is put
+                                    // (held, not owned)
 
-    bsl::ostream    d_stream;      // stream to which log message is put
+    bsls::ObjectBuffer<bsl::ostream>
+                     d_localStream; // stream used when the stream of the
+                                    // calling thread is already in use
 
   private:
     // NOT IMPLEMENTED
@@ -1817,7 +1836,7 @@ Record *Log_Stream::record()
 inline
 bsl::ostream& Log_Stream::stream()
 {
-    return d_stream;
+    return *d_stream_p;
 }
 
 // ACCESSORS
@@ -60,7 +60,9 @@
 #include <bsl_ctime.h>
 #include <bsl_fstream.h>
 #include <bsl_functional.h>
+#include <bsl_iomanip.h>
 #include <bsl_iostream.h>
+#include <bsl_locale.h>
 #include <bsl_memory.h>
 #include <bsl_set.h>
 #include <bsl_sstream.h>
@@ -166,6 +168,7 @@ using bsl::flush;
 // [38] RULE-BASED LOGGING USAGE EXAMPLE
 // [39] CLASS-SCOPE LOGGING USAGE EXAMPLE
 // [40] BASIC LOGGING USAGE EXAMPLE
+// [-3] BENCHMARK: RECORDS PER SECOND VS. NUMBER OF THREADS
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -456,6 +459,19 @@ class CerrBufferGuard {
 
 };
 
+class GroupingNumpunct : public bsl::numpunct<char> {
+    // This 'class' provides a numeric punctuation facet that groups the
+    // digits of integers in threes, separated by commas.
+
+  protected:
+    // PROTECTED ACCESSORS
+    virtual char do_thousands_sep() const { return ','; }
+        // Return the character that separates digit groups.
+
+    virtual string_type do_grouping() const { return "\3"; }
+        // Return the digit grouping, which is three digits per group.
+};
+
 void logNamespaceOverride() {
     // Override the outer logging category and log a test message.
     BALL_LOG_SET_CATEGORY("BALL_LOG.T.OVERRIDE.U");
@@ -2927,6 +2943,74 @@ void *workerThreadPerformance(void *)
 
 }  // close namespace BALL_LOG_TEST_CASE_MINUS_2
 
+// ============================================================================
+//                         CASE -3 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOG_TEST_CASE_MINUS_3 {
+
+class NullObserver : public BloombergLP::ball::Observer {
+    // This concrete implementation of 'ball::Observer' ignores all records
+    // published to it.
+
+  public:
+    // MANIPULATORS
+    using BloombergLP::ball::Observer::publish;
+
+    void publish(const bsl::shared_ptr<const BloombergLP::ball::Record>&,
+                 const BloombergLP::ball::Context&)
+        // Ignore the supplied record and context.
+    {
+    }
+};
+
+enum LoggingPath {
+    e_SHARED_BUFFER,  // 'printf'-style into the buffer shared by all threads
+    e_PRINTF,         // 'BALL_LOGVA_INFO'
+    e_STREAM          // 'BALL_LOG_INFO'
+};
+
+const char  *MESSAGE       = "The quick brown fox jumps over the lazy dog";
+int          numIterations = 100000;
+LoggingPath  loggingPath   = e_SHARED_BUFFER;
+
+extern "C" {
+void *workerThreadBenchmark(void *)
+{
+    using namespace BloombergLP;
+
+    BALL_LOG_SET_CATEGORY("BENCHMARK");
+
+    for (int i = 0; i < numIterations; ++i) {
+        switch (loggingPath) {
+          case e_SHARED_BUFFER: {
+            bslmt::Mutex *mutex;
+            int           bufferSize;
+            char         *buffer = ball::Log::obtainMessageBuffer(&mutex,
+                                                                  &bufferSize);
+
+            bsl::snprintf(buffer, bufferSize, "message %d: %s", i, MESSAGE);
+            ball::Log::logMessage(BALL_LOG_CATEGORY,
+                                  ball::Severity::e_INFO,
+                                  __FILE__,
+                                  __LINE__,
+                                  buffer);
+            ball::Log::releaseMessageBuffer(mutex);
+          } break;
+          case e_PRINTF: {
+            BALL_LOGVA_INFO("message %d: %s", i, MESSAGE);
+          } break;
+          case e_STREAM: {
+            BALL_LOG_INFO << "message " << i << ": " << MESSAGE;
+          } break;
+        }
+    }
+    return NULL;
+}
+}  // extern "C"
+
+}  // close namespace BALL_LOG_TEST_CASE_MINUS_3
+
 // ============================================================================
 //                              MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -7635,6 +7719,99 @@ if (verbose) bsl::cout << "printf-style macro usage" << bsl::endl;
             ASSERTV(LINE, 0 == bsl::strcmp(FILENAME,
                                        mL.record()->fixedFields().fileName()));
         }
+
+        if (verbose) bsl::cout << "\tTesting 'stream'." << bsl::endl;
+        {
+            // The stream of a thread is reused by successive logging streams
+            // of that thread, so verify that streaming into nested logging
+            // streams yields distinct messages, and that formatting state set
+            // by one message does not carry over to the next.
+
+            const Cat *CATEGORY = CM.addCategory("STREAM", 0, 0, 0, 0);
+
+            ASSERT(CATEGORY);
+
+            {
+                LogStream mX(CATEGORY, __FILE__, L_, 1);
+
+                mX.stream() << bsl::hex << bsl::showbase << 255 << ' '
+                            << bsl::setfill('*') << bsl::setw(4) << 7 << ' '
+                            << bsl::setprecision(2) << 1.2345 << ' '
+                            << bsl::boolalpha << true;
+
+                {
+                    LogStream mY(CATEGORY, __FILE__, L_, 1);
+
+                    ASSERT(&mX.stream() != &mY.stream());
+
+                    mY.stream() << 255 << ' ' << true;
+
+                    ASSERTV(mY.record()->fixedFields().messageRef(),
+                            "255 1" ==
+                                     mY.record()->fixedFields().messageRef());
+                }
+
+                mX.stream() << ' ' << 16;
+
+                ASSERTV(mX.record()->fixedFields().messageRef(),
+                        "0xff *0x7 1.2 true 0x10" ==
+                                     mX.record()->fixedFields().messageRef());
+            }
+
+            {
+                LogStream mZ(CATEGORY, __FILE__, L_, 1);
+
+                mZ.stream() << 255 << ' ' << bsl::setw(2) << 7 << ' '
+                            << 1.2345 << ' ' << true;
+
+                ASSERTV(mZ.record()->fixedFields().messageRef(),
+                        "255  7 1.2345 1" ==
+                                     mZ.record()->fixedFields().messageRef());
+                ASSERT(mZ.stream().good());
+            }
+
+            if (verbose) bsl::cout << "\tTesting that the locale is restored."
+                                   << bsl::endl;
+
+            for (int i = 0; i < 2; ++i) {
+                // Imbue a locale that groups digits in threes into the stream
+                // of one message, then verify that the next message is not
+                // affected.  The second iteration uses 'copyfmt', which also
+                // replaces the 'pword' slots and callbacks of the stream.
+
+                {
+                    LogStream mX(CATEGORY, __FILE__, L_, 1);
+
+                    const bsl::locale LOCALE(bsl::locale::classic(),
+                                             new u::GroupingNumpunct());
+
+                    if (0 == i) {
+                        mX.stream().imbue(LOCALE);
+                    }
+                    else {
+                        bsl::ostringstream other;
+                        other.imbue(LOCALE);
+                        mX.stream().copyfmt(other);
+                    }
+
+                    mX.stream() << 1234567;
+
+                    ASSERTV(i, mX.record()->fixedFields().messageRef(),
+                            "1,234,567" ==
+                                     mX.record()->fixedFields().messageRef());
+                }
+
+                for (int j = 0; j < 2; ++j) {
+                    LogStream mY(CATEGORY, __FILE__, L_, 1);
+
+                    mY.stream() << 1234567;
+
+                    ASSERTV(i, j, mY.record()->fixedFields().messageRef(),
+                            "1234567" ==
+                                     mY.record()->fixedFields().messageRef());
+                }
+            }
+        }
       } break;
       case 18: {
         // --------------------------------------------------------------------
@@ -12026,6 +12203,78 @@ if (verbose) bsl::cout << "printf-style macro usage" << bsl::endl;
                   << " seconds."
                   << bsl::endl;
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // BENCHMARK: RECORDS PER SECOND VS. NUMBER OF THREADS
+        //
+        // Concerns:
+        //: 1 Logging throughput scales with the number of logging threads
+        //:   when messages are formatted in per-thread buffers and streams,
+        //:   as opposed to a buffer shared by all threads.
+        //
+        // Plan:
+        //: 1 Register an observer that ignores published records, and
+        //:   configure the logger manager to pass every 'e_INFO' record
+        //:   through to it.
+        //:
+        //: 2 For 1, 2, 4, 8, and 16 threads, have each thread log a fixed
+        //:   number of records (a) 'printf'-style into the buffer shared by
+        //:   all threads, which is locked by 'ball::Log::obtainMessageBuffer',
+        //:   (b) using 'BALL_LOGVA_INFO', and (c) using 'BALL_LOG_INFO'.
+        //:   Report the number of records logged per second for each.
+        //
+        // Testing:
+        //   BENCHMARK: RECORDS PER SECOND VS. NUMBER OF THREADS
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout
+                       << bsl::endl
+                       << "BENCHMARK: RECORDS PER SECOND VS. NUMBER OF THREADS"
+                       << bsl::endl
+                       << "==================================================="
+                       << bsl::endl;
+
+        using namespace BALL_LOG_TEST_CASE_MINUS_3;
+        using namespace BloombergLP;
+
+        ball::LoggerManagerConfiguration lmc;
+        lmc.setDefaultThresholdLevelsIfValid(
+                                 ball::Severity::e_OFF,    // record level
+                                 ball::Severity::e_INFO,   // passthrough level
+                                 ball::Severity::e_OFF,    // trigger level
+                                 ball::Severity::e_OFF);   // triggerAll level
+
+        ball::LoggerManagerScopedGuard lmg(lmc);
+
+        ASSERT(0 == ball::LoggerManager::singleton().registerObserver(
+                                             bsl::make_shared<NullObserver>(),
+                                             "null"));
+
+        const LoggingPath PATHS[] = { e_SHARED_BUFFER, e_PRINTF, e_STREAM };
+        enum { k_NUM_PATHS = sizeof PATHS / sizeof *PATHS };
+
+        bsl::printf("%8s %16s %16s %16s  (records/s)\n",
+                    "threads", "shared buffer", "BALL_LOGVA", "BALL_LOG");
+
+        for (int numThreads = 1; numThreads <= 16; numThreads *= 2) {
+            bsl::printf("%8d", numThreads);
+
+            for (int p = 0; p < k_NUM_PATHS; ++p) {
+                loggingPath = PATHS[p];
+
+                bsls::Stopwatch timer;
+                timer.start();
+                u::executeInParallel(numThreads, workerThreadBenchmark);
+                timer.stop();
+
+                const double numRecords = static_cast<double>(numThreads)
+                                        * numIterations;
+
+                bsl::printf(" %16.0f", numRecords / timer.elapsedTime());
+            }
+            bsl::printf("\n");
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
@@ -24,11 +24,13 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 
 #include <bslma_default.h>
 #include <bslma_managedptr.h>
+#include <bslma_newdeleteallocator.h>
 
 #include <bslmt_mutex.h>
 #include <bslmt_once.h>
 #include <bslmt_qlock.h>
 #include <bslmt_readlockguard.h>
+#include <bslmt_threadlocalvariable.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_writelockguard.h>
 
@@ -118,6 +120,145 @@ void bufferPoolDeleter(void *buffer, void *pool)
     p->deallocate(buffer);
 }
 
+                        // ==========================
+                        // struct ThreadMessageBuffer
+                        // ==========================
+
+struct ThreadMessageBuffer {
+    // This 'struct' holds the buffer that a thread uses to format log messages
+    // (see 'Logger::obtainMessageBuffer').  A thread creates its buffer the
+    // first time that it formats a message, and the buffer is destroyed when
+    // the thread exits.
+
+    // DATA
+    char *d_buffer_p;  // formatting buffer (owned)
+    int   d_size;      // size (in bytes) of 'd_buffer_p'
+    bool  d_inUse;     // 'true' while 'd_buffer_p' is loaned out
+};
+
+// On supported platforms, define a thread-local variable,
+// 'g_threadMessageBuffer', to serve as the cache for
+// 'bslmt::ThreadUtil::getSpecific'.  Note that the memory is managed by
+// 'bslmt::ThreadUtil' thread-specific storage.
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(ThreadMessageBuffer *, g_threadMessageBuffer, 0);
+#endif
+
+void destroyThreadMessageBuffer(void *threadBuffer)
+    // Deallocate the specified 'threadBuffer' and the formatting buffer that
+    // it holds.  The behavior is undefined unless 'threadBuffer' is null or
+    // was created by 'obtainThreadMessageBuffer'.  Note that this function is
+    // installed as the destructor of the thread-specific storage key returned
+    // by 'threadMessageBufferKey', and so is invoked on thread exit.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_threadMessageBuffer = 0;
+#endif
+
+    ThreadMessageBuffer *buffer =
+                             static_cast<ThreadMessageBuffer *>(threadBuffer);
+    if (buffer) {
+        // The buffers outlive any logger manager, and so are supplied by the
+        // 'new'/'delete' allocator rather than by the global allocator.
+
+        bslma::Allocator *allocator =
+                                    &bslma::NewDeleteAllocator::singleton();
+
+        allocator->deallocate(buffer->d_buffer_p);
+        allocator->deallocate(buffer);
+    }
+}
+
+const bslmt::ThreadUtil::Key& threadMessageBufferKey()
+    // Return a reference providing non-modifiable access to the
+    // thread-specific storage key under which the 'ThreadMessageBuffer' of
+    // each thread is stored.
+{
+    static bslmt::ThreadUtil::Key s_key;
+    BSLMT_ONCE_DO {
+        bslmt::ThreadUtil::createKey(&s_key,
+                                     (bslmt::ThreadUtil::Destructor)
+                                     &destroyThreadMessageBuffer);
+    }
+    return s_key;
+}
+
+ThreadMessageBuffer *obtainThreadMessageBuffer(int size)
+    // Return the address of the message buffer of the calling thread, marked
+    // as in use, after ensuring that it holds at least the specified 'size'
+    // bytes.  Return 0 if the buffer of the calling thread is already in use
+    // (e.g., if a message is formatted from within the formatting of another
+    // message), or if the buffer could not be registered in thread-specific
+    // storage.  The behavior is undefined unless '0 < size'.
+{
+    BSLS_ASSERT(0 < size);
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    ThreadMessageBuffer *buffer = g_threadMessageBuffer;
+#else
+    ThreadMessageBuffer *buffer = static_cast<ThreadMessageBuffer *>(
+                    bslmt::ThreadUtil::getSpecific(threadMessageBufferKey()));
+#endif
+
+    bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+    if (!buffer) {
+        buffer = static_cast<ThreadMessageBuffer *>(
+                           allocator->allocate(sizeof(ThreadMessageBuffer)));
+        buffer->d_buffer_p = 0;
+        buffer->d_size     = 0;
+        buffer->d_inUse    = false;
+
+        if (0 != bslmt::ThreadUtil::setSpecific(threadMessageBufferKey(),
+                                                buffer)) {
+            allocator->deallocate(buffer);
+            return 0;                                                 // RETURN
+        }
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+        g_threadMessageBuffer = buffer;
+#endif
+    }
+    else if (buffer->d_inUse) {
+        return 0;                                                     // RETURN
+    }
+
+    if (buffer->d_size < size) {
+        allocator->deallocate(buffer->d_buffer_p);
+        buffer->d_buffer_p = 0;
+        buffer->d_size     = 0;
+
+        buffer->d_buffer_p = static_cast<char *>(allocator->allocate(size));
+        buffer->d_size     = size;
+    }
+
+    buffer->d_inUse = true;
+    return buffer;
+}
+
+void threadMessageBufferDeleter(void *, void *threadBuffer)
+    // Return the formatting buffer held by the specified 'threadBuffer' to the
+    // calling thread.  The behavior is undefined unless 'threadBuffer' was
+    // returned by 'obtainThreadMessageBuffer' on the calling thread.
+{
+    BSLS_ASSERT(threadBuffer);
+
+    static_cast<ThreadMessageBuffer *>(threadBuffer)->d_inUse = false;
+}
+
+bslma::ManagedPtr<char> makeThreadMessageBuffer(
+                                            ThreadMessageBuffer *threadBuffer)
+    // Return a managed pointer that refers to the formatting buffer held by
+    // the specified 'threadBuffer', and that returns the buffer to the calling
+    // thread when it is destroyed.
+{
+    BSLS_ASSERT(threadBuffer);
+
+    return bslma::ManagedPtr<char>(threadBuffer->d_buffer_p,
+                                   static_cast<void *>(threadBuffer),
+                                   &threadMessageBufferDeleter);
+}
+
 const char *filterName(
    bsl::string                                             *filteredNameBuffer,
    const char                                              *originalName,
@@ -513,6 +654,16 @@ char *Logger::obtainMessageBuffer(bslmt::Mutex **mutex, int *bufferSize)
 bslma::ManagedPtr<char> Logger::obtainMessageBuffer(int *bufferSize)
 {
     *bufferSize = d_scratchBufferSize;
+
+    ThreadMessageBuffer *threadBuffer =
+                               obtainThreadMessageBuffer(d_scratchBufferSize);
+    if (threadBuffer) {
+        return makeThreadMessageBuffer(threadBuffer);                 // RETURN
+    }
+
+    // The buffer of this thread is already in use, so fall back to the pool
+    // shared by all threads.
+
     char *buffer = static_cast<char *>(d_bufferPool.allocate());
 
     bslma::ManagedPtr<char> bufferManagedPtr(
@@ -905,6 +1056,14 @@ bslma::ManagedPtr<char> LoggerManager::obtainMessageBuffer(int *bufferSize)
 {
     const int k_DEFAULT_LOGGER_BUFFER_SIZE = 8192;
 
+    *bufferSize = k_DEFAULT_LOGGER_BUFFER_SIZE;
+
+    ThreadMessageBuffer *threadBuffer =
+                      obtainThreadMessageBuffer(k_DEFAULT_LOGGER_BUFFER_SIZE);
+    if (threadBuffer) {
+        return makeThreadMessageBuffer(threadBuffer);                 // RETURN
+    }
+
     static bsls::ObjectBuffer<bdlma::ConcurrentPool> staticPool;
 
     BSLMT_ONCE_DO {
@@ -925,9 +1084,6 @@ bslma::ManagedPtr<char> LoggerManager::obtainMessageBuffer(int *bufferSize)
                                       static_cast<void *>(staticPool.buffer()),
                                       bufferPoolDeleter);
 
-
-    *bufferSize = k_DEFAULT_LOGGER_BUFFER_SIZE;
-
     return bufferManagedPtr;
 }
 
@@ -1115,8 +1115,12 @@ class Logger {
     bslma::ManagedPtr<char> obtainMessageBuffer(int *bufferSize);
         // Return a managed pointer that refers to the memory block to which
         // this thread of execution has exclusive access and load the size (in
-        // bytes) of this buffer into the specified 'bufferSize' address.  Note
-        // that this method is intended for *internal* *use* only.
+        // bytes) of this buffer into the specified 'bufferSize' address.  The
+        // block is the formatting buffer of the calling thread unless that
+        // buffer is already in use (e.g., if this method is called while a
+        // message is being formatted), in which case it is taken from a pool
+        // shared by all threads.  Note that this method is intended for
+        // *internal* *use* only.
 
     void publish();
         // Publish to the observer held by this logger all records stored in
@@ -1444,8 +1448,11 @@ class LoggerManager {
     static bslma::ManagedPtr<char> obtainMessageBuffer(int *bufferSize);
         // Return a managed pointer that refers to the memory block to which
         // this thread of execution has exclusive access and load the size (in
-        // bytes) of this buffer into the specified 'bufferSize' address.  Note
-        // that this method is intended for *internal* *use* only.
+        // bytes) of this buffer into the specified 'bufferSize' address.  The
+        // block is the formatting buffer of the calling thread unless that
+        // buffer is already in use, in which case it is taken from a pool
+        // shared by all threads.  Note that this method is intended for
+        // *internal* *use* only.
 
     static void shutDownSingleton();
         // Destroy the logger manager singleton and release all resources used
@@ -13,6 +13,17 @@
 // significant performance overhead.  For this reason, the 'operator()' method
 // is implemented by writing the formatted string to a buffer before inserting
 // to a stream.
+//
+// The format specification is compiled into 'd_steps' whenever it is set, so
+// 'operator()' executes a sequence of typed steps rather than re-parsing the
+// specification.  Integers are converted by hand rather than by 'snprintf',
+// and the date and time of the last formatted timestamp are cached, to the
+// second, in 'd_cache'.  'operator()' is 'const' and may be called
+// concurrently, so 'd_cache' is claimed with a test-and-swap of
+// 'd_cacheInUse'; a thread that fails to claim it renders into a local cache
+// instead of waiting.  The claim is held (by a 'TimestampCacheGuard') only
+// while the timestamp is rendered and copied to the local cache, so it is
+// released before any output is produced, and on every exit path.
 
 #include <ball_recordstringformatter.h>
 
@@ -30,10 +41,12 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <bdlma_bufferedsequentialallocator.h>
 
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
 #include <bdlt_iso8601util.h>
 #include <bdlt_iso8601utilconfiguration.h>
+#include <bdlt_time.h>
 
 #include <bsls_annotation.h>
 #include <bsls_platform.h>
@@ -42,9 +55,8 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <bslstl_stringref.h>
 
 #include <bsl_climits.h>   // for 'INT_MAX'
-#include <bsl_cstring.h>   // for 'bsl::strcmp'
+#include <bsl_cstring.h>   // for 'bsl::strcmp', 'bsl::memcpy'
 #include <bsl_c_stdlib.h>
-#include <bsl_c_stdio.h>   // for 'snprintf'
 
 #include <bsl_iomanip.h>
 #include <bsl_ostream.h>
@@ -58,62 +70,123 @@ const char *const DEFAULT_FORMAT_SPEC = "\n%d %p:%t %s %f:%l %c %m %u\n";
 
 namespace BloombergLP {
 
-// STATIC HELPER FUNCTIONS
-static void appendToString(bsl::string *result, int value)
-    // Convert the specified 'value' into ASCII characters and append it to the
-    // specified 'result.
-{
-    char buffer[16];
+namespace {
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+                        // =========================
+                        // class TimestampCacheGuard
+                        // =========================
+
+class TimestampCacheGuard {
+    // This class implements a guard that attempts, on construction, to claim
+    // a shared timestamp cache by setting its in-use flag, and, if the claim
+    // succeeded, releases the cache (by clearing the flag) on destruction.
+
+    // DATA
+    bsls::AtomicInt *d_inUse_p;  // in-use flag of the claimed cache, or 0 if
+                                 // the claim failed
+
+    // NOT IMPLEMENTED
+    TimestampCacheGuard(const TimestampCacheGuard&);
+    TimestampCacheGuard& operator=(const TimestampCacheGuard&);
+
+  public:
+    // CREATORS
+    explicit TimestampCacheGuard(bsls::AtomicInt *inUse)
+        // Create a guard that attempts to claim the cache having the specified
+        // 'inUse' flag, which is 1 if the cache is claimed and 0 otherwise.
+    : d_inUse_p(0 == inUse->testAndSwap(0, 1) ? inUse : 0)
+    {
+    }
 
-    snprintf(buffer, sizeof buffer, "%d", value);
+    ~TimestampCacheGuard()
+        // Release the cache if it was claimed by this guard, and destroy this
+        // object.
+    {
+        if (d_inUse_p) {
+            d_inUse_p->storeRelease(0);
+        }
+    }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    // ACCESSORS
+    bool isClaimed() const
+        // Return 'true' if this guard claimed the cache, and 'false'
+        // otherwise.
+    {
+        return 0 != d_inUse_p;
+    }
+};
 
-    *result += buffer;
-}
+}  // close unnamed namespace
 
+// STATIC HELPER FUNCTIONS
 static void appendToString(bsl::string *result, bsls::Types::Uint64 value)
     // Convert the specified 'value' into ASCII characters and append it to the
     // specified 'result.
 {
-    char buffer[32];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+    char  buffer[32];
+    char *end   = buffer + sizeof buffer;
+    char *begin = end;
 
-    snprintf(buffer, sizeof buffer, "%llu", value);
+    do {
+        *--begin = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    result->append(begin, end - begin);
+}
 
-    *result += buffer;
+static void appendToString(bsl::string *result, int value)
+    // Convert the specified 'value' into ASCII characters and append it to the
+    // specified 'result.
+{
+    if (value < 0) {
+        *result += '-';
+        appendToString(result,
+                       static_cast<bsls::Types::Uint64>(-(value + 1)) + 1);
+    }
+    else {
+        appendToString(result, static_cast<bsls::Types::Uint64>(value));
+    }
 }
 
 static void appendToStringAsHex(bsl::string *result, bsls::Types::Uint64 value)
     // Convert the specified 'value' into hexadecimal and append it to the
     // specified 'result'.
 {
-    char buffer[32];
+    static const char k_DIGITS[] = "0123456789ABCDEF";
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+    char  buffer[32];
+    char *end   = buffer + sizeof buffer;
+    char *begin = end;
 
-    snprintf(buffer, sizeof(buffer), "%llX", value);
+    do {
+        *--begin = k_DIGITS[value & 0xF];
+        value >>= 4;
+    } while (value);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    result->append(begin, end - begin);
+}
+
+static void appendFraction(bsl::string *result,
+                           int          millisecond,
+                           int          microsecond,
+                           int          precision)
+    // Append to the specified 'result' a decimal point followed by the
+    // specified 'precision' fractional second digits of the specified
+    // 'millisecond' and 'microsecond'.  The behavior is undefined unless
+    // 'precision' is 3 or 6.
+{
+    char buffer[8];
+
+    buffer[0] = '.';
+    buffer[1] = static_cast<char>('0' + millisecond / 100);
+    buffer[2] = static_cast<char>('0' + millisecond / 10 % 10);
+    buffer[3] = static_cast<char>('0' + millisecond % 10);
+    buffer[4] = static_cast<char>('0' + microsecond / 100);
+    buffer[5] = static_cast<char>('0' + microsecond / 10 % 10);
+    buffer[6] = static_cast<char>('0' + microsecond % 10);
 
-    *result += buffer;
+    result->append(buffer, 1 + precision);
 }
 
 namespace ball {
@@ -130,18 +203,142 @@ const int RecordStringFormatter::k_DISABLE_PUBLISH_IN_LOCALTIME = INT_MIN;
 // appear in practice.  Real values are (always?) less than one day (plus or
 // minus).
 
+// PRIVATE MANIPULATORS
+void RecordStringFormatter::appendConversion(char conversion)
+{
+    Step step = { conversion, 0, 0 };
+    d_steps.push_back(step);
+
+    switch (conversion) {
+      case 'd':
+      case 'D':
+      case 'i':
+      case 'I':
+      case 'O': {
+        d_hasTimestamp = true;
+      } break;
+    }
+}
+
+void RecordStringFormatter::appendLiteral(const char *text, int length)
+{
+    // Literal text is appended to 'd_literals' in order, so a literal step
+    // that is the last step can be extended in place.
+
+    if (d_steps.empty() || 0 != d_steps.back().d_conversion) {
+        Step step = { 0, static_cast<int>(d_literals.length()), 0 };
+        d_steps.push_back(step);
+    }
+    d_literals.append(text, length);
+    d_steps.back().d_literalLength += length;
+}
+
+void RecordStringFormatter::compileFormat()
+{
+    d_steps.clear();
+    d_literals.clear();
+    d_hasTimestamp    = false;
+    d_cache.d_isValid = false;
+
+    const char *iter = d_formatSpec.data();
+    const char *end  = iter + d_formatSpec.length();
+
+    while (iter != end) {
+        switch (*iter) {
+          case '%': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case '%': {
+                appendLiteral("%", 1);
+              } break;
+              case 'd':
+              case 'D':
+              case 'i':
+              case 'I':
+              case 'O':
+              case 'p':
+              case 't':
+              case 'T':
+              case 's':
+              case 'f':
+              case 'F':
+              case 'l':
+              case 'c':
+              case 'm':
+              case 'x':
+              case 'X':
+              case 'u': {
+                appendConversion(*iter);
+              } break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                appendLiteral(iter - 1, 2);
+              }
+            }
+            ++iter;
+          } break;
+          case '\\': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case 'n': {
+                appendLiteral("\n", 1);
+              } break;
+              case 't': {
+                appendLiteral("\t", 1);
+              } break;
+              case '\\': {
+                appendLiteral("\\", 1);
+              } break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                appendLiteral(iter - 1, 2);
+              }
+            }
+            ++iter;
+          } break;
+          default: {
+            const char *literalEnd = iter + 1;
+            while (literalEnd != end && '%'  != *literalEnd
+                                     && '\\' != *literalEnd) {
+                ++literalEnd;
+            }
+            appendLiteral(iter, static_cast<int>(literalEnd - iter));
+            iter = literalEnd;
+          }
+        }
+    }
+}
+
 // CREATORS
 RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(0)
+, d_steps(basicAllocator)
+, d_literals(basicAllocator)
+, d_hasTimestamp(false)
+, d_cache()
+, d_cacheInUse(0)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(const char       *format,
                                              bslma::Allocator *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(0)
+, d_steps(basicAllocator)
+, d_literals(basicAllocator)
+, d_hasTimestamp(false)
+, d_cache()
+, d_cacheInUse(0)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -149,7 +346,13 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(offset)
+, d_steps(basicAllocator)
+, d_literals(basicAllocator)
+, d_hasTimestamp(false)
+, d_cache()
+, d_cacheInUse(0)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -163,7 +366,13 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_steps(basicAllocator)
+, d_literals(basicAllocator)
+, d_hasTimestamp(false)
+, d_cache()
+, d_cacheInUse(0)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -172,7 +381,13 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(offset)
+, d_steps(basicAllocator)
+, d_literals(basicAllocator)
+, d_hasTimestamp(false)
+, d_cache()
+, d_cacheInUse(0)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -187,7 +402,13 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_steps(basicAllocator)
+, d_literals(basicAllocator)
+, d_hasTimestamp(false)
+, d_cache()
+, d_cacheInUse(0)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -195,7 +416,13 @@ RecordStringFormatter::RecordStringFormatter(
                                   bslma::Allocator             *basicAllocator)
 : d_formatSpec(original.d_formatSpec, basicAllocator)
 , d_timestampOffset(original.d_timestampOffset)
+, d_steps(original.d_steps, basicAllocator)
+, d_literals(original.d_literals, basicAllocator)
+, d_hasTimestamp(original.d_hasTimestamp)
+, d_cache()
+, d_cacheInUse(0)
 {
+    d_cache.d_isValid = false;
 }
 
 // MANIPULATORS
@@ -205,37 +432,115 @@ RecordStringFormatter& RecordStringFormatter::operator=(
     if (this != &rhs) {
         d_formatSpec      = rhs.d_formatSpec;
         d_timestampOffset = rhs.d_timestampOffset;
+        d_steps           = rhs.d_steps;
+        d_literals        = rhs.d_literals;
+        d_hasTimestamp    = rhs.d_hasTimestamp;
     }
 
     return *this;
 }
 
+void RecordStringFormatter::setFormat(const char *format)
+{
+    d_formatSpec = format;
+    compileFormat();
+}
+
 // ACCESSORS
 void RecordStringFormatter::operator()(bsl::ostream& stream,
                                        const Record& record) const
 
 {
     const RecordAttributes& fixedFields = record.fixedFields();
-    bdlt::DatetimeInterval  offset;
 
-    if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
+    // Compute the timestamp only if the format specification refers to it,
+    // as computing the local time offset may be expensive.
+
+    bdlt::Datetime timestamp;
+    TimestampCache localCache;  // rendering of 'timestamp' used for output
+
+    if (d_hasTimestamp) {
+        bdlt::DatetimeInterval offset;
+
+        if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
                                        d_timestampOffset.totalMilliseconds()) {
-        bsls::Types::Int64 localTimeOffsetInSeconds =
-            bdlt::LocalTimeOffset::localTimeOffset(
+            bsls::Types::Int64 localTimeOffsetInSeconds =
+                bdlt::LocalTimeOffset::localTimeOffset(
                                        fixedFields.timestamp()).totalSeconds();
-        offset.setTotalSeconds(localTimeOffsetInSeconds);
-    } else if (k_DISABLE_PUBLISH_IN_LOCALTIME !=
+            offset.setTotalSeconds(localTimeOffsetInSeconds);
+        } else if (k_DISABLE_PUBLISH_IN_LOCALTIME !=
                                        d_timestampOffset.totalMilliseconds()) {
-        offset = d_timestampOffset;
-    }
+            offset = d_timestampOffset;
+        }
 
-    bdlt::DatetimeTz timestamp(fixedFields.timestamp() + offset,
-                               static_cast<int>(offset.totalMinutes()));
+        timestamp = fixedFields.timestamp() + offset;
 
-    // Step through the format string, outputting the required elements.
+        const int offsetInMinutes = static_cast<int>(offset.totalMinutes());
+        const int secondOfDay     = timestamp.hour()   * 3600
+                                  + timestamp.minute() *   60
+                                  + timestamp.second();
 
-    const char* iter = d_formatSpec.data();
-    const char* end  = iter + d_formatSpec.length();
+        // Use the shared cache unless another thread is using it.  The
+        // rendering is copied to 'localCache', so the shared cache is released
+        // (by 'guard') at the end of this block, before any output is
+        // produced.
+
+        TimestampCacheGuard  guard(&d_cacheInUse);
+        TimestampCache      *cache = &localCache;
+
+        if (guard.isClaimed()) {
+            cache = &d_cache;
+        }
+        else {
+            localCache.d_isValid = false;
+        }
+
+        if (!cache->d_isValid
+         || cache->d_secondOfDay     != secondOfDay
+         || cache->d_offsetInMinutes != offsetInMinutes
+         || cache->d_date            != timestamp.date()) {
+            bdlt::Datetime second(timestamp.date(),
+                                  bdlt::Time(timestamp.hour(),
+                                             timestamp.minute(),
+                                             timestamp.second()));
+
+            cache->d_datetimeLength = second.printToBuffer(
+                                                    cache->d_datetime,
+                                                    sizeof cache->d_datetime,
+                                                    0);
+
+            // Use ISO8601 "extended" format.
+
+            bdlt::Iso8601UtilConfiguration config;
+            config.setFractionalSecondPrecision(0);
+            config.setUseZAbbreviationForUtc(true);
+
+            char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+
+            int outputLength = bdlt::Iso8601Util::generateRaw(
+                                     buffer,
+                                     bdlt::DatetimeTz(second, offsetInMinutes),
+                                     config);
+
+            enum { k_TZINFO_OFFSET = 19 };
+
+            bsl::memcpy(cache->d_iso8601, buffer, k_TZINFO_OFFSET);
+            cache->d_iso8601Length     = k_TZINFO_OFFSET;
+            cache->d_iso8601ZoneLength = outputLength - k_TZINFO_OFFSET;
+            bsl::memcpy(cache->d_iso8601Zone,
+                        buffer + k_TZINFO_OFFSET,
+                        cache->d_iso8601ZoneLength);
+
+            cache->d_date            = timestamp.date();
+            cache->d_secondOfDay     = secondOfDay;
+            cache->d_offsetInMinutes = offsetInMinutes;
+            cache->d_isValid         = true;
+        }
+
+        if (guard.isClaimed()) {
+            localCache = d_cache;
+        }
+    }
 
     // Create a buffer on the stack for formatting the record.  Note that the
     // size of the buffer should be slightly larger than the amount we reserve
@@ -251,173 +556,115 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
     bsl::string output(&stringAllocator);
     output.reserve(STRING_RESERVATION);
 
-    while (iter != end) {
-        switch (*iter) {
-          case '%': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case '%': {
-                output += '%';
-              } break;
-              case 'd': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'D': {
-                const int fractionalSecondPrecision = 'd' == *iter ? 3 : 6;
-
-                char buffer[32];
-                timestamp.localDatetime().printToBuffer(
-                                                    buffer,
-                                                    sizeof buffer,
-                                                    fractionalSecondPrecision);
-
-                output += buffer;
-              } break;
-              case 'I': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'O': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'i': {
-                // Use ISO8601 "extended" format.
-
-                const int fractionalSecondPrecision = 'O' == *iter ? 6 : 3;
-
-                bdlt::Iso8601UtilConfiguration config;
-                config.setFractionalSecondPrecision(fractionalSecondPrecision);
-                config.setUseZAbbreviationForUtc(true);
-
-                char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+    // Execute the compiled format specification.
 
-                int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                                  timestamp,
-                                                                  config);
+    const Step *iter = d_steps.data();
+    const Step *end  = iter + d_steps.size();
 
-                if ('i' == *iter) {
-                    // Remove milliseconds part.
-
-                    enum { k_DECIMAL_SIGN_OFFSET = 19,
-                           k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
-                    bslstl::StringRef head(buffer, k_DECIMAL_SIGN_OFFSET);
-
-                    bslstl::StringRef tail(buffer + k_TZINFO_OFFSET,
-                                           outputLength - k_TZINFO_OFFSET);
-
-                    output += head + tail;
-                }
-                else {
-                    output.append(buffer, outputLength);
-                }
-              } break;
-              case 'p': {
-                appendToString(&output, fixedFields.processID());
-              } break;
-              case 't': {
-                appendToString(&output, fixedFields.threadID());
-              } break;
-              case 'T': {
-                appendToStringAsHex(&output, fixedFields.threadID());
-              } break;
-              case 's': {
-                output += Severity::toAscii(
+    for (; iter != end; ++iter) {
+        switch (iter->d_conversion) {
+          case 0: {
+            output.append(d_literals.data() + iter->d_literalOffset,
+                          iter->d_literalLength);
+          } break;
+          case 'd': BSLS_ANNOTATION_FALLTHROUGH;
+          case 'D': {
+            output.append(localCache.d_datetime, localCache.d_datetimeLength);
+            appendFraction(&output,
+                           timestamp.millisecond(),
+                           timestamp.microsecond(),
+                           'd' == iter->d_conversion ? 3 : 6);
+          } break;
+          case 'I': BSLS_ANNOTATION_FALLTHROUGH;
+          case 'O': BSLS_ANNOTATION_FALLTHROUGH;
+          case 'i': {
+            output.append(localCache.d_iso8601, localCache.d_iso8601Length);
+            if ('i' != iter->d_conversion) {
+                appendFraction(&output,
+                               timestamp.millisecond(),
+                               timestamp.microsecond(),
+                               'O' == iter->d_conversion ? 6 : 3);
+            }
+            output.append(localCache.d_iso8601Zone,
+                          localCache.d_iso8601ZoneLength);
+          } break;
+          case 'p': {
+            appendToString(&output, fixedFields.processID());
+          } break;
+          case 't': {
+            appendToString(&output, fixedFields.threadID());
+          } break;
+          case 'T': {
+            appendToStringAsHex(&output, fixedFields.threadID());
+          } break;
+          case 's': {
+            output += Severity::toAscii(
                                  (Severity::Level)fixedFields.severity());
-              } break;
-              case 'f': {
-                output += fixedFields.fileName();
-              } break;
-              case 'F': {
-                const bsl::string& filename = fixedFields.fileName();
-                bsl::string::size_type rightmostSlashIndex =
+          } break;
+          case 'f': {
+            output += fixedFields.fileName();
+          } break;
+          case 'F': {
+            const bsl::string& filename = fixedFields.fileName();
+            bsl::string::size_type rightmostSlashIndex =
 #ifdef BSLS_PLATFORM_OS_WINDOWS
-                    filename.rfind('\\');
+                filename.rfind('\\');
 #else
-                    filename.rfind('/');
+                filename.rfind('/');
 #endif
-                if (bsl::string::npos == rightmostSlashIndex) {
-                    output += filename;
-                }
-                else {
-                    output += filename.substr(rightmostSlashIndex + 1);
-                }
-              } break;
-              case 'l': {
-                appendToString(&output, fixedFields.lineNumber());
-              } break;
-              case 'c': {
-                output += fixedFields.category();
-              } break;
-              case 'm': {
-                bslstl::StringRef message = fixedFields.messageRef();
-                output.append(message.data(), message.length());
-              } break;
-              case 'x': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
+            if (bsl::string::npos == rightmostSlashIndex) {
+                output += filename;
+            }
+            else {
+                output.append(filename, rightmostSlashIndex + 1,
+                              bsl::string::npos);
+            }
+          } break;
+          case 'l': {
+            appendToString(&output, fixedFields.lineNumber());
+          } break;
+          case 'c': {
+            output += fixedFields.category();
+          } break;
+          case 'm': {
+            bslstl::StringRef message = fixedFields.messageRef();
+            output.append(message.data(), message.length());
+          } break;
+          case 'x': {
+            bsl::stringstream ss;
+            int length = static_cast<int>(
                                       fixedFields.messageStreamBuf().length());
-                bdlb::Print::printString(ss,
-                                        fixedFields.message(),
-                                        length,
-                                        false);
-                output += ss.str();
-              } break;
-              case 'X': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
+            bdlb::Print::printString(ss,
+                                    fixedFields.message(),
+                                    length,
+                                    false);
+            output += ss.str();
+          } break;
+          case 'X': {
+            bsl::stringstream ss;
+            int length = static_cast<int>(
                                       fixedFields.messageStreamBuf().length());
-                bdlb::Print::singleLineHexDump(ss,
-                                              fixedFields.message(),
-                                              length);
-                output += ss.str();
-              } break;
-              case 'u': {
-                typedef ball::UserFields Values;
-                const Values& customFields = record.customFields();
-                const int numCustomFields  = customFields.length();
-
-                if (numCustomFields > 0) {
-                    bsl::stringstream ss;
-                    Values::ConstIterator it = customFields.begin();
-                    ss << *it;
-                    ++it;
-                    for (; it != customFields.end(); ++it) {
-                        ss << " " << *it;
-                    }
-                    output += ss.str();
-                }
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
-
-                output += '%';
-                output += *iter;
-              }
-            }
-            ++iter;
+            bdlb::Print::singleLineHexDump(ss,
+                                          fixedFields.message(),
+                                          length);
+            output += ss.str();
           } break;
-          case '\\': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case 'n': {
-                output += '\n';
-              } break;
-              case 't': {
-                output += '\t';
-              } break;
-              case '\\': {
-                output += '\\';
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
+          case 'u': {
+            typedef ball::UserFields Values;
+            const Values& customFields = record.customFields();
+            const int numCustomFields  = customFields.length();
 
-                output += '\\';
-                output += *iter;
-              }
+            if (numCustomFields > 0) {
+                bsl::stringstream ss;
+                Values::ConstIterator it = customFields.begin();
+                ss << *it;
+                ++it;
+                for (; it != customFields.end(); ++it) {
+                    ss << " " << *it;
+                }
+                output += ss.str();
             }
-            ++iter;
           } break;
-          default: {
-            output += *iter;
-            ++iter;
-          }
         }
     }
 
@@ -93,6 +93,22 @@ BSLS_IDENT("$Id: $")
 // 27AUG2007_16:09:46.161 2040:1 WARN subdir/process.cpp:542 FOO.BAR.BAZ <text>
 //..
 //
+///Performance
+///-----------
+// The format specification is compiled, when it is supplied (at construction
+// or by 'setFormat'), into a sequence of steps, each either a run of literal
+// text (with '\'-escape sequences already resolved) or a single conversion,
+// so that formatting a record does not re-interpret the specification.  In
+// addition, a record formatter caches the rendering of the date and time
+// (to the second) of the most recently formatted timestamp, so that records
+// logged within the same second re-render only their fractional seconds.
+// The cache is used by one thread at a time; a thread finding it in use by
+// another thread renders the timestamp without the cache.  Note that the
+// local-time offset is still computed for each record when publishing in
+// local time is enabled, so transitions into and out of Daylight Saving Time
+// are observed, and no timestamp (or local-time offset) is computed for a
+// format specification having no timestamp conversions.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use an instance of
@@ -129,6 +145,7 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <bdlt_date.h>
 #include <bdlt_datetimeinterval.h>
 
 #include <bslma_allocator.h>
@@ -136,8 +153,11 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_atomic.h>
+
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 #include <bslalg_typetraits.h>
@@ -177,9 +197,70 @@ class RecordStringFormatter {
                                               // adjusted to the current local
                                               // time.
 
+    // PRIVATE TYPES
+    struct Step {
+        // A step of a compiled format specification: either a run of literal
+        // text or a single conversion.
+
+        char d_conversion;     // conversion character (e.g., 'd'), or 0 for
+                               // literal text
+
+        int  d_literalOffset;  // offset of the literal text in 'd_literals'
+
+        int  d_literalLength;  // length of the literal text
+    };
+
+    struct TimestampCache {
+        // The rendering, to the second, of a (local) timestamp and its offset
+        // from UTC.
+
+        bool       d_isValid;             // 'true' if the fields below are
+                                          // set
+
+        bdlt::Date d_date;                // date of the cached timestamp
+
+        int        d_secondOfDay;         // seconds since midnight of the
+                                          // cached timestamp
+
+        int        d_offsetInMinutes;     // offset from UTC of the cached
+                                          // timestamp
+
+        char       d_datetime[32];        // "DDMonYYYY_HH:MM:SS"
+
+        int        d_datetimeLength;      // length of 'd_datetime'
+
+        char       d_iso8601[32];         // "YYYY-MM-DDTHH:MM:SS"
+
+        int        d_iso8601Length;       // length of 'd_iso8601'
+
+        char       d_iso8601Zone[16];     // "Z" or "+hh:mm"
+
+        int        d_iso8601ZoneLength;   // length of 'd_iso8601Zone'
+    };
+
     // DATA
-    bsl::string            d_formatSpec;       // 'printf'-style format spec.
-    bdlt::DatetimeInterval d_timestampOffset;  // offset added to timestamps
+    bsl::string              d_formatSpec;       // 'printf'-style format spec.
+    bdlt::DatetimeInterval   d_timestampOffset;  // offset added to timestamps
+    bsl::vector<Step>        d_steps;            // compiled 'd_formatSpec'
+    bsl::string              d_literals;         // literal text of 'd_steps'
+    bool                     d_hasTimestamp;     // 'true' if 'd_steps' has a
+                                                 // timestamp conversion
+    mutable TimestampCache   d_cache;            // last rendered timestamp
+    mutable bsls::AtomicInt  d_cacheInUse;       // 1 while a thread is using
+                                                 // 'd_cache', and 0 otherwise
+
+    // PRIVATE MANIPULATORS
+    void appendConversion(char conversion);
+        // Append to the compiled format specification of this object a step
+        // for the specified 'conversion'.
+
+    void appendLiteral(const char *text, int length);
+        // Append to the compiled format specification of this object the
+        // specified 'length' characters of literal 'text'.
+
+    void compileFormat();
+        // Compile the format specification of this object into a sequence of
+        // steps.
 
   public:
     // TRAITS
@@ -355,12 +436,6 @@ void RecordStringFormatter::enablePublishInLocalTime()
     d_timestampOffset.setTotalMilliseconds(k_ENABLE_PUBLISH_IN_LOCALTIME);
 }
 
-inline
-void RecordStringFormatter::setFormat(const char *format)
-{
-    d_formatSpec = format;
-}
-
 inline
 void RecordStringFormatter::setTimestampOffset(
                                           const bdlt::DatetimeInterval& offset)
@@ -8,7 +8,9 @@
 
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_iso8601util.h>
+#include <bdlt_iso8601utilconfiguration.h>
 #include <bdlt_localtimeoffset.h>
 
 #include <bslim_testutil.h>
@@ -21,6 +23,7 @@
 #include <bslmt_threadutil.h>
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_iostream.h>
@@ -29,6 +32,8 @@
 #include <bsl_string.h>
 #include <bsl_sstream.h>
 
+#include <bsl_climits.h>                  // for 'INT_MAX', 'INT_MIN'
+#include <bsl_cstdio.h>                   // for 'sprintf'
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>                  // for 'strcmp'
 
@@ -89,6 +94,8 @@ using bsl::uppercase;
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
 // [12] USAGE example
+// [14] CONCERN: COMPILED FORMAT AND TIMESTAMP CACHE
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -246,6 +253,110 @@ bool compareText(bslstl::StringRef lhs, bslstl::StringRef rhs)
 
 namespace {
 
+bsl::string expectedTimestamp(char                  conversion,
+                              const bdlt::Datetime& utc,
+                              int                   offsetInMinutes)
+    // Return the text that the specified 'conversion' ('d', 'D', 'i', 'I', or
+    // 'O') is expected to produce for a record having the specified 'utc'
+    // timestamp when published with the specified 'offsetInMinutes'.
+{
+    bdlt::Datetime local(utc);
+    local.addMinutes(offsetInMinutes);
+
+    char buffer[64];
+
+    if ('d' == conversion || 'D' == conversion) {
+        local.printToBuffer(buffer, sizeof buffer, 'd' == conversion ? 3 : 6);
+        return buffer;                                                // RETURN
+    }
+
+    bdlt::Iso8601UtilConfiguration config;
+    config.setFractionalSecondPrecision('O' == conversion ? 6 : 3);
+    config.setUseZAbbreviationForUtc(true);
+
+    int length = bdlt::Iso8601Util::generateRaw(
+                                      buffer,
+                                      bdlt::DatetimeTz(local, offsetInMinutes),
+                                      config);
+
+    bsl::string result(buffer, length);
+    if ('i' == conversion) {
+        result.erase(19, 4);
+    }
+    return result;
+}
+
+bsl::string expectedRecord(const bdlt::Datetime& utc, int offsetInMinutes)
+    // Return the text that 'k_TIMESTAMP_FORMAT' is expected to produce for a
+    // record having the specified 'utc' timestamp when published with the
+    // specified 'offsetInMinutes'.
+{
+    bsl::string result;
+    result += expectedTimestamp('d', utc, offsetInMinutes);
+    result += '|';
+    result += expectedTimestamp('D', utc, offsetInMinutes);
+    result += '|';
+    result += expectedTimestamp('i', utc, offsetInMinutes);
+    result += '|';
+    result += expectedTimestamp('I', utc, offsetInMinutes);
+    result += '|';
+    result += expectedTimestamp('O', utc, offsetInMinutes);
+    return result;
+}
+
+const char k_TIMESTAMP_FORMAT[] = "%d|%D|%i|%I|%O";
+
+bsl::string format(const Obj& formatter, const bdlt::Datetime& utc)
+    // Return the text produced by the specified 'formatter' for a record
+    // having the specified 'utc' timestamp.
+{
+    ball::RecordAttributes fixedFields(utc,
+                                       0,
+                                       0,
+                                       "",
+                                       0,
+                                       "",
+                                       ball::Severity::e_OFF,
+                                       "");
+    ball::Record record(fixedFields, ball::UserFields());
+
+    ostringstream oss;
+    formatter(oss, record);
+    return oss.str();
+}
+
+struct FormatThreadArgs {
+    // This 'struct' describes the work done by one 'formatThread'.
+
+    const Obj *d_formatter_p;     // shared formatter
+    int        d_offsetMinutes;   // offset with which 'd_formatter_p' was
+                                  // configured
+    int        d_threadIndex;     // index of this thread
+    int        d_iterations;      // number of records to format
+    int        d_numErrors;       // (output) number of mismatches observed
+};
+
+extern "C" void *formatThread(void *arg)
+    // Format records having timestamps that differ in second and fractional
+    // second through the formatter described by the specified 'arg', which
+    // must point to a 'FormatThreadArgs', and count the outputs that do not
+    // match the expected text.
+{
+    FormatThreadArgs *args = static_cast<FormatThreadArgs *>(arg);
+
+    for (int i = 0; i < args->d_iterations; ++i) {
+        bdlt::Datetime utc(2020, 2, 29, 23, 59, 50);
+        utc.addSeconds((i + args->d_threadIndex) % 17);
+        utc.addMicroseconds((i * 7919 + args->d_threadIndex) % 1000000);
+
+        if (format(*args->d_formatter_p, utc) !=
+                                  expectedRecord(utc, args->d_offsetMinutes)) {
+            ++args->d_numErrors;
+        }
+    }
+    return 0;
+}
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -263,6 +374,283 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 14: {
+        // --------------------------------------------------------------------
+        // CONCERN: COMPILED FORMAT AND TIMESTAMP CACHE
+        //
+        // Concerns:
+        //: 1 The format specification is recompiled whenever it is set, and
+        //:   copies and assignments render the format of their source.
+        //:
+        //: 2 Escape sequences, unknown conversions, and a trailing '%' or '\'
+        //:   render as they did before the specification was compiled.
+        //:
+        //: 3 Records within the same second that differ in their fractional
+        //:   seconds render correctly from the cached date and time.
+        //:
+        //: 4 The cache is refreshed when the second, the date, or the offset
+        //:   changes, including when the time goes backwards.
+        //:
+        //: 5 Integers render identically to 'printf'.
+        //:
+        //: 6 Concurrent calls to 'operator()' on one object are safe and
+        //:   render correctly.
+        //
+        // Plan:
+        //: 1 Format records through a table of specifications, calling
+        //:   'setFormat' on one object, and verify the output.  (C-1..2)
+        //:
+        //: 2 Format a sequence of records whose timestamps revisit the same
+        //:   seconds with different fractional parts, and whose offsets
+        //:   change, and compare against text generated directly by 'bdlt'.
+        //:   (C-1, 3..4)
+        //:
+        //: 3 Format records with extreme process IDs, line numbers, and
+        //:   thread IDs and compare with 'sprintf'.  (C-5)
+        //:
+        //: 4 Format records from several threads through one shared object
+        //:   and verify every result.  (C-6)
+        //
+        // Testing:
+        //   CONCERN: COMPILED FORMAT AND TIMESTAMP CACHE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: COMPILED FORMAT AND TIMESTAMP CACHE"
+                          << "\n============================================"
+                          << endl;
+
+        if (verbose) cout << "\nTesting escapes and unknown conversions."
+                          << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_format;
+                const char *d_expected;
+            } DATA[] = {
+                //LINE  FORMAT               EXPECTED
+                //----  -------------------  ------------------
+                { L_,   "",                  ""                 },
+                { L_,   "abc",               "abc"              },
+                { L_,   "%%",                "%"                },
+                { L_,   "a%%b%%%%c",         "a%b%%c"           },
+                { L_,   "%",                 ""                 },
+                { L_,   "ab%",               "ab"               },
+                { L_,   "\\",                ""                 },
+                { L_,   "ab\\",              "ab"               },
+                { L_,   "\\n\\t\\\\",        "\n\t\\"           },
+                { L_,   "%z%Y",              "%z%Y"             },
+                { L_,   "\\z\\%",            "\\z\\%"           },
+                { L_,   "[%s]",              "[OFF]"            },
+                { L_,   "%c:%l",             "CAT:0"            },
+                { L_,   "%F|%f",             "f.cpp|dir/f.cpp"  },
+                { L_,   "%m%%%m",            "MSG%MSG"          },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            ball::RecordAttributes fixedFields(bdlt::Datetime(2001, 2, 3),
+                                               0,
+                                               0,
+                                               "dir/f.cpp",
+                                               0,
+                                               "CAT",
+                                               ball::Severity::e_OFF,
+                                               "MSG");
+            ball::Record record(fixedFields, ball::UserFields());
+
+            Obj mX;  const Obj& X = mX;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const char *const FORMAT   = DATA[ti].d_format;
+                const char *const EXPECTED = DATA[ti].d_expected;
+
+                mX.setFormat(FORMAT);
+                ASSERTV(LINE, 0 == strcmp(FORMAT, X.format()));
+
+                ostringstream oss;
+                X(oss, record);
+                ASSERTV(LINE, oss.str(), EXPECTED == oss.str());
+
+                Obj           mY(X);
+                ostringstream ossY;
+                mY(ossY, record);
+                ASSERTV(LINE, ossY.str(), EXPECTED == ossY.str());
+
+                Obj           mZ("%m%m%m%d");
+                ostringstream ossZ;
+                mZ = X;
+                mZ(ossZ, record);
+                ASSERTV(LINE, ossZ.str(), EXPECTED == ossZ.str());
+            }
+        }
+
+        if (verbose) cout << "\nTesting the timestamp cache." << endl;
+        {
+            static const struct {
+                int d_line;
+                int d_second;       // second added to the base datetime
+                int d_microsecond;  // microsecond added to that second
+                int d_offset;       // offset, in minutes
+            } DATA[] = {
+                //LINE  SECOND    MICROSECOND  OFFSET
+                //----  --------  -----------  ------
+                { L_,          0,           0,      0 },
+                { L_,          0,           1,      0 },
+                { L_,          0,        1000,      0 },
+                { L_,          0,      999999,      0 },
+                { L_,          1,      500000,      0 },
+                { L_,          0,      123456,      0 },
+                { L_,          0,      123456,     90 },
+                { L_,          0,      123456,    -90 },
+                { L_,          0,      654321,    -90 },
+                { L_,         59,      999999,    -90 },
+                { L_,         60,           0,    -90 },
+                { L_,      86399,      999999,      0 },
+                { L_,      86400,           0,      0 },
+                { L_,      86400,           0,   1439 },
+                { L_,      86400,           0,  -1439 },
+                { L_,  -86400*30,          17,      0 },
+                { L_,          0,          17,      0 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            const bdlt::Datetime BASE(2016, 12, 31, 23, 59, 59);
+
+            Obj mX(k_TIMESTAMP_FORMAT);  const Obj& X = mX;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE        = DATA[ti].d_line;
+                const int SECOND      = DATA[ti].d_second;
+                const int MICROSECOND = DATA[ti].d_microsecond;
+                const int OFFSET      = DATA[ti].d_offset;
+
+                bdlt::Datetime utc(BASE);
+                utc.addSeconds(SECOND);
+                utc.addMicroseconds(MICROSECOND);
+
+                mX.setTimestampOffset(bdlt::DatetimeInterval(0, 0, OFFSET));
+
+                const bsl::string EXPECTED = expectedRecord(utc, OFFSET);
+                const bsl::string result   = format(X, utc);
+
+                if (veryVerbose) { T_ P_(LINE) P(result) }
+
+                ASSERTV(LINE, EXPECTED, result, EXPECTED == result);
+
+                // A fresh object, with no cached timestamp, must agree.
+
+                const Obj Y(k_TIMESTAMP_FORMAT,
+                            bdlt::DatetimeInterval(0, 0, OFFSET));
+                ASSERTV(LINE, EXPECTED == format(Y, utc));
+            }
+
+            // Changing the format discards nothing that affects the output.
+
+            mX.setTimestampOffset(bdlt::DatetimeInterval(0));
+            mX.setFormat("%i");
+            ASSERT(expectedTimestamp('i', BASE, 0) == format(X, BASE));
+            mX.setFormat("%D");
+            ASSERT(expectedTimestamp('D', BASE, 0) == format(X, BASE));
+        }
+
+        if (verbose) cout << "\nTesting publishing in local time." << endl;
+        {
+            const bdlt::Datetime utc(2014, 2, 19, 12, 34, 56, 789, 12);
+
+            const int offset = static_cast<int>(
+                 bdlt::LocalTimeOffset::localTimeOffset(utc).totalMinutes());
+
+            Obj mX(k_TIMESTAMP_FORMAT, true);  const Obj& X = mX;
+
+            ASSERT(expectedRecord(utc, offset) == format(X, utc));
+
+            mX.disablePublishInLocalTime();
+            ASSERT(expectedRecord(utc, 0) == format(X, utc));
+
+            mX.enablePublishInLocalTime();
+            ASSERT(expectedRecord(utc, offset) == format(X, utc));
+        }
+
+        if (verbose) cout << "\nTesting integer conversions." << endl;
+        {
+            static const struct {
+                int                 d_line;
+                int                 d_processId;
+                int                 d_lineNumber;
+                bsls::Types::Uint64 d_threadId;
+            } DATA[] = {
+                //LINE  PROCESS ID  LINE NUMBER  THREAD ID
+                //----  ----------  -----------  ---------------------------
+                { L_,            0,           0, 0                           },
+                { L_,            1,           9, 10                          },
+                { L_,           10,          99, 15                          },
+                { L_,      INT_MAX,     INT_MAX, 0xFFFFFFFFULL               },
+                { L_,      INT_MIN,     INT_MIN, 0xFFFFFFFFFFFFFFFFULL       },
+                { L_,           -1,          -1, 0x123456789ABCDEFULL        },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            Obj mX("%p %l %t %T");  const Obj& X = mX;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int                 LINE        = DATA[ti].d_line;
+                const int                 PROCESS_ID  = DATA[ti].d_processId;
+                const int                 LINE_NUMBER = DATA[ti].d_lineNumber;
+                const bsls::Types::Uint64 THREAD_ID   = DATA[ti].d_threadId;
+
+                ball::RecordAttributes fixedFields(bdlt::Datetime(),
+                                                   PROCESS_ID,
+                                                   THREAD_ID,
+                                                   "",
+                                                   LINE_NUMBER,
+                                                   "",
+                                                   ball::Severity::e_OFF,
+                                                   "");
+                ball::Record record(fixedFields, ball::UserFields());
+
+                char expected[128];
+                bsl::sprintf(expected,
+                             "%d %d %llu %llX",
+                             PROCESS_ID,
+                             LINE_NUMBER,
+                             THREAD_ID,
+                             THREAD_ID);
+
+                ostringstream oss;
+                X(oss, record);
+                ASSERTV(LINE, expected, oss.str(), expected == oss.str());
+            }
+        }
+
+        if (verbose) cout << "\nTesting concurrent formatting." << endl;
+        {
+            enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 2000 };
+
+            const int OFFSET = -330;
+
+            const Obj X(k_TIMESTAMP_FORMAT,
+                        bdlt::DatetimeInterval(0, 0, OFFSET));
+
+            FormatThreadArgs          args[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_formatter_p   = &X;
+                args[i].d_offsetMinutes = OFFSET;
+                args[i].d_threadIndex   = i;
+                args[i].d_iterations    = k_NUM_ITERATIONS;
+                args[i].d_numErrors     = 0;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      formatThread,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                ASSERTV(i, args[i].d_numErrors, 0 == args[i].d_numErrors);
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING: Records Show Calculated Local-Time Offset
@@ -1771,6 +2159,69 @@ int main(int argc, char *argv[])
         ASSERT( 1 == (X1 == X4));        ASSERT(0 == (X1 != X4));
       } break;
 
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The cost of formatting a record with the default format, and
+        //:   with the ISO 8601 timestamp conversions, is reported.
+        //
+        // Plan:
+        //: 1 Time the formatting of a number of records, a few to a second,
+        //:   with several formats.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE TEST"
+             << "\n================" << endl;
+
+        static const char *FORMATS[] = {
+            "\n%d %p:%t %s %f:%l %c %m %u\n",
+            "%I %p:%t %s %F:%l %c %m\n",
+            "%O %T %s %c %m\n",
+            "%p:%t %s %c %m\n",
+        };
+        const int NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS;
+
+        const int NUM_RECORDS = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        ball::RecordAttributes fixedFields(bdlt::Datetime(2020, 1, 1),
+                                           0,
+                                           bslmt::ThreadUtil::selfIdAsUint64(),
+                                           "subdir/process.cpp",
+                                           542,
+                                           "FOO.BAR.BAZ",
+                                           ball::Severity::e_WARN,
+                                           "Hello world!");
+        ball::Record mRecord(fixedFields, ball::UserFields());
+
+        for (int fi = 0; fi < NUM_FORMATS; ++fi) {
+            const Obj X(FORMATS[fi]);
+
+            ostringstream oss;
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            bdlt::Datetime timestamp(2020, 1, 1);
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                timestamp.addMicroseconds(7);
+                mRecord.fixedFields().setTimestamp(timestamp);
+                X(oss, mRecord);
+                oss.seekp(0);
+            }
+
+            timer.stop();
+
+            cout << "Format " << fi << ": "
+                 << timer.elapsedTime() * 1.0e9 / NUM_RECORDS
+                 << " ns per record" << endl;
+        }
+      } break;
       default:
         {
             cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -12,12 +12,223 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_collector_cpp,"$Id$ $CSID$")
 
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+#include <new>          // placement 'new'
+
 namespace BloombergLP {
+namespace {
+
+typedef bsls::Types::Uint64 Bits;
+
+BSLMF_ASSERT(sizeof(double) == sizeof(Bits));
+BSLMF_ASSERT(sizeof(balm::Collector_Stripe) <=
+                                    balm::CollectorStripeUtil::k_STRIPE_SIZE);
+
+inline
+Bits toBits(double value)
+    // Return the bit pattern of the specified 'value'.
+{
+    Bits bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+inline
+double fromBits(Bits bits)
+    // Return the 'double' value having the specified 'bits'.
+{
+    double value;
+    bsl::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+void atomicAdd(bsls::AtomicUint64 *bits, double value)
+    // Atomically add the specified 'value' to the 'double' held as the
+    // specified 'bits'.
+{
+    Bits current = bits->loadRelaxed();
+    for (;;) {
+        const Bits previous = bits->testAndSwapAcqRel(
+                                          current,
+                                          toBits(fromBits(current) + value));
+        if (previous == current) {
+            return;                                                   // RETURN
+        }
+        current = previous;
+    }
+}
+
+void atomicMin(bsls::AtomicUint64 *bits, double value)
+    // Atomically set the 'double' held as the specified 'bits' to the
+    // specified 'value' if 'value' is less than that 'double'.
+{
+    Bits current = bits->loadRelaxed();
+    while (value < fromBits(current)) {
+        const Bits previous = bits->testAndSwapAcqRel(current, toBits(value));
+        if (previous == current) {
+            return;                                                   // RETURN
+        }
+        current = previous;
+    }
+}
+
+void atomicMax(bsls::AtomicUint64 *bits, double value)
+    // Atomically set the 'double' held as the specified 'bits' to the
+    // specified 'value' if 'value' is greater than that 'double'.
+{
+    Bits current = bits->loadRelaxed();
+    while (fromBits(current) < value) {
+        const Bits previous = bits->testAndSwapAcqRel(current, toBits(value));
+        if (previous == current) {
+            return;                                                   // RETURN
+        }
+        current = previous;
+    }
+}
+
+void resetStripe(balm::Collector_Stripe *stripe)
+    // Reset the values of the specified 'stripe' to their default states.
+{
+    stripe->d_count.storeRelease(0);
+    stripe->d_total.storeRelease(toBits(0.0));
+    stripe->d_min.storeRelease(toBits(balm::MetricRecord::k_DEFAULT_MIN));
+    stripe->d_max.storeRelease(toBits(balm::MetricRecord::k_DEFAULT_MAX));
+}
+
+}  // close unnamed namespace
+
+namespace balm {
 
                               // ---------------
                               // class Collector
                               // ---------------
 
+// PRIVATE MANIPULATORS
+void Collector::accumulateStriped(int    count,
+                                  double total,
+                                  double min,
+                                  double max)
+{
+    const unsigned int index = CollectorStripeUtil::threadStripeIndex()
+                             & (d_numStripes - 1);
+
+    Collector_Stripe *s = stripe(static_cast<int>(index));
+
+    s->d_count.addRelaxed(count);
+    atomicAdd(&s->d_total, total);
+    atomicMin(&s->d_min, min);
+    atomicMax(&s->d_max, max);
+}
+
+void Collector::loadAndResetStripes(MetricRecord *record)
+{
+    record->metricId() = d_record.metricId();
+    record->count()    = 0;
+    record->total()    = 0.0;
+    record->min()      = MetricRecord::k_DEFAULT_MIN;
+    record->max()      = MetricRecord::k_DEFAULT_MAX;
+
+    for (int i = 0; i < d_numStripes; ++i) {
+        Collector_Stripe *s = stripe(i);
+
+        record->count() += s->d_count.swapAcqRel(0);
+        record->total() += fromBits(s->d_total.swapAcqRel(toBits(0.0)));
+        record->min()    = bsl::min(record->min(), fromBits(
+                 s->d_min.swapAcqRel(toBits(MetricRecord::k_DEFAULT_MIN))));
+        record->max()    = bsl::max(record->max(), fromBits(
+                 s->d_max.swapAcqRel(toBits(MetricRecord::k_DEFAULT_MAX))));
+    }
+}
+
+void Collector::resetStripes()
+{
+    for (int i = 0; i < d_numStripes; ++i) {
+        resetStripe(stripe(i));
+    }
+}
+
+void Collector::setStripes(int count, double total, double min, double max)
+{
+    for (int i = 1; i < d_numStripes; ++i) {
+        resetStripe(stripe(i));
+    }
+
+    Collector_Stripe *s = stripe(0);
+
+    s->d_count.storeRelease(count);
+    s->d_total.storeRelease(toBits(total));
+    s->d_min.storeRelease(toBits(min));
+    s->d_max.storeRelease(toBits(max));
+}
+
+// PRIVATE ACCESSORS
+void Collector::loadStripes(MetricRecord *record) const
+{
+    record->metricId() = d_record.metricId();
+    record->count()    = 0;
+    record->total()    = 0.0;
+    record->min()      = MetricRecord::k_DEFAULT_MIN;
+    record->max()      = MetricRecord::k_DEFAULT_MAX;
+
+    for (int i = 0; i < d_numStripes; ++i) {
+        const Collector_Stripe *s = stripe(i);
+
+        record->count() += s->d_count.loadAcquire();
+        record->total() += fromBits(s->d_total.loadAcquire());
+        record->min()    = bsl::min(record->min(),
+                                    fromBits(s->d_min.loadAcquire()));
+        record->max()    = bsl::max(record->max(),
+                                    fromBits(s->d_max.loadAcquire()));
+    }
+}
+
+// CREATORS
+Collector::Collector(const MetricId&   metricId,
+                     int               numStripes,
+                     bslma::Allocator *basicAllocator)
+: d_record(metricId)
+, d_lock()
+, d_stripes_p(0)
+, d_buffer_p(0)
+, d_numStripes(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= numStripes);
+
+    if (0 == numStripes) {
+        return;                                                       // RETURN
+    }
+
+    const int         count      =
+                              CollectorStripeUtil::roundNumStripes(numStripes);
+    const bsl::size_t stripeSize = CollectorStripeUtil::k_STRIPE_SIZE;
+
+    // Allocate one additional stripe so that the stripes can be aligned on a
+    // cache line boundary.
+
+    d_buffer_p = d_allocator_p->allocate((count + 1) * stripeSize);
+
+    const bsl::size_t offset =
+         reinterpret_cast<bsls::Types::UintPtr>(d_buffer_p) % stripeSize;
+
+    d_stripes_p  = static_cast<char *>(d_buffer_p)
+                 + (offset ? stripeSize - offset : 0);
+    d_numStripes = count;
+
+    for (int i = 0; i < d_numStripes; ++i) {
+        resetStripe(new (stripe(i)) Collector_Stripe());
+    }
+}
+
+}  // close package namespace
 }  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
@@ -34,6 +34,30 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 // clients should not need to access a 'balm::Collector' directly, but instead
 // use it through another type (see 'balm_metric').
 //
+///Striped Collectors
+///------------------
+// By default, a 'balm::Collector' protects its aggregated values with a
+// mutex, which is acquired by every update.  When a metric is updated very
+// frequently by many threads, that mutex serializes the updating threads.  A
+// collector constructed with a non-zero number of stripes instead holds an
+// array of cache-line-sized cells ("stripes"), each aggregating the updates
+// of a subset of the threads (see 'balm_collectorstripeutil').  An update of
+// a striped collector modifies only the stripe of the calling thread, using
+// atomic operations (compare-and-swap loops for the 'double' total, minimum,
+// and maximum), and acquires no lock.  The stripes are merged when the
+// collector is loaded (typically, at publication time).
+//
+// Striping trades memory (one cache line per stripe) and the cost of 'load'
+// for the scalability of 'update'.  Note that, for a striped collector,
+// 'load', 'loadAndReset', 'reset', and 'setCountTotalMinMax' are not atomic
+// with respect to concurrent updates: an update that is concurrent with
+// 'loadAndReset' is accounted either in the loaded record or in the
+// collector after the reset, but its count, total, minimum, and maximum may
+// be split between the two.  Also note that the total of a striped collector
+// is the sum of the totals of its stripes, and therefore may differ from the
+// total of an unstriped collector in the last bits, as floating-point
+// addition is not associative.
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
@@ -43,7 +67,8 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 ///-------------
 // 'balm::Collector' is fully *thread-safe*, meaning that all non-creator
 // operations on a given instance can be safely invoked simultaneously from
-// multiple threads.
+// multiple threads.  See "Striped Collectors" for the atomicity guarantees of
+// striped collectors.
 //
 ///Usage
 ///-----
@@ -79,15 +104,39 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 //      assert(1.0      == record.min());
 //      assert(3.0      == record.max());
 //..
+// Finally, we create a striped collector for a metric that is updated
+// concurrently by many threads.  Its updates acquire no lock, and its stripes
+// are merged when it is loaded:
+//..
+//  balm::Collector stripedCollector(
+//                             myMetric,
+//                             balm::CollectorStripeUtil::defaultNumStripes());
+//
+//  stripedCollector.update(1.0);
+//  stripedCollector.update(3.0);
+//
+//  stripedCollector.loadAndReset(&record);
+//
+//      assert(myMetric == record.metricId());
+//      assert(2        == record.count());
+//      assert(4        == record.total());
+//      assert(1.0      == record.min());
+//      assert(3.0      == record.max());
+//..
 
 #include <balscm_version.h>
 
+#include <balm_collectorstripeutil.h>
 #include <balm_metricrecord.h>
 #include <balm_metricid.h>
 
+#include <bslma_allocator.h>
+
 #include <bslmt_mutex.h>
 #include <bslmt_lockguard.h>
 
+#include <bsls_atomic.h>
+
 #include <bsl_algorithm.h>
 
 namespace BloombergLP {
@@ -95,6 +144,23 @@ namespace BloombergLP {
 
 namespace balm {
 
+                          // =======================
+                          // struct Collector_Stripe
+                          // =======================
+
+struct Collector_Stripe {
+    // This 'struct' holds the values aggregated by one stripe of a striped
+    // 'Collector'.  The 'double' aggregates are held as their bit patterns,
+    // so that they can be updated using atomic operations.  This 'struct' is
+    // an implementation detail of 'Collector', and must not be used directly.
+
+    // DATA
+    bsls::AtomicInt    d_count;  // aggregated count of events
+    bsls::AtomicUint64 d_total;  // bits of the total of values
+    bsls::AtomicUint64 d_min;    // bits of the minimum value
+    bsls::AtomicUint64 d_max;    // bits of the maximum value
+};
+
                               // ===============
                               // class Collector
                               // ===============
@@ -110,13 +176,59 @@ class Collector {
     // the default maximum value is 'MetricRecord::k_DEFAULT_MAX'.
 
     // DATA
-    MetricRecord         d_record;  // the recorded metric information
-    mutable bslmt::Mutex d_lock;    // record synchronization mechanism
+    MetricRecord         d_record;       // the recorded metric information
+                                         // (for the identity of the metric
+                                         // only, if striped)
+
+    mutable bslmt::Mutex d_lock;         // record synchronization mechanism
+
+    char                *d_stripes_p;    // cache-line-aligned stripes, or 0
+                                         // if not striped
+
+    void                *d_buffer_p;     // memory holding the stripes
+                                         // (owned)
+
+    int                  d_numStripes;   // number of stripes (a power of 2),
+                                         // or 0 if not striped
+
+    bslma::Allocator    *d_allocator_p;  // allocator for the stripes (held,
+                                         // not owned)
 
     // NOT IMPLEMENTED
     Collector(const Collector&);
     Collector& operator=(const Collector&);
 
+    // PRIVATE MANIPULATORS
+    void accumulateStriped(int count, double total, double min, double max);
+        // Add the specified 'count', 'total', 'min', and 'max' to the stripe
+        // of the calling thread.  The behavior is undefined unless this
+        // collector is striped.
+
+    void loadAndResetStripes(MetricRecord *record);
+        // Load into the specified 'record' the merged values of the stripes of
+        // this collector, resetting each stripe as it is loaded.  The behavior
+        // is undefined unless this collector is striped.
+
+    void resetStripes();
+        // Reset the stripes of this collector.  The behavior is undefined
+        // unless this collector is striped.
+
+    void setStripes(int count, double total, double min, double max);
+        // Set the first stripe of this collector to the specified 'count',
+        // 'total', 'min', and 'max', and reset the other stripes.  The
+        // behavior is undefined unless this collector is striped.
+
+    // PRIVATE ACCESSORS
+    void loadStripes(MetricRecord *record) const;
+        // Load into the specified 'record' the merged values of the stripes of
+        // this collector.  The behavior is undefined unless this collector is
+        // striped.
+
+    Collector_Stripe *stripe(int index) const;
+        // Return the address of the stripe at the specified 'index'.  The
+        // behavior is undefined unless this collector is striped and
+        // '0 <= index < numStripes()'.
+
   public:
      // CREATORS
     Collector(const MetricId& metricId);
@@ -125,6 +237,22 @@ class Collector {
         // 'MetricRecord::k_DEFAULT_MIN', and max of
         // 'MetricRecord::k_DEFAULT_MAX'.
 
+    Collector(const MetricId&   metricId,
+              int               numStripes,
+              bslma::Allocator *basicAllocator = 0);
+        // Create a collector for a metric having the specified 'metricId',
+        // and having an initial count of 0, total of 0.0, min of
+        // 'MetricRecord::k_DEFAULT_MIN', and max of
+        // 'MetricRecord::k_DEFAULT_MAX'.  If the specified 'numStripes' is
+        // positive, the collector is striped, having the smallest power of two
+        // not less than 'numStripes' stripes (capped at
+        // 'CollectorStripeUtil::k_MAX_NUM_STRIPES'); otherwise the collector
+        // is not striped.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '0 <= numStripes'.  Note that a collector that is not striped
+        // allocates no memory.
+
     ~Collector();
         // Destroy this object.
 
@@ -177,6 +305,10 @@ class Collector {
         // Load into the specified 'record' the id of the metric being
         // collected, as well as the current count, total, minimum, and
         // maximum aggregated values for the metric.
+
+    int numStripes() const;
+        // Return the number of stripes of this collector, or 0 if this
+        // collector is not striped.
 };
 
 // ============================================================================
@@ -187,23 +319,43 @@ class Collector {
                               // class Collector
                               // ---------------
 
+// PRIVATE ACCESSORS
+inline
+Collector_Stripe *Collector::stripe(int index) const
+{
+    return reinterpret_cast<Collector_Stripe *>(
+                     d_stripes_p + index * CollectorStripeUtil::k_STRIPE_SIZE);
+}
+
 // CREATORS
 inline
 Collector::Collector(const MetricId& metricId)
 : d_record(metricId)
 , d_lock()
+, d_stripes_p(0)
+, d_buffer_p(0)
+, d_numStripes(0)
+, d_allocator_p(0)
 {
 }
 
 inline
 Collector::~Collector()
 {
+    if (d_buffer_p) {
+        d_allocator_p->deallocate(d_buffer_p);
+    }
 }
 
 // MANIPULATORS
 inline
 void Collector::reset()
 {
+    if (d_stripes_p) {
+        resetStripes();
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
     d_record.count() = 0;
     d_record.total() = 0.0;
@@ -214,6 +366,11 @@ void Collector::reset()
 inline
 void Collector::loadAndReset(MetricRecord *record)
 {
+    if (d_stripes_p) {
+        loadAndResetStripes(record);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
     *record          = d_record;
     d_record.count() = 0;
@@ -225,6 +382,11 @@ void Collector::loadAndReset(MetricRecord *record)
 inline
 void Collector::update(double value)
 {
+    if (d_stripes_p) {
+        accumulateStriped(1, value, value, value);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
     ++d_record.count();
     d_record.total() += value;
@@ -238,6 +400,11 @@ void Collector::accumulateCountTotalMinMax(int    count,
                                            double min,
                                            double max)
 {
+    if (d_stripes_p) {
+        accumulateStriped(count, total, min, max);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
     d_record.count() += count;
     d_record.total() += total;
@@ -251,6 +418,11 @@ void Collector::setCountTotalMinMax(int    count,
                                     double min,
                                     double max)
 {
+    if (d_stripes_p) {
+        setStripes(count, total, min, max);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
     d_record.count() = count;
     d_record.total() = total;
@@ -268,9 +440,20 @@ const MetricId& Collector::metricId() const
 inline
 void Collector::load(MetricRecord *record) const
 {
+    if (d_stripes_p) {
+        loadStripes(record);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
     *record = d_record;
 }
+
+inline
+int Collector::numStripes() const
+{
+    return d_numStripes;
+}
 }  // close package namespace
 
 }  // close enterprise namespace
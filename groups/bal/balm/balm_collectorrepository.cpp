@@ -12,7 +12,9 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_collectorrepository_cpp,"$Id$ $CSID$")
 
+#include <balm_histogram.h>
 #include <balm_metricid.h>
+#include <balm_publicationtype.h>
 
 #include <bslmt_readlockguard.h>
 #include <bslmt_writelockguard.h>
@@ -33,6 +35,22 @@ namespace BloombergLP {
 
 namespace {
 
+const struct {
+    double      d_quantile;  // quantile of the collected values
+    const char *d_suffix;    // suffix of the name of the derived metric
+} QUANTILES[] = {
+    { 0.5,   ".p50"  },
+    { 0.9,   ".p90"  },
+    { 0.99,  ".p99"  },
+    { 0.999, ".p999" }
+};
+    // The quantiles of the values collected by a histogram collector that
+    // are reported as derived metrics, and the suffixes appended to the name
+    // of the metric of the histogram collector to form the names of those
+    // derived metrics.
+
+enum { k_NUM_QUANTILES = sizeof QUANTILES / sizeof *QUANTILES };
+
 inline
 void combine(balm::MetricRecord *record, const balm::MetricRecord& value)
 {
@@ -43,6 +61,46 @@ void combine(balm::MetricRecord *record, const balm::MetricRecord& value)
     record->max()      = bsl::max(record->max(), value.max());
 }
 
+void appendHistogramRecords(bsl::vector<balm::MetricRecord> *records,
+                            balm::MetricRecord              *record,
+                            const balm::Histogram&           histogram,
+                            const balm::MetricId            *quantileIds)
+    // Combine the count, total, minimum, and maximum of the specified
+    // 'histogram' into the specified 'record', and append 'record' to the
+    // specified 'records', followed by a record for each of the
+    // 'k_NUM_QUANTILES' derived metrics identified by the specified
+    // 'quantileIds' holding the corresponding quantile of 'histogram' as its
+    // minimum and maximum.
+{
+    if (0 == histogram.count()) {
+        records->push_back(*record);
+        for (int i = 0; i < k_NUM_QUANTILES; ++i) {
+            records->push_back(balm::MetricRecord(quantileIds[i]));
+        }
+        return;                                                       // RETURN
+    }
+
+    const int count = static_cast<int>(histogram.count());
+
+    combine(record, balm::MetricRecord(record->metricId(),
+                                       count,
+                                       static_cast<double>(histogram.total()),
+                                       static_cast<double>(histogram.min()),
+                                       static_cast<double>(histogram.max())));
+    records->push_back(*record);
+
+    for (int i = 0; i < k_NUM_QUANTILES; ++i) {
+        const double value = static_cast<double>(
+                          histogram.valueAtQuantile(QUANTILES[i].d_quantile));
+
+        records->push_back(balm::MetricRecord(quantileIds[i],
+                                              count,
+                                              value * count,
+                                              value,
+                                              value));
+    }
+}
+
 }  // close unnamed namespace
 
 namespace balm {
@@ -78,6 +136,7 @@ class CollectorRepository_Collectors {
     // DATA
     COLLECTOR         d_defaultCollector;  // default collector
     CollectorSet      d_addedCollectors;   // added collectors
+    int               d_numStripes;        // stripes of each collector
     bslma::Allocator *d_allocator_p;       // allocator (held, not owned)
 
     // NOT IMPLEMENTED
@@ -92,14 +151,17 @@ class CollectorRepository_Collectors {
 
     // CREATORS
     CollectorRepository_Collectors(const MetricId&   metricId,
+                                   int               numStripes,
                                    bslma::Allocator *basicAllocator = 0);
         // Create a 'CollectorRepository_Collectors' object to hold
         // objects of the templatized type 'COLLECTOR' for the specified
-        // 'metricId'.   Optionally specify a 'basicAllocator' used to supply
-        // memory.  If 'basicAllocator' is 0, the currently installed default
-        // allocator is used.  The behavior is undefined unless the
-        // templatized type 'COLLECTOR' is either 'Collector' or
-        // 'IntegerCollector', and 'metricId.isValid()' is 'true'.
+        // 'metricId', each striped across the specified 'numStripes' stripes
+        // (or not striped if 'numStripes' is 0).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless the templatized type 'COLLECTOR' is either
+        // 'Collector' or 'IntegerCollector', and 'metricId.isValid()' is
+        // 'true'.
 
     ~CollectorRepository_Collectors();
         // Destroy this object.
@@ -158,9 +220,11 @@ class CollectorRepository_Collectors {
 template <class COLLECTOR>
 CollectorRepository_Collectors<COLLECTOR>::
       CollectorRepository_Collectors(const MetricId&   metricId,
+                                     int               numStripes,
                                      bslma::Allocator *basicAllocator)
-: d_defaultCollector(metricId)
+: d_defaultCollector(metricId, numStripes, basicAllocator)
 , d_addedCollectors(basicAllocator)
+, d_numStripes(numStripes)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -186,7 +250,9 @@ bsl::shared_ptr<COLLECTOR>
 CollectorRepository_Collectors<COLLECTOR>::addCollector()
 {
     Collector collectorPtr(
-                new (*d_allocator_p) COLLECTOR(d_defaultCollector.metricId()),
+                new (*d_allocator_p) COLLECTOR(d_defaultCollector.metricId(),
+                                               d_numStripes,
+                                               d_allocator_p),
                 d_allocator_p);
     d_addedCollectors.insert(collectorPtr);
     return collectorPtr;
@@ -256,13 +322,14 @@ CollectorRepository_Collectors<COLLECTOR>::metricId() const
 
 class CollectorRepository_MetricCollectors {
     // This implementation class provides a container mechanism for managing
-    // the 'Collector' and 'IntegerCollector' objects associated with a single
-    // metric.  The 'collector' and 'intCollector' methods are provided to
-    // access the individual containers for 'Collector' objects and
-    // 'IntegerCollector' objects, respectively.   The 'collectAndReset' method
-    // obtains the aggregate value of all the owned collectors and integer
-    // collectors, and then resets those collectors and integer collectors to
-    // their default state.
+    // the 'Collector' and 'IntegerCollector' objects, and the optional
+    // 'HistogramCollector' object, associated with a single metric.  The
+    // 'collector' and 'intCollector' methods are provided to access the
+    // individual containers for 'Collector' objects and 'IntegerCollector'
+    // objects, respectively, and the 'histogramCollector' method to access the
+    // histogram collector, if any.  The 'collectAndReset' method obtains the
+    // aggregate value of all the owned collectors, and then resets those
+    // collectors to their default state.
 
     // PRIVATE TYPES
     typedef CollectorRepository_Collectors<Collector>
@@ -271,8 +338,19 @@ class CollectorRepository_MetricCollectors {
                                                         IntCollectors;
 
     // DATA
-    Collectors    d_collectors;     // collector objects
-    IntCollectors d_intCollectors;  // integer collector objects
+    Collectors          d_collectors;       // collector objects
+
+    IntCollectors       d_intCollectors;    // integer collector objects
+
+    HistogramCollector *d_histogramCollector_p;
+                                            // histogram collector (owned), or
+                                            // 0 if none has been created
+
+    MetricId            d_quantileIds[k_NUM_QUANTILES];
+                                            // ids of the metrics derived from
+                                            // the histogram collector
+
+    bslma::Allocator   *d_allocator_p;      // allocator (held, not owned)
 
     // NOT IMPLEMENTED
     CollectorRepository_MetricCollectors(
@@ -286,13 +364,16 @@ class CollectorRepository_MetricCollectors {
 
     // CREATORS
     CollectorRepository_MetricCollectors(const MetricId&   id,
+                                         int               numStripes,
                                          bslma::Allocator *basicAllocator = 0);
         // Create a 'CollectorRepository_MetricCollectors' object to hold
         // collector and integer collector objects for the specified
-        // 'metricId'.   Optionally specify a 'basicAllocator' used to supply
-        // memory.  If 'basicAllocator' is 0, the currently installed default
-        // allocator is used.  The behavior is undefined unless
-        // 'metricId.isValid()' is 'true'.
+        // 'metricId', each striped across the specified 'numStripes' stripes
+        // (or not striped if 'numStripes' is 0), and no histogram collector.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'metricId.isValid()' is
+        // 'true'.
 
     ~CollectorRepository_MetricCollectors();
         // Destroy this object.
@@ -306,16 +387,32 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the modifiable container of
         // 'IntegerCollector' objects.
 
-    void collectAndReset(MetricRecord *record);
-        // Load into the specified 'record' the aggregate value of all the
-        // records collected by the collectors owned by this object; then
+    HistogramCollector *histogramCollector();
+        // Return the address of the modifiable histogram collector owned by
+        // this object, or 0 if no histogram collector has been created.
+
+    HistogramCollector *createHistogramCollector(
+                                              const MetricId *quantileIds);
+        // Create a histogram collector for the metric of this object, whose
+        // quantiles are reported as the records of the 'k_NUM_QUANTILES'
+        // derived metrics identified by the specified 'quantileIds', and
+        // return its address.  The behavior is undefined unless this object
+        // has no histogram collector.
+
+    void collectAndReset(bsl::vector<MetricRecord> *records);
+        // Append to the specified 'records' a record holding the aggregate
+        // value of all the records collected by the collectors owned by this
+        // object, followed, if this object has a histogram collector, by the
+        // records of the metrics derived from the histogram collector; then
         // reset those collectors to their default values.  Note that all
         // collectors within this object record values for the same metric id,
         // so they can be aggregated into a single record.
 
-    void collect(MetricRecord *record);
-        // Load into the specified 'record' the aggregate value of all the
-        // records collected by the collectors owned by this object.  Note
+    void collect(bsl::vector<MetricRecord> *records);
+        // Append to the specified 'records' a record holding the aggregate
+        // value of all the records collected by the collectors owned by this
+        // object, followed, if this object has a histogram collector, by the
+        // records of the metrics derived from the histogram collector.  Note
         // that all collectors within this object record values for the same
         // metric id, so they can be aggregated into a single record.  Also
         // note that because this operation does not reset the collectors,
@@ -346,9 +443,12 @@ class CollectorRepository_MetricCollectors {
 inline
 CollectorRepository_MetricCollectors::
 CollectorRepository_MetricCollectors(const MetricId&   id,
+                                     int               numStripes,
                                      bslma::Allocator *basicAllocator)
-: d_collectors(id, basicAllocator)
-, d_intCollectors(id, basicAllocator)
+: d_collectors(id, numStripes, basicAllocator)
+, d_intCollectors(id, numStripes, basicAllocator)
+, d_histogramCollector_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
@@ -356,6 +456,9 @@ inline
 CollectorRepository_MetricCollectors::
 ~CollectorRepository_MetricCollectors()
 {
+    if (d_histogramCollector_p) {
+        d_allocator_p->deleteObject(d_histogramCollector_p);
+    }
 }
 
 // MANIPULATORS
@@ -373,21 +476,65 @@ CollectorRepository_MetricCollectors::intCollectors()
     return d_intCollectors;
 }
 
+inline
+HistogramCollector *CollectorRepository_MetricCollectors::histogramCollector()
+{
+    return d_histogramCollector_p;
+}
+
+HistogramCollector *
+CollectorRepository_MetricCollectors::createHistogramCollector(
+                                                   const MetricId *quantileIds)
+{
+    BSLS_ASSERT(!d_histogramCollector_p);
+
+    for (int i = 0; i < k_NUM_QUANTILES; ++i) {
+        d_quantileIds[i] = quantileIds[i];
+    }
+    d_histogramCollector_p = new (*d_allocator_p) HistogramCollector(
+                                                               metricId(),
+                                                               d_allocator_p);
+    return d_histogramCollector_p;
+}
+
 void CollectorRepository_MetricCollectors::collectAndReset(
-                                                          MetricRecord *record)
+                                            bsl::vector<MetricRecord> *records)
 {
-    d_collectors.collectAndReset(record);
+    MetricRecord record;
+    d_collectors.collectAndReset(&record);
     MetricRecord tempRecord;
     d_intCollectors.collectAndReset(&tempRecord);
-    combine(record, tempRecord);
+    combine(&record, tempRecord);
+
+    if (!d_histogramCollector_p) {
+        records->push_back(record);
+        return;                                                       // RETURN
+    }
+
+    Histogram histogram(d_histogramCollector_p->significantBits(),
+                        d_allocator_p);
+    d_histogramCollector_p->loadAndReset(&histogram);
+    appendHistogramRecords(records, &record, histogram, d_quantileIds);
 }
 
-void CollectorRepository_MetricCollectors::collect(MetricRecord *record)
+void CollectorRepository_MetricCollectors::collect(
+                                            bsl::vector<MetricRecord> *records)
 {
-    d_collectors.collect(record);
+    MetricRecord record;
+    d_collectors.collect(&record);
     MetricRecord tempRecord;
     d_intCollectors.collect(&tempRecord);
-    combine(record, tempRecord);
+    combine(&record, tempRecord);
+
+    if (!d_histogramCollector_p) {
+        records->push_back(record);
+        return;                                                       // RETURN
+    }
+
+    Histogram histogram(d_histogramCollector_p->significantBits(),
+                        d_allocator_p);
+    d_histogramCollector_p->load(&histogram);
+    appendHistogramRecords(records, &record, histogram, d_quantileIds);
 }
 
 // ACCESSORS
@@ -429,7 +576,9 @@ CollectorRepository::getMetricCollectors(const MetricId& metricId)
         const Category *category = metricId.category();
 
         MetricCollectorsSPtr collectorsPtr(
-               new (*d_allocator_p) MetricCollectors(metricId, d_allocator_p),
+               new (*d_allocator_p) MetricCollectors(metricId,
+                                                     d_numCollectorStripes,
+                                                     d_allocator_p),
                d_allocator_p);
 
         // To make this method exception safe: Reserve memory for inserting
@@ -463,9 +612,7 @@ void CollectorRepository::collectAndReset(bsl::vector<MetricRecord> *records,
         // Each 'MetricCollectors' object (in the 'd_categories' map) contains
         // the collectors for a single metric.
         for (; metricIt != metricCollectors.end(); ++metricIt) {
-            MetricRecord record;
-            (*metricIt)->collectAndReset(&record);
-            records->push_back(record);
+            (*metricIt)->collectAndReset(records);
         }
     }
 }
@@ -487,9 +634,7 @@ void CollectorRepository::collect(bsl::vector<MetricRecord> *records,
         // Each 'MetricCollectors' object (in the 'd_categories' map) contains
         // the collectors for a single metric.
         for (; metricIt != metricCollectors.end(); ++metricIt) {
-            MetricRecord record;
-            (*metricIt)->collect(&record);
-            records->push_back(record);
+            (*metricIt)->collect(records);
         }
     }
 }
@@ -531,6 +676,47 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
     return getMetricCollectors(metricId).intCollectors().defaultCollector();
 }
 
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                      const MetricId& metricId)
+{
+    BSLS_ASSERT(metricId.isValid());
+
+    // First, obtain a read-lock, and test if the histogram collector for
+    // 'metricId' already exists.
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Collectors::iterator it = d_collectors.find(metricId);
+        if (it != d_collectors.end() && it->second->histogramCollector()) {
+            return it->second->histogramCollector();                  // RETURN
+        }
+    }
+
+    // Register the metrics derived from the histogram collector before
+    // acquiring the write-lock, as the registry has a lock of its own.
+    MetricId          quantileIds[k_NUM_QUANTILES];
+    bsl::string       name(metricId.metricName(), d_allocator_p);
+    const bsl::size_t length = name.size();
+    for (int i = 0; i < k_NUM_QUANTILES; ++i) {
+        name.resize(length);
+        name += QUANTILES[i].d_suffix;
+
+        quantileIds[i] = d_registry_p->getId(metricId.categoryName(),
+                                             name.c_str());
+        d_registry_p->setPreferredPublicationType(quantileIds[i],
+                                                  PublicationType::e_MAX);
+    }
+
+    // Use 'getMetricCollectors' to create the metrics collectors object and
+    // the histogram collector (if they have not been created since the
+    // read-lock was released).
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    MetricCollectors&   collectors = getMetricCollectors(metricId);
+    HistogramCollector *collector  = collectors.histogramCollector();
+    return collector
+         ? collector
+         : collectors.createHistogramCollector(quantileIds);
+}
+
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                       const MetricId& metricId)
 {
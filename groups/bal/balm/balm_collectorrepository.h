@@ -18,7 +18,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   balm::CollectorRepository: a repository for collectors
 //
-//@SEE_ALSO: balm_collector, balm_integercollector, balm_metricsmanager
+//@SEE_ALSO: balm_collector, balm_integercollector, balm_histogramcollector,
+//           balm_metricsmanager
 //
 //@DESCRIPTION: This component defines a class, 'balm::CollectorRepository',
 // that serves as a repository for 'balm::Collector' and
@@ -34,9 +35,37 @@ BSLS_IDENT("$Id: $")
 // can safely collect values from multiple threads, however, the collector does
 // use a mutex: Applications anticipating high contention for that lock can use
 // 'addCollector' (and 'addIntegerCollector') to obtain multiple collectors and
-// thereby reduce contention.  Finally, the 'collectAndReset' operation
-// collects and returns metric records from each of the collectors in the
-// repository.
+// thereby reduce contention, or can supply a number of collector stripes at
+// construction, in which case each collector created by the repository is
+// *striped* (see 'balm_collector') and its updates acquire no lock.  Finally,
+// the 'collectAndReset' operation collects and returns metric records from
+// each of the collectors in the repository.
+//
+///Histogram Collectors
+///--------------------
+// The 'getDefaultHistogramCollector' operation returns the histogram
+// collector (see 'balm_histogramcollector') for the supplied metric, which
+// records the distribution of the values of that metric without acquiring a
+// lock.  The count, total, minimum, and maximum of the values collected by a
+// histogram collector are aggregated into the metric record for its metric,
+// along with the values of the other collectors for that metric.  In
+// addition, because a 'balm::MetricRecord' cannot hold a distribution, the
+// estimated 50th, 90th, 99th, and 99.9th percentiles of the collected values
+// are reported as the records of four *derived* metrics, in the category of
+// the metric, whose names are the name of the metric followed by ".p50",
+// ".p90", ".p99", and ".p999", respectively.  The 'min' and 'max' of the
+// record of a derived metric are both the estimated percentile, so that a
+// publisher can report the percentile as a maximum; accordingly, the
+// repository sets the preferred publication type of each derived metric to
+// 'balm::PublicationType::e_MAX' when it creates a histogram collector.  For
+// example, a 'balm::StreamPublisher' publishing a histogram collected for the
+// metric "Latency" in the category "Service" writes (among others) a line
+// such as:
+//..
+//  Service.Latency.p99[ max = 1472 ]
+//..
+// The records of the derived metrics of a histogram collector having no
+// collected values have the default value (a count of 0).
 //
 ///Alternative Systems for Telemetry
 ///---------------------------------
@@ -109,6 +138,7 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <balm_collector.h>
+#include <balm_histogramcollector.h>
 #include <balm_integercollector.h>
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
@@ -121,6 +151,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_assert.h>
+
 #include <bsl_map.h>
 #include <bsl_memory.h>
 #include <bsl_vector.h>
@@ -137,11 +169,11 @@ class CollectorRepository_MetricCollectors;  // defined in implementation
 
 class CollectorRepository {
     // This class defines a fully thread-safe repository mechanism for
-    // 'Collector' and 'IntegerCollector' objects.  Collectors are identified
-    // in the repository by a 'MetricId' object and also grouped together
-    // according to the category of the metric.  This repository supports
-    // operations to create, find, and collect metric records from the
-    // collectors in the repository.
+    // 'Collector', 'IntegerCollector', and 'HistogramCollector' objects.
+    // Collectors are identified in the repository by a 'MetricId' object and
+    // also grouped together according to the category of the metric.  This
+    // repository supports operations to create, find, and collect metric
+    // records from the collectors in the repository.
 
     // PRIVATE TYPES
     typedef CollectorRepository_MetricCollectors     MetricCollectors;
@@ -169,6 +201,9 @@ class CollectorRepository {
     Collectors              d_collectors;  // collectors (owned)
     CategorizedCollectors   d_categories;  // map of category => collectors
     mutable bslmt::RWMutex  d_rwMutex;     // data lock
+    int                     d_numCollectorStripes;
+                                           // stripes of each collector, or 0
+                                           // if collectors are not striped
     bslma::Allocator       *d_allocator_p; // allocator (held, not owned)
 
     // NOT IMPLEMENTED
@@ -200,6 +235,19 @@ class CollectorRepository {
         // 'basicAllocator' is 0, the currently installed default allocator is
         // used.  The behavior is undefined if 'registry' is 0.
 
+    CollectorRepository(MetricRegistry        *registry,
+                        int                    numCollectorStripes,
+                        bslma::Allocator      *basicAllocator = 0);
+        // Create an empty collector repository that will use the specified
+        // 'registry' to identify the metrics for which it manages collectors,
+        // and whose collectors (and integer collectors) are striped across
+        // the specified 'numCollectorStripes' stripes (see
+        // 'balm_collector'), or are not striped if 'numCollectorStripes' is
+        // 0.  Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined if 'registry' is 0, or unless
+        // '0 <= numCollectorStripes'.
+
     ~CollectorRepository();
         // Free all the collectors in this repository and destroy this object.
 
@@ -261,6 +309,34 @@ class CollectorRepository {
         // repository, create one, add it to the repository, and return its
         // address.
 
+    HistogramCollector *getDefaultHistogramCollector(const char *category,
+                                                     const char *metricName);
+        // Return the address of the modifiable histogram collector identified
+        // by the specified 'category' and 'metricName'.  If a histogram
+        // collector for the identified metric does not already exist in the
+        // repository, create one, add it to the repository, register the
+        // derived metrics reporting its percentiles (see "Histogram
+        // Collectors" in the component documentation), and return its
+        // address.  In addition, if the identified metric has not already
+        // been registered, add the identified metric to the 'metricRegistry'
+        // supplied at construction.  The behavior is undefined unless
+        // 'category' and 'metricName' are null-terminated.  Note that this
+        // operation is logically equivalent to:
+        //..
+        //  getDefaultHistogramCollector(
+        //                            registry().getId(category, metricName))
+        //..
+
+    HistogramCollector *getDefaultHistogramCollector(const MetricId& metricId);
+        // Return the address of the modifiable histogram collector identified
+        // by the specified 'metricId'.  If a histogram collector for the
+        // identified metric does not already exist in the repository, create
+        // one, add it to the repository, register the derived metrics
+        // reporting its percentiles (see "Histogram Collectors" in the
+        // component documentation), and return its address.  The behavior is
+        // undefined unless 'metricId' is a valid id returned by the
+        // 'MetricRepository' supplied at construction.
+
     bsl::shared_ptr<Collector> addCollector(const char *category,
                                             const char *metricName);
         // Return a shared pointer to a newly-created modifiable collector
@@ -319,6 +395,11 @@ class CollectorRepository {
         // this collector repository.
 
     // ACCESSORS
+    int numCollectorStripes() const;
+        // Return the number of stripes requested for each collector (and
+        // integer collector) created by this repository, or 0 if those
+        // collectors are not striped.
+
     const MetricRegistry& registry() const;
         // Return a reference to the non-modifiable registry of metrics used by
         // this collector repository.
@@ -340,10 +421,25 @@ CollectorRepository::CollectorRepository(MetricRegistry   *registry,
 , d_collectors(basicAllocator)
 , d_categories(basicAllocator)
 , d_rwMutex()
+, d_numCollectorStripes(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
+inline
+CollectorRepository::CollectorRepository(MetricRegistry   *registry,
+                                         int               numCollectorStripes,
+                                         bslma::Allocator *basicAllocator)
+: d_registry_p(registry)
+, d_collectors(basicAllocator)
+, d_categories(basicAllocator)
+, d_rwMutex()
+, d_numCollectorStripes(numCollectorStripes)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= numCollectorStripes);
+}
+
 inline
 CollectorRepository::~CollectorRepository()
 {
@@ -366,6 +462,15 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
                                                           metricName));
 }
 
+inline
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                        const char *category,
+                                                        const char *metricName)
+{
+    return getDefaultHistogramCollector(d_registry_p->getId(category,
+                                                            metricName));
+}
+
 inline
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                         const char *category,
@@ -389,6 +494,12 @@ MetricRegistry& CollectorRepository::registry()
 }
 
 // ACCESSORS
+inline
+int CollectorRepository::numCollectorStripes() const
+{
+    return d_numCollectorStripes;
+}
+
 inline
 const MetricRegistry& CollectorRepository::registry() const
 {
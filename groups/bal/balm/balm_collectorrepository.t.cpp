@@ -9,6 +9,10 @@
 
 #include <balm_collectorrepository.h>
 
+#include <balm_histogram.h>
+#include <balm_metricdescription.h>
+#include <balm_publicationtype.h>
+
 #include <bslma_testallocator.h>
 #include <bslmt_barrier.h>
 #include <bdlmt_fixedthreadpool.h>
@@ -53,6 +57,7 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // CREATORS
 // [ 2] CollectorRepository(MetricRegistry *, bslma::Allocator *);
+// [ 9] CollectorRepository(MetricRegistry *, int, bslma::Allocator *);
 // [ 2] ~CollectorRepository();
 // MANIPULATORS
 // [ 7] void collect(v<MetricRecord> *, const Category *);
@@ -61,6 +66,8 @@ using bsl::flush;
 // [ 3] getDefaultCollector(const MetricId&);
 // [ 6] getDefaultIntegerCollector(const StringRef&, const StringRef&);
 // [ 3] IntegerCollector *getDefaultIntegerCollector(const MetricId&);
+// [10] getDefaultHistogramCollector(const char *, const char *);
+// [10] HistogramCollector *getDefaultHistogramCollector(const MetricId&);
 // [ 5] addCollector(const StringRef&, const StringRef&);
 // [ 2] addCollector(const MetricId& metricId);
 // [ 5] addIntegerCollector(const StringRef&, const StringRef&);
@@ -71,10 +78,13 @@ using bsl::flush;
 // ACCESSORS
 // [ 2] int getAddedCollectors(v<C*> *, v<IC*> *, MetricId& ) const;
 // [ 2] const MetricRegistry& registry() const;
+// [ 9] int numCollectorStripes() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [ 9] STRIPED COLLECTORS
+// [10] HISTOGRAM COLLECTORS
+// [11] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -399,7 +409,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -476,6 +486,251 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING HISTOGRAM COLLECTORS
+        //
+        // Concerns:
+        //: 1 'getDefaultHistogramCollector' creates a single histogram
+        //:   collector per metric, using the repository's allocator, and
+        //:   returns it on subsequent calls, whether the metric is supplied
+        //:   by id or by name.
+        //:
+        //: 2 The derived metrics reporting the quantiles of a histogram
+        //:   collector are registered in the category of its metric, with a
+        //:   preferred publication type of 'e_MAX'.
+        //:
+        //: 3 The count, total, minimum, and maximum of the values collected
+        //:   by a histogram collector are combined with the values of the
+        //:   other collectors for the same metric.
+        //:
+        //: 4 A record for each derived metric, holding the corresponding
+        //:   quantile, is collected after the record of the metric.
+        //:
+        //: 5 'collectAndReset' resets the histogram collector, and the
+        //:   derived metrics of an empty histogram collector have the default
+        //:   value, whereas 'collect' does not reset the histogram collector.
+        //
+        // Plan:
+        //: 1 Obtain the histogram collector of a metric several times, by
+        //:   name and by id, and verify that the same address is returned and
+        //:   that the default allocator is not used.  (C-1)
+        //:
+        //: 2 Verify the preferred publication type of the derived metrics.
+        //:   (C-2)
+        //:
+        //: 3 Update the histogram collector and an integer collector for the
+        //:   same metric, and a reference histogram with the same values, and
+        //:   compare the collected records with the values computed from the
+        //:   reference histogram.  (C-3,4)
+        //:
+        //: 4 Collect the records a second time, using 'collect' and
+        //:   'collectAndReset', and verify the collected records.  (C-5)
+        //
+        // Testing:
+        //   getDefaultHistogramCollector(const char *, const char *);
+        //   HistogramCollector *getDefaultHistogramCollector(const MetricId&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING HISTOGRAM COLLECTORS" << endl
+                                  << "============================" << endl;
+
+        static const struct {
+            const char *d_name;      // name of the derived metric
+            double      d_quantile;  // quantile reported by the metric
+        } QUANTILES[] = {
+            { "H.p50",  0.5   },
+            { "H.p90",  0.9   },
+            { "H.p99",  0.99  },
+            { "H.p999", 0.999 }
+        };
+        const int NUM_QUANTILES = static_cast<int>(sizeof  QUANTILES
+                                                   / sizeof *QUANTILES);
+
+        balm::MetricRegistry      registry(Z);
+        balm::CollectorRepository mX(&registry, Z);
+
+        const bsls::Types::Int64 NUM_DEFAULT =
+                                            defaultAllocator.numAllocations();
+
+        balm::HistogramCollector *h = mX.getDefaultHistogramCollector("A",
+                                                                      "H");
+        ASSERT(0 != h);
+        ASSERT(h == mX.getDefaultHistogramCollector("A", "H"));
+        ASSERT(h == mX.getDefaultHistogramCollector(registry.getId("A",
+                                                                   "H")));
+        ASSERT(h != mX.getDefaultHistogramCollector("A", "I"));
+        ASSERT(registry.getId("A", "H") == h->metricId());
+
+        for (int i = 0; i < NUM_QUANTILES; ++i) {
+            const Id id = registry.findId("A", QUANTILES[i].d_name);
+
+            LOOP_ASSERT(i, id.isValid());
+            LOOP_ASSERT(i, balm::PublicationType::e_MAX ==
+                               id.description()->preferredPublicationType());
+        }
+
+        ICol *ic = mX.getDefaultIntegerCollector("A", "H");
+
+        balm::Histogram reference(h->significantBits(), Z);
+        for (int i = 1; i <= 1000; ++i) {
+            h->update(i);
+            reference.record(i);
+        }
+        ic->update(2000);
+
+        ASSERT(NUM_DEFAULT == defaultAllocator.numAllocations());
+
+        for (int collectOnly = 1; collectOnly >= 0; --collectOnly) {
+            bsl::vector<Rec> records(Z);
+            if (collectOnly) {
+                mX.collect(&records, registry.getCategory("A"));
+            }
+            else {
+                mX.collectAndReset(&records, registry.getCategory("A"));
+            }
+
+            // The records of metrics "H" and "I", and of their derived
+            // metrics.
+
+            LOOP_ASSERT(records.size(), 10 == records.size());
+
+            bsl::sort(records.begin(), records.end(), recordLess);
+
+            if (veryVerbose) {
+                for (bsl::size_t i = 0; i < records.size(); ++i) {
+                    P(records[i]);
+                }
+            }
+
+            ASSERTV(collectOnly, records[0],
+                    Rec(registry.getId("A", "H"), 1001, 502500, 1, 2000)
+                                                              == records[0]);
+
+            for (int i = 0; i < NUM_QUANTILES; ++i) {
+                const double Q = static_cast<double>(
+                          reference.valueAtQuantile(QUANTILES[i].d_quantile));
+                const Rec    EXP(registry.getId("A", QUANTILES[i].d_name),
+                                 1000,
+                                 Q * 1000,
+                                 Q,
+                                 Q);
+
+                ASSERTV(collectOnly, i, EXP, records[i + 1],
+                        EXP == records[i + 1]);
+            }
+
+            ASSERTV(collectOnly, records[5],
+                    Rec(registry.getId("A", "I")) == records[5]);
+        }
+
+        bsl::vector<Rec> records(Z);
+        mX.collectAndReset(&records, registry.getCategory("A"));
+        ASSERT(10 == records.size());
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            LOOP_ASSERT(i, Rec(records[i].metricId()) == records[i]);
+        }
+
+        ASSERT(NUM_DEFAULT == defaultAllocator.numAllocations());
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING STRIPED COLLECTORS
+        //
+        // Concerns:
+        //: 1 A repository constructed without a number of collector stripes,
+        //:   or with 0 stripes, creates collectors that are not striped.
+        //:
+        //: 2 A repository constructed with a positive number of collector
+        //:   stripes creates default and added collectors (and integer
+        //:   collectors) that are striped, using the repository's allocator.
+        //:
+        //: 3 Values recorded in striped collectors are collected and reset by
+        //:   'collectAndReset'.
+        //
+        // Plan:
+        //: 1 Create repositories with 0 and with several collector stripes,
+        //:   verify 'numCollectorStripes' and the number of stripes of the
+        //:   collectors they create.  (C-1,2)
+        //:
+        //: 2 Update the striped collectors and verify the records collected
+        //:   by 'collectAndReset'.  (C-3)
+        //
+        // Testing:
+        //   CollectorRepository(MetricRegistry *, int, bslma::Allocator *);
+        //   int numCollectorStripes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING STRIPED COLLECTORS" << endl
+                                  << "==========================" << endl;
+
+        {
+            balm::MetricRegistry      registry(Z);
+            balm::CollectorRepository mX(&registry, Z);
+            const balm::CollectorRepository& MX = mX;
+
+            ASSERT(0 == MX.numCollectorStripes());
+            ASSERT(0 == mX.getDefaultCollector("A", "A")->numStripes());
+            ASSERT(0 == mX.getDefaultIntegerCollector("A", "B")->numStripes());
+        }
+        {
+            balm::MetricRegistry      registry(Z);
+            balm::CollectorRepository mX(&registry, 0, Z);
+            const balm::CollectorRepository& MX = mX;
+
+            ASSERT(0 == MX.numCollectorStripes());
+            ASSERT(0 == mX.getDefaultCollector("A", "A")->numStripes());
+            ASSERT(0 == mX.addCollector("A", "A")->numStripes());
+        }
+        {
+            balm::MetricRegistry      registry(Z);
+            balm::CollectorRepository mX(&registry, 3, Z);
+            const balm::CollectorRepository& MX = mX;
+
+            ASSERT(3 == MX.numCollectorStripes());
+
+            const bsls::Types::Int64 NUM_DEFAULT =
+                                            defaultAllocator.numAllocations();
+
+            balm::Collector        *c1 = mX.getDefaultCollector("A", "A");
+            balm::IntegerCollector *c2 = mX.getDefaultIntegerCollector("A",
+                                                                       "B");
+            bsl::shared_ptr<balm::Collector>        c3 =
+                                                    mX.addCollector("A", "A");
+            bsl::shared_ptr<balm::IntegerCollector> c4 =
+                                             mX.addIntegerCollector("A", "B");
+
+            ASSERT(NUM_DEFAULT == defaultAllocator.numAllocations());
+
+            ASSERT(4 == c1->numStripes());
+            ASSERT(4 == c2->numStripes());
+            ASSERT(4 == c3->numStripes());
+            ASSERT(4 == c4->numStripes());
+
+            c1->update(1.0);
+            c3->update(2.0);
+            c2->update(3);
+            c4->update(5);
+
+            bsl::vector<balm::MetricRecord> records(Z);
+            mX.collectAndReset(&records, registry.getCategory("A"));
+            ASSERT(2 == records.size());
+
+            bsl::sort(records.begin(), records.end(), recordLess);
+
+            ASSERT(balm::MetricRecord(registry.getId("A", "A"), 2, 3, 1, 2)
+                                                               == records[0]);
+            ASSERT(balm::MetricRecord(registry.getId("A", "B"), 2, 8, 3, 5)
+                                                               == records[1]);
+
+            records.clear();
+            mX.collectAndReset(&records, registry.getCategory("A"));
+            ASSERT(2 == records.size());
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                LOOP_ASSERT(i, 0 == records[i].count());
+            }
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
@@ -0,0 +1,98 @@
+// balm_collectorstripeutil.cpp                                       -*-C++-*-
+#include <balm_collectorstripeutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_collectorstripeutil_cpp,"$Id$ $CSID$")
+
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace {
+
+bsls::AtomicUint s_nextStripeIndex;  // stripe index of the next thread
+
+// On supported platforms, define a thread-local variable, 'g_stripeIndex', to
+// cache the stripe index of each thread, offset by one so that 0 indicates
+// that no index has been assigned to the thread.
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(unsigned int, g_stripeIndex, 0);
+#endif
+
+}  // close unnamed namespace
+
+namespace balm {
+
+                         // --------------------------
+                         // struct CollectorStripeUtil
+                         // --------------------------
+
+// CLASS METHODS
+int CollectorStripeUtil::defaultNumStripes()
+{
+    const unsigned int numThreads = bslmt::ThreadUtil::hardwareConcurrency();
+
+    if (0 == numThreads) {
+        return 1;                                                     // RETURN
+    }
+    return numThreads < static_cast<unsigned int>(k_MAX_NUM_STRIPES)
+           ? roundNumStripes(static_cast<int>(numThreads))
+           : static_cast<int>(k_MAX_NUM_STRIPES);
+}
+
+int CollectorStripeUtil::roundNumStripes(int numStripes)
+{
+    BSLS_ASSERT(0 < numStripes);
+
+    int result = 1;
+    while (result < numStripes && result < k_MAX_NUM_STRIPES) {
+        result *= 2;
+    }
+    return result;
+}
+
+unsigned int CollectorStripeUtil::threadStripeIndex()
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    if (g_stripeIndex) {
+        return g_stripeIndex - 1;                                     // RETURN
+    }
+
+    const unsigned int index = s_nextStripeIndex.addRelaxed(1) - 1;
+
+    g_stripeIndex = index + 1;
+    return index;
+#else
+    // Without thread-local storage, derive the index from the thread id.
+    // Thread ids are typically addresses, so discard their low-order bits.
+
+    bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+    id ^= id >> 12;
+    id ^= id >> 24;
+    return static_cast<unsigned int>(id);
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,116 @@
+// balm_collectorstripeutil.h                                         -*-C++-*-
+#ifndef INCLUDED_BALM_COLLECTORSTRIPEUTIL
+#define INCLUDED_BALM_COLLECTORSTRIPEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities for collectors that stripe updates across cells.
+//
+//@CLASSES:
+//   balm::CollectorStripeUtil: namespace for collector striping utilities
+//
+//@SEE_ALSO: balm_collector, balm_integercollector
+//
+//@DESCRIPTION: This component provides a 'struct',
+// 'balm::CollectorStripeUtil', that serves as a namespace for the utilities
+// shared by the *striped* modes of 'balm::Collector' and
+// 'balm::IntegerCollector'.  A striped collector holds an array of
+// cache-line-sized cells ("stripes"), rather than a single mutex-protected
+// record.  Each thread updates the stripe selected by its
+// *stripe index*, using atomic operations, so that threads updating the same
+// metric concurrently do not contend on a lock or, as long as there are at
+// least as many stripes as updating threads, on a cache line.  The stripes
+// are merged when the collector is loaded (e.g., at publication time).
+//
+// The stripe index of a thread is assigned, on the first request by that
+// thread, from a process-wide counter, so that concurrently running threads
+// are assigned consecutive indices.  A collector having 'N' stripes (where 'N'
+// is a power of two) uses stripe 'threadStripeIndex() & (N - 1)'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Choosing a Stripe
+/// - - - - - - - - - - - - - -
+// Suppose that we are implementing a counter that is incremented concurrently
+// by many threads, and that we stripe it across cache lines.
+//
+// First, we choose the number of stripes, which is a power of two suited to
+// the number of processors of the host:
+//..
+//  const int numStripes = balm::CollectorStripeUtil::defaultNumStripes();
+//  assert(0 == (numStripes & (numStripes - 1)));
+//..
+// Then, we compute the stripe to be updated by the calling thread:
+//..
+//  const unsigned int stripe = balm::CollectorStripeUtil::threadStripeIndex()
+//                                                         & (numStripes - 1);
+//  assert(static_cast<int>(stripe) < numStripes);
+//..
+// Finally, we observe that the stripe index of a thread does not change:
+//..
+//  assert(stripe == (balm::CollectorStripeUtil::threadStripeIndex()
+//                                                        & (numStripes - 1)));
+//..
+
+#include <balscm_version.h>
+
+#include <bslmt_platform.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                         // ==========================
+                         // struct CollectorStripeUtil
+                         // ==========================
+
+struct CollectorStripeUtil {
+    // This 'struct' provides a namespace for utilities used by collectors
+    // that stripe their updates across cache-line-sized cells.
+
+    // CONSTANTS
+    enum {
+        k_STRIPE_SIZE     = bslmt::Platform::e_CACHE_LINE_SIZE,
+                                              // size (in bytes) of a stripe
+
+        k_MAX_NUM_STRIPES = 64                // maximum number of stripes
+    };
+
+    // CLASS METHODS
+    static int defaultNumStripes();
+        // Return the default number of stripes of a striped collector: the
+        // smallest power of two not less than the number of hardware threads
+        // of the host, capped at 'k_MAX_NUM_STRIPES'.
+
+    static int roundNumStripes(int numStripes);
+        // Return the smallest power of two not less than the specified
+        // 'numStripes', capped at 'k_MAX_NUM_STRIPES'.  The behavior is
+        // undefined unless '0 < numStripes'.
+
+    static unsigned int threadStripeIndex();
+        // Return the stripe index of the calling thread.  Note that the stripe
+        // index of a thread does not change over the lifetime of the thread.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,406 @@
+// balm_collectorstripeutil.t.cpp                                     -*-C++-*-
+#include <balm_collectorstripeutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility providing the stripe size, the
+// number of stripes, and the per-thread stripe index used by striped
+// collectors.  We verify the rounding of the number of stripes against a
+// table of values, the default number of stripes against the number of
+// hardware threads, and that the stripe index of a thread is stable and
+// distinct from that of the other concurrently running threads.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] int defaultNumStripes();
+// [ 2] int roundNumStripes(int numStripes);
+// [ 4] unsigned int threadStripeIndex();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(expr) BSLS_ASSERTTEST_ASSERT_FAIL(expr)
+#define ASSERT_PASS(expr) BSLS_ASSERTTEST_ASSERT_PASS(expr)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::CollectorStripeUtil Util;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+void loadStripeIndex(unsigned int   *result,
+                     bool           *isStable,
+                     bslmt::Barrier *barrier)
+    // Load into the specified 'result' the stripe index of the calling
+    // thread, and load into the specified 'isStable' whether a second request
+    // returns the same index.  Wait on the specified 'barrier' before
+    // returning, so that the calling thread runs concurrently with the other
+    // threads waiting on 'barrier'.
+{
+    *result   = Util::threadStripeIndex();
+    *isStable = *result == Util::threadStripeIndex();
+    barrier->wait();
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Choosing a Stripe
+/// - - - - - - - - - - - - - -
+// Suppose that we are implementing a counter that is incremented concurrently
+// by many threads, and that we stripe it across cache lines.
+//
+// First, we choose the number of stripes, which is a power of two suited to
+// the number of processors of the host:
+//..
+    const int numStripes = balm::CollectorStripeUtil::defaultNumStripes();
+    ASSERT(0 == (numStripes & (numStripes - 1)));
+//..
+// Then, we compute the stripe to be updated by the calling thread:
+//..
+    const unsigned int stripe = balm::CollectorStripeUtil::threadStripeIndex()
+                                                           & (numStripes - 1);
+    ASSERT(static_cast<int>(stripe) < numStripes);
+//..
+// Finally, we observe that the stripe index of a thread does not change:
+//..
+    ASSERT(stripe == (balm::CollectorStripeUtil::threadStripeIndex()
+                                                          & (numStripes - 1)));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'threadStripeIndex'
+        //
+        // Concerns:
+        //: 1 The stripe index of a thread does not change.
+        //:
+        //: 2 Concurrently running threads are assigned distinct stripe
+        //:   indices (where thread-local storage is supported).
+        //
+        // Plan:
+        //: 1 Request the stripe index twice from the main thread and from
+        //:   each of several concurrently running threads, and verify that
+        //:   both requests return the same index.  (C-1)
+        //:
+        //: 2 Verify that the indices of the concurrently running threads are
+        //:   distinct.  (C-2)
+        //
+        // Testing:
+        //   unsigned int threadStripeIndex();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHOD 'threadStripeIndex'" << endl
+                          << "================================" << endl;
+
+        ASSERT(Util::threadStripeIndex() == Util::threadStripeIndex());
+
+        enum { k_NUM_THREADS = 16 };
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        unsigned int   indices[k_NUM_THREADS];
+        bool           isStable[k_NUM_THREADS];
+        bslmt::Barrier barrier(k_NUM_THREADS);
+
+        {
+            bslmt::ThreadGroup group(&ta);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == group.addThread(
+                                       bdlf::BindUtil::bind(&loadStripeIndex,
+                                                            indices + i,
+                                                            isStable + i,
+                                                            &barrier)));
+            }
+            group.joinAll();
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            if (veryVerbose) { P_(i) P(indices[i]) }
+
+            LOOP_ASSERT(i, isStable[i]);
+        }
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+        bsl::sort(indices, indices + k_NUM_THREADS);
+        ASSERT(indices + k_NUM_THREADS ==
+                       bsl::adjacent_find(indices, indices + k_NUM_THREADS));
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'defaultNumStripes'
+        //
+        // Concerns:
+        //: 1 The default number of stripes is a power of two in the range
+        //:   '[1, k_MAX_NUM_STRIPES]'.
+        //:
+        //: 2 The default number of stripes is not less than the number of
+        //:   hardware threads, unless capped.
+        //
+        // Plan:
+        //: 1 Compare the default number of stripes with the number of
+        //:   hardware threads reported by 'bslmt::ThreadUtil'.  (C-1,2)
+        //
+        // Testing:
+        //   int defaultNumStripes();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHOD 'defaultNumStripes'" << endl
+                          << "================================" << endl;
+
+        const int          numStripes = Util::defaultNumStripes();
+        const unsigned int numThreads =
+                                     bslmt::ThreadUtil::hardwareConcurrency();
+
+        if (veryVerbose) { P_(numStripes) P(numThreads) }
+
+        ASSERTV(numStripes, 1 <= numStripes);
+        ASSERTV(numStripes, Util::k_MAX_NUM_STRIPES >= numStripes);
+        ASSERTV(numStripes, 0 == (numStripes & (numStripes - 1)));
+        ASSERTV(numStripes, numThreads,
+                Util::k_MAX_NUM_STRIPES == numStripes
+             || numThreads <= static_cast<unsigned int>(numStripes));
+        ASSERTV(numStripes, numThreads,
+                1 == numStripes
+             || static_cast<unsigned int>(numStripes / 2) < numThreads);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'roundNumStripes'
+        //
+        // Concerns:
+        //: 1 The result is the smallest power of two not less than the
+        //:   argument.
+        //:
+        //: 2 The result is capped at 'k_MAX_NUM_STRIPES'.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the result for a set of
+        //:   arguments including powers of two, their neighbors, and values
+        //:   beyond the cap.  (C-1,2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   int roundNumStripes(int numStripes);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHOD 'roundNumStripes'" << endl
+                          << "==============================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_numStripes;
+            int d_expected;
+        } DATA[] = {
+            //LINE    NUM   EXP
+            //----  -----   ---
+            { L_,       1,    1 },
+            { L_,       2,    2 },
+            { L_,       3,    4 },
+            { L_,       4,    4 },
+            { L_,       5,    8 },
+            { L_,       7,    8 },
+            { L_,      17,   32 },
+            { L_,      32,   32 },
+            { L_,      33,   64 },
+            { L_,      63,   64 },
+            { L_,      64,   64 },
+            { L_,      65,   64 },
+            { L_,    1000,   64 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+            const int NUM  = DATA[ti].d_numStripes;
+            const int EXP  = DATA[ti].d_expected;
+
+            if (veryVerbose) { P_(LINE) P_(NUM) P(EXP) }
+
+            LOOP3_ASSERT(LINE, EXP, Util::roundNumStripes(NUM),
+                         EXP == Util::roundNumStripes(NUM));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::roundNumStripes( 1));
+            ASSERT_FAIL(Util::roundNumStripes( 0));
+            ASSERT_FAIL(Util::roundNumStripes(-1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Invoke each class method and verify the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        ASSERT(0 <  static_cast<int>(Util::k_STRIPE_SIZE));
+        ASSERT(64 == static_cast<int>(Util::k_MAX_NUM_STRIPES));
+
+        ASSERT(1 == Util::roundNumStripes(1));
+        ASSERT(4 == Util::roundNumStripes(3));
+
+        const int numStripes = Util::defaultNumStripes();
+        ASSERT(1 <= numStripes);
+
+        const unsigned int index = Util::threadStripeIndex();
+        ASSERT(index == Util::threadStripeIndex());
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,237 @@
+// balm_histogram.cpp                                                 -*-C++-*-
+#include <balm_histogram.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogram_cpp,"$Id$ $CSID$")
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_limits.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                              // ---------------
+                              // class Histogram
+                              // ---------------
+
+// PUBLIC CONSTANTS
+const bsls::Types::Int64 Histogram::k_DEFAULT_MIN =
+                                bsl::numeric_limits<bsls::Types::Int64>::max();
+const bsls::Types::Int64 Histogram::k_DEFAULT_MAX =
+                                bsl::numeric_limits<bsls::Types::Int64>::min();
+
+// CLASS METHODS
+bsls::Types::Int64 Histogram::bucketLowerBound(int index, int significantBits)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numBuckets(significantBits));
+
+    const int numSubBuckets = 1 << significantBits;
+
+    if (index < 2 * numSubBuckets) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift     = (index >> significantBits) - 1;
+    const int subBucket = index & (numSubBuckets - 1);
+
+    return static_cast<Int64>(
+               static_cast<bsl::uint64_t>(numSubBuckets + subBucket) << shift);
+}
+
+bsls::Types::Int64 Histogram::bucketUpperBound(int index, int significantBits)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numBuckets(significantBits));
+
+    if (index < 2 * (1 << significantBits)) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift = (index >> significantBits) - 1;
+
+    return bucketLowerBound(index, significantBits)
+         + ((static_cast<Int64>(1) << shift) - 1);
+}
+
+// CREATORS
+Histogram::Histogram(bslma::Allocator *basicAllocator)
+: d_buckets(numBuckets(k_DEFAULT_SIGNIFICANT_BITS), 0, basicAllocator)
+, d_count(0)
+, d_total(0)
+, d_min(k_DEFAULT_MIN)
+, d_max(k_DEFAULT_MAX)
+, d_significantBits(k_DEFAULT_SIGNIFICANT_BITS)
+{
+}
+
+Histogram::Histogram(int significantBits, bslma::Allocator *basicAllocator)
+: d_buckets(numBuckets(significantBits), 0, basicAllocator)
+, d_count(0)
+, d_total(0)
+, d_min(k_DEFAULT_MIN)
+, d_max(k_DEFAULT_MAX)
+, d_significantBits(significantBits)
+{
+}
+
+Histogram::Histogram(const Histogram&  original,
+                     bslma::Allocator *basicAllocator)
+: d_buckets(original.d_buckets, basicAllocator)
+, d_count(original.d_count)
+, d_total(original.d_total)
+, d_min(original.d_min)
+, d_max(original.d_max)
+, d_significantBits(original.d_significantBits)
+{
+}
+
+// MANIPULATORS
+Histogram& Histogram::operator=(const Histogram& rhs)
+{
+    d_buckets         = rhs.d_buckets;
+    d_count           = rhs.d_count;
+    d_total           = rhs.d_total;
+    d_min             = rhs.d_min;
+    d_max             = rhs.d_max;
+    d_significantBits = rhs.d_significantBits;
+    return *this;
+}
+
+void Histogram::accumulateTotalMinMax(Int64 total, Int64 min, Int64 max)
+{
+    d_total += total;
+    d_min    = bsl::min(d_min, min);
+    d_max    = bsl::max(d_max, max);
+}
+
+void Histogram::merge(const Histogram& other)
+{
+    BSLS_ASSERT(other.d_significantBits == d_significantBits);
+
+    for (bsl::size_t i = 0; i < d_buckets.size(); ++i) {
+        d_buckets[i] += other.d_buckets[i];
+    }
+    d_count += other.d_count;
+    accumulateTotalMinMax(other.d_total, other.d_min, other.d_max);
+}
+
+void Histogram::record(Int64 value, Int64 count)
+{
+    BSLS_ASSERT(0 <= count);
+
+    if (0 == count) {
+        return;                                                       // RETURN
+    }
+
+    d_buckets[bucketIndex(value, d_significantBits)] += count;
+    d_count += count;
+    accumulateTotalMinMax(value * count, value, value);
+}
+
+void Histogram::reset()
+{
+    bsl::fill(d_buckets.begin(), d_buckets.end(), 0);
+    d_count = 0;
+    d_total = 0;
+    d_min   = k_DEFAULT_MIN;
+    d_max   = k_DEFAULT_MAX;
+}
+
+// ACCESSORS
+bsls::Types::Int64 Histogram::valueAtQuantile(double quantile) const
+{
+    BSLS_ASSERT(0 <= quantile);
+    BSLS_ASSERT(quantile <= 1);
+
+    if (0 == d_count) {
+        return 0;                                                     // RETURN
+    }
+
+    if (0 == quantile) {
+        return d_min;                                                 // RETURN
+    }
+
+    // Find the bucket holding the value of rank 'ceil(quantile * d_count)',
+    // where ranks start at 1.
+
+    Int64 rank = static_cast<Int64>(
+                         bsl::ceil(quantile * static_cast<double>(d_count)));
+    rank = bsl::max(rank, static_cast<Int64>(1));
+    rank = bsl::min(rank, d_count);
+
+    Int64 cumulative = 0;
+    int   index      = 0;
+    for (; index < numBuckets() - 1; ++index) {
+        cumulative += d_buckets[index];
+        if (cumulative >= rank) {
+            break;
+        }
+    }
+
+    const Int64 value = bucketUpperBound(index, d_significantBits);
+
+    return bsl::max(d_min, bsl::min(value, d_max));
+}
+
+bsl::ostream& Histogram::print(bsl::ostream& stream) const
+{
+    stream << "[ count = " << d_count << " total = " << d_total;
+
+    if (0 == d_count) {
+        stream << " ]";
+        return stream;                                                // RETURN
+    }
+
+    stream << " min = "   << d_min
+           << " max = "   << d_max
+           << " p50 = "   << valueAtQuantile(0.5)
+           << " p90 = "   << valueAtQuantile(0.9)
+           << " p99 = "   << valueAtQuantile(0.99)
+           << " p99.9 = " << valueAtQuantile(0.999)
+           << " ]";
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool balm::operator==(const Histogram& lhs, const Histogram& rhs)
+{
+    if (lhs.significantBits() != rhs.significantBits()
+     || lhs.count()           != rhs.count()
+     || lhs.total()           != rhs.total()
+     || lhs.min()             != rhs.min()
+     || lhs.max()             != rhs.max()) {
+        return false;                                                 // RETURN
+    }
+
+    for (int i = 0; i < lhs.numBuckets(); ++i) {
+        if (lhs.bucketCount(i) != rhs.bucketCount(i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,478 @@
+// balm_histogram.h                                                   -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAM
+#define INCLUDED_BALM_HISTOGRAM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mergeable, fixed-size, log-linear histogram of values.
+//
+//@CLASSES:
+//   balm::Histogram: log-linear histogram of non-negative integer values
+//
+//@SEE_ALSO: balm_histogramcollector, balm_collectorrepository
+//
+//@DESCRIPTION: This component provides a value-semantic class,
+// 'balm::Histogram', that records the distribution of a set of integer values
+// (e.g., latencies measured in microseconds) in a fixed number of buckets,
+// from which quantiles of the recorded values (e.g., the median, or the 99th
+// percentile) can be estimated.  In addition to its buckets, a histogram
+// maintains the exact count, total, minimum, and maximum of the recorded
+// values.
+//
+///Bucket Layout
+///-------------
+// The buckets of a histogram are *log-linear*, in the manner of an HDR
+// ("high dynamic range") histogram: a histogram having 'B' *significant*
+// *bits* records each value 'v < 2 ^ (B + 1)' exactly, in a bucket of its own,
+// and divides each subsequent power-of-two range '[2 ^ e, 2 ^ (e + 1))' into
+// '2 ^ B' buckets of equal width '2 ^ (e - B)'.  The width of the bucket
+// holding a value 'v' is therefore at most 'v / 2 ^ B', and a quantile
+// estimated from the buckets differs from the exact quantile by a relative
+// error of at most '2 ^ -B' (about 3% for the default of 5 significant bits).
+// The buckets cover every non-negative 'bsls::Types::Int64' value, so that a
+// histogram has a fixed number of buckets, '(64 - B) * 2 ^ B', and recording
+// a value never allocates memory.  Negative values are counted in the lowest
+// bucket (although the minimum and total of the histogram reflect their
+// exact values).
+//
+// The following table gives the number of buckets for some numbers of
+// significant bits:
+//..
+//  Significant Bits   Number of Buckets   Maximum Relative Error
+//  ----------------   -----------------   ----------------------
+//         3                   488                 12.5%
+//         5 (default)        1888                  3.1%
+//         7                  7296                  0.8%
+//..
+// Two histograms having the same number of significant bits can be *merged*
+// (see 'merge'), so that, for example, histograms collected by several
+// processes, or over several publication intervals, can be combined exactly.
+//
+///Quantiles
+///---------
+// The 'valueAtQuantile' method returns an estimate of the value at a given
+// quantile 'q' (where '0 <= q <= 1') of the recorded values: the highest
+// value that is equivalent (i.e., that shares a bucket) to the value having
+// rank 'ceil(q * count())' among the recorded values, clamped to the range
+// '[min(), max()]'.  Note that 'valueAtQuantile(0)' returns 'min()', and
+// 'valueAtQuantile(1)' returns 'max()'.
+//
+///Thread Safety
+///-------------
+// 'balm::Histogram' is *const* *thread-safe*, meaning that accessors may be
+// invoked concurrently from different threads, but it is not safe to access
+// or modify a 'balm::Histogram' in one thread while another thread modifies
+// the same object.  See 'balm_histogramcollector' for a mechanism that
+// records values concurrently from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Estimating Latency Percentiles
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we measure the latencies of the requests processed by a
+// service, and that we want to report their median and 99th percentile.
+//
+// First, we create a histogram having the default number of significant bits:
+//..
+//  balm::Histogram histogram;
+//  assert(0 == histogram.count());
+//..
+// Then, we record the latencies, in microseconds, of 1000 requests, 990 of
+// which complete in about 100 microseconds, and 10 of which are much slower:
+//..
+//  for (int i = 0; i < 990; ++i) {
+//      histogram.record(95 + i % 10);
+//  }
+//  for (int i = 0; i < 10; ++i) {
+//      histogram.record(20000 + i);
+//  }
+//  assert(1000  == histogram.count());
+//  assert(95    == histogram.min());
+//  assert(20009 == histogram.max());
+//..
+// Next, we estimate the median and the 99th percentile of the latencies.  The
+// estimates are within 3% of the exact values:
+//..
+//  const bsls::Types::Int64 median = histogram.valueAtQuantile(0.5);
+//  const bsls::Types::Int64 p99    = histogram.valueAtQuantile(0.99);
+//
+//  assert(99  <= median && median <= 102);
+//  assert(104 <= p99    && p99    <= 107);
+//..
+// Finally, we merge the histogram of a second interval, in which every request
+// was slow, and observe that the median of the combined intervals is now slow:
+//..
+//  balm::Histogram slowInterval;
+//  slowInterval.record(20000, 2000);
+//
+//  histogram.merge(slowInterval);
+//  assert(3000 == histogram.count());
+//  assert(19456 <= histogram.valueAtQuantile(0.5));
+//..
+
+#include <balscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_iosfwd.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                              // ===============
+                              // class Histogram
+                              // ===============
+
+class Histogram {
+    // This value-semantic class records the distribution of a set of integer
+    // values in a fixed number of log-linear buckets, together with their
+    // exact count, total, minimum, and maximum.  The salient attributes of a
+    // histogram are its number of significant bits, its bucket counts, and
+    // its total, minimum, and maximum.
+
+  public:
+    // TYPES
+    typedef bsls::Types::Int64 Int64;
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_MIN_SIGNIFICANT_BITS     = 1,  // minimum number of significant bits
+
+        k_MAX_SIGNIFICANT_BITS     = 10, // maximum number of significant bits
+
+        k_DEFAULT_SIGNIFICANT_BITS = 5   // default number of significant bits
+    };
+
+    static const Int64 k_DEFAULT_MIN;  // minimum of an empty histogram
+    static const Int64 k_DEFAULT_MAX;  // maximum of an empty histogram
+
+  private:
+    // DATA
+    bsl::vector<Int64> d_buckets;          // count of values in each bucket
+    Int64              d_count;            // number of recorded values
+    Int64              d_total;            // total of recorded values
+    Int64              d_min;              // minimum recorded value
+    Int64              d_max;              // maximum recorded value
+    int                d_significantBits;  // number of significant bits
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Histogram, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int bucketIndex(Int64 value, int significantBits);
+        // Return the index of the bucket holding the specified 'value' in a
+        // histogram having the specified 'significantBits'.  If 'value' is
+        // negative, return 0.  The behavior is undefined unless
+        // 'significantBits' is in the range
+        // '[k_MIN_SIGNIFICANT_BITS .. k_MAX_SIGNIFICANT_BITS]'.
+
+    static Int64 bucketLowerBound(int index, int significantBits);
+        // Return the lowest value held by the bucket at the specified 'index'
+        // in a histogram having the specified 'significantBits'.  The behavior
+        // is undefined unless 'significantBits' is in the range
+        // '[k_MIN_SIGNIFICANT_BITS .. k_MAX_SIGNIFICANT_BITS]' and
+        // '0 <= index < numBuckets(significantBits)'.
+
+    static Int64 bucketUpperBound(int index, int significantBits);
+        // Return the highest value held by the bucket at the specified
+        // 'index' in a histogram having the specified 'significantBits'.  The
+        // behavior is undefined unless 'significantBits' is in the range
+        // '[k_MIN_SIGNIFICANT_BITS .. k_MAX_SIGNIFICANT_BITS]' and
+        // '0 <= index < numBuckets(significantBits)'.
+
+    static int numBuckets(int significantBits);
+        // Return the number of buckets of a histogram having the specified
+        // 'significantBits'.  The behavior is undefined unless
+        // 'significantBits' is in the range
+        // '[k_MIN_SIGNIFICANT_BITS .. k_MAX_SIGNIFICANT_BITS]'.
+
+    // CREATORS
+    explicit Histogram(bslma::Allocator *basicAllocator = 0);
+    explicit Histogram(int               significantBits,
+                       bslma::Allocator *basicAllocator = 0);
+        // Create an empty histogram having the optionally specified
+        // 'significantBits'.  If 'significantBits' is not specified,
+        // 'k_DEFAULT_SIGNIFICANT_BITS' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'significantBits' is in the range
+        // '[k_MIN_SIGNIFICANT_BITS .. k_MAX_SIGNIFICANT_BITS]'.
+
+    Histogram(const Histogram&  original,
+              bslma::Allocator *basicAllocator = 0);
+        // Create a histogram having the value of the specified 'original'
+        // histogram.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    // ~Histogram() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    Histogram& operator=(const Histogram& rhs);
+        // Assign to this histogram the value of the specified 'rhs'
+        // histogram, and return a reference providing modifiable access to
+        // this object.
+
+    void accumulateTotalMinMax(Int64 total, Int64 min, Int64 max);
+        // Add the specified 'total' to the total of this histogram, and set
+        // the minimum and maximum of this histogram to the lesser of its
+        // minimum and the specified 'min', and the greater of its maximum and
+        // the specified 'max', respectively, without modifying the buckets
+        // of this histogram.  Note that this method, together with
+        // 'addToBucket', is intended for mechanisms (such as
+        // 'HistogramCollector') that maintain their buckets and their total,
+        // minimum, and maximum separately.
+
+    void addToBucket(int index, Int64 count);
+        // Add the specified 'count' to the bucket at the specified 'index',
+        // and to the count of this histogram, without modifying the total,
+        // minimum, or maximum of this histogram.  The behavior is undefined
+        // unless '0 <= index < numBuckets()' and '0 <= count'.
+
+    void merge(const Histogram& other);
+        // Add the values recorded by the specified 'other' histogram to this
+        // histogram.  The behavior is undefined unless
+        // 'other.significantBits() == significantBits()'.
+
+    void record(Int64 value);
+        // Record the specified 'value' in this histogram.
+
+    void record(Int64 value, Int64 count);
+        // Record the specified 'value' the specified 'count' times in this
+        // histogram.  The behavior is undefined unless '0 <= count'.
+
+    void reset();
+        // Reset this histogram to the empty state, retaining its number of
+        // significant bits.
+
+    // ACCESSORS
+    Int64 bucketCount(int index) const;
+        // Return the number of values recorded in the bucket at the specified
+        // 'index'.  The behavior is undefined unless
+        // '0 <= index < numBuckets()'.
+
+    Int64 count() const;
+        // Return the number of values recorded in this histogram.
+
+    Int64 max() const;
+        // Return the maximum value recorded in this histogram, or
+        // 'k_DEFAULT_MAX' if this histogram is empty.
+
+    Int64 min() const;
+        // Return the minimum value recorded in this histogram, or
+        // 'k_DEFAULT_MIN' if this histogram is empty.
+
+    int numBuckets() const;
+        // Return the number of buckets of this histogram.
+
+    int significantBits() const;
+        // Return the number of significant bits of this histogram.
+
+    Int64 total() const;
+        // Return the total of the values recorded in this histogram.
+
+    Int64 valueAtQuantile(double quantile) const;
+        // Return an estimate of the value at the specified 'quantile' of the
+        // values recorded in this histogram (see "Quantiles" in the component
+        // documentation), or 0 if this histogram is empty.  The behavior is
+        // undefined unless '0 <= quantile <= 1'.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream) const;
+        // Write a description of this histogram, comprising its count,
+        // total, minimum, maximum, and estimated 50th, 90th, 99th, and 99.9th
+        // percentiles, to the specified 'stream', and return a reference to
+        // 'stream'.
+};
+
+// FREE OPERATORS
+bool operator==(const Histogram& lhs, const Histogram& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' histograms have the same
+    // value, and 'false' otherwise.  Two histograms have the same value if
+    // they have the same number of significant bits, the same bucket counts,
+    // and the same total, minimum, and maximum.
+
+bool operator!=(const Histogram& lhs, const Histogram& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' histograms do not have
+    // the same value, and 'false' otherwise.  Two histograms do not have the
+    // same value if they differ in their number of significant bits, any of
+    // their bucket counts, or their total, minimum, or maximum.
+
+bsl::ostream& operator<<(bsl::ostream& stream, const Histogram& histogram);
+    // Write a description of the specified 'histogram' to the specified
+    // 'stream', and return a reference to 'stream'.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class Histogram
+                              // ---------------
+
+// CLASS METHODS
+inline
+int Histogram::bucketIndex(Int64 value, int significantBits)
+{
+    BSLS_ASSERT(k_MIN_SIGNIFICANT_BITS <= significantBits);
+    BSLS_ASSERT(k_MAX_SIGNIFICANT_BITS >= significantBits);
+
+    if (value < 0) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::uint64_t v = static_cast<bsl::uint64_t>(value);
+
+    // Values less than '2 ^ (significantBits + 1)' have buckets of their
+    // own.
+
+    if (0 == (v >> (significantBits + 1))) {
+        return static_cast<int>(v);                                   // RETURN
+    }
+
+    // Otherwise, the bucket is identified by the position of the highest set
+    // bit of 'v' and the 'significantBits' bits that follow it.
+
+    const int exponent = 63 - bdlb::BitUtil::numLeadingUnsetBits(v);
+    const int shift    = exponent - significantBits;
+
+    return ((shift + 1) << significantBits)
+         + static_cast<int>(v >> shift)
+         - (1 << significantBits);
+}
+
+inline
+int Histogram::numBuckets(int significantBits)
+{
+    BSLS_ASSERT(k_MIN_SIGNIFICANT_BITS <= significantBits);
+    BSLS_ASSERT(k_MAX_SIGNIFICANT_BITS >= significantBits);
+
+    return (64 - significantBits) << significantBits;
+}
+
+// MANIPULATORS
+inline
+void Histogram::addToBucket(int index, Int64 count)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numBuckets());
+    BSLS_ASSERT(0 <= count);
+
+    d_buckets[index] += count;
+    d_count          += count;
+}
+
+inline
+void Histogram::record(Int64 value)
+{
+    record(value, 1);
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 Histogram::bucketCount(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numBuckets());
+
+    return d_buckets[index];
+}
+
+inline
+bsls::Types::Int64 Histogram::count() const
+{
+    return d_count;
+}
+
+inline
+bsls::Types::Int64 Histogram::max() const
+{
+    return d_max;
+}
+
+inline
+bsls::Types::Int64 Histogram::min() const
+{
+    return d_min;
+}
+
+inline
+int Histogram::numBuckets() const
+{
+    return static_cast<int>(d_buckets.size());
+}
+
+inline
+int Histogram::significantBits() const
+{
+    return d_significantBits;
+}
+
+inline
+bsls::Types::Int64 Histogram::total() const
+{
+    return d_total;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *Histogram::allocator() const
+{
+    return d_buckets.get_allocator().mechanism();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool balm::operator!=(const Histogram& lhs, const Histogram& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bsl::ostream& balm::operator<<(bsl::ostream&    stream,
+                               const Histogram& histogram)
+{
+    return histogram.print(stream);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,964 @@
+// balm_histogram.t.cpp                                               -*-C++-*-
+#include <balm_histogram.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic histogram whose buckets are
+// computed by a set of class methods.  We first verify, for every supported
+// number of significant bits, that the buckets partition the non-negative
+// 64-bit integers, that the width of each bucket is within the documented
+// relative error, and that 'bucketIndex' agrees with the bucket bounds.  We
+// then verify the value-semantic operations, the manipulators, and the
+// estimated quantiles against the exact quantiles of a set of pseudo-random
+// values.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int bucketIndex(Int64 value, int significantBits);
+// [ 2] Int64 bucketLowerBound(int index, int significantBits);
+// [ 2] Int64 bucketUpperBound(int index, int significantBits);
+// [ 2] int numBuckets(int significantBits);
+//
+// CREATORS
+// [ 3] Histogram(bslma::Allocator *basicAllocator = 0);
+// [ 3] Histogram(int significantBits, bslma::Allocator *basicAllocator = 0);
+// [ 3] Histogram(const Histogram& original, bslma::Allocator *ba = 0);
+//
+// MANIPULATORS
+// [ 3] Histogram& operator=(const Histogram& rhs);
+// [ 4] void accumulateTotalMinMax(Int64 total, Int64 min, Int64 max);
+// [ 4] void addToBucket(int index, Int64 count);
+// [ 4] void merge(const Histogram& other);
+// [ 4] void record(Int64 value);
+// [ 4] void record(Int64 value, Int64 count);
+// [ 4] void reset();
+//
+// ACCESSORS
+// [ 4] Int64 bucketCount(int index) const;
+// [ 4] Int64 count() const;
+// [ 4] Int64 max() const;
+// [ 4] Int64 min() const;
+// [ 3] int numBuckets() const;
+// [ 3] int significantBits() const;
+// [ 4] Int64 total() const;
+// [ 5] Int64 valueAtQuantile(double quantile) const;
+// [ 3] bslma::Allocator *allocator() const;
+// [ 3] bsl::ostream& print(bsl::ostream& stream) const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const Histogram& lhs, const Histogram& rhs);
+// [ 3] bool operator!=(const Histogram& lhs, const Histogram& rhs);
+// [ 3] bsl::ostream& operator<<(bsl::ostream&, const Histogram&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(expr) BSLS_ASSERTTEST_ASSERT_FAIL(expr)
+#define ASSERT_PASS(expr) BSLS_ASSERTTEST_ASSERT_PASS(expr)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::Histogram    Obj;
+typedef bsls::Types::Int64 Int64;
+
+const Int64 k_INT64_MAX = bsl::numeric_limits<Int64>::max();
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+Int64 nextValue(bsls::Types::Uint64 *seed)
+    // Return a pseudo-random, non-negative value having a log-uniform
+    // distribution below 2^40, and update the specified 'seed'.
+{
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+    const int exponent = static_cast<int>((*seed >> 58) % 40);
+
+    return static_cast<Int64>((*seed >> 16) & ((1ULL << exponent) - 1))
+         + (static_cast<Int64>(1) << exponent);
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Estimating Latency Percentiles
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we measure the latencies of the requests processed by a
+// service, and that we want to report their median and 99th percentile.
+//
+// First, we create a histogram having the default number of significant bits:
+//..
+    balm::Histogram histogram;
+    ASSERT(0 == histogram.count());
+//..
+// Then, we record the latencies, in microseconds, of 1000 requests, 990 of
+// which complete in about 100 microseconds, and 10 of which are much slower:
+//..
+    for (int i = 0; i < 990; ++i) {
+        histogram.record(95 + i % 10);
+    }
+    for (int i = 0; i < 10; ++i) {
+        histogram.record(20000 + i);
+    }
+    ASSERT(1000  == histogram.count());
+    ASSERT(95    == histogram.min());
+    ASSERT(20009 == histogram.max());
+//..
+// Next, we estimate the median and the 99th percentile of the latencies.  The
+// estimates are within 3% of the exact values:
+//..
+    const bsls::Types::Int64 median = histogram.valueAtQuantile(0.5);
+    const bsls::Types::Int64 p99    = histogram.valueAtQuantile(0.99);
+
+    ASSERT(99  <= median && median <= 102);
+    ASSERT(104 <= p99    && p99    <= 107);
+//..
+// Finally, we merge the histogram of a second interval, in which every request
+// was slow, and observe that the median of the combined intervals is now slow:
+//..
+    balm::Histogram slowInterval;
+    slowInterval.record(20000, 2000);
+
+    histogram.merge(slowInterval);
+    ASSERT(3000 == histogram.count());
+    ASSERT(19456 <= histogram.valueAtQuantile(0.5));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // QUANTILES
+        //
+        // Concerns:
+        //: 1 'valueAtQuantile' returns 0 for an empty histogram.
+        //:
+        //: 2 'valueAtQuantile(0)' returns the minimum, and
+        //:   'valueAtQuantile(1)' returns the maximum.
+        //:
+        //: 3 The estimated quantile is never less than the exact quantile, and
+        //:   exceeds it by a relative error of at most '2 ^ -B', where 'B' is
+        //:   the number of significant bits.
+        //:
+        //: 4 The estimated quantile is monotonic in the quantile.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the quantiles of an empty histogram, and of histograms
+        //:   holding a single value.  (C-1,2)
+        //:
+        //: 2 For each of several numbers of significant bits, record a set of
+        //:   pseudo-random values having a wide dynamic range, and compare the
+        //:   estimated quantiles with the exact quantiles computed from the
+        //:   sorted values.  (C-2..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   Int64 valueAtQuantile(double quantile) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "QUANTILES" << endl
+                          << "=========" << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        if (verbose) cout << "\nEmpty and single-valued histograms." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.valueAtQuantile(0));
+            ASSERT(0 == X.valueAtQuantile(0.5));
+            ASSERT(0 == X.valueAtQuantile(1));
+
+            const Int64 VALUES[] = { 0, 1, 63, 64, 65, 1000, 123456789,
+                                     k_INT64_MAX };
+            const int   NUM_VALUES = static_cast<int>(sizeof VALUES
+                                                      / sizeof *VALUES);
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.reset();
+                mX.record(VALUES[i]);
+
+                LOOP_ASSERT(i, VALUES[i] == X.valueAtQuantile(0));
+                LOOP_ASSERT(i, VALUES[i] == X.valueAtQuantile(0.5));
+                LOOP_ASSERT(i, VALUES[i] == X.valueAtQuantile(1));
+            }
+        }
+
+        if (verbose) cout << "\nCompare with exact quantiles." << endl;
+        {
+            const int    BITS[] = { 1, 3, 5, 7, 10 };
+            const int    NUM_BITS = static_cast<int>(sizeof BITS
+                                                     / sizeof *BITS);
+            const double QUANTILES[] = { 0.001, 0.1, 0.25, 0.5, 0.75, 0.9,
+                                         0.99, 0.999, 1.0 };
+            const int    NUM_QUANTILES = static_cast<int>(sizeof QUANTILES
+                                                        / sizeof *QUANTILES);
+
+            enum { k_NUM_VALUES = 10000 };
+
+            for (int bi = 0; bi < NUM_BITS; ++bi) {
+                const int B = BITS[bi];
+
+                bsls::Types::Uint64 seed = B;
+                bsl::vector<Int64>  values(&ta);
+                Obj                 mX(B, &ta);  const Obj& X = mX;
+
+                for (int i = 0; i < k_NUM_VALUES; ++i) {
+                    const Int64 value = nextValue(&seed);
+                    values.push_back(value);
+                    mX.record(value);
+                }
+                bsl::sort(values.begin(), values.end());
+
+                ASSERTV(B, values.front() == X.valueAtQuantile(0));
+                ASSERTV(B, values.back()  == X.valueAtQuantile(1));
+
+                Int64 previous = X.valueAtQuantile(0);
+                for (int qi = 0; qi < NUM_QUANTILES; ++qi) {
+                    const double Q     = QUANTILES[qi];
+                    const Int64  rank  = static_cast<Int64>(
+                                                bsl::ceil(Q * k_NUM_VALUES));
+                    const Int64  EXACT = values[static_cast<bsl::size_t>(
+                                                                   rank - 1)];
+                    const Int64  VALUE = X.valueAtQuantile(Q);
+
+                    if (veryVerbose) { P_(B) P_(Q) P_(EXACT) P(VALUE) }
+
+                    ASSERTV(B, Q, EXACT, VALUE, EXACT <= VALUE);
+                    ASSERTV(B, Q, EXACT, VALUE,
+                            VALUE - EXACT <= (EXACT >> B));
+                    ASSERTV(B, Q, previous, VALUE, previous <= VALUE);
+
+                    previous = VALUE;
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.record(5);
+
+            ASSERT_PASS(X.valueAtQuantile(0));
+            ASSERT_PASS(X.valueAtQuantile(1));
+            ASSERT_FAIL(X.valueAtQuantile(-0.1));
+            ASSERT_FAIL(X.valueAtQuantile(1.1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        //: 1 'record' increments the count of the bucket of the value, and
+        //:   maintains the exact count, total, minimum, and maximum.
+        //:
+        //: 2 'record' with a count of 0 has no effect.
+        //:
+        //: 3 Negative values are counted in the lowest bucket, and are
+        //:   reflected in the total and minimum.
+        //:
+        //: 4 'merge' produces the histogram of the union of the recorded
+        //:   values.
+        //:
+        //: 5 'addToBucket' and 'accumulateTotalMinMax' together reproduce the
+        //:   effect of 'record'.
+        //:
+        //: 6 'reset' restores the empty state, retaining the number of
+        //:   significant bits.
+        //:
+        //: 7 No manipulator allocates memory.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Record a sequence of values, and verify the attributes and the
+        //:   bucket counts after each call.  (C-1..3)
+        //:
+        //: 2 Record two sets of values into two histograms and both sets into
+        //:   a third; verify that merging the first two yields the third.
+        //:   (C-4)
+        //:
+        //: 3 Rebuild a histogram using 'addToBucket' and
+        //:   'accumulateTotalMinMax', and compare it with the original.
+        //:   (C-5)
+        //:
+        //: 4 Reset a histogram and compare it with a newly created one.  (C-6)
+        //:
+        //: 5 Use a test allocator to verify that no memory is allocated after
+        //:   construction.  (C-7)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   void accumulateTotalMinMax(Int64 total, Int64 min, Int64 max);
+        //   void addToBucket(int index, Int64 count);
+        //   void merge(const Histogram& other);
+        //   void record(Int64 value);
+        //   void record(Int64 value, Int64 count);
+        //   void reset();
+        //   Int64 bucketCount(int index) const;
+        //   Int64 count() const;
+        //   Int64 max() const;
+        //   Int64 min() const;
+        //   Int64 total() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        if (verbose) cout << "\nTesting 'record'." << endl;
+        {
+            static const struct {
+                int   d_line;
+                Int64 d_value;
+                Int64 d_count;
+                Int64 d_expMin;
+                Int64 d_expMax;
+            } DATA[] = {
+                //LINE        VALUE  COUNT       MIN        MAX
+                //----  -----------  -----  --------  ---------
+                { L_,           100,     1,      100,       100 },
+                { L_,            50,     2,       50,       100 },
+                { L_,          1000,     0,       50,       100 },
+                { L_,         10000,     3,       50,     10000 },
+                { L_,             0,     1,        0,     10000 },
+                { L_,            -7,     1,       -7,     10000 },
+                { L_,   1LL << 40,       1,       -7, 1LL << 40 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const bsls::Types::Int64 NUM_ALLOCS = ta.numAllocations();
+
+            Int64 expCount = 0;
+            Int64 expTotal = 0;
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE  = DATA[ti].d_line;
+                const Int64 VALUE = DATA[ti].d_value;
+                const Int64 COUNT = DATA[ti].d_count;
+                const Int64 MIN   = DATA[ti].d_expMin;
+                const Int64 MAX   = DATA[ti].d_expMax;
+
+                const int   INDEX  = Obj::bucketIndex(VALUE,
+                                                      X.significantBits());
+                const Int64 BUCKET = X.bucketCount(INDEX);
+
+                if (1 == COUNT) {
+                    mX.record(VALUE);
+                }
+                else {
+                    mX.record(VALUE, COUNT);
+                }
+                expCount += COUNT;
+                expTotal += VALUE * COUNT;
+
+                if (veryVerbose) { P_(LINE) P(X) }
+
+                LOOP_ASSERT(LINE, BUCKET + COUNT == X.bucketCount(INDEX));
+                LOOP_ASSERT(LINE, expCount       == X.count());
+                LOOP_ASSERT(LINE, expTotal       == X.total());
+                LOOP_ASSERT(LINE, MIN            == X.min());
+                LOOP_ASSERT(LINE, MAX            == X.max());
+            }
+            ASSERT(2 == X.bucketCount(0));
+            ASSERT(NUM_ALLOCS == ta.numAllocations());
+        }
+
+        if (verbose) cout << "\nTesting 'merge'." << endl;
+        {
+            Obj mX(3, &ta);  const Obj& X = mX;
+            Obj mY(3, &ta);  const Obj& Y = mY;
+            Obj mZ(3, &ta);  const Obj& Z = mZ;
+
+            bsls::Types::Uint64 seed = 17;
+            for (int i = 0; i < 1000; ++i) {
+                const Int64 value = nextValue(&seed);
+                (i % 3 ? mX : mY).record(value);
+                mZ.record(value);
+            }
+
+            const bsls::Types::Int64 NUM_ALLOCS = ta.numAllocations();
+
+            ASSERT(X != Z);
+            mX.merge(Y);
+            ASSERT(X == Z);
+            ASSERT(NUM_ALLOCS == ta.numAllocations());
+
+            // Merging an empty histogram has no effect.
+
+            const Obj EMPTY(3, &ta);
+            mX.merge(EMPTY);
+            ASSERT(X == Z);
+        }
+
+        if (verbose) cout << "\nTesting 'addToBucket' and "
+                             "'accumulateTotalMinMax'." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            Obj mY(&ta);  const Obj& Y = mY;
+
+            bsls::Types::Uint64 seed = 3;
+            for (int i = 0; i < 1000; ++i) {
+                mX.record(nextValue(&seed));
+            }
+
+            for (int i = 0; i < X.numBuckets(); ++i) {
+                if (X.bucketCount(i)) {
+                    mY.addToBucket(i, X.bucketCount(i));
+                }
+            }
+            ASSERT(X.count() == Y.count());
+            ASSERT(0         == Y.total());
+            ASSERT(X         != Y);
+
+            mY.accumulateTotalMinMax(X.total(), X.min(), X.max());
+            ASSERT(X == Y);
+
+            // Accumulating the attributes of an empty histogram has no
+            // effect.
+
+            mY.accumulateTotalMinMax(0, Obj::k_DEFAULT_MIN,
+                                     Obj::k_DEFAULT_MAX);
+            ASSERT(X == Y);
+        }
+
+        if (verbose) cout << "\nTesting 'reset'." << endl;
+        {
+            const Obj EMPTY(7, &ta);
+
+            Obj mX(7, &ta);  const Obj& X = mX;
+            mX.record(12345, 10);
+            ASSERT(EMPTY != X);
+
+            mX.reset();
+            ASSERT(EMPTY              == X);
+            ASSERT(0                  == X.count());
+            ASSERT(0                  == X.total());
+            ASSERT(Obj::k_DEFAULT_MIN == X.min());
+            ASSERT(Obj::k_DEFAULT_MAX == X.max());
+            ASSERT(7                  == X.significantBits());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj       mX(3, &ta);
+            const Obj Y(3, &ta);
+            const Obj Z(4, &ta);
+
+            ASSERT_PASS(mX.record(1, 0));
+            ASSERT_FAIL(mX.record(1, -1));
+
+            ASSERT_PASS(mX.addToBucket(0, 1));
+            ASSERT_PASS(mX.addToBucket(mX.numBuckets() - 1, 1));
+            ASSERT_FAIL(mX.addToBucket(-1, 1));
+            ASSERT_FAIL(mX.addToBucket(mX.numBuckets(), 1));
+            ASSERT_FAIL(mX.addToBucket(0, -1));
+
+            ASSERT_PASS(mX.merge(Y));
+            ASSERT_FAIL(mX.merge(Z));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // VALUE SEMANTICS
+        //
+        // Concerns:
+        //: 1 A default-constructed histogram is empty and has the default
+        //:   number of significant bits.
+        //:
+        //: 2 A histogram uses the supplied allocator, or the default
+        //:   allocator if none is supplied.
+        //:
+        //: 3 The copy constructor and the assignment operator produce a
+        //:   histogram having the value of the original, using the allocator
+        //:   of the target.
+        //:
+        //: 4 Two histograms compare equal if and only if they have the same
+        //:   number of significant bits, bucket counts, total, minimum, and
+        //:   maximum.
+        //:
+        //: 5 'print' and 'operator<<' describe the histogram.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create histograms with and without an allocator and a number of
+        //:   significant bits, and verify their attributes.  (C-1,2)
+        //:
+        //: 2 Copy and assign histograms, and verify the value and allocator
+        //:   of the result.  (C-3)
+        //:
+        //: 3 Compare histograms differing in each salient attribute.  (C-4)
+        //:
+        //: 4 Print an empty and a non-empty histogram to a string stream, and
+        //:   verify the output.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   Histogram(bslma::Allocator *basicAllocator = 0);
+        //   Histogram(int significantBits, bslma::Allocator *ba = 0);
+        //   Histogram(const Histogram& original, bslma::Allocator *ba = 0);
+        //   Histogram& operator=(const Histogram& rhs);
+        //   int numBuckets() const;
+        //   int significantBits() const;
+        //   bslma::Allocator *allocator() const;
+        //   bsl::ostream& print(bsl::ostream& stream) const;
+        //   bool operator==(const Histogram& lhs, const Histogram& rhs);
+        //   bool operator!=(const Histogram& lhs, const Histogram& rhs);
+        //   bsl::ostream& operator<<(bsl::ostream&, const Histogram&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE SEMANTICS" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        if (verbose) cout << "\nTesting creators." << endl;
+        {
+            const Obj X;
+            ASSERT(Obj::k_DEFAULT_SIGNIFICANT_BITS == X.significantBits());
+            ASSERT(Obj::numBuckets(Obj::k_DEFAULT_SIGNIFICANT_BITS)
+                                                          == X.numBuckets());
+            ASSERT(0                  == X.count());
+            ASSERT(0                  == X.total());
+            ASSERT(Obj::k_DEFAULT_MIN == X.min());
+            ASSERT(Obj::k_DEFAULT_MAX == X.max());
+            ASSERT(&defaultAllocator  == X.allocator());
+            ASSERT(0                  <  defaultAllocator.numBlocksInUse());
+
+            const bsls::Types::Int64 NUM_BLOCKS =
+                                             defaultAllocator.numBlocksInUse();
+
+            const Obj Y(3, &ta);
+            ASSERT(3                    == Y.significantBits());
+            ASSERT(Obj::numBuckets(3)   == Y.numBuckets());
+            ASSERT(&ta                  == Y.allocator());
+            ASSERT(0                    <  ta.numBlocksInUse());
+            ASSERT(NUM_BLOCKS == defaultAllocator.numBlocksInUse());
+
+            for (int i = 0; i < Y.numBuckets(); ++i) {
+                LOOP_ASSERT(i, 0 == Y.bucketCount(i));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting copy and assignment." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVerbose);
+
+            Obj mX(4, &ta);  const Obj& X = mX;
+            mX.record(10);
+            mX.record(1000, 5);
+
+            const Obj Y(X, &sa);
+            ASSERT(X   == Y);
+            ASSERT(&sa == Y.allocator());
+
+            Obj mZ(&sa);  const Obj& Z = mZ;
+            ASSERT(X != Z);
+
+            mZ = X;
+            ASSERT(X   == Z);
+            ASSERT(4   == Z.significantBits());
+            ASSERT(&sa == Z.allocator());
+
+            // Self-assignment.
+
+            mZ = Z;
+            ASSERT(X == Z);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting equality." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            Obj mY(&ta);  const Obj& Y = mY;
+
+            ASSERT(  X == Y);
+            ASSERT(!(X != Y));
+
+            // Different number of significant bits.
+
+            const Obj Z(4, &ta);
+            ASSERT(!(X == Z));
+            ASSERT(  X != Z);
+
+            // Different buckets, same total, minimum, and maximum.
+
+            mX.record(1);
+            mX.record(5);
+            mY.record(2);
+            mY.record(4);
+            mY.accumulateTotalMinMax(0, 1, 5);
+            ASSERT(X.total() == Y.total());
+            ASSERT(X.min()   == Y.min());
+            ASSERT(X.max()   == Y.max());
+            ASSERT(X != Y);
+
+            // Same buckets, different total.
+
+            mX.reset();
+            mY.reset();
+            mX.record(1000);
+            mY.record(1001);
+            ASSERT(Obj::bucketIndex(1000, 5) == Obj::bucketIndex(1001, 5));
+            ASSERT(X != Y);
+
+            mY.reset();
+            mY.record(1000);
+            ASSERT(X == Y);
+        }
+
+        if (verbose) cout << "\nTesting 'print' and 'operator<<'." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsl::ostringstream os;
+            os << X;
+            ASSERTV(os.str(), "[ count = 0 total = 0 ]" == os.str());
+
+            mX.record(10);
+            mX.record(20);
+
+            os.str("");
+            X.print(os);
+            ASSERTV(os.str(),
+                    "[ count = 2 total = 30 min = 10 max = 20 p50 = 10 "
+                    "p90 = 20 p99 = 20 p99.9 = 20 ]" == os.str());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(Obj::k_MIN_SIGNIFICANT_BITS, &ta));
+            ASSERT_PASS(Obj(Obj::k_MAX_SIGNIFICANT_BITS, &ta));
+            ASSERT_FAIL(Obj(Obj::k_MIN_SIGNIFICANT_BITS - 1, &ta));
+            ASSERT_FAIL(Obj(Obj::k_MAX_SIGNIFICANT_BITS + 1, &ta));
+
+            const Obj X(&ta);
+            ASSERT_PASS(X.bucketCount(0));
+            ASSERT_FAIL(X.bucketCount(-1));
+            ASSERT_FAIL(X.bucketCount(X.numBuckets()));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BUCKET LAYOUT
+        //
+        // Concerns:
+        //: 1 The buckets are contiguous and cover the non-negative 64-bit
+        //:   integers: the first bucket holds 0, each bucket starts after the
+        //:   previous one ends, and the last bucket ends at the maximum
+        //:   'Int64' value.
+        //:
+        //: 2 Values less than '2 ^ (B + 1)' have buckets of their own, where
+        //:   'B' is the number of significant bits.
+        //:
+        //: 3 The width of each bucket is at most '2 ^ -B' times its lower
+        //:   bound.
+        //:
+        //: 4 'bucketIndex' maps every value of a bucket, and no other value,
+        //:   to the index of that bucket, and maps negative values to 0.
+        //:
+        //: 5 'numBuckets' returns '(64 - B) * 2 ^ B'.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For every supported number of significant bits, iterate over the
+        //:   buckets, and verify the bounds of each bucket against those of
+        //:   its predecessor, and 'bucketIndex' at the bounds and around
+        //:   them.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int bucketIndex(Int64 value, int significantBits);
+        //   Int64 bucketLowerBound(int index, int significantBits);
+        //   Int64 bucketUpperBound(int index, int significantBits);
+        //   int numBuckets(int significantBits);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BUCKET LAYOUT" << endl
+                          << "=============" << endl;
+
+        for (int B  = Obj::k_MIN_SIGNIFICANT_BITS;
+                 B <= Obj::k_MAX_SIGNIFICANT_BITS;
+               ++B) {
+            const int NUM_BUCKETS = Obj::numBuckets(B);
+
+            if (veryVerbose) { P_(B) P(NUM_BUCKETS) }
+
+            ASSERTV(B, NUM_BUCKETS, (64 - B) * (1 << B) == NUM_BUCKETS);
+
+            ASSERTV(B, 0 == Obj::bucketLowerBound(0, B));
+            ASSERTV(B, 0 == Obj::bucketIndex(-1, B));
+            ASSERTV(B, 0 == Obj::bucketIndex(bsl::numeric_limits<Int64>::min(),
+                                             B));
+            ASSERTV(B, NUM_BUCKETS - 1 == Obj::bucketIndex(k_INT64_MAX, B));
+            ASSERTV(B, k_INT64_MAX ==
+                                   Obj::bucketUpperBound(NUM_BUCKETS - 1, B));
+
+            Int64 previousUpper = -1;
+            for (int i = 0; i < NUM_BUCKETS; ++i) {
+                const Int64 LOWER = Obj::bucketLowerBound(i, B);
+                const Int64 UPPER = Obj::bucketUpperBound(i, B);
+
+                ASSERTV(B, i, LOWER, previousUpper,
+                        previousUpper + 1 == LOWER);
+                ASSERTV(B, i, LOWER, UPPER, LOWER <= UPPER);
+                ASSERTV(B, i, LOWER, UPPER, (UPPER - LOWER) <= (LOWER >> B));
+
+                if (i < 2 * (1 << B)) {
+                    ASSERTV(B, i, LOWER, UPPER, i == LOWER && i == UPPER);
+                }
+
+                ASSERTV(B, i, i == Obj::bucketIndex(LOWER, B));
+                ASSERTV(B, i, i == Obj::bucketIndex(UPPER, B));
+                const Int64 MIDDLE = LOWER + (UPPER - LOWER) / 2;
+                ASSERTV(B, i, i == Obj::bucketIndex(MIDDLE, B));
+                if (0 < i) {
+                    ASSERTV(B, i, i - 1 == Obj::bucketIndex(LOWER - 1, B));
+                }
+                if (i < NUM_BUCKETS - 1) {
+                    ASSERTV(B, i, i + 1 == Obj::bucketIndex(UPPER + 1, B));
+                }
+
+                previousUpper = UPPER;
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const int MIN = Obj::k_MIN_SIGNIFICANT_BITS;
+            const int MAX = Obj::k_MAX_SIGNIFICANT_BITS;
+
+            ASSERT_PASS(Obj::numBuckets(MIN));
+            ASSERT_PASS(Obj::numBuckets(MAX));
+            ASSERT_FAIL(Obj::numBuckets(MIN - 1));
+            ASSERT_FAIL(Obj::numBuckets(MAX + 1));
+
+            ASSERT_PASS(Obj::bucketIndex(0, MIN));
+            ASSERT_FAIL(Obj::bucketIndex(0, MIN - 1));
+            ASSERT_FAIL(Obj::bucketIndex(0, MAX + 1));
+
+            ASSERT_PASS(Obj::bucketLowerBound(0, MIN));
+            ASSERT_PASS(Obj::bucketLowerBound(Obj::numBuckets(MIN) - 1, MIN));
+            ASSERT_FAIL(Obj::bucketLowerBound(-1, MIN));
+            ASSERT_FAIL(Obj::bucketLowerBound(Obj::numBuckets(MIN), MIN));
+
+            ASSERT_PASS(Obj::bucketUpperBound(0, MIN));
+            ASSERT_PASS(Obj::bucketUpperBound(Obj::numBuckets(MIN) - 1, MIN));
+            ASSERT_FAIL(Obj::bucketUpperBound(-1, MIN));
+            ASSERT_FAIL(Obj::bucketUpperBound(Obj::numBuckets(MIN), MIN));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a histogram, record, merge, and reset values, and verify
+        //:   the attributes of the histogram.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+        ASSERT(0 == X.count());
+
+        mX.record(3);
+        mX.record(300);
+        mX.record(3000);
+        ASSERT(3    == X.count());
+        ASSERT(3303 == X.total());
+        ASSERT(3    == X.min());
+        ASSERT(3000 == X.max());
+        ASSERT(3    == X.valueAtQuantile(0.3));
+        ASSERT(3000 == X.valueAtQuantile(1));
+
+        Obj mY(X, &ta);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.merge(X);
+        ASSERT(6    == Y.count());
+        ASSERT(6606 == Y.total());
+        ASSERT(X    != Y);
+
+        mY.reset();
+        ASSERT(0 == Y.count());
+        ASSERT(X != Y);
+
+        if (veryVerbose) { P(X) }
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
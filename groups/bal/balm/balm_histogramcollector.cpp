@@ -0,0 +1,131 @@
+// balm_histogramcollector.cpp                                        -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramcollector_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+
+#include <new>          // placement 'new'
+
+namespace BloombergLP {
+namespace balm {
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// CREATORS
+HistogramCollector::HistogramCollector(const MetricId&   metricId,
+                                       bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_buckets_p(0)
+, d_total(0)
+, d_min(Histogram::k_DEFAULT_MIN)
+, d_max(Histogram::k_DEFAULT_MAX)
+, d_significantBits(Histogram::k_DEFAULT_SIGNIFICANT_BITS)
+, d_numBuckets(Histogram::numBuckets(Histogram::k_DEFAULT_SIGNIFICANT_BITS))
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_buckets_p = static_cast<bsls::AtomicInt64 *>(
+            d_allocator_p->allocate(d_numBuckets * sizeof(bsls::AtomicInt64)));
+
+    for (int i = 0; i < d_numBuckets; ++i) {
+        new (d_buckets_p + i) bsls::AtomicInt64(0);
+    }
+}
+
+HistogramCollector::HistogramCollector(const MetricId&   metricId,
+                                       int               significantBits,
+                                       bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_buckets_p(0)
+, d_total(0)
+, d_min(Histogram::k_DEFAULT_MIN)
+, d_max(Histogram::k_DEFAULT_MAX)
+, d_significantBits(significantBits)
+, d_numBuckets(Histogram::numBuckets(significantBits))
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_buckets_p = static_cast<bsls::AtomicInt64 *>(
+            d_allocator_p->allocate(d_numBuckets * sizeof(bsls::AtomicInt64)));
+
+    for (int i = 0; i < d_numBuckets; ++i) {
+        new (d_buckets_p + i) bsls::AtomicInt64(0);
+    }
+}
+
+HistogramCollector::~HistogramCollector()
+{
+    // 'bsls::AtomicInt64' is trivially destructible.
+
+    d_allocator_p->deallocate(d_buckets_p);
+}
+
+// MANIPULATORS
+void HistogramCollector::loadAndReset(Histogram *histogram)
+{
+    BSLS_ASSERT(histogram);
+    BSLS_ASSERT(histogram->significantBits() == d_significantBits);
+
+    histogram->reset();
+    for (int i = 0; i < d_numBuckets; ++i) {
+        const bsls::Types::Int64 count = d_buckets_p[i].swapAcqRel(0);
+        if (count) {
+            histogram->addToBucket(i, count);
+        }
+    }
+    histogram->accumulateTotalMinMax(
+                                d_total.swapAcqRel(0),
+                                d_min.swapAcqRel(Histogram::k_DEFAULT_MIN),
+                                d_max.swapAcqRel(Histogram::k_DEFAULT_MAX));
+}
+
+void HistogramCollector::reset()
+{
+    for (int i = 0; i < d_numBuckets; ++i) {
+        d_buckets_p[i].storeRelease(0);
+    }
+    d_total.storeRelease(0);
+    d_min.storeRelease(Histogram::k_DEFAULT_MIN);
+    d_max.storeRelease(Histogram::k_DEFAULT_MAX);
+}
+
+// ACCESSORS
+void HistogramCollector::load(Histogram *histogram) const
+{
+    BSLS_ASSERT(histogram);
+    BSLS_ASSERT(histogram->significantBits() == d_significantBits);
+
+    histogram->reset();
+    for (int i = 0; i < d_numBuckets; ++i) {
+        const bsls::Types::Int64 count = d_buckets_p[i].loadAcquire();
+        if (count) {
+            histogram->addToBucket(i, count);
+        }
+    }
+    histogram->accumulateTotalMinMax(d_total.loadAcquire(),
+                                     d_min.loadAcquire(),
+                                     d_max.loadAcquire());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
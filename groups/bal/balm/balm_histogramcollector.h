@@ -0,0 +1,246 @@
+// balm_histogramcollector.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#define INCLUDED_BALM_HISTOGRAMCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free container for collecting a histogram of values.
+//
+//@CLASSES:
+//   balm::HistogramCollector: lock-free collector of a histogram of values
+//
+//@SEE_ALSO: balm_histogram, balm_collectorrepository, balm_metrics
+//
+//@DESCRIPTION: This component provides a class, 'balm::HistogramCollector',
+// that collects the distribution of the integer values of a metric (e.g.,
+// latencies measured in microseconds) from any number of threads, so that
+// quantiles of those values (e.g., the 99th percentile) can be published.  A
+// histogram collector holds the buckets of a 'balm::Histogram' (see
+// 'balm_histogram') as an array of atomic counters, together with the atomic
+// total, minimum, and maximum of the collected values.  The 'update' method
+// records a value by incrementing the counter of its bucket and the total,
+// and, only if the value is a new extreme, updating the minimum or maximum
+// with a compare-and-swap loop: 'update' acquires no lock and never allocates
+// memory.  The 'load' and 'loadAndReset' methods load the collected values
+// into a 'balm::Histogram'.
+//
+// A histogram collector is typically obtained from a
+// 'balm::CollectorRepository' (e.g., using the 'BALM_METRICS_HISTOGRAM_UPDATE'
+// macro of 'balm_metrics'), which publishes, for each metric having a
+// histogram collector, the count, total, minimum, and maximum of the collected
+// values, and their estimated quantiles (see 'balm_collectorrepository').
+//
+///Thread Safety
+///-------------
+// 'balm::HistogramCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.  Note, however, that 'load' and
+// 'loadAndReset' are not atomic with respect to concurrent calls to 'update':
+// a value recorded concurrently with 'loadAndReset' is accounted either in
+// the loaded histogram or in the collector after the reset, but its bucket
+// count, total, minimum, and maximum may be split between the two.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting Request Latencies
+///- - - - - - - - - - - - - - - - - - - -
+// In the following example we collect the latencies of requests, and load
+// their distribution into a 'balm::Histogram'.
+//
+// First, we create a 'balm::MetricId' by hand; in practice, an id should be
+// obtained from a 'balm::MetricRegistry' object (such as the one owned by a
+// 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "RequestLatency");
+//  balm::MetricId           latencyId(&description);
+//..
+// Then, we create a histogram collector for the metric, and record the
+// latencies (in microseconds) of a few requests.  Note that 'update' may be
+// called concurrently from any number of threads:
+//..
+//  balm::HistogramCollector collector(latencyId);
+//
+//  collector.update(120);
+//  collector.update(95);
+//  collector.update(4000);
+//..
+// Finally, we load the collected latencies into a histogram, and reset the
+// collector:
+//..
+//  balm::Histogram histogram(collector.significantBits());
+//  collector.loadAndReset(&histogram);
+//
+//  assert(3    == histogram.count());
+//  assert(4215 == histogram.total());
+//  assert(95   == histogram.min());
+//  assert(4000 == histogram.max());
+//  assert(120  <= histogram.valueAtQuantile(0.5));
+//  assert(123  >= histogram.valueAtQuantile(0.5));
+//
+//  collector.load(&histogram);
+//  assert(0 == histogram.count());
+//..
+
+#include <balscm_version.h>
+
+#include <balm_histogram.h>
+#include <balm_metricid.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                          // ========================
+                          // class HistogramCollector
+                          // ========================
+
+class HistogramCollector {
+    // This class provides a mechanism, lock-free on update, for collecting the
+    // distribution of the values of a metric into the buckets of a
+    // 'Histogram', together with their total, minimum, and maximum.
+
+    // DATA
+    MetricId           d_metricId;         // metric identifier
+    bsls::AtomicInt64 *d_buckets_p;        // bucket counters (owned)
+    bsls::AtomicInt64  d_total;            // total of values
+    bsls::AtomicInt64  d_min;              // minimum value
+    bsls::AtomicInt64  d_max;              // maximum value
+    int                d_significantBits;  // significant bits of buckets
+    int                d_numBuckets;       // number of buckets
+    bslma::Allocator  *d_allocator_p;      // allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    HistogramCollector(const HistogramCollector&);
+    HistogramCollector& operator=(const HistogramCollector&);
+
+  public:
+    // CREATORS
+    explicit HistogramCollector(const MetricId&   metricId,
+                                bslma::Allocator *basicAllocator = 0);
+    HistogramCollector(const MetricId&   metricId,
+                       int               significantBits,
+                       bslma::Allocator *basicAllocator = 0);
+        // Create a histogram collector for the metric having the specified
+        // 'metricId', whose buckets have the optionally specified
+        // 'significantBits' (see 'balm_histogram'), and having no collected
+        // values.  If 'significantBits' is not specified,
+        // 'Histogram::k_DEFAULT_SIGNIFICANT_BITS' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'significantBits' is in the
+        // range supported by 'Histogram'.
+
+    ~HistogramCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void loadAndReset(Histogram *histogram);
+        // Load into the specified 'histogram' the values collected by this
+        // object, and reset this object to its default state (having no
+        // collected values).  The behavior is undefined unless
+        // 'histogram->significantBits() == significantBits()'.
+
+    void reset();
+        // Reset this object to its default state (having no collected
+        // values).
+
+    void update(bsls::Types::Int64 value);
+        // Record the specified 'value' in this collector.
+
+    // ACCESSORS
+    void load(Histogram *histogram) const;
+        // Load into the specified 'histogram' the values collected by this
+        // object.  The behavior is undefined unless
+        // 'histogram->significantBits() == significantBits()'.
+
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable metric identifier for this
+        // collector.
+
+    int significantBits() const;
+        // Return the number of significant bits of the buckets of this
+        // collector.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// MANIPULATORS
+inline
+void HistogramCollector::update(bsls::Types::Int64 value)
+{
+    const int index = Histogram::bucketIndex(value, d_significantBits);
+
+    d_buckets_p[index].addRelaxed(1);
+    d_total.addRelaxed(value);
+
+    // Update the minimum and maximum only if 'value' is a new extreme, which
+    // is rare once the collector holds a few values.
+
+    bsls::Types::Int64 current = d_min.loadRelaxed();
+    while (value < current) {
+        const bsls::Types::Int64 previous =
+                                       d_min.testAndSwapAcqRel(current, value);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+
+    current = d_max.loadRelaxed();
+    while (current < value) {
+        const bsls::Types::Int64 previous =
+                                       d_max.testAndSwapAcqRel(current, value);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+}
+
+// ACCESSORS
+inline
+const MetricId& HistogramCollector::metricId() const
+{
+    return d_metricId;
+}
+
+inline
+int HistogramCollector::significantBits() const
+{
+    return d_significantBits;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,599 @@
+// balm_histogramcollector.t.cpp                                      -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <balm_category.h>
+#include <balm_metricdescription.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism that records values into the
+// buckets of a 'balm::Histogram' using atomic counters.  We verify that the
+// histogram loaded from a collector is the histogram of the updated values,
+// that 'loadAndReset' and 'reset' restore the default state, and that
+// concurrent updates, with or without a concurrent 'loadAndReset', are not
+// lost.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] HistogramCollector(const MetricId&, bslma::Allocator * = 0);
+// [ 2] HistogramCollector(const MetricId&, int, bslma::Allocator * = 0);
+// [ 2] ~HistogramCollector();
+//
+// MANIPULATORS
+// [ 3] void loadAndReset(Histogram *histogram);
+// [ 3] void reset();
+// [ 3] void update(bsls::Types::Int64 value);
+//
+// ACCESSORS
+// [ 3] void load(Histogram *histogram) const;
+// [ 2] const MetricId& metricId() const;
+// [ 2] int significantBits() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENCY TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(expr) BSLS_ASSERTTEST_ASSERT_FAIL(expr)
+#define ASSERT_PASS(expr) BSLS_ASSERTTEST_ASSERT_PASS(expr)
+#define ASSERT_FAIL_RAW(expr) BSLS_ASSERTTEST_ASSERT_FAIL_RAW(expr)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramCollector Obj;
+typedef balm::Histogram          Hist;
+typedef bsls::Types::Int64       Int64;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+void updateJob(Obj            *collector,
+               bslmt::Barrier *barrier,
+               int             threadIndex,
+               int             numIterations)
+    // Wait on the specified 'barrier', then update the specified 'collector'
+    // the specified 'numIterations' times with values determined by the
+    // specified 'threadIndex': the 'i'th update records
+    // '(threadIndex + 1) * (i % 1000)'.
+{
+    barrier->wait();
+    for (int i = 0; i < numIterations; ++i) {
+        collector->update((threadIndex + 1) * (i % 1000));
+    }
+}
+
+void loadAndResetJob(Obj             *collector,
+                     bslmt::Barrier  *barrier,
+                     bsls::AtomicInt *done,
+                     Hist            *result)
+    // Wait on the specified 'barrier', then repeatedly load and reset the
+    // specified 'collector', merging the loaded histograms into the
+    // specified 'result', until the specified 'done' flag is set.
+{
+    Hist loaded(collector->significantBits());
+
+    barrier->wait();
+    while (!done->loadAcquire()) {
+        collector->loadAndReset(&loaded);
+        result->merge(loaded);
+    }
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    balm::Category          CATEGORY("A", true);
+    balm::MetricDescription DESCRIPTION(&CATEGORY, "Latency");
+    const balm::MetricId    METRIC(&DESCRIPTION);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting Request Latencies
+///- - - - - - - - - - - - - - - - - - - -
+// In the following example we collect the latencies of requests, and load
+// their distribution into a 'balm::Histogram'.
+//
+// First, we create a 'balm::MetricId' by hand; in practice, an id should be
+// obtained from a 'balm::MetricRegistry' object (such as the one owned by a
+// 'balm::MetricsManager'):
+//..
+    balm::Category           myCategory("MyCategory");
+    balm::MetricDescription  description(&myCategory, "RequestLatency");
+    balm::MetricId           latencyId(&description);
+//..
+// Then, we create a histogram collector for the metric, and record the
+// latencies (in microseconds) of a few requests.  Note that 'update' may be
+// called concurrently from any number of threads:
+//..
+    balm::HistogramCollector collector(latencyId);
+
+    collector.update(120);
+    collector.update(95);
+    collector.update(4000);
+//..
+// Finally, we load the collected latencies into a histogram, and reset the
+// collector:
+//..
+    balm::Histogram histogram(collector.significantBits());
+    collector.loadAndReset(&histogram);
+
+    ASSERT(3    == histogram.count());
+    ASSERT(4215 == histogram.total());
+    ASSERT(95   == histogram.min());
+    ASSERT(4000 == histogram.max());
+    ASSERT(120  <= histogram.valueAtQuantile(0.5));
+    ASSERT(123  >= histogram.valueAtQuantile(0.5));
+
+    collector.load(&histogram);
+    ASSERT(0 == histogram.count());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Concurrent updates of a collector are not lost, whether or not
+        //:   the collector is concurrently loaded and reset.
+        //:
+        //: 2 The minimum and maximum of a collector reflect every concurrent
+        //:   update.
+        //
+        // Plan:
+        //: 1 Update a collector from several threads, and update a reference
+        //:   histogram with the same values from the main thread; verify that
+        //:   the histogram loaded from the collector equals the reference.
+        //:   (C-1,2)
+        //:
+        //: 2 Repeat P-1 while another thread repeatedly loads and resets the
+        //:   collector, and verify that the merge of the loaded histograms
+        //:   and of the final state of the collector equals the reference.
+        //:   (C-1,2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        const int k_NUM_THREADS    = 8;
+        const int k_NUM_ITERATIONS = 20000;
+
+        Hist expected(&ta);
+        for (int t = 0; t < k_NUM_THREADS; ++t) {
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                expected.record((t + 1) * (i % 1000));
+            }
+        }
+
+        for (int withLoader = 0; withLoader < 2; ++withLoader) {
+            if (verbose) { P(withLoader); }
+
+            Obj mX(METRIC, &ta);
+
+            const int       numParties = k_NUM_THREADS + withLoader;
+            bslmt::Barrier  barrier(numParties);
+            bsls::AtomicInt done(0);
+            Hist            loaded(&ta);
+
+            bslmt::ThreadGroup updaters(&ta);
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                ASSERT(0 == updaters.addThread(
+                                     bdlf::BindUtil::bind(&updateJob,
+                                                          &mX,
+                                                          &barrier,
+                                                          t,
+                                                          k_NUM_ITERATIONS)));
+            }
+
+            bslmt::ThreadGroup loader(&ta);
+            if (withLoader) {
+                ASSERT(0 == loader.addThread(
+                                       bdlf::BindUtil::bind(&loadAndResetJob,
+                                                            &mX,
+                                                            &barrier,
+                                                            &done,
+                                                            &loaded)));
+            }
+
+            updaters.joinAll();
+            done.storeRelease(1);
+            loader.joinAll();
+
+            Hist remaining(&ta);
+            mX.loadAndReset(&remaining);
+            loaded.merge(remaining);
+
+            if (veryVerbose) { P_(expected) P(loaded) }
+
+            ASSERTV(withLoader, expected.count(), loaded.count(),
+                    expected.count() == loaded.count());
+            ASSERTV(withLoader, expected.total(), loaded.total(),
+                    expected.total() == loaded.total());
+            ASSERTV(withLoader, expected.min(), loaded.min(),
+                    expected.min() == loaded.min());
+            ASSERTV(withLoader, expected.max(), loaded.max(),
+                    expected.max() == loaded.max());
+            ASSERTV(withLoader, expected == loaded);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND 'load'
+        //
+        // Concerns:
+        //: 1 The histogram loaded from a collector is the histogram of the
+        //:   values with which the collector was updated.
+        //:
+        //: 2 'load' does not modify the collector, and replaces the value of
+        //:   the supplied histogram.
+        //:
+        //: 3 'loadAndReset' and 'reset' restore the default state.
+        //:
+        //: 4 'update' does not allocate memory.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each of several numbers of significant bits, update a
+        //:   collector and a reference histogram with the same values, and
+        //:   compare the histogram loaded from the collector with the
+        //:   reference after each update.  (C-1,2)
+        //:
+        //: 2 Call 'loadAndReset' and 'reset', and verify that the collector
+        //:   subsequently loads an empty histogram.  (C-3)
+        //:
+        //: 3 Use a test allocator to verify that 'update' does not allocate.
+        //:   (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void loadAndReset(Histogram *histogram);
+        //   void reset();
+        //   void update(bsls::Types::Int64 value);
+        //   void load(Histogram *histogram) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS AND 'load'" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        const Int64 VALUES[] = { 100, 0, 5, 1000000, 99, -3, 1LL << 50, 7 };
+        const int   NUM_VALUES = static_cast<int>(sizeof VALUES
+                                                  / sizeof *VALUES);
+
+        const int BITS[]   = { 1, 5, 10 };
+        const int NUM_BITS = static_cast<int>(sizeof BITS / sizeof *BITS);
+
+        for (int bi = 0; bi < NUM_BITS; ++bi) {
+            const int B = BITS[bi];
+
+            Obj mX(METRIC, B, &ta);  const Obj& X = mX;
+
+            Hist expected(B, &ta);
+            Hist result(B, &ta);
+
+            const bsls::Types::Int64 NUM_ALLOCS = ta.numAllocations();
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.update(VALUES[i]);
+                expected.record(VALUES[i]);
+
+                result.record(1);  // 'load' replaces this value
+                X.load(&result);
+
+                if (veryVerbose) { P_(B) P(result) }
+
+                ASSERTV(B, i, expected == result);
+
+                X.load(&result);
+                ASSERTV(B, i, expected == result);
+            }
+            ASSERTV(B, NUM_ALLOCS == ta.numAllocations());
+
+            mX.loadAndReset(&result);
+            ASSERTV(B, expected == result);
+
+            X.load(&result);
+            ASSERTV(B, Hist(B, &ta) == result);
+
+            mX.update(42);
+            X.load(&result);
+            ASSERTV(B, 1 == result.count());
+
+            mX.reset();
+            X.load(&result);
+            ASSERTV(B, Hist(B, &ta) == result);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj  mX(METRIC, 4, &ta);
+            Hist good(4, &ta);
+            Hist bad(5, &ta);
+
+            ASSERT_PASS(mX.load(&good));
+            ASSERT_FAIL(mX.load(&bad));
+            ASSERT_FAIL(mX.load(0));
+
+            ASSERT_PASS(mX.loadAndReset(&good));
+            ASSERT_FAIL(mX.loadAndReset(&bad));
+            ASSERT_FAIL(mX.loadAndReset(0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A collector holds the supplied metric id and number of
+        //:   significant bits, defaulting to
+        //:   'Histogram::k_DEFAULT_SIGNIFICANT_BITS'.
+        //:
+        //: 2 A collector allocates its buckets from the supplied allocator,
+        //:   or from the default allocator if none is supplied, and releases
+        //:   them on destruction.
+        //:
+        //: 3 A newly created collector has no collected values.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create collectors with and without the optional arguments, and
+        //:   verify their attributes, the histogram they load, and the
+        //:   memory allocated from test allocators.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   HistogramCollector(const MetricId&, bslma::Allocator * = 0);
+        //   HistogramCollector(const MetricId&, int, bslma::Allocator * = 0);
+        //   ~HistogramCollector();
+        //   const MetricId& metricId() const;
+        //   int significantBits() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        bslma::TestAllocator da("default", veryVerbose);
+
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        {
+            const Obj X(METRIC);
+
+            ASSERT(METRIC == X.metricId());
+            ASSERT(Hist::k_DEFAULT_SIGNIFICANT_BITS == X.significantBits());
+            ASSERT(0 < da.numBlocksInUse());
+
+            Hist result(&ta);
+            X.load(&result);
+            ASSERT(Hist(&ta) == result);
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        {
+            const Obj X(METRIC, 3, &ta);
+
+            ASSERT(METRIC == X.metricId());
+            ASSERT(3      == X.significantBits());
+            ASSERT(1      == ta.numBlocksInUse());
+            ASSERT(0      == da.numBlocksInUse());
+
+            Hist result(3, &ta);
+            X.load(&result);
+            ASSERT(Hist(3, &ta) == result);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            const balm::MetricId EMPTY;
+            const Obj            X(EMPTY, &ta);
+
+            ASSERT(EMPTY == X.metricId());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(METRIC, Hist::k_MIN_SIGNIFICANT_BITS, &ta));
+            ASSERT_PASS(Obj(METRIC, Hist::k_MAX_SIGNIFICANT_BITS, &ta));
+
+            // The number of significant bits is checked by 'balm_histogram'.
+
+            const int MIN = Hist::k_MIN_SIGNIFICANT_BITS;
+            const int MAX = Hist::k_MAX_SIGNIFICANT_BITS;
+
+            ASSERT_FAIL_RAW(Obj(METRIC, MIN - 1, &ta));
+            ASSERT_FAIL_RAW(Obj(METRIC, MAX + 1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a collector, update it, and verify the loaded histogram.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        Obj mX(METRIC, &ta);  const Obj& X = mX;
+
+        mX.update(1);
+        mX.update(10);
+        mX.update(100);
+
+        Hist result(X.significantBits(), &ta);
+        X.load(&result);
+        ASSERT(3   == result.count());
+        ASSERT(111 == result.total());
+        ASSERT(1   == result.min());
+        ASSERT(100 == result.max());
+
+        mX.loadAndReset(&result);
+        ASSERT(3 == result.count());
+
+        X.load(&result);
+        ASSERT(0 == result.count());
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -12,11 +12,62 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_integercollector_cpp,"$Id$ $CSID$")
 
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
 #include <bsls_types.h>
 
 #include <bsl_climits.h>
+#include <bsl_cstddef.h>
+
+#include <new>          // placement 'new'
 
 namespace BloombergLP {
+namespace {
+
+BSLMF_ASSERT(sizeof(balm::IntegerCollector_Stripe) <=
+                                    balm::CollectorStripeUtil::k_STRIPE_SIZE);
+
+void atomicMin(bsls::AtomicInt *value, int other)
+    // Atomically set the specified 'value' to the specified 'other' if
+    // 'other' is less than 'value'.
+{
+    int current = value->loadRelaxed();
+    while (other < current) {
+        const int previous = value->testAndSwapAcqRel(current, other);
+        if (previous == current) {
+            return;                                                   // RETURN
+        }
+        current = previous;
+    }
+}
+
+void atomicMax(bsls::AtomicInt *value, int other)
+    // Atomically set the specified 'value' to the specified 'other' if
+    // 'other' is greater than 'value'.
+{
+    int current = value->loadRelaxed();
+    while (current < other) {
+        const int previous = value->testAndSwapAcqRel(current, other);
+        if (previous == current) {
+            return;                                                   // RETURN
+        }
+        current = previous;
+    }
+}
+
+void resetStripe(balm::IntegerCollector_Stripe *stripe)
+    // Reset the values of the specified 'stripe' to their default states.
+{
+    stripe->d_count.storeRelease(0);
+    stripe->d_total.storeRelease(0);
+    stripe->d_min.storeRelease(balm::IntegerCollector::k_DEFAULT_MIN);
+    stripe->d_max.storeRelease(balm::IntegerCollector::k_DEFAULT_MAX);
+}
+
+}  // close unnamed namespace
 
                         // ----------------------------
                         // class balm::IntegerCollector
@@ -31,6 +82,143 @@ const int balm::IntegerCollector::DEFAULT_MAX = INT_MIN;
 #endif
 
 namespace balm {
+// PRIVATE MANIPULATORS
+void IntegerCollector::accumulateStriped(int count,
+                                         int total,
+                                         int min,
+                                         int max)
+{
+    const unsigned int index = CollectorStripeUtil::threadStripeIndex()
+                             & (d_numStripes - 1);
+
+    IntegerCollector_Stripe *s = stripe(static_cast<int>(index));
+
+    s->d_count.addRelaxed(count);
+    s->d_total.addRelaxed(total);
+    atomicMin(&s->d_min, min);
+    atomicMax(&s->d_max, max);
+}
+
+void IntegerCollector::loadAndResetStripes(int                *count,
+                                           bsls::Types::Int64 *total,
+                                           int                *min,
+                                           int                *max)
+{
+    *count = 0;
+    *total = 0;
+    *min   = k_DEFAULT_MIN;
+    *max   = k_DEFAULT_MAX;
+
+    for (int i = 0; i < d_numStripes; ++i) {
+        IntegerCollector_Stripe *s = stripe(i);
+
+        *count += s->d_count.swapAcqRel(0);
+        *total += s->d_total.swapAcqRel(0);
+
+        const int stripeMin = s->d_min.swapAcqRel(k_DEFAULT_MIN);
+        const int stripeMax = s->d_max.swapAcqRel(k_DEFAULT_MAX);
+
+        if (stripeMin < *min) {
+            *min = stripeMin;
+        }
+        if (*max < stripeMax) {
+            *max = stripeMax;
+        }
+    }
+}
+
+void IntegerCollector::resetStripes()
+{
+    for (int i = 0; i < d_numStripes; ++i) {
+        resetStripe(stripe(i));
+    }
+}
+
+void IntegerCollector::setStripes(int count, int total, int min, int max)
+{
+    for (int i = 1; i < d_numStripes; ++i) {
+        resetStripe(stripe(i));
+    }
+
+    IntegerCollector_Stripe *s = stripe(0);
+
+    s->d_count.storeRelease(count);
+    s->d_total.storeRelease(total);
+    s->d_min.storeRelease(min);
+    s->d_max.storeRelease(max);
+}
+
+// PRIVATE ACCESSORS
+void IntegerCollector::loadStripes(int                *count,
+                                   bsls::Types::Int64 *total,
+                                   int                *min,
+                                   int                *max) const
+{
+    *count = 0;
+    *total = 0;
+    *min   = k_DEFAULT_MIN;
+    *max   = k_DEFAULT_MAX;
+
+    for (int i = 0; i < d_numStripes; ++i) {
+        const IntegerCollector_Stripe *s = stripe(i);
+
+        *count += s->d_count.loadAcquire();
+        *total += s->d_total.loadAcquire();
+
+        const int stripeMin = s->d_min.loadAcquire();
+        const int stripeMax = s->d_max.loadAcquire();
+
+        if (stripeMin < *min) {
+            *min = stripeMin;
+        }
+        if (*max < stripeMax) {
+            *max = stripeMax;
+        }
+    }
+}
+
+// CREATORS
+IntegerCollector::IntegerCollector(const MetricId&   metricId,
+                                   int               numStripes,
+                                   bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_count(0)
+, d_total(0)
+, d_min(k_DEFAULT_MIN)
+, d_max(k_DEFAULT_MAX)
+, d_mutex()
+, d_stripes_p(0)
+, d_buffer_p(0)
+, d_numStripes(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= numStripes);
+
+    if (0 == numStripes) {
+        return;                                                       // RETURN
+    }
+
+    const int         count      =
+                              CollectorStripeUtil::roundNumStripes(numStripes);
+    const bsl::size_t stripeSize = CollectorStripeUtil::k_STRIPE_SIZE;
+
+    // Allocate one additional stripe so that the stripes can be aligned on a
+    // cache line boundary.
+
+    d_buffer_p = d_allocator_p->allocate((count + 1) * stripeSize);
+
+    const bsl::size_t offset =
+         reinterpret_cast<bsls::Types::UintPtr>(d_buffer_p) % stripeSize;
+
+    d_stripes_p  = static_cast<char *>(d_buffer_p)
+                 + (offset ? stripeSize - offset : 0);
+    d_numStripes = count;
+
+    for (int i = 0; i < d_numStripes; ++i) {
+        resetStripe(new (stripe(i)) IntegerCollector_Stripe());
+    }
+}
+
 // MANIPULATORS
 void IntegerCollector::loadAndReset(MetricRecord *records)
 {
@@ -38,7 +226,10 @@ void IntegerCollector::loadAndReset(MetricRecord *records)
     bsls::Types::Int64 total;
     int                min;
     int                max;
-    {
+    if (d_stripes_p) {
+        loadAndResetStripes(&count, &total, &min, &max);
+    }
+    else {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
         count = d_count;
         total = d_total;
@@ -70,7 +261,10 @@ void IntegerCollector::load(MetricRecord *record) const
     int                min;
     int                max;
 
-    {
+    if (d_stripes_p) {
+        loadStripes(&count, &total, &min, &max);
+    }
+    else {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
         count = d_count;
         total = d_total;
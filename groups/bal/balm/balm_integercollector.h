@@ -33,6 +33,23 @@ BSLS_IDENT("$Id: $")
 // finally a combined 'loadAndReset' method that performs both a load and a
 // reset in a single (atomic) operation.
 //
+///Striped Collectors
+///------------------
+// By default, a 'balm::IntegerCollector' protects its aggregated values with a
+// mutex, which is acquired by every update.  A collector constructed with a
+// non-zero number of stripes instead holds an array of cache-line-sized cells
+// ("stripes"), each aggregating the updates of a subset of the threads (see
+// 'balm_collectorstripeutil').  An update of a striped collector modifies only
+// the stripe of the calling thread, using atomic additions for the count and
+// total, and compare-and-swap loops for the minimum and maximum, and acquires
+// no lock.  The stripes are merged when the collector is loaded (typically, at
+// publication time).  Note that, for a striped collector, 'load',
+// 'loadAndReset', 'reset', and 'setCountTotalMinMax' are not atomic with
+// respect to concurrent updates: an update that is concurrent with
+// 'loadAndReset' is accounted either in the loaded record or in the collector
+// after the reset, but its count, total, minimum, and maximum may be split
+// between the two.
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
@@ -42,7 +59,8 @@ BSLS_IDENT("$Id: $")
 ///-------------
 // 'balm::IntegerCollector' is fully *thread-safe*, meaning that all
 // non-creator operations on a given instance can be safely invoked
-// simultaneously from multiple threads.
+// simultaneously from multiple threads.  See "Striped Collectors" for the
+// atomicity guarantees of striped collectors.
 //
 ///Usage
 ///-----
@@ -78,22 +96,61 @@ BSLS_IDENT("$Id: $")
 //      assert(1        == record.min());
 //      assert(3        == record.max());
 //..
+// Finally, we create a striped collector for a metric that is updated
+// concurrently by many threads.  Its updates acquire no lock, and its stripes
+// are merged when it is loaded:
+//..
+//  balm::IntegerCollector stripedCollector(
+//                             myMetric,
+//                             balm::CollectorStripeUtil::defaultNumStripes());
+//
+//  stripedCollector.update(1);
+//  stripedCollector.update(3);
+//
+//  stripedCollector.loadAndReset(&record);
+//
+//      assert(myMetric == record.metricId());
+//      assert(2        == record.count());
+//      assert(4        == record.total());
+//      assert(1        == record.min());
+//      assert(3        == record.max());
+//..
 
 #include <bsl_algorithm.h>
 
 #include <balscm_version.h>
 
+#include <balm_collectorstripeutil.h>
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
 
+#include <bslma_allocator.h>
+
 #include <bslmt_mutex.h>
 #include <bslmt_lockguard.h>
 
+#include <bsls_atomic.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
 namespace balm {
 
+                       // ==============================
+                       // struct IntegerCollector_Stripe
+                       // ==============================
+
+struct IntegerCollector_Stripe {
+    // This 'struct' holds the values aggregated by one stripe of a striped
+    // 'IntegerCollector'.  This 'struct' is an implementation detail of
+    // 'IntegerCollector', and must not be used directly.
+
+    // DATA
+    bsls::AtomicInt   d_count;  // aggregated count of events
+    bsls::AtomicInt64 d_total;  // total of values across events
+    bsls::AtomicInt   d_min;    // minimum value across events
+    bsls::AtomicInt   d_max;    // maximum value across events
+};
+
                            // ======================
                            // class IntegerCollector
                            // ======================
@@ -115,11 +172,58 @@ class IntegerCollector {
     int                  d_min;       // minimum value across events
     int                  d_max;       // maximum value across events
     mutable bslmt::Mutex d_mutex;     // synchronizes access to data
+    char                *d_stripes_p; // cache-line-aligned stripes, or 0 if
+                                      // not striped
+    void                *d_buffer_p;  // memory holding the stripes (owned)
+    int                  d_numStripes;
+                                      // number of stripes (a power of 2), or
+                                      // 0 if not striped
+    bslma::Allocator    *d_allocator_p;
+                                      // allocator for the stripes (held, not
+                                      // owned)
 
     // NOT IMPLEMENTED
     IntegerCollector(const IntegerCollector&);
     IntegerCollector& operator=(const IntegerCollector&);
 
+    // PRIVATE MANIPULATORS
+    void accumulateStriped(int count, int total, int min, int max);
+        // Add the specified 'count', 'total', 'min', and 'max' to the stripe
+        // of the calling thread.  The behavior is undefined unless this
+        // collector is striped.
+
+    void loadAndResetStripes(int                *count,
+                             bsls::Types::Int64 *total,
+                             int                *min,
+                             int                *max);
+        // Load into the specified 'count', 'total', 'min', and 'max' the
+        // merged values of the stripes of this collector, resetting each
+        // stripe as it is loaded.  The behavior is undefined unless this
+        // collector is striped.
+
+    void resetStripes();
+        // Reset the stripes of this collector.  The behavior is undefined
+        // unless this collector is striped.
+
+    void setStripes(int count, int total, int min, int max);
+        // Set the first stripe of this collector to the specified 'count',
+        // 'total', 'min', and 'max', and reset the other stripes.  The
+        // behavior is undefined unless this collector is striped.
+
+    // PRIVATE ACCESSORS
+    void loadStripes(int                *count,
+                     bsls::Types::Int64 *total,
+                     int                *min,
+                     int                *max) const;
+        // Load into the specified 'count', 'total', 'min', and 'max' the
+        // merged values of the stripes of this collector.  The behavior is
+        // undefined unless this collector is striped.
+
+    IntegerCollector_Stripe *stripe(int index) const;
+        // Return the address of the stripe at the specified 'index'.  The
+        // behavior is undefined unless this collector is striped and
+        // '0 <= index < numStripes()'.
+
   public:
     // PUBLIC CONSTANTS
     static const int k_DEFAULT_MIN;  // default minimum value (INT_MAX)
@@ -135,6 +239,21 @@ class IntegerCollector {
         // 'metricId', and having an initial count of 0, total of 0, min of
         // 'k_DEFAULT_MIN', and max of 'k_DEFAULT_MAX'.
 
+    IntegerCollector(const MetricId&   metricId,
+                     int               numStripes,
+                     bslma::Allocator *basicAllocator = 0);
+        // Create an integer collector for a metric having the specified
+        // 'metricId', and having an initial count of 0, total of 0, min of
+        // 'k_DEFAULT_MIN', and max of 'k_DEFAULT_MAX'.  If the specified
+        // 'numStripes' is positive, the collector is striped, having the
+        // smallest power of two not less than 'numStripes' stripes (capped at
+        // 'CollectorStripeUtil::k_MAX_NUM_STRIPES'); otherwise the collector
+        // is not striped.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '0 <= numStripes'.  Note that a collector that is not striped
+        // allocates no memory.
+
     ~IntegerCollector();
         // Destroy this object.
 
@@ -195,6 +314,10 @@ class IntegerCollector {
         // minimum value of 'MetricRecord::k_DEFAULT_MIN' and a maximum value
         // of 'k_DEFAULT_MAX' will populate a maximum value of
         // 'MetricRecord::k_DEFAULT_MAX'.
+
+    int numStripes() const;
+        // Return the number of stripes of this collector, or 0 if this
+        // collector is not striped.
 };
 
 // ============================================================================
@@ -205,6 +328,14 @@ class IntegerCollector {
                            // class IntegerCollector
                            // ----------------------
 
+// PRIVATE ACCESSORS
+inline
+IntegerCollector_Stripe *IntegerCollector::stripe(int index) const
+{
+    return reinterpret_cast<IntegerCollector_Stripe *>(
+                     d_stripes_p + index * CollectorStripeUtil::k_STRIPE_SIZE);
+}
+
 // CREATORS
 inline
 IntegerCollector::IntegerCollector(const MetricId& metricId)
@@ -214,18 +345,30 @@ IntegerCollector::IntegerCollector(const MetricId& metricId)
 , d_min(k_DEFAULT_MIN)
 , d_max(k_DEFAULT_MAX)
 , d_mutex()
+, d_stripes_p(0)
+, d_buffer_p(0)
+, d_numStripes(0)
+, d_allocator_p(0)
 {
 }
 
 inline
 IntegerCollector::~IntegerCollector()
 {
+    if (d_buffer_p) {
+        d_allocator_p->deallocate(d_buffer_p);
+    }
 }
 
 // MANIPULATORS
 inline
 void IntegerCollector::reset()
 {
+    if (d_stripes_p) {
+        resetStripes();
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
     d_count = 0;
     d_total = 0;
@@ -236,6 +379,11 @@ void IntegerCollector::reset()
 inline
 void IntegerCollector::update(int value)
 {
+    if (d_stripes_p) {
+        accumulateStriped(1, value, value, value);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
     ++d_count;
     d_total += value;
@@ -249,6 +397,11 @@ void IntegerCollector::accumulateCountTotalMinMax(int count,
                                                   int min,
                                                   int max)
 {
+    if (d_stripes_p) {
+        accumulateStriped(count, total, min, max);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
     d_count += count;
     d_total += total;
@@ -262,6 +415,11 @@ void IntegerCollector::setCountTotalMinMax(int count,
                                            int min,
                                            int max)
 {
+    if (d_stripes_p) {
+        setStripes(count, total, min, max);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
     d_count = count;
     d_total = total;
@@ -276,6 +434,12 @@ const MetricId& IntegerCollector::metricId() const
     return d_metricId;
 }
 
+inline
+int IntegerCollector::numStripes() const
+{
+    return d_numStripes;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -11,6 +11,7 @@
 
 #include <bslma_testallocator.h>
 #include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
 #include <bdlmt_fixedthreadpool.h>
 #include <bdlf_bind.h>
 
@@ -45,6 +46,7 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // CREATORS
 // [ 3]  balm::Collector(const balm::MetricId& metric);
+// [ 9]  balm::IntegerCollector(const MetricId&, int, Allocator *);
 // [ 3]  ~balm::Collector();
 //
 // MANIPULATORS
@@ -60,10 +62,13 @@ using bsl::flush;
 // ACCESSORS
 // [ 2]  const balm::MetricId& metric() const;
 // [ 2]  void load(balm::MetricRecord *record) const;
+// [ 9]  int numStripes() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [ 9] STRIPED INTEGER COLLECTOR
+// [10] CONCURRENCY TEST: STRIPED INTEGER COLLECTOR
+// [11] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -216,6 +221,53 @@ void ConcurrencyTest::runTest()
     d_pool.drain();
 }
 
+void stripedUpdateJob(balm::IntegerCollector *collector,
+                      bslmt::Barrier         *barrier,
+                      int                     threadIndex,
+                      int                     numIterations)
+    // Wait on the specified 'barrier', then update the specified 'collector'
+    // the specified 'numIterations' times with values in the range
+    // '[threadIndex, threadIndex + 10)', where 'threadIndex' is the specified
+    // index of the calling thread, alternating between 'update' and
+    // 'accumulateCountTotalMinMax'.
+{
+    barrier->wait();
+    for (int i = 0; i < numIterations; ++i) {
+        const int value = threadIndex + i % 10;
+        if (i % 2) {
+            collector->update(value);
+        }
+        else {
+            collector->accumulateCountTotalMinMax(1, value, value, value);
+        }
+    }
+}
+
+void stripedLoadJob(balm::IntegerCollector *collector,
+                    bslmt::Barrier         *barrier,
+                    bsls::AtomicInt        *done,
+                    balm::MetricRecord     *result)
+    // Wait on the specified 'barrier', then repeatedly load and reset the
+    // specified 'collector', until the specified 'done' flag is set,
+    // aggregating the loaded records into the specified 'result'.
+{
+    barrier->wait();
+    while (!done->loadAcquire()) {
+        balm::MetricRecord record;
+        collector->loadAndReset(&record);
+
+        // Note that the count, total, minimum, and maximum of an update that
+        // is concurrent with 'loadAndReset' may be split between two loaded
+        // records, so that a record having a count of 0 may hold a minimum
+        // or maximum.
+
+        result->count() += record.count();
+        result->total() += record.total();
+        result->min()    = bsl::min(result->min(), record.min());
+        result->max()    = bsl::max(result->max(), record.max());
+    }
+}
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -248,7 +300,7 @@ int main(int argc, char *argv[])
     Id metric_E(DESC_E); const Id& METRIC_E = metric_E;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -301,7 +353,295 @@ int main(int argc, char *argv[])
         ASSERT(1        == record.min());
         ASSERT(3        == record.max());
 //..
+// Finally, we create a striped collector for a metric that is updated
+// concurrently by many threads.  Its updates acquire no lock, and its stripes
+// are merged when it is loaded:
+//..
+    balm::IntegerCollector stripedCollector(
+                               myMetric,
+                               balm::CollectorStripeUtil::defaultNumStripes());
+
+    stripedCollector.update(1);
+    stripedCollector.update(3);
+
+    stripedCollector.loadAndReset(&record);
+
+        ASSERT(myMetric == record.metricId());
+        ASSERT(2        == record.count());
+        ASSERT(4        == record.total());
+        ASSERT(1        == record.min());
+        ASSERT(3        == record.max());
+//..
+
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST: STRIPED INTEGER COLLECTOR
+        //
+        // Concerns:
+        //: 1 Concurrent updates of a striped collector are not lost, whether
+        //:   or not the collector is concurrently loaded and reset.
+        //:
+        //: 2 The minimum and maximum of a striped collector reflect every
+        //:   concurrent update.
+        //
+        // Plan:
+        //: 1 Update a striped collector (having fewer stripes than updating
+        //:   threads, so that stripes are shared) from several threads, and
+        //:   verify that the loaded record accounts for every update.  (C-1,2)
+        //:
+        //: 2 Repeat P-1 while another thread repeatedly loads and resets the
+        //:   collector, and verify that the aggregate of the loaded records
+        //:   and of the final state of the collector accounts for every
+        //:   update.  (C-1,2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST: STRIPED INTEGER COLLECTOR
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST: STRIPED INTEGER COLLECTOR"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::TestAllocator ta;
+
+        enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 10000 };
+
+        // Each thread contributes 'k_NUM_ITERATIONS / 10' times each of the
+        // values '[threadIndex, threadIndex + 10)'.
+
+        bsls::Types::Int64 expectedTotal = 0;
+        for (int t = 0; t < k_NUM_THREADS; ++t) {
+            expectedTotal += (k_NUM_ITERATIONS / 10) * (10 * t + 45);
+        }
+
+        for (int withLoader = 0; withLoader < 2; ++withLoader) {
+            if (verbose) { P(withLoader); }
 
+            Obj mX(METRIC_A, 4, &ta); const Obj& X = mX;
+
+            ASSERT(4 == X.numStripes());
+
+            const int      numParties = k_NUM_THREADS + withLoader;
+            bslmt::Barrier barrier(numParties);
+            bsls::AtomicInt done(0);
+            Rec             loaded(METRIC_A);
+
+            bslmt::ThreadGroup updaters(&ta);
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                ASSERT(0 == updaters.addThread(
+                                      bdlf::BindUtil::bind(&stripedUpdateJob,
+                                                           &mX,
+                                                           &barrier,
+                                                           t,
+                                                           k_NUM_ITERATIONS)));
+            }
+
+            bslmt::ThreadGroup loader(&ta);
+            if (withLoader) {
+                ASSERT(0 == loader.addThread(
+                                        bdlf::BindUtil::bind(&stripedLoadJob,
+                                                             &mX,
+                                                             &barrier,
+                                                             &done,
+                                                             &loaded)));
+            }
+
+            updaters.joinAll();
+            done.storeRelease(1);
+            loader.joinAll();
+
+            Rec remaining;
+            mX.loadAndReset(&remaining);
+
+            loaded.count() += remaining.count();
+            loaded.total() += remaining.total();
+            loaded.min()    = bsl::min(loaded.min(), remaining.min());
+            loaded.max()    = bsl::max(loaded.max(), remaining.max());
+
+            ASSERTV(loaded.count(),
+                    k_NUM_THREADS * k_NUM_ITERATIONS == loaded.count());
+            ASSERTV(loaded.total(), expectedTotal == loaded.total());
+            ASSERTV(loaded.min(), 0                      == loaded.min());
+            ASSERTV(loaded.max(), k_NUM_THREADS - 1 + 9  == loaded.max());
+
+            Rec empty;
+            X.load(&empty);
+            ASSERT(Rec(METRIC_A) == empty);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING STRIPED INTEGER COLLECTOR
+        //
+        // Concerns:
+        //: 1 An integer collector constructed with 0 stripes is not striped,
+        //:   and allocates no memory.
+        //:
+        //: 2 An integer collector constructed with a positive number of
+        //:   stripes has the smallest power of two not less than that number
+        //:   of stripes, capped at 'CollectorStripeUtil::k_MAX_NUM_STRIPES',
+        //:   and allocates its stripes from the supplied allocator.
+        //:
+        //: 3 The manipulators and accessors of a striped collector have the
+        //:   same observable behavior as those of an unstriped collector.
+        //:
+        //: 4 Updates from different threads (and so, generally, different
+        //:   stripes) are merged by 'load' and 'loadAndReset'.
+        //:
+        //: 5 The memory of a striped collector is released on destruction.
+        //
+        // Plan:
+        //: 1 Construct collectors with a range of numbers of stripes, and
+        //:   verify 'numStripes' and the memory allocated.  (C-1,2,5)
+        //:
+        //: 2 For a table of sequences of values, apply the same operations
+        //:   to a striped and an unstriped integer collector, and verify that
+        //:   the loaded records are the same.  (C-3)
+        //:
+        //: 3 Update a striped collector from several threads in turn, and
+        //:   verify the loaded record.  (C-4)
+        //
+        // Testing:
+        //   balm::IntegerCollector(const MetricId&, int, Allocator *);
+        //   int numStripes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING STRIPED INTEGER COLLECTOR"
+                          << endl << "================================="
+                          << endl;
+
+        bslma::TestAllocator ta;
+        bslma::TestAllocator da;
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\tTest construction." << endl;
+        {
+            const struct {
+                int d_line;
+                int d_numStripes;
+                int d_expNumStripes;
+            } DATA[] = {
+                { L_,   0,  0 },
+                { L_,   1,  1 },
+                { L_,   2,  2 },
+                { L_,   3,  4 },
+                { L_,   8,  8 },
+                { L_,  33, 64 },
+                { L_,  64, 64 },
+                { L_, 100, 64 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int LINE = DATA[i].d_line;
+                const int NS   = DATA[i].d_numStripes;
+                const int EXP  = DATA[i].d_expNumStripes;
+
+                {
+                    Obj mX(METRIC_A, NS, &ta); const Obj& X = mX;
+
+                    LOOP_ASSERT(LINE, EXP      == X.numStripes());
+                    LOOP_ASSERT(LINE, METRIC_A == X.metricId());
+                    LOOP_ASSERT(LINE, (0 != EXP) == (0 < ta.numBytesInUse()));
+
+                    Rec r;
+                    X.load(&r);
+                    LOOP_ASSERT(LINE, Rec(METRIC_A) == r);
+                }
+                LOOP_ASSERT(LINE, 0 == ta.numBytesInUse());
+                LOOP_ASSERT(LINE, 0 == da.numBytesInUse());
+            }
+
+            Obj mX(METRIC_A); const Obj& X = mX;
+            ASSERT(0 == X.numStripes());
+        }
+
+        if (verbose) cout << "\tTest manipulators." << endl;
+        {
+            const struct {
+                int         d_line;
+                const char *d_values;  // each digit is a value to 'update'
+            } DATA[] = {
+                { L_, ""          },
+                { L_, "0"         },
+                { L_, "5"         },
+                { L_, "19"        },
+                { L_, "91"        },
+                { L_, "3141592653" },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int   LINE   = DATA[i].d_line;
+                const char *VALUES = DATA[i].d_values;
+
+                Obj mX(METRIC_A, 4, &ta); const Obj& X = mX;
+                Obj mY(METRIC_A);         const Obj& Y = mY;
+
+                for (const char *v = VALUES; *v; ++v) {
+                    mX.update(*v - '0');
+                    mY.update(*v - '0');
+                }
+
+                Rec rX, rY;
+                X.load(&rX);
+                Y.load(&rY);
+                LOOP3_ASSERT(LINE, rX, rY, rX == rY);
+
+                mX.accumulateCountTotalMinMax(2, 10, -1, 20);
+                mY.accumulateCountTotalMinMax(2, 10, -1, 20);
+                X.load(&rX);
+                Y.load(&rY);
+                LOOP3_ASSERT(LINE, rX, rY, rX == rY);
+
+                mX.loadAndReset(&rX);
+                mY.loadAndReset(&rY);
+                LOOP3_ASSERT(LINE, rX, rY, rX == rY);
+                X.load(&rX);
+                LOOP2_ASSERT(LINE, rX, Rec(METRIC_A) == rX);
+
+                mX.setCountTotalMinMax(3, 6, 1, 3);
+                mY.setCountTotalMinMax(3, 6, 1, 3);
+                X.load(&rX);
+                Y.load(&rY);
+                LOOP3_ASSERT(LINE, rX, rY, rX == rY);
+
+                mX.reset();
+                X.load(&rX);
+                LOOP2_ASSERT(LINE, rX, Rec(METRIC_A) == rX);
+            }
+        }
+
+        if (verbose) cout << "\tTest updates from several threads." << endl;
+        {
+            enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 100 };
+
+            Obj mX(METRIC_A, 2, &ta); const Obj& X = mX;
+
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                bslmt::Barrier     barrier(1);
+                bslmt::ThreadGroup group(&ta);
+                ASSERT(0 == group.addThread(
+                                      bdlf::BindUtil::bind(&stripedUpdateJob,
+                                                           &mX,
+                                                           &barrier,
+                                                           t,
+                                                           k_NUM_ITERATIONS)));
+                group.joinAll();
+            }
+
+            Rec r;
+            X.load(&r);
+            ASSERTV(r.count(), k_NUM_THREADS * k_NUM_ITERATIONS == r.count());
+            ASSERTV(r.total(), 10 * (4 * 45 + 10 * 6) == r.total());
+            ASSERTV(r.min(), 0                     == r.min());
+            ASSERTV(r.max(), k_NUM_THREADS - 1 + 9 == r.max());
+        }
+        ASSERT(0 == ta.numBytesInUse());
       } break;
       case 8: {
         // --------------------------------------------------------------------
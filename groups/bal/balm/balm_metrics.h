@@ -72,6 +72,11 @@ BSLS_IDENT("$Id: $")
 //       publication type.  'CATEGORY' and 'METRIC' must be *runtime*
 //       *constants*.
 //
+//   BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)
+//       Record the integer 'VALUE' in the histogram of the identified metric,
+//       whose percentiles are published as derived metrics.  'CATEGORY' and
+//       'METRIC' must be *runtime* *constants*.
+//
 //   BALM_METRICS_INCREMENT(CATEGORY, METRIC)
 //       Increment (by 1) the identified metric.  'CATEGORY' and 'METRIC' must
 //       be *runtime* *constants*.
@@ -83,6 +88,7 @@ BSLS_IDENT("$Id: $")
 //
 //   BALM_METRICS_DYNAMIC_UPDATE(CATEGORY, METRIC, VALUE)
 //   BALM_METRICS_DYNAMIC_INT_UPDATE(CATEGORY, METRIC, VALUE)
+//   BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)
 //       Update the identified metric by 'VALUE'.  This operation performs a
 //       lookup on 'CATEGORY' and 'METRIC' on each invocation, so those values
 //       need *not* be runtime constants.
@@ -236,6 +242,25 @@ BSLS_IDENT("$Id: $")
 //       collected aggregates (total, count, minimum, and maximum value)
 //       should be published.
 //
+//   BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)
+//       Record the specified *integer* 'VALUE' in the histogram collector
+//       (see 'balm_histogramcollector') of the indicated metric, identified
+//       by the specified 'CATEGORY' and 'METRIC' names.  'CATEGORY' and
+//       'METRIC' must be null-terminated strings of a type convertible to
+//       'const char *', and 'VALUE' is assumed to be of a type convertible to
+//       'bsls::Types::Int64'.  The count, total, minimum, and maximum of the
+//       recorded values are published for the metric, and their estimated
+//       50th, 90th, 99th, and 99.9th percentiles are published as the
+//       derived metrics "METRIC.p50", "METRIC.p90", "METRIC.p99", and
+//       "METRIC.p999" (see 'balm_collectorrepository').  Recording a value
+//       acquires no lock, making this macro suitable for measuring the
+//       latencies of frequent operations.  This macro maintains a
+//       (function-scope static) cache containing the identity of the metric
+//       being updated, which in practice means that 'CATEGORY' and 'METRIC'
+//       must be *runtime* *constants*.  If the default metrics manager has
+//       not been initialized, or if the indicated 'CATEGORY' is currently
+//       disabled, this macro has no effect.
+//
 //   BALM_METRICS_INCREMENT(CATEGORY, METRIC)
 //       The behavior of this macro is logically equivalent to:
 //       'BALM_METRICS_INT_UPDATE(CATEGORY, METRIC, 1)'.
@@ -273,6 +298,19 @@ BSLS_IDENT("$Id: $")
 //       additional runtime overhead (if the 'CATEGORY' and 'METRIC' values
 //       are always the same for a particular point of call).
 //
+//   BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)
+//       Record the specified *integer* 'VALUE' in the histogram collector of
+//       the indicated metric, identified by the specified 'CATEGORY' and
+//       'METRIC' names (see 'BALM_METRICS_HISTOGRAM_UPDATE').  'CATEGORY'
+//       and 'METRIC' must be null-terminated strings of a type convertible to
+//       'const char *', and 'VALUE' is assumed to be of a type convertible
+//       to 'bsls::Types::Int64'.  If the default metrics manager has not been
+//       initialized, or if the indicated 'CATEGORY' is currently disabled,
+//       this macro has no effect.  Note that this operation looks up the
+//       'CATEGORY' and 'METRIC' on *each* application, resulting in
+//       (unnecessary) additional runtime overhead (if the 'CATEGORY' and
+//       'METRIC' values are always the same for a particular point of call).
+//
 //   BALM_METRICS_DYNAMIC_INCREMENT(CATEGORY, METRIC)
 //       The behavior of this macro is logically equivalent to
 //       'BALM_METRICS_DYNAMIC_INT_UPDATE(CATEGORY, METRIC, 1)'.
@@ -505,6 +543,7 @@ BSLS_IDENT("$Id: $")
 #include <balm_collector.h>
 #include <balm_collectorrepository.h>
 #include <balm_defaultmetricsmanager.h>
+#include <balm_histogramcollector.h>
 #include <balm_integercollector.h>
 #include <balm_metricid.h>
 #include <balm_metricregistry.h>
@@ -996,6 +1035,39 @@ do {                                                                          \
 #define BALM_METRICS_DYNAMIC_INCREMENT(CATEGORY, METRIC)                      \
     BALM_METRICS_DYNAMIC_INT_UPDATE(CATEGORY, METRIC, 1)
 
+                        // =============================
+                        // BALM_METRICS_HISTOGRAM_UPDATE
+                        // =============================
+
+#define BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE) do {           \
+   using namespace BloombergLP;                                               \
+   typedef balm::Metrics_Helper Helper;                                       \
+   static balm::CategoryHolder holder = { false, 0, 0 };                      \
+   static balm::HistogramCollector *collector1 = 0;                           \
+   if (0 == holder.category() && balm::DefaultMetricsManager::instance()) {   \
+     Helper::logEmptyName(CATEGORY,Helper::e_TYPE_CATEGORY,__FILE__,__LINE__);\
+     Helper::logEmptyName(METRIC, Helper::e_TYPE_METRIC, __FILE__, __LINE__); \
+       collector1 = Helper::getHistogramCollector(CATEGORY, METRIC);          \
+       Helper::initializeCategoryHolder(&holder, CATEGORY);                   \
+   }                                                                          \
+   if (holder.enabled()) {                                                    \
+       collector1->update(VALUE);                                             \
+   }                                                                          \
+ } while (0)
+
+#define BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE) do {   \
+    using namespace BloombergLP;                                              \
+    if (balm::DefaultMetricsManager::instance()) {                            \
+        balm::CollectorRepository& repository =                               \
+             balm::DefaultMetricsManager::instance()->collectorRepository();  \
+        balm::HistogramCollector *collector =                                 \
+             repository.getDefaultHistogramCollector((CATEGORY), (METRIC));   \
+        if (collector->metricId().category()->enabled()) {                    \
+            collector->update((VALUE));                                       \
+        }                                                                     \
+    }                                                                         \
+  } while (0)
+
                         // =======================
                         // BALM_METRICS_TIME_BLOCK
                         // =======================
@@ -1202,6 +1274,13 @@ struct Metrics_Helper {
         // The behavior is undefined unless the 'balm' metrics manager
         // singleton is valid.
 
+    static HistogramCollector *getHistogramCollector(const char *category,
+                                                     const char *metric);
+        // Return the address of the histogram collector for the metric
+        // identified by the specified 'category' and 'metric' names.  The
+        // behavior is undefined unless the 'balm' metrics manager singleton
+        // is valid.
+
     static void setPublicationType(const MetricId&        id,
                                    PublicationType::Value type);
         // Set the publication type for the metric identified by the specified
@@ -1256,6 +1335,17 @@ IntegerCollector *Metrics_Helper::getIntegerCollector(const char *category,
                                                                      metric);
 }
 
+inline
+HistogramCollector *Metrics_Helper::getHistogramCollector(
+                                                        const char *category,
+                                                        const char *metric)
+{
+    MetricsManager *manager = DefaultMetricsManager::instance();
+    return manager->collectorRepository().getDefaultHistogramCollector(
+                                                                    category,
+                                                                    metric);
+}
+
 inline
 void Metrics_Helper::setPublicationType(const MetricId&        id,
                                         PublicationType::Value type)
@@ -9,6 +9,7 @@
 
 #include <balm_metrics.h>
 
+#include <balm_histogram.h>
 #include <balm_metricregistry.h>
 #include <balm_metricsample.h>
 #include <balm_publisher.h>
@@ -101,7 +102,9 @@ using bsl::flush;
 //                                             const char *file,
 //                                             int         line);
 // [18] WARNING LOG TEST: ALL MACROS
-// [19] USAGE EXAMPLE
+// [19] BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, NAME, VALUE)
+// [19] BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE(CATEGORY, NAME, VALUE)
+// [20] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -1385,7 +1388,7 @@ int main(int argc, char *argv[])
     Corp::bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1443,6 +1446,98 @@ int main(int argc, char *argv[])
 
     }
     } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING: 'BALM_METRICS_HISTOGRAM_UPDATE',
+        //          'BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE'
+        //
+        // Concerns:
+        //    That the histogram macros record the supplied values in the
+        //    histogram collector of the identified metric, that they respect
+        //    the 'enabled' property of the metric's category, that the derived
+        //    metrics of the histogram are registered, and that the macros have
+        //    no effect without a default metrics manager.
+        //
+        // Plan:
+        //   Verify that invoking the macros without a default metrics manager
+        //   has no effect.
+        //
+        //   Invoke the macros with a set of values, alternately enabling and
+        //   disabling the metric's category, and record the values applied
+        //   while the category is enabled in an "oracle" histogram.  Verify
+        //   that the histogram loaded from the histogram collector of the
+        //   metric has the same value as the "oracle" histogram.
+        //
+        // Testing:
+        //    BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, NAME, VALUE)
+        //    BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE(CATEGORY, NAME, VALUE)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: HISTOGRAM MACROS\n"
+                          << "=========================\n";
+
+        const Corp::bsls::Types::Int64 UPDATES[] = {
+            0, 12, 1321, 43145, 1, 2131241, 1LL << 40, 77, 100, 100
+        };
+        const int NUM_UPDATES = sizeof(UPDATES)/sizeof(*UPDATES);
+
+        if (veryVerbose)
+            cout << "\tverify macros are a no-op without a metrics manager.\n";
+        {
+            for (int i = 0; i < NUM_UPDATES; ++i) {
+                BALM_METRICS_HISTOGRAM_UPDATE("H", "latency", UPDATES[i]);
+                BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE("H",
+                                                      "dynamic",
+                                                      UPDATES[i]);
+            }
+        }
+
+        if (veryVerbose)
+            cout << "\tverify macros are applied correctly.\n";
+        {
+            BALM::DefaultMetricsManagerScopedGuard guard(Z);
+            BALM::MetricsManager& mgr = *DefaultManager::instance();
+            Registry&   registry   = mgr.metricRegistry();
+            Repository& repository = mgr.collectorRepository();
+
+            const Id latencyId(registry.getId("H", "latency"));
+            const Id dynamicId(registry.getId("H", "dynamic"));
+
+            BALM::HistogramCollector *latencyCol =
+                          repository.getDefaultHistogramCollector(latencyId);
+            BALM::HistogramCollector *dynamicCol =
+                          repository.getDefaultHistogramCollector(dynamicId);
+
+            BALM::Histogram expected(latencyCol->significantBits(), Z);
+            BALM::Histogram latency(latencyCol->significantBits(), Z);
+            BALM::Histogram dynamic(dynamicCol->significantBits(), Z);
+
+            for (int i = 0; i < NUM_UPDATES; ++i) {
+                const bool enabled = 0 == i % 3;
+
+                registry.setCategoryEnabled(latencyId.category(), enabled);
+
+                BALM_METRICS_HISTOGRAM_UPDATE("H", "latency", UPDATES[i]);
+                BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE("H",
+                                                      "dynamic",
+                                                      UPDATES[i]);
+                if (enabled) {
+                    expected.record(UPDATES[i]);
+                }
+
+                latencyCol->load(&latency);
+                dynamicCol->load(&dynamic);
+                LOOP_ASSERT(i, expected == latency);
+                LOOP_ASSERT(i, expected == dynamic);
+            }
+            ASSERT(4 == expected.count());
+
+            ASSERT(registry.findId("H", "latency.p50").isValid());
+            ASSERT(registry.findId("H", "latency.p999").isValid());
+            ASSERT(registry.findId("H", "dynamic.p99").isValid());
+        }
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // Testing:
@@ -986,6 +986,31 @@ MetricsManager::MetricsManager(bslma::Allocator *basicAllocator)
              d_allocator_p);
 }
 
+MetricsManager::MetricsManager(int               numCollectorStripes,
+                               bslma::Allocator *basicAllocator)
+: d_metricRegistry(basicAllocator)
+, d_collectors(&d_metricRegistry, numCollectorStripes, basicAllocator)
+, d_callbacks(0)
+, d_publishers(0)
+, d_creationTime(bdlt::CurrentTime::now())
+, d_prevResetTimes(basicAllocator)
+, d_publishLock()
+, d_rwLock()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= numCollectorStripes);
+
+    d_callbacks.load(
+             new (*d_allocator_p) MetricsManager_CallbackRegistry(
+                                                                d_allocator_p),
+             d_allocator_p);
+
+    d_publishers.load(
+             new (*d_allocator_p) MetricsManager_PublisherRegistry(
+                                                               d_allocator_p),
+             d_allocator_p);
+}
+
 MetricsManager::~MetricsManager()
 {
 }
@@ -515,6 +515,20 @@ class MetricsManager {
         // used to supply memory.  If 'basicAllocator' is 0, the currently
         // installed default allocator is used.
 
+    explicit MetricsManager(int               numCollectorStripes,
+                            bslma::Allocator *basicAllocator = 0);
+        // Create a 'MetricsManager' whose collectors (and integer collectors)
+        // are striped across the specified 'numCollectorStripes' stripes, or
+        // are not striped if 'numCollectorStripes' is 0 (see
+        // 'balm_collector').  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '0 <= numCollectorStripes'.  Note that striped collectors are
+        // updated without acquiring a lock, and are suited to metrics updated
+        // concurrently by many threads; see
+        // 'CollectorStripeUtil::defaultNumStripes' for a suitable number of
+        // stripes.
+
     ~MetricsManager();
         // Destroy this 'MetricsManager'.
 
@@ -6682,8 +6682,7 @@ t(L,12, 8, de(    1125899906842624.0), A(   1125899906842624.0              ));
 t(L,12, 8, de(   18014398509481984.0), A(  18014398509481984.0              ));
 t(L,12, 8, de(  144115188075855870.0), A( 144115188075855872.0              ));
 
-t(L, N, N, du(1.1920928955078125e-07), A(1.192092895507812e-07)
-                                     , A(1.192092895507813e-07));
+t(L, N, N, du(1.1920928955078125e-07), A(1.1920928955078125e-07));
 t(L, N, N, du(2.384185791015625e-07 ), A(2.384185791015625e-07));
 t(L, N, N, du(1.52587890625e-05     ), A(1.52587890625e-05    ));
 t(L, N, N, du(2.44140625e-04        ), A(0.000244140625       ));
@@ -6695,9 +6694,8 @@ t(L, N, N, du(                1024.0), A(             1024    ));
 t(L, N, N, du(            16777216.0), A(         16777216    ));
 t(L, N, N, du(        137438953472.0), A(     137438953472    ));
 t(L, N, N, du(    1125899906842624.0), A( 1125899906842624    ));
-t(L, N, N, du(   18014398509481984.0), A(1.801439850948198e+16));
-t(L, N, 0, du(1.1920928955078125e-07), A(1.192092895507812e-07)
-                                     , A(1.192092895507813e-07));
+t(L, N, N, du(   18014398509481984.0), A(18014398509481984    ));
+t(L, N, 0, du(1.1920928955078125e-07), A(1.1920928955078125e-07));
 t(L, N, 0, du(2.384185791015625e-07 ), A(2.384185791015625e-07));
 t(L, N, 0, du(1.52587890625e-05     ), A(1.52587890625e-05    ));
 t(L, N, 0, du(2.44140625e-04        ), A(0.000244140625       ));
@@ -6708,9 +6706,8 @@ t(L, N, 0, du(                1024.0), A(             1024    ));
 t(L, N, 0, du(            16777216.0), A(         16777216    ));
 t(L, N, 0, du(        137438953472.0), A(     137438953472    ));
 t(L, N, 0, du(    1125899906842624.0), A( 1125899906842624    ));
-t(L, N, 0, du(   18014398509481984.0), A(1.801439850948198e+16));
-t(L, N, 1, du(1.1920928955078125e-07), A(1.192092895507812e-07)
-                                     , A(1.192092895507813e-07));
+t(L, N, 0, du(   18014398509481984.0), A(18014398509481984    ));
+t(L, N, 1, du(1.1920928955078125e-07), A(1.1920928955078125e-07));
 t(L, N, 1, du(2.384185791015625e-07 ), A(2.384185791015625e-07));
 t(L, N, 1, du(1.52587890625e-05     ), A(1.52587890625e-05    ));
 t(L, N, 1, du(2.44140625e-04        ), A(0.000244140625       ));
@@ -6721,9 +6718,8 @@ t(L, N, 1, du(                1024.0), A(             1024    ));
 t(L, N, 1, du(            16777216.0), A(         16777216    ));
 t(L, N, 1, du(        137438953472.0), A(     137438953472    ));
 t(L, N, 1, du(    1125899906842624.0), A( 1125899906842624    ));
-t(L, N, 1, du(   18014398509481984.0), A(1.801439850948198e+16));
-t(L,12, 8, du(1.1920928955078125e-07), A(1.192092895507812e-07)
-                                     , A(1.192092895507813e-07));
+t(L, N, 1, du(   18014398509481984.0), A(18014398509481984    ));
+t(L,12, 8, du(1.1920928955078125e-07), A(1.1920928955078125e-07));
 t(L,12, 8, du(2.384185791015625e-07 ), A(2.384185791015625e-07));
 t(L,12, 8, du(1.52587890625e-05     ), A(1.52587890625e-05    ));
 t(L,12, 8, du(2.44140625e-04        ), A(0.000244140625       ));
@@ -6734,7 +6730,7 @@ t(L,12, 8, du(                1024.0), A(             1024    ));
 t(L,12, 8, du(            16777216.0), A(         16777216    ));
 t(L,12, 8, du(        137438953472.0), A(     137438953472    ));
 t(L,12, 8, du(    1125899906842624.0), A( 1125899906842624    ));
-t(L,12, 8, du(   18014398509481984.0), A(1.801439850948198e+16));
+t(L,12, 8, du(   18014398509481984.0), A(18014398509481984    ));
 
 t(L, N, N, pd(DD(             0.001)), A(               0.001 ));
 t(L, N, N, pd(DD(             0.01 )), A(               0.01  ));
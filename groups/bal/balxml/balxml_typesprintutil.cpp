@@ -17,12 +17,12 @@ BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 #include <bdldfp_decimalutil.h>
 
 #include <bsla_fallthrough.h>
+#include <bslalg_numericformatterutil.h>
 #include <bsls_assert.h>
-#include <bsls_platform.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cfloat.h>
-#include <bsl_cstdio.h>
 #include <bsl_cstring.h>
 #include <bsl_iterator.h>
 
@@ -599,28 +599,24 @@ bsl::ostream& printDecimalImpl(bsl::ostream& stream,
       } break;
     }
 
+    BSLS_ASSERT(0 < precision);
     BSLS_ASSERT(precision <= DBL_DIG);
 
-    // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-    // 'sprintf', even though the former calls the latter.  Also, note that
-    // 'snprintf' is 15% slower than 'sprintf' on Sun.
+    // Format as "%-#1.*f" would (the '.' is always written, as 'precision' is
+    // positive), but without the overhead of 'sprintf'.
 
     char buffer[DBL_MAX_10_EXP + DBL_DIG + 4];  // buffer with headroom
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
+    const char *end = bslalg::NumericFormatterUtil::toChars(
+                                         buffer,
+                                         buffer + sizeof buffer,
+                                         object,
+                                         bslalg::NumericFormatterUtil::e_FIXED,
+                                         precision);
+    BSLS_ASSERT(end);
 
-    // format: "-"  forces left alignment, "#" always prints period
-    const int len = bsl::sprintf(buffer, "%-#1.*f", precision, object);
-    (void)len; BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
-
-    const char *ptr = bsl::strchr(buffer, '.');
+    const char *ptr = static_cast<const char *>(
+                                    bsl::memchr(buffer, '.', end - buffer));
     BSLS_ASSERT(ptr != 0);
 
     int integralLen = static_cast<int>(ptr - buffer);
@@ -637,7 +633,7 @@ bsl::ostream& printDecimalImpl(bsl::ostream& stream,
 
     ++ptr;  // move ptr to the first fraction digit
 
-    int fractionLen = static_cast<int>(bsl::strlen(ptr));
+    int fractionLen = static_cast<int>(end - ptr);
 
     if (fractionLen > maxFractionLen) {
         fractionLen = maxFractionLen;
@@ -670,10 +666,6 @@ bsl::ostream& printDecimalWithOptions(bsl::ostream& stream,
     // Ex: for totalDigits = 4, 65.43, 1234, 1.456 etc Maximum number of
     // fraction digits refers to the digits following the decimal point.
 
-    const int BUF_SIZE = 128;
-    char buffer[BUF_SIZE];
-    bsl::memset(buffer, 0, BUF_SIZE);
-
     if (maxTotalDigits < 2) {
         // At least two digits must be printed one before and one after the
         // decimal.
@@ -691,20 +683,27 @@ bsl::ostream& printDecimalWithOptions(bsl::ostream& stream,
         maxFractionDigits = maxTotalDigits - 1;
     }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
+    // Format as "%-#1.*f" would, but without the overhead of 'sprintf'.  A
+    // 'double' has at most 'k_MAX_FRACTION_DIGITS' non-zero fraction digits,
+    // so any further digits requested are zeros, and are written separately.
 
-    // format: "-"  forces left alignment, "#" always prints period
-    const int len = bsl::sprintf(buffer, "%-#1.*f", maxFractionDigits, object);
-    (void)len; BSLS_ASSERT(len < (int) sizeof buffer);
+    enum { k_MAX_FRACTION_DIGITS = DBL_MANT_DIG - DBL_MIN_EXP + 1 };
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+    const int precision = bsl::min(maxFractionDigits,
+                                   static_cast<int>(k_MAX_FRACTION_DIGITS));
 
-    const char *ptr = bsl::strchr(buffer, '.');
+    char buffer[DBL_MAX_10_EXP + k_MAX_FRACTION_DIGITS + 4];
+
+    const char *end = bslalg::NumericFormatterUtil::toChars(
+                                         buffer,
+                                         buffer + sizeof buffer,
+                                         object,
+                                         bslalg::NumericFormatterUtil::e_FIXED,
+                                         precision);
+    BSLS_ASSERT(end);
+
+    const char *ptr = static_cast<const char *>(
+                                    bsl::memchr(buffer, '.', end - buffer));
     BSLS_ASSERT(ptr != 0);
 
     int integralLen = static_cast<int>(ptr - buffer);
@@ -723,7 +722,13 @@ bsl::ostream& printDecimalWithOptions(bsl::ostream& stream,
 
     ++ptr;  // move ptr to the first fraction digit
 
-    return stream.write(buffer, (ptr - buffer) + fractionLen);
+    const int numWritten = bsl::min(fractionLen, precision);
+    stream.write(buffer, (ptr - buffer) + numWritten);
+
+    for (int i = numWritten; i < fractionLen; ++i) {
+        stream.put('0');
+    }
+    return stream;
 }
 
 inline
@@ -986,26 +991,17 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Write the shortest representation that round-trips.
 
         char buffer[FLT_DIG + 20];  // buffer with headroom
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len =
-                    bsl::sprintf(buffer, "%.*g", FLT_DIG + 1, (double) object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
+        const char *end = bslalg::NumericFormatterUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        object);
+        BSLS_ASSERT(end);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
-
-        stream.write(buffer, len);
+        stream.write(buffer, end - buffer);
       } break;
     }
 
@@ -1032,25 +1028,17 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Write the shortest representation that round-trips.
 
         char buffer[DBL_DIG + 20];  // buffer with headroom
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len = bsl::sprintf(buffer, "%.*g", DBL_DIG + 1, object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+        const char *end = bslalg::NumericFormatterUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        object);
+        BSLS_ASSERT(end);
 
-        stream.write(buffer, len);
+        stream.write(buffer, end - buffer);
       } break;
     }
 
@@ -105,6 +105,17 @@ BSLS_IDENT("$Id: $")
 //      Enumeration                         TEXT
 //..
 //
+///Printing Floating-Point Values
+///------------------------------
+// In the 'DEFAULT' formatting mode, 'float' and 'double' values are printed
+// with the fewest significant digits that, when parsed, yield exactly the
+// original value (e.g., "0.1", "0.30000000000000004", or "1e+22"), in fixed
+// or scientific notation, whichever is shorter.  In the 'DEC' formatting mode
+// they are printed in fixed notation, with the number of digits limited by
+// the 'EncoderOptions' (if any).  Infinities and NaNs are printed as "+INF",
+// "-INF", and "NaN" in the 'DEFAULT' mode, and cannot be printed in the 'DEC'
+// mode.
+//
 ///Behavior of 'printText' on Non-Valid Strings
 ///--------------------------------------------
 // The output of 'printText' will always be valid XML 1.0 with UTF-8 encoding.
@@ -95,7 +95,11 @@ BSLS_IDENT("$Id: $")
 // The conversion from text to values of type 'double' results in the closest
 // representable value to the decimal text.  Note that this is the same as for
 // the standard library function 'strtod'.  For example, the ASCII string
-// "3.14159" is converted, on some platforms, to 3.1415899999999999.
+// "3.14159" is converted to 3.1415899999999999.  As with 'strtod', text whose
+// magnitude is too large (or too small) to be represented results in infinity
+// (or zero) of the same sign.  The conversion is performed by
+// 'bsl::from_chars', without copying the input and without regard to the
+// current locale.
 //
 ///Special Floating Point Values
 ///- - - - - - - - - - - - - - -
@@ -201,9 +205,8 @@ struct NumericParseUtil {
         // successfully parsed text, or the position at which a parse failure
         // was detected.  Return zero on success, and a non-zero value
         // otherwise.  The value of 'result' is unchanged if a parse failure
-        // occurs.  The behavior is undefined unless the current locale is the
-        // "C" locale, such that 'strcmp(setlocale(0, 0), "C") == 0'.  For more
-        // information see {Floating Point Values}.
+        // occurs.  Note that parsing does not depend on the current locale.
+        // For more information see {Floating Point Values}.
 
     static int parseInt(int                      *result,
                         const bslstl::StringRef&  inputString,
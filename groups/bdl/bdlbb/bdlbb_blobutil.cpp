@@ -56,6 +56,71 @@ void copyFromPlace(char                *dstBuffer,
     } while (copied < length);
 }
 
+template <class VISITOR>
+void visitRange(const bdlbb::Blob&  blob,
+                int                 position,
+                int                 length,
+                VISITOR&            visitor)
+    // Invoke the specified 'visitor' with the address and length of each
+    // contiguous segment, in order, of the specified 'length' bytes starting
+    // at the specified 'position' in the specified 'blob'.  The behavior is
+    // undefined unless '0 <= position', '0 <= length', and
+    // 'position <= blob.length() - length'.
+{
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(position <= blob.length() - length);
+
+    if (0 == length) {
+        return;                                                       // RETURN
+    }
+
+    bsl::pair<int, int> place = bdlbb::BlobUtil::findBufferIndexAndOffset(
+                                                                     blob,
+                                                                     position);
+    do {
+        const bdlbb::BlobBuffer& buf = blob.buffer(place.first);
+        const int                size = bsl::min(length,
+                                                 buf.size() - place.second);
+
+        visitor(buf.data() + place.second, size);
+
+        length -= size;
+        ++place.first;
+        place.second = 0;
+    } while (0 < length);
+}
+
+struct Crc32cVisitor {
+    // This 'struct' accumulates the CRC32-C value of the segments it visits.
+
+    // DATA
+    unsigned int d_crc;  // CRC32-C value of the segments visited so far
+
+    // MANIPULATORS
+    void operator()(const char *data, int length)
+        // Incorporate the specified 'length' bytes at the specified 'data'
+        // into 'd_crc'.
+    {
+        d_crc = bdlde::Crc32c::calculate(data, length, d_crc);
+    }
+};
+
+struct Crc64Visitor {
+    // This 'struct' updates a CRC-64 checksum with the segments it visits.
+
+    // DATA
+    bdlde::Crc64 *d_checksum_p;  // checksum to update (held, not owned)
+
+    // MANIPULATORS
+    void operator()(const char *data, int length)
+        // Incorporate the specified 'length' bytes at the specified 'data'
+        // into '*d_checksum_p'.
+    {
+        d_checksum_p->update(data, length);
+    }
+};
+
 }  // close unnamed namespace
 
 namespace bdlbb {
@@ -574,6 +639,44 @@ bsl::ostream& BlobUtil::hexDump(bsl::ostream& stream,
     return bdlb::Print::hexDump(stream, buffers, numBufferInfo);
 }
 
+unsigned int BlobUtil::calculateCrc32c(const Blob& blob, unsigned int crc)
+{
+    return calculateCrc32c(blob, 0, blob.length(), crc);
+}
+
+unsigned int BlobUtil::calculateCrc32c(const Blob&  blob,
+                                       int          position,
+                                       int          length,
+                                       unsigned int crc)
+{
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(position <= blob.length() - length);
+
+    Crc32cVisitor visitor = { crc };
+    visitRange(blob, position, length, visitor);
+    return visitor.d_crc;
+}
+
+void BlobUtil::updateCrc64(bdlde::Crc64 *checksum, const Blob& blob)
+{
+    updateCrc64(checksum, blob, 0, blob.length());
+}
+
+void BlobUtil::updateCrc64(bdlde::Crc64 *checksum,
+                           const Blob&   blob,
+                           int           position,
+                           int           length)
+{
+    BSLS_ASSERT(checksum);
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(position <= blob.length() - length);
+
+    Crc64Visitor visitor = { checksum };
+    visitRange(blob, position, length, visitor);
+}
+
 int BlobUtil::compare(const Blob& a, const Blob& b)
 {
     // Upon entry, establish 'lhs' and 'rhs' as aliases for 'a' and 'b',
@@ -16,13 +16,25 @@ BSLS_IDENT("$Id: $")
 //@SEE_ALSO: bdlbb_blob
 //
 //@DESCRIPTION: This 'struct' provides a variety of utilities for 'bdlbb::Blob'
-// objects, 'bdlbb::BlobUtil', such as I/O functions, comparison functions, and
-// streaming functions.
+// objects, 'bdlbb::BlobUtil', such as I/O functions, comparison functions,
+// checksum functions, and streaming functions.
+//
+///Checksums
+///---------
+// 'calculateCrc32c' and 'updateCrc64' compute the CRC32-C and CRC-64 checksums
+// of the data of a blob (or of a range of it) directly from its buffers,
+// without first copying the data into contiguous storage.  Each data buffer
+// is handed to the hardware-accelerated implementations of 'bdlde_crc32c' and
+// 'bdlde_crc64' in turn, so the checksum of a blob of large buffers is
+// computed at essentially the speed of a contiguous buffer of the same size.
 
 #include <bdlscm_version.h>
 
 #include <bdlbb_blob.h>
 
+#include <bdlde_crc32c.h>
+#include <bdlde_crc64.h>
+
 #include <bslma_allocator.h>
 
 #include <bsls_assert.h>
@@ -226,6 +238,36 @@ struct BlobUtil {
         // lexicographically less than 'b', and a positive value if 'a' is
         // lexicographically greater than 'b'.
 
+    static unsigned int calculateCrc32c(
+                          const Blob&  blob,
+                          unsigned int crc = bdlde::Crc32c::k_NULL_CRC32C);
+    static unsigned int calculateCrc32c(
+                          const Blob&  blob,
+                          int          position,
+                          int          length,
+                          unsigned int crc = bdlde::Crc32c::k_NULL_CRC32C);
+        // Return the CRC32-C value calculated for the data of the specified
+        // 'blob' (or for the optionally specified 'length' bytes starting at
+        // the optionally specified 'position' in 'blob'), using the
+        // optionally specified 'crc' value as the starting point for the
+        // calculation.  The data is processed in place, one data buffer at a
+        // time, and the result is the same as that of
+        // 'bdlde::Crc32c::calculate' on a contiguous copy of the data.  The
+        // behavior is undefined unless '0 <= position', '0 <= length', and
+        // 'position <= blob.length() - length'.
+
+    static void updateCrc64(bdlde::Crc64 *checksum, const Blob& blob);
+    static void updateCrc64(bdlde::Crc64 *checksum,
+                            const Blob&   blob,
+                            int           position,
+                            int           length);
+        // Update the specified 'checksum' to incorporate the data of the
+        // specified 'blob' (or the specified 'length' bytes starting at the
+        // specified 'position' in 'blob').  The data is processed in place,
+        // one data buffer at a time.  The behavior is undefined unless
+        // '0 <= position', '0 <= length', and
+        // 'position <= blob.length() - length'.
+
     static int appendBufferIfValid(Blob *dest, const BlobBuffer& buffer);
         // Append the specified 'buffer' after the last buffer of the specified
         // 'dest' if neither the resulting total size of 'dest' nor its
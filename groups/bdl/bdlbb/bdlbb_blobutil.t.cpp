@@ -12,6 +12,9 @@
 #include <bdlbb_blob.h>
 #include <bdlbb_simpleblobbufferfactory.h>
 
+#include <bdlde_crc32c.h>
+#include <bdlde_crc64.h>
+
 #include <bdlsb_fixedmemoutstreambuf.h>
 
 #include <bslim_testutil.h>
@@ -25,6 +28,7 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_climits.h>     // 'INT_MIN'
@@ -42,6 +46,10 @@ using namespace bsl;  // automatically added by script
 //=============================================================================
 //                                  TEST PLAN
 //-----------------------------------------------------------------------------
+// [14] unsigned int calculateCrc32c(const Blob&, unsigned int = 0);
+// [14] unsigned int calculateCrc32c(const Blob&, int, int, uint = 0);
+// [14] void updateCrc64(bdlde::Crc64 *, const Blob&);
+// [14] void updateCrc64(bdlde::Crc64 *, const Blob&, int, int);
 // [13] int appendBufferIfValid(Blob *d, const BlobBuffer& b);
 // [13] int appendDataBufferIfValid(Blob *d, const BlobBuffer& );
 // [13] int insertBufferIfValid(Blob *d, int i, const BlobBuffer& b);
@@ -59,6 +67,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] Testing "write special cases"
 //-----------------------------------------------------------------------------
 // [11] CONCERN: append doesn't do excessive 'reserveBufferCapacity'.
+// [-1] CHECKSUM THROUGHPUT
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -391,6 +400,154 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING CHECKSUM FUNCTIONS
+        //
+        // Concerns:
+        //: 1 'calculateCrc32c' and 'updateCrc64' yield the checksum of the
+        //:   data of the blob, i.e., the checksum of a contiguous copy of the
+        //:   data, for any size of blob buffers.
+        //:
+        //: 2 Only the data buffers, and only up to the length of the blob, are
+        //:   incorporated (i.e., capacity beyond the length is ignored).
+        //:
+        //: 3 The range overloads incorporate exactly the specified range,
+        //:   including empty ranges and ranges that start or end in the
+        //:   middle of a buffer or on a buffer boundary.
+        //:
+        //: 4 The optional 'crc' argument of 'calculateCrc32c' is used as the
+        //:   starting point of the calculation.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a variety of buffer sizes, build a blob from a pseudo-random
+        //:   string, leaving spare capacity in the last buffer, and compare
+        //:   the checksums computed on the blob with those computed on the
+        //:   string with 'bdlde::Crc32c' and 'bdlde::Crc64'.  (C-1..2)
+        //:
+        //: 2 For each such blob, compare the checksums of a set of ranges
+        //:   with those of the corresponding substrings, and verify that
+        //:   checksums of consecutive ranges can be chained.  (C-3..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid ranges (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   unsigned int calculateCrc32c(const Blob&, unsigned int = 0);
+        //   unsigned int calculateCrc32c(const Blob&, int, int, uint = 0);
+        //   void updateCrc64(bdlde::Crc64 *, const Blob&);
+        //   void updateCrc64(bdlde::Crc64 *, const Blob&, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING CHECKSUM FUNCTIONS"
+                          << "\n==========================" << endl;
+
+        const int k_LENGTH = 5000;
+
+        bsl::string data(k_LENGTH, '\0');
+        unsigned int seed = 31415;
+        for (int i = 0; i < k_LENGTH; ++i) {
+            seed    = seed * 1103515245 + 12345;
+            data[i] = static_cast<char>(seed >> 16);
+        }
+
+        const int BUFFER_SIZES[] = { 1, 7, 64, 100, 1000, 4096, 8000 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                                        / sizeof *BUFFER_SIZES;
+
+        for (int bi = 0; bi < NUM_BUFFER_SIZES; ++bi) {
+            const int BUFFER_SIZE = BUFFER_SIZES[bi];
+
+            if (veryVerbose) { T_ P(BUFFER_SIZE); }
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+
+            for (int length = 0; length <= k_LENGTH;
+                                 length += 1 + length / 2) {
+                bdlbb::Blob mX(&factory);  const bdlbb::Blob& X = mX;
+                bdlbb::BlobUtil::append(&mX, data.data(), length);
+
+                // Fill the unused capacity so that it would be detected.
+
+                if (0 < X.numDataBuffers()) {
+                    const bdlbb::BlobBuffer& last =
+                                           X.buffer(X.numDataBuffers() - 1);
+                    bsl::memset(last.data() + X.lastDataBufferLength(),
+                                'x',
+                                last.size() - X.lastDataBufferLength());
+                }
+
+                const unsigned int EXP_CRC32C =
+                                 bdlde::Crc32c::calculate(data.data(), length);
+                const bdlde::Crc64 EXP_CRC64(data.data(), length);
+
+                ASSERTV(BUFFER_SIZE, length,
+                        EXP_CRC32C == bdlbb::BlobUtil::calculateCrc32c(X));
+
+                bdlde::Crc64 crc64;
+                bdlbb::BlobUtil::updateCrc64(&crc64, X);
+                ASSERTV(BUFFER_SIZE, length, EXP_CRC64 == crc64);
+
+                // Ranges
+
+                for (int pos = 0; pos <= length; pos += 1 + pos / 3) {
+                    for (int len = 0; len <= length - pos;
+                                      len += 1 + len / 2) {
+                        const unsigned int EXP = bdlde::Crc32c::calculate(
+                                                             data.data() + pos,
+                                                             len);
+
+                        ASSERTV(BUFFER_SIZE, length, pos, len,
+                                EXP == bdlbb::BlobUtil::calculateCrc32c(X,
+                                                                        pos,
+                                                                        len));
+
+                        bdlde::Crc64 rangeCrc64;
+                        bdlbb::BlobUtil::updateCrc64(&rangeCrc64, X, pos, len);
+                        ASSERTV(BUFFER_SIZE, length, pos, len,
+                                bdlde::Crc64(data.data() + pos, len) ==
+                                                                   rangeCrc64);
+                    }
+
+                    // Chain the checksums of '[0, pos)' and '[pos, length)'.
+
+                    const unsigned int prefix =
+                               bdlbb::BlobUtil::calculateCrc32c(X, 0, pos);
+                    ASSERTV(BUFFER_SIZE, length, pos,
+                            EXP_CRC32C == bdlbb::BlobUtil::calculateCrc32c(
+                                                                 X,
+                                                                 pos,
+                                                                 length - pos,
+                                                                 prefix));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(8);
+            bdlbb::Blob                    mX(&factory);
+            const bdlbb::Blob&             X = mX;
+            bdlbb::BlobUtil::append(&mX, data.data(), 20);
+
+            bdlde::Crc64 crc64;
+
+            ASSERT_PASS(bdlbb::BlobUtil::calculateCrc32c(X, 0, 20));
+            ASSERT_PASS(bdlbb::BlobUtil::calculateCrc32c(X, 20, 0));
+            ASSERT_FAIL(bdlbb::BlobUtil::calculateCrc32c(X, -1, 5));
+            ASSERT_FAIL(bdlbb::BlobUtil::calculateCrc32c(X, 0, -1));
+            ASSERT_FAIL(bdlbb::BlobUtil::calculateCrc32c(X, 16, 5));
+
+            ASSERT_PASS(bdlbb::BlobUtil::updateCrc64(&crc64, X, 0, 20));
+            ASSERT_FAIL(bdlbb::BlobUtil::updateCrc64(0, X, 0, 20));
+            ASSERT_FAIL(bdlbb::BlobUtil::updateCrc64(&crc64, X, 16, 5));
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING SAFE BUFFER ADD FUNCTIONS
@@ -3130,6 +3287,90 @@ int main(int argc, char *argv[])
 
         if (verbose) cout << "\nEnd of Test." << endl;
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // CHECKSUM THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput (in GB/s) of 'calculateCrc32c' and
+        //:   'updateCrc64' on blobs of various buffer sizes, compared with
+        //:   copying the data into a contiguous buffer first.
+        //
+        // Plan:
+        //: 1 For a 16 MiB blob built with buffers of 4 KiB, 64 KiB and
+        //:   1 MiB, time repeated checksum calculations on the blob and on a
+        //:   contiguous copy, and report the throughput.  (C-1)
+        //
+        // Testing:
+        //   CHECKSUM THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCHECKSUM THROUGHPUT"
+                          << "\n===================" << endl;
+
+        const int k_LENGTH     = 16 << 20;
+        const int k_NUM_ITERS  = 64;
+        const int BUFFER_SIZES[] = { 4 << 10, 64 << 10, 1 << 20 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                                        / sizeof *BUFFER_SIZES;
+
+        bsl::string data(k_LENGTH, '\0');
+        for (int i = 0; i < k_LENGTH; ++i) {
+            data[i] = static_cast<char>(i * 31 + (i >> 8));
+        }
+        bsl::string copy(k_LENGTH, '\0');
+
+        const double k_GB = static_cast<double>(k_LENGTH) * k_NUM_ITERS
+                                                                      / 1.0e9;
+
+        unsigned int result = 0;
+
+        cout << "Buffer(B)\tCRC32-C (GB/s)\tcopy+CRC32-C (GB/s)"
+                "\tCRC-64 (GB/s)" << endl;
+
+        for (int bi = 0; bi < NUM_BUFFER_SIZES; ++bi) {
+            const int BUFFER_SIZE = BUFFER_SIZES[bi];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+            bdlbb::Blob                    blob(&factory);
+            bdlbb::BlobUtil::append(&blob, data.data(), k_LENGTH);
+
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int i = 0; i < k_NUM_ITERS; ++i) {
+                result ^= bdlbb::BlobUtil::calculateCrc32c(blob);
+            }
+            timer.stop();
+            const double crc32cRate = k_GB / timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < k_NUM_ITERS; ++i) {
+                bdlbb::BlobUtil::copy(&copy[0], blob, 0, k_LENGTH);
+                result ^= bdlde::Crc32c::calculate(copy.data(), k_LENGTH);
+            }
+            timer.stop();
+            const double copyRate = k_GB / timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < k_NUM_ITERS; ++i) {
+                bdlde::Crc64 crc64;
+                bdlbb::BlobUtil::updateCrc64(&crc64, blob);
+                result ^= static_cast<unsigned int>(crc64.checksum());
+            }
+            timer.stop();
+            const double crc64Rate = k_GB / timer.elapsedTime();
+
+            cout << BUFFER_SIZE << '\t' << crc32cRate << '\t' << copyRate
+                 << '\t' << crc64Rate << endl;
+        }
+
+        if (veryVerbose) {
+            cout << "result: " << result << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -48,6 +48,12 @@ BSLS_IDENT("$Id: $")
 // before using 'bdlc::FlatHashMap' -- particulary on non-Intel production
 // environments.
 //
+// When many keys are looked up at once in a map much larger than the
+// processor caches, 'findBulk' can be used in place of repeated calls to
+// 'find'; it hashes a batch of keys and prefetches the memory each lookup will
+// read before searching for any key of the batch, overlapping the resulting
+// cache misses.
+//
 ///Interface Differences with 'unordered_map'
 ///------------------------------------------
 // A 'bdlc::FlatHashMap' meets most of the requirements of an unordered
@@ -610,6 +616,15 @@ class FlatHashMap {
         // having the specified 'key', or 'end()' if no such entry exists in
         // this map.
 
+    void findBulk(iterator *results, const KEY *keys, bsl::size_t numKeys);
+        // Load into the specified 'results' an iterator referring to the
+        // modifiable element in this map having each of the specified
+        // 'numKeys' elements of the specified 'keys' array, or 'end()' for
+        // each key not present (i.e., 'results[i]' is 'find(keys[i])').  The
+        // memory to be searched for several keys is prefetched before any of
+        // them is searched for.  The behavior is undefined unless 'results'
+        // and 'keys' each have at least 'numKeys' elements.
+
 #if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
     template <class VALUE_TYPE>
     bsl::pair<iterator, bool> insert(
@@ -733,6 +748,17 @@ class FlatHashMap {
         // having the specified 'key', or 'end()' if no such entry exists in
         // this map.
 
+    void findBulk(const_iterator *results,
+                  const KEY      *keys,
+                  bsl::size_t     numKeys) const;
+        // Load into the specified 'results' a 'const_iterator' referring to
+        // the element in this map having each of the specified 'numKeys'
+        // elements of the specified 'keys' array, or 'end()' for each key not
+        // present (i.e., 'results[i]' is 'find(keys[i])').  The memory to be
+        // searched for several keys is prefetched before any of them is
+        // searched for.  The behavior is undefined unless 'results' and 'keys'
+        // each have at least 'numKeys' elements.
+
     HASH hash_function() const;
         // Return (a copy of) the unary hash functor used by this map to
         // generate a hash value (of type 'bsl::size_t') for a 'KEY' object.
@@ -1189,6 +1215,15 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::findBulk(iterator    *results,
+                                                    const KEY   *keys,
+                                                    bsl::size_t  numKeys)
+{
+    d_impl.findBulk(results, keys, numKeys);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 template <class INPUT_ITERATOR>
 void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
@@ -1301,6 +1336,16 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::findBulk(
+                                             const_iterator *results,
+                                             const KEY      *keys,
+                                             bsl::size_t     numKeys) const
+{
+    d_impl.findBulk(results, keys, numKeys);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
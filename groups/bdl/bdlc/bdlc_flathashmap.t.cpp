@@ -138,6 +138,7 @@ using namespace bsl;
 // [17] iterator erase(iterator);
 // [18] iterator erase(const_iterator, const_iterator);
 // [24] iterator find(const KEY& key);
+// [27] void findBulk(iterator *, const KEY *, size_t);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) entry)
 // [16] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
 // #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
@@ -157,6 +158,7 @@ using namespace bsl;
 // [11] bool empty() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [ 4] const_iterator find(const KEY&) const;
+// [27] void findBulk(const_iterator *, const KEY *, size_t) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
@@ -177,7 +179,7 @@ using namespace bsl;
 // FREE FUNCTIONS
 // [ 8] void swap(FlatHashMap&, FlatHashMap&);
 // ----------------------------------------------------------------------------
-// [27] USAGE EXAMPLE
+// [28] USAGE EXAMPLE
 // [26] CONCERN: 'FlatHashMap' has the necessary type traits
 // [ 1] BREATHING TEST
 // [-1] PERFORMANCE TEST
@@ -244,6 +246,11 @@ void aSsErT(bool condition, const char *message, int line)
 
 const bsl::uint8_t k_SIZE = bdlc::FlatHashTable_GroupControl::k_SIZE;
 
+// The explicit capacities (e.g., 32 and 64) supplied by the test cases must be
+// at least the minimum non-zero capacity of a table, '2 * k_SIZE'.
+
+BSLMF_ASSERT(2 * k_SIZE <= 32);
+
 // ============================================================================
 //                     GLOBAL VARIABLES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -957,7 +964,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 27: {
+      case 28: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1105,6 +1112,67 @@ int main(int argc, char *argv[])
 //  among         3
 //..
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // 'findBulk'
+        //   Ensure the 'findBulk' methods operate as expected.
+        //
+        // Concerns:
+        //: 1 The 'findBulk' methods correctly forward to the underlying
+        //:   implementation, and each result is identical to the result of
+        //:   'find' for the corresponding key.
+        //:
+        //: 2 The iterators loaded by the non-'const' method provide modifiable
+        //:   access to the mapped values.
+        //
+        // Plan:
+        //: 1 Invoke both 'findBulk' methods on present and absent keys for an
+        //:   object with a number of elements, and compare the results with
+        //:   those of 'find'.  (C-1)
+        //:
+        //: 2 Assign a value through an iterator loaded by the non-'const'
+        //:   method and verify the value using 'find'.  (C-2)
+        //
+        // Testing:
+        //   void findBulk(iterator *, const KEY *, size_t);
+        //   void findBulk(const_iterator *, const KEY *, size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'findBulk'" << endl
+                          << "==========" << endl;
+
+        typedef bdlc::FlatHashMap<int, int> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 100; ++i) {
+            mX.insert(bsl::make_pair(2 * i, i));
+        }
+
+        int keys[50];
+        for (int i = 0; i < 50; ++i) {
+            keys[i] = 3 * i;
+        }
+
+        Obj::iterator       results[50];
+        Obj::const_iterator cresults[50];
+
+        mX.findBulk(results, keys, 50);
+        X.findBulk(cresults, keys, 50);
+
+        for (int i = 0; i < 50; ++i) {
+            LOOP_ASSERT(i, mX.find(keys[i]) == results[i]);
+            LOOP_ASSERT(i, X.find(keys[i])  == cresults[i]);
+            LOOP_ASSERT(i, (0 == keys[i] % 2) == (X.end() != cresults[i]));
+        }
+
+        results[0]->second = 1000;
+
+        ASSERT(1000 == X.find(0)->second);
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // TYPE TRAITS
@@ -47,6 +47,12 @@ BSLS_IDENT("$Id: $")
 // before using 'bdlc::FlatHashSet' -- particulary on non-Intel production
 // environments.
 //
+// When many keys are looked up at once in a set much larger than the
+// processor caches, 'findBulk' can be used in place of repeated calls to
+// 'find'; it hashes a batch of keys and prefetches the memory each lookup will
+// read before searching for any key of the batch, overlapping the resulting
+// cache misses.
+//
 ///Interface Differences with 'bsl::unordered_set'
 ///-----------------------------------------------
 // A 'bdlc::FlatHashSet' meets most of the requirements of an unordered
@@ -817,6 +823,17 @@ class FlatHashSet {
         // having the specified 'key', or 'end()' if no such entry exists in
         // this set.
 
+    void findBulk(const_iterator *results,
+                  const KEY      *keys,
+                  bsl::size_t     numKeys) const;
+        // Load into the specified 'results' a 'const_iterator' referring to
+        // the element in this set having each of the specified 'numKeys'
+        // elements of the specified 'keys' array, or 'end()' for each key not
+        // present (i.e., 'results[i]' is 'find(keys[i])').  The memory to be
+        // searched for several keys is prefetched before any of them is
+        // searched for.  The behavior is undefined unless 'results' and 'keys'
+        // each have at least 'numKeys' elements.
+
     HASH hash_function() const;
         // Return (a copy of) the unary hash functor used by this set to
         // generate a hash value (of type 'bsl::size_t') for a 'KEY' object.
@@ -1321,6 +1338,15 @@ typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
     return d_impl.find(key);
 }
 
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::findBulk(const_iterator *results,
+                                             const KEY      *keys,
+                                             bsl::size_t     numKeys) const
+{
+    d_impl.findBulk(results, keys, numKeys);
+}
+
 template <class KEY, class HASH, class EQUAL>
 inline
 HASH FlatHashSet<KEY, HASH, EQUAL>::hash_function() const
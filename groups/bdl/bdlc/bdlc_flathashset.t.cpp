@@ -150,6 +150,7 @@ using namespace bsl;
 // [11] bool empty() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [ 4] const_iterator find(const KEY&) const;
+// [25] void findBulk(const_iterator *, const KEY *, size_t) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
@@ -170,7 +171,7 @@ using namespace bsl;
 // FREE FUNCTIONS
 // [ 8] void swap(FlatHashSet&, FlatHashSet&);
 // ----------------------------------------------------------------------------
-// [25] USAGE EXAMPLE
+// [26] USAGE EXAMPLE
 // [24] CONCERN: 'FlatHashMap' has the necessary type traits
 // [ 1] BREATHING TEST
 // [-1] PERFORMANCE TEST
@@ -237,6 +238,11 @@ void aSsErT(bool condition, const char *message, int line)
 
 const bsl::uint8_t k_SIZE = bdlc::FlatHashTable_GroupControl::k_SIZE;
 
+// The explicit capacities (e.g., 32 and 64) supplied by the test cases must be
+// at least the minimum non-zero capacity of a table, '2 * k_SIZE'.
+
+BSLMF_ASSERT(2 * k_SIZE <= 32);
+
 // ============================================================================
 //                     GLOBAL VARIABLES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1184,7 +1190,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 25: {
+      case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1232,6 +1238,53 @@ int main(int argc, char *argv[])
 //  100 84
 //..
       } break;
+      case 25: {
+        // --------------------------------------------------------------------
+        // 'findBulk'
+        //   Ensure the 'findBulk' method operates as expected.
+        //
+        // Concerns:
+        //: 1 The 'findBulk' method correctly forwards to the underlying
+        //:   implementation, and each result is identical to the result of
+        //:   'find' for the corresponding key.
+        //
+        // Plan:
+        //: 1 Invoke 'findBulk' on present and absent keys for an object with a
+        //:   number of elements, and compare the results with those of
+        //:   'find'.  (C-1)
+        //
+        // Testing:
+        //   void findBulk(const_iterator *, const KEY *, size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'findBulk'" << endl
+                          << "==========" << endl;
+
+        typedef bdlc::FlatHashSet<int> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 100; ++i) {
+            mX.insert(2 * i);
+        }
+
+        int keys[50];
+        for (int i = 0; i < 50; ++i) {
+            keys[i] = 3 * i;
+        }
+
+        Obj::const_iterator results[50];
+
+        X.findBulk(results, keys, 50);
+
+        for (int i = 0; i < 50; ++i) {
+            LOOP_ASSERT(i, X.find(keys[i]) == results[i]);
+            LOOP_ASSERT(i, (0 == keys[i] % 2) == (X.end() != results[i]));
+        }
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // TYPE TRAITS
@@ -85,6 +85,31 @@ BSLS_IDENT("$Id: $")
 // If support for 'operator==' is required, the type 'ENTRY' must be
 // equality-comparable.
 //
+///Bulk Lookup
+///-----------
+// For a table much larger than the processor caches, the time to 'find' a key
+// is dominated by the cache misses incurred reading the key's group of control
+// values and then the matching entry.  When many keys are to be looked up
+// together, the 'findBulk' methods can hide much of this latency: the keys
+// are processed in small batches, and, for each batch, all of the keys are
+// hashed and the memory at the start of each key's probe sequence is
+// prefetched before any of the keys is searched for.  The results are
+// identical to invoking 'find' on each key in turn.
+//
+///Group Control
+///-------------
+// The control values of a table are examined a group at a time by the
+// (template parameter) type 'GROUP_CONTROL', which defaults to
+// 'bdlc::FlatHashTable_GroupControl' (a group of 16 control values on
+// platforms supporting SSE2, and 8 otherwise).  'bdlc::FlatHashMap',
+// 'bdlc::FlatHashSet', and 'bdlc::NodeHashMap' always use the default.  When
+// AVX2 is enabled for the build, 'bdlc::FlatHashTable_WideGroupControl' (a
+// group of 32 control values) may be supplied explicitly; the group size
+// determines the layout of the control values (and the minimum non-zero
+// capacity, 'k_MIN_CAPACITY'), so a table having the wide group is a distinct
+// type from one having the default group.  See
+// 'bdlc_flathashtable_groupcontrol' for details.
+//
 ///Iterator, Pointer, and Reference Invalidation
 ///---------------------------------------------
 // Any change in capacity of a 'bdlc::FlatHashTable' invalidates all pointers,
@@ -278,13 +303,20 @@ bool operator==(const FlatHashTable_IteratorImp<ENTRY>& a,
                            // class FlatHashTable
                            // ===================
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL = FlatHashTable_GroupControl>
 class FlatHashTable
     // This class template provides a flat hash table implementation useful for
-    // implementing a flat hash set and flat hash map.
+    // implementing a flat hash set and flat hash map.  The (template
+    // parameter) type 'GROUP_CONTROL' determines the number of control values
+    // examined per inquiry (see {Group Control}).
 {
     // PRIVATE TYPES
-    typedef FlatHashTable_GroupControl       GroupControl;
+    typedef GROUP_CONTROL                    GroupControl;
     typedef FlatHashTable_IteratorImp<ENTRY> IteratorImp;
 
   public:
@@ -301,6 +333,11 @@ class FlatHashTable
                                              IteratorImp> const_iterator;
 
   private:
+    // PRIVATE CLASS DATA
+    static const bsl::size_t k_BULK_BATCH_SIZE = 16;
+                                     // number of keys hashed and prefetched
+                                     // ahead of being searched by 'findBulk'
+
     // DATA
     ENTRY            *d_entries_p;          // entries of this table
     bsl::uint8_t     *d_controls_p;         // control values of this table
@@ -356,6 +393,20 @@ class FlatHashTable
         // 'd_capacity' if the 'key' is not present.  The behavior is undefined
         // unless 'hashValue == d_hasher(key)'.
 
+    void findKeysBulk(bsl::size_t *indices,
+                      const KEY   *keys,
+                      bsl::size_t  numKeys) const;
+        // Load into the specified 'indices' the result of 'findKey' for each
+        // of the specified 'numKeys' elements of the specified 'keys' array
+        // (i.e., 'indices[i]' is the index of the entry containing 'keys[i]',
+        // or 'd_capacity' if 'keys[i]' is not present).  The keys are
+        // processed in batches of (at most) 'k_BULK_BATCH_SIZE' keys; the
+        // hash values of the keys in a batch are computed, and the first
+        // control values and entries of their probe sequences prefetched,
+        // before the keys of the batch are searched for.  The behavior is
+        // undefined unless 'indices' and 'keys' each have at least 'numKeys'
+        // elements.
+
     bsl::size_t minimumCompliantCapacity(bsl::size_t minimumCapacity) const;
         // Return the minimum capacity that satisfies all class invariants, and
         // is at least the specified 'minimumCapacity'.
@@ -502,6 +553,16 @@ class FlatHashTable
         // flat hash table with a key equal to the specified 'key', if such an
         // entry exists, and 'end()' otherwise.
 
+    void findBulk(iterator *results, const KEY *keys, bsl::size_t numKeys);
+        // Load into the specified 'results' an iterator providing modifiable
+        // access to the object in this flat hash table with a key equal to
+        // each of the specified 'numKeys' elements of the specified 'keys'
+        // array, or 'end()' for each key not present (i.e., 'results[i]' is
+        // 'find(keys[i])').  Memory for several keys is prefetched before
+        // they are searched for (see {Bulk Lookup}).  The behavior is
+        // undefined unless 'results' and 'keys' each have at least 'numKeys'
+        // elements.
+
 #if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
     template <class ENTRY_TYPE>
     bsl::pair<iterator, bool> insert(
@@ -656,6 +717,18 @@ class FlatHashTable
         // flat hash table having the specified 'key', or 'end()' if no such
         // entry exists in this table.
 
+    void findBulk(const_iterator *results,
+                  const KEY      *keys,
+                  bsl::size_t     numKeys) const;
+        // Load into the specified 'results' an iterator representing the
+        // position of the entry in this flat hash table having each of the
+        // specified 'numKeys' elements of the specified 'keys' array, or
+        // 'end()' for each key not present (i.e., 'results[i]' is
+        // 'find(keys[i])').  Memory for several keys is prefetched before
+        // they are searched for (see {Bulk Lookup}).  The behavior is
+        // undefined unless 'results' and 'keys' each have at least 'numKeys'
+        // elements.
+
     HASH hash_function() const;
         // Return (a copy of) the unary hash functor used by this flat hash
         // table to generate a hash value (of type 'bsl::size_t) for a 'KEY'
@@ -700,9 +773,24 @@ class FlatHashTable
 };
 
 // FREE OPERATORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-bool operator==(const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
-                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+bool operator==(const FlatHashTable<KEY,
+                                    ENTRY,
+                                    ENTRY_UTIL,
+                                    HASH,
+                                    EQUAL,
+                                    GROUP_CONTROL>& lhs,
+                const FlatHashTable<KEY,
+                                    ENTRY,
+                                    ENTRY_UTIL,
+                                    HASH,
+                                    EQUAL,
+                                    GROUP_CONTROL>& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
     // value, and 'false' otherwise.  Two 'FlatHashTable' objects have the same
     // value if they have the same number of entries, and for each entry that
@@ -710,9 +798,24 @@ bool operator==(const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
     // same value.  Note that this method requires the (template parameter)
     // type 'ENTRY' to be equality-comparable.
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-bool operator!=(const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
-                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+bool operator!=(const FlatHashTable<KEY,
+                                    ENTRY,
+                                    ENTRY_UTIL,
+                                    HASH,
+                                    EQUAL,
+                                    GROUP_CONTROL>& lhs,
+                const FlatHashTable<KEY,
+                                    ENTRY,
+                                    ENTRY_UTIL,
+                                    HASH,
+                                    EQUAL,
+                                    GROUP_CONTROL>& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
     // same value, and 'false' otherwise.  Two 'FlatHashTable' objects do not
     // have the same value if they do not have the same number of entries, or
@@ -721,9 +824,24 @@ bool operator!=(const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
     // parameter) type 'ENTRY' to be equality-comparable.
 
 // FREE FUNCTIONS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-void swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
-          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b);
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+void swap(FlatHashTable<KEY,
+                        ENTRY,
+                        ENTRY_UTIL,
+                        HASH,
+                        EQUAL,
+                        GROUP_CONTROL>& a,
+          FlatHashTable<KEY,
+                        ENTRY,
+                        ENTRY_UTIL,
+                        HASH,
+                        EQUAL,
+                        GROUP_CONTROL>& b);
     // Exchange the values of the specified 'a' and 'b' objects.  This function
     // provides the no-throw exception-safety guarantee if the two objects were
     // created with the same allocator and the basic guarantee otherwise.
@@ -861,8 +979,18 @@ namespace bdlc {
                            // -------------------
 
 // PRIVATE CLASS METHODS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+bsl::size_t FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL>::findAvailable(
                                                         bsl::uint8_t *controls,
                                                         bsl::size_t   index,
                                                         bsl::size_t   capacity)
@@ -888,8 +1016,18 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
 }
 
 // PRIVATE MANIPULATORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clearEntriesRaw()
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+void FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::clearEntriesRaw()
 {
     for (bsl::size_t i = 0; i < d_capacity; i += GroupControl::k_SIZE) {
         bsl::uint8_t *controlStart = d_controls_p + i;
@@ -905,12 +1043,18 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clearEntriesRaw()
     }
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 bsl::size_t FlatHashTable<KEY,
                           ENTRY,
                           ENTRY_UTIL,
                           HASH,
-                          EQUAL>::indexOfKey(bool        *notFound,
+                          EQUAL,
+                          GROUP_CONTROL>::indexOfKey(bool        *notFound,
                                              const KEY&   key,
                                              bsl::size_t  hashValue)
 {
@@ -936,8 +1080,18 @@ bsl::size_t FlatHashTable<KEY,
     return index;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+void FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::rehashRaw(
                                                        bsl::size_t newCapacity)
 {
     BSLS_ASSERT_SAFE(          0 <  newCapacity);
@@ -1003,8 +1157,18 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
 }
 
 // PRIVATE ACCESSORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+bsl::size_t FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL>::findKey(
                                                    const KEY&  key,
                                                    bsl::size_t hashValue) const
 {
@@ -1041,12 +1205,70 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
     return d_capacity;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+void FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::findKeysBulk(
+                                             bsl::size_t *indices,
+                                             const KEY   *keys,
+                                             bsl::size_t  numKeys) const
+{
+    BSLS_ASSERT_SAFE(indices || 0 == numKeys);
+    BSLS_ASSERT_SAFE(keys    || 0 == numKeys);
+
+    if (0 == d_capacity) {
+        for (bsl::size_t i = 0; i < numKeys; ++i) {
+            indices[i] = d_capacity;
+        }
+        return;                                                       // RETURN
+    }
+
+    bsl::size_t hashValues[k_BULK_BATCH_SIZE];
+
+    for (bsl::size_t base = 0; base < numKeys; base += k_BULK_BATCH_SIZE) {
+        const bsl::size_t batchSize = numKeys - base < k_BULK_BATCH_SIZE
+                                    ? numKeys - base
+                                    : k_BULK_BATCH_SIZE;
+
+        const KEY *batchKeys = keys + base;
+
+        for (bsl::size_t i = 0; i < batchSize; ++i) {
+            const bsl::size_t hashValue = d_hasher(batchKeys[i]);
+            const bsl::size_t index     = (hashValue >> d_groupControlShift)
+                                                        * GroupControl::k_SIZE;
+
+            hashValues[i] = hashValue;
+
+            bsls::PerformanceHint::prefetchForReading(d_controls_p + index);
+            bsls::PerformanceHint::prefetchForReading(d_entries_p  + index);
+        }
+
+        for (bsl::size_t i = 0; i < batchSize; ++i) {
+            indices[base + i] = findKey(batchKeys[i], hashValues[i]);
+        }
+    }
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 bsl::size_t FlatHashTable<KEY,
                           ENTRY,
                           ENTRY_UTIL,
                           HASH,
-                          EQUAL>::minimumCompliantCapacity(
+                          EQUAL,
+                          GROUP_CONTROL>::minimumCompliantCapacity(
                                              bsl::size_t minimumCapacity) const
 {
     bsl::size_t minForEntries = ((d_size + k_MAX_LOAD_FACTOR_NUMERATOR - 1)
@@ -1068,9 +1290,19 @@ bsl::size_t FlatHashTable<KEY,
 }
 
 // CREATORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::FlatHashTable(
                                               bsl::size_t       capacity,
                                               const HASH&       hash,
                                               const EQUAL&      equal,
@@ -1111,9 +1343,19 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
     }
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::FlatHashTable(
                                           const FlatHashTable&  original,
                                           bslma::Allocator     *basicAllocator)
 : d_entries_p(0)
@@ -1140,12 +1382,7 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
         controlsProctor.release();
 
         if (false == bsl::is_trivially_copyable<ENTRY>::value) {
-            FlatHashTable_ResetProctor<
-                                     FlatHashTable<KEY,
-                                                   ENTRY,
-                                                   ENTRY_UTIL,
-                                                   HASH,
-                                                   EQUAL> > resetProctor(this);
+            FlatHashTable_ResetProctor<FlatHashTable> resetProctor(this);
 
             for (bsl::size_t i = 0; i < d_capacity; ++i) {
                 if (0 == (original.d_controls_p[i] & k_AVAIL_MASK)) {
@@ -1172,9 +1409,19 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
     }
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::FlatHashTable(
                                      bslmf::MovableRef<FlatHashTable> original)
 : d_entries_p(bslmf::MovableRefUtil::access(original).d_entries_p)
 , d_controls_p(bslmf::MovableRefUtil::access(original).d_controls_p)
@@ -1195,8 +1442,18 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
     reference.d_groupControlShift = 0;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::FlatHashTable(
                               bslmf::MovableRef<FlatHashTable>  original,
                               bslma::Allocator                 *basicAllocator)
 : d_entries_p(0)
@@ -1235,12 +1492,7 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
         controlsProctor.release();
 
         if (false == bsl::is_trivially_copyable<ENTRY>::value) {
-            FlatHashTable_ResetProctor<
-                                     FlatHashTable<KEY,
-                                                   ENTRY,
-                                                   ENTRY_UTIL,
-                                                   HASH,
-                                                   EQUAL> > resetProctor(this);
+            FlatHashTable_ResetProctor<FlatHashTable> resetProctor(this);
 
             for (bsl::size_t i = 0; i < d_capacity; ++i) {
                 bsl::uint8_t control = reference.d_controls_p[i];
@@ -1291,9 +1543,19 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
     }
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::~FlatHashTable()
 {
     if (0 != d_entries_p) {
         if (false == bsl::is_trivially_copyable<ENTRY>::value) {
@@ -1305,10 +1567,15 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
 }
 
 // MANIPULATORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::operator=(
                                                       const FlatHashTable& rhs)
 {
     if (this != &rhs) {
@@ -1318,10 +1585,15 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
     return *this;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::operator=(
                                           bslmf::MovableRef<FlatHashTable> rhs)
 {
     FlatHashTable& reference = rhs;
@@ -1333,10 +1605,20 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
     return *this;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 template <class KEY_TYPE>
 inline
-ENTRY& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator[](
+ENTRY& FlatHashTable<KEY,
+                     ENTRY,
+                     ENTRY_UTIL,
+                     HASH,
+                     EQUAL,
+                     GROUP_CONTROL>::operator[](
                                BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
 {
     bool        notFound;
@@ -1361,9 +1643,14 @@ ENTRY& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator[](
     return d_entries_p[index];
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::clear()
 {
     if (false == bsl::is_trivially_copyable<ENTRY>::value) {
         clearEntriesRaw();
@@ -1372,12 +1659,32 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
     d_size = 0;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
 bsl::pair<
-         typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
-         typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator>
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(const KEY& key)
+         typename FlatHashTable<KEY,
+                                ENTRY,
+                                ENTRY_UTIL,
+                                HASH,
+                                EQUAL,
+                                GROUP_CONTROL>::iterator,
+         typename FlatHashTable<KEY,
+                                ENTRY,
+                                ENTRY_UTIL,
+                                HASH,
+                                EQUAL,
+                                GROUP_CONTROL>::iterator>
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::equal_range(const KEY& key)
 {
     iterator it1 = find(key);
     if (it1 == end()) {
@@ -1388,9 +1695,19 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(const KEY& key)
     return bsl::make_pair(it1, it2);
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+bsl::size_t FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL>::erase(
                                                                 const KEY& key)
 {
     iterator it = find(key);
@@ -1401,15 +1718,21 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
     return 1;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
-                        typename FlatHashTable<KEY,
-                                               ENTRY,
-                                               ENTRY_UTIL,
-                                               HASH,
-                                               EQUAL>::const_iterator position)
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::erase(
+                                                       const_iterator position)
 {
     BSLS_ASSERT_SAFE(position != end());
 
@@ -1430,15 +1753,21 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
     return iterator();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
-                        typename FlatHashTable<KEY,
-                                               ENTRY,
-                                               ENTRY_UTIL,
-                                               HASH,
-                                               EQUAL>::iterator position)
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::erase(
+                                                             iterator position)
 {
     // Note that this overload is necessary to avoid ambiguity when the key is
     // a table iterator.
@@ -1462,19 +1791,21 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
     return iterator();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
-                           typename FlatHashTable<KEY,
-                                                  ENTRY,
-                                                  ENTRY_UTIL,
-                                                  HASH,
-                                                  EQUAL>::const_iterator first,
-                           typename FlatHashTable<KEY,
-                                                  ENTRY,
-                                                  ENTRY_UTIL,
-                                                  HASH,
-                                                  EQUAL>::const_iterator last)
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
 {
     iterator rv;
     {
@@ -1496,10 +1827,25 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
     return rv;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::iterator
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::find(const KEY& key)
 {
     bsl::size_t index = findKey(key, d_hasher(key));
     if (index < d_capacity) {
@@ -1510,10 +1856,55 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
     return end();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+void FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::findBulk(
+                                                   iterator    *results,
+                                                   const KEY   *keys,
+                                                   bsl::size_t  numKeys)
+{
+    BSLS_ASSERT_SAFE(results || 0 == numKeys);
+    BSLS_ASSERT_SAFE(keys    || 0 == numKeys);
+
+    bsl::size_t indices[k_BULK_BATCH_SIZE];
+
+    for (bsl::size_t base = 0; base < numKeys; base += k_BULK_BATCH_SIZE) {
+        const bsl::size_t batchSize = numKeys - base < k_BULK_BATCH_SIZE
+                                    ? numKeys - base
+                                    : k_BULK_BATCH_SIZE;
+
+        findKeysBulk(indices, keys + base, batchSize);
+
+        for (bsl::size_t i = 0; i < batchSize; ++i) {
+            const bsl::size_t index = indices[i];
+
+            results[base + i] = index < d_capacity
+                              ? iterator(IteratorImp(d_entries_p  + index,
+                                                     d_controls_p + index,
+                                                     d_capacity - index - 1))
+                              : end();
+        }
+    }
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 template <class INPUT_ITERATOR>
 inline
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::insert(
                                                           INPUT_ITERATOR first,
                                                           INPUT_ITERATOR last)
 {
@@ -1522,9 +1913,14 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
     }
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::rehash(
                                                    bsl::size_t minimumCapacity)
 {
     minimumCapacity = minimumCompliantCapacity(minimumCapacity);
@@ -1542,9 +1938,19 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
     }
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+void FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::reserve(
                                                         bsl::size_t numEntries)
 {
     bsl::size_t minForEntries = ((numEntries + k_MAX_LOAD_FACTOR_NUMERATOR - 1)
@@ -1554,9 +1960,14 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
     rehash(minForEntries);
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reset()
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::reset()
 {
     if (0 != d_entries_p) {
         if (false == bsl::is_trivially_copyable<ENTRY>::value) {
@@ -1574,10 +1985,20 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reset()
 
                             // Iterators
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::begin()
 {
     if (d_size) {
         for (bsl::size_t i = 0; i < d_capacity; ++i) {
@@ -1591,19 +2012,34 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
     return iterator();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::end()
 {
     return iterator();
 }
 
                            // Aspects
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::swap(
                                                           FlatHashTable& other)
 {
     BSLS_ASSERT_SAFE(allocator() == other.allocator());
@@ -1618,72 +2054,126 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
 }
 
 // ACCESSORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::
                                                                capacity() const
 {
     return d_capacity;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::contains(
+bool FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::contains(
                                                           const KEY& key) const
 {
     return find(key) != end();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
 const bsl::uint8_t *FlatHashTable<KEY,
                                   ENTRY,
                                   ENTRY_UTIL,
                                   HASH,
-                                  EQUAL>::controls() const
+                                  EQUAL,
+                                  GROUP_CONTROL>::controls() const
 {
     return d_controls_p;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::count(
+bsl::size_t FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL>::count(
                                                           const KEY& key) const
 {
     return contains(key) ? 1 : 0;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::empty() const
+bool FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::empty() const
 {
     return 0 == d_size;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
 const ENTRY *FlatHashTable<KEY,
                            ENTRY,
                            ENTRY_UTIL,
                            HASH,
-                           EQUAL>::entries() const
+                           EQUAL,
+                           GROUP_CONTROL>::entries() const
 {
     return d_entries_p;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
 bsl::pair<typename FlatHashTable<KEY,
                                  ENTRY,
                                  ENTRY_UTIL,
                                  HASH,
-                                 EQUAL>::const_iterator,
+                                 EQUAL,
+                                 GROUP_CONTROL>::const_iterator,
           typename FlatHashTable<KEY,
                                  ENTRY,
                                  ENTRY_UTIL,
                                  HASH,
-                                 EQUAL>::const_iterator>
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(
+                                 EQUAL,
+                                 GROUP_CONTROL>::const_iterator>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::equal_range(
                                                           const KEY& key) const
 {
     const_iterator cit1 = find(key);
@@ -1694,10 +2184,25 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(
     return bsl::make_pair(cit1, cit2);
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::const_iterator
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::find(const KEY& key) const
 {
     bsl::size_t index = findKey(key, d_hasher(key));
     if (index < d_capacity) {
@@ -1708,58 +2213,155 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
     return end();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+void FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::findBulk(
+                                             const_iterator *results,
+                                             const KEY      *keys,
+                                             bsl::size_t     numKeys) const
+{
+    BSLS_ASSERT_SAFE(results || 0 == numKeys);
+    BSLS_ASSERT_SAFE(keys    || 0 == numKeys);
+
+    bsl::size_t indices[k_BULK_BATCH_SIZE];
+
+    for (bsl::size_t base = 0; base < numKeys; base += k_BULK_BATCH_SIZE) {
+        const bsl::size_t batchSize = numKeys - base < k_BULK_BATCH_SIZE
+                                    ? numKeys - base
+                                    : k_BULK_BATCH_SIZE;
+
+        findKeysBulk(indices, keys + base, batchSize);
+
+        for (bsl::size_t i = 0; i < batchSize; ++i) {
+            const bsl::size_t index = indices[i];
+
+            results[base + i] = index < d_capacity
+                        ? const_iterator(IteratorImp(d_entries_p  + index,
+                                                     d_controls_p + index,
+                                                     d_capacity - index - 1))
+                        : end();
+        }
+    }
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-HASH FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
+HASH FlatHashTable<KEY,
+                   ENTRY,
+                   ENTRY_UTIL,
+                   HASH,
+                   EQUAL,
+                   GROUP_CONTROL>::hash_function() const
 {
     return d_hasher;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-EQUAL FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::key_eq() const
+EQUAL FlatHashTable<KEY,
+                    ENTRY,
+                    ENTRY_UTIL,
+                    HASH,
+                    EQUAL,
+                    GROUP_CONTROL>::key_eq() const
 {
     return d_equal;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
 float bdlc::FlatHashTable<KEY,
                           ENTRY,
                           ENTRY_UTIL,
                           HASH,
-                          EQUAL>::load_factor() const
+                          EQUAL,
+                          GROUP_CONTROL>::load_factor() const
 {
     return d_capacity > 0
          ? static_cast<float>(d_size) / static_cast<float>(d_capacity)
          : 0;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
 float bdlc::FlatHashTable<KEY,
                           ENTRY,
                           ENTRY_UTIL,
                           HASH,
-                          EQUAL>::max_load_factor() const
+                          EQUAL,
+                          GROUP_CONTROL>::max_load_factor() const
 {
     return static_cast<float>(k_MAX_LOAD_FACTOR_NUMERATOR)
          / static_cast<float>(k_MAX_LOAD_FACTOR_DENOMINATOR);
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+bsl::size_t FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL>::size() const
 {
     return d_size;
 }
 
                             // Iterators
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::const_iterator
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::begin() const
 {
     if (d_size) {
         for (bsl::size_t i = 0; i < d_capacity; ++i) {
@@ -1774,35 +2376,80 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
     return const_iterator();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::cbegin() const
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::const_iterator
+FlatHashTable<KEY,
+              ENTRY,
+              ENTRY_UTIL,
+              HASH,
+              EQUAL,
+              GROUP_CONTROL>::cbegin() const
 {
     return begin();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::cend() const
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::cend() const
 {
     return end();
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
-FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+typename FlatHashTable<KEY,
+                       ENTRY,
+                       ENTRY_UTIL,
+                       HASH,
+                       EQUAL,
+                       GROUP_CONTROL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>::end() const
 {
     return const_iterator();
 }
 
                            // Aspects
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-bslma::Allocator *FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+bslma::Allocator *FlatHashTable<KEY,
+                                ENTRY,
+                                ENTRY_UTIL,
+                                HASH,
+                                EQUAL,
+                                GROUP_CONTROL>::
                                                               allocator() const
 {
     return d_allocator_p;
@@ -1811,23 +2458,28 @@ bslma::Allocator *FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
 }  // close package namespace
 
 // FREE OPERATORS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 bool bdlc::operator==(const FlatHashTable<KEY,
                                           ENTRY,
                                           ENTRY_UTIL,
                                           HASH,
-                                          EQUAL>& lhs,
+                                          EQUAL,
+                                          GROUP_CONTROL>& lhs,
                       const FlatHashTable<KEY,
                                           ENTRY,
                                           ENTRY_UTIL,
                                           HASH,
-                                          EQUAL>& rhs)
+                                          EQUAL,
+                                          GROUP_CONTROL>& rhs)
 {
-    typedef typename FlatHashTable<KEY,
-                                   ENTRY,
-                                   ENTRY_UTIL,
-                                   HASH,
-                                   EQUAL>::const_iterator ConstIterator;
+    typedef FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL, GROUP_CONTROL>
+                                                                  Table;
+    typedef typename Table::const_iterator ConstIterator;
 
     if (lhs.size() == rhs.size()) {
         ConstIterator lhsEnd = lhs.end();
@@ -1855,26 +2507,48 @@ bool bdlc::operator==(const FlatHashTable<KEY,
     return false;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 bool bdlc::operator!=(const FlatHashTable<KEY,
                                           ENTRY,
                                           ENTRY_UTIL,
                                           HASH,
-                                          EQUAL>& lhs,
+                                          EQUAL,
+                                          GROUP_CONTROL>& lhs,
                       const FlatHashTable<KEY,
                                           ENTRY,
                                           ENTRY_UTIL,
                                           HASH,
-                                          EQUAL>& rhs)
+                                          EQUAL,
+                                          GROUP_CONTROL>& rhs)
 {
     return !(lhs == rhs);
 }
 
 // FREE FUNCTIONS
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 inline
-void bdlc::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
-                FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b)
+void bdlc::swap(FlatHashTable<KEY,
+                              ENTRY,
+                              ENTRY_UTIL,
+                              HASH,
+                              EQUAL,
+                              GROUP_CONTROL>& a,
+                FlatHashTable<KEY,
+                              ENTRY,
+                              ENTRY_UTIL,
+                              HASH,
+                              EQUAL,
+                              GROUP_CONTROL>& b)
 {
     if (a.allocator() == b.allocator()) {
         a.swap(b);
@@ -1882,7 +2556,12 @@ void bdlc::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
         return;                                                       // RETURN
     }
 
-    typedef FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> Table;
+    typedef FlatHashTable<KEY,
+                          ENTRY,
+                          ENTRY_UTIL,
+                          HASH,
+                          EQUAL,
+                          GROUP_CONTROL> Table;
 
     Table futureA(b, a.allocator());
     Table futureB(a, b.allocator());
@@ -1893,12 +2572,19 @@ void bdlc::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
 
 namespace bslma {
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
 struct UsesBslmaAllocator<bdlc::FlatHashTable<KEY,
                                               ENTRY,
                                               ENTRY_UTIL,
                                               HASH,
-                                              EQUAL> > : bsl::true_type {
+                                              EQUAL,
+                                              GROUP_CONTROL> >
+: bsl::true_type {
 };
 
 }  // close namespace bslma
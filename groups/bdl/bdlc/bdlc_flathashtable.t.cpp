@@ -16,6 +16,7 @@
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
 
+#include <bslmf_assert.h>
 #include <bslmf_isbitwisemoveable.h>
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_movableref.h>
@@ -108,6 +109,7 @@ using namespace bsl;
 // [17] iterator erase(iterator);
 // [18] iterator erase(const_iterator, const_iterator);
 // [12] iterator find(const KEY&);
+// [21] void findBulk(iterator *, const KEY *, size_t);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(ENTRY_TYPE) entry)
 // [16] void insert(INPUT_IT, INPUT_IT);
 // [19] void rehash(size_t);
@@ -128,6 +130,7 @@ using namespace bsl;
 // [ 4] const ENTRY *entries() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [12] const_iterator find(const KEY&) const;
+// [21] void findBulk(const_iterator *, const KEY *, size_t) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
@@ -156,6 +159,7 @@ using namespace bsl;
 // [12] CONCERN: 'const ENTRY& FHTCI::operator*()'
 // [12] CONCERN: 'bool operator==(FHTCI&, FHTCI&)'
 // [12] CONCERN: 'ENTRY& FHTI::operator*()'
+// [22] CONCERN: 'GROUP_CONTROL' determines the group size
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -222,6 +226,11 @@ const bsl::uint8_t k_SIZE   = GroupControl::k_SIZE;
 const bsl::uint8_t k_EMPTY  = GroupControl::k_EMPTY;
 const bsl::uint8_t k_ERASED = GroupControl::k_ERASED;
 
+// The explicit capacities (e.g., 32 and 64) supplied by the test cases must be
+// at least the minimum non-zero capacity of a table, '2 * k_SIZE'.
+
+BSLMF_ASSERT(2 * k_SIZE <= 32);
+
 // ============================================================================
 //                     GLOBAL VARIABLES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -903,13 +912,20 @@ IsValidResult::Enum isValid(bsl::size_t        *errorIndex,
     return IsValidResult::e_SUCCESS;
 }
 
-template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-IsValidResult::Enum isValid(bsl::size_t                       *errorIndex,
-                            const bdlc::FlatHashTable<KEY,
-                                                      ENTRY,
-                                                      ENTRY_UTIL,
-                                                      HASH,
-                                                      EQUAL>&  table)
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class HASH,
+          class EQUAL,
+          class GROUP_CONTROL>
+IsValidResult::Enum isValid(
+                    bsl::size_t                               *errorIndex,
+                    const bdlc::FlatHashTable<KEY,
+                                              ENTRY,
+                                              ENTRY_UTIL,
+                                              HASH,
+                                              EQUAL,
+                                              GROUP_CONTROL>&  table)
     // Return 'IsValidResult::e_SUCCESS' if the specified 'table' is valid;
     // otherwise return an 'IsValidResult::Enum' value indicating the found
     // error and populate the specified 'errorIndex' with the location of the
@@ -919,12 +935,164 @@ IsValidResult::Enum isValid(bsl::size_t                       *errorIndex,
                    table.entries(),
                    table.controls(),
                    table.size(),
-                   k_SIZE,
+                   GROUP_CONTROL::k_SIZE,
                    table.capacity(),
                    table.hash_function(),
                    ENTRY_UTIL());
 }
 
+template <class HASH, class GROUP_CONTROL>
+void testCase22GroupControl(int id)
+    // Address the concerns of test case 22 for the table having the 'HASH'
+    // functor and the 'GROUP_CONTROL' group control identified by the
+    // specified 'id'.
+{
+    typedef bdlc::FlatHashTable<int,
+                                int,
+                                TestEntryUtil<int>,
+                                HASH,
+                                bsl::equal_to<int>,
+                                GROUP_CONTROL> Obj;
+
+    const bsl::size_t GROUP_SIZE = GROUP_CONTROL::k_SIZE;
+
+    LOOP_ASSERT(id, 2 * GROUP_SIZE == Obj::k_MIN_CAPACITY);
+
+    // Note that 7919 is relatively prime to 'MAX_KEY', so
+    // '(i * 7919) % MAX_KEY' visits every key in '[0 .. MAX_KEY)' once for
+    // each 'MAX_KEY' consecutive values of 'i'.
+
+    const int MAX_KEY     = 2000;
+    const int CHECK_EVERY = 97;
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    Obj mX(0, HASH(), bsl::equal_to<int>(), &oa);  const Obj& X = mX;
+
+    bsl::vector<char> present(MAX_KEY, 0, &sa);
+    bsl::size_t       size = 0;
+
+    for (int i = 0; i < 3 * MAX_KEY; ++i) {
+        const int key   = (i * 7919) % MAX_KEY;
+        const int phase = i / MAX_KEY;
+
+        if (1 == phase) {
+            // Erase every third key.
+
+            if (0 == key % 3) {
+                LOOP2_ASSERT(id, key, 1 == mX.erase(key));
+                present[key] = 0;
+                --size;
+            }
+        }
+        else {
+            // Insert every key; in the third phase, only the erased keys are
+            // not already present.
+
+            LOOP2_ASSERT(id, key, !present[key] == mX.insert(key).second);
+            if (!present[key]) {
+                present[key] = 1;
+                ++size;
+            }
+        }
+
+        if (0 == i % CHECK_EVERY || MAX_KEY - 1 == i % MAX_KEY) {
+            bsl::size_t errorIndex;
+
+            LOOP2_ASSERT(id, i, size == X.size());
+            LOOP2_ASSERT(id, i, 0    == X.capacity() % GROUP_SIZE);
+            LOOP2_ASSERT(id, i, IsValidResult::e_SUCCESS
+                                               == isValid(&errorIndex, X));
+        }
+
+        if (MAX_KEY - 1 == i % MAX_KEY) {
+            for (int k = 0; k < MAX_KEY; ++k) {
+                LOOP3_ASSERT(id, phase, k,
+                             static_cast<bool>(present[k]) == X.contains(k));
+            }
+        }
+    }
+
+    bsl::vector<int> keys(MAX_KEY, 0, &sa);
+    for (int k = 0; k < MAX_KEY; ++k) {
+        keys[k] = (k * 7919) % MAX_KEY + (k % 2 ? MAX_KEY : 0);
+    }
+
+    bsl::vector<typename Obj::const_iterator> results(MAX_KEY, &sa);
+
+    X.findBulk(results.data(), keys.data(), MAX_KEY);
+
+    for (int k = 0; k < MAX_KEY; ++k) {
+        LOOP2_ASSERT(id, k, X.find(keys[k]) == results[k]);
+    }
+}
+
+template <class HASH>
+void testCase21FindBulk(int id)
+    // Address the concerns of test case 21 for the table having the 'HASH'
+    // functor identified by the specified 'id'.
+{
+    typedef bdlc::FlatHashTable<int,
+                                int,
+                                TestEntryUtil<int>,
+                                HASH,
+                                bsl::equal_to<int> > Obj;
+
+    const bsl::size_t NUM_KEYS[] = { 0, 1, 2, 15, 16, 17, 31, 32, 33, 100 };
+    const bsl::size_t NUM_NUM_KEYS = sizeof NUM_KEYS / sizeof *NUM_KEYS;
+
+    const int MAX_KEYS = 100;
+
+    const int SIZES[] = { 0, 1, 7, 8, 50, 500 };
+    const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+    for (int si = 0; si < NUM_SIZES; ++si) {
+        const int SIZE = SIZES[si];
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(0, HASH(), bsl::equal_to<int>(), &oa);  const Obj& X = mX;
+
+        // Insert the even keys in '[0 .. 2 * SIZE)'.
+
+        for (int i = 0; i < SIZE; ++i) {
+            mX.insert(2 * i);
+        }
+
+        // Look up a mix of present and absent keys, wrapping around so that
+        // all sizes reference inserted keys.
+
+        int keys[MAX_KEYS];
+        for (int i = 0; i < MAX_KEYS; ++i) {
+            keys[i] = SIZE ? (7 * i) % (2 * SIZE + 1) : i;
+        }
+
+        for (bsl::size_t ni = 0; ni < NUM_NUM_KEYS; ++ni) {
+            const bsl::size_t N = NUM_KEYS[ni];
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            typename Obj::iterator       results[MAX_KEYS];
+            typename Obj::const_iterator cresults[MAX_KEYS];
+
+            mX.findBulk(results, keys, N);
+            X.findBulk(cresults, keys, N);
+
+            for (bsl::size_t i = 0; i < N; ++i) {
+                LOOP4_ASSERT(id, SIZE, N, i, mX.find(keys[i]) == results[i]);
+                LOOP4_ASSERT(id, SIZE, N, i, X.find(keys[i])  == cresults[i]);
+
+                if (X.end() != cresults[i]) {
+                    LOOP4_ASSERT(id, SIZE, N, i, keys[i] == *cresults[i]);
+                }
+            }
+
+            LOOP3_ASSERT(id, SIZE, N, oam.isTotalSame());
+        }
+    }
+}
+
 template <class ENTRY>
 void testCase20Bracket(int id, bool allocates, bool allocatesOnRehash)
     // Address the copy 'operator[]' concerns of test case 20 for the specified
@@ -2747,6 +2915,124 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 22: {
+        // --------------------------------------------------------------------
+        // GROUP CONTROL
+        //   Ensure the table operates as expected for each group control.
+        //
+        // Concerns:
+        //: 1 The minimum non-zero capacity, and the granularity of the
+        //:   capacity, are determined by the 'k_SIZE' of the (template
+        //:   parameter) type 'GROUP_CONTROL'.
+        //:
+        //: 2 Insertion, erasure, and lookup operate as expected, and the table
+        //:   remains valid, for the default group control and, when AVX2 is
+        //:   enabled for the build, for the wide group control.
+        //
+        // Plan:
+        //: 1 For each group control and for hash functors that distribute the
+        //:   keys and that map every key to zero, insert a sequence of keys,
+        //:   erase a subset of them, and insert them again, verifying the
+        //:   size, capacity, validity, and contents of the table with an
+        //:   oracle throughout.  Verify 'findBulk' against 'find' for present
+        //:   and absent keys.  (C-1,2)
+        //
+        // Testing:
+        //   CONCERN: 'GROUP_CONTROL' determines the group size
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GROUP CONTROL" << endl
+                          << "=============" << endl;
+
+        typedef bdlc::FlatHashTable_GroupControl GC;
+
+        testCase22GroupControl<IntValueIsHash, GC>(0);
+        testCase22GroupControl<IntZeroHash,    GC>(1);
+        testCase22GroupControl<bslh::Hash<>,   GC>(2);
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+        if (verbose) cout << "Testing the wide group control." << endl;
+
+        typedef bdlc::FlatHashTable_WideGroupControl WGC;
+
+        testCase22GroupControl<IntValueIsHash, WGC>(3);
+        testCase22GroupControl<IntZeroHash,    WGC>(4);
+        testCase22GroupControl<bslh::Hash<>,   WGC>(5);
+#endif
+      } break;
+      case 21: {
+        // --------------------------------------------------------------------
+        // 'findBulk'
+        //   Ensure the 'findBulk' methods operate as expected.
+        //
+        // Concerns:
+        //: 1 Each result of 'findBulk' is identical to the result of 'find'
+        //:   for the corresponding key, for present and absent keys.
+        //:
+        //: 2 The methods operate correctly for a zero-capacity table, for no
+        //:   keys, and for numbers of keys less than, equal to, and more than
+        //:   (multiples of) the internal batch size.
+        //:
+        //: 3 The methods operate correctly when probe sequences span multiple
+        //:   groups.
+        //:
+        //: 4 No memory is allocated.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For tables of varying size, using a hash functor that distributes
+        //:   the keys and one that maps every key to zero, invoke both
+        //:   'findBulk' methods on a varying number of keys and compare each
+        //:   result with the result of 'find'.  Verify no memory is allocated
+        //:   using a 'bslma::TestAllocatorMonitor'.  (C-1..4)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-5)
+        //
+        // Testing:
+        //   void findBulk(iterator *, const KEY *, size_t);
+        //   void findBulk(const_iterator *, const KEY *, size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'findBulk'" << endl
+                          << "==========" << endl;
+
+        testCase21FindBulk<IntValueIsHash>(0);
+        testCase21FindBulk<IntZeroHash>(1);
+        testCase21FindBulk<bslh::Hash<> >(2);
+
+        if (verbose) cout << "Negative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            typedef bdlc::FlatHashTable<int,
+                                        int,
+                                        TestEntryUtil<int>,
+                                        IntValueIsHash,
+                                        bsl::equal_to<int> > Obj;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(0, IntValueIsHash(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            int                 keys[1] = { 0 };
+            Obj::iterator       results[1];
+            Obj::const_iterator cresults[1];
+
+            ASSERT_SAFE_PASS(mX.findBulk(results, keys, 1));
+            ASSERT_SAFE_PASS(mX.findBulk(0, 0, 0));
+            ASSERT_SAFE_FAIL(mX.findBulk(0, keys, 1));
+            ASSERT_SAFE_FAIL(mX.findBulk(results, 0, 1));
+
+            ASSERT_SAFE_PASS(X.findBulk(cresults, keys, 1));
+            ASSERT_SAFE_PASS(X.findBulk(0, 0, 0));
+            ASSERT_SAFE_FAIL(X.findBulk(0, keys, 1));
+            ASSERT_SAFE_FAIL(X.findBulk(cresults, 0, 1));
+        }
+      } break;
     case 20: {
         // --------------------------------------------------------------------
         // 'operator[]'
@@ -2978,7 +3264,11 @@ int main(int argc, char *argv[])
 
             mX.reserve(16);
 
-            ASSERT(32 == X.capacity());
+            // 16 entries require at least 16 / (7 / 8) entries of capacity.
+
+            const bsl::size_t EXP = 2 * k_SIZE > 32 ? 2 * k_SIZE : 32;
+
+            ASSERT(EXP == X.capacity());
 
             mX.insert(0);
 
@@ -9,12 +9,33 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlc::FlatHashTable_GroupControl: flat hash table group control inquiries
+//  bdlc::FlatHashTable_WideGroupControl: 32-value group inquiries using AVX2
 //
 //@DESCRIPTION: This component implements the class,
 // 'bdlc::FlatHashTable_GroupControl', that provides query methods to a group
 // of flat hash table control values.  Note that the number of entries in a
 // group control and the inquiry performance is platform dependant.
 //
+///Group Size
+///----------
+// The number of control values in a 'bdlc::FlatHashTable_GroupControl',
+// 'k_SIZE', is 16 on platforms supporting SSE2, in which case each inquiry
+// uses a single 128-bit comparison, and 8 otherwise, in which case a portable
+// 64-bit implementation is used.  'k_SIZE' determines the layout of the
+// control values of a 'bdlc::FlatHashTable', and so does not depend on
+// optional instruction sets enabled by compilation options (e.g., '-mavx2').
+//
+// When AVX2 is enabled for the build (i.e., 'BSLS_PLATFORM_CPU_AVX2' is
+// defined), this component also provides
+// 'bdlc::FlatHashTable_WideGroupControl', which has a 'k_SIZE' of 32 and uses
+// a single 256-bit comparison per inquiry.  A larger group allows a probe to
+// examine more candidate entries per inquiry, which reduces the number of
+// groups visited for tables having a high load factor.  A
+// 'bdlc::FlatHashTable' uses the wide group only if it is explicitly supplied
+// as the 'GROUP_CONTROL' template parameter, so the layout of a table never
+// changes silently with the compilation options; a translation unit built
+// without AVX2 cannot name such a table type.
+//
 // The flat hash map/set/table data structures are inspired by Google's
 // flat_hash_map CppCon presentations (available on youtube).  The
 // implementations draw from Google's open source 'raw_hash_set.h' file at:
@@ -35,7 +56,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BSLS_PLATFORM_CPU_AVX2) || defined(BSLS_PLATFORM_CPU_SSE2)
 #include <immintrin.h>
 #include <emmintrin.h>
 #endif
@@ -115,6 +136,75 @@ class FlatHashTable_GroupControl
         // value that is empty, but not erased).
 };
 
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+
+                   // ====================================
+                   // class FlatHashTable_WideGroupControl
+                   // ====================================
+
+class FlatHashTable_WideGroupControl
+    // This class provides methods for making inquires to the data of a group
+    // of 32 control values loaded during construction, using AVX2
+    // instructions.  This class provides the same interface as
+    // 'FlatHashTable_GroupControl'.
+{
+  public:
+    // TYPES
+    typedef __m256i Storage;
+
+  private:
+    // DATA
+    Storage d_value;  // efficiently cached value for inquiries
+
+    // PRIVATE ACCESSORS
+    bsl::uint32_t matchRaw(bsl::uint8_t value) const;
+        // Return a bit mask of the 'k_SIZE' entries that have the specified
+        // 'value'.  The bit at index 'i' corresponds to the result for
+        // 'data[i]'.
+
+    // NOT IMPLEMENTED
+    FlatHashTable_WideGroupControl();
+    FlatHashTable_WideGroupControl(const FlatHashTable_WideGroupControl&);
+    FlatHashTable_WideGroupControl& operator=(
+                                        const FlatHashTable_WideGroupControl&);
+
+  public:
+    // PUBLIC CLASS DATA
+    static const bsl::uint8_t k_EMPTY  = 0x80;
+    static const bsl::uint8_t k_ERASED = 0xC0;
+    static const bsl::size_t  k_SIZE   = sizeof(Storage);
+
+    // CREATORS
+    explicit FlatHashTable_WideGroupControl(const bsl::uint8_t *data);
+        // Create a group control query object using the specified 'data'.  The
+        // bytes of 'data' have no alignment requirement.  The behavior is
+        // undefined unless 'data' has at least 'k_SIZE' bytes available.
+
+    //! ~FlatHashTable_WideGroupControl() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    bsl::uint32_t available() const;
+        // Return a bit mask of the 'k_SIZE' entries that are empty or erased.
+        // The bit at index 'i' corresponds to the result for 'data[i]'.
+
+    bsl::uint32_t inUse() const;
+        // Return a bit mask of the 'k_SIZE' entries that are in use (i.e., not
+        // empty or erased).  The bit at index 'i' corresponds to the result
+        // for 'data[i]'.
+
+    bsl::uint32_t match(bsl::uint8_t value) const;
+        // Return a bit mask of the 'k_SIZE' entries that have the specified
+        // 'value'.  The bit at index 'i' corresponds to the result for
+        // 'data[i]'.  The behavior is undefined unless '0 == (0x80 & value)'.
+
+    bool neverFull() const;
+        // Return 'true' if this group control was never full (i.e., has a
+        // value that is empty, but not erased).
+};
+
+#endif
+
 // ============================================================================
 //                             INLINE DEFINITIONS
 // ============================================================================
@@ -191,6 +281,60 @@ bool FlatHashTable_GroupControl::neverFull() const
     return 0 != matchRaw(k_EMPTY);
 }
 
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+
+                   // ------------------------------------
+                   // class FlatHashTable_WideGroupControl
+                   // ------------------------------------
+
+// PRIVATE ACCESSORS
+inline
+bsl::uint32_t FlatHashTable_WideGroupControl::matchRaw(
+                                                      bsl::uint8_t value) const
+{
+    return static_cast<bsl::uint32_t>(_mm256_movemask_epi8(
+                 _mm256_cmpeq_epi8(_mm256_set1_epi8(static_cast<char>(value)),
+                                   d_value)));
+}
+
+// CREATORS
+inline
+FlatHashTable_WideGroupControl::FlatHashTable_WideGroupControl(
+                                                      const bsl::uint8_t *data)
+{
+    d_value = _mm256_loadu_si256(static_cast<const Storage *>(
+                                             static_cast<const void *>(data)));
+}
+
+// ACCESSORS
+inline
+bsl::uint32_t FlatHashTable_WideGroupControl::available() const
+{
+    return static_cast<bsl::uint32_t>(_mm256_movemask_epi8(d_value));
+}
+
+inline
+bsl::uint32_t FlatHashTable_WideGroupControl::inUse() const
+{
+    return ~available();
+}
+
+inline
+bsl::uint32_t FlatHashTable_WideGroupControl::match(bsl::uint8_t value) const
+{
+    BSLS_ASSERT_SAFE(0 == (value & 0x80));
+
+    return matchRaw(value);
+}
+
+inline
+bool FlatHashTable_WideGroupControl::neverFull() const
+{
+    return 0 != matchRaw(k_EMPTY);
+}
+
+#endif
+
 }  // close package namespace
 }  // close enterprise namespace
 
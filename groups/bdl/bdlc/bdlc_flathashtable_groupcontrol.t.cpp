@@ -23,7 +23,9 @@ using namespace bsl;
 //                              Overview
 //                              --------
 // The component under test defines a mechanism,
-// 'bdlc::FlatHashTable_GroupControl'.  No allocator is involved.  Testing
+// 'bdlc::FlatHashTable_GroupControl', and, when AVX2 is enabled for the build,
+// a second mechanism having the same interface,
+// 'bdlc::FlatHashTable_WideGroupControl'.  No allocator is involved.  Testing
 // concerns are (safely) limited to the mechanical functioning of the various
 // methods.
 //
@@ -44,6 +46,13 @@ using namespace bsl;
 // [ 3] bsl::uint32_t inUse() const;
 // [ 3] bsl::uint32_t match(bsl::uint8_t value) const;
 // [ 3] bool neverFull() const;
+//
+// FlatHashTable_WideGroupControl
+// [ 4] FlatHashTable_WideGroupControl(const bsl::uint8_t *data);
+// [ 4] bsl::uint32_t available() const;
+// [ 4] bsl::uint32_t inUse() const;
+// [ 4] bsl::uint32_t match(bsl::uint8_t value) const;
+// [ 4] bool neverFull() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // ----------------------------------------------------------------------------
@@ -117,17 +126,29 @@ const bsl::uint8_t VC = 0x01;
 const bsl::uint8_t VD = 0x10;
 const bsl::uint8_t VE = 0x11;
 
+const bsl::size_t k_MAX_SIZE = 32;  // largest 'k_SIZE' of any group control
+
+BSLMF_ASSERT(Obj::k_SIZE <= k_MAX_SIZE);
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+typedef bdlc::FlatHashTable_WideGroupControl WideObj;
+
+BSLMF_ASSERT(WideObj::k_SIZE == k_MAX_SIZE);
+#endif
+
 // ============================================================================
 //                    GLOBAL HELPER FUNCTIONS FOR TESTING
 // ----------------------------------------------------------------------------
 
+template <class GROUP_CONTROL>
 void print(const bsl::uint8_t *data)
-    // Print a representation of the specified 'data'.
+    // Print a representation of the first 'GROUP_CONTROL::k_SIZE' values of
+    // the specified 'data'.
 {
     const char *hex = "0123456789abcdef";
 
     bsl::cout << "   ";
-    for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
+    for (bsl::size_t i = 0; i < GROUP_CONTROL::k_SIZE; ++i) {
         bsl::cout << ' '
                   << hex[static_cast<bsl::uint32_t>((data[i] >> 4) & 0xF)]
                   << hex[static_cast<bsl::uint32_t>(data[i] & 0xF)];
@@ -135,11 +156,13 @@ void print(const bsl::uint8_t *data)
     bsl::cout << bsl::endl;
 }
 
+template <class GROUP_CONTROL>
 void verifyWithOracle(const bsl::uint8_t *data)
-    // Verify the accessor methods of a 'bdlc::FlatHashTable_GroupControl'
-    // return the expected values for the specified 'data'.
+    // Verify the accessor methods of a (template parameter) 'GROUP_CONTROL'
+    // (e.g., 'bdlc::FlatHashTable_GroupControl') return the expected values
+    // for the specified 'data'.
 {
-    Obj mX(data);  const Obj& X = mX;
+    GROUP_CONTROL mX(data);  const GROUP_CONTROL& X = mX;
 
     bsl::uint32_t expAvailable = 0;
     bsl::uint32_t expInUse     = 0;
@@ -149,7 +172,7 @@ void verifyWithOracle(const bsl::uint8_t *data)
     bsl::uint32_t expMatchD    = 0;
     bsl::uint32_t expMatchE    = 0;
     bool          expNeverFull = false;
-    for (int i = Obj::k_SIZE - 1; i >= 0; --i) {
+    for (int i = static_cast<int>(GROUP_CONTROL::k_SIZE) - 1; i >= 0; --i) {
         expAvailable = expAvailable * 2 + (data[i] >= 0x80u ? 1 : 0);
         expInUse     = expInUse * 2     + (data[i] <  0x80u ? 1 : 0);
         expMatchA    = expMatchA * 2    + (data[i] == VA    ? 1 : 0);
@@ -161,42 +184,42 @@ void verifyWithOracle(const bsl::uint8_t *data)
     }
 
     if (expAvailable != X.available()) {
-        print(data);
+        print<GROUP_CONTROL>(data);
     }
     ASSERT(expAvailable == X.available());
 
     if (expInUse != X.inUse()) {
-        print(data);
+        print<GROUP_CONTROL>(data);
     }
     ASSERT(expInUse == X.inUse());
 
     if (expMatchA != X.match(VA)) {
-        print(data);
+        print<GROUP_CONTROL>(data);
     }
     ASSERT(expMatchA == X.match(VA));
 
     if (expMatchB != X.match(VB)) {
-        print(data);
+        print<GROUP_CONTROL>(data);
     }
     ASSERT(expMatchB == X.match(VB));
 
     if (expMatchC != X.match(VC)) {
-        print(data);
+        print<GROUP_CONTROL>(data);
     }
     ASSERT(expMatchC == X.match(VC));
 
     if (expMatchD != X.match(VD)) {
-        print(data);
+        print<GROUP_CONTROL>(data);
     }
     ASSERT(expMatchD == X.match(VD));
 
     if (expMatchE != X.match(VE)) {
-        print(data);
+        print<GROUP_CONTROL>(data);
     }
     ASSERT(expMatchE == X.match(VE));
 
     if (expNeverFull != X.neverFull()) {
-        print(data);
+        print<GROUP_CONTROL>(data);
     }
     ASSERT(expNeverFull == X.neverFull());
 }
@@ -235,6 +258,112 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // WIDE GROUP CONTROL
+        //   Ensure 'FlatHashTable_WideGroupControl' operates as expected.
+        //
+        // Concerns:
+        //: 1 The constructor loads all 'k_SIZE' (i.e., 32) control values.
+        //:
+        //: 2 The accessors 'available', 'inUse', 'match', and 'neverFull'
+        //:   report the result for each of the control values, including the
+        //:   one corresponding to the most-significant bit of the result.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 If AVX2 is enabled for the build, using the depth-enumerated
+        //:   technique (to depth 3), compare the results of 'available',
+        //:   'inUse', 'match(V)', and 'neverFull' methods with oracle
+        //:   implementations.  (C-1,2)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-3)
+        //
+        // Testing:
+        //   FlatHashTable_WideGroupControl(const bsl::uint8_t *data);
+        //   bsl::uint32_t available() const;
+        //   bsl::uint32_t inUse() const;
+        //   bsl::uint32_t match(bsl::uint8_t value) const;
+        //   bool neverFull() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WIDE GROUP CONTROL" << endl
+                          << "==================" << endl;
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+        if (verbose) cout << "\nTesting accessors." << endl;
+
+        {
+            bsl::uint8_t BACKGROUND[][k_MAX_SIZE] =
+                       {
+                           { EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE },
+                           { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,
+                             XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },
+                       };
+            const bsl::size_t NUM_BACKGROUND
+                                      = sizeof BACKGROUND / sizeof *BACKGROUND;
+
+            bsl::uint8_t VALUE[] = { VA, VB, VC, VD, VE, EE, XX };
+            const bsl::size_t NUM_VALUE = sizeof VALUE / sizeof *VALUE;
+
+            for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
+                bsl::uint8_t data[k_MAX_SIZE];
+                bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
+
+                verifyWithOracle<WideObj>(data);
+
+                for (bsl::size_t i = 0; i < WideObj::k_SIZE; ++i) {
+                    for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
+                        data[i] = VALUE[ii];
+                        verifyWithOracle<WideObj>(data);
+
+                        for (bsl::size_t j = i + 1; j < WideObj::k_SIZE; ++j) {
+                            for (bsl::size_t jj = 0; jj < NUM_VALUE; ++jj) {
+                                data[j] = VALUE[jj];
+                                verifyWithOracle<WideObj>(data);
+
+                                for (bsl::size_t k = j + 1;
+                                     k < WideObj::k_SIZE;
+                                     ++k) {
+                                    for (bsl::size_t kk = 0;
+                                         kk < NUM_VALUE;
+                                         ++kk) {
+                                        data[k] = VALUE[kk];
+                                        verifyWithOracle<WideObj>(data);
+                                    }
+                                    data[k] = BACKGROUND[bi][k];
+                                }
+                            }
+                            data[j] = BACKGROUND[bi][j];
+                        }
+                    }
+                    data[i] = BACKGROUND[bi][i];
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::uint8_t data[k_MAX_SIZE] =
+                { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                  EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+
+            WideObj mX(data);  const WideObj& X = mX;
+
+            ASSERT_SAFE_PASS(X.match(VA));
+            ASSERT_SAFE_FAIL(X.match(WideObj::k_EMPTY));
+            ASSERT_SAFE_FAIL(X.match(WideObj::k_ERASED));
+            ASSERT_SAFE_FAIL(X.match(0xFF));
+        }
+#else
+        if (verbose) cout << "\nAVX2 is not enabled; skipping test." << endl;
+#endif
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // ACCESSORS
@@ -271,10 +400,12 @@ int main(int argc, char *argv[])
         if (verbose) cout << "\nTesting accessors." << endl;
 
         {
-            bsl::uint8_t BACKGROUND[][16] =
+            bsl::uint8_t BACKGROUND[][k_MAX_SIZE] =
                        {
-                           { EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE },
-                           { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },
+                           { EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE },
+                           { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,
+                             XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },
                        };
             const bsl::size_t NUM_BACKGROUND
                                       = sizeof BACKGROUND / sizeof *BACKGROUND;
@@ -284,18 +415,18 @@ int main(int argc, char *argv[])
 
             { // depth 0
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    verifyWithOracle(BACKGROUND[bi]);
+                    verifyWithOracle<Obj>(BACKGROUND[bi]);
                 }
             }
             { // depth 1
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
 
                     for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                         for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
                             data[i] = VALUE[ii];
-                            verifyWithOracle(data);
+                            verifyWithOracle<Obj>(data);
                             data[i] = BACKGROUND[bi][i];
                         }
                     }
@@ -303,8 +434,8 @@ int main(int argc, char *argv[])
             }
             { // depth 2
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
             //------^
             for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                 for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -312,7 +443,7 @@ int main(int argc, char *argv[])
                     for (bsl::size_t j = i + 1; j < Obj::k_SIZE; ++j) {
                         for (bsl::size_t jj = 0; jj < NUM_VALUE; ++jj) {
                             data[j] = VALUE[jj];
-                            verifyWithOracle(data);
+                            verifyWithOracle<Obj>(data);
                             data[j] = BACKGROUND[bi][j];
                         }
                     }
@@ -324,8 +455,8 @@ int main(int argc, char *argv[])
             }
             { // depth 3
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
         //----------^
         for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -336,7 +467,7 @@ int main(int argc, char *argv[])
                         for (bsl::size_t k = j + 1; k < Obj::k_SIZE; ++k) {
                             for (bsl::size_t kk = 0; kk < NUM_VALUE; ++kk) {
                                 data[k] = VALUE[kk];
-                                verifyWithOracle(data);
+                                verifyWithOracle<Obj>(data);
                                 data[k] = BACKGROUND[bi][k];
                             }
                         }
@@ -351,8 +482,8 @@ int main(int argc, char *argv[])
             }
             { // depth 4
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
 //------------------^
 for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
     for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -366,7 +497,7 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                         for (bsl::size_t m = k + 1; m < Obj::k_SIZE; ++m) {
                             for (bsl::size_t mm = 0; mm < NUM_VALUE; ++mm) {
                                 data[m] = VALUE[mm];
-                                verifyWithOracle(data);
+                                verifyWithOracle<Obj>(data);
                                 data[m] = BACKGROUND[bi][m];
                             }
                         }
@@ -388,8 +519,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
         {
             bsls::AssertTestHandlerGuard hG;
 
-            bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                  EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -426,8 +558,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                           << "========" << endl;
 
         {
-            bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                  EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -440,8 +573,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             ASSERT(true == X.neverFull());
         }
         {
-            bsl::uint8_t data[16] =
-                           { VA,VB,VC,VD,VE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                { VA,VB,VC,VD,VE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                  EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -454,8 +588,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             ASSERT(true == X.neverFull());
         }
         {
-            bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                { XX,VA,XX,VB,VA,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,
+                  XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -488,8 +623,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                           << "BREATHING TEST" << endl
                           << "==============" << endl;
 
-        bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+        bsl::uint8_t data[k_MAX_SIZE] =
+            { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+              EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
         Obj mX(data);  const Obj& X = mX;
 
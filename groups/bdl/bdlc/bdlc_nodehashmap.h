@@ -0,0 +1,1882 @@
+// bdlc_nodehashmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_NODEHASHMAP
+#define INCLUDED_BDLC_NODEHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an unordered map with stable element addresses.
+//
+//@CLASSES:
+//   bdlc::NodeHashMap: unordered map with flat index and stable elements
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashtable
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::NodeHashMap', that implements an unordered map of items with unique
+// keys in which each element is held in a separately allocated node, and the
+// nodes are indexed by an open-addressed table (see 'bdlc_flathashtable').
+//
+// 'bdlc::FlatHashMap' stores its elements directly in the open-addressed
+// table, and therefore moves them whenever the table is resized.
+// 'bsl::unordered_map' never moves its elements, but locating an element
+// requires following a chain of node pointers from a bucket.
+// 'bdlc::NodeHashMap' combines the two: the table stores only a pointer to the
+// node of each element, and, as in 'bdlc::FlatHashMap', is searched using the
+// SIMD-friendly group control bytes of 'bdlc::FlatHashTable_GroupControl'.
+// Consequently, a lookup inspects a group of control bytes and then
+// dereferences one node pointer for each candidate whose hashlet matches
+// (typically only the element sought), and the address of each element is
+// stable for the lifetime of the element.  'bdlc::NodeHashMap' is intended for
+// large, frequently-probed maps whose clients retain pointers or references to
+// the elements; when such stability is not needed, 'bdlc::FlatHashMap' is
+// generally faster and uses less memory.
+//
+// An instantiation of 'bdlc::NodeHashMap' is an allocator-aware,
+// value-semantic type whose salient attributes are the collection of
+// 'KEY-VALUE' pairs contained, without regard to order.  An instantiation may
+// be provided with custom hash and key-equality functors, but those are not
+// salient attributes.  In particular, when comparing element values for
+// equality between two different 'bdlc::NodeHashMap' objects, the elements are
+// compared using 'operator=='.
+//
+///Performance Caveats
+///-------------------
+// The performance caveats of 'bdlc::FlatHashMap' apply: 'bdlc::NodeHashMap' is
+// recommended for Intel platforms, and it is recommended to benchmark before
+// using 'bdlc::NodeHashMap' on other platforms.  In addition, each element of
+// a 'bdlc::NodeHashMap' requires a separate memory allocation (as is the case
+// for 'bsl::unordered_map'), so inserting into and erasing from a
+// 'bdlc::NodeHashMap' is generally slower than for a 'bdlc::FlatHashMap'.
+//
+///Interface Differences with 'unordered_map'
+///------------------------------------------
+// A 'bdlc::NodeHashMap' meets most of the requirements of an unordered
+// associative container with forward iterators in the C++11 Standard [23.2.5].
+// It does not have the bucket interface, and iterators become invalid when the
+// container is resized (although the elements themselves do not move).
+// Allocator use follows BDE style, and the various allocator propagation
+// attributes are not present (e.g., the allocator trait
+// 'propagate_on_container_copy_assignment').  The maximum load factor of the
+// container (the ratio of size to capacity) is maintained by the container
+// itself and is not settable (the maximum load factor is implementation
+// defined and fixed).
+//
+///Load Factor and Resizing
+///------------------------
+// An invariant of 'bdlc::NodeHashMap' is that
+// '0 <= load_factor() <= max_load_factor() <= 1.0'.  Any operation that would
+// result in 'load_factor() > max_load_factor()' for a 'bdlc::NodeHashMap'
+// causes the capacity to increase.  This resizing allocates new memory for the
+// index, moves the node pointers (but not the elements) to the new memory, and
+// reclaims the original memory.  The transfer of node pointers involves
+// rehashing each element to determine its new location.  As such, all
+// iterators of the 'bdlc::NodeHashMap' are invalidated on a resize, but
+// pointers and references to its elements remain valid.
+//
+///Requirements on 'KEY', 'HASH', and 'EQUAL'
+///------------------------------------------
+// The template parameter type 'KEY' must be copy or move constructible.  The
+// template parameter types 'HASH' and 'EQUAL' must be default and copy
+// constructible function objects.
+//
+// 'HASH' must support a function-call operator compatible with the following
+// statements for an object 'key' of type 'KEY':
+//..
+//  HASH        hash;
+//  bsl::size_t result = hash(key);
+//..
+//
+// 'EQUAL' must support a function-call operator compatible with the
+//  following statements for objects 'key1' and 'key2' of type 'KEY':
+//..
+//  EQUAL equal;
+//  bool  result = equal(key1, key2);
+//..
+// where the definition of the called function defines an equivalence
+// relationship on keys that is both reflexive and transitive.
+//
+// 'HASH' and 'EQUAL' function objects are further constrained: if the
+// comparator determines that two values are equal, the hasher must produce the
+// same hash value for each.
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// Any change in capacity of a 'bdlc::NodeHashMap' invalidates all iterators,
+// but no pointers or references.  A 'bdlc::NodeHashMap' manipulator that
+// erases an element invalidates all pointers, references, and iterators to the
+// erased element.  Swapping two 'bdlc::NodeHashMap' objects, or moving a
+// 'bdlc::NodeHashMap' into a new object that uses the same allocator, does not
+// invalidate pointers or references to the elements, which then refer to
+// elements of the other (or new) object.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::NodeHashMap' is exception neutral, and all of the methods of
+// 'bdlc::NodeHashMap' provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Move Semantics in C++03
+///-----------------------
+// Move-only types are supported by 'bdlc::NodeHashMap' on C++11, and later,
+// platforms only (where 'BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES' is defined),
+// and are not supported on C++03 platforms.  See 'bdlc_flathashmap' for
+// details.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Retaining References to Mapped Values
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a table of the latest prices of securities, keyed by an
+// integral security identifier, and some of our clients cache the address of
+// the price of a security of interest rather than look it up every time it is
+// needed.  The table grows as new securities are seen, so the cached addresses
+// must remain valid when the table is resized.
+//
+// First, we define an alias for our price table:
+//..
+//  typedef bdlc::NodeHashMap<int, double> PriceTable;
+//..
+// Then, we create an (empty) price table, and record the price of a security
+// that a client is watching, retaining the address of the price:
+//..
+//  PriceTable prices;
+//
+//  double *watchedPrice = &prices[1234];
+//
+//  *watchedPrice = 101.25;
+//..
+// Next, we record prices for many more securities, which causes the table to
+// be resized several times:
+//..
+//  const bsl::size_t initialCapacity = prices.capacity();
+//
+//  for (int id = 0; id < 1000; ++id) {
+//      prices[id] = 1.0 + id;
+//  }
+//
+//  assert(initialCapacity < prices.capacity());
+//..
+// Now, we observe that the retained address still refers to the price of the
+// watched security:
+//..
+//  assert(watchedPrice == &prices[1234]);
+//  assert(101.25       == *watchedPrice);
+//..
+// Finally, we update the price through the retained address and observe the
+// change through the table:
+//..
+//  *watchedPrice = 99.5;
+//
+//  assert(99.5 == prices.find(1234)->second);
+//..
+// Note that had 'PriceTable' been a 'bdlc::FlatHashMap', 'watchedPrice' would
+// have been invalidated by the first resize.
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_swaputil.h>
+
+#include <bslh_fibonaccibadhashwrapper.h>
+
+#include <bslim_printer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_addconst.h>
+#include <bslmf_enableif.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_platform.h>
+
+#include <bslstl_equalto.h>
+#include <bslstl_forwarditerator.h>
+#include <bslstl_hash.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_cstddef.h>
+#include <bsl_new.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class KEY,
+          class VALUE,
+          class HASH  = bslh::FibonacciBadHashWrapper<bsl::hash<KEY> >,
+          class EQUAL = bsl::equal_to<KEY> >
+class NodeHashMap;
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const NodeHashMap<KEY, VALUE, HASH, EQUAL> &lhs,
+                const NodeHashMap<KEY, VALUE, HASH, EQUAL> &rhs);
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const NodeHashMap<KEY, VALUE, HASH, EQUAL> &lhs,
+                const NodeHashMap<KEY, VALUE, HASH, EQUAL> &rhs);
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(NodeHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          NodeHashMap<KEY, VALUE, HASH, EQUAL>& b);
+
+template <class KEY, class VALUE>
+struct NodeHashMap_EntryUtil;
+
+template <class KEY, class VALUE>
+class NodeHashMap_IteratorImp;
+
+template <class KEY, class VALUE>
+bool operator==(const NodeHashMap_IteratorImp<KEY, VALUE>& a,
+                const NodeHashMap_IteratorImp<KEY, VALUE>& b);
+
+                          // =======================
+                          // class NodeHashMap_Entry
+                          // =======================
+
+template <class KEY, class VALUE>
+class NodeHashMap_Entry {
+    // This class template provides the entry type of the flat hash table
+    // underlying 'NodeHashMap'.  An entry owns a separately allocated node
+    // holding a 'bsl::pair<const KEY, VALUE>' object, so that moving an entry
+    // (e.g., when the table is resized) moves only a pointer and does not
+    // change the address of the held pair.  The node records the allocator
+    // that supplied it, and is reclaimed when the entry is destroyed.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<typename bsl::add_const<KEY>::type, VALUE> value_type;
+
+  private:
+    // PRIVATE TYPES
+    struct Node {
+        // This 'struct' defines the layout of the node owned by an entry.
+
+        bslma::Allocator               *d_allocator_p;  // supplied this node
+                                                        // (held, not owned)
+
+        bsls::ObjectBuffer<value_type>  d_value;        // held pair
+    };
+
+    // DATA
+    Node *d_node_p;  // owned node, or 0 if this entry has been moved from
+
+    // FRIENDS
+    friend struct NodeHashMap_EntryUtil<KEY, VALUE>;
+
+    // PRIVATE CREATORS
+    NodeHashMap_Entry();
+        // Create an entry that does not own a node.  Note that this
+        // constructor is used by 'NodeHashMap_EntryUtil', which subsequently
+        // loads a node into the entry.
+
+    // PRIVATE MANIPULATORS
+    template <class ARG_TYPE>
+    void createNode(bslma::Allocator                            *allocator,
+                    BSLS_COMPILERFEATURES_FORWARD_REF(ARG_TYPE)  argument);
+    template <class ARG1_TYPE, class ARG2_TYPE>
+    void createNode(bslma::Allocator                             *allocator,
+                    BSLS_COMPILERFEATURES_FORWARD_REF(ARG1_TYPE)  argument1,
+                    BSLS_COMPILERFEATURES_FORWARD_REF(ARG2_TYPE)  argument2);
+        // Allocate a node from the specified 'allocator', construct the held
+        // pair in the node from the specified 'argument' (or 'argument1' and
+        // 'argument2'), using 'allocator' to supply memory, and make this
+        // entry the owner of the node.  If an exception is thrown, this entry
+        // is unchanged and no memory is leaked.  The behavior is undefined
+        // unless this entry does not own a node.
+
+    // NOT IMPLEMENTED
+    NodeHashMap_Entry& operator=(const NodeHashMap_Entry&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(NodeHashMap_Entry,
+                                   bslma::UsesBslmaAllocator);
+    BSLMF_NESTED_TRAIT_DECLARATION(NodeHashMap_Entry,
+                                   bslmf::IsBitwiseMoveable);
+
+    // CREATORS
+    template <class VALUE_TYPE>
+    NodeHashMap_Entry(
+               BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE)  value,
+               bslma::Allocator                              *basicAllocator =
+                                                                             0,
+               typename bsl::enable_if<
+                   bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                   int>::type                                 = 0)
+        // Create an entry holding a pair constructed from the specified
+        // 'value'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+    : d_node_p(0)
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        createNode(bslma::Default::allocator(basicAllocator),
+                   BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value));
+    }
+
+    NodeHashMap_Entry(const NodeHashMap_Entry&  original,
+                      bslma::Allocator         *basicAllocator = 0);
+        // Create an entry holding a newly allocated copy of the pair held by
+        // the specified 'original' entry.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    NodeHashMap_Entry(bslmf::MovableRef<NodeHashMap_Entry> original);
+        // Create an entry that takes ownership of the node of the specified
+        // 'original' entry.  'original' is left in a moved-from state, in
+        // which it may only be destroyed.  No memory is allocated, and the
+        // address of the held pair is unchanged.
+
+    NodeHashMap_Entry(bslmf::MovableRef<NodeHashMap_Entry>  original,
+                      bslma::Allocator                     *basicAllocator);
+        // Create an entry holding the pair held by the specified 'original'
+        // entry, using the specified 'basicAllocator' to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  If 'basicAllocator' is the allocator that supplied the node
+        // of 'original', this entry takes ownership of that node, and
+        // 'original' is left in a moved-from state, in which it may only be
+        // destroyed; otherwise, a new node is allocated, its pair is
+        // move-constructed from the pair of 'original', and 'original' is
+        // left in a valid but unspecified state.
+
+    ~NodeHashMap_Entry();
+        // Destroy this object, the pair it holds, and reclaim its node.
+
+    // MANIPULATORS
+    value_type& value();
+        // Return a reference providing modifiable access to the pair held by
+        // this entry.  The behavior is undefined if this entry has been moved
+        // from.
+
+    // ACCESSORS
+    const value_type& value() const;
+        // Return a reference providing non-modifiable access to the pair held
+        // by this entry.  The behavior is undefined if this entry has been
+        // moved from.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE>
+bool operator==(const NodeHashMap_Entry<KEY, VALUE>& lhs,
+                const NodeHashMap_Entry<KEY, VALUE>& rhs);
+    // Return 'true' if the pairs held by the specified 'lhs' and 'rhs' entries
+    // have the same value, and 'false' otherwise.
+
+template <class KEY, class VALUE>
+bool operator!=(const NodeHashMap_Entry<KEY, VALUE>& lhs,
+                const NodeHashMap_Entry<KEY, VALUE>& rhs);
+    // Return 'true' if the pairs held by the specified 'lhs' and 'rhs' entries
+    // do not have the same value, and 'false' otherwise.
+
+                        // ============================
+                        // struct NodeHashMap_EntryUtil
+                        // ============================
+
+template <class KEY, class VALUE>
+struct NodeHashMap_EntryUtil
+    // This templated utility provides methods to construct a
+    // 'NodeHashMap_Entry' and to extract the key from a 'NodeHashMap_Entry'
+    // (or from a value convertible to the pair held by such an entry).
+{
+    // PUBLIC TYPES
+    typedef NodeHashMap_Entry<KEY, VALUE>  Entry;
+    typedef typename Entry::value_type     value_type;
+
+    // CLASS METHODS
+    template <class KEY_TYPE>
+    static void construct(
+                        Entry                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+        // Load into the specified 'entry' an 'Entry' holding the pair
+        // comprised of the specified 'key' and a default constructed 'VALUE',
+        // using the specified 'allocator' to supply memory.
+
+    static const KEY& key(const Entry& entry);
+        // Return the key of the pair held by the specified 'entry'.
+
+#if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
+    template <class VALUE_TYPE>
+    static const KEY& key(const VALUE_TYPE& value)
+#else
+    template <class VALUE_TYPE>
+    static typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE,
+                                                       value_type>::value,
+                              const KEY&>::type key(const VALUE_TYPE& value)
+#endif
+        // Return the key of the specified 'value'.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return value.first;
+    }
+};
+
+                       // =============================
+                       // class NodeHashMap_IteratorImp
+                       // =============================
+
+template <class KEY, class VALUE>
+class NodeHashMap_IteratorImp {
+    // This class template adapts an iterator implementation of the flat hash
+    // table underlying 'NodeHashMap', which refers to 'NodeHashMap_Entry'
+    // objects, to refer to the pairs held by those entries.  This class
+    // template is suitable for use with 'bslstl::ForwardIterator'.
+
+  public:
+    // PUBLIC TYPES
+    typedef NodeHashMap_Entry<KEY, VALUE>     Entry;
+    typedef typename Entry::value_type        value_type;
+    typedef FlatHashTable_IteratorImp<Entry>  TableIteratorImp;
+
+  private:
+    // DATA
+    TableIteratorImp d_imp;  // adapted table iterator implementation
+
+    // FRIENDS
+    friend bool operator==<>(const NodeHashMap_IteratorImp&,
+                             const NodeHashMap_IteratorImp&);
+
+  public:
+    // CREATORS
+    NodeHashMap_IteratorImp();
+        // Create a 'NodeHashMap_IteratorImp' having the default constructed
+        // value of 'TableIteratorImp'.
+
+    NodeHashMap_IteratorImp(const TableIteratorImp& imp);           // IMPLICIT
+        // Create a 'NodeHashMap_IteratorImp' adapting the specified 'imp'.
+
+    // MANIPULATORS
+    void operator++();
+        // Advance this iterator to the next element.  The behavior is
+        // undefined unless this iterator refers to a valid element of the
+        // underlying table.
+
+    // ACCESSORS
+    value_type& operator*() const;
+        // Return a reference to the pair held by the entry referred to by this
+        // iterator.  The behavior is undefined unless this iterator refers to
+        // a valid element of the underlying table.
+
+    const TableIteratorImp& tableImp() const;
+        // Return a reference providing non-modifiable access to the adapted
+        // table iterator implementation.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE>
+bool operator==(const NodeHashMap_IteratorImp<KEY, VALUE>& a,
+                const NodeHashMap_IteratorImp<KEY, VALUE>& b);
+    // Return true if the specified 'a' and 'b' are equal.  Two
+    // 'NodeHashMap_IteratorImp' objects are equal if the table iterator
+    // implementations they adapt are equal.
+
+                            // =================
+                            // class NodeHashMap
+                            // =================
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+class NodeHashMap {
+    // This class template implements a value-semantic container type holding
+    // an unordered map of 'KEY-VALUE' pairs having unique keys that provides a
+    // mapping from keys of (template parameter) type 'KEY' to their associated
+    // mapped values of (template parameter) type 'VALUE'.  Each pair is held
+    // in a separately allocated node whose address does not change for the
+    // lifetime of the pair.  The (template parameter) type 'HASH' is a functor
+    // providing the hash value for 'KEY'.  The (template parameter) type
+    // 'EQUAL' is a functor providing the equality function for two 'KEY'
+    // values.  See {Requirements on 'KEY', 'HASH', and 'EQUAL'} for more
+    // information.
+
+  private:
+    // PRIVATE TYPES
+    typedef NodeHashMap_Entry<KEY, VALUE>        Entry;
+    typedef NodeHashMap_IteratorImp<KEY, VALUE>  IteratorImp;
+
+    typedef FlatHashTable<KEY,
+                          Entry,
+                          NodeHashMap_EntryUtil<KEY, VALUE>,
+                          HASH,
+                          EQUAL> ImplType;
+        // This is the underlying implementation class.
+
+    // FRIENDS
+    friend bool operator==<>(const NodeHashMap&, const NodeHashMap&);
+    friend bool operator!=<>(const NodeHashMap&, const NodeHashMap&);
+
+    // The following verbose declaration is required by the xlC 12.1 compiler.
+    template <class K, class V, class H, class E>
+    friend void swap(NodeHashMap<K, V, H, E>&, NodeHashMap<K, V, H, E>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef typename Entry::value_type value_type;
+
+    typedef KEY                                               key_type;
+    typedef VALUE                                             mapped_type;
+    typedef bsl::size_t                                       size_type;
+    typedef bsl::ptrdiff_t                                    difference_type;
+    typedef EQUAL                                             key_compare;
+    typedef HASH                                              hasher;
+    typedef value_type&                                       reference;
+    typedef const value_type&                                 const_reference;
+    typedef bslstl::ForwardIterator<value_type, IteratorImp>  iterator;
+    typedef bslstl::ForwardIterator<const value_type,
+                                    IteratorImp>              const_iterator;
+
+  private:
+    // DATA
+    ImplType d_impl;  // underlying flat hash table used by this node hash map
+
+  public:
+    // CREATORS
+    NodeHashMap();
+    explicit NodeHashMap(bslma::Allocator *basicAllocator);
+    explicit NodeHashMap(bsl::size_t capacity);
+    NodeHashMap(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    NodeHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    NodeHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'NodeHashMap' object.  Optionally specify a
+        // 'capacity' indicating the minimum initial size of the underlying
+        // array of entries of this container.  If 'capacity' is not supplied
+        // or is 0, no memory is allocated.  Optionally specify a 'hash'
+        // functor used to generate the hash values associated with the keys of
+        // elements in this container.  If 'hash' is not supplied, a
+        // default-constructed object of the (template parameter) type 'HASH'
+        // is used.  Optionally specify an equality functor 'equal' used to
+        // determine whether the keys of two elements are equivalent.  If
+        // 'equal' is not supplied, a default-constructed object of the
+        // (template parameter) type 'EQUAL' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied or is 0, the currently installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    NodeHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    NodeHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    NodeHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    NodeHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a 'NodeHashMap' object initialized by insertion of the values
+        // from the input iterator range specified by 'first' through 'last'
+        // (including 'first', excluding 'last').  Optionally specify a
+        // 'capacity' indicating the minimum initial size of the underlying
+        // array of entries of this container.  If 'capacity' is not supplied
+        // or is 0, no memory is allocated.  Optionally specify a 'hash'
+        // functor used to generate hash values associated with the keys of the
+        // elements in this container.  If 'hash' is not supplied, a
+        // default-constructed object of the (template parameter) type 'HASH'
+        // is used.  Optionally specify an equality functor 'equal' used to
+        // determine whether the keys of two elements are equivalent.  If
+        // 'equal' is not supplied, a default-constructed object of the
+        // (template parameter) type 'EQUAL' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied or is 0, the currently installed default allocator is used.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or before
+        // 'last'.  Note that if a member of the input sequence has an
+        // equivalent key to an earlier member, the later member will not be
+        // inserted.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    NodeHashMap(bsl::initializer_list<value_type>  values,
+                bslma::Allocator                  *basicAllocator = 0);
+    NodeHashMap(bsl::initializer_list<value_type>  values,
+                bsl::size_t                        capacity,
+                bslma::Allocator                  *basicAllocator = 0);
+    NodeHashMap(bsl::initializer_list<value_type>  values,
+                bsl::size_t                        capacity,
+                const HASH&                        hash,
+                bslma::Allocator                  *basicAllocator = 0);
+    NodeHashMap(bsl::initializer_list<value_type>  values,
+                bsl::size_t                        capacity,
+                const HASH&                        hash,
+                const EQUAL&                       equal,
+                bslma::Allocator                  *basicAllocator = 0);
+        // Create a 'NodeHashMap' object initialized by insertion of the
+        // specified 'values'.  Optionally specify a 'capacity' indicating the
+        // minimum initial size of the underlying array of entries of this
+        // container.  If 'capacity' is not supplied or is 0, no memory is
+        // allocated.  Optionally specify a 'hash' functor used to generate
+        // hash values associated with the keys of elements in this container.
+        // If 'hash' is not supplied, a default-constructed object of the
+        // (template parameter) type 'HASH' is used.  Optionally specify an
+        // equality functor 'equal' used to determine whether the keys of two
+        // elements are equivalent.  If 'equal' is not supplied, a
+        // default-constructed object of the (template parameter) type 'EQUAL'
+        // is used.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is not supplied or is 0, the currently
+        // installed default allocator is used.  Note that if a member of
+        // 'values' has an equivalent key to an earlier member, the later
+        // member will not be inserted.
+#endif
+
+    NodeHashMap(const NodeHashMap&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a 'NodeHashMap' object having the same value, hasher, and
+        // equality comparator as the specified 'original' object.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not specified or is 0, the currently installed
+        // default allocator is used.
+
+    NodeHashMap(bslmf::MovableRef<NodeHashMap> original);
+        // Create a 'NodeHashMap' object having the same value, hasher,
+        // equality comparator, and allocator as the specified 'original'
+        // object.  The contents of 'original' are moved (in constant time) to
+        // this object, 'original' is left in a (valid) unspecified state, and
+        // no exceptions will be thrown.  Pointers and references to the
+        // elements of 'original' remain valid, and refer to the elements of
+        // this object.
+
+    NodeHashMap(bslmf::MovableRef<NodeHashMap>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a 'NodeHashMap' object having the same value, hasher, and
+        // equality comparator as the specified 'original' object, using the
+        // specified 'basicAllocator' to supply memory.  If 'basicAllocator' is
+        // 0, the currently installed default allocator is used.  The allocator
+        // of 'original' remains unchanged.  If 'original' and the newly
+        // created object have the same allocator then the contents of
+        // 'original' are moved (in constant time) to this object, 'original'
+        // is left in a (valid) unspecified state, no exceptions will be
+        // thrown, and pointers and references to the elements of 'original'
+        // remain valid and refer to the elements of this object; otherwise,
+        // 'original' is unchanged (and an exception may be thrown).
+
+    ~NodeHashMap();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    NodeHashMap& operator=(const NodeHashMap& rhs);
+        // Assign to this object the value, hasher, and equality functor of the
+        // specified 'rhs' object, and return a reference providing modifiable
+        // access to this object.
+
+    NodeHashMap& operator=(bslmf::MovableRef<NodeHashMap> rhs);
+        // Assign to this object the value, hasher, and equality comparator of
+        // the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.  If this object and 'rhs' use the
+        // same allocator the contents of 'rhs' are moved (in constant time) to
+        // this object.  'rhs' is left in a (valid) unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    NodeHashMap& operator=(bsl::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // map and then inserting each object in the specified 'values'
+        // initializer list, ignoring those objects having a value whose key is
+        // equivalent to that which appears earlier in the list; return a
+        // reference providing modifiable access to this object.  This method
+        // requires that the (template parameter) type 'KEY' be
+        // 'copy-insertable' into this map (see {Requirements on 'KEY', 'HASH',
+        // and 'EQUAL'}).
+#endif
+
+    template <class KEY_TYPE>
+    VALUE& operator[](BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map.  If this map does
+        // not already contain an element having 'key', insert an element with
+        // the 'key' and a default-constructed 'VALUE', and return a reference
+        // to the newly mapped value.  If 'key' is movable, 'key' is left in a
+        // (valid) unspecified state.
+
+    void clear();
+        // Remove all elements from this map.  Note that this map will be empty
+        // after calling this method, but allocated memory may be retained for
+        // future use.  See the 'capacity' method.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of modifiable
+        // elements in this map having the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // iterator is positioned one past the end of the sequence.  If this
+        // map contains no elements having a key equivalent to 'key', then the
+        // two returned iterators will have the same value.  Note that since a
+        // map maintains unique keys, the range will contain at most one
+        // element.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this map the element whose key is equal to the specified
+        // 'key', if it exists, and return 1; otherwise (there is no element
+        // having 'key' in this map), return 0 with no other effect.  This
+        // method invalidates all iterators, pointers, and references to the
+        // removed element.
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this map the element at the specified 'position', and
+        // return an iterator referring to the modifiable element immediately
+        // following the removed element, or to the past-the-end position if
+        // the removed element was the last element in the sequence of elements
+        // maintained by this map.  This method invalidates all iterators,
+        // pointers, and references to the removed element.  The behavior is
+        // undefined unless 'position' refers to an element in this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referencing the same element as 'last'.  This
+        // method invalidates all iterators, pointers, and references to the
+        // removed elements.  The behavior is undefined unless 'first' and
+        // 'last' are valid iterators on this map, and the 'first' position is
+        // at or before the 'last' position in the iteration sequence provided
+        // by this container.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the modifiable element in this map
+        // having the specified 'key', or 'end()' if no such entry exists in
+        // this map.
+
+#if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
+    template <class VALUE_TYPE>
+    bsl::pair<iterator, bool> insert(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+#else
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            bsl::pair<iterator, bool> >::type
+                    insert(BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+#endif
+        // Insert the specified 'value' into this map if the key of 'value'
+        // does not already exist in this map; otherwise, this method has no
+        // effect.  Return a 'pair' whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) modifiable element in
+        // this map whose key is equivalent to that of the element to be
+        // inserted, and whose 'second' member is 'true' if a new element was
+        // inserted, and 'false' if an element with an equivalent key was
+        // already present.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        bsl::pair<typename ImplType::iterator, bool> result =
+                  d_impl.insert(BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE,
+                                                              value));
+
+        return bsl::pair<iterator, bool>(IteratorImp(result.first.imp()),
+                                         result.second);
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each element in the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last').  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.  Note that if the key of a member of
+        // the input sequence is equivalent to the key of an earlier member,
+        // the later member will not be inserted.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<value_type> values);
+        // Insert into this map an element having the value of each object in
+        // the specified 'values' initializer list if a value with an
+        // equivalent key is not already contained in this map.  This method
+        // requires that the (template parameter) type 'KEY' be copy-insertable
+        // (see {Requirements on 'KEY', 'HASH', and 'EQUAL'}).
+#endif
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this map to at least the specified
+        // 'minimumCapacity', and redistribute all the contained elements into
+        // a new sequence of entries according to their hash values.  If
+        // '0 == minimumCapacity' and '0 == size()', the map is returned to the
+        // default constructed state.  After this call, 'load_factor()' will be
+        // less than or equal to 'max_load_factor()' and all iterators to
+        // elements of this map are invalidated; pointers and references to
+        // elements of this map remain valid.
+
+    void reserve(bsl::size_t numEntries);
+        // Change the capacity of this map to at least a capacity that can
+        // accommodate the specified 'numEntries' (accounting for the load
+        // factor invariant), and redistribute all the contained elements into
+        // a new sequence of entries according to their hash values.  If
+        // '0 == numEntries' and '0 == size()', the map is returned to the
+        // default constructed state.  After this call, 'load_factor()' will be
+        // less than or equal to 'max_load_factor()' and all iterators to
+        // elements of this map are invalidated; pointers and references to
+        // elements of this map remain valid.  Note that this method is
+        // effectively equivalent to:
+        //..
+        //     rehash(bsl::ceil(numEntries / max_load_factor()))
+        //..
+
+    void reset();
+        // Remove all elements from this map and release all memory from this
+        // map, returning the map to the default constructed state.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator to the first element in the sequence of
+        // modifiable elements maintained by this map, or the 'end' iterator if
+        // this map is empty.
+
+    iterator end();
+        // Return an iterator to the past-the-end element in the sequence of
+        // modifiable elements maintained by this map.
+
+                             // Aspects
+
+    void swap(NodeHashMap& other);
+        // Exchange the value of this object as well as its hasher and equality
+        // functors with those of the specified 'other' object.  The behavior
+        // is undefined unless this object was created with the same allocator
+        // as 'other'.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of elements this map could hold if the load factor
+        // were 1.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map contains an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this map having the specified
+        // 'key'.  Note that since a node hash map maintains unique keys, the
+        // returned value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of 'const_iterator's defining the sequence of elements
+        // in this map having the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second iterator is
+        // positioned one past the end of the sequence.  If this map contains
+        // no elements having a key equivalent to 'key', then the two returned
+        // iterators will have the same value.  Note that since a map maintains
+        // unique keys, the range will contain at most one element.
+
+    const_iterator find(const KEY& key) const;
+        // Return a 'const_iterator' referring to the element in this map
+        // having the specified 'key', or 'end()' if no such entry exists in
+        // this map.
+
+    HASH hash_function() const;
+        // Return (a copy of) the unary hash functor used by this map to
+        // generate a hash value (of type 'bsl::size_t') for a 'KEY' object.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the binary key-equality functor that returns
+        // 'true' if the value of two 'KEY' objects are equivalent, and 'false'
+        // otherwise.
+
+    float load_factor() const;
+        // Return the current ratio between the number of elements in this
+        // container and its capacity.
+
+    float max_load_factor() const;
+        // Return the maximum load factor allowed for this map.  Note that if
+        // an insert operation would cause the load factor to exceed
+        // 'max_load_factor()', that same insert operation will increase the
+        // capacity and rehash the entries of the container (see {Load Factor
+        // and Resizing}).  Also note that the value returned by
+        // 'max_load_factor' is implementation defined and cannot be changed by
+        // the user.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+                          // Iterators
+
+    const_iterator begin() const;
+        // Return a 'const_iterator' to the first element in the sequence of
+        // elements maintained by this map, or the 'end' iterator if this map
+        // is empty.
+
+    const_iterator cbegin() const;
+        // Return a 'const_iterator' to the first element in the sequence of
+        // elements maintained by this map, or the 'end' iterator if this map
+        // is empty.
+
+    const_iterator cend() const;
+        // Return a 'const_iterator' to the past-the-end element in the
+        // sequence of elements maintained by this map.
+
+    const_iterator end() const;
+        // Return a 'const_iterator' to the past-the-end element in the
+        // sequence of elements maintained by this map.
+
+                           // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this node hash map to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Format this object to the specified output 'stream' at the (absolute
+        // value of) the optionally specified indentation 'level', and return a
+        // reference to the modifiable 'stream'.  If 'level' is specified,
+        // optionally specify 'spacesPerLevel', the number of spaces per
+        // indentation level for this and all of its nested objects.  If
+        // 'level' is negative, suppress indentation of the first line.  If
+        // 'spacesPerLevel' is negative, format the entire output on one line,
+        // suppressing all but the initial indentation (as governed by
+        // 'level').  If 'stream' is not valid on entry, this operation has no
+        // effect.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const NodeHashMap<KEY, VALUE, HASH, EQUAL> &lhs,
+                const NodeHashMap<KEY, VALUE, HASH, EQUAL> &rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'NodeHashMap' objects have the same
+    // value if their sizes are the same and each element contained in one is
+    // equal to an element of the other.  The hash and equality functors are
+    // not involved in the comparison.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const NodeHashMap<KEY, VALUE, HASH, EQUAL> &lhs,
+                const NodeHashMap<KEY, VALUE, HASH, EQUAL> &rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'NodeHashMap' objects do not
+    // have the same value if their sizes are different or one contains an
+    // element equal to no element of the other.  The hash and equality
+    // functors are not involved in the comparison.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::ostream& operator<<(bsl::ostream&                               stream,
+                         const NodeHashMap<KEY, VALUE, HASH, EQUAL>& map);
+    // Write the value of the specified 'map' to the specified output 'stream'
+    // in a single-line format, and return a reference providing modifiable
+    // access to 'stream'.  If 'stream' is not valid on entry, this operation
+    // has no effect.  Note that this human-readable format is not fully
+    // specified and can change without notice.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(NodeHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          NodeHashMap<KEY, VALUE, HASH, EQUAL>& b);
+    // Exchange the value, the hasher, and the key-equality functor of the
+    // specified 'a' and 'b' objects.  This function provides the no-throw
+    // exception-safety guarantee if the two objects were created with the same
+    // allocator and the basic guarantee otherwise.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class NodeHashMap_Entry
+                          // -----------------------
+
+// PRIVATE CREATORS
+template <class KEY, class VALUE>
+inline
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry()
+: d_node_p(0)
+{
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE>
+template <class ARG_TYPE>
+void NodeHashMap_Entry<KEY, VALUE>::createNode(
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(ARG_TYPE)  argument)
+{
+    BSLS_ASSERT_SAFE(allocator);
+    BSLS_ASSERT_SAFE(0 == d_node_p);
+
+    Node *node = static_cast<Node *>(allocator->allocate(sizeof(Node)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(node, allocator);
+
+    bslma::ConstructionUtil::construct(
+                                 node->d_value.address(),
+                                 allocator,
+                                 BSLS_COMPILERFEATURES_FORWARD(ARG_TYPE,
+                                                               argument));
+    node->d_allocator_p = allocator;
+
+    proctor.release();
+
+    d_node_p = node;
+}
+
+template <class KEY, class VALUE>
+template <class ARG1_TYPE, class ARG2_TYPE>
+void NodeHashMap_Entry<KEY, VALUE>::createNode(
+                       bslma::Allocator                             *allocator,
+                       BSLS_COMPILERFEATURES_FORWARD_REF(ARG1_TYPE)  argument1,
+                       BSLS_COMPILERFEATURES_FORWARD_REF(ARG2_TYPE)  argument2)
+{
+    BSLS_ASSERT_SAFE(allocator);
+    BSLS_ASSERT_SAFE(0 == d_node_p);
+
+    Node *node = static_cast<Node *>(allocator->allocate(sizeof(Node)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(node, allocator);
+
+    bslma::ConstructionUtil::construct(
+                                 node->d_value.address(),
+                                 allocator,
+                                 BSLS_COMPILERFEATURES_FORWARD(ARG1_TYPE,
+                                                               argument1),
+                                 BSLS_COMPILERFEATURES_FORWARD(ARG2_TYPE,
+                                                               argument2));
+    node->d_allocator_p = allocator;
+
+    proctor.release();
+
+    d_node_p = node;
+}
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                      const NodeHashMap_Entry&  original,
+                                      bslma::Allocator         *basicAllocator)
+: d_node_p(0)
+{
+    BSLS_ASSERT_SAFE(original.d_node_p);
+
+    createNode(bslma::Default::allocator(basicAllocator), original.value());
+}
+
+template <class KEY, class VALUE>
+inline
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                 bslmf::MovableRef<NodeHashMap_Entry> original)
+: d_node_p(bslmf::MovableRefUtil::access(original).d_node_p)
+{
+    bslmf::MovableRefUtil::access(original).d_node_p = 0;
+}
+
+template <class KEY, class VALUE>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                          bslmf::MovableRef<NodeHashMap_Entry>  original,
+                          bslma::Allocator                     *basicAllocator)
+: d_node_p(0)
+{
+    NodeHashMap_Entry& lvalue = original;
+
+    BSLS_ASSERT_SAFE(lvalue.d_node_p);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    if (allocator == lvalue.d_node_p->d_allocator_p) {
+        d_node_p        = lvalue.d_node_p;
+        lvalue.d_node_p = 0;
+    }
+    else {
+        createNode(allocator, bslmf::MovableRefUtil::move(lvalue.value()));
+    }
+}
+
+template <class KEY, class VALUE>
+inline
+NodeHashMap_Entry<KEY, VALUE>::~NodeHashMap_Entry()
+{
+    if (d_node_p) {
+        bslma::DestructionUtil::destroy(d_node_p->d_value.address());
+        d_node_p->d_allocator_p->deallocate(d_node_p);
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE>
+inline
+typename NodeHashMap_Entry<KEY, VALUE>::value_type&
+NodeHashMap_Entry<KEY, VALUE>::value()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_node_p->d_value.object();
+}
+
+// ACCESSORS
+template <class KEY, class VALUE>
+inline
+const typename NodeHashMap_Entry<KEY, VALUE>::value_type&
+NodeHashMap_Entry<KEY, VALUE>::value() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_node_p->d_value.object();
+}
+
+                        // ----------------------------
+                        // struct NodeHashMap_EntryUtil
+                        // ----------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE>
+template <class KEY_TYPE>
+void NodeHashMap_EntryUtil<KEY, VALUE>::construct(
+                        Entry                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bsls::ObjectBuffer<VALUE> value;
+
+    bslma::ConstructionUtil::construct(value.address(), allocator);
+    bslma::DestructorGuard<VALUE> guard(value.address());
+
+    Entry *newEntry = ::new (static_cast<void *>(entry)) Entry();
+
+    newEntry->createNode(allocator,
+                         BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key),
+                         bslmf::MovableRefUtil::move(value.object()));
+}
+
+template <class KEY, class VALUE>
+inline
+const KEY& NodeHashMap_EntryUtil<KEY, VALUE>::key(const Entry& entry)
+{
+    return entry.value().first;
+}
+
+                       // -----------------------------
+                       // class NodeHashMap_IteratorImp
+                       // -----------------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+NodeHashMap_IteratorImp<KEY, VALUE>::NodeHashMap_IteratorImp()
+: d_imp()
+{
+}
+
+template <class KEY, class VALUE>
+inline
+NodeHashMap_IteratorImp<KEY, VALUE>::NodeHashMap_IteratorImp(
+                                                   const TableIteratorImp& imp)
+: d_imp(imp)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE>
+inline
+void NodeHashMap_IteratorImp<KEY, VALUE>::operator++()
+{
+    ++d_imp;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE>
+inline
+typename NodeHashMap_IteratorImp<KEY, VALUE>::value_type&
+NodeHashMap_IteratorImp<KEY, VALUE>::operator*() const
+{
+    return (*d_imp).value();
+}
+
+template <class KEY, class VALUE>
+inline
+const typename NodeHashMap_IteratorImp<KEY, VALUE>::TableIteratorImp&
+NodeHashMap_IteratorImp<KEY, VALUE>::tableImp() const
+{
+    return d_imp;
+}
+
+                            // -----------------
+                            // class NodeHashMap
+                            // -----------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                             bsl::initializer_list<value_type>  values,
+                             bslma::Allocator                  *basicAllocator)
+: NodeHashMap(values.begin(),
+              values.end(),
+              0,
+              HASH(),
+              EQUAL(),
+              basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                             bsl::initializer_list<value_type>  values,
+                             bsl::size_t                        capacity,
+                             bslma::Allocator                  *basicAllocator)
+: NodeHashMap(values.begin(),
+              values.end(),
+              capacity,
+              HASH(),
+              EQUAL(),
+              basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                             bsl::initializer_list<value_type>  values,
+                             bsl::size_t                        capacity,
+                             const HASH&                        hash,
+                             bslma::Allocator                  *basicAllocator)
+: NodeHashMap(values.begin(),
+              values.end(),
+              capacity,
+              hash,
+              EQUAL(),
+              basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                             bsl::initializer_list<value_type>  values,
+                             bsl::size_t                        capacity,
+                             const HASH&                        hash,
+                             const EQUAL&                       equal,
+                             bslma::Allocator                  *basicAllocator)
+: NodeHashMap(values.begin(),
+              values.end(),
+              capacity,
+              hash,
+              equal,
+              basicAllocator)
+{
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                            const NodeHashMap&  original,
+                                            bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                       bslmf::MovableRef<NodeHashMap> original)
+: d_impl(bslmf::MovableRefUtil::move(
+                               bslmf::MovableRefUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                bslmf::MovableRef<NodeHashMap>  original,
+                                bslma::Allocator               *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(
+                               bslmf::MovableRefUtil::access(original).d_impl),
+         basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::~NodeHashMap()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>&
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::operator=(const NodeHashMap& rhs)
+{
+    d_impl = rhs.d_impl;
+
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>&
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::operator=(
+                                            bslmf::MovableRef<NodeHashMap> rhs)
+{
+    NodeHashMap& lvalue = rhs;
+
+    d_impl = bslmf::MovableRefUtil::move(lvalue.d_impl);
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>&
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::operator=(
+                                      bsl::initializer_list<value_type> values)
+{
+    NodeHashMap tmp(values.begin(),
+                    values.end(),
+                    0,
+                    d_impl.hash_function(),
+                    d_impl.key_eq(),
+                    d_impl.allocator());
+
+    this->swap(tmp);
+
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class KEY_TYPE>
+inline
+VALUE& NodeHashMap<KEY, VALUE, HASH, EQUAL>::operator[](
+                               BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+{
+    return d_impl[BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key)].value().second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator,
+          typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key)
+{
+    bsl::pair<typename ImplType::iterator,
+              typename ImplType::iterator> range = d_impl.equal_range(key);
+
+    return bsl::pair<iterator, iterator>(IteratorImp(range.first.imp()),
+                                         IteratorImp(range.second.imp()));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t NodeHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return IteratorImp(d_impl.erase(typename ImplType::const_iterator(
+                                           position.imp().tableImp())).imp());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::erase(iterator position)
+{
+    // Note that this overload is necessary to avoid ambiguity when the key is
+    // an iterator.
+
+    BSLS_ASSERT_SAFE(position != end());
+
+    return erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    typedef typename ImplType::const_iterator ImplConstIterator;
+
+    return IteratorImp(d_impl.erase(ImplConstIterator(first.imp().tableImp()),
+                                    ImplConstIterator(last.imp().tableImp()))
+                                                                       .imp());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return IteratorImp(d_impl.find(key).imp());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                      bsl::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numEntries)
+{
+    d_impl.reserve(numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+                                  NodeHashMap<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return IteratorImp(d_impl.begin().imp());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+                                    NodeHashMap<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return IteratorImp(d_impl.end().imp());
+}
+
+                             // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::swap(NodeHashMap& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t NodeHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool NodeHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t NodeHashMap<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool NodeHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator,
+          typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key) const
+{
+    bsl::pair<typename ImplType::const_iterator,
+              typename ImplType::const_iterator> range =
+                                                      d_impl.equal_range(key);
+
+    return bsl::pair<const_iterator, const_iterator>(
+                                             IteratorImp(range.first.imp()),
+                                             IteratorImp(range.second.imp()));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return IteratorImp(d_impl.find(key).imp());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH NodeHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL NodeHashMap<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float NodeHashMap<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float NodeHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t NodeHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+                      NodeHashMap<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return IteratorImp(d_impl.begin().imp());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+                     NodeHashMap<KEY, VALUE, HASH, EQUAL>::cbegin() const
+{
+    return IteratorImp(d_impl.cbegin().imp());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+                       NodeHashMap<KEY, VALUE, HASH, EQUAL>::cend() const
+{
+    return IteratorImp(d_impl.cend().imp());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+                        NodeHashMap<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return IteratorImp(d_impl.end().imp());
+}
+
+                             // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *NodeHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::ostream& NodeHashMap<KEY, VALUE, HASH, EQUAL>::print(
+                                            bsl::ostream& stream,
+                                            int           level,
+                                            int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+
+    printer.start();
+
+    const_iterator iter = begin();
+    while (iter != end()) {
+        printer.printValue(*iter);
+        ++iter;
+    }
+
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE>
+inline
+bool bdlc::operator==(const NodeHashMap_Entry<KEY, VALUE>& lhs,
+                      const NodeHashMap_Entry<KEY, VALUE>& rhs)
+{
+    return lhs.value() == rhs.value();
+}
+
+template <class KEY, class VALUE>
+inline
+bool bdlc::operator!=(const NodeHashMap_Entry<KEY, VALUE>& lhs,
+                      const NodeHashMap_Entry<KEY, VALUE>& rhs)
+{
+    return lhs.value() != rhs.value();
+}
+
+template <class KEY, class VALUE>
+inline
+bool bdlc::operator==(const NodeHashMap_IteratorImp<KEY, VALUE>& a,
+                      const NodeHashMap_IteratorImp<KEY, VALUE>& b)
+{
+    return a.d_imp == b.d_imp;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const NodeHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const NodeHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const NodeHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const NodeHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl != rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::ostream& bdlc::operator<<(
+                            bsl::ostream&                               stream,
+                            const NodeHashMap<KEY, VALUE, HASH, EQUAL>& map)
+{
+    return map.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void bdlc::swap(NodeHashMap<KEY, VALUE, HASH, EQUAL>& a,
+                NodeHashMap<KEY, VALUE, HASH, EQUAL>& b)
+{
+    bslalg::SwapUtil::swap(&a.d_impl, &b.d_impl);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct HasStlIterators<bdlc::NodeHashMap<KEY, VALUE, HASH, EQUAL> >
+: bsl::true_type {
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlc::NodeHashMap<KEY, VALUE, HASH, EQUAL> >
+: bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,2115 @@
+// bdlc_nodehashmap.t.cpp                                             -*-C++-*-
+
+#include <bdlc_nodehashmap.h>
+
+#include <bdlc_flathashmap.h>
+
+#include <bslalg_hasstliterators.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_buildtarget.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a container implementing an unordered map
+// whose elements are held in separately allocated nodes that are indexed by a
+// 'bdlc::FlatHashTable'.  The general concerns are correctness, the stability
+// of element addresses, exception safety, and proper dispatching.  Most of the
+// container functionality forwards to 'bdlc::FlatHashTable', so the testing
+// concentrates on the forwarding, on the node-owning entry type
+// 'bdlc::NodeHashMap_Entry', and on the adaptation of the table iterators.
+//
+// Primary Manipulators:
+//: o 'clear'
+//: o 'erase(key)'
+//: o 'insert'
+//: o 'reset'
+//
+// Basic Accessors:
+//: o 'allocator'
+//: o 'capacity'
+//: o 'find'
+//: o 'hash_function'
+//: o 'key_eq'
+//: o 'max_load_factor'
+//: o 'size'
+//
+// Global Concerns:
+//: o ACCESSOR methods are declared 'const'.
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+//: o Injected exceptions are safely propagated during memory allocation.
+//: o Precondition violations are detected in appropriate build modes.
+// ----------------------------------------------------------------------------
+// NodeHashMap_Entry
+// [ 2] NodeHashMap_Entry(FORWARD_REF(VALUE_TYPE) value, Allocator * = 0);
+// [ 2] NodeHashMap_Entry(const NodeHashMap_Entry&, Allocator * = 0);
+// [ 2] NodeHashMap_Entry(MovableRef<NodeHashMap_Entry> original);
+// [ 2] NodeHashMap_Entry(MovableRef<NodeHashMap_Entry>, Allocator *);
+// [ 2] ~NodeHashMap_Entry();
+// [ 2] value_type& value();
+// [ 2] const value_type& value() const;
+// [ 2] bool operator==(const Entry&, const Entry&);
+// [ 2] bool operator!=(const Entry&, const Entry&);
+//
+// CREATORS
+// [ 3] NodeHashMap();
+// [ 3] NodeHashMap(Allocator *basicAllocator);
+// [ 3] NodeHashMap(size_t capacity);
+// [ 3] NodeHashMap(size_t capacity, Allocator *basicAllocator);
+// [ 3] NodeHashMap(size_t capacity, const HASH&, Allocator *bA = 0);
+// [ 3] NodeHashMap(size_t, const HASH&, const EQUAL&, Allocator * = 0);
+// [10] NodeHashMap(INPUT_ITERATOR, INPUT_ITERATOR, Allocator *bA = 0);
+// [10] NodeHashMap(INPUT_ITER, INPUT_ITER, size_t, Allocator * = 0);
+// [10] NodeHashMap(II, II, size_t, const HASH&, Allocator * = 0);
+// [10] NodeHashMap(II, II, size_t, const H&, const EQ&, Alloc * = 0);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [10] NodeHashMap(bsl::initializer_list<v_t> values, Allocator * = 0);
+// [10] NodeHashMap(bsl::initializer_list<v_t>, size_t, Allocator * = 0);
+// [10] NodeHashMap(init_list<v_t>, size_t, const HASH&, Allocator * = 0);
+// [10] NodeHashMap(init_list<v_t>, size_t, const H&, const EQ&, A * = 0);
+// #endif
+// [ 6] NodeHashMap(const NodeHashMap&, Allocator *bA = 0);
+// [ 7] NodeHashMap(NodeHashMap&&);
+// [ 7] NodeHashMap(NodeHashMap&&, Allocator *basicAllocator);
+// [ 3] ~NodeHashMap();
+//
+// MANIPULATORS
+// [ 6] NodeHashMap& operator=(const NodeHashMap&);
+// [ 7] NodeHashMap& operator=(NodeHashMap&&);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [10] NodeHashMap& operator=(bsl::initializer_list<v_t> values);
+// #endif
+// [11] VALUE& operator[](FORWARD_REF(KEY) key);
+// [ 3] void clear();
+// [ 9] bsl::pair<iterator, iterator> equal_range(const KEY& key);
+// [ 3] size_t erase(const KEY&);
+// [12] iterator erase(const_iterator);
+// [12] iterator erase(iterator);
+// [12] iterator erase(const_iterator, const_iterator);
+// [ 9] iterator find(const KEY& key);
+// [ 3] bsl::pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) entry)
+// [10] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [10] void insert(bsl::initializer_list<value_type> values);
+// #endif
+// [13] void rehash(size_t);
+// [13] void reserve(size_t);
+// [ 3] void reset();
+// [ 9] iterator begin();
+// [ 9] iterator end();
+// [ 8] void swap(NodeHashMap&);
+//
+// ACCESSORS
+// [ 4] size_t capacity() const;
+// [ 9] bool contains(const KEY&) const;
+// [ 9] bsl::size_t count(const KEY& key) const;
+// [ 9] bool empty() const;
+// [ 9] bsl::pair<ci, ci> equal_range(const KEY&) const;
+// [ 4] const_iterator find(const KEY&) const;
+// [ 4] HASH hash_function() const;
+// [ 4] EQUAL key_eq() const;
+// [ 9] float load_factor() const;
+// [ 4] float max_load_factor() const;
+// [ 4] size_t size() const;
+// [ 9] const_iterator begin() const;
+// [ 9] const_iterator cbegin() const;
+// [ 9] const_iterator cend() const;
+// [ 9] const_iterator end() const;
+// [ 4] Allocator *allocator() const;
+// [ 5] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const NodeHashMap&, const NodeHashMap&);
+// [ 5] bool operator!=(const NodeHashMap&, const NodeHashMap&);
+// [ 5] ostream& operator<<(ostream& stream, const NodeHashMap& map);
+//
+// FREE FUNCTIONS
+// [ 8] void swap(NodeHashMap&, NodeHashMap&);
+// ----------------------------------------------------------------------------
+// [15] USAGE EXAMPLE
+// [14] CONCERN: 'NodeHashMap' has the necessary type traits
+// [13] CONCERN: element addresses are stable across resizes
+// [ 1] BREATHING TEST
+// [-1] PERFORMANCE TEST
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT  BSLIM_TESTUTIL_ASSERT
+#define ASSERTV BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q  BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P  BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_ BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                  GLOBAL CLASSES/STRUCTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+                             // ================
+                             // class SeedIsHash
+                             // ================
+
+template <class TYPE>
+class SeedIsHash {
+    // This class template provides a hash algorithm that returns the specified
+    // seed value for all hash requests.
+
+    bsl::size_t d_seed;  // value to return for all hash requests
+
+  public:
+    // CREATORS
+    SeedIsHash()
+        // Create a 'SeedIsHash' object having 0 as the seed value.
+    : d_seed(0)
+    {
+    }
+
+    explicit SeedIsHash(bsl::size_t seed)
+        // Create a 'SeedIsHash' object having the specified 'seed'.
+    : d_seed(seed)
+    {
+    }
+
+    // ACCESSORS
+    bsl::size_t operator()(const TYPE&) const
+        // Return the provided-at-construction seed value.
+    {
+        return d_seed;
+    }
+};
+
+// ============================================================================
+//                       GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::NodeHashMap<int, int>                 IntObj;
+typedef bdlc::NodeHashMap<bsl::string, bsl::string> StrObj;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static unsigned int s_antiOptimization = 0;
+
+template <class MAP>
+bsls::TimeInterval performanceFindPresent(MAP *map)
+    // For the specified 'map', insert a large number of values and then invoke
+    // 'find()' with values matching those inserted.  Return the duration of
+    // the 'find()' invocations.
+{
+    const int NUM_TRIAL = 101;
+    const int MAX       = 1 << 16;
+    const int NUM_ITER  = 4;
+
+    for (int i = 0; i < MAX; ++i) {
+        map->insert(bsl::make_pair(i * 31, i));
+    }
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (int iter = 0; iter < NUM_ITER; ++iter) {
+            for (int i = 0; i < MAX; ++i) {
+                s_antiOptimization +=
+                                map->find(((i * 7) & (MAX - 1)) * 31)->second;
+            }
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return results[NUM_TRIAL / 2];
+}
+
+template <class MAP>
+bsls::TimeInterval performanceFindNotPresent(MAP *map)
+    // For the specified 'map', insert a large number of values and then invoke
+    // 'find()' with values not matching those inserted.  Return the duration
+    // of the 'find()' invocations.
+{
+    const int NUM_TRIAL = 101;
+    const int MAX       = 1 << 16;
+    const int NUM_ITER  = 4;
+
+    for (int i = 0; i < MAX; ++i) {
+        map->insert(bsl::make_pair(i * 31, i));
+    }
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (int iter = 0; iter < NUM_ITER; ++iter) {
+            for (int i = 0; i < MAX; ++i) {
+                if (map->end() == map->find(((i * 7) & (MAX - 1)) * 31 + 1)) {
+                    ++s_antiOptimization;
+                }
+            }
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return results[NUM_TRIAL / 2];
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 15: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Retaining References to Mapped Values
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a table of the latest prices of securities, keyed by an
+// integral security identifier, and some of our clients cache the address of
+// the price of a security of interest rather than look it up every time it is
+// needed.  The table grows as new securities are seen, so the cached addresses
+// must remain valid when the table is resized.
+//
+// First, we define an alias for our price table:
+//..
+    typedef bdlc::NodeHashMap<int, double> PriceTable;
+//..
+// Then, we create an (empty) price table, and record the price of a security
+// that a client is watching, retaining the address of the price:
+//..
+    PriceTable prices;
+
+    double *watchedPrice = &prices[1234];
+
+    *watchedPrice = 101.25;
+//..
+// Next, we record prices for many more securities, which causes the table to
+// be resized several times:
+//..
+    const bsl::size_t initialCapacity = prices.capacity();
+
+    for (int id = 0; id < 1000; ++id) {
+        prices[id] = 1.0 + id;
+    }
+
+    ASSERT(initialCapacity < prices.capacity());
+//..
+// Now, we observe that the retained address still refers to the price of the
+// watched security:
+//..
+    ASSERT(watchedPrice == &prices[1234]);
+    ASSERT(101.25       == *watchedPrice);
+//..
+// Finally, we update the price through the retained address and observe the
+// change through the table:
+//..
+    *watchedPrice = 99.5;
+
+    ASSERT(99.5 == prices.find(1234)->second);
+//..
+// Note that had 'PriceTable' been a 'bdlc::FlatHashMap', 'watchedPrice' would
+// have been invalidated by the first resize.
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TYPE TRAITS
+        //
+        // Concerns:
+        //: 1 'NodeHashMap' has the 'bslalg::HasStlIterators' and
+        //:   'bslma::UsesBslmaAllocator' traits.
+        //:
+        //: 2 'NodeHashMap_Entry' has the 'bslma::UsesBslmaAllocator' and
+        //:   'bslmf::IsBitwiseMoveable' traits, so that resizing the
+        //:   underlying table relocates only the node pointers.
+        //
+        // Plan:
+        //: 1 Directly verify the traits.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: 'NodeHashMap' has the necessary type traits
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TYPE TRAITS" << endl
+                          << "===========" << endl;
+
+        typedef bdlc::NodeHashMap_Entry<bsl::string, bsl::string> Entry;
+
+        ASSERT(bslalg::HasStlIterators<StrObj>::value);
+        ASSERT(bslma::UsesBslmaAllocator<StrObj>::value);
+
+        ASSERT(bslma::UsesBslmaAllocator<Entry>::value);
+        ASSERT(bslmf::IsBitwiseMoveable<Entry>::value);
+        ASSERT(sizeof(void *) == sizeof(Entry));
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // 'rehash', 'reserve', AND ELEMENT ADDRESS STABILITY
+        //
+        // Concerns:
+        //: 1 'rehash' and 'reserve' correctly forward to the implementation
+        //:   class.
+        //:
+        //: 2 The addresses of the elements, and of their keys and mapped
+        //:   values, do not change when the map is resized, whether by
+        //:   'rehash', 'reserve', or an insertion.
+        //:
+        //: 3 Resizing the map does not allocate or deallocate nodes, and so
+        //:   neither copies nor moves the elements.
+        //
+        // Plan:
+        //: 1 Insert elements one at a time, retaining the address of each
+        //:   inserted element.  After each insertion, and after explicit
+        //:   calls to 'rehash' and 'reserve', verify that each retained
+        //:   address is the address of the element found for its key, and that
+        //:   the capacity is as expected.  (C-1..2)
+        //:
+        //: 2 Use a 'bslma::TestAllocator' to verify that each resize allocates
+        //:   and deallocates only the two arrays of the underlying table.
+        //:   (C-3)
+        //
+        // Testing:
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   CONCERN: element addresses are stable across resizes
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                     << "'rehash', 'reserve', AND ELEMENT ADDRESS STABILITY"
+                     << endl
+                     << "=================================================="
+                     << endl;
+
+        const int NUM_ELEMENTS = 1000;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        StrObj mX(&oa);  const StrObj& X = mX;
+
+        bsl::vector<const StrObj::value_type *> addresses;
+
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            bsl::ostringstream oss;
+            oss << "a somewhat long key preventing short-string optimization "
+                << i;
+            const bsl::string KEY(oss.str(), &oa);
+
+            const bsl::size_t capacity = X.capacity();
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+            StrObj::value_type& element = *mX.insert(
+                                  StrObj::value_type(KEY, KEY, &oa)).first;
+
+            addresses.push_back(&element);
+
+            // A new node holding two allocating strings, plus the two arrays
+            // of the table if it was resized (and less the two arrays it
+            // replaced).
+
+            ASSERTV(i, NUM_BLOCKS + 3 == oa.numBlocksInUse()
+                    || capacity != X.capacity());
+
+            if (0 == (i & (i + 1))) {
+                for (int j = 0; j <= i; ++j) {
+                    bsl::ostringstream oss;
+                    oss << "a somewhat long key preventing short-string "
+                        << "optimization " << j;
+
+                    StrObj::const_iterator iter = X.find(oss.str());
+
+                    ASSERTV(i, j, iter != X.end());
+                    ASSERTV(i, j, &*iter == addresses[j]);
+                }
+            }
+        }
+
+        ASSERT(NUM_ELEMENTS == static_cast<int>(X.size()));
+
+        if (verbose) cout << "Testing 'rehash'." << endl;
+        {
+            const bsl::size_t        capacity   = X.capacity();
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+            const bsls::Types::Int64 NUM_TOTAL  = oa.numBlocksTotal();
+
+            mX.rehash(4 * capacity);
+
+            ASSERTV(X.capacity(), 4 * capacity == X.capacity());
+            ASSERT(NUM_BLOCKS    == oa.numBlocksInUse());
+            ASSERT(NUM_TOTAL + 2 == oa.numBlocksTotal());
+
+            int j = 0;
+            for (StrObj::const_iterator iter = X.begin();
+                 iter != X.end();
+                 ++iter, ++j) {
+                ASSERTV(j, addresses.end() != bsl::find(addresses.begin(),
+                                                        addresses.end(),
+                                                        &*iter));
+            }
+            ASSERT(NUM_ELEMENTS == j);
+        }
+
+        if (verbose) cout << "Testing 'reserve'." << endl;
+        {
+            const bsl::size_t        capacity   = X.capacity();
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+            mX.reserve(2 * capacity);
+
+            ASSERTV(X.capacity(), 2 * capacity < X.capacity());
+            ASSERT(NUM_BLOCKS == oa.numBlocksInUse());
+
+            for (int j = 0; j < NUM_ELEMENTS; ++j) {
+                ASSERTV(j, &*X.find(addresses[j]->first) == addresses[j]);
+            }
+        }
+
+        if (verbose) cout << "Testing erasure does not affect others."
+                          << endl;
+        {
+            for (int j = 0; j < NUM_ELEMENTS; j += 2) {
+                ASSERTV(j, 1 == mX.erase(addresses[j]->first));
+            }
+
+            mX.rehash(0);
+
+            for (int j = 1; j < NUM_ELEMENTS; j += 2) {
+                ASSERTV(j, &*X.find(addresses[j]->first) == addresses[j]);
+                ASSERTV(j, addresses[j]->first == addresses[j]->second);
+            }
+            ASSERT(NUM_ELEMENTS / 2 == static_cast<int>(X.size()));
+        }
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // 'erase(const_iterator)' AND 'erase(const_iterator, const_iterator)'
+        //
+        // Concerns:
+        //: 1 The 'erase' methods taking iterators remove the referenced
+        //:   elements, reclaim their nodes, and return an iterator to the
+        //:   element following the removed elements.
+        //:
+        //: 2 The remaining elements are not relocated.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create maps of various sizes, erase elements using the iterator
+        //:   methods, and verify the returned iterator, the value of the map,
+        //:   the addresses of the remaining elements, and the memory in use.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid attribute values, but not triggered for
+        //:   adjacent valid ones (using the 'BSLS_ASSERTTEST_*' macros).
+        //:   (C-3)
+        //
+        // Testing:
+        //   iterator erase(const_iterator);
+        //   iterator erase(iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'erase' WITH ITERATORS" << endl
+                          << "======================" << endl;
+
+        if (verbose) cout << "Testing 'erase(const_iterator)'." << endl;
+        {
+            for (int n = 1; n < 40; ++n) {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntObj mX(&oa);  const IntObj& X = mX;
+
+                for (int i = 0; i < n; ++i) {
+                    mX[i] = i * i;
+                }
+
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+                int count = n;
+                for (IntObj::const_iterator iter = X.begin();
+                     iter != X.end(); ) {
+                    IntObj::const_iterator next = iter;
+                    ++next;
+
+                    const int KEY = iter->first;
+
+                    IntObj::iterator result = mX.erase(iter);
+
+                    --count;
+
+                    ASSERTV(n, KEY, next == result);
+                    ASSERTV(n, KEY, count == static_cast<int>(X.size()));
+                    ASSERTV(n, KEY, false == X.contains(KEY));
+                    ASSERTV(n, KEY, NUM_BLOCKS - (n - count) ==
+                                                         oa.numBlocksInUse());
+
+                    iter = result;
+                }
+                ASSERTV(n, X.empty());
+            }
+        }
+
+        if (verbose) cout << "Testing 'erase(iterator)'." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            IntObj mX(&oa);  const IntObj& X = mX;
+
+            for (int i = 0; i < 20; ++i) {
+                mX[i] = i;
+            }
+
+            const int *pValue = &mX[19];
+
+            for (int i = 0; i < 19; ++i) {
+                IntObj::iterator iter = mX.find(i);
+
+                IntObj::iterator next = iter;
+                ++next;
+
+                ASSERTV(i, next == mX.erase(iter));
+            }
+
+            ASSERT(1      == X.size());
+            ASSERT(pValue == &X.find(19)->second);
+        }
+
+        if (verbose) {
+            cout << "Testing 'erase(const_iterator, const_iterator)'." << endl;
+        }
+        {
+            for (int n = 0; n < 40; ++n) {
+                for (int first = 0; first <= n; ++first) {
+                    for (int last = first; last <= n; ++last) {
+                        bslma::TestAllocator oa("object",
+                                                veryVeryVeryVerbose);
+
+                        IntObj mX(&oa);  const IntObj& X = mX;
+
+                        for (int i = 0; i < n; ++i) {
+                            mX[i] = -i;
+                        }
+
+                        IntObj::const_iterator firstIter = X.begin();
+                        for (int i = 0; i < first; ++i) {
+                            ++firstIter;
+                        }
+
+                        IntObj::const_iterator lastIter = firstIter;
+                        for (int i = first; i < last; ++i) {
+                            ++lastIter;
+                        }
+
+                        bsl::vector<const IntObj::value_type *> kept;
+                        for (IntObj::const_iterator iter = X.begin();
+                             iter != firstIter;
+                             ++iter) {
+                            kept.push_back(&*iter);
+                        }
+                        for (IntObj::const_iterator iter = lastIter;
+                             iter != X.end();
+                             ++iter) {
+                            kept.push_back(&*iter);
+                        }
+
+                        IntObj::iterator result = mX.erase(firstIter,
+                                                           lastIter);
+
+                        ASSERTV(n, first, last, lastIter == result);
+                        ASSERTV(n, first, last,
+                               n - (last - first) ==
+                                                 static_cast<int>(X.size()));
+
+                        for (bsl::size_t i = 0; i < kept.size(); ++i) {
+                            ASSERTV(n, first, last, i,
+                                    &*X.find(kept[i]->first) == kept[i]);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "Negative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            IntObj mX(&oa);  const IntObj& X = mX;
+
+            mX[0] = 0;
+
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_FAIL(mX.erase(mX.end()));
+            ASSERT_SAFE_PASS(mX.erase(mX.begin()));
+        }
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // 'operator[]'
+        //
+        // Concerns:
+        //: 1 'operator[]' returns a reference to the mapped value of an
+        //:   existing element without allocating memory.
+        //:
+        //: 2 'operator[]' inserts an element having the key and a
+        //:   default-constructed mapped value, allocated from the object
+        //:   allocator, if no element has the key.
+        //:
+        //: 3 'operator[]' is exception neutral and leaks no memory when an
+        //:   allocation fails.
+        //
+        // Plan:
+        //: 1 Use 'operator[]' to insert and access elements, and verify the
+        //:   returned reference, the value of the map, and the memory in use.
+        //:   (C-1..2)
+        //:
+        //: 2 Use 'operator[]' within the 'bslma::TestAllocator' exception test
+        //:   macros, and verify the map is unchanged when an exception is
+        //:   thrown.  (C-3)
+        //
+        // Testing:
+        //   VALUE& operator[](FORWARD_REF(KEY) key);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'operator[]'" << endl
+                          << "============" << endl;
+
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            StrObj mX(&oa);  const StrObj& X = mX;
+
+            const char *LONG = "a string long enough to require an allocation";
+
+            bsl::string& value = mX[bsl::string(LONG)];
+
+            ASSERT(1              == X.size());
+            ASSERT(value.empty());
+            ASSERT(&oa            == value.get_allocator().mechanism());
+            ASSERT(&value         == &X.find(LONG)->second);
+            ASSERT(&oa            == X.find(LONG)->first.get_allocator()
+                                                                .mechanism());
+
+            value = LONG;
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+            ASSERT(&value         == &mX[bsl::string(LONG)]);
+            ASSERT(LONG           == mX[bsl::string(LONG)]);
+            ASSERT(NUM_BLOCKS     == oa.numBlocksTotal());
+        }
+
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            StrObj mX(&oa);  const StrObj& X = mX;
+
+            mX.reserve(64);
+
+            const char *LONG = "another string long enough to allocate";
+
+            int numPasses = 0;
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ++numPasses;
+
+                ASSERT(0 == X.size());
+
+                mX[bsl::string(LONG)];
+
+                ASSERT(1 == X.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(X.find(LONG)->second.empty());
+
+            if (veryVerbose) { P(numPasses); }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // RANGE AND INITIALIZER LIST CONSTRUCTORS AND INSERTION
+        //
+        // Concerns:
+        //: 1 The constructors taking an iterator range or an initializer list
+        //:   create a map having the (unique-keyed) values of the range, and
+        //:   forward the capacity, hasher, comparator, and allocator.
+        //:
+        //: 2 The 'insert' methods taking an iterator range or an initializer
+        //:   list insert the values having a key not already present.
+        //:
+        //: 3 Initializer list assignment replaces the value of the map.
+        //
+        // Plan:
+        //: 1 Construct maps from ranges and initializer lists, and verify the
+        //:   resulting state using the (tested) basic accessors.  (C-1)
+        //:
+        //: 2 Insert ranges and initializer lists into maps having various
+        //:   values, and verify the resulting value.  (C-2)
+        //:
+        //: 3 Assign initializer lists to maps and verify the value.  (C-3)
+        //
+        // Testing:
+        //   NodeHashMap(INPUT_ITERATOR, INPUT_ITERATOR, Allocator *bA = 0);
+        //   NodeHashMap(INPUT_ITER, INPUT_ITER, size_t, Allocator * = 0);
+        //   NodeHashMap(II, II, size_t, const HASH&, Allocator * = 0);
+        //   NodeHashMap(II, II, size_t, const H&, const EQ&, Alloc * = 0);
+        //   NodeHashMap(bsl::initializer_list<v_t> values, Allocator * = 0);
+        //   NodeHashMap(bsl::initializer_list<v_t>, size_t, Allocator * = 0);
+        //   NodeHashMap(init_list<v_t>, size_t, const HASH&, Allocator * = 0);
+        //   NodeHashMap(init_list<v_t>, size_t, const H&, const EQ&, A * = 0);
+        //   NodeHashMap& operator=(bsl::initializer_list<v_t> values);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(bsl::initializer_list<value_type> values);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+               << "RANGE AND INITIALIZER LIST CONSTRUCTORS AND INSERTION"
+               << endl
+               << "====================================================="
+               << endl;
+
+        typedef SeedIsHash<int>                                 Hash;
+        typedef bsl::equal_to<int>                              Equal;
+        typedef bdlc::NodeHashMap<int, int, Hash, Equal>        Obj;
+        typedef bsl::pair<int, int>                             Pair;
+
+        const Pair DATA[] = {
+            Pair(1, 10), Pair(2, 20), Pair(3, 30), Pair(1, 11), Pair(4, 40)
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        if (verbose) cout << "Testing range constructors." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mW(DATA, DATA + NUM_DATA, &oa);  const Obj& W = mW;
+            Obj mX(DATA, DATA + NUM_DATA, 32, &oa);  const Obj& X = mX;
+            Obj mY(DATA, DATA + NUM_DATA, 32, Hash(3), &oa);
+            const Obj& Y = mY;
+            Obj mZ(DATA, DATA + NUM_DATA, 64, Hash(5), Equal(), &oa);
+            const Obj& Z = mZ;
+
+            ASSERT(  4 == W.size());
+            ASSERT( 10 == W.find(1)->second);
+            ASSERT( 40 == W.find(4)->second);
+            ASSERT(&oa == W.allocator());
+
+            ASSERT(  4 == X.size());
+            ASSERT( 32 == X.capacity());
+            ASSERT(  W == X);
+
+            ASSERT(  4 == Y.size());
+            ASSERT( 32 == Y.capacity());
+            ASSERT(  3 == Y.hash_function()(0));
+            ASSERT(  W == Y);
+
+            ASSERT(  4 == Z.size());
+            ASSERT( 64 == Z.capacity());
+            ASSERT(  5 == Z.hash_function()(0));
+            ASSERT(  W == Z);
+        }
+
+        if (verbose) cout << "Testing range 'insert'." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX[4] = 44;
+
+            mX.insert(DATA, DATA + NUM_DATA);
+
+            ASSERT(  4 == X.size());
+            ASSERT( 10 == X.find(1)->second);
+            ASSERT( 44 == X.find(4)->second);
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        if (verbose) cout << "Testing initializer lists." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mW({ {1, 10}, {2, 20}, {1, 11} }, &oa);  const Obj& W = mW;
+            Obj mX({ {1, 10}, {2, 20} }, 32, &oa);  const Obj& X = mX;
+            Obj mY({ {1, 10}, {2, 20} }, 32, Hash(3), &oa);
+            const Obj& Y = mY;
+            Obj mZ({ {1, 10}, {2, 20} }, 32, Hash(3), Equal(), &oa);
+            const Obj& Z = mZ;
+
+            ASSERT(  2 == W.size());
+            ASSERT( 10 == W.find(1)->second);
+            ASSERT(&oa == W.allocator());
+            ASSERT( 32 == X.capacity());
+            ASSERT(  W == X);
+            ASSERT(  3 == Y.hash_function()(0));
+            ASSERT(  W == Y);
+            ASSERT(  W == Z);
+
+            mX.insert({ {3, 30}, {1, 11} });
+
+            ASSERT(  3 == X.size());
+            ASSERT( 10 == X.find(1)->second);
+            ASSERT( 30 == X.find(3)->second);
+
+            mX = { {5, 50} };
+
+            ASSERT(  1 == X.size());
+            ASSERT( 50 == X.find(5)->second);
+            ASSERT(&oa == X.allocator());
+        }
+#endif
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // ITERATORS AND LOOKUP
+        //
+        // Concerns:
+        //: 1 The iterators visit each element exactly once, and dereference to
+        //:   the elements held in the nodes.
+        //:
+        //: 2 'const_iterator' is constructible from 'iterator', and mapped
+        //:   values are modifiable through 'iterator'.
+        //:
+        //: 3 'find', 'equal_range', 'contains', and 'count' forward to the
+        //:   implementation class and adapt the returned iterators.
+        //:
+        //: 4 'empty' and 'load_factor' forward to the implementation class.
+        //
+        // Plan:
+        //: 1 Create maps of various sizes and verify, for each element, the
+        //:   iterators and lookup methods against the result of 'operator[]'.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        //   iterator find(const KEY& key);
+        //   iterator begin();
+        //   iterator end();
+        //   bool contains(const KEY&) const;
+        //   bsl::size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   bsl::pair<ci, ci> equal_range(const KEY&) const;
+        //   float load_factor() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_iterator end() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATORS AND LOOKUP" << endl
+                          << "====================" << endl;
+
+        for (int n = 0; n < 100; n += 1 + n / 4) {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            IntObj mX(&oa);  const IntObj& X = mX;
+
+            ASSERTV(n, X.empty());
+            ASSERTV(n, X.begin()  == X.end());
+            ASSERTV(n, X.cbegin() == X.cend());
+            ASSERTV(n, mX.begin() == mX.end());
+
+            for (int i = 0; i < n; ++i) {
+                mX[3 * i] = i;
+            }
+
+            ASSERTV(n, (0 == n) == X.empty());
+            ASSERTV(n, 0 == n || X.load_factor() ==
+                             static_cast<float>(n) / X.capacity());
+
+            int count = 0;
+            int sum   = 0;
+            for (IntObj::iterator iter = mX.begin(); iter != mX.end();
+                                                                      ++iter) {
+                ASSERTV(n, &iter->second == &mX[iter->first]);
+
+                iter->second += 1;
+
+                sum += iter->second;
+                ++count;
+            }
+            ASSERTV(n, n == count);
+            ASSERTV(n, n * (n + 1) / 2 == sum);
+
+            count = 0;
+            for (IntObj::const_iterator iter = X.cbegin(); iter != X.cend();
+                                                                      ++iter) {
+                ++count;
+            }
+            ASSERTV(n, n == count);
+
+            for (int i = 0; i < 3 * n; ++i) {
+                const bool PRESENT = 0 == i % 3;
+
+                IntObj::iterator       iter  = mX.find(i);
+                IntObj::const_iterator citer = X.find(i);
+
+                ASSERTV(n, i, PRESENT == (iter  != mX.end()));
+                ASSERTV(n, i, PRESENT == (citer != X.end()));
+                ASSERTV(n, i, PRESENT == X.contains(i));
+                ASSERTV(n, i, static_cast<bsl::size_t>(PRESENT) ==
+                                                                X.count(i));
+                ASSERTV(n, i, IntObj::const_iterator(iter) == citer);
+
+                bsl::pair<IntObj::iterator, IntObj::iterator> range =
+                                                          mX.equal_range(i);
+                bsl::pair<IntObj::const_iterator,
+                          IntObj::const_iterator> crange = X.equal_range(i);
+
+                ASSERTV(n, i, range.first  == iter);
+                ASSERTV(n, i, crange.first == citer);
+
+                if (PRESENT) {
+                    ASSERTV(n, i, i / 3 + 1 == iter->second);
+                    ASSERTV(n, i, &*iter    == &*citer);
+
+                    ++iter;
+                    ++citer;
+                }
+                ASSERTV(n, i, range.second  == iter);
+                ASSERTV(n, i, crange.second == citer);
+            }
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // SWAP MEMBER AND FREE FUNCTIONS
+        //
+        // Concerns:
+        //: 1 Both functions exchange the values of the (two) supplied objects,
+        //:   along with their hashers and comparators.
+        //:
+        //: 2 Neither function allocates memory, and pointers to the elements
+        //:   remain valid (and refer to elements of the other object).
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create two objects having distinct values and hashers, swap them
+        //:   using each function, and verify the values, the hashers, the
+        //:   element addresses, and that no memory was allocated.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for objects having different allocators.  (C-3)
+        //
+        // Testing:
+        //   void swap(NodeHashMap&);
+        //   void swap(NodeHashMap&, NodeHashMap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SWAP MEMBER AND FREE FUNCTIONS" << endl
+                          << "==============================" << endl;
+
+        typedef SeedIsHash<int>                          Hash;
+        typedef bdlc::NodeHashMap<int, int, Hash>        Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(0, Hash(1), &oa);  const Obj& X = mX;
+        Obj mY(0, Hash(2), &oa);  const Obj& Y = mY;
+
+        for (int i = 0; i < 10; ++i) {
+            mX[i] = i;
+        }
+        mY[100] = 100;
+
+        const int *pX = &X.find(5)->second;
+        const int *pY = &Y.find(100)->second;
+
+        const Obj XX(X, &oa);
+        const Obj YY(Y, &oa);
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        mX.swap(mY);
+
+        ASSERT(YY == X);
+        ASSERT(XX == Y);
+        ASSERT( 2 == X.hash_function()(0));
+        ASSERT( 1 == Y.hash_function()(0));
+        ASSERT(pX == &Y.find(5)->second);
+        ASSERT(pY == &X.find(100)->second);
+
+        swap(mX, mY);
+
+        ASSERT(XX == X);
+        ASSERT(YY == Y);
+        ASSERT( 1 == X.hash_function()(0));
+        ASSERT( 2 == Y.hash_function()(0));
+        ASSERT(pX == &X.find(5)->second);
+        ASSERT(pY == &Y.find(100)->second);
+
+        ASSERT(oam.isTotalSame());
+
+        if (verbose) cout << "Negative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator za("other", veryVeryVeryVerbose);
+
+            Obj mZ(&za);
+
+            ASSERT_SAFE_FAIL(mX.swap(mZ));
+            ASSERT_SAFE_PASS(mX.swap(mY));
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // MOVE CONSTRUCTORS AND MOVE ASSIGNMENT
+        //
+        // Concerns:
+        //: 1 The move constructor creates an object having the value of the
+        //:   original, uses the allocator of the original, allocates no
+        //:   memory, and retains the nodes of the original (so pointers to
+        //:   the elements remain valid).
+        //:
+        //: 2 The extended move constructor behaves as the move constructor
+        //:   when the allocators are the same; otherwise, it creates an
+        //:   object having the value of the original using new nodes supplied
+        //:   by the specified allocator.
+        //:
+        //: 3 Move assignment results in an object having the value of the
+        //:   source and retaining its allocator, retaining the nodes of the
+        //:   source if the allocators are the same.
+        //
+        // Plan:
+        //: 1 Move construct and move assign objects using the same and
+        //:   different allocators, and verify the value, the allocator, the
+        //:   element addresses, and the memory allocated.  (C-1..3)
+        //
+        // Testing:
+        //   NodeHashMap(NodeHashMap&&);
+        //   NodeHashMap(NodeHashMap&&, Allocator *basicAllocator);
+        //   NodeHashMap& operator=(NodeHashMap&&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MOVE CONSTRUCTORS AND MOVE ASSIGNMENT" << endl
+                          << "=====================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const char *LONG = "a string long enough to require an allocation";
+
+        StrObj mW(&oa);  const StrObj& W = mW;
+        for (int i = 0; i < 10; ++i) {
+            bsl::string key(LONG, &oa);
+            key.push_back(static_cast<char>('a' + i));
+            mW[key] = key;
+        }
+
+        const bsl::string KEY(bsl::string(LONG) + 'e', &oa);
+
+        if (verbose) cout << "Testing move constructor." << endl;
+        {
+            StrObj mX(W, &oa);
+
+            const bsl::string *pValue = &mX.find(KEY)->second;
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            StrObj mY(bslmf::MovableRefUtil::move(mX));  const StrObj& Y = mY;
+
+            ASSERT(oam.isTotalSame());
+            ASSERT(W      == Y);
+            ASSERT(&oa    == Y.allocator());
+            ASSERT(pValue == &Y.find(KEY)->second);
+        }
+
+        if (verbose) cout << "Testing extended move constructor." << endl;
+        {
+            StrObj mX(W, &oa);
+
+            const bsl::string *pValue = &mX.find(KEY)->second;
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            StrObj mY(bslmf::MovableRefUtil::move(mX), &oa);
+            const StrObj& Y = mY;
+
+            ASSERT(oam.isTotalSame());
+            ASSERT(W      == Y);
+            ASSERT(pValue == &Y.find(KEY)->second);
+
+            StrObj mZ(bslmf::MovableRefUtil::move(mY), &za);
+            const StrObj& Z = mZ;
+
+            ASSERT(W      == Z);
+            ASSERT(&za    == Z.allocator());
+            ASSERT(pValue != &Z.find(KEY)->second);
+            ASSERT(&za    == Z.find(KEY)->second.get_allocator().mechanism());
+        }
+
+        if (verbose) cout << "Testing move assignment." << endl;
+        {
+            StrObj mX(W, &oa);
+
+            const bsl::string *pValue = &mX.find(KEY)->second;
+
+            StrObj mY(&oa);  const StrObj& Y = mY;
+
+            mY = bslmf::MovableRefUtil::move(mX);
+
+            ASSERT(W      == Y);
+            ASSERT(pValue == &Y.find(KEY)->second);
+
+            StrObj mZ(&za);  const StrObj& Z = mZ;
+
+            mZ = bslmf::MovableRefUtil::move(mY);
+
+            ASSERT(W      == Z);
+            ASSERT(&za    == Z.allocator());
+            ASSERT(&za    == Z.find(KEY)->second.get_allocator().mechanism());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY CONSTRUCTOR AND COPY ASSIGNMENT
+        //
+        // Concerns:
+        //: 1 The copy constructor creates an object having the value of the
+        //:   original, with each element held in a new node supplied by the
+        //:   specified (or default) allocator.
+        //:
+        //: 2 The original is unchanged.
+        //:
+        //: 3 Copy assignment results in an object having the value of the
+        //:   source and retaining its allocator.
+        //:
+        //: 4 Copy construction is exception neutral and leaks no memory when
+        //:   an allocation fails.
+        //
+        // Plan:
+        //: 1 Copy construct and copy assign objects of various values, and
+        //:   verify the value, the allocator, and that the elements of the
+        //:   copy are distinct from those of the original.  (C-1..3)
+        //:
+        //: 2 Copy construct within the 'bslma::TestAllocator' exception test
+        //:   macros.  (C-4)
+        //
+        // Testing:
+        //   NodeHashMap(const NodeHashMap&, Allocator *bA = 0);
+        //   NodeHashMap& operator=(const NodeHashMap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY CONSTRUCTOR AND COPY ASSIGNMENT" << endl
+                          << "====================================" << endl;
+
+        const char *LONG = "a string long enough to require an allocation";
+
+        for (int n = 0; n < 20; ++n) {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+            StrObj mW(&oa);  const StrObj& W = mW;
+            for (int i = 0; i < n; ++i) {
+                bsl::string key(LONG, &oa);
+                key.push_back(static_cast<char>('a' + i));
+                mW[key] = LONG;
+            }
+
+            const StrObj WW(W, &oa);
+
+            {
+                StrObj mX(W, &za);  const StrObj& X = mX;
+
+                ASSERTV(n, W   == X);
+                ASSERTV(n, WW  == W);
+                ASSERTV(n, &za == X.allocator());
+
+                for (StrObj::const_iterator iter = X.begin();
+                     iter != X.end();
+                     ++iter) {
+                    ASSERTV(n, &*iter != &*W.find(iter->first));
+                    ASSERTV(n, &za    == iter->second.get_allocator()
+                                                                .mechanism());
+                }
+            }
+            {
+                bslma::DefaultAllocatorGuard dag(&za);
+
+                StrObj mX(W);  const StrObj& X = mX;
+
+                ASSERTV(n, W   == X);
+                ASSERTV(n, &za == X.allocator());
+            }
+            {
+                StrObj mX(&za);  const StrObj& X = mX;
+
+                mX[bsl::string("x")] = "x";
+
+                mX = W;
+
+                ASSERTV(n, W   == X);
+                ASSERTV(n, &za == X.allocator());
+
+                StrObj& result = (mX = X);
+
+                ASSERTV(n, &result == &mX);
+                ASSERTV(n, W       == X);
+            }
+            {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(za) {
+                    StrObj mX(W, &za);  const StrObj& X = mX;
+
+                    ASSERTV(n, W == X);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(n, 0 == za.numBlocksInUse());
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EQUALITY OPERATORS, 'print', AND 'operator<<'
+        //
+        // Concerns:
+        //: 1 Two objects compare equal if and only if they contain the same
+        //:   elements, regardless of hasher, capacity, and insertion order.
+        //:
+        //: 2 'print' and 'operator<<' format the elements of the map.
+        //
+        // Plan:
+        //: 1 Compare objects created from various sets of values, having
+        //:   various capacities, and verify the result.  (C-1)
+        //:
+        //: 2 Format objects having known values and verify the output.  (C-2)
+        //
+        // Testing:
+        //   bool operator==(const NodeHashMap&, const NodeHashMap&);
+        //   bool operator!=(const NodeHashMap&, const NodeHashMap&);
+        //   ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+        //   ostream& operator<<(ostream& stream, const NodeHashMap& map);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                         << "EQUALITY OPERATORS, 'print', AND 'operator<<'"
+                         << endl
+                         << "============================================="
+                         << endl;
+
+        if (verbose) cout << "Testing equality operators." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_spec;  // pairs of (key, value) digits
+            } DATA[] = {
+                { L_, ""         },
+                { L_, "11"       },
+                { L_, "12"       },
+                { L_, "21"       },
+                { L_, "1122"     },
+                { L_, "1123"     },
+                { L_, "112233"   },
+                { L_, "11223344" },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE1 = DATA[ti].d_line;
+                const char *SPEC1 = DATA[ti].d_spec;
+
+                IntObj mX(&oa);  const IntObj& X = mX;
+                for (const char *p = SPEC1; *p; p += 2) {
+                    mX[p[0] - '0'] = p[1] - '0';
+                }
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const int   LINE2 = DATA[tj].d_line;
+                    const char *SPEC2 = DATA[tj].d_spec;
+
+                    // Insert in reverse order into a presized map.
+
+                    IntObj mY(256, &oa);  const IntObj& Y = mY;
+                    for (int i = static_cast<int>(strlen(SPEC2)) - 2;
+                         i >= 0;
+                         i -= 2) {
+                        mY[SPEC2[i] - '0'] = SPEC2[i + 1] - '0';
+                    }
+
+                    const bool EXP = ti == tj;
+
+                    ASSERTV(LINE1, LINE2, EXP == (X == Y));
+                    ASSERTV(LINE1, LINE2, EXP == (Y == X));
+                    ASSERTV(LINE1, LINE2, EXP != (X != Y));
+                    ASSERTV(LINE1, LINE2, EXP != (Y != X));
+                }
+            }
+        }
+
+        if (verbose) cout << "Testing 'print' and 'operator<<'." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            IntObj mX(&oa);  const IntObj& X = mX;
+
+            {
+                bsl::ostringstream oss(&oa);
+                oss << X;
+                ASSERTV(oss.str(), "[ ]" == oss.str());
+            }
+
+            mX[1] = 2;
+
+            {
+                bsl::ostringstream oss(&oa);
+                oss << X;
+                ASSERTV(oss.str(), "[ [ 1 2 ] ]" == oss.str());
+            }
+            {
+                bsl::ostringstream oss(&oa);
+                X.print(oss, 1, 2);
+                ASSERTV(oss.str(),
+                        "  [\n    [\n      1\n      2\n    ]\n  ]\n" ==
+                                                                   oss.str());
+            }
+            {
+                bsl::ostringstream oss(&oa);
+                oss.setstate(bsl::ios::badbit);
+                X.print(oss);
+                ASSERTV(oss.str(), "" == oss.str());
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BASIC ACCESSORS
+        //   Ensure each basic accessor properly interprets object state.
+        //
+        // Concerns:
+        //: 1 Each accessor returns the value of the corresponding attribute of
+        //:   the object.
+        //:
+        //: 2 Each accessor method is declared 'const'.
+        //:
+        //: 3 No accessor allocates memory.
+        //
+        // Plan:
+        //: 1 Produce objects of arbitrary state and verify the accessors'
+        //:   return values against expected values.  (C-1)
+        //:
+        //: 2 The accessors will only be accessed from a 'const' reference to
+        //:   the created object.  (C-2)
+        //:
+        //: 3 Use a 'bslma::TestAllocatorMonitor' to verify that no memory is
+        //:   allocated by the accessors.  (C-3)
+        //
+        // Testing:
+        //   size_t capacity() const;
+        //   const_iterator find(const KEY&) const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BASIC ACCESSORS" << endl
+                          << "===============" << endl;
+
+        {
+            typedef SeedIsHash<int>                          Hash;
+            typedef bsl::equal_to<int>                       Equal;
+            typedef bdlc::NodeHashMap<int, int, Hash, Equal> Obj;
+
+            Obj mX(0, Hash(), Equal());  const Obj& X = mX;
+
+            ASSERT(                0 == X.capacity());
+            ASSERT(                0 == X.hash_function()(0));
+            ASSERT(             true == X.key_eq()(0, 0));
+            ASSERT(            false == X.key_eq()(0, 1));
+            ASSERT(            0.875 == X.max_load_factor());
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+        {
+            typedef SeedIsHash<int>                          Hash;
+            typedef bsl::less<int>                           Equal;
+            typedef bdlc::NodeHashMap<int, int, Hash, Equal> Obj;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(32, Hash(1), Equal(), &oa);  const Obj& X = mX;
+
+            ASSERT(   32 == X.capacity());
+            ASSERT(    1 == X.hash_function()(0));
+            ASSERT(false == X.key_eq()(0, 0));
+            ASSERT( true == X.key_eq()(0, 1));
+            ASSERT(0.875 == X.max_load_factor());
+            ASSERT(  &oa == X.allocator());
+        }
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            IntObj mX(&oa);  const IntObj& X = mX;
+
+            ASSERT(      0 == X.size());
+            ASSERT(X.end() == X.find(1));
+
+            mX.insert(bsl::make_pair(1, 5));
+            mX.insert(bsl::make_pair(2, 7));
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            ASSERT(      2 == X.size());
+            ASSERT(      1 == X.find(1)->first);
+            ASSERT(      5 == X.find(1)->second);
+            ASSERT(      2 == X.find(2)->first);
+            ASSERT(      7 == X.find(2)->second);
+            ASSERT(X.end() == X.find(3));
+
+            ASSERT(oam.isTotalSame());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS TEST
+        //   The constructor, the destructor, and the primary manipulators:
+        //      - 'clear'
+        //      - 'erase(key)'
+        //      - 'insert'
+        //      - 'reset'
+        //   operate as expected.
+        //
+        // Concerns:
+        //: 1 The constructors create the correct initial value and have the
+        //:   hashing, equality, and internal memory management systems hooked
+        //:   up properly.
+        //:
+        //: 2 'insert' allocates exactly one node (from the object allocator)
+        //:   for each inserted element, and none when the key is present, and
+        //:   correctly forwards the return value from the implementation
+        //:   class.
+        //:
+        //: 3 'erase(key)', 'clear', and 'reset' reclaim the nodes of the
+        //:   removed elements.
+        //:
+        //: 4 Memory is not leaked by any method and the destructor properly
+        //:   deallocates the residual allocated memory.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor and verify the state using
+        //:   the (untested) basic accessors.  (C-1)
+        //:
+        //: 2 Insert and erase elements, verifying the return values, the
+        //:   value of the object, and the number of blocks in use by the
+        //:   object allocator.  (C-2..3)
+        //:
+        //: 3 Use a supplied 'bslma::TestAllocator' that goes out-of-scope
+        //:   at the conclusion of each test to ensure all memory is returned
+        //:   to the allocator.  (C-4)
+        //
+        // Testing:
+        //   NodeHashMap();
+        //   NodeHashMap(Allocator *basicAllocator);
+        //   NodeHashMap(size_t capacity);
+        //   NodeHashMap(size_t capacity, Allocator *basicAllocator);
+        //   NodeHashMap(size_t capacity, const HASH&, Allocator *bA = 0);
+        //   NodeHashMap(size_t, const HASH&, const EQUAL&, Allocator * = 0);
+        //   ~NodeHashMap();
+        //   void clear();
+        //   size_t erase(const KEY&);
+        //   bsl::pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) entry)
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS TEST" << endl
+                          << "=========================" << endl;
+
+        if (verbose) cout << "Testing constructors." << endl;
+        {
+            typedef SeedIsHash<int>                          Hash;
+            typedef bsl::equal_to<int>                       Equal;
+            typedef bdlc::NodeHashMap<int, int, Hash, Equal> Obj;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Obj mX;  const Obj& X = mX;
+
+                ASSERT(0                 == X.size());
+                ASSERT(0                 == X.capacity());
+                ASSERT(&defaultAllocator == X.allocator());
+            }
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+
+                ASSERT(0   == X.capacity());
+                ASSERT(&oa == X.allocator());
+                ASSERT(0   == oa.numBlocksTotal());
+            }
+            {
+                bslma::DefaultAllocatorGuard dag(&oa);
+
+                Obj mX(32);  const Obj& X = mX;
+
+                ASSERT(32  == X.capacity());
+                ASSERT(&oa == X.allocator());
+            }
+            {
+                Obj mX(32, &oa);  const Obj& X = mX;
+
+                ASSERT(32  == X.capacity());
+                ASSERT(&oa == X.allocator());
+            }
+            {
+                Obj mX(32, Hash(3), &oa);  const Obj& X = mX;
+
+                ASSERT(32  == X.capacity());
+                ASSERT(3   == X.hash_function()(0));
+                ASSERT(&oa == X.allocator());
+            }
+            {
+                Obj mX(64, Hash(5), Equal(), &oa);  const Obj& X = mX;
+
+                ASSERT(64  == X.capacity());
+                ASSERT(5   == X.hash_function()(0));
+                ASSERT(&oa == X.allocator());
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "Testing 'insert' and 'erase(key)'." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            IntObj mX(64, &oa);  const IntObj& X = mX;
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+            for (int i = 0; i < 50; ++i) {
+                bsl::pair<IntObj::iterator, bool> rv =
+                                         mX.insert(bsl::make_pair(i, 2 * i));
+
+                ASSERTV(i, rv.second);
+                ASSERTV(i, i     == rv.first->first);
+                ASSERTV(i, 2 * i == rv.first->second);
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+                ASSERTV(i, NUM_BLOCKS + i + 1 == oa.numBlocksInUse());
+
+                rv = mX.insert(bsl::make_pair(i, 3 * i));
+
+                ASSERTV(i, !rv.second);
+                ASSERTV(i, 2 * i == rv.first->second);
+                ASSERTV(i, NUM_BLOCKS + i + 1 == oa.numBlocksInUse());
+            }
+
+            for (int i = 0; i < 50; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i));
+                ASSERTV(i, 0 == mX.erase(i));
+                ASSERTV(i, X.end() == X.find(i));
+            }
+            ASSERT(25              == X.size());
+            ASSERT(NUM_BLOCKS + 25 == oa.numBlocksInUse());
+
+            for (int i = 1; i < 50; i += 2) {
+                ASSERTV(i, 2 * i == X.find(i)->second);
+            }
+
+            const StrObj::value_type VALUE(
+                 "a string long enough to require an allocation", "value");
+
+            StrObj mY(&oa);  const StrObj& Y = mY;
+
+            mY.insert(VALUE);
+
+            ASSERT(1     == Y.size());
+            ASSERT(VALUE == *Y.begin());
+            ASSERT(&oa   == Y.begin()->first.get_allocator().mechanism());
+        }
+
+        if (verbose) cout << "Testing 'clear' and 'reset'." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            IntObj mX(&oa);  const IntObj& X = mX;
+
+            for (int i = 0; i < 20; ++i) {
+                mX[i] = i;
+            }
+
+            const bsl::size_t capacity = X.capacity();
+
+            mX.clear();
+
+            ASSERT(0        == X.size());
+            ASSERT(capacity == X.capacity());
+            ASSERT(2        == oa.numBlocksInUse());
+
+            for (int i = 0; i < 20; ++i) {
+                mX[i] = i;
+            }
+
+            mX.reset();
+
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "Testing exception neutrality of 'insert'."
+                          << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            StrObj mX(&oa);  const StrObj& X = mX;
+
+            const StrObj::value_type VALUE(
+                            "a string long enough to require an allocation",
+                            "another string long enough to be allocated");
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERT(0 == X.size());
+
+                mX.insert(VALUE);
+
+                ASSERT(1 == X.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(VALUE == *X.begin());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'NodeHashMap_Entry'
+        //
+        // Concerns:
+        //: 1 Each constructor allocates a node from the specified (or default)
+        //:   allocator, and constructs the held pair using that allocator.
+        //:
+        //: 2 The move constructor, and the extended move constructor given the
+        //:   allocator of the original, take ownership of the node of the
+        //:   original without allocating; the extended move constructor given
+        //:   a different allocator allocates a new node.
+        //:
+        //: 3 The destructor destroys the held pair and reclaims the node, and
+        //:   a moved-from entry reclaims nothing.
+        //:
+        //: 4 The equality operators compare the held pairs.
+        //:
+        //: 5 'NodeHashMap_EntryUtil' extracts the key from an entry and from
+        //:   a 'value_type' object.
+        //
+        // Plan:
+        //: 1 Create entries using each constructor and verify the held pair,
+        //:   its address, and the memory in use.  (C-1..5)
+        //
+        // Testing:
+        //   NodeHashMap_Entry(FORWARD_REF(VALUE_TYPE) value, Allocator * = 0);
+        //   NodeHashMap_Entry(const NodeHashMap_Entry&, Allocator * = 0);
+        //   NodeHashMap_Entry(MovableRef<NodeHashMap_Entry> original);
+        //   NodeHashMap_Entry(MovableRef<NodeHashMap_Entry>, Allocator *);
+        //   ~NodeHashMap_Entry();
+        //   value_type& value();
+        //   const value_type& value() const;
+        //   bool operator==(const Entry&, const Entry&);
+        //   bool operator!=(const Entry&, const Entry&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'NodeHashMap_Entry'" << endl
+                          << "===================" << endl;
+
+        typedef bdlc::NodeHashMap_Entry<bsl::string, bsl::string> Entry;
+        typedef bdlc::NodeHashMap_EntryUtil<bsl::string, bsl::string>
+                                                                  EntryUtil;
+        typedef Entry::value_type                                 Value;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const char *LONG = "a string long enough to require an allocation";
+
+        const Value VA(LONG, "a", &oa);
+        const Value VB(LONG, "b", &oa);
+
+        const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+        {
+            Entry mX(VA, &oa);  const Entry& X = mX;
+
+            ASSERT(NUM_BLOCKS + 2 == oa.numBlocksInUse());
+            ASSERT(VA             == X.value());
+            ASSERT(&oa            == X.value().first.get_allocator()
+                                                                .mechanism());
+            ASSERT(&X.value()     == &mX.value());
+            ASSERT(LONG           == EntryUtil::key(X));
+            ASSERT(LONG           == EntryUtil::key(VA));
+
+            Entry mY(X, &za);  const Entry& Y = mY;
+
+            ASSERT(NUM_BLOCKS + 2 == oa.numBlocksInUse());
+            ASSERT(2              == za.numBlocksInUse());
+            ASSERT(VA             == Y.value());
+            ASSERT(&za            == Y.value().first.get_allocator()
+                                                                .mechanism());
+            ASSERT(X              == Y);
+            ASSERT(!(X            != Y));
+
+            mY.value().second = "b";
+
+            ASSERT(VB             == Y.value());
+            ASSERT(X              != Y);
+            ASSERT(!(X            == Y));
+        }
+        ASSERT(NUM_BLOCKS == oa.numBlocksInUse());
+        ASSERT(0          == za.numBlocksInUse());
+
+        {
+            bslma::DefaultAllocatorGuard dag(&za);
+
+            Entry mX(VA);  const Entry& X = mX;
+
+            ASSERT(2  == za.numBlocksInUse());
+            ASSERT(VA == X.value());
+        }
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) cout << "Testing move constructors." << endl;
+        {
+            Entry mX(VA, &oa);
+
+            const Value *ADDRESS = &mX.value();
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Entry mY(bslmf::MovableRefUtil::move(mX));  const Entry& Y = mY;
+
+            ASSERT(oam.isTotalSame());
+            ASSERT(ADDRESS == &Y.value());
+
+            Entry mZ(bslmf::MovableRefUtil::move(mY), &oa);
+            const Entry& Z = mZ;
+
+            ASSERT(oam.isTotalSame());
+            ASSERT(ADDRESS == &Z.value());
+
+            Entry mW(bslmf::MovableRefUtil::move(mZ), &za);
+            const Entry& W = mW;
+
+            ASSERT(oam.isInUseSame());
+            ASSERT(2       == za.numBlocksInUse());
+            ASSERT(ADDRESS != &W.value());
+            ASSERT(VA      == W.value());
+            ASSERT(&za     == W.value().first.get_allocator().mechanism());
+        }
+        ASSERT(NUM_BLOCKS == oa.numBlocksInUse());
+        ASSERT(0          == za.numBlocksInUse());
+
+        if (verbose) cout << "Testing 'NodeHashMap_EntryUtil::construct'."
+                          << endl;
+        {
+            bsls::ObjectBuffer<Entry> buffer;
+
+            EntryUtil::construct(buffer.address(), &oa, bsl::string(LONG));
+
+            ASSERT(NUM_BLOCKS + 2 == oa.numBlocksInUse());
+            ASSERT(LONG           == buffer.object().value().first);
+            ASSERT(buffer.object().value().second.empty());
+
+            buffer.object().~Entry();
+        }
+        ASSERT(NUM_BLOCKS == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, insert and erase elements, and verify the
+        //:   value and the stability of the element addresses.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        IntObj mX(&oa);  const IntObj& X = mX;
+
+        ASSERT(X.empty());
+
+        int *p0 = &mX[0];
+        *p0 = 100;
+
+        for (int i = 1; i < 100; ++i) {
+            mX[i] = i;
+        }
+
+        ASSERT(100 == X.size());
+        ASSERT(p0  == &mX[0]);
+        ASSERT(100 == X.find(0)->second);
+
+        IntObj mY(X, &oa);  const IntObj& Y = mY;
+
+        ASSERT(X == Y);
+
+        mY.erase(50);
+
+        ASSERT(X != Y);
+        ASSERT(99 == Y.size());
+        ASSERT(!Y.contains(50));
+
+        if (veryVerbose) { P(X.capacity()); }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //    Compare the 'find' performance of 'bdlc::NodeHashMap' with that
+        //    of 'bdlc::FlatHashMap' and 'bsl::unordered_map'.
+        //
+        // Concerns:
+        //: 1 The relative cost of 'find' for values present in the map can be
+        //:   measured.
+        //:
+        //: 2 The relative cost of 'find' for values not present in the map
+        //:   can be measured.
+        //
+        // Plan:
+        //: 1 Time 'find' on large maps of each type for values present and not
+        //:   present, and report the results.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        {
+            bdlc::NodeHashMap<int, int> mX;
+            bdlc::FlatHashMap<int, int> mF;
+            bsl::unordered_map<int, int> mY;
+
+            mY.max_load_factor(mX.max_load_factor());
+
+            double x = static_cast<double>(
+                               performanceFindPresent(&mX).totalNanoseconds());
+            double f = static_cast<double>(
+                               performanceFindPresent(&mF).totalNanoseconds());
+            double y = static_cast<double>(
+                               performanceFindPresent(&mY).totalNanoseconds());
+
+            cout << "find when present:"
+                 << " node " << x / 1e6 << "ms,"
+                 << " flat " << f / 1e6 << "ms,"
+                 << " unordered " << y / 1e6 << "ms" << endl;
+        }
+        {
+            bdlc::NodeHashMap<int, int> mX;
+            bdlc::FlatHashMap<int, int> mF;
+            bsl::unordered_map<int, int> mY;
+
+            mY.max_load_factor(mX.max_load_factor());
+
+            double x = static_cast<double>(
+                            performanceFindNotPresent(&mX).totalNanoseconds());
+            double f = static_cast<double>(
+                            performanceFindNotPresent(&mF).totalNanoseconds());
+            double y = static_cast<double>(
+                            performanceFindNotPresent(&mY).totalNanoseconds());
+
+            cout << "find when not present:"
+                 << " node " << x / 1e6 << "ms,"
+                 << " flat " << f / 1e6 << "ms,"
+                 << " unordered " << y / 1e6 << "ms" << endl;
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
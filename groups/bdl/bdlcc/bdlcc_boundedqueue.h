@@ -28,6 +28,16 @@ BSLS_IDENT("$Id: $")
 // value, if the queue is full.  The 'tryPopFront' method fails immediately,
 // returning a non-zero value, if the queue is empty.
 //
+// Bulk variants of these methods, 'pushBackBulk', 'tryPushBackBulk',
+// 'popFrontBulk', and 'tryPopFrontBulk', transfer a run of elements to or
+// from a caller-supplied array.  A bulk operation reserves as many elements
+// as are available (up to the requested number) with a single atomic
+// operation on each of the queue's counters, and publishes the run to the
+// opposite side of the queue at once, so a batch of elements wakes blocked
+// threads once rather than once per element.  A bulk "pop" operation succeeds
+// if at least one element is removed, and reports the number of elements
+// transferred through an output parameter.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  Any threads blocked in 'pushBack'
@@ -182,6 +192,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslalg_scalarprimitives.h>
 
+#include <bslma_destructionutil.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_istriviallycopyable.h>
@@ -198,6 +209,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_objectbuffer.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
 #include <bsl_cstdint.h>
 
 namespace BloombergLP {
@@ -272,6 +285,99 @@ class BoundedQueue_PushExceptionCompleteProctor {
         // If no queue is currently managed, this method has no effect.
 };
 
+                 // =======================================
+                 // class BoundedQueue_PopBulkCompleteGuard
+                 // =======================================
+
+template <class TYPE, class NODE>
+class BoundedQueue_PopBulkCompleteGuard {
+    // This class implements a guard that, for a run of elements reserved by a
+    // bulk "pop" operation on a 'TYPE' queue, supplies the reserved 'NODE'
+    // objects one at a time and, upon destruction, destroys the values of all
+    // the reserved nodes that remain and invokes 'TYPE::popCompleteBulk'.
+
+    // DATA
+    TYPE                *d_queue_p;       // managed queue owning the nodes
+    NODE                *d_node_p;        // node most recently supplied, or 0
+    bsls::Types::Uint64  d_index;         // next index in the reserved run
+    bsls::Types::Uint64  d_numRemaining;  // reserved nodes not yet supplied
+    bsls::Types::Uint64  d_numValues;     // number of reserved nodes
+    bool                 d_isEmpty;       // if true, the empty condition will
+                                          // be signalled
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PopBulkCompleteGuard();
+    BoundedQueue_PopBulkCompleteGuard(
+                                     const BoundedQueue_PopBulkCompleteGuard&);
+    BoundedQueue_PopBulkCompleteGuard& operator=(
+                                     const BoundedQueue_PopBulkCompleteGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PopBulkCompleteGuard(TYPE                *queue,
+                                      bsls::Types::Uint64  index,
+                                      bsls::Types::Uint64  numValues,
+                                      bool                 isEmpty);
+        // Create a guard managing the specified 'numValues' nodes of the
+        // specified 'queue' reserved starting at the specified 'index', that
+        // will cause the empty condition to be signalled if the specified
+        // 'isEmpty' is 'true'.
+
+    ~BoundedQueue_PopBulkCompleteGuard();
+        // Destroy the values of the most recently supplied node and of every
+        // reserved node not yet supplied, then destroy this object and invoke
+        // the 'TYPE::popCompleteBulk' method for all the reserved nodes.
+
+    // MANIPULATORS
+    NODE *next();
+        // Destroy the value of the node most recently supplied by this guard,
+        // if any, and return the address of the next reserved node.  The
+        // behavior is undefined unless fewer than the number of nodes supplied
+        // at construction have been returned by this method.
+};
+
+                 // =======================================
+                 // class BoundedQueue_PushBulkCompleteGuard
+                 // =======================================
+
+template <class TYPE>
+class BoundedQueue_PushBulkCompleteGuard {
+    // This class implements a guard that, upon destruction, invokes
+    // 'TYPE::pushCompleteBulk' for a run of elements reserved by a bulk
+    // "push" operation, indicating how many of the reserved elements were
+    // successfully constructed.
+
+    // DATA
+    TYPE                *d_queue_p;      // managed queue
+    bsls::Types::Uint64  d_index;        // index of first reserved element
+    bsls::Types::Uint64  d_numReserved;  // number of reserved elements
+    bsls::Types::Uint64  d_numPushed;    // number of constructed elements
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PushBulkCompleteGuard();
+    BoundedQueue_PushBulkCompleteGuard(
+                                    const BoundedQueue_PushBulkCompleteGuard&);
+    BoundedQueue_PushBulkCompleteGuard& operator=(
+                                    const BoundedQueue_PushBulkCompleteGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PushBulkCompleteGuard(TYPE                *queue,
+                                       bsls::Types::Uint64  index,
+                                       bsls::Types::Uint64  numReserved);
+        // Create a guard managing the specified 'numReserved' elements of the
+        // specified 'queue' reserved starting at the specified 'index', none
+        // of which are yet constructed.
+
+    ~BoundedQueue_PushBulkCompleteGuard();
+        // Destroy this object and invoke the 'TYPE::pushCompleteBulk' method
+        // with the managed run of elements.
+
+    // MANIPULATORS
+    void increment();
+        // Indicate that one more of the managed elements has been constructed.
+};
+
                          // ========================
                          // struct BoundedQueue_Node
                          // ========================
@@ -404,12 +510,24 @@ class BoundedQueue {
     friend class BoundedQueue_PushExceptionCompleteProctor<
                                                           BoundedQueue<TYPE> >;
 
+    friend class BoundedQueue_PopBulkCompleteGuard<
+                                            BoundedQueue<TYPE>,
+                                            typename BoundedQueue<TYPE>::Node>;
+
+    friend class BoundedQueue_PushBulkCompleteGuard<BoundedQueue<TYPE> >;
+
     // PRIVATE CLASS METHODS
     static bool isQuiescentState(bsls::Types::Uint64 count);
         // Return 'true' if the specified 'count' implies a quiescent state
         // (see *Implementation* *Note*), and 'false' otherwise.
 
     // PRIVATE MANIPULATORS
+    Node *nextPopNode(Uint64 *index);
+        // Return the address of the node at the specified '*index' of a run
+        // reserved from 'd_popIndex' and increment '*index'.  If that node is
+        // marked for reclamation, count it as popped and instead reserve and
+        // return the next node from 'd_popIndex' that is not so marked.
+
     void popComplete(Node *node, bool isEmpty);
         // Destruct the value stored in the specified 'node', mark the 'node'
         // writable, and if the specified 'isEmpty' is 'true' then signal the
@@ -417,15 +535,39 @@ class BoundedQueue {
         // by a guard to complete the reclamation of a node in the presence of
         // an exception.
 
+    void popCompleteBulk(Uint64 numPopped, bool isEmpty);
+        // Mark the specified 'numPopped' nodes, whose values have been
+        // destructed, writable, and if the specified 'isEmpty' is 'true' then
+        // signal the queue empty condition.
+
+    void popFrontBulkHelper(TYPE *values, Uint64 numValues);
+        // Remove the specified 'numValues' elements from the front of this
+        // queue and load them, in order, into the array starting at the
+        // specified 'values'.  This method is invoked by 'popFrontBulk' and
+        // 'tryPopFrontBulk' once 'numValues' elements are available.
+
     void popFrontHelper(TYPE *value);
         // Remove the element from the front of this queue and load that
         // element into the specified 'value'.  This method is invoked by
         // 'popFront' and 'tryPopFront' once an element is available.
 
+    void pushBackBulkHelper(const TYPE *values, Uint64 numValues);
+        // Append the specified 'numValues' elements of the array starting at
+        // the specified 'values' to the back of this queue.  This method is
+        // invoked by 'pushBackBulk' and 'tryPushBackBulk' once 'numValues'
+        // empty elements are available.
+
     void pushComplete();
         // Mark a "push" operation as complete, and 'post' to the
         // 'd_popSemaphore' if appropriate.
 
+    void pushCompleteBulk(Uint64 index, Uint64 numReserved, Uint64 numPushed);
+        // Mark a bulk "push" operation of the specified 'numReserved' elements
+        // starting at the specified 'index', of which the first specified
+        // 'numPushed' were constructed, as complete, mark the remaining
+        // elements for reclamation, and 'post' to the 'd_popSemaphore' if
+        // appropriate.
+
     void pushExceptionComplete();
         // Remove the indicator for a started push operation, and 'post' to the
         // 'd_popSemaphore' if appropriate.  This method is used within
@@ -474,6 +616,22 @@ class BoundedQueue {
         // the queue being empty will return 'e_DISABLED' if 'disablePopFront'
         // is invoked.
 
+    int popFrontBulk(TYPE        *values,
+                     bsl::size_t  maxNumValues,
+                     bsl::size_t *numPopped);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, load them, in order, into the array starting at the
+        // specified 'values', and load the number of elements removed into the
+        // specified 'numPopped'.  If the queue is empty, block until it is not
+        // empty.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_SUCCESS' on success, 'e_DISABLED' if
+        // 'isPopFrontDisabled()' and 'e_FAILED' if an error occurs.  On
+        // failure, 'values' and 'numPopped' are not changed.  The behavior is
+        // undefined unless '0 < maxNumValues' and 'values' refers to an array
+        // of at least 'maxNumValues' elements.  Note that all the elements
+        // available (up to 'maxNumValues') are removed at once, and that at
+        // least one element is removed on success.
+
     int pushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  If the
         // queue is full, block until it is not full.  Return 0 on success, and
@@ -492,6 +650,22 @@ class BoundedQueue {
         // due to the queue being full will return 'e_DISABLED' if
         // 'disablePushBack' is invoked.
 
+    int pushBackBulk(const TYPE  *values,
+                     bsl::size_t  numValues,
+                     bsl::size_t *numPushed = 0);
+        // Append, in order, the specified 'numValues' elements of the array
+        // starting at the specified 'values' to the back of this queue.  If
+        // the queue is full, block until it is not full; when fewer than the
+        // remaining number of elements is available, append as many elements
+        // as possible and then block for the rest.  Optionally specify
+        // 'numPushed', into which the number of elements appended is loaded.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_SUCCESS' if all 'numValues' elements were appended,
+        // 'e_DISABLED' if 'isPushBackDisabled()' and 'e_FAILED' if an error
+        // occurs.  Threads blocked due to the queue being full will return
+        // 'e_DISABLED' if 'disablePushBack' is invoked.  Note that on failure
+        // some of the elements may have been appended.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -507,6 +681,21 @@ class BoundedQueue {
         // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
         // an error occurs.  On failure, 'value' is not changed.
 
+    int tryPopFrontBulk(TYPE        *values,
+                        bsl::size_t  maxNumValues,
+                        bsl::size_t *numPopped);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, and, if successful, load
+        // the removed elements, in order, into the array starting at the
+        // specified 'values' and the number of elements removed into the
+        // specified 'numPopped'.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_SUCCESS' if at least one element
+        // was removed, 'e_DISABLED' if 'isPopFrontDisabled()', 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
+        // an error occurs.  On failure, 'values' and 'numPopped' are not
+        // changed.  The behavior is undefined unless '0 < maxNumValues' and
+        // 'values' refers to an array of at least 'maxNumValues' elements.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -522,6 +711,20 @@ class BoundedQueue {
         // 'e_FULL' if '!isPushBackDisabled()' and the queue was full, and
         // 'e_FAILED' if an error occurs.  On failure, 'value' is not changed.
 
+    int tryPushBackBulk(const TYPE  *values,
+                        bsl::size_t  numValues,
+                        bsl::size_t *numPushed);
+        // Append, in order and without blocking, as many of the specified
+        // 'numValues' elements of the array starting at the specified 'values'
+        // to the back of this queue as there is capacity available for, and
+        // load the number of elements appended into the specified
+        // 'numPushed'.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_SUCCESS' if at least one element was
+        // appended (or '0 == numValues'), 'e_DISABLED' if
+        // 'isPushBackDisabled()', 'e_FULL' if '!isPushBackDisabled()' and the
+        // queue was full, and 'e_FAILED' if an error occurs.  On failure,
+        // 'numPushed' is not changed.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -641,6 +844,94 @@ void BoundedQueue_PushExceptionCompleteProctor<TYPE>::release()
     d_queue_p = 0;
 }
 
+                 // ---------------------------------------
+                 // class BoundedQueue_PopBulkCompleteGuard
+                 // ---------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+inline
+BoundedQueue_PopBulkCompleteGuard<TYPE, NODE>::
+BoundedQueue_PopBulkCompleteGuard(TYPE                *queue,
+                                  bsls::Types::Uint64  index,
+                                  bsls::Types::Uint64  numValues,
+                                  bool                 isEmpty)
+: d_queue_p(queue)
+, d_node_p(0)
+, d_index(index)
+, d_numRemaining(numValues)
+, d_numValues(numValues)
+, d_isEmpty(isEmpty)
+{
+}
+
+template <class TYPE, class NODE>
+BoundedQueue_PopBulkCompleteGuard<TYPE, NODE>::
+                                          ~BoundedQueue_PopBulkCompleteGuard()
+{
+    // Normally only the last supplied node remains; in the presence of an
+    // exception, the values of the nodes not yet supplied are discarded.
+
+    while (d_numRemaining) {
+        next();
+    }
+    if (d_node_p) {
+        bslma::DestructionUtil::destroy(d_node_p->d_value.address());
+    }
+
+    d_queue_p->popCompleteBulk(d_numValues, d_isEmpty);
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+inline
+NODE *BoundedQueue_PopBulkCompleteGuard<TYPE, NODE>::next()
+{
+    BSLS_ASSERT(0 < d_numRemaining);
+
+    if (d_node_p) {
+        bslma::DestructionUtil::destroy(d_node_p->d_value.address());
+    }
+
+    --d_numRemaining;
+    d_node_p = d_queue_p->nextPopNode(&d_index);
+
+    return d_node_p;
+}
+
+                 // ---------------------------------------
+                 // class BoundedQueue_PushBulkCompleteGuard
+                 // ---------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PushBulkCompleteGuard<TYPE>::
+BoundedQueue_PushBulkCompleteGuard(TYPE                *queue,
+                                   bsls::Types::Uint64  index,
+                                   bsls::Types::Uint64  numReserved)
+: d_queue_p(queue)
+, d_index(index)
+, d_numReserved(numReserved)
+, d_numPushed(0)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PushBulkCompleteGuard<TYPE>::~BoundedQueue_PushBulkCompleteGuard()
+{
+    d_queue_p->pushCompleteBulk(d_index, d_numReserved, d_numPushed);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PushBulkCompleteGuard<TYPE>::increment()
+{
+    ++d_numPushed;
+}
+
                          // ------------------------
                          // struct BoundedQueue_Node
                          // ------------------------
@@ -686,12 +977,37 @@ bool BoundedQueue<TYPE>::isQuiescentState(bsls::Types::Uint64 count)
 }
 
 // PRIVATE MANIPULATORS
+template <class TYPE>
+typename BoundedQueue<TYPE>::Node *BoundedQueue<TYPE>::nextPopNode(
+                                                                Uint64 *index)
+{
+    Node *node = &d_element_p[(*index)++ % d_capacity];
+
+    // See 'popFrontHelper' for the treatment of nodes marked for reclamation.
+
+    while (node->reclaim()) {
+        AtomicOp::addUint64AcqRel(&d_popCount, k_STARTED_INC + k_FINISHED_INC);
+
+        Uint64 extra = AtomicOp::addUint64NvAcqRel(&d_popIndex, 1) - 1;
+        node = &d_element_p[extra % d_capacity];
+    }
+
+    return node;
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::popComplete(Node *node, bool isEmpty)
 {
     node->d_value.object().~TYPE();
 
-    Uint64 count = AtomicOp::addUint64NvAcqRel(&d_popCount, k_FINISHED_INC);
+    popCompleteBulk(1, isEmpty);
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popCompleteBulk(Uint64 numPopped, bool isEmpty)
+{
+    Uint64 count = AtomicOp::addUint64NvAcqRel(&d_popCount,
+                                               numPopped * k_FINISHED_INC);
     if (isQuiescentState(count)) {
 
         // The total number of popped elements is 'count & k_STARTED_MASK'.
@@ -716,6 +1032,34 @@ void BoundedQueue<TYPE>::popComplete(Node *node, bool isEmpty)
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::popFrontBulkHelper(TYPE *values, Uint64 numValues)
+{
+    bool empty = isEmpty();
+
+    // The run of 'numValues' elements is reserved with a single update of
+    // each of 'd_popCount' and 'd_popIndex', and is released to pushers with
+    // a single update of 'd_popCount' (see 'popCompleteBulk').
+
+    AtomicOp::addUint64AcqRel(&d_popCount, numValues * k_STARTED_INC);
+
+    Uint64 index = AtomicOp::addUint64NvAcqRel(&d_popIndex, numValues)
+                                                                   - numValues;
+
+    BoundedQueue_PopBulkCompleteGuard<BoundedQueue<TYPE>, Node>
+                                       guard(this, index, numValues, empty);
+
+    for (Uint64 i = 0; i < numValues; ++i) {
+        Node *node = guard.next();
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        values[i] = bslmf::MovableRefUtil::move(node->d_value.object());
+#else
+        values[i] = node->d_value.object();
+#endif
+    }
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 {
@@ -753,6 +1097,38 @@ void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 #endif
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::pushBackBulkHelper(const TYPE *values,
+                                            Uint64      numValues)
+{
+    // The run of 'numValues' elements is reserved with a single update of
+    // each of 'd_pushCount' and 'd_pushIndex', and is published to poppers
+    // with a single update of 'd_pushCount' (see 'pushCompleteBulk').
+
+    AtomicOp::addUint64AcqRel(&d_pushCount, numValues * k_STARTED_INC);
+
+    Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, numValues)
+                                                                   - numValues;
+
+    BoundedQueue_PushBulkCompleteGuard<BoundedQueue<TYPE> > guard(this,
+                                                                  index,
+                                                                  numValues);
+
+    for (Uint64 i = 0; i < numValues; ++i) {
+        Node& node = d_element_p[(index + i) % d_capacity];
+
+        node.assignReclaim(true);
+
+        bslalg::ScalarPrimitives::copyConstruct(node.d_value.address(),
+                                                values[i],
+                                                d_allocator_p);
+
+        node.assignReclaim(false);
+
+        guard.increment();
+    }
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::pushComplete()
 {
@@ -792,6 +1168,40 @@ void BoundedQueue<TYPE>::pushExceptionComplete()
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::pushCompleteBulk(Uint64 index,
+                                          Uint64 numReserved,
+                                          Uint64 numPushed)
+{
+    // Elements that were not constructed due to an exception are marked for
+    // reclamation, and are not counted as pushed (see
+    // 'pushExceptionComplete').
+
+    for (Uint64 i = numPushed; i < numReserved; ++i) {
+        d_element_p[(index + i) % d_capacity].assignReclaim(true);
+    }
+
+    Uint64 count = AtomicOp::addUint64NvAcqRel(
+                                  &d_pushCount,
+                                  numPushed * k_FINISHED_INC
+                                  - (numReserved - numPushed) * k_STARTED_INC);
+
+    int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+    if (0 != numToPost && isQuiescentState(count)) {
+
+        // The total number of pushed elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the pop
+        // semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_pushCount,
+                                               count,
+                                               0) == count) {
+            d_popSemaphore.post(numToPost);
+        }
+    }
+}
+
 // CREATORS
 template <class TYPE>
 BoundedQueue<TYPE>::BoundedQueue(bsl::size_t       capacity,
@@ -849,6 +1259,36 @@ int BoundedQueue<TYPE>::popFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::popFrontBulk(TYPE        *values,
+                                     bsl::size_t  maxNumValues,
+                                     bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    int rv = d_popSemaphore.wait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    Uint64 numValues = 1;
+    if (1 < maxNumValues) {
+        numValues += d_popSemaphore.take(static_cast<int>(
+                      bsl::min<Uint64>(maxNumValues - 1, d_capacity)));
+    }
+
+    popFrontBulkHelper(values, numValues);
+
+    *numPopped = static_cast<bsl::size_t>(numValues);
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -922,6 +1362,40 @@ int BoundedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::pushBackBulk(const TYPE  *values,
+                                     bsl::size_t  numValues,
+                                     bsl::size_t *numPushed)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    bsl::size_t pushed = 0;
+    int         rv     = e_SUCCESS;
+
+    while (pushed < numValues) {
+        int waitRv = d_pushSemaphore.wait();
+        if (waitRv) {
+            rv = bslmt::FastPostSemaphore::e_DISABLED == waitRv
+               ? e_DISABLED
+               : e_FAILED;
+            break;
+        }
+
+        Uint64 count = 1 + d_pushSemaphore.take(static_cast<int>(
+                       bsl::min<Uint64>(numValues - pushed - 1, d_capacity)));
+
+        pushBackBulkHelper(values + pushed, count);
+
+        pushed += static_cast<bsl::size_t>(count);
+    }
+
+    if (numPushed) {
+        *numPushed = pushed;
+    }
+
+    return rv;
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::removeAll()
 {
@@ -980,6 +1454,39 @@ int BoundedQueue<TYPE>::tryPopFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPopFrontBulk(TYPE        *values,
+                                        bsl::size_t  maxNumValues,
+                                        bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    int rv = d_popSemaphore.tryWait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+            return e_EMPTY;                                           // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    Uint64 numValues = 1;
+    if (1 < maxNumValues) {
+        numValues += d_popSemaphore.take(static_cast<int>(
+                      bsl::min<Uint64>(maxNumValues - 1, d_capacity)));
+    }
+
+    popFrontBulkHelper(values, numValues);
+
+    *numPopped = static_cast<bsl::size_t>(numValues);
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -1056,6 +1563,43 @@ int BoundedQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
 
     pushComplete();
 
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPushBackBulk(const TYPE  *values,
+                                        bsl::size_t  numValues,
+                                        bsl::size_t *numPushed)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(numPushed);
+
+    if (0 == numValues) {
+        *numPushed = 0;
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    int rv = d_pushSemaphore.tryWait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+            return e_FULL;                                            // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    Uint64 count = 1;
+    if (1 < numValues) {
+        count += d_pushSemaphore.take(static_cast<int>(
+                         bsl::min<Uint64>(numValues - 1, d_capacity)));
+    }
+
+    pushBackBulkHelper(values, count);
+
+    *numPushed = static_cast<bsl::size_t>(count);
+
     return e_SUCCESS;
 }
 
@@ -81,10 +81,14 @@ using namespace bsl;
 // [ 2] int popFront(TYPE *value);
 // [ 2] int pushBack(const TYPE& value);
 // [ 9] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int popFrontBulk(TYPE *values, size_t maxNum, size_t *n);
+// [13] int pushBackBulk(const TYPE *values, size_t num, size_t *n);
 // [ 2] void removeAll();
 // [ 7] int tryPopFront(TYPE *value);
+// [13] int tryPopFrontBulk(TYPE *values, size_t maxNum, size_t *n);
 // [ 6] int tryPushBack(const TYPE& value);
 // [ 9] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [13] int tryPushBackBulk(const TYPE *values, size_t num, size_t *n);
 // [ 5] void disablePopFront();
 // [ 5] void disablePushBack();
 // [ 5] void enablePopFront();
@@ -98,7 +102,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -153,6 +157,13 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
 // ============================================================================
 //                        GLOBAL MACROS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -736,6 +747,97 @@ void orderingGuaranteeTest(const int numPushThread, const int numPopThread)
     bslmt::ThreadUtil::join(watchdogHandle);
 }
 
+enum {
+    k_BULK_NUM_VALUES = 20000,  // values pushed by each bulk producer
+    k_BULK_BATCH_SIZE = 64      // maximum number of values in a batch
+};
+
+struct BulkPushData {
+    Obj *d_obj_p;  // queue to push into
+    int  d_id;     // identifies the pushing thread, in '[0 .. numThreads)'
+};
+
+extern "C" void *bulkPush(void *arg)
+    // Push, using 'pushBackBulk' with batches of varying size, the
+    // 'k_BULK_NUM_VALUES' values 'd_id * k_BULK_NUM_VALUES + i', for 'i' in
+    // increasing order, into the queue of the 'BulkPushData' addressed by the
+    // specified 'arg'.
+{
+    BulkPushData *data = static_cast<BulkPushData *>(arg);
+
+    int values[k_BULK_BATCH_SIZE];
+    int next = 0;
+
+    while (next < k_BULK_NUM_VALUES) {
+        int numValues = 1 + next % k_BULK_BATCH_SIZE;
+        if (numValues > k_BULK_NUM_VALUES - next) {
+            numValues = k_BULK_NUM_VALUES - next;
+        }
+
+        for (int i = 0; i < numValues; ++i) {
+            values[i] = data->d_id * k_BULK_NUM_VALUES + next + i;
+        }
+
+        bsl::size_t numPushed = 0;
+        int         rv        = data->d_obj_p->pushBackBulk(values,
+                                                            numValues,
+                                                            &numPushed);
+
+        ASSERTV(rv, e_SUCCESS == rv);
+        ASSERTV(numPushed, numValues,
+                static_cast<bsl::size_t>(numValues) == numPushed);
+
+        next += numValues;
+    }
+
+    return 0;
+}
+
+struct BulkPopData {
+    Obj              *d_obj_p;    // queue to pop from
+    bsl::vector<int>  d_values;   // values popped, in order
+    bool              d_useTry;   // if 'true', use 'tryPopFrontBulk'
+};
+
+extern "C" void *bulkPop(void *arg)
+    // Pop, using 'popFrontBulk' (or 'tryPopFrontBulk' if 'd_useTry'), values
+    // from the queue of the 'BulkPopData' addressed by the specified 'arg'
+    // and append them to 'd_values', until the queue is dequeue disabled.
+{
+    BulkPopData *data = static_cast<BulkPopData *>(arg);
+
+    int values[k_BULK_BATCH_SIZE];
+
+    while (1) {
+        bsl::size_t numPopped = 0;
+        int         rv        = data->d_useTry
+                              ? data->d_obj_p->tryPopFrontBulk(
+                                                             values,
+                                                             k_BULK_BATCH_SIZE,
+                                                             &numPopped)
+                              : data->d_obj_p->popFrontBulk(values,
+                                                            k_BULK_BATCH_SIZE,
+                                                            &numPopped);
+
+        if (e_DISABLED == rv) {
+            break;
+        }
+        if (e_EMPTY == rv) {
+            bslmt::ThreadUtil::yield();
+            continue;
+        }
+
+        ASSERTV(rv, e_SUCCESS == rv);
+        ASSERTV(numPopped, 0 < numPopped && numPopped <= k_BULK_BATCH_SIZE);
+
+        data->d_values.insert(data->d_values.end(),
+                              values,
+                              values + numPopped);
+    }
+
+    return 0;
+}
+
 extern "C" void *pushWaitDisable(void *arg)
 {
     Obj& mX = *static_cast<Obj *>(arg);
@@ -971,7 +1073,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1009,6 +1111,409 @@ int main(int argc, char *argv[])
 
         bslmt::ThreadUtil::join(watchdogHandle);
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // BULK OPERATIONS
+        //
+        // Concerns:
+        //: 1 'tryPushBackBulk' appends, in order, as many values as there is
+        //:   capacity for, returns 'e_SUCCESS' if any were appended, and
+        //:   returns 'e_FULL' if the queue is full.
+        //:
+        //: 2 'pushBackBulk' appends all the values, blocking until capacity
+        //:   is available.
+        //:
+        //: 3 'tryPopFrontBulk' and 'popFrontBulk' remove, in order, up to the
+        //:   requested number of values, and 'tryPopFrontBulk' returns
+        //:   'e_EMPTY' if the queue is empty.
+        //:
+        //: 4 The bulk methods interoperate with the single-element methods
+        //:   across the wrap-around of the underlying array.
+        //:
+        //: 5 The bulk methods return 'e_DISABLED' when the respective end of
+        //:   the queue is disabled.
+        //:
+        //: 6 All memory is released, and an exception thrown while copying a
+        //:   value in 'pushBackBulk' leaves the queue in a valid state
+        //:   containing the values copied before the exception.
+        //:
+        //: 7 Concurrent bulk producers and consumers transfer every value
+        //:   exactly once, preserving the order of each producer's values as
+        //:   seen by each consumer.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a queue of capacity 8, exercise the bulk methods with
+        //:   requests smaller and larger than the available elements and
+        //:   verify the return values, the number of elements transferred,
+        //:   and the values.  (C-1..3)
+        //:
+        //: 2 Repeatedly push and pop batches of every size, mixing bulk and
+        //:   single-element methods, and verify the sequence of values.
+        //:   (C-4)
+        //:
+        //: 3 Disable each end of the queue and verify the return values of
+        //:   the bulk methods.  (C-5)
+        //:
+        //: 4 Use a queue of strings supplied by a test allocator, and a queue
+        //:   of 'AllocExceptionHelper' with an allocation limit to force an
+        //:   exception during 'pushBackBulk'.  (C-6)
+        //:
+        //: 5 Run four producer threads using 'pushBackBulk' and four consumer
+        //:   threads using 'popFrontBulk' or 'tryPopFrontBulk', and verify
+        //:   the values popped.  (C-7)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments, but not triggered for adjacent
+        //:   valid ones (using the 'BSLS_ASSERTTEST_*' macros).  (C-8)
+        //
+        // Testing:
+        //   int popFrontBulk(TYPE *values, size_t maxNum, size_t *n);
+        //   int pushBackBulk(const TYPE *values, size_t num, size_t *n);
+        //   int tryPopFrontBulk(TYPE *values, size_t maxNum, size_t *n);
+        //   int tryPushBackBulk(const TYPE *values, size_t num, size_t *n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK OPERATIONS" << endl
+                          << "===============" << endl;
+
+        if (verbose) cout << "\nBasic behavior." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(8, &sa);  const Obj& X = mX;
+
+            int values[16];
+            for (int i = 0; i < 16; ++i) {
+                values[i] = i + 1;
+            }
+
+            int         out[16];
+            bsl::size_t num = 99;
+
+            ASSERT(e_SUCCESS == mX.tryPushBackBulk(values, 0, &num));
+            ASSERT(0 == num);
+            ASSERT(0 == X.numElements());
+
+            ASSERT(e_EMPTY == mX.tryPopFrontBulk(out, 4, &num));
+            ASSERT(0 == num);
+
+            ASSERT(e_SUCCESS == mX.tryPushBackBulk(values, 12, &num));
+            ASSERT(8 == num);
+            ASSERT(8 == X.numElements());
+            ASSERT(X.isFull());
+
+            num = 99;
+            ASSERT(e_FULL == mX.tryPushBackBulk(values, 1, &num));
+            ASSERT(99 == num);
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontBulk(out, 3, &num));
+            ASSERT(3 == num);
+            ASSERT(1 == out[0] && 2 == out[1] && 3 == out[2]);
+            ASSERT(5 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.pushBackBulk(values + 8, 3, &num));
+            ASSERT(3 == num);
+            ASSERT(8 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.popFrontBulk(out, 16, &num));
+            ASSERT(8 == num);
+            for (int i = 0; i < 8; ++i) {
+                ASSERTV(i, out[i], i + 4 == out[i]);
+            }
+            ASSERT(X.isEmpty());
+
+            ASSERT(e_EMPTY == mX.tryPopFrontBulk(out, 16, &num));
+        }
+
+        if (verbose) cout << "\nInteroperation and wrap-around." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(8, &sa);  const Obj& X = mX;
+
+            int nextPush = 0;
+            int nextPop  = 0;
+
+            for (int iteration = 0; iteration < 200; ++iteration) {
+                const int numValues = 1 + iteration % 8;
+
+                int values[8];
+                for (int i = 0; i < numValues; ++i) {
+                    values[i] = nextPush + i;
+                }
+
+                if (iteration % 3) {
+                    ASSERT(e_SUCCESS == mX.pushBackBulk(values, numValues));
+                }
+                else {
+                    for (int i = 0; i < numValues; ++i) {
+                        ASSERT(e_SUCCESS == mX.pushBack(values[i]));
+                    }
+                }
+                nextPush += numValues;
+
+                ASSERTV(iteration,
+                        static_cast<bsl::size_t>(numValues) ==
+                                                             X.numElements());
+
+                int         out[8];
+                bsl::size_t num;
+
+                if (iteration % 2) {
+                    ASSERT(e_SUCCESS == mX.tryPopFrontBulk(out, 8, &num));
+                    ASSERTV(iteration,
+                            num,
+                            static_cast<bsl::size_t>(numValues) == num);
+                }
+                else {
+                    // Pop one value individually, and the rest in batches of
+                    // at most two.
+
+                    ASSERT(e_SUCCESS == mX.popFront(out));
+                    num = 1;
+                    while (num < static_cast<bsl::size_t>(numValues)) {
+                        bsl::size_t n;
+                        ASSERT(e_SUCCESS == mX.popFrontBulk(out + num,
+                                                            2,
+                                                            &n));
+                        ASSERT(1 <= n && n <= 2);
+                        num += n;
+                    }
+                }
+
+                for (int i = 0; i < numValues; ++i) {
+                    ASSERTV(iteration, i, out[i], nextPop == out[i]);
+                    ++nextPop;
+                }
+                ASSERT(X.isEmpty());
+            }
+        }
+
+        if (verbose) cout << "\nDisablement." << endl;
+        {
+            Obj mX(8);
+
+            int         values[4] = { 1, 2, 3, 4 };
+            int         out[4];
+            bsl::size_t num = 99;
+
+            mX.disablePushBack();
+
+            ASSERT(e_DISABLED == mX.pushBackBulk(values, 4, &num));
+            ASSERT(0 == num);
+            num = 99;
+            ASSERT(e_DISABLED == mX.tryPushBackBulk(values, 4, &num));
+            ASSERT(99 == num);
+
+            mX.enablePushBack();
+
+            ASSERT(e_SUCCESS == mX.pushBackBulk(values, 4));
+
+            mX.disablePopFront();
+
+            ASSERT(e_DISABLED == mX.popFrontBulk(out, 4, &num));
+            ASSERT(e_DISABLED == mX.tryPopFrontBulk(out, 4, &num));
+            ASSERT(99 == num);
+
+            mX.enablePopFront();
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontBulk(out, 4, &num));
+            ASSERT(4 == num);
+        }
+
+        if (verbose) cout << "\nAllocating elements." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            const bsl::string longString("a string long enough to allocate "
+                                         "memory from the allocator");
+
+            bsl::string values[5] = { longString,
+                                      longString,
+                                      longString,
+                                      longString,
+                                      longString };
+            {
+                AllocObj mX(8, &sa);  const AllocObj& X = mX;
+
+                ASSERT(e_SUCCESS == mX.pushBackBulk(values, 5));
+                ASSERT(5 == X.numElements());
+
+                bsl::string out[2];
+                bsl::size_t num;
+
+                ASSERT(e_SUCCESS == mX.tryPopFrontBulk(out, 2, &num));
+                ASSERT(2 == num);
+                ASSERT(longString == out[0] && longString == out[1]);
+
+                // The remaining elements are destroyed with the queue.
+            }
+            ASSERT(0 == sa.numBytesInUse());
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nException while pushing." << endl;
+        {
+            // white-box test for when the element copy throws in the middle
+            // of a batch
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bdlcc::BoundedQueue<AllocExceptionHelper>        mX(4, &sa);
+            const bdlcc::BoundedQueue<AllocExceptionHelper>& X = mX;
+
+            AllocExceptionHelper values[3] = { AllocExceptionHelper(&sa),
+                                               AllocExceptionHelper(&sa),
+                                               AllocExceptionHelper(&sa) };
+
+            AllocExceptionHelper out[4] = { AllocExceptionHelper(&sa),
+                                            AllocExceptionHelper(&sa),
+                                            AllocExceptionHelper(&sa),
+                                            AllocExceptionHelper(&sa) };
+
+            bsls::Types::Int64 nd = sa.numDeallocations();
+
+            int numException = 0;
+
+            // The first copy succeeds and the second throws.
+
+            sa.setAllocationLimit(1);
+            try {
+                mX.pushBackBulk(values, 3);
+            } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                ++numException;
+            }
+            sa.setAllocationLimit(-1);
+
+            ASSERT(     1 == numException);
+            ASSERT(     1 == X.numElements());
+            ASSERT(nd     == sa.numDeallocations());
+
+            // The two elements marked for reclamation remain unavailable until
+            // a subsequent 'pop' skips them and returns them to the available
+            // capacity.
+
+            bsl::size_t num;
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontBulk(out, 4, &num));
+            ASSERT(1 == num);
+            ASSERT(X.isEmpty());
+
+            ASSERT(e_SUCCESS == mX.tryPushBackBulk(values, 3, &num));
+            ASSERT(2 == num);
+            ASSERT(e_FULL == mX.tryPushBack(values[0]));
+
+            ASSERT(e_SUCCESS == mX.popFrontBulk(out, 4, &num));
+            ASSERT(2 == num);
+            ASSERT(X.isEmpty());
+
+            ASSERT(e_SUCCESS == mX.tryPushBackBulk(values, 3, &num));
+            ASSERT(3 == num);
+            ASSERT(e_SUCCESS == mX.tryPushBack(values[0]));
+            ASSERT(X.isFull());
+
+            ASSERT(e_SUCCESS == mX.popFrontBulk(out, 4, &num));
+            ASSERT(4 == num);
+            ASSERT(X.isEmpty());
+        }
+#endif
+
+        if (verbose) cout << "\nConcurrent producers and consumers." << endl;
+        {
+            enum { k_NUM_THREADS = 4 };
+
+            bslmt::ThreadUtil::Handle watchdogHandle;
+
+            s_continue = 1;
+
+            setWatchdogText("bulk operations");
+            bslmt::ThreadUtil::create(&watchdogHandle, watchdog, 0);
+
+            Obj mX(100);
+
+            BulkPushData              pushData[k_NUM_THREADS];
+            BulkPopData               popData[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle pushHandle[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle popHandle[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                popData[i].d_obj_p  = &mX;
+                popData[i].d_useTry = 0 == i % 2;
+                bslmt::ThreadUtil::create(&popHandle[i],
+                                          bulkPop,
+                                          &popData[i]);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                pushData[i].d_obj_p = &mX;
+                pushData[i].d_id    = i;
+                bslmt::ThreadUtil::create(&pushHandle[i],
+                                          bulkPush,
+                                          &pushData[i]);
+            }
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(pushHandle[i]);
+            }
+
+            ASSERT(0 == mX.waitUntilEmpty());
+
+            mX.disablePopFront();
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(popHandle[i]);
+            }
+
+            s_continue = 0;
+
+            bslmt::ThreadUtil::join(watchdogHandle);
+
+            bsl::vector<int> count(k_NUM_THREADS * k_BULK_NUM_VALUES, 0);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                const bsl::vector<int>& popped = popData[i].d_values;
+
+                int last[k_NUM_THREADS] = { -1, -1, -1, -1 };
+
+                for (bsl::size_t j = 0; j < popped.size(); ++j) {
+                    const int value    = popped[j];
+                    const int producer = value / k_BULK_NUM_VALUES;
+
+                    ASSERTV(value, last[producer], last[producer] < value);
+
+                    last[producer] = value;
+                    ++count[value];
+                }
+            }
+
+            for (bsl::size_t i = 0; i < count.size(); ++i) {
+                ASSERTV(i, count[i], 1 == count[i]);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(8);
+
+            int         values[2] = { 1, 2 };
+            bsl::size_t num;
+
+            ASSERT_PASS(mX.tryPushBackBulk(values, 2, &num));
+            ASSERT_FAIL(mX.tryPushBackBulk(values, 2, 0));
+            ASSERT_FAIL(mX.tryPushBackBulk(0, 2, &num));
+
+            ASSERT_FAIL(mX.tryPopFrontBulk(values, 0, &num));
+            ASSERT_FAIL(mX.tryPopFrontBulk(values, 2, 0));
+            ASSERT_FAIL(mX.tryPopFrontBulk(0, 2, &num));
+            ASSERT_PASS(mX.tryPopFrontBulk(values, 2, &num));
+
+            ASSERT_FAIL(mX.popFrontBulk(values, 0, &num));
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // DRQS 153332608: 'waitUntilEmpty' RACE WITH 'popFront'
@@ -30,6 +30,11 @@ BSLS_IDENT("$Id: $")
 // 'tryPushBack' and 'tryPopFront' are also provided, which fail immediately
 // returning a non-zero value in case of overflow or underflow.
 //
+// Bulk variants, 'pushBackBulk', 'tryPushBackBulk', and 'tryPopFrontBulk',
+// transfer a run of values to or from a caller-supplied array.  Each element
+// of a run is still reserved individually, but threads blocked waiting on the
+// queue are woken once per run rather than once per element.
+//
 // The queue may be placed into a "disabled" state using the 'disable' method.
 // When disabled, 'pushBack' and 'tryPushBack' fail immediately (they do not
 // block and any blocked invocations will fail immediately).  The queue may be
@@ -301,6 +306,14 @@ class FixedQueue {
         // state.  Return 0 on success, and a nonzero value if the queue is
         // disabled.
 
+    int pushBackBulk(const TYPE *values, bsl::size_t numValues);
+        // Append, in order, the specified 'numValues' elements of the array
+        // starting at the specified 'values' to the back of this queue,
+        // blocking until either space is available - if necessary - or the
+        // queue is disabled.  Return 0 on success, and a nonzero value if the
+        // queue is disabled.  Note that if the queue is disabled, some of the
+        // values may have been appended.
+
     int tryPushBack(const TYPE& value);
         // Attempt to append the specified 'value' to the back of this queue
         // without blocking.  Return 0 on success, and a non-zero value if the
@@ -312,6 +325,13 @@ class FixedQueue {
         // unspecified state.  Return 0 on success, and a non-zero value if the
         // queue is full or disabled.
 
+    bsl::size_t tryPushBackBulk(const TYPE *values, bsl::size_t numValues);
+        // Append, in order and without blocking, as many of the specified
+        // 'numValues' elements of the array starting at the specified 'values'
+        // to the back of this queue as there is space available for, and
+        // return the number of elements appended.  Note that 0 is returned if
+        // the queue is full or disabled.
+
     void popFront(TYPE* value);
         // Remove the element from the front of this queue and load that
         // element into the specified 'value'.  If the queue is empty, block
@@ -327,6 +347,14 @@ class FixedQueue {
         // removed element.  Return 0 on success, and a non-zero value if queue
         // was empty.  On failure, 'value' is not changed.
 
+    bsl::size_t tryPopFrontBulk(TYPE *values, bsl::size_t maxNumValues);
+        // Remove, without blocking, up to the specified 'maxNumValues'
+        // elements from the front of this queue, load them, in order, into the
+        // array starting at the specified 'values', and return the number of
+        // elements removed.  The behavior is undefined unless 'values' refers
+        // to an array of at least 'maxNumValues' elements.  Note that 0 is
+        // returned if the queue is empty.
+
     void removeAll();
         // Remove all items from this queue.  Note that this operation is not
         // atomic; if other threads are concurrently pushing items into the
@@ -624,6 +652,78 @@ int FixedQueue<TYPE>::tryPopFront(TYPE *value)
     return 0;
 }
 
+template <class TYPE>
+bsl::size_t FixedQueue<TYPE>::tryPushBackBulk(const TYPE  *values,
+                                              bsl::size_t  numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    bsl::size_t numPushed = 0;
+
+    while (numPushed < numValues) {
+        unsigned int generation;
+        unsigned int index;
+
+        // SYNCHRONIZATION POINT 1 (see 'tryPushBack')
+
+        if (0 != d_impl.reservePushIndex(&generation, &index)) {
+            break;
+        }
+
+        FixedQueue_PushProctor<TYPE> guard(this, generation, index);
+        bslalg::ScalarPrimitives::copyConstruct(&d_elements[index],
+                                                values[numPushed],
+                                                d_allocator_p);
+        guard.release();
+        d_impl.commitPushIndex(generation, index);
+
+        ++numPushed;
+    }
+
+    // Wake up waiting poppers once for the whole run.
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numWaitingPoppers)) {
+        const int numWakeUps = static_cast<int>(
+                   bsl::min(numPushed,
+                            static_cast<bsl::size_t>(d_numWaitingPoppers)));
+        if (numWakeUps) {
+            d_popControlSema.post(numWakeUps);
+        }
+    }
+
+    return numPushed;
+}
+
+template <class TYPE>
+bsl::size_t FixedQueue<TYPE>::tryPopFrontBulk(TYPE        *values,
+                                              bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(values || 0 == maxNumValues);
+
+    bsl::size_t numPopped = 0;
+
+    while (numPopped < maxNumValues) {
+        unsigned int generation;
+        unsigned int index;
+
+        // SYNCHRONIZATION POINT 2 (see 'tryPopFront')
+
+        if (0 != d_impl.reservePopIndex(&generation, &index)) {
+            break;
+        }
+
+        FixedQueue_PopGuard<TYPE> guard(this, generation, index);
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        values[numPopped] = bslmf::MovableRefUtil::move(d_elements[index]);
+#else
+        values[numPopped] = d_elements[index];
+#endif
+        ++numPopped;
+    }
+
+    return numPopped;
+}
+
 // MANIPULATORS
 template <class TYPE>
 int FixedQueue<TYPE>::pushBack(const TYPE& value)
@@ -687,6 +787,35 @@ int FixedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return 0;
 }
 
+template <class TYPE>
+int FixedQueue<TYPE>::pushBackBulk(const TYPE *values, bsl::size_t numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    bsl::size_t numPushed = tryPushBackBulk(values, numValues);
+
+    while (numPushed < numValues) {
+        if (!isEnabled()) {
+            return -1;                                                // RETURN
+        }
+
+        d_numWaitingPushers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 1-Prime (see 'pushBack')
+
+        if (isFull() && isEnabled()) {
+            d_pushControlSema.wait();
+        }
+
+        d_numWaitingPushers.addRelaxed(-1);
+
+        numPushed += tryPushBackBulk(values + numPushed,
+                                     numValues - numPushed);
+    }
+
+    return 0;
+}
+
 template <class TYPE>
 void FixedQueue<TYPE>::popFront(TYPE *value)
 {
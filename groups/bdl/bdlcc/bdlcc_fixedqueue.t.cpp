@@ -50,6 +50,7 @@
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>            // 'atoi'
 
@@ -200,6 +201,71 @@ void pushpopThread(bdlcc::FixedQueue<int> *queue,
 
 }  // close namespace Backoff
 
+namespace bulktst {
+
+enum {
+    k_NUM_VALUES = 20000,  // number of values pushed by each pusher
+    k_BATCH_SIZE = 32      // maximum number of values in a batch
+};
+
+void bulkPusher(bdlcc::FixedQueue<int> *queue, int threadId)
+    // Push the values 'threadId * k_NUM_VALUES + i', for 'i' in increasing
+    // order, into the specified 'queue' using 'pushBackBulk' with batches of
+    // varying size.
+{
+    int values[k_BATCH_SIZE];
+    int next = 0;
+
+    while (next < k_NUM_VALUES) {
+        int numValues = bsl::min(1 + next % k_BATCH_SIZE,
+                                 static_cast<int>(k_NUM_VALUES) - next);
+
+        for (int i = 0; i < numValues; ++i) {
+            values[i] = threadId * k_NUM_VALUES + next + i;
+        }
+
+        ASSERTT(0 == queue->pushBackBulk(values, numValues));
+
+        next += numValues;
+    }
+}
+
+void bulkPopper(bdlcc::FixedQueue<int> *queue,
+                bsls::AtomicInt        *numRemaining,
+                bsl::vector<int>       *counts,
+                int                     numPushers)
+    // Pop values from the specified 'queue' using 'tryPopFrontBulk' until the
+    // specified 'numRemaining' values have been popped by all poppers, verify
+    // that the values from each of the specified 'numPushers' pushers are
+    // popped in increasing order, and increment the element of the specified
+    // 'counts' for each value popped.
+{
+    int              values[k_BATCH_SIZE];
+    bsl::vector<int> last(numPushers, -1);
+
+    while (0 < *numRemaining) {
+        int numPopped = static_cast<int>(queue->tryPopFrontBulk(values,
+                                                               k_BATCH_SIZE));
+        if (0 == numPopped) {
+            bslmt::ThreadUtil::yield();
+            continue;
+        }
+
+        for (int i = 0; i < numPopped; ++i) {
+            int pusher = values[i] / k_NUM_VALUES;
+
+            LOOP2_ASSERTT(last[pusher], values[i], last[pusher] < values[i]);
+
+            last[pusher] = values[i];
+            ++(*counts)[values[i]];
+        }
+
+        numRemaining->add(-numPopped);
+    }
+}
+
+}  // close namespace bulktst
+
 void rolloverPusher(bdlcc::FixedQueue<int> *queue,
                     bsls::AtomicInt        *doneFlag,
                     bslmt::Turnstile       *turnstile,
@@ -1317,7 +1383,7 @@ int main(int argc, char *argv[])
                     bslmt::Configuration::recommendedDefaultThreadStackSize());
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // ---------------------------------------------------------
         // Usage example test
         //
@@ -1333,6 +1399,131 @@ int main(int argc, char *argv[])
         break;
       }
 
+      case 19: {
+        // ---------------------------------------------------------
+        // Bulk operations
+        //
+        // Test that 'pushBackBulk', 'tryPushBackBulk', and
+        // 'tryPopFrontBulk' transfer runs of values in order, respect the
+        // capacity and the disabled state of the queue, interoperate with
+        // the single-element methods, and transfer every value exactly once
+        // when used concurrently.
+        // ---------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Bulk operations" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            bdlcc::FixedQueue<int> mX(8, &ta);
+
+            int values[12];
+            for (int i = 0; i < 12; ++i) {
+                values[i] = i + 1;
+            }
+            int out[12];
+
+            ASSERT(0 == mX.tryPushBackBulk(values, 0));
+            ASSERT(0 == mX.tryPopFrontBulk(out, 12));
+
+            ASSERT(8 == mX.tryPushBackBulk(values, 12));
+            ASSERT(mX.isFull());
+            ASSERT(0 == mX.tryPushBackBulk(values, 1));
+
+            ASSERT(3 == mX.tryPopFrontBulk(out, 3));
+            ASSERT(1 == out[0] && 2 == out[1] && 3 == out[2]);
+
+            ASSERT(0 == mX.pushBackBulk(values + 8, 3));
+            ASSERT(8 == mX.numElements());
+
+            ASSERT(8 == mX.tryPopFrontBulk(out, 12));
+            for (int i = 0; i < 8; ++i) {
+                LOOP2_ASSERT(i, out[i], i + 4 == out[i]);
+            }
+            ASSERT(mX.isEmpty());
+
+            // interoperation and wrap-around
+
+            int nextPush = 0;
+            int nextPop  = 0;
+            for (int iteration = 0; iteration < 100; ++iteration) {
+                const int numValues = 1 + iteration % 8;
+
+                for (int i = 0; i < numValues; ++i) {
+                    values[i] = nextPush++;
+                }
+                if (iteration % 2) {
+                    ASSERT(0 == mX.pushBackBulk(values, numValues));
+                }
+                else {
+                    for (int i = 0; i < numValues; ++i) {
+                        ASSERT(0 == mX.pushBack(values[i]));
+                    }
+                }
+
+                int numPopped = 0;
+                if (iteration % 3) {
+                    numPopped = static_cast<int>(mX.tryPopFrontBulk(out, 12));
+                }
+                else {
+                    while (0 == mX.tryPopFront(out + numPopped)) {
+                        ++numPopped;
+                    }
+                }
+                LOOP2_ASSERT(iteration, numPopped, numValues == numPopped);
+                for (int i = 0; i < numPopped; ++i) {
+                    LOOP3_ASSERT(iteration, i, out[i], nextPop == out[i]);
+                    ++nextPop;
+                }
+            }
+
+            // disabled
+
+            mX.disable();
+            ASSERT(0 == mX.tryPushBackBulk(values, 4));
+            ASSERT(0 != mX.pushBackBulk(values, 4));
+            mX.enable();
+            ASSERT(4 == mX.tryPushBackBulk(values, 4));
+            ASSERT(4 == mX.tryPopFrontBulk(out, 12));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tConcurrent bulk pushers and poppers" << endl;
+        {
+            enum { k_NUM_THREADS = 2 };
+
+            bdlcc::FixedQueue<int> mX(100, &ta);
+
+            bsls::AtomicInt  numRemaining(k_NUM_THREADS *
+                                          bulktst::k_NUM_VALUES);
+            bsl::vector<int> counts[k_NUM_THREADS];
+
+            bslmt::ThreadGroup tg;
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                counts[i].resize(k_NUM_THREADS * bulktst::k_NUM_VALUES);
+                tg.addThread(bdlf::BindUtil::bind(&bulktst::bulkPopper,
+                                                  &mX,
+                                                  &numRemaining,
+                                                  &counts[i],
+                                                  static_cast<int>(
+                                                              k_NUM_THREADS)));
+                tg.addThread(bdlf::BindUtil::bind(&bulktst::bulkPusher,
+                                                  &mX,
+                                                  i));
+            }
+            tg.joinAll();
+
+            ASSERT(mX.isEmpty());
+            for (int j = 0; j < k_NUM_THREADS * bulktst::k_NUM_VALUES; ++j) {
+                int count = 0;
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    count += counts[i][j];
+                }
+                LOOP2_ASSERT(j, count, 1 == count);
+            }
+        }
+      } break;
       case 18: {
           // ---------------------------------------------------------
           // Moving tests
@@ -0,0 +1,79 @@
+// bdlcc_multiproducersingleconsumerboundedqueue.cpp                  -*-C++-*-
+
+#include <bdlcc_multiproducersingleconsumerboundedqueue.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_multiproducersingleconsumerboundedqueue_cpp,
+                 "$Id$$CSID$")
+
+namespace BloombergLP {
+
+///Implementation Note
+///===================
+// This component is implemented using a ring buffer of 'd_capacity' nodes,
+// where 'd_capacity' is a power of two, in which every node carries a 64-bit
+// sequence number ('d_sequence').  Producers and the consumer advance 64-bit
+// positions ('d_pushIndex' and 'd_popIndex'); the node for position 'p' is
+// 'd_element_p[p & (d_capacity - 1)]'.  Positions never wrap in practice.
+//
+// The node for position 'p' has the sequence number (ignoring the flags
+// described below):
+//   * 'p' when it is writable by the producer reserving position 'p',
+//   * 'p + 1' when it holds the value pushed at position 'p' (readable), and
+//   * 'p + d_capacity' once that value has been popped, i.e., when it is
+//     writable by the producer reserving position 'p + d_capacity'.
+//
+// Initially, node 'i' has the sequence number 'i'.  A producer reserves
+// position 'p' by observing the writable sequence number 'p' in the node and
+// then advancing 'd_pushIndex' from 'p' to 'p + 1' with a compare-and-swap;
+// constructs the value; and publishes it by setting the sequence number to
+// 'p + 1'.  A node observed with a sequence number less than 'p' still holds
+// (or is still receiving) the value from the previous pass over the ring, so
+// the queue is full.  The single consumer needs no compare-and-swap: it waits
+// for the sequence number 'p + 1' in the node for 'd_popIndex', moves the
+// value out, and sets the sequence number to 'p + d_capacity'.  A capacity of
+// at least 2 keeps the readable and next-pass writable sequence numbers of a
+// node distinct.
+//
+// Two flags are stored in the high-order bits of the sequence number:
+//   * 'k_BLOCKED_FLAG' is set by a thread about to block waiting for the
+//     node, while holding the mutex of the associated condition variable.
+//     The consumer sets it on the writable node it waits to read, and
+//     producers set it on the readable node they wait to write.  The thread
+//     changing the state of the node atomically swaps in the new sequence
+//     number, and only signals the condition variable (after acquiring and
+//     releasing the mutex) when the old value had the flag set.  Hence, the
+//     mutex and condition variable are untouched unless a thread is blocked.
+//   * 'k_RECLAIM_FLAG' is set when publishing a node whose value could not be
+//     constructed (due to an exception).  The consumer skips such nodes.
+//
+// When the queue is empty, the consumer re-checks the node for a number of
+// iterations ('d_popSpinCount'), then yields, and then blocks.  The number of
+// iterations is doubled (up to 'k_MAX_POP_SPIN_COUNT') whenever an element
+// arrives during the spin, and halved (down to 'k_MIN_POP_SPIN_COUNT')
+// whenever the consumer must block anyway.  Producers use a fixed spin count,
+// since many producers spinning on a full queue only add contention.
+//
+// The disabled states are maintained, as in
+// 'bdlcc_singleproducersingleconsumerboundedqueue', with generation counts
+// ('d_popDisabledGeneration' and 'd_pushDisabledGeneration') that are odd
+// while the respective operation is disabled; blocked threads exit when the
+// generation count changes.
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
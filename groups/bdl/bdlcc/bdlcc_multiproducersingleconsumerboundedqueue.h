@@ -0,0 +1,1418 @@
+// bdlcc_multiproducersingleconsumerboundedqueue.h                    -*-C++-*-
+
+#ifndef INCLUDED_BDLCC_MULTIPRODUCERSINGLECONSUMERBOUNDEDQUEUE
+#define INCLUDED_BDLCC_MULTIPRODUCERSINGLECONSUMERBOUNDEDQUEUE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-aware MPSC bounded queue of values.
+//
+//@CLASSES:
+//  bdlcc::MultiProducerSingleConsumerBoundedQueue: MPSCB concurrent queue
+//
+//@SEE_ALSO: bdlcc_singleproducersingleconsumerboundedqueue, bdlcc_fixedqueue
+//
+//@DESCRIPTION: This component defines a type,
+// 'bdlcc::MultiProducerSingleConsumerBoundedQueue', that provides an
+// efficient, thread-aware bounded (capacity fixed at construction) queue of
+// values assuming any number of producers and a single consumer.  The
+// behavior of the methods 'popFront', 'popFrontBulk', 'tryPopFront',
+// 'tryPopFrontBulk', and 'removeAll' is undefined unless the use is by a
+// single consumer (one thread or a group of threads using external
+// synchronization).  This class is ideal for synchronization and
+// communication between threads in a producer-consumer model when a bounded
+// queue is appropriate and many producer threads feed one consumer thread.
+//
+// The queue provides 'pushBack' and 'popFront' methods for pushing data into
+// the queue and popping data from the queue.  When the queue is full, the
+// 'pushBack' methods block until data is removed from the queue.  When the
+// queue is empty, the 'popFront' methods block until data appears in the
+// queue.  Non-blocking methods 'tryPushBack' and 'tryPopFront' are also
+// provided.  The 'tryPushBack' method fails immediately, returning a non-zero
+// value, if the queue is full.  The 'tryPopFront' method fails immediately,
+// returning a non-zero value, if the queue is empty.
+//
+// The consumer may also drain the queue in batches using 'popFrontBulk' and
+// 'tryPopFrontBulk', which remove, in order, all the elements available (up
+// to a specified maximum) into a caller-supplied array and wake blocked
+// producers at most once per batch.
+//
+// The queue may be placed into a "enqueue disabled" state using the
+// 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
+// immediately and return an error code.  Any threads blocked in 'pushBack'
+// when the queue is enqueue disabled return from 'pushBack' immediately and
+// return an error code.  The queue may be restored to normal operation with
+// the 'enablePushBack' method.
+//
+// The queue may be placed into a "dequeue disabled" state using the
+// 'disablePopFront' method.  When dequeue disabled, the "pop" methods fail
+// immediately and return an error code.  If the consumer is blocked in
+// 'popFront' or 'popFrontBulk' when the queue is dequeue disabled, the method
+// returns immediately with an error code.  The queue may be restored to
+// normal operation with the 'enablePopFront' method.
+//
+///Waiting Strategy
+///----------------
+// Neither producers nor the consumer acquire a lock, or signal a condition
+// variable, unless a thread is actually blocked.  A thread that finds the
+// queue full (or, for the consumer, empty) first re-checks the queue in a
+// short spin, then yields once, and only then blocks on a condition variable
+// after marking the element it is waiting on, so that the thread that makes
+// the element available knows to wake it.  The number of spin iterations of
+// the consumer adapts to the observed behavior: it grows while elements tend
+// to arrive during the spin and shrinks while the consumer has to block
+// anyway.
+//
+///Template Requirements
+///---------------------
+// 'bdlcc::MultiProducerSingleConsumerBoundedQueue' is a template that is
+// parameterized on the type of element contained within the queue.  The
+// supplied template argument, 'TYPE', must provide both a default constructor
+// and a copy constructor, as well as an assignment operator.  If the default
+// constructor accepts a 'bslma::Allocator *', 'TYPE' must declare the uses
+// 'bslma::Allocator' trait (see 'bslma_usesbslmaallocator') so that the
+// allocator of the queue is propagated to the elements contained in the queue.
+//
+///Exception safety
+///----------------
+// A 'bdlcc::MultiProducerSingleConsumerBoundedQueue' is exception neutral, and
+// all of the methods of 'bdlcc::MultiProducerSingleConsumerBoundedQueue'
+// provide the basic exception safety guarantee (see 'bsldoc_glossary').  If
+// the copy (or move) of a value into the queue throws, the element reserved
+// for the value is skipped by the consumer.
+//
+///Move Semantics in C++03
+///-----------------------
+// Move-only types are supported by
+// 'bdlcc::MultiProducerSingleConsumerBoundedQueue' on C++11 platforms only
+// (where 'BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES' is defined), and are not
+// supported on C++03 platforms.  Unfortunately, in C++03, there are user types
+// where a 'bslmf::MovableRef' will not safely degrade to a lvalue reference
+// when a move constructor is not available (types providing a constructor
+// template taking any type), so 'bslmf::MovableRefUtil::move' cannot be used
+// directly on a user supplied template type.  See internal bug report 99039150
+// for more information.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Many Feeds, One Aggregator
+///- - - - - - - - - - - - - - - - - - -
+// In the following example a 'bdlcc::MultiProducerSingleConsumerBoundedQueue'
+// is used to communicate between several "feed" threads and a single
+// "aggregator" thread.  Each feed pushes updates onto the queue, and the
+// aggregator drains the queue in batches and applies the updates.
+//
+// First, we define the type of an update, and of the queue:
+//..
+//  struct my_Update {
+//      int d_feedId;    // identifies the producing feed
+//      int d_quantity;  // quantity to accumulate
+//  };
+//
+//  typedef bdlcc::MultiProducerSingleConsumerBoundedQueue<my_Update>
+//                                                              my_UpdateQueue;
+//..
+// Then, we define a 'myFeed' function that pushes a number of updates onto
+// the queue:
+//..
+//  void myFeed(my_UpdateQueue *queue, int id)
+//      // Push 1000 updates from the feed having the specified 'id' onto the
+//      // specified 'queue'.
+//  {
+//      for (int i = 0; i < 1000; ++i) {
+//          my_Update update;
+//          update.d_feedId   = id;
+//          update.d_quantity = 1;
+//
+//          queue->pushBack(update);
+//      }
+//  }
+//..
+// Next, we define a 'myAggregator' function that pops updates off the queue in
+// batches of up to 64.  Note that the call to 'popFrontBulk' blocks until at
+// least one update is available:
+//..
+//  int myAggregator(my_UpdateQueue *queue, int numUpdates)
+//      // Pop the specified 'numUpdates' updates from the specified
+//      // 'queue', and return their accumulated quantity.
+//  {
+//      my_Update updates[64];
+//      int       total = 0;
+//
+//      while (numUpdates) {
+//          bsl::size_t numPopped;
+//
+//          assert(0 == queue->popFrontBulk(updates, 64, &numPopped));
+//
+//          for (bsl::size_t i = 0; i < numPopped; ++i) {
+//              total += updates[i].d_quantity;
+//          }
+//          numUpdates -= static_cast<int>(numPopped);
+//      }
+//      return total;
+//  }
+//..
+// Finally, we create the queue, start four feed threads, and aggregate the
+// updates in the current thread:
+//..
+//  my_UpdateQueue queue(128);
+//
+//  bslmt::ThreadGroup feeds;
+//  for (int i = 0; i < 4; ++i) {
+//      feeds.addThread(bdlf::BindUtil::bind(&myFeed, &queue, i));
+//  }
+//
+//  assert(4000 == myAggregator(&queue, 4000));
+//
+//  feeds.joinAll();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_scalarprimitives.h>
+
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+       // ==============================================================
+       // class MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard
+       // ==============================================================
+
+template <class TYPE, class NODE>
+class MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard {
+    // This class implements a guard that, for the elements removed by a "pop"
+    // operation, invokes 'TYPE::popComplete' on the managed 'NODE' upon
+    // destruction (if one is managed), and wakes the blocked producers of the
+    // queue (once) if any element completed through this guard had a blocked
+    // producer.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    TYPE   *d_queue_p;            // managed queue owning the managed node
+    NODE   *d_node_p;             // managed node, or 0
+    Uint64  d_position;           // position of the managed node
+    bool    d_isProducerBlocked;  // 'true' if a producer must be woken
+
+    // NOT IMPLEMENTED
+    MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard();
+    MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard(
+              const MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard&);
+    MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard& operator=(
+              const MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard&);
+
+  public:
+    // CREATORS
+    explicit
+    MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard(TYPE *queue);
+        // Create a guard for "pop" operations on the specified 'queue' that
+        // does not manage a node.
+
+    ~MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard();
+        // Complete the managed node, if any, wake the blocked producers if
+        // required, and destroy this object.
+
+    // MANIPULATORS
+    void complete();
+        // Destroy the value of the managed node, make the node writable, and
+        // release it from management.
+
+    void manage(NODE *node, Uint64 position);
+        // Manage the specified readable 'node' at the specified 'position'.
+        // The behavior is undefined unless this guard does not currently
+        // manage a node.
+
+    void skip(NODE *node, Uint64 position);
+        // Make the specified 'node', at the specified 'position', that was
+        // marked for reclamation writable without destroying its value.
+};
+
+         // ========================================================
+         // class MultiProducerSingleConsumerBoundedQueue_PushProctor
+         // ========================================================
+
+template <class TYPE, class NODE>
+class MultiProducerSingleConsumerBoundedQueue_PushProctor {
+    // This class implements a proctor that, unless 'release' has been called,
+    // publishes the managed 'NODE' of a 'TYPE' queue marked for reclamation
+    // upon destruction.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    TYPE   *d_queue_p;   // managed queue, or 0 if released
+    NODE   *d_node_p;    // managed node
+    Uint64  d_position;  // position of the managed node
+
+    // NOT IMPLEMENTED
+    MultiProducerSingleConsumerBoundedQueue_PushProctor();
+    MultiProducerSingleConsumerBoundedQueue_PushProctor(
+                   const MultiProducerSingleConsumerBoundedQueue_PushProctor&);
+    MultiProducerSingleConsumerBoundedQueue_PushProctor& operator=(
+                   const MultiProducerSingleConsumerBoundedQueue_PushProctor&);
+
+  public:
+    // CREATORS
+    MultiProducerSingleConsumerBoundedQueue_PushProctor(TYPE   *queue,
+                                                        NODE   *node,
+                                                        Uint64  position);
+        // Create a proctor managing the specified 'node', reserved at the
+        // specified 'position' of the specified 'queue'.
+
+    ~MultiProducerSingleConsumerBoundedQueue_PushProctor();
+        // Destroy this object and, if 'release' has not been invoked, publish
+        // the managed node marked for reclamation.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the node currently managed by this proctor.
+};
+
+               // =============================================
+               // class MultiProducerSingleConsumerBoundedQueue
+               // =============================================
+
+template <class TYPE>
+class MultiProducerSingleConsumerBoundedQueue {
+    // This class provides a thread-safe bounded queue of values supporting
+    // any number of producers and a single consumer.
+
+    // PRIVATE TYPES
+    typedef          unsigned int                                Uint;
+    typedef typename bsls::Types::Uint64                         Uint64;
+    typedef typename bsls::AtomicOperations::AtomicTypes::Uint   AtomicUint;
+    typedef typename bsls::AtomicOperations::AtomicTypes::Uint64 AtomicUint64;
+    typedef typename bsls::AtomicOperations                      AtomicOp;
+
+    // PRIVATE CONSTANTS
+
+    // The following constants are used to interpret the 'd_sequence' of a
+    // 'Node'.  See the implementation note in the '.cpp' file for details.
+
+    static const bsls::Types::Uint64 k_BLOCKED_FLAG  = 0x8000000000000000ULL;
+    static const bsls::Types::Uint64 k_RECLAIM_FLAG  = 0x4000000000000000ULL;
+    static const bsls::Types::Uint64 k_SEQUENCE_MASK = 0x3fffffffffffffffULL;
+
+    enum {
+        k_PUSH_SPIN_COUNT    = 64,    // re-checks of a full queue by a
+                                      // producer before blocking
+
+        k_MIN_POP_SPIN_COUNT = 16,    // bounds of the adaptive number of
+        k_MAX_POP_SPIN_COUNT = 4096   // re-checks of an empty queue by the
+                                      // consumer before blocking
+    };
+
+    template <class DATA>
+    struct QueueNode {
+        // PUBLIC DATA
+        bsls::ObjectBuffer<DATA> d_value;     // stored value
+        AtomicUint64             d_sequence;  // sequence number and flags
+    };
+
+    typedef QueueNode<TYPE> Node;
+
+    typedef MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard<
+                             MultiProducerSingleConsumerBoundedQueue<TYPE>,
+                             Node>                                   PopGuard;
+
+    typedef MultiProducerSingleConsumerBoundedQueue_PushProctor<
+                             MultiProducerSingleConsumerBoundedQueue<TYPE>,
+                             Node>                                PushProctor;
+
+    // DATA
+    AtomicUint64              d_popIndex;        // position of next element
+                                                 // to pop
+
+    int                       d_popSpinCount;    // current number of
+                                                 // re-checks of an empty
+                                                 // queue before the consumer
+                                                 // blocks
+
+    AtomicUint                d_popDisabledGeneration;
+                                                 // generation count of pop
+                                                 // disablements
+
+    const char                d_popPad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                       - sizeof(AtomicUint64)
+                                       - sizeof(int)
+                                       - sizeof(AtomicUint)];
+                                                 // padding to prevent the
+                                                 // producer data from being
+                                                 // in the same cache line as
+                                                 // the consumer data
+
+    AtomicUint64              d_pushIndex;       // position of next element
+                                                 // to reserve for a push
+
+    AtomicUint                d_pushDisabledGeneration;
+                                                 // generation count of push
+                                                 // disablements
+
+    const char                d_pushPad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                        - sizeof(AtomicUint64)
+                                        - sizeof(AtomicUint)];
+                                                 // padding to prevent
+                                                 // subsequent data from being
+                                                 // in the same cache line as
+                                                 // the producer data
+
+    Node                     *d_element_p;       // array of elements that
+                                                 // comprise the bounded queue
+
+    const Uint64              d_capacity;        // capacity of the queue, a
+                                                 // power of two
+
+    bslmt::Mutex              d_popMutex;        // used with 'd_popCondition'
+                                                 // to block the consumer when
+                                                 // the queue is empty
+
+    bslmt::Condition          d_popCondition;    // condition for blocking the
+                                                 // consumer when the queue is
+                                                 // empty
+
+    bslmt::Mutex              d_pushMutex;       // used with 'd_pushCondition'
+                                                 // to block producers when
+                                                 // the queue is full
+
+    bslmt::Condition          d_pushCondition;   // condition for blocking
+                                                 // producers when the queue
+                                                 // is full
+
+    bslma::Allocator         *d_allocator_p;     // allocator, held not owned
+
+    // FRIENDS
+    friend class MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard<
+                MultiProducerSingleConsumerBoundedQueue<TYPE>,
+                typename MultiProducerSingleConsumerBoundedQueue<TYPE>::Node>;
+
+    friend class MultiProducerSingleConsumerBoundedQueue_PushProctor<
+                MultiProducerSingleConsumerBoundedQueue<TYPE>,
+                typename MultiProducerSingleConsumerBoundedQueue<TYPE>::Node>;
+
+    // PRIVATE CLASS METHODS
+    static void incrementUntil(AtomicUint *value, unsigned int bitValue);
+        // If the specified 'value' does not have its lowest-order bit set to
+        // the value of the specified 'bitValue', increment 'value' until it
+        // does.  Note that this method is used to modify the generation counts
+        // stored in 'd_popDisabledGeneration' and 'd_pushDisabledGeneration'.
+
+    // PRIVATE MANIPULATORS
+    bool popComplete(Node *node, Uint64 position, bool destroy);
+        // Destroy the value stored in the specified 'node' if the specified
+        // 'destroy' is 'true', mark the 'node', at the specified 'position',
+        // writable for the next pass over the ring, and advance 'd_popIndex'.
+        // Return 'true' if a producer was blocked waiting for 'node' (and
+        // must be woken), and 'false' otherwise.
+
+    int popFrontImp(TYPE        *values,
+                    bsl::size_t  maxNumValues,
+                    bsl::size_t *numPopped,
+                    bool         isTry);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, load them, in order, into the array starting at the
+        // specified 'values', and load the number of elements removed into the
+        // specified 'numPopped'.  If the specified 'isTry' is 'false' and the
+        // queue is empty, block until it is not empty.  Return 0 on success,
+        // and a non-zero value otherwise.  Specifically, return 'e_SUCCESS' on
+        // success, 'e_DISABLED' if 'isPopFrontDisabled()', 'e_EMPTY' if
+        // 'true == isTry', '!isPopFrontDisabled()', and the queue is empty,
+        // and 'e_FAILED' if an underlying mechanism returns an error.
+
+    void pushComplete(Node *node, Uint64 position, bool reclaim);
+        // Mark the specified 'node', reserved at the specified 'position',
+        // readable (and, if the specified 'reclaim' is 'true', marked for
+        // reclamation), and wake the consumer if it is blocked waiting for
+        // 'node'.
+
+    int reservePushNode(Node **node, Uint64 *position, bool isTry);
+        // Reserve the next writable node of this queue and load its address
+        // into the specified 'node' and its position into the specified
+        // 'position'.  If the specified 'isTry' is 'false' and the queue is
+        // full, block until it is not full.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_SUCCESS' on
+        // success, 'e_DISABLED' if 'isPushBackDisabled()', 'e_FULL' if
+        // 'true == isTry', '!isPushBackDisabled()', and the queue is full, and
+        // 'e_FAILED' if an underlying mechanism returns an error.
+
+    void wakeProducers();
+        // Wake all the producers blocked waiting for the queue to not be full.
+
+    // NOT IMPLEMENTED
+    MultiProducerSingleConsumerBoundedQueue(
+                               const MultiProducerSingleConsumerBoundedQueue&);
+    MultiProducerSingleConsumerBoundedQueue& operator=(
+                               const MultiProducerSingleConsumerBoundedQueue&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MultiProducerSingleConsumerBoundedQueue,
+                                   bslma::UsesBslmaAllocator);
+
+    // PUBLIC TYPES
+    typedef TYPE value_type;  // The type for elements.
+
+    // PUBLIC CONSTANTS
+    enum {
+        e_SUCCESS  =  0,
+        e_EMPTY    = -1,
+        e_FULL     = -2,
+        e_DISABLED = -3,
+        e_FAILED   = -4
+    };
+
+    // CREATORS
+    explicit
+    MultiProducerSingleConsumerBoundedQueue(
+                                         bsl::size_t       capacity,
+                                         bslma::Allocator *basicAllocator = 0);
+        // Create a thread-aware queue with, at least, the specified
+        // 'capacity'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  Note that the capacity is rounded up to a power
+        // of two not less than 2.
+
+    ~MultiProducerSingleConsumerBoundedQueue();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int popFront(TYPE *value);
+        // Remove the element from the front of this queue and load that
+        // element into the specified 'value'.  If the queue is empty, block
+        // until it is not empty.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_SUCCESS' on success,
+        // 'e_DISABLED' if 'isPopFrontDisabled()' and 'e_FAILED' if an
+        // underlying mechanism returns an error.  On failure, 'value' is not
+        // changed.  The consumer blocked due to the queue being empty will
+        // return 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior
+        // is undefined unless the invoker of this method is the single
+        // consumer.
+
+    int popFrontBulk(TYPE        *values,
+                     bsl::size_t  maxNumValues,
+                     bsl::size_t *numPopped);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, load them, in order, into the array starting at the
+        // specified 'values', and load the number of elements removed into the
+        // specified 'numPopped'.  If the queue is empty, block until it is not
+        // empty.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_SUCCESS' on success, 'e_DISABLED' if
+        // 'isPopFrontDisabled()' and 'e_FAILED' if an underlying mechanism
+        // returns an error.  On failure, 'values' and 'numPopped' are not
+        // changed.  The behavior is undefined unless the invoker of this
+        // method is the single consumer, '0 < maxNumValues', and 'values'
+        // refers to an array of at least 'maxNumValues' elements.  Note that
+        // all the elements available (up to 'maxNumValues') are removed, and
+        // that at least one element is removed on success.
+
+    int pushBack(const TYPE& value);
+        // Append the specified 'value' to the back of this queue.  If the
+        // queue is full, block until it is not full.  Return 0 on success, and
+        // a non-zero value otherwise.  Specifically, return 'e_SUCCESS' on
+        // success, 'e_DISABLED' if 'isPushBackDisabled()' and 'e_FAILED' if an
+        // underlying mechanism returns an error.  Threads blocked due to the
+        // queue being full will return 'e_DISABLED' if 'disablePushBack' is
+        // invoked.
+
+    int pushBack(bslmf::MovableRef<TYPE> value);
+        // Append the specified move-insertable 'value' to the back of this
+        // queue.  If the queue is full, block until it is not full.  'value'
+        // is left in a valid but unspecified state.  Return 0 on success, and
+        // a non-zero value otherwise.  Specifically, return 'e_SUCCESS' on
+        // success, 'e_DISABLED' if 'isPushBackDisabled()' and 'e_FAILED' if an
+        // underlying mechanism returns an error.  On failure, 'value' is not
+        // changed.  Threads blocked due to the queue being full will return
+        // 'e_DISABLED' if 'disablePushBack' is invoked.
+
+    void removeAll();
+        // Remove all items currently in this queue.  Note that this operation
+        // is not atomic; if other threads are concurrently pushing items into
+        // the queue the result of 'numElements()' after this function returns
+        // is not guaranteed to be 0.  The behavior is undefined unless the
+        // invoker of this method is the single consumer.
+
+    int tryPopFront(TYPE *value);
+        // Attempt to remove the element from the front of this queue without
+        // blocking, and, if successful, load the specified 'value' with the
+        // removed element.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_SUCCESS' on success,
+        // 'e_DISABLED' if 'isPopFrontDisabled()', and 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty.  On failure,
+        // 'value' is not changed.  The behavior is undefined unless the
+        // invoker of this method is the single consumer.
+
+    int tryPopFrontBulk(TYPE        *values,
+                        bsl::size_t  maxNumValues,
+                        bsl::size_t *numPopped);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, and, if successful, load
+        // the removed elements, in order, into the array starting at the
+        // specified 'values' and the number of elements removed into the
+        // specified 'numPopped'.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_SUCCESS' if at least one element
+        // was removed, 'e_DISABLED' if 'isPopFrontDisabled()', and 'e_EMPTY'
+        // if '!isPopFrontDisabled()' and the queue was empty.  On failure,
+        // 'values' and 'numPopped' are not changed.  The behavior is undefined
+        // unless the invoker of this method is the single consumer,
+        // '0 < maxNumValues', and 'values' refers to an array of at least
+        // 'maxNumValues' elements.
+
+    int tryPushBack(const TYPE& value);
+        // Append the specified 'value' to the back of this queue.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPushBackDisabled()', and
+        // 'e_FULL' if '!isPushBackDisabled()' and the queue was full.
+
+    int tryPushBack(bslmf::MovableRef<TYPE> value);
+        // Append the specified move-insertable 'value' to the back of this
+        // queue.  'value' is left in a valid but unspecified state.  Return 0
+        // on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPushBackDisabled()', and
+        // 'e_FULL' if '!isPushBackDisabled()' and the queue was full.  On
+        // failure, 'value' is not changed.
+
+                       // Enqueue/Dequeue State
+
+    void disablePopFront();
+        // Disable dequeueing from this queue.  All subsequent invocations of
+        // the "pop" methods will fail immediately.  If the single consumer is
+        // blocked in 'popFront' or 'popFrontBulk', the invocation will fail
+        // immediately.  If the queue is already dequeue disabled, this method
+        // has no effect.
+
+    void disablePushBack();
+        // Disable enqueueing into this queue.  All subsequent invocations of
+        // 'pushBack' or 'tryPushBack' will fail immediately.  All blocked
+        // invocations of 'pushBack' will fail immediately.  If the queue is
+        // already enqueue disabled, this method has no effect.
+
+    void enablePopFront();
+        // Enable dequeueing.  If the queue is not dequeue disabled, this call
+        // has no effect.
+
+    void enablePushBack();
+        // Enable queuing.  If the queue is not enqueue disabled, this call has
+        // no effect.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the maximum number of elements that may be stored in this
+        // queue.
+
+    bool isEmpty() const;
+        // Return 'true' if this queue is empty (has no elements), or 'false'
+        // otherwise.
+
+    bool isFull() const;
+        // Return 'true' if this queue is full (has no available capacity), or
+        // 'false' otherwise.
+
+    bool isPopFrontDisabled() const;
+        // Return 'true' if this queue is dequeue disabled, and 'false'
+        // otherwise.  Note that the queue is created in the "dequeue enabled"
+        // state.
+
+    bool isPushBackDisabled() const;
+        // Return 'true' if this queue is enqueue disabled, and 'false'
+        // otherwise.  Note that the queue is created in the "enqueue enabled"
+        // state.
+
+    bsl::size_t numElements() const;
+        // Returns the number of elements currently in this queue.  Note that
+        // elements whose "push" operation is in progress are included.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+       // --------------------------------------------------------------
+       // class MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard
+       // --------------------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+inline
+MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard<TYPE, NODE>
+      ::MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard(TYPE *queue)
+: d_queue_p(queue)
+, d_node_p(0)
+, d_position(0)
+, d_isProducerBlocked(false)
+{
+}
+
+template <class TYPE, class NODE>
+inline
+MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard<TYPE, NODE>
+                  ::~MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard()
+{
+    if (d_node_p) {
+        complete();
+    }
+    if (d_isProducerBlocked) {
+        d_queue_p->wakeProducers();
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+inline
+void MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard<TYPE, NODE>
+                                                                  ::complete()
+{
+    BSLS_ASSERT(d_node_p);
+
+    if (d_queue_p->popComplete(d_node_p, d_position, true)) {
+        d_isProducerBlocked = true;
+    }
+    d_node_p = 0;
+}
+
+template <class TYPE, class NODE>
+inline
+void MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard<TYPE, NODE>
+                                          ::manage(NODE *node, Uint64 position)
+{
+    BSLS_ASSERT(0 == d_node_p);
+
+    d_node_p   = node;
+    d_position = position;
+}
+
+template <class TYPE, class NODE>
+inline
+void MultiProducerSingleConsumerBoundedQueue_PopCompleteGuard<TYPE, NODE>
+                                            ::skip(NODE *node, Uint64 position)
+{
+    if (d_queue_p->popComplete(node, position, false)) {
+        d_isProducerBlocked = true;
+    }
+}
+
+         // --------------------------------------------------------
+         // class MultiProducerSingleConsumerBoundedQueue_PushProctor
+         // --------------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+inline
+MultiProducerSingleConsumerBoundedQueue_PushProctor<TYPE, NODE>
+                         ::MultiProducerSingleConsumerBoundedQueue_PushProctor(
+                                                              TYPE   *queue,
+                                                              NODE   *node,
+                                                              Uint64  position)
+: d_queue_p(queue)
+, d_node_p(node)
+, d_position(position)
+{
+}
+
+template <class TYPE, class NODE>
+inline
+MultiProducerSingleConsumerBoundedQueue_PushProctor<TYPE, NODE>
+                       ::~MultiProducerSingleConsumerBoundedQueue_PushProctor()
+{
+    if (d_queue_p) {
+        d_queue_p->pushComplete(d_node_p, d_position, true);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+inline
+void MultiProducerSingleConsumerBoundedQueue_PushProctor<TYPE, NODE>::release()
+{
+    d_queue_p = 0;
+}
+
+               // ---------------------------------------------
+               // class MultiProducerSingleConsumerBoundedQueue
+               // ---------------------------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+void MultiProducerSingleConsumerBoundedQueue<TYPE>
+                     ::incrementUntil(AtomicUint *value, unsigned int bitValue)
+{
+    unsigned int state = AtomicOp::getUintAcquire(value);
+    if (bitValue != (state & 1)) {
+        unsigned int expState;
+        do {
+            expState = state;
+            state = AtomicOp::testAndSwapUintAcqRel(value,
+                                                     state,
+                                                     state + 1);
+        } while (state != expState && (bitValue == (state & 1)));
+    }
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+bool MultiProducerSingleConsumerBoundedQueue<TYPE>::popComplete(
+                                                           Node   *node,
+                                                           Uint64  position,
+                                                           bool    destroy)
+{
+    if (destroy) {
+        node->d_value.object().~TYPE();
+    }
+
+    // The node becomes writable by the producer reserving 'position' on the
+    // next pass over the ring.
+
+    Uint64 sequence = AtomicOp::swapUint64AcqRel(&node->d_sequence,
+                                                 position + d_capacity);
+
+    AtomicOp::setUint64Release(&d_popIndex, position + 1);
+
+    return 0 != (sequence & k_BLOCKED_FLAG);
+}
+
+template <class TYPE>
+int MultiProducerSingleConsumerBoundedQueue<TYPE>::popFrontImp(
+                                                     TYPE        *values,
+                                                     bsl::size_t  maxNumValues,
+                                                     bsl::size_t *numPopped,
+                                                     bool         isTry)
+{
+    const Uint disabledGen =
+                            AtomicOp::getUintAcquire(&d_popDisabledGeneration);
+
+    if (disabledGen & 1) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    Uint64      position = AtomicOp::getUint64Acquire(&d_popIndex);
+    bsl::size_t count    = 0;
+    PopGuard    guard(this);
+
+    while (count < maxNumValues) {
+        Node   *node     = &d_element_p[position & (d_capacity - 1)];
+        Uint64  sequence = AtomicOp::getUint64Acquire(&node->d_sequence);
+
+        if ((sequence & k_SEQUENCE_MASK) == position + 1) {
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                               sequence & k_RECLAIM_FLAG)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+                // The "push" into this node failed due to an exception.
+
+                guard.skip(node, position);
+                ++position;
+                continue;                                           // CONTINUE
+            }
+
+            guard.manage(node, position);
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+            values[count] =
+                         bslmf::MovableRefUtil::move(node->d_value.object());
+#else
+            values[count] = node->d_value.object();
+#endif
+
+            guard.complete();
+            ++position;
+            ++count;
+            continue;                                               // CONTINUE
+        }
+
+        // The node is not readable.  If elements were removed, the batch is
+        // complete.  Otherwise, if this is a "try" invocation, return; if not,
+        // spin, yield, and then block until the node is readable.
+
+        if (count) {
+            break;
+        }
+
+        if (isTry) {
+            return e_EMPTY;                                           // RETURN
+        }
+
+        bool isReadable = false;
+        for (int i = 0; i < d_popSpinCount && !isReadable; ++i) {
+            isReadable = (AtomicOp::getUint64Acquire(&node->d_sequence)
+                                        & k_SEQUENCE_MASK) == position + 1;
+        }
+        if (isReadable) {
+            if (d_popSpinCount < k_MAX_POP_SPIN_COUNT) {
+                d_popSpinCount *= 2;
+            }
+            continue;                                               // CONTINUE
+        }
+
+        bslmt::ThreadUtil::yield();
+
+        sequence = AtomicOp::getUint64Acquire(&node->d_sequence);
+        if ((sequence & k_SEQUENCE_MASK) == position + 1) {
+            continue;                                               // CONTINUE
+        }
+
+        if (d_popSpinCount > k_MIN_POP_SPIN_COUNT) {
+            d_popSpinCount /= 2;
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_popMutex);
+
+        // Mark the node so that the producer publishing it wakes the
+        // consumer.  Only the consumer marks a writable node, so the node is
+        // either unchanged (and marked) or has become readable.
+
+        sequence = AtomicOp::testAndSwapUint64AcqRel(
+                                                   &node->d_sequence,
+                                                   position,
+                                                   position | k_BLOCKED_FLAG);
+
+        while (   (position == sequence
+                   || (position | k_BLOCKED_FLAG) == sequence)
+               && disabledGen ==
+                          AtomicOp::getUintAcquire(&d_popDisabledGeneration)) {
+            int rv = d_popCondition.wait(&d_popMutex);
+            if (rv) {
+                AtomicOp::testAndSwapUint64AcqRel(&node->d_sequence,
+                                                  position | k_BLOCKED_FLAG,
+                                                  position);
+                return e_FAILED;                                      // RETURN
+            }
+            sequence = AtomicOp::getUint64Acquire(&node->d_sequence);
+        }
+
+        // The following checks for disablement being the cause of exiting
+        // the 'while' loop.
+
+        if (   position == sequence
+            || (position | k_BLOCKED_FLAG) == sequence) {
+            AtomicOp::testAndSwapUint64AcqRel(&node->d_sequence,
+                                              position | k_BLOCKED_FLAG,
+                                              position);
+            return e_DISABLED;                                        // RETURN
+        }
+    }
+
+    *numPopped = count;
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+inline
+void MultiProducerSingleConsumerBoundedQueue<TYPE>::pushComplete(
+                                                           Node   *node,
+                                                           Uint64  position,
+                                                           bool    reclaim)
+{
+    Uint64 sequence = position + 1;
+    if (reclaim) {
+        sequence |= k_RECLAIM_FLAG;
+    }
+
+    sequence = AtomicOp::swapUint64AcqRel(&node->d_sequence, sequence);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(sequence & k_BLOCKED_FLAG)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The consumer is blocked waiting for this node.
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_popMutex);
+        }
+        d_popCondition.signal();
+    }
+}
+
+template <class TYPE>
+int MultiProducerSingleConsumerBoundedQueue<TYPE>::reservePushNode(
+                                                       Node   **node,
+                                                       Uint64  *position,
+                                                       bool     isTry)
+{
+    const Uint disabledGen =
+                           AtomicOp::getUintAcquire(&d_pushDisabledGeneration);
+
+    if (disabledGen & 1) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    Uint64 pos  = AtomicOp::getUint64Acquire(&d_pushIndex);
+    int    spin = 0;
+
+    while (1) {
+        Node   *n        = &d_element_p[pos & (d_capacity - 1)];
+        Uint64  sequence = AtomicOp::getUint64Acquire(&n->d_sequence)
+                                                             & k_SEQUENCE_MASK;
+
+        if (sequence == pos) {
+            // The node is writable; attempt to reserve it.
+
+            Uint64 prev = AtomicOp::testAndSwapUint64AcqRel(&d_pushIndex,
+                                                            pos,
+                                                            pos + 1);
+            if (prev == pos) {
+                *node     = n;
+                *position = pos;
+                return e_SUCCESS;                                     // RETURN
+            }
+            pos = prev;
+            continue;                                               // CONTINUE
+        }
+
+        if (sequence > pos) {
+            // Another producer reserved the node.
+
+            pos = AtomicOp::getUint64Acquire(&d_pushIndex);
+            continue;                                               // CONTINUE
+        }
+
+        // The node still holds the element pushed on the previous pass over
+        // the ring (or that element is still being pushed): the queue is full.
+
+        if (isTry) {
+            return e_FULL;                                            // RETURN
+        }
+
+        if (spin < k_PUSH_SPIN_COUNT) {
+            ++spin;
+            pos = AtomicOp::getUint64Acquire(&d_pushIndex);
+            continue;                                               // CONTINUE
+        }
+
+        if (k_PUSH_SPIN_COUNT == spin) {
+            ++spin;
+            bslmt::ThreadUtil::yield();
+            pos = AtomicOp::getUint64Acquire(&d_pushIndex);
+            continue;                                               // CONTINUE
+        }
+
+        if (sequence + d_capacity != pos + 1) {
+            // The node is being written by a producer from the previous pass
+            // over the ring; it can not be marked, so yield and check again.
+
+            bslmt::ThreadUtil::yield();
+            pos = AtomicOp::getUint64Acquire(&d_pushIndex);
+            continue;                                               // CONTINUE
+        }
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_pushMutex);
+
+            // Mark the readable node so that the consumer wakes the producers
+            // when the node is popped.
+
+            Uint64 state = AtomicOp::getUint64Acquire(&n->d_sequence);
+
+            while (   (state & k_SEQUENCE_MASK) == sequence
+                   && disabledGen ==
+                         AtomicOp::getUintAcquire(&d_pushDisabledGeneration)) {
+                if (0 == (state & k_BLOCKED_FLAG)) {
+                    Uint64 prev = AtomicOp::testAndSwapUint64AcqRel(
+                                                       &n->d_sequence,
+                                                       state,
+                                                       state | k_BLOCKED_FLAG);
+                    if (prev != state) {
+                        state = prev;
+                        continue;                                   // CONTINUE
+                    }
+                }
+
+                int rv = d_pushCondition.wait(&d_pushMutex);
+                if (rv) {
+                    return e_FAILED;                                  // RETURN
+                }
+                state = AtomicOp::getUint64Acquire(&n->d_sequence);
+            }
+
+            if (disabledGen !=
+                         AtomicOp::getUintAcquire(&d_pushDisabledGeneration)) {
+                return e_DISABLED;                                    // RETURN
+            }
+        }
+
+        spin = 0;
+        pos  = AtomicOp::getUint64Acquire(&d_pushIndex);
+    }
+}
+
+template <class TYPE>
+void MultiProducerSingleConsumerBoundedQueue<TYPE>::wakeProducers()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_pushMutex);
+    }
+    d_pushCondition.broadcast();
+}
+
+// CREATORS
+template <class TYPE>
+MultiProducerSingleConsumerBoundedQueue<TYPE>::
+     MultiProducerSingleConsumerBoundedQueue(bsl::size_t       capacity,
+                                             bslma::Allocator *basicAllocator)
+: d_popSpinCount(k_MIN_POP_SPIN_COUNT)
+, d_popPad()
+, d_pushPad()
+, d_element_p(0)
+, d_capacity(bdlb::BitUtil::roundUpToBinaryPower(
+                                  static_cast<bsl::uint64_t>(capacity > 2
+                                                             ? capacity
+                                                             : 2)))
+, d_popMutex()
+, d_popCondition()
+, d_pushMutex()
+, d_pushCondition()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    AtomicOp::initUint64(&d_popIndex,  0);
+    AtomicOp::initUint64(&d_pushIndex, 0);
+
+    AtomicOp::initUint(&d_popDisabledGeneration,  0);
+    AtomicOp::initUint(&d_pushDisabledGeneration, 0);
+
+    d_element_p = static_cast<Node *>(
+                           d_allocator_p->allocate(d_capacity * sizeof(Node)));
+
+    for (Uint64 i = 0; i < d_capacity; ++i) {
+        AtomicOp::initUint64(&d_element_p[i].d_sequence, i);
+    }
+}
+
+template <class TYPE>
+MultiProducerSingleConsumerBoundedQueue<TYPE>
+                                   ::~MultiProducerSingleConsumerBoundedQueue()
+{
+    if (d_element_p) {
+        removeAll();
+        d_allocator_p->deallocate(d_element_p);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int MultiProducerSingleConsumerBoundedQueue<TYPE>::popFront(TYPE *value)
+{
+    bsl::size_t numPopped;
+
+    return popFrontImp(value, 1, &numPopped, false);
+}
+
+template <class TYPE>
+inline
+int MultiProducerSingleConsumerBoundedQueue<TYPE>::popFrontBulk(
+                                                     TYPE        *values,
+                                                     bsl::size_t  maxNumValues,
+                                                     bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    return popFrontImp(values, maxNumValues, numPopped, false);
+}
+
+template <class TYPE>
+int MultiProducerSingleConsumerBoundedQueue<TYPE>::pushBack(const TYPE& value)
+{
+    Node   *node;
+    Uint64  position;
+
+    int rv = reservePushNode(&node, &position, false);
+    if (rv) {
+        return rv;                                                    // RETURN
+    }
+
+    PushProctor proctor(this, node, position);
+
+    bslalg::ScalarPrimitives::copyConstruct(node->d_value.address(),
+                                            value,
+                                            d_allocator_p);
+
+    proctor.release();
+
+    pushComplete(node, position, false);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int MultiProducerSingleConsumerBoundedQueue<TYPE>::pushBack(
+                                                 bslmf::MovableRef<TYPE> value)
+{
+    Node   *node;
+    Uint64  position;
+
+    int rv = reservePushNode(&node, &position, false);
+    if (rv) {
+        return rv;                                                    // RETURN
+    }
+
+    PushProctor proctor(this, node, position);
+
+    TYPE& dummy = value;
+    bslalg::ScalarPrimitives::moveConstruct(node->d_value.address(),
+                                            dummy,
+                                            d_allocator_p);
+
+    proctor.release();
+
+    pushComplete(node, position, false);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+void MultiProducerSingleConsumerBoundedQueue<TYPE>::removeAll()
+{
+    Uint64   position = AtomicOp::getUint64Acquire(&d_popIndex);
+    PopGuard guard(this);
+
+    while (1) {
+        Node   *node     = &d_element_p[position & (d_capacity - 1)];
+        Uint64  sequence = AtomicOp::getUint64Acquire(&node->d_sequence);
+
+        if ((sequence & k_SEQUENCE_MASK) != position + 1) {
+            break;
+        }
+
+        if (sequence & k_RECLAIM_FLAG) {
+            guard.skip(node, position);
+        }
+        else {
+            guard.manage(node, position);
+            guard.complete();
+        }
+        ++position;
+    }
+}
+
+template <class TYPE>
+inline
+int MultiProducerSingleConsumerBoundedQueue<TYPE>::tryPopFront(TYPE *value)
+{
+    bsl::size_t numPopped;
+
+    return popFrontImp(value, 1, &numPopped, true);
+}
+
+template <class TYPE>
+inline
+int MultiProducerSingleConsumerBoundedQueue<TYPE>::tryPopFrontBulk(
+                                                     TYPE        *values,
+                                                     bsl::size_t  maxNumValues,
+                                                     bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    return popFrontImp(values, maxNumValues, numPopped, true);
+}
+
+template <class TYPE>
+int MultiProducerSingleConsumerBoundedQueue<TYPE>::tryPushBack(
+                                                             const TYPE& value)
+{
+    Node   *node;
+    Uint64  position;
+
+    int rv = reservePushNode(&node, &position, true);
+    if (rv) {
+        return rv;                                                    // RETURN
+    }
+
+    PushProctor proctor(this, node, position);
+
+    bslalg::ScalarPrimitives::copyConstruct(node->d_value.address(),
+                                            value,
+                                            d_allocator_p);
+
+    proctor.release();
+
+    pushComplete(node, position, false);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int MultiProducerSingleConsumerBoundedQueue<TYPE>::tryPushBack(
+                                                 bslmf::MovableRef<TYPE> value)
+{
+    Node   *node;
+    Uint64  position;
+
+    int rv = reservePushNode(&node, &position, true);
+    if (rv) {
+        return rv;                                                    // RETURN
+    }
+
+    PushProctor proctor(this, node, position);
+
+    TYPE& dummy = value;
+    bslalg::ScalarPrimitives::moveConstruct(node->d_value.address(),
+                                            dummy,
+                                            d_allocator_p);
+
+    proctor.release();
+
+    pushComplete(node, position, false);
+
+    return e_SUCCESS;
+}
+
+                       // Enqueue/Dequeue State
+
+template <class TYPE>
+inline
+void MultiProducerSingleConsumerBoundedQueue<TYPE>::disablePopFront()
+{
+    incrementUntil(&d_popDisabledGeneration, 1);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_popMutex);
+    }
+    d_popCondition.broadcast();
+}
+
+template <class TYPE>
+inline
+void MultiProducerSingleConsumerBoundedQueue<TYPE>::disablePushBack()
+{
+    incrementUntil(&d_pushDisabledGeneration, 1);
+
+    wakeProducers();
+}
+
+template <class TYPE>
+inline
+void MultiProducerSingleConsumerBoundedQueue<TYPE>::enablePopFront()
+{
+    incrementUntil(&d_popDisabledGeneration, 0);
+}
+
+template <class TYPE>
+inline
+void MultiProducerSingleConsumerBoundedQueue<TYPE>::enablePushBack()
+{
+    incrementUntil(&d_pushDisabledGeneration, 0);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bsl::size_t MultiProducerSingleConsumerBoundedQueue<TYPE>::capacity() const
+{
+    return static_cast<bsl::size_t>(d_capacity);
+}
+
+template <class TYPE>
+inline
+bool MultiProducerSingleConsumerBoundedQueue<TYPE>::isEmpty() const
+{
+    Uint64 position = AtomicOp::getUint64Acquire(&d_popIndex);
+    Node&  node     = d_element_p[position & (d_capacity - 1)];
+
+    return (AtomicOp::getUint64Acquire(&node.d_sequence) & k_SEQUENCE_MASK)
+                                                             != position + 1;
+}
+
+template <class TYPE>
+inline
+bool MultiProducerSingleConsumerBoundedQueue<TYPE>::isFull() const
+{
+    Uint64 position = AtomicOp::getUint64Acquire(&d_pushIndex);
+    Node&  node     = d_element_p[position & (d_capacity - 1)];
+
+    return (AtomicOp::getUint64Acquire(&node.d_sequence) & k_SEQUENCE_MASK)
+                                                                  < position;
+}
+
+template <class TYPE>
+inline
+bool MultiProducerSingleConsumerBoundedQueue<TYPE>::isPopFrontDisabled() const
+{
+    return 1 == (AtomicOp::getUintAcquire(&d_popDisabledGeneration) & 1);
+}
+
+template <class TYPE>
+inline
+bool MultiProducerSingleConsumerBoundedQueue<TYPE>::isPushBackDisabled() const
+{
+    return 1 == (AtomicOp::getUintAcquire(&d_pushDisabledGeneration) & 1);
+}
+
+template <class TYPE>
+inline
+bsl::size_t MultiProducerSingleConsumerBoundedQueue<TYPE>::numElements() const
+{
+    // 'd_popIndex' is loaded first, so that it does not exceed the subsequent
+    // value loaded from 'd_pushIndex'.
+
+    Uint64 popIndex  = AtomicOp::getUint64Acquire(&d_popIndex);
+    Uint64 pushIndex = AtomicOp::getUint64Acquire(&d_pushIndex);
+    Uint64 count     = pushIndex - popIndex;
+
+    return static_cast<bsl::size_t>(count < d_capacity ? count : d_capacity);
+}
+
+                                  // Aspects
+
+template <class TYPE>
+inline
+bslma::Allocator *MultiProducerSingleConsumerBoundedQueue<TYPE>::allocator()
+                                                                          const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1286 @@
+// bdlcc_multiproducersingleconsumerboundedqueue.t.cpp                -*-C++-*-
+
+#include <bdlcc_multiproducersingleconsumerboundedqueue.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a concurrent FIFO queue container
+// supporting multiple producers and a single consumer with bounded capacity.
+// The primary manipulators are the methods for adding elements ('pushBack')
+// and emptying the queue ('removeAll').  The provided basic accessors are the
+// methods for obtaining the allocator ('allocator') and the number of elements
+// in the queue ('numElements').  The manipulator 'popFront' will be used
+// extensively to verify the value of resultant queues.  The basic
+// functionality of the queue will be verified initially with a single thread
+// of execution, and then concurrency concerns will be addressed.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+//: o Precondition violations are detected in appropriate build modes.
+// ----------------------------------------------------------------------------
+// [ 2] MultiProducerSingleConsumerBoundedQueue(capacity, bA = 0);
+// [ 2] ~MultiProducerSingleConsumerBoundedQueue();
+// [ 2] int popFront(TYPE *value);
+// [ 4] int popFrontBulk(TYPE *values, size_t max, size_t *n);
+// [ 2] int pushBack(const TYPE& value);
+// [ 6] int pushBack(bslmf::MovableRef<TYPE> value);
+// [ 2] void removeAll();
+// [ 3] int tryPopFront(TYPE *value);
+// [ 4] int tryPopFrontBulk(TYPE *values, size_t max, size_t *n);
+// [ 3] int tryPushBack(const TYPE& value);
+// [ 6] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [ 5] void disablePopFront();
+// [ 5] void disablePushBack();
+// [ 5] void enablePopFront();
+// [ 5] void enablePushBack();
+// [ 2] bsl::size_t capacity() const;
+// [ 3] bool isEmpty() const;
+// [ 3] bool isFull() const;
+// [ 5] bool isPopFrontDisabled() const;
+// [ 5] bool isPushBackDisabled() const;
+// [ 3] bsl::size_t numElements() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [10] USAGE EXAMPLE
+// [ 2] CONCERN: 0 == e_SUCCESS
+// [ 7] CONCERN: exception while pushing
+// [ 8] CONCERN: blocked threads are woken
+// [ 9] CONCERN: ordering guarantee with many producers
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+// ============================================================================
+//                   GLOBAL STRUCTS/FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+                                // ==========
+                                // MoveTester
+                                // ==========
+
+class MoveTester {
+    // DATA
+    bool d_moved;
+    int  d_value;
+
+    // NOT IMPLEMENTED
+    MoveTester(const MoveTester& other);
+    MoveTester& operator=(const MoveTester& other);
+
+  public:
+    // CREATORS
+    explicit MoveTester(int value = 0)
+        // Create a 'MoveTester' object having the optionally specified
+        // 'value'.
+    : d_moved(false)
+    , d_value(value)
+    {
+    }
+
+    explicit MoveTester(bslmf::MovableRef<MoveTester> other)
+        // Move-construct a 'MoveTester' object from the specified 'other'.
+    : d_moved(false)
+    , d_value(bslmf::MovableRefUtil::access(other).d_value)
+    {
+        bslmf::MovableRefUtil::access(other).d_moved = true;
+    }
+
+    // MANIPULATORS
+    MoveTester& operator=(bslmf::MovableRef<MoveTester> other)
+        // Move-assign the value of the specified 'other' object to this one.
+    {
+        d_moved = false;
+        d_value = bslmf::MovableRefUtil::access(other).d_value;
+        bslmf::MovableRefUtil::access(other).d_moved = true;
+        return *this;
+    }
+
+    // ACCESSORS
+    bool isMoved() const
+        // Return 'true' if this object was moved from, and 'false' otherwise.
+    {
+        return d_moved;
+    }
+
+    int value() const
+        // Return the value of this object.
+    {
+        return d_value;
+    }
+};
+
+                           // ===================
+                           // ThrowOnCopyTestType
+                           // ===================
+
+class ThrowOnCopyTestType {
+    // This class throws an 'int' when copy constructed from an object having
+    // a negative value.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CREATORS
+    explicit ThrowOnCopyTestType(int value = 0)
+        // Create a 'ThrowOnCopyTestType' object having the optionally
+        // specified 'value'.
+    : d_value(value)
+    {
+    }
+
+    ThrowOnCopyTestType(const ThrowOnCopyTestType& original)
+        // Create a 'ThrowOnCopyTestType' object having the value of the
+        // specified 'original' object, or throw if that value is negative.
+    : d_value(original.d_value)
+    {
+        if (0 > d_value) {
+            BSLS_THROW(d_value);
+        }
+    }
+
+    // MANIPULATORS
+    ThrowOnCopyTestType& operator=(const ThrowOnCopyTestType& rhs)
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+    {
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+        // Return the value of this object.
+    {
+        return d_value;
+    }
+};
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::MultiProducerSingleConsumerBoundedQueue<int>          Obj;
+
+typedef bdlcc::MultiProducerSingleConsumerBoundedQueue<bsl::string>  AllocObj;
+
+const int e_SUCCESS  = Obj::e_SUCCESS;
+const int e_EMPTY    = Obj::e_EMPTY;
+const int e_FULL     = Obj::e_FULL;
+const int e_DISABLED = Obj::e_DISABLED;
+
+// ============================================================================
+//                   GLOBAL METHODS FOR TESTING
+// ----------------------------------------------------------------------------
+
+void deferredDisablePopFront(Obj *queue)
+    // Sleep briefly and then disable popping from the specified 'queue'.
+{
+    bslmt::ThreadUtil::microSleep(50000);
+
+    queue->disablePopFront();
+}
+
+void deferredDisablePushBack(Obj *queue)
+    // Sleep briefly and then disable pushing to the specified 'queue'.
+{
+    bslmt::ThreadUtil::microSleep(50000);
+
+    queue->disablePushBack();
+}
+
+void deferredPopFront(Obj *queue, int *value)
+    // Sleep briefly and then pop an element from the specified 'queue' into
+    // the specified 'value'.
+{
+    bslmt::ThreadUtil::microSleep(50000);
+
+    ASSERT(e_SUCCESS == queue->popFront(value));
+}
+
+void deferredPushBack(Obj *queue, int value)
+    // Sleep briefly and then push the specified 'value' onto the specified
+    // 'queue'.
+{
+    bslmt::ThreadUtil::microSleep(50000);
+
+    ASSERT(e_SUCCESS == queue->pushBack(value));
+}
+
+void orderingPush(Obj *queue, int id, int numValues)
+    // Push, in increasing order, 'numValues' values encoding the specified
+    // producer 'id' and a sequence number onto the specified 'queue'.
+{
+    for (int i = 0; i < numValues; ++i) {
+        int value = (id << 24) | i;
+
+        if (i % 3) {
+            ASSERT(e_SUCCESS == queue->pushBack(value));
+        }
+        else {
+            while (e_SUCCESS != queue->tryPushBack(value)) {
+                bslmt::ThreadUtil::yield();
+            }
+        }
+    }
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Many Feeds, One Aggregator
+///- - - - - - - - - - - - - - - - - - -
+// In the following example a 'bdlcc::MultiProducerSingleConsumerBoundedQueue'
+// is used to communicate between several "feed" threads and a single
+// "aggregator" thread.  Each feed pushes updates onto the queue, and the
+// aggregator drains the queue in batches and applies the updates.
+//
+// First, we define the type of an update, and of the queue:
+//..
+    struct my_Update {
+        int d_feedId;    // identifies the producing feed
+        int d_quantity;  // quantity to accumulate
+    };
+
+    typedef bdlcc::MultiProducerSingleConsumerBoundedQueue<my_Update>
+                                                                my_UpdateQueue;
+//..
+// Then, we define a 'myFeed' function that pushes a number of updates onto
+// the queue:
+//..
+    void myFeed(my_UpdateQueue *queue, int id)
+        // Push 1000 updates from the feed having the specified 'id' onto the
+        // specified 'queue'.
+    {
+        for (int i = 0; i < 1000; ++i) {
+            my_Update update;
+            update.d_feedId   = id;
+            update.d_quantity = 1;
+
+            queue->pushBack(update);
+        }
+    }
+//..
+// Next, we define a 'myAggregator' function that pops updates off the queue in
+// batches of up to 64.  Note that the call to 'popFrontBulk' blocks until at
+// least one update is available:
+//..
+    int myAggregator(my_UpdateQueue *queue, int numUpdates)
+        // Pop the specified 'numUpdates' updates from the specified
+        // 'queue', and return their accumulated quantity.
+    {
+        my_Update updates[64];
+        int       total = 0;
+
+        while (numUpdates) {
+            bsl::size_t numPopped;
+
+            ASSERT(0 == queue->popFrontBulk(updates, 64, &numPopped));
+
+            for (bsl::size_t i = 0; i < numPopped; ++i) {
+                total += updates[i].d_quantity;
+            }
+            numUpdates -= static_cast<int>(numPopped);
+        }
+        return total;
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Finally, we create the queue, start four feed threads, and aggregate the
+// updates in the current thread:
+//..
+    my_UpdateQueue queue(128);
+
+    bslmt::ThreadGroup feeds;
+    for (int i = 0; i < 4; ++i) {
+        feeds.addThread(bdlf::BindUtil::bind(&myFeed, &queue, i));
+    }
+
+    ASSERT(4000 == myAggregator(&queue, 4000));
+
+    feeds.joinAll();
+//..
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // ORDERING GUARANTEE TEST
+        //   For the set of elements enqueued by a particular producer, the
+        //   order in which the elements are dequeued must match the order
+        //   these elements were enqueued.
+        //
+        // Concerns:
+        //: 1 With many producers, every pushed element is popped exactly once.
+        //:
+        //: 2 The elements from each producer are popped in the order pushed.
+        //:
+        //: 3 The blocking and non-blocking methods interoperate while the
+        //:   queue repeatedly becomes full and empty.
+        //
+        // Plan:
+        //: 1 Using a small queue, have several producers push elements
+        //:   encoding the producer and a sequence number, using both
+        //:   'pushBack' and 'tryPushBack'.  Pop the elements in the main
+        //:   thread with a mix of all the "pop" methods, and verify the
+        //:   sequence numbers per producer are consecutive.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: ordering guarantee with many producers
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ORDERING GUARANTEE TEST" << endl
+                          << "=======================" << endl;
+
+        enum { k_NUM_PRODUCERS = 6, k_NUM_VALUES = 100000 };
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int capacity = 2; capacity <= 256; capacity *= 8) {
+            if (veryVerbose) { T_ P(capacity) }
+
+            Obj mX(capacity, &ta);
+
+            bslmt::ThreadGroup producers(&ta);
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                producers.addThread(bdlf::BindUtil::bind(&orderingPush,
+                                                         &mX,
+                                                         i,
+                                                         k_NUM_VALUES));
+            }
+
+            bsl::vector<int> next(k_NUM_PRODUCERS, 0, &ta);
+            int              values[16];
+            int              numPopped = 0;
+            int              iteration = 0;
+
+            while (numPopped < k_NUM_PRODUCERS * k_NUM_VALUES) {
+                bsl::size_t n = 0;
+                int         rv;
+
+                switch (iteration++ % 4) {
+                  case 0: {
+                    rv = mX.popFront(values);
+                    n  = 1;
+                  } break;
+                  case 1: {
+                    rv = mX.tryPopFront(values);
+                    n  = 1;
+                  } break;
+                  case 2: {
+                    rv = mX.popFrontBulk(values, 16, &n);
+                  } break;
+                  default: {
+                    rv = mX.tryPopFrontBulk(values, 16, &n);
+                  } break;
+                }
+
+                if (e_EMPTY == rv) {
+                    continue;                                       // CONTINUE
+                }
+                ASSERTV(rv, e_SUCCESS == rv);
+
+                for (bsl::size_t i = 0; i < n; ++i) {
+                    const int id       = values[i] >> 24;
+                    const int sequence = values[i] & 0xffffff;
+
+                    ASSERTV(id, 0 <= id && id < k_NUM_PRODUCERS);
+                    ASSERTV(id, sequence, next[id], sequence == next[id]);
+
+                    next[id] = sequence + 1;
+                }
+                numPopped += static_cast<int>(n);
+            }
+
+            producers.joinAll();
+
+            ASSERT(mX.isEmpty());
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                ASSERTV(i, next[i], k_NUM_VALUES == next[i]);
+            }
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // BLOCKING TEST
+        //
+        // Concerns:
+        //: 1 A producer blocked on a full queue is woken when the consumer
+        //:   pops an element, whether by 'popFront' or 'popFrontBulk'.
+        //:
+        //: 2 The consumer blocked on an empty queue is woken when a producer
+        //:   pushes an element, in both 'popFront' and 'popFrontBulk'.
+        //
+        // Plan:
+        //: 1 Fill a queue, start a thread that pops after a delay, and push
+        //:   (blocking) from the main thread.  (C-1)
+        //:
+        //: 2 Start a thread that pushes after a delay, and pop (blocking)
+        //:   from the main thread.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: blocked threads are woken
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BLOCKING TEST" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (veryVerbose) cout << "Blocked producer." << endl;
+        {
+            Obj mX(2, &ta);
+
+            ASSERT(e_SUCCESS == mX.pushBack(1));
+            ASSERT(e_SUCCESS == mX.pushBack(2));
+            ASSERT(mX.isFull());
+
+            int                value = 0;
+            bslmt::ThreadGroup threads(&ta);
+
+            threads.addThread(bdlf::BindUtil::bind(&deferredPopFront,
+                                                   &mX,
+                                                   &value));
+
+            ASSERT(e_SUCCESS == mX.pushBack(3));
+
+            threads.joinAll();
+
+            ASSERT(1 == value);
+
+            bsl::size_t n;
+            int         values[4];
+
+            threads.addThread(bdlf::BindUtil::bind(&deferredPopFront,
+                                                   &mX,
+                                                   &value));
+
+            ASSERT(e_SUCCESS == mX.pushBack(4));
+
+            threads.joinAll();
+
+            ASSERT(2 == value);
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontBulk(values, 4, &n));
+            ASSERT(2 == n);
+            ASSERT(3 == values[0]);
+            ASSERT(4 == values[1]);
+        }
+
+        if (veryVerbose) cout << "Blocked consumer." << endl;
+        {
+            Obj mX(4, &ta);
+
+            bslmt::ThreadGroup threads(&ta);
+
+            threads.addThread(bdlf::BindUtil::bind(&deferredPushBack,
+                                                   &mX,
+                                                   5));
+
+            int value = 0;
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT(5 == value);
+
+            threads.joinAll();
+
+            threads.addThread(bdlf::BindUtil::bind(&deferredPushBack,
+                                                   &mX,
+                                                   6));
+
+            int         values[4];
+            bsl::size_t n = 0;
+            ASSERT(e_SUCCESS == mX.popFrontBulk(values, 4, &n));
+            ASSERT(1 == n);
+            ASSERT(6 == values[0]);
+
+            threads.joinAll();
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // EXCEPTION TEST
+        //
+        // Concerns:
+        //: 1 An exception thrown while copying a value into the queue
+        //:   propagates to the caller of 'pushBack' or 'tryPushBack'.
+        //:
+        //: 2 The element reserved for the failed value is skipped by all the
+        //:   "pop" methods and by 'removeAll', and the queue remains usable.
+        //
+        // Plan:
+        //: 1 Using 'ThrowOnCopyTestType', interleave pushes of throwing and
+        //:   non-throwing values and verify that exactly the non-throwing
+        //:   values are popped, in order.  (C-1,2)
+        //
+        // Testing:
+        //   CONCERN: exception while pushing
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION TEST" << endl
+                          << "==============" << endl;
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        typedef bdlcc::MultiProducerSingleConsumerBoundedQueue<
+                                                  ThrowOnCopyTestType> ExcObj;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        ExcObj mX(4, &ta);  const ExcObj& X = mX;
+
+        const ThrowOnCopyTestType GOOD1(1);
+        const ThrowOnCopyTestType GOOD2(2);
+        const ThrowOnCopyTestType BAD(-1);
+
+        for (int i = 0; i < 3; ++i) {
+            if (veryVerbose) { T_ P(i) }
+
+            int numThrown = 0;
+
+            try {
+                mX.pushBack(BAD);
+            }
+            catch (int) {
+                ++numThrown;
+            }
+            ASSERT(e_SUCCESS == mX.pushBack(GOOD1));
+            try {
+                mX.tryPushBack(BAD);
+            }
+            catch (int) {
+                ++numThrown;
+            }
+            ASSERT(e_SUCCESS == mX.tryPushBack(GOOD2));
+
+            ASSERT(2 == numThrown);
+            ASSERT(X.isFull());
+            ASSERT(e_FULL == mX.tryPushBack(GOOD1));
+
+            ThrowOnCopyTestType value;
+
+            if (0 == i) {
+                ASSERT(e_SUCCESS == mX.popFront(&value));
+                ASSERT(1 == value.value());
+                ASSERT(e_SUCCESS == mX.tryPopFront(&value));
+                ASSERT(2 == value.value());
+            }
+            else if (1 == i) {
+                ThrowOnCopyTestType values[4];
+                bsl::size_t         n;
+
+                ASSERT(e_SUCCESS == mX.popFrontBulk(values, 4, &n));
+                ASSERT(2 == n);
+                ASSERT(1 == values[0].value());
+                ASSERT(2 == values[1].value());
+            }
+            else {
+                mX.removeAll();
+            }
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.numElements());
+            ASSERT(e_EMPTY == mX.tryPopFront(&value));
+        }
+#endif
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // MOVING TESTS
+        //
+        // Concerns:
+        //: 1 The manipulators 'pushBack', 'tryPushBack', and the "pop"
+        //:   methods honor move-semantics.
+        //
+        // Plan:
+        //: 1 After pushing back a value, verify the value is in moved-from
+        //:   state, and verify the popped value has the expected value.  (C-1)
+        //
+        // Testing:
+        //   int pushBack(bslmf::MovableRef<TYPE> value);
+        //   int tryPushBack(bslmf::MovableRef<TYPE> value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MOVING TESTS" << endl
+                          << "============" << endl;
+
+#ifdef BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES
+        // Move-only types are not supported in C++03 mode.
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        bdlcc::MultiProducerSingleConsumerBoundedQueue<MoveTester> mX(4, &ta);
+
+        MoveTester a(1);
+        MoveTester b(2);
+        MoveTester c(3);
+
+        ASSERT(e_SUCCESS == mX.pushBack(MoveUtil::move(a)));
+        ASSERT(a.isMoved());
+        ASSERT(e_SUCCESS == mX.tryPushBack(MoveUtil::move(b)));
+        ASSERT(b.isMoved());
+        ASSERT(e_SUCCESS == mX.pushBack(MoveUtil::move(c)));
+        ASSERT(c.isMoved());
+
+        MoveTester value;
+        ASSERT(e_SUCCESS == mX.popFront(&value));
+        ASSERT(1 == value.value());
+        ASSERT(e_SUCCESS == mX.tryPopFront(&value));
+        ASSERT(2 == value.value());
+
+        MoveTester  values[2];
+        bsl::size_t n;
+        ASSERT(e_SUCCESS == mX.tryPopFrontBulk(values, 2, &n));
+        ASSERT(1 == n);
+        ASSERT(3 == values[0].value());
+#endif
+
+        bslma::TestAllocator ta2(veryVeryVerbose);
+        {
+            AllocObj mX(4, &ta2);
+
+            bsl::string s("a string long enough to allocate memory", &ta2);
+
+            ASSERT(e_SUCCESS == mX.pushBack(bslmf::MovableRefUtil::move(s)));
+
+            bsl::string value(&ta2);
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT("a string long enough to allocate memory" == value);
+        }
+        ASSERT(0 == ta2.numBytesInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // DISABLE AND ENABLE TEST
+        //
+        // Concerns:
+        //: 1 The queue is created enabled, and the disabled states are
+        //:   independent and reported by the accessors.
+        //:
+        //: 2 While disabled, the corresponding methods fail immediately with
+        //:   'e_DISABLED' and do not modify the queue.
+        //:
+        //: 3 A blocked consumer, and blocked producers, return 'e_DISABLED'
+        //:   when the corresponding operation is disabled.
+        //:
+        //: 4 Disabling or enabling a queue that is already in that state has
+        //:   no effect.
+        //
+        // Plan:
+        //: 1 Directly exercise the methods in each state.  (C-1,2,4)
+        //:
+        //: 2 Use threads that disable the queue after a delay while the main
+        //:   thread is blocked.  (C-3)
+        //
+        // Testing:
+        //   void disablePopFront();
+        //   void disablePushBack();
+        //   void enablePopFront();
+        //   void enablePushBack();
+        //   bool isPopFrontDisabled() const;
+        //   bool isPushBackDisabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DISABLE AND ENABLE TEST" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isPopFrontDisabled());
+            ASSERT(false == X.isPushBackDisabled());
+
+            mX.disablePushBack();
+            mX.disablePushBack();
+
+            ASSERT(false == X.isPopFrontDisabled());
+            ASSERT(true  == X.isPushBackDisabled());
+
+            ASSERT(e_DISABLED == mX.pushBack(1));
+            ASSERT(e_DISABLED == mX.tryPushBack(1));
+            ASSERT(0 == X.numElements());
+
+            mX.enablePushBack();
+            mX.enablePushBack();
+
+            ASSERT(false == X.isPushBackDisabled());
+            ASSERT(e_SUCCESS == mX.pushBack(1));
+
+            mX.disablePopFront();
+
+            ASSERT(true  == X.isPopFrontDisabled());
+            ASSERT(false == X.isPushBackDisabled());
+
+            int         value = 0;
+            int         values[2];
+            bsl::size_t n = 7;
+
+            ASSERT(e_DISABLED == mX.popFront(&value));
+            ASSERT(e_DISABLED == mX.tryPopFront(&value));
+            ASSERT(e_DISABLED == mX.popFrontBulk(values, 2, &n));
+            ASSERT(e_DISABLED == mX.tryPopFrontBulk(values, 2, &n));
+            ASSERT(0 == value);
+            ASSERT(7 == n);
+            ASSERT(1 == X.numElements());
+
+            mX.enablePopFront();
+
+            ASSERT(false == X.isPopFrontDisabled());
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT(1 == value);
+        }
+
+        if (veryVerbose) cout << "Blocked consumer is disabled." << endl;
+        {
+            Obj mX(4, &ta);
+
+            for (int i = 0; i < 2; ++i) {
+                bslmt::ThreadGroup threads(&ta);
+
+                threads.addThread(
+                         bdlf::BindUtil::bind(&deferredDisablePopFront, &mX));
+
+                int         value = 0;
+                int         values[2];
+                bsl::size_t n = 0;
+
+                if (0 == i) {
+                    ASSERT(e_DISABLED == mX.popFront(&value));
+                }
+                else {
+                    ASSERT(e_DISABLED == mX.popFrontBulk(values, 2, &n));
+                }
+
+                threads.joinAll();
+
+                mX.enablePopFront();
+
+                // The queue is usable after the blocked consumer returns.
+
+                ASSERT(e_SUCCESS == mX.pushBack(3));
+                ASSERT(e_SUCCESS == mX.popFront(&value));
+                ASSERT(3 == value);
+            }
+        }
+
+        if (veryVerbose) cout << "Blocked producer is disabled." << endl;
+        {
+            Obj mX(2, &ta);
+
+            ASSERT(e_SUCCESS == mX.pushBack(1));
+            ASSERT(e_SUCCESS == mX.pushBack(2));
+
+            bslmt::ThreadGroup threads(&ta);
+
+            threads.addThread(
+                         bdlf::BindUtil::bind(&deferredDisablePushBack, &mX));
+
+            ASSERT(e_DISABLED == mX.pushBack(3));
+
+            threads.joinAll();
+
+            mX.enablePushBack();
+
+            int value = 0;
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT(1 == value);
+            ASSERT(e_SUCCESS == mX.pushBack(4));
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT(2 == value);
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT(4 == value);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BULK POP TEST
+        //
+        // Concerns:
+        //: 1 'tryPopFrontBulk' returns 'e_EMPTY' on an empty queue and does
+        //:   not modify its arguments.
+        //:
+        //: 2 The bulk methods remove, in order, all available elements up to
+        //:   the requested maximum, and report the number removed.
+        //:
+        //: 3 The bulk methods operate correctly when the elements wrap around
+        //:   the end of the ring.
+        //:
+        //: 4 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a number of fill levels and maximums, push elements (after
+        //:   advancing the ring by a varying offset), drain the queue with the
+        //:   bulk methods, and verify the results.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values.  (C-4)
+        //
+        // Testing:
+        //   int popFrontBulk(TYPE *values, size_t max, size_t *n);
+        //   int tryPopFrontBulk(TYPE *values, size_t max, size_t *n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK POP TEST" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int offset = 0; offset < 8; ++offset) {
+            for (int fill = 1; fill <= 8; ++fill) {
+                for (int max = 1; max <= 9; ++max) {
+                    Obj mX(8, &ta);  const Obj& X = mX;
+
+                    int         values[9];
+                    bsl::size_t n = 99;
+
+                    ASSERT(e_EMPTY == mX.tryPopFrontBulk(values, max, &n));
+                    ASSERT(99 == n);
+
+                    for (int i = 0; i < offset; ++i) {
+                        int value;
+                        ASSERT(e_SUCCESS == mX.pushBack(i));
+                        ASSERT(e_SUCCESS == mX.popFront(&value));
+                    }
+
+                    for (int i = 0; i < fill; ++i) {
+                        ASSERT(e_SUCCESS == mX.pushBack(i));
+                    }
+
+                    int next   = 0;
+                    int useTry = 0;
+
+                    while (next < fill) {
+                        int rv = (useTry++ % 2)
+                               ? mX.tryPopFrontBulk(values, max, &n)
+                               : mX.popFrontBulk(values, max, &n);
+
+                        ASSERTV(offset, fill, max, e_SUCCESS == rv);
+
+                        const int EXP_N = fill - next < max ? fill - next
+                                                            : max;
+                        ASSERTV(offset, fill, max, n,
+                                EXP_N == static_cast<int>(n));
+
+                        for (bsl::size_t i = 0; i < n; ++i) {
+                            ASSERTV(offset, fill, max, values[i],
+                                    next == values[i]);
+                            ++next;
+                        }
+                        ASSERT(static_cast<bsl::size_t>(fill - next)
+                                                         == X.numElements());
+                    }
+                    ASSERT(X.isEmpty());
+                    ASSERT(e_EMPTY == mX.tryPopFrontBulk(values, max, &n));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(4, &ta);
+
+            ASSERT(e_SUCCESS == mX.pushBack(1));
+
+            int         values[1];
+            bsl::size_t n;
+
+            ASSERT_FAIL(mX.tryPopFrontBulk(0, 1, &n));
+            ASSERT_FAIL(mX.tryPopFrontBulk(values, 0, &n));
+            ASSERT_FAIL(mX.tryPopFrontBulk(values, 1, 0));
+            ASSERT_PASS(mX.tryPopFrontBulk(values, 1, &n));
+
+            ASSERT(e_SUCCESS == mX.pushBack(2));
+
+            ASSERT_FAIL(mX.popFrontBulk(0, 1, &n));
+            ASSERT_FAIL(mX.popFrontBulk(values, 0, &n));
+            ASSERT_FAIL(mX.popFrontBulk(values, 1, 0));
+            ASSERT_PASS(mX.popFrontBulk(values, 1, &n));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // NON-BLOCKING METHODS AND ACCESSORS TEST
+        //
+        // Concerns:
+        //: 1 'tryPushBack' succeeds until the queue is full, and then returns
+        //:   'e_FULL' without modifying the queue.
+        //:
+        //: 2 'tryPopFront' succeeds until the queue is empty, and then returns
+        //:   'e_EMPTY' without modifying its argument.
+        //:
+        //: 3 'isEmpty', 'isFull', and 'numElements' reflect the state of the
+        //:   queue, including after the positions wrap around the ring.
+        //
+        // Plan:
+        //: 1 For a number of capacities, repeatedly fill and drain the queue
+        //:   using the non-blocking methods, verifying the accessors after
+        //:   each operation.  (C-1..3)
+        //
+        // Testing:
+        //   int tryPopFront(TYPE *value);
+        //   int tryPushBack(const TYPE& value);
+        //   bool isEmpty() const;
+        //   bool isFull() const;
+        //   bsl::size_t numElements() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "NON-BLOCKING METHODS AND ACCESSORS TEST" << endl
+                          << "=======================================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int capacity = 2; capacity <= 16; capacity *= 2) {
+            Obj mX(capacity, &ta);  const Obj& X = mX;
+
+            for (int round = 0; round < 3; ++round) {
+                for (int i = 0; i < capacity; ++i) {
+                    ASSERT(false == X.isFull());
+                    ASSERT(e_SUCCESS == mX.tryPushBack(i));
+                    ASSERT(false == X.isEmpty());
+                    ASSERT(static_cast<bsl::size_t>(i + 1)
+                                                         == X.numElements());
+                }
+                ASSERT(true == X.isFull());
+                ASSERT(e_FULL == mX.tryPushBack(-1));
+                ASSERT(static_cast<bsl::size_t>(capacity) == X.numElements());
+
+                for (int i = 0; i < capacity; ++i) {
+                    int value = -1;
+                    ASSERT(e_SUCCESS == mX.tryPopFront(&value));
+                    ASSERTV(capacity, i, value, i == value);
+                    ASSERT(false == X.isFull());
+                }
+                ASSERT(true == X.isEmpty());
+                ASSERT(0 == X.numElements());
+
+                int value = -1;
+                ASSERT(e_EMPTY == mX.tryPopFront(&value));
+                ASSERT(-1 == value);
+
+                // Offset the positions so that the next round wraps.
+
+                ASSERT(e_SUCCESS == mX.tryPushBack(0));
+                ASSERT(e_SUCCESS == mX.tryPopFront(&value));
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS
+        //
+        // Concerns:
+        //: 1 The capacity is the supplied capacity rounded up to a power of
+        //:   two not less than 2.
+        //:
+        //: 2 The allocator is propagated to the elements, and all memory is
+        //:   returned on destruction.
+        //:
+        //: 3 'pushBack' and 'popFront' maintain FIFO order, and 'removeAll'
+        //:   empties the queue.
+        //:
+        //: 4 The return value of a successful operation is 0.
+        //
+        // Plan:
+        //: 1 Create queues of varied capacities and verify 'capacity'.  (C-1)
+        //:
+        //: 2 Using a queue of allocating elements, push, pop, and remove all
+        //:   elements, and verify the allocator usage.  (C-2..4)
+        //
+        // Testing:
+        //   MultiProducerSingleConsumerBoundedQueue(capacity, bA = 0);
+        //   ~MultiProducerSingleConsumerBoundedQueue();
+        //   int popFront(TYPE *value);
+        //   int pushBack(const TYPE& value);
+        //   void removeAll();
+        //   bsl::size_t capacity() const;
+        //   bslma::Allocator *allocator() const;
+        //   CONCERN: 0 == e_SUCCESS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS" << endl
+                          << "====================" << endl;
+
+        ASSERT(0 == e_SUCCESS);
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        {
+            static const struct {
+                int         d_line;
+                bsl::size_t d_capacity;
+                bsl::size_t d_expected;
+            } DATA[] = {
+                { L_,    0,    2 },
+                { L_,    1,    2 },
+                { L_,    2,    2 },
+                { L_,    3,    4 },
+                { L_,    4,    4 },
+                { L_,    5,    8 },
+                { L_,  100,  128 },
+                { L_, 1024, 1024 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const bsl::size_t CAPACITY = DATA[ti].d_capacity;
+                const bsl::size_t EXPECTED = DATA[ti].d_expected;
+
+                Obj mX(CAPACITY, &ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, EXPECTED == X.capacity());
+                ASSERTV(LINE, &ta == X.allocator());
+                ASSERTV(LINE, 0 < ta.numBytesInUse());
+            }
+            ASSERT(0 == ta.numBytesInUse());
+        }
+
+        {
+            bslma::DefaultAllocatorGuard dag(&ta);
+
+            Obj mX(4);  const Obj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+        }
+
+        {
+            AllocObj mX(4, &ta);  const AllocObj& X = mX;
+
+            const bsl::string A("a string long enough to allocate memory",
+                                &ta);
+            const bsl::string B("another string long enough to allocate",
+                                &ta);
+
+            ASSERT(e_SUCCESS == mX.pushBack(A));
+            ASSERT(e_SUCCESS == mX.pushBack(B));
+            ASSERT(2 == X.numElements());
+
+            bsl::string value(&ta);
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT(A == value);
+
+            ASSERT(e_SUCCESS == mX.pushBack(A));
+            ASSERT(e_SUCCESS == mX.pushBack(B));
+            ASSERT(e_SUCCESS == mX.pushBack(A));
+            ASSERT(4 == X.numElements());
+
+            mX.removeAll();
+            ASSERT(0 == X.numElements());
+            ASSERT(X.isEmpty());
+
+            ASSERT(e_SUCCESS == mX.pushBack(B));
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT(B == value);
+
+            // Elements remaining at destruction are destroyed.
+
+            ASSERT(e_SUCCESS == mX.pushBack(A));
+            ASSERT(e_SUCCESS == mX.pushBack(B));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a queue, push and pop a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(4);  const Obj& X = mX;
+
+        ASSERT(X.isEmpty());
+        ASSERT(e_SUCCESS == mX.pushBack(1));
+        ASSERT(e_SUCCESS == mX.pushBack(2));
+        ASSERT(2 == X.numElements());
+
+        int value;
+        ASSERT(e_SUCCESS == mX.popFront(&value));
+        ASSERT(1 == value);
+        ASSERT(e_SUCCESS == mX.tryPopFront(&value));
+        ASSERT(2 == value);
+        ASSERT(e_EMPTY == mX.tryPopFront(&value));
+        ASSERT(X.isEmpty());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    ASSERT(0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1224 @@
+// bdlcc_shardedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDCACHE
+#define INCLUDED_BDLCC_SHARDEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-striped in-process cache with an intrusive LRU list.
+//
+//@CLASSES:
+//  bdlcc::ShardedCache: in-process key-value cache partitioned into shards
+//  bdlcc::ShardedCacheEvictionPolicy: namespace for eviction policy 'enum'
+//
+//@SEE_ALSO: bdlcc_cache, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlcc::ShardedCache', implementing a thread-safe in-memory key-value cache
+// that partitions its keys across a number of independently locked *shards*.
+// 'bdlcc::ShardedCache' provides an interface closely resembling that of
+// 'bdlcc::Cache', and is intended for use where a single 'bdlcc::Cache' would
+// be a point of contention between many threads.
+//
+// Each shard owns a hash map and an eviction queue that is threaded through
+// the map nodes themselves (i.e., an *intrusive* list), so that no memory is
+// allocated for the eviction queue beyond the map node of each item.  A key is
+// assigned to a shard using the value returned by the hash functor, so that
+// operations on keys in different shards never contend for the same lock.  The
+// number of shards is rounded up to the next power of 2.
+//
+///Eviction Policies
+///-----------------
+// Three eviction policies are supported:
+//
+//: o LRU (Least Recently Used): the item that has *not* been accessed for the
+//:   longest period of time is evicted first.  Maintaining the access order
+//:   requires a successful 'tryGetValue' to acquire a write lock on the shard
+//:   containing the key.
+//:
+//: o FIFO (First In, First Out): the item inserted earliest is evicted first.
+//:   'tryGetValue' requires only a read lock.
+//:
+//: o CLOCK (second chance): an approximation of LRU in which a successful
+//:   'tryGetValue' merely marks the item as *referenced* using an atomic flag,
+//:   and therefore requires only a read lock.  When eviction is required, the
+//:   item at the front of the shard's eviction queue is examined: if it is
+//:   marked as referenced, the mark is cleared and the item is moved to the
+//:   back of the queue (i.e., it is given a second chance); otherwise the item
+//:   is evicted.
+//
+///Watermarks
+///----------
+// As in 'bdlcc::Cache', the cache size is controlled by the low watermark and
+// high watermark attributes.  The watermarks supplied at construction apply to
+// the cache as a whole and are distributed evenly (rounding up) among the
+// shards: eviction in a shard starts when the size of that shard reaches its
+// share of the high watermark, and continues until the size of the shard is
+// less than its share of the low watermark.  Consequently, if keys are not
+// evenly distributed among shards, eviction may begin before the size of the
+// cache as a whole reaches the high watermark.  Note that if a single shard is
+// requested, the eviction behavior of a 'bdlcc::ShardedCache' using the LRU or
+// FIFO policy is identical to that of 'bdlcc::Cache'.
+//
+///Thread Safety
+///-------------
+// The 'bdlcc::ShardedCache' class template is fully thread-safe (see
+// 'bsldoc_glossary') provided that the allocator supplied at construction and
+// the default allocator in effect during the lifetime of cached items are both
+// fully thread-safe.
+//
+///Thread Contention
+///-----------------
+// Each shard is protected by its own reader-writer lock; threads accessing
+// keys that belong to different shards do not block each other.  'insert',
+// 'erase', and a 'tryGetValue' that modifies the eviction queue of an LRU
+// cache acquire a write lock on a single shard.  'tryGetValue' acquires only
+// a read lock if the eviction policy is FIFO or CLOCK, or if the argument
+// 'modifyEvictionQueue' is 'false'.
+//
+// 'clear', 'setPostEvictionCallback', and 'size' lock each shard in turn, and
+// 'visit' holds the read lock of each shard while visiting the items of that
+// shard.  Note that 'size' is not an atomic snapshot of the cache.
+//
+///Post-eviction Callback and Potential Deadlocks
+///---------------------------------------------
+// When an item is evicted or erased from the cache, the previously set
+// post-eviction callback (via the 'setPostEvictionCallback' method) will be
+// invoked within the calling thread, supplying a pointer to the item being
+// removed.  The callback is invoked while the write lock of the shard that
+// contained the item is held; therefore, the cache object itself should not be
+// used in a post-eviction callback, otherwise a deadlock may result.
+//
+///Runtime Complexity
+///------------------
+//..
+// +----------------------------------------------------+--------------------+
+// | Operation                                          | Complexity         |
+// +====================================================+====================+
+// | insert                                             | Average: O[1]      |
+// |                                                    | Worst:   O[n]      |
+// +----------------------------------------------------+--------------------+
+// | tryGetValue                                        | O[1]               |
+// +----------------------------------------------------+--------------------+
+// | erase                                              | O[1]               |
+// +----------------------------------------------------+--------------------+
+// | size                                               | O[numShards]       |
+// +----------------------------------------------------+--------------------+
+// | visit                                              | O[n]               |
+// +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Caching Computed Prices
+/// - - - - - - - - - - - - - - - - -
+// Suppose that a pricing service computes the price of an instrument in a
+// relatively expensive way, and that the same instruments are priced
+// repeatedly by many threads.  We can cache the computed prices in a
+// 'bdlcc::ShardedCache' using the CLOCK policy, so that cache hits acquire
+// only a read lock on one of the shards.
+//
+// First, we define a 'bdlcc::ShardedCache' object, 'priceCache', mapping an
+// instrument identifier to its price, having 4 shards, and holding at most 8
+// items:
+//..
+//  bdlcc::ShardedCache<int, double> priceCache(
+//                                  bdlcc::ShardedCacheEvictionPolicy::e_CLOCK,
+//                                  8,
+//                                  8,
+//                                  4,
+//                                  &talloc);
+//  assert(4 == priceCache.numShards());
+//..
+// Then, we insert the prices of a few instruments:
+//..
+//  priceCache.insert(1, 101.25);
+//  priceCache.insert(2, 99.5);
+//  priceCache.insert(3, 100.0);
+//  assert(3 == priceCache.size());
+//..
+// Next, we look up the price of an instrument:
+//..
+//  bsl::shared_ptr<double> price;
+//  int                     rc = priceCache.tryGetValue(&price, 2);
+//  assert(0    == rc);
+//  assert(99.5 == *price);
+//..
+// Then, we look up an instrument that is not in the cache:
+//..
+//  rc = priceCache.tryGetValue(&price, 4);
+//  assert(1 == rc);
+//..
+// Now, we insert enough prices to exceed the capacity of the cache.  Each of
+// the 4 shards holds at most 2 items, so eviction begins when a shard holds 2
+// items:
+//..
+//  for (int i = 4; i < 100; ++i) {
+//      priceCache.insert(i, 100.0 + i);
+//  }
+//  assert(priceCache.size() <= 8);
+//..
+// Finally, we observe that the most recently inserted price is still cached:
+//..
+//  rc = priceCache.tryGetValue(&price, 99);
+//  assert(0     == rc);
+//  assert(199.0 == *price);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_allocatorargt.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bslmt_platform.h>
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>            // 'bsl::size_t'
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                     // =================================
+                     // struct ShardedCacheEvictionPolicy
+                     // =================================
+
+struct ShardedCacheEvictionPolicy {
+
+    // TYPES
+    enum Enum {
+        // Enumeration of supported sharded cache eviction policies.
+
+        e_LRU,   // Least Recently Used
+        e_FIFO,  // First In, First Out
+        e_CLOCK  // second chance approximation of LRU
+    };
+};
+
+                          // =======================
+                          // class ShardedCache_Node
+                          // =======================
+
+template <class KEY, class VALUE>
+class ShardedCache_Node {
+    // This class is a value stored in the hash map of a shard of a
+    // 'ShardedCache'.  It holds a shared pointer to the cached value, the
+    // links of the intrusive eviction queue, and the CLOCK policy reference
+    // flag.  Note that the eviction queue links point to the 'bsl::pair'
+    // containing this object, whose address is stable for as long as the
+    // element is in the map.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<const KEY, ShardedCache_Node> Element;
+        // Type of the hash map element containing a node.
+
+    // PUBLIC DATA
+    bsl::shared_ptr<VALUE>  d_value;       // cached value
+
+    Element                *d_prev_p;      // previous element in the eviction
+                                           // queue, or 0 if first
+
+    Element                *d_next_p;      // next element in the eviction
+                                           // queue, or 0 if last
+
+    bsls::AtomicBool        d_referenced;  // 'true' if the element was
+                                           // accessed since it was last
+                                           // examined by the CLOCK hand
+
+    // CREATORS
+    ShardedCache_Node();
+        // Create a node having a null value, no links, and not referenced.
+
+    ShardedCache_Node(const ShardedCache_Node& original);
+        // Create a node having the same value and links as the specified
+        // 'original' object.  The behavior is undefined if 'original' is
+        // concurrently modified.
+
+    //! ~ShardedCache_Node() = default;
+        // Destroy this object.
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_Node& operator=(const ShardedCache_Node&);
+};
+
+                         // ========================
+                         // class ShardedCache_Shard
+                         // ========================
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+class ShardedCache_Shard {
+    // This class implements one shard of a 'ShardedCache': a hash map, an
+    // intrusive eviction queue threaded through the hash map elements, and the
+    // reader-writer lock protecting both.  This class does not lock the mutex
+    // itself; all locking is performed by 'ShardedCache'.
+
+  public:
+    // PUBLIC TYPES
+    typedef ShardedCache_Node<KEY, VALUE>                   Node;
+    typedef typename Node::Element                          Element;
+    typedef bsl::unordered_map<KEY, Node, HASH, EQUAL>      MapType;
+    typedef bslmt::ReaderWriterMutex                        LockType;
+
+    typedef bsl::function<void(const bsl::shared_ptr<VALUE>&)>
+                                                          PostEvictionCallback;
+
+    // PUBLIC DATA
+    mutable LockType  d_lock;           // protects all other data members
+
+    MapType           d_map;            // hash map of the shard
+
+    Element          *d_head_p;         // first element of the eviction queue
+                                        // (next to be evicted), or 0
+
+    Element          *d_tail_p;         // last element of the eviction queue,
+                                        // or 0
+
+    bsl::size_t       d_lowWatermark;   // size of this shard at which
+                                        // eviction stops
+
+    bsl::size_t       d_highWatermark;  // size of this shard at which
+                                        // eviction starts
+
+    const char        d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                        // padding, so that the locks of
+                                        // adjacent shards do not share a cache
+                                        // line
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_Shard(const ShardedCache_Shard&);
+    ShardedCache_Shard& operator=(const ShardedCache_Shard&);
+
+  public:
+    // CREATORS
+    ShardedCache_Shard(bsl::size_t       lowWatermark,
+                       bsl::size_t       highWatermark,
+                       const HASH&       hashFunction,
+                       const EQUAL&      equalFunction,
+                       bslma::Allocator *basicAllocator);
+        // Create an empty shard using the specified 'lowWatermark' and
+        // 'highWatermark', and using the specified 'hashFunction' and
+        // 'equalFunction' for its hash map.  Use the specified
+        // 'basicAllocator' to supply memory.
+
+    //! ~ShardedCache_Shard() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all elements from this shard.
+
+    void enforceHighWatermark(ShardedCacheEvictionPolicy::Enum  policy,
+                              const PostEvictionCallback&       callback);
+        // If 'd_map.size() >= d_highWatermark' evict elements from this shard,
+        // using the specified eviction 'policy', until
+        // 'd_map.size() < d_lowWatermark', invoking the specified 'callback'
+        // (if not empty) for each evicted element.
+
+    void evict(Element *element, const PostEvictionCallback& callback);
+        // Remove the specified 'element' from this shard and invoke the
+        // specified 'callback' (if not empty) for its value.  The behavior is
+        // undefined unless 'element' is in this shard.
+
+    void moveToBack(Element *element);
+        // Move the specified 'element' to the back of the eviction queue.  The
+        // behavior is undefined unless 'element' is in this shard.
+
+    void pushBack(Element *element);
+        // Append the specified 'element', which is not linked, to the eviction
+        // queue.
+
+    void unlink(Element *element);
+        // Remove the specified 'element' from the eviction queue.  The
+        // behavior is undefined unless 'element' is in the eviction queue.
+};
+
+                             // ==================
+                             // class ShardedCache
+                             // ==================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class ShardedCache {
+    // This class represents an in-process key-value store, partitioned into
+    // independently locked shards, supporting a variety of eviction policies.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::shared_ptr<VALUE>                            ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef bsl::function<void(const ValuePtrType&)> PostEvictionCallback;
+        // Type of function to call after an item has been evicted from the
+        // cache.
+
+    typedef bsl::pair<KEY, ValuePtrType>                          KVType;
+        // Value type of a bulk insert entry.
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_NUM_SHARDS = 16  // number of shards used by the default
+                                   // constructor
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>         Shard;
+    typedef typename Shard::Node                                Node;
+    typedef typename Shard::Element                             Element;
+    typedef typename Shard::MapType                             MapType;
+    typedef typename Shard::LockType                            LockType;
+
+    // DATA
+    bslma::Allocator                 *d_allocator_p;    // memory allocator
+                                                        // (held, not owned)
+
+    bsl::size_t                       d_numShards;      // number of shards, a
+                                                        // power of 2
+
+    bsl::size_t                       d_hashMask;       // 'd_numShards - 1'
+
+    Shard                            *d_shards_p;       // array of
+                                                        // 'd_numShards'
+                                                        // shards (owned)
+
+    HASH                              d_hasher;         // hash functor
+
+    ShardedCacheEvictionPolicy::Enum  d_evictionPolicy; // eviction policy
+
+    bsl::size_t                       d_lowWatermark;   // total low watermark
+
+    bsl::size_t                       d_highWatermark;  // total high
+                                                        // watermark
+
+    PostEvictionCallback              d_postEvictionCallback;
+                                                        // the function to call
+                                                        // after a value has
+                                                        // been evicted from
+                                                        // the cache
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t powerCeil(bsl::size_t num);
+        // Return the smallest power of 2 that is greater than or equal to the
+        // specified 'num', or 1 if 'num' is 0.
+
+    static bsl::size_t shardWatermark(bsl::size_t watermark,
+                                      bsl::size_t numShards);
+        // Return the share of the specified 'watermark' for each of the
+        // specified 'numShards' shards, rounded up, and at least 1.
+
+    // PRIVATE MANIPULATORS
+    void createShards(const EQUAL& equalFunction);
+        // Allocate and construct the 'd_numShards' shards of this cache, using
+        // 'd_hasher' and the specified 'equalFunction' for their hash maps.
+
+    bool insertImp(Shard&              shard,
+                   const KEY&          key,
+                   const ValuePtrType& valuePtr);
+        // Insert the specified 'key' and its associated 'valuePtr' into the
+        // specified 'shard', whose write lock is held by the caller, first
+        // enforcing the high watermark of 'shard'.  If 'key' already exists,
+        // replace its value with 'valuePtr' and move it to the back of the
+        // eviction queue.  Return 'true' if 'key' was not previously in the
+        // cache and 'false' otherwise.
+
+    void populateValuePtrType(ValuePtrType             *dst,
+                              const VALUE&              value,
+                              bsl::true_type);
+    void populateValuePtrType(ValuePtrType             *dst,
+                              const VALUE&              value,
+                              bsl::false_type);
+    void populateValuePtrType(ValuePtrType             *dst,
+                              bslmf::MovableRef<VALUE>  value,
+                              bsl::true_type);
+    void populateValuePtrType(ValuePtrType             *dst,
+                              bslmf::MovableRef<VALUE>  value,
+                              bsl::false_type);
+        // Allocate a footprint for the specified 'value', copy or move 'value'
+        // into the footprint and load the specified '*dst' with a pointer to
+        // the value.
+
+    // PRIVATE ACCESSORS
+    Shard& shardOf(const KEY& key) const;
+        // Return a reference providing modifiable access to the shard of the
+        // specified 'key'.
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache(const ShardedCache&);
+    ShardedCache& operator=(const ShardedCache&);
+
+  public:
+    // CREATORS
+    explicit ShardedCache(bslma::Allocator *basicAllocator = 0);
+        // Create an empty LRU cache having no size limit and
+        // 'k_DEFAULT_NUM_SHARDS' shards.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ShardedCache(ShardedCacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                       lowWatermark,
+                 bsl::size_t                       highWatermark,
+                 bsl::size_t                       numShards,
+                 bslma::Allocator                 *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy', the
+        // specified 'lowWatermark' and 'highWatermark', and having the
+        // specified 'numShards' rounded up to the next power of 2.  Optionally
+        // specify the 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark',
+        // '1 <= highWatermark', and '1 <= numShards'.
+
+    ShardedCache(ShardedCacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                       lowWatermark,
+                 bsl::size_t                       highWatermark,
+                 bsl::size_t                       numShards,
+                 const HASH&                       hashFunction,
+                 const EQUAL&                      equalFunction,
+                 bslma::Allocator                 *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy',
+        // 'lowWatermark', and 'highWatermark', and having the specified
+        // 'numShards' rounded up to the next power of 2.  The specified
+        // 'hashFunction' is used to generate the hash values for a given key
+        // (which determine both the shard of a key, and its position in the
+        // hash map of that shard), and the specified 'equalFunction' is used
+        // to determine whether two keys have the same value.  Optionally
+        // specify the 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark',
+        // '1 <= highWatermark', and '1 <= numShards'.
+
+    ~ShardedCache();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this cache.  Do *not* invoke the post-eviction
+        // callback.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this cache.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    int eraseBulk(const bsl::vector<KEY>& keys);
+        // Remove the items having the specified 'keys' from this cache.
+        // Invoke the post-eviction callback for each removed item.  Return
+        // the number of items successfully removed.
+
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+        // Insert the specified 'key' and its associated 'value' into this
+        // cache.  If 'key' already exists, then its value will be replaced
+        // with 'value'.
+
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+        // Insert the specified 'key' and its associated 'valuePtr' into this
+        // cache.  If 'key' already exists, then its value will be replaced
+        // with 'valuePtr'.
+
+    int insertBulk(const bsl::vector<KVType>& data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+        // Set the post-eviction callback to the specified
+        // 'postEvictionCallback'.  The post-eviction callback is invoked for
+        // each item evicted or removed from this cache.
+
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key' in this cache.  If the optionally specified
+        // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
+        // move the cached item to the back of the eviction queue of its shard;
+        // if 'modifyEvictionQueue' is 'true' and the eviction policy is CLOCK,
+        // then mark the cached item as referenced.  Return 0 on success, and 1
+        // if 'key' does not exist in this cache.  Note that a write lock is
+        // acquired only if the eviction policy is LRU and
+        // 'modifyEvictionQueue' is 'true'.
+
+    // ACCESSORS
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this cache that
+        // returns 'true' if two 'KEY' objects have the same value, and 'false'
+        // otherwise.
+
+    ShardedCacheEvictionPolicy::Enum evictionPolicy() const;
+        // Return the eviction policy used by this cache.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this cache to
+        // generate a hash value (of type 'std::size_t') for a 'KEY' object.
+
+    bsl::size_t highWatermark() const;
+        // Return the high watermark of this cache, as supplied at
+        // construction.
+
+    bsl::size_t lowWatermark() const;
+        // Return the low watermark of this cache, as supplied at
+        // construction.
+
+    bsl::size_t numShards() const;
+        // Return the number of shards of this cache.
+
+    bsl::size_t size() const;
+        // Return the current size of this cache.  Note that, if this cache is
+        // concurrently modified, the returned value may not reflect the size
+        // of the cache at any single point in time.
+
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this cache,
+        // shard by shard, in the order of the eviction queue of each shard,
+        // until 'visitor' returns 'false'.  The 'VISITOR' type must be a
+        // callable object that can be invoked in the same way as the function
+        // 'bool (const KEY&, const VALUE&)'.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class ShardedCache_Node
+                          // -----------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+ShardedCache_Node<KEY, VALUE>::ShardedCache_Node()
+: d_value()
+, d_prev_p(0)
+, d_next_p(0)
+, d_referenced(false)
+{
+}
+
+template <class KEY, class VALUE>
+inline
+ShardedCache_Node<KEY, VALUE>::ShardedCache_Node(
+                                            const ShardedCache_Node& original)
+: d_value(original.d_value)
+, d_prev_p(original.d_prev_p)
+, d_next_p(original.d_next_p)
+, d_referenced(original.d_referenced.loadRelaxed())
+{
+}
+
+                         // ------------------------
+                         // class ShardedCache_Shard
+                         // ------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::ShardedCache_Shard(
+                                            bsl::size_t       lowWatermark,
+                                            bsl::size_t       highWatermark,
+                                            const HASH&       hashFunction,
+                                            const EQUAL&      equalFunction,
+                                            bslma::Allocator *basicAllocator)
+: d_lock()
+, d_map(0, hashFunction, equalFunction, basicAllocator)
+, d_head_p(0)
+, d_tail_p(0)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_pad()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_map.clear();
+    d_head_p = 0;
+    d_tail_p = 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark(
+                               ShardedCacheEvictionPolicy::Enum  policy,
+                               const PostEvictionCallback&       callback)
+{
+    if (d_map.size() < d_highWatermark) {
+        return;                                                       // RETURN
+    }
+
+    while (d_map.size() >= d_lowWatermark && d_map.size() > 0) {
+        Element *element = d_head_p;
+        BSLS_ASSERT(element);
+
+        if (ShardedCacheEvictionPolicy::e_CLOCK == policy
+         && element->second.d_referenced.loadRelaxed()) {
+            // Give the element a second chance.  Every element is examined at
+            // most twice, so the loop terminates.
+
+            element->second.d_referenced.storeRelaxed(false);
+            moveToBack(element);
+            continue;
+        }
+        evict(element, callback);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::evict(
+                                         Element                     *element,
+                                         const PostEvictionCallback&  callback)
+{
+    bsl::shared_ptr<VALUE> value = element->second.d_value;
+
+    unlink(element);
+    d_map.erase(element->first);
+
+    if (callback) {
+        callback(value);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::moveToBack(Element *element)
+{
+    if (element != d_tail_p) {
+        unlink(element);
+        pushBack(element);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::pushBack(Element *element)
+{
+    element->second.d_prev_p = d_tail_p;
+    element->second.d_next_p = 0;
+    if (d_tail_p) {
+        d_tail_p->second.d_next_p = element;
+    }
+    else {
+        d_head_p = element;
+    }
+    d_tail_p = element;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::unlink(Element *element)
+{
+    Element *prev = element->second.d_prev_p;
+    Element *next = element->second.d_next_p;
+
+    if (prev) {
+        prev->second.d_next_p = next;
+    }
+    else {
+        d_head_p = next;
+    }
+    if (next) {
+        next->second.d_prev_p = prev;
+    }
+    else {
+        d_tail_p = prev;
+    }
+    element->second.d_prev_p = 0;
+    element->second.d_next_p = 0;
+}
+
+                             // ------------------
+                             // class ShardedCache
+                             // ------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::powerCeil(bsl::size_t num)
+{
+    bsl::size_t ret = 1;
+    while (ret < num) {
+        ret <<= 1;
+    }
+    return ret;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::shardWatermark(
+                                                     bsl::size_t watermark,
+                                                     bsl::size_t numShards)
+{
+    bsl::size_t ret = watermark / numShards + (watermark % numShards ? 1 : 0);
+    return ret ? ret : 1;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::createShards(
+                                                    const EQUAL& equalFunction)
+{
+    const bsl::size_t low  = shardWatermark(d_lowWatermark,  d_numShards);
+    const bsl::size_t high = shardWatermark(d_highWatermark, d_numShards);
+
+    d_shards_p = static_cast<Shard *>(
+                       d_allocator_p->allocate(d_numShards * sizeof(Shard)));
+
+    bsl::size_t i = 0;
+    BSLS_TRY {
+        for (; i < d_numShards; ++i) {
+            bslma::ConstructionUtil::construct(&d_shards_p[i],
+                                               d_allocator_p,
+                                               low,
+                                               high,
+                                               d_hasher,
+                                               equalFunction,
+                                               d_allocator_p);
+        }
+    }
+    BSLS_CATCH(...) {
+        while (i) {
+            --i;
+            bslma::DestructionUtil::destroy(&d_shards_p[i]);
+        }
+        d_allocator_p->deallocate(d_shards_p);
+        BSLS_RETHROW;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool ShardedCache<KEY, VALUE, HASH, EQUAL>::insertImp(
+                                                Shard&              shard,
+                                                const KEY&          key,
+                                                const ValuePtrType& valuePtr)
+{
+    shard.enforceHighWatermark(d_evictionPolicy, d_postEvictionCallback);
+
+    typename MapType::iterator mapIt = shard.d_map.find(key);
+    if (mapIt != shard.d_map.end()) {
+        mapIt->second.d_value = valuePtr;
+        mapIt->second.d_referenced.storeRelaxed(false);
+        shard.moveToBack(&*mapIt);
+        return false;                                                 // RETURN
+    }
+
+    Node node;
+    node.d_value = valuePtr;
+
+    mapIt = shard.d_map.emplace(key, node).first;
+    shard.pushBack(&*mapIt);
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                                      ValuePtrType *dst,
+                                                      const VALUE&  value,
+                                                      bsl::true_type)
+{
+    dst->createInplace(d_allocator_p, value, d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                                      ValuePtrType *dst,
+                                                      const VALUE&  value,
+                                                      bsl::false_type)
+{
+    dst->createInplace(d_allocator_p, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                               ValuePtrType             *dst,
+                                               bslmf::MovableRef<VALUE>  value,
+                                               bsl::true_type)
+{
+    dst->createInplace(d_allocator_p,
+                       bslmf::MovableRefUtil::move(value),
+                       d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                               ValuePtrType             *dst,
+                                               bslmf::MovableRef<VALUE>  value,
+                                               bsl::false_type)
+{
+    dst->createInplace(d_allocator_p, bslmf::MovableRefUtil::move(value));
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedCache<KEY, VALUE, HASH, EQUAL>::Shard&
+ShardedCache<KEY, VALUE, HASH, EQUAL>::shardOf(const KEY& key) const
+{
+    return d_shards_p[d_hasher(key) & d_hashMask];
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numShards(k_DEFAULT_NUM_SHARDS)
+, d_hashMask(d_numShards - 1)
+, d_shards_p(0)
+, d_hasher()
+, d_evictionPolicy(ShardedCacheEvictionPolicy::e_LRU)
+, d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+{
+    createShards(EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                              ShardedCacheEvictionPolicy::Enum  evictionPolicy,
+                              bsl::size_t                       lowWatermark,
+                              bsl::size_t                       highWatermark,
+                              bsl::size_t                       numShards,
+                              bslma::Allocator                 *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numShards(powerCeil(numShards))
+, d_hashMask(d_numShards - 1)
+, d_shards_p(0)
+, d_hasher()
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+    BSLS_ASSERT(1 <= numShards);
+
+    createShards(EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                              ShardedCacheEvictionPolicy::Enum  evictionPolicy,
+                              bsl::size_t                       lowWatermark,
+                              bsl::size_t                       highWatermark,
+                              bsl::size_t                       numShards,
+                              const HASH&                       hashFunction,
+                              const EQUAL&                      equalFunction,
+                              bslma::Allocator                 *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numShards(powerCeil(numShards))
+, d_hashMask(d_numShards - 1)
+, d_shards_p(0)
+, d_hasher(hashFunction)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+    BSLS_ASSERT(1 <= numShards);
+
+    createShards(equalFunction);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::~ShardedCache()
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        bslma::DestructionUtil::destroy(&d_shards_p[i]);
+    }
+    d_allocator_p->deallocate(d_shards_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        Shard&                          shard = d_shards_p[i];
+        bslmt::WriteLockGuard<LockType> guard(&shard.d_lock);
+        shard.clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    Shard&                          shard = shardOf(key);
+    bslmt::WriteLockGuard<LockType> guard(&shard.d_lock);
+
+    const typename MapType::iterator mapIt = shard.d_map.find(key);
+    if (mapIt == shard.d_map.end()) {
+        return 1;                                                     // RETURN
+    }
+
+    shard.evict(&*mapIt, d_postEvictionCallback);
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                  const bsl::vector<KEY>& keys)
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        count += 0 == erase(keys[i]);
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    ValuePtrType valuePtr;
+    populateValuePtrType(&valuePtr, value, bslma::UsesBslmaAllocator<VALUE>());
+
+    insert(key, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               const KEY&               key,
+                                               bslmf::MovableRef<VALUE> value)
+{
+    ValuePtrType valuePtr;
+    populateValuePtrType(&valuePtr,
+                         bslmf::MovableRefUtil::move(value),
+                         bslma::UsesBslmaAllocator<VALUE>());
+
+    insert(key, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 const KEY&          key,
+                                                 const ValuePtrType& valuePtr)
+{
+    Shard&                          shard = shardOf(key);
+    bslmt::WriteLockGuard<LockType> guard(&shard.d_lock);
+
+    insertImp(shard, key, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                              const bsl::vector<KVType>& data)
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        Shard&                          shard = shardOf(data[i].first);
+        bslmt::WriteLockGuard<LockType> guard(&shard.d_lock);
+
+        count += insertImp(shard, data[i].first, data[i].second);
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    // Every shard must be write locked, since any shard may invoke the
+    // callback.
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].d_lock.lockWrite();
+    }
+
+    d_postEvictionCallback = postEvictionCallback;
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].d_lock.unlock();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    Shard& shard = shardOf(key);
+
+    const bool writeLock = modifyEvictionQueue &&
+                       ShardedCacheEvictionPolicy::e_LRU == d_evictionPolicy;
+    if (writeLock) {
+        shard.d_lock.lockWrite();
+    }
+    else {
+        shard.d_lock.lockRead();
+    }
+
+    // Since the guard is constructed with a locked synchronization object, the
+    // guard's call to 'unlock' correctly handles both read and write
+    // scenarios.
+
+    bslmt::ReadLockGuard<LockType> guard(&shard.d_lock, true);
+
+    typename MapType::iterator mapIt = shard.d_map.find(key);
+    if (mapIt == shard.d_map.end()) {
+        return 1;                                                     // RETURN
+    }
+
+    *value = mapIt->second.d_value;
+
+    if (writeLock) {
+        shard.moveToBack(&*mapIt);
+    }
+    else if (modifyEvictionQueue
+          && ShardedCacheEvictionPolicy::e_CLOCK == d_evictionPolicy
+          && !mapIt->second.d_referenced.loadRelaxed()) {
+        // Avoid writing to the cache line of the element if the element is
+        // already marked.
+
+        mapIt->second.d_referenced.storeRelaxed(true);
+    }
+
+    return 0;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_shards_p[0].d_map.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+ShardedCacheEvictionPolicy::Enum
+ShardedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_evictionPolicy;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_numShards;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t ret = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        const Shard&                   shard = d_shards_p[i];
+        bslmt::ReadLockGuard<LockType> guard(&shard.d_lock);
+        ret += shard.d_map.size();
+    }
+    return ret;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        const Shard&                   shard = d_shards_p[i];
+        bslmt::ReadLockGuard<LockType> guard(&shard.d_lock);
+
+        for (const Element *element = shard.d_head_p;
+             element;
+             element = element->second.d_next_p) {
+            if (!visitor(element->first, *element->second.d_value)) {
+                return;                                               // RETURN
+            }
+        }
+    }
+}
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlcc::ShardedCache<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1018 @@
+// bdlcc_shardedcache.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_shardedcache.h>
+
+#include <bdlcc_cache.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>     // 'sprintf'
+#include <bsl_cstdlib.h>    // 'atoi'
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::ShardedCache', that
+// provides an in-memory key-value cache partitioned into independently locked
+// shards.  Since the locking of each shard is delegated to
+// 'bslmt::ReaderWriterMutex', and the storage of each shard to
+// 'bsl::unordered_map', the tests concentrate on the distribution of keys
+// among shards, on the intrusive eviction queue maintained by each shard, and
+// on the three eviction policies.
+//
+// A 'bdlcc::ShardedCache' having a single shard behaves as a 'bdlcc::Cache'
+// for the LRU and FIFO policies; we use this property to verify the eviction
+// order against 'bdlcc::Cache' as an oracle.
+//
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit ShardedCache(bslma::Allocator *basicAllocator);
+// [ 2] ShardedCache(policy, low, high, numShards, basicAllocator);
+// [ 2] ShardedCache(policy, low, high, numShards, hash, equal, alloc);
+// [ 2] ~ShardedCache();
+//
+// MANIPULATORS
+// [ 2] void insert(const KEY& key, const VALUE& value);
+// [ 2] void insert(const KEY& key, MovableRef<VALUE> value);
+// [ 2] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 5] int insertBulk(const bsl::vector<KVType>& data);
+// [ 2] int tryGetValue(value, key, modifyEvictionQueue);
+// [ 5] int erase(const KEY& key);
+// [ 5] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 5] void clear();
+// [ 5] void setPostEvictionCallback(postEvictionCallback);
+//
+// ACCESSORS
+// [ 2] EQUAL equalFunction() const;
+// [ 2] ShardedCacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 2] HASH hashFunction() const;
+// [ 2] bsl::size_t highWatermark() const;
+// [ 2] bsl::size_t lowWatermark() const;
+// [ 2] bsl::size_t numShards() const;
+// [ 2] bsl::size_t size() const;
+// [ 3] void visit(VISITOR& visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] LRU AND FIFO EVICTION ORDER
+// [ 4] CLOCK EVICTION
+// [ 6] CONCURRENCY
+// [ 7] USAGE EXAMPLE
+// [-1] READ PERFORMANCE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlcc::ShardedCacheEvictionPolicy Policy;
+
+typedef bdlcc::ShardedCache<int, bsl::string> Obj;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct KeyCollector {
+    // This visitor appends the keys of the visited items to a vector.
+
+    // DATA
+    bsl::vector<int> *d_keys_p;
+
+    // CREATORS
+    explicit KeyCollector(bsl::vector<int> *keys)
+    : d_keys_p(keys)
+    {
+    }
+
+    // MANIPULATORS
+    template <class VALUE>
+    bool operator()(int key, const VALUE&)
+        // Append the specified 'key' to the vector and return 'true'.
+    {
+        d_keys_p->push_back(key);
+        return true;
+    }
+};
+
+struct ModHash {
+    // This hash functor returns the key itself, so that the shard of a key is
+    // predictable.
+
+    bsl::size_t operator()(int key) const
+        // Return the specified 'key'.
+    {
+        return static_cast<bsl::size_t>(key);
+    }
+};
+
+bsl::vector<int> *g_evicted_p = 0;
+
+void recordEviction(const bsl::shared_ptr<bsl::string>& value)
+    // Append the integer value of the specified 'value' to '*g_evicted_p'.
+{
+    g_evicted_p->push_back(atoi(value->c_str()));
+}
+
+bsl::string toString(int value)
+    // Return the decimal representation of the specified 'value'.
+{
+    char buffer[16];
+    bsl::sprintf(buffer, "%d", value);
+    return bsl::string(buffer);
+}
+
+struct StopAfterTwo {
+    // This visitor counts the visited items, and stops after two.
+
+    // DATA
+    int d_count;
+
+    // CREATORS
+    StopAfterTwo()
+    : d_count(0)
+    {
+    }
+
+    // MANIPULATORS
+    bool operator()(int, int)
+        // Return 'true' if fewer than two items have been visited.
+    {
+        return ++d_count < 2;
+    }
+};
+
+enum { k_NUM_ITERATIONS = 20000, k_NUM_KEYS = 512, k_NUM_READ_KEYS = 100000 };
+
+void concurrencyWorker(bdlcc::ShardedCache<int, int> *cache,
+                       bsls::AtomicInt               *errors,
+                       int                            seed)
+    // Perform a pseudo-random sequence, determined by the specified 'seed', of
+    // 'insert', 'tryGetValue', and 'erase' operations on the specified
+    // 'cache', and increment the specified 'errors' for each value retrieved
+    // that does not match its key.
+{
+    unsigned int state = seed;
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        state = state * 1103515245 + 12345;
+        const int key = (state >> 8) % k_NUM_KEYS;
+        const int op  = (state >> 20) % 8;
+
+        if (op < 3) {
+            cache->insert(key, key * 2);
+        }
+        else if (op < 7) {
+            bsl::shared_ptr<int> value;
+            if (0 == cache->tryGetValue(&value, key) && key * 2 != *value) {
+                ++*errors;
+            }
+        }
+        else {
+            cache->erase(key);
+        }
+    }
+}
+
+template <class CACHE>
+void readWorker(CACHE *cache, bslmt::Barrier *barrier, int numReads, int seed)
+    // Wait on the specified 'barrier', then perform the specified 'numReads'
+    // lookups of pseudo-random keys, determined by the specified 'seed', in
+    // the specified 'cache'.
+{
+    barrier->wait();
+    unsigned int         state = seed;
+    bsl::shared_ptr<int> value;
+    for (int i = 0; i < numReads; ++i) {
+        state = state * 1103515245 + 12345;
+        cache->tryGetValue(&value, (state >> 8) % k_NUM_READ_KEYS);
+    }
+}
+
+template <class CACHE>
+double measureReads(CACHE *cache, int numThreads, int numReads)
+    // Populate the specified 'cache' and return the elapsed time, in seconds,
+    // taken by the specified 'numThreads' threads to each perform the
+    // specified 'numReads' lookups in 'cache'.
+{
+    for (int i = 0; i < k_NUM_READ_KEYS; ++i) {
+        cache->insert(i, i);
+    }
+
+    bslmt::Barrier     barrier(numThreads + 1);
+    bslmt::ThreadGroup tg;
+    for (int i = 0; i < numThreads; ++i) {
+        tg.addThread(bdlf::BindUtil::bind(&readWorker<CACHE>,
+                                          cache,
+                                          &barrier,
+                                          numReads,
+                                          i + 1));
+    }
+    bsls::Stopwatch timer;
+    timer.start();
+    barrier.wait();
+    tg.joinAll();
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                 USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usageExample1 {
+
+void example1(bslma::Allocator *basicAllocator)
+{
+    bslma::Allocator& talloc = *basicAllocator;
+
+// First, we define a 'bdlcc::ShardedCache' object, 'priceCache', mapping an
+// instrument identifier to its price, having 4 shards, and holding at most 8
+// items:
+//..
+    bdlcc::ShardedCache<int, double> priceCache(
+                                    bdlcc::ShardedCacheEvictionPolicy::e_CLOCK,
+                                    8,
+                                    8,
+                                    4,
+                                    &talloc);
+    ASSERT(4 == priceCache.numShards());
+//..
+// Then, we insert the prices of a few instruments:
+//..
+    priceCache.insert(1, 101.25);
+    priceCache.insert(2, 99.5);
+    priceCache.insert(3, 100.0);
+    ASSERT(3 == priceCache.size());
+//..
+// Next, we look up the price of an instrument:
+//..
+    bsl::shared_ptr<double> price;
+    int                     rc = priceCache.tryGetValue(&price, 2);
+    ASSERT(0    == rc);
+    ASSERT(99.5 == *price);
+//..
+// Then, we look up an instrument that is not in the cache:
+//..
+    rc = priceCache.tryGetValue(&price, 4);
+    ASSERT(1 == rc);
+//..
+// Now, we insert enough prices to exceed the capacity of the cache.  Each of
+// the 4 shards holds at most 2 items, so eviction begins when a shard holds 2
+// items:
+//..
+    for (int i = 4; i < 100; ++i) {
+        priceCache.insert(i, 100.0 + i);
+    }
+    ASSERT(priceCache.size() <= 8);
+//..
+// Finally, we observe that the most recently inserted price is still cached:
+//..
+    rc = priceCache.tryGetValue(&price, 99);
+    ASSERT(0     == rc);
+    ASSERT(199.0 == *price);
+//..
+}
+
+}  // close namespace usageExample1
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("usage", veryVeryVeryVerbose);
+
+        usageExample1::example1(&ta);
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Concurrent inserts, lookups, and erasures on a cache with each of
+        //:   the eviction policies do not corrupt the cache.
+        //:
+        //: 2 The watermarks of each shard are respected under concurrent
+        //:   insertion.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 For each eviction policy, run a number of threads, each
+        //:   performing a mix of 'insert', 'tryGetValue', and 'erase' on a
+        //:   shared range of keys.  Verify that every value obtained matches
+        //:   its key, that the size of the cache does not exceed the high
+        //:   watermark, and that 'visit' observes a consistent eviction queue.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        enum { k_NUM_THREADS = 8 };
+
+        const Policy::Enum POLICIES[] = {
+            Policy::e_LRU, Policy::e_FIFO, Policy::e_CLOCK
+        };
+
+        for (int ti = 0; ti < 3; ++ti) {
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+            {
+                bdlcc::ShardedCache<int, int> mX(POLICIES[ti],
+                                                 100,
+                                                 128,
+                                                 8,
+                                                 &ta);
+
+                bsls::AtomicInt errors(0);
+
+                bslmt::ThreadGroup tg(&ta);
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    tg.addThread(bdlf::BindUtil::bind(&concurrencyWorker,
+                                                      &mX,
+                                                      &errors,
+                                                      i + 1));
+                }
+                tg.joinAll();
+
+                ASSERTV(ti, errors, 0 == errors);
+                ASSERTV(ti, mX.size(), mX.size() <= 128);
+
+                bsl::vector<int> keys(&ta);
+                KeyCollector     collector(&keys);
+                mX.visit(collector);
+                ASSERTV(ti, keys.size(), mX.size(), keys.size() == mX.size());
+            }
+            ASSERTV(ti, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ERASE, CLEAR, BULK OPERATIONS, AND POST-EVICTION CALLBACK
+        //
+        // Concerns:
+        //: 1 'erase' removes only the specified key, invokes the post-eviction
+        //:   callback, and returns 1 if the key is not in the cache.
+        //:
+        //: 2 'eraseBulk' and 'insertBulk' return the number of affected items.
+        //:
+        //: 3 'clear' removes all items without invoking the callback, and the
+        //:   eviction queues of all shards remain usable afterwards.
+        //:
+        //: 4 Erasing an item in the middle, front, or back of an eviction
+        //:   queue correctly unlinks it.
+        //
+        // Plan:
+        //: 1 Populate a cache and use 'erase', 'eraseBulk', 'insertBulk', and
+        //:   'clear', verifying the state with 'size', 'tryGetValue', 'visit',
+        //:   and the keys recorded by the post-eviction callback.  (C-1..4)
+        //
+        // Testing:
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int erase(const KEY& key);
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        //   void clear();
+        //   void setPostEvictionCallback(postEvictionCallback);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ERASE, CLEAR, BULK OPERATIONS, AND CALLBACK"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            bsl::vector<int> evicted(&ta);
+            g_evicted_p = &evicted;
+
+            bdlcc::ShardedCache<int, bsl::string, ModHash> mX(
+                                                         Policy::e_LRU,
+                                                         100,
+                                                         100,
+                                                         2,
+                                                         ModHash(),
+                                                         bsl::equal_to<int>(),
+                                                         &ta);
+            const bdlcc::ShardedCache<int, bsl::string, ModHash>& X = mX;
+
+            mX.setPostEvictionCallback(&recordEviction);
+
+            typedef bdlcc::ShardedCache<int, bsl::string, ModHash>::KVType
+                                                                        KVType;
+
+            bsl::vector<KVType> data(&ta);
+            for (int i = 0; i < 10; ++i) {
+                bsl::shared_ptr<bsl::string> value;
+                value.createInplace(&ta, toString(i), &ta);
+                data.push_back(KVType(i, value));
+            }
+            ASSERT(10 == mX.insertBulk(data));
+            ASSERT( 0 == mX.insertBulk(data));
+            ASSERT(10 == X.size());
+            ASSERT(evicted.empty());
+
+            // Keys 0, 2, 4, 6, 8 are in shard 0; remove the front (0), middle
+            // (4), and back (8) of its queue.
+
+            ASSERT(0 == mX.erase(0));
+            ASSERT(0 == mX.erase(4));
+            ASSERT(0 == mX.erase(8));
+            ASSERT(1 == mX.erase(8));
+            ASSERT(7 == X.size());
+            ASSERT(3 == evicted.size());
+            ASSERT(0 == evicted[0] && 4 == evicted[1] && 8 == evicted[2]);
+
+            bsl::vector<int> keys(&ta);
+            KeyCollector     collector(&keys);
+            X.visit(collector);
+
+            const int EXP[] = { 2, 6, 1, 3, 5, 7, 9 };
+            ASSERT(7 == keys.size());
+            for (int i = 0; i < 7 && i < static_cast<int>(keys.size()); ++i) {
+                ASSERTV(i, keys[i], EXP[i] == keys[i]);
+            }
+
+            bsl::vector<int> eraseKeys(&ta);
+            eraseKeys.push_back(1);
+            eraseKeys.push_back(2);
+            eraseKeys.push_back(42);
+            ASSERT(2 == mX.eraseBulk(eraseKeys));
+            ASSERT(5 == X.size());
+            ASSERT(5 == evicted.size());
+
+            evicted.clear();
+            mX.clear();
+            ASSERT(0 == X.size());
+            ASSERT(evicted.empty());
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(1 == mX.tryGetValue(&value, 3));
+
+            mX.insert(3, "three");
+            mX.insert(4, "four");
+            ASSERT(2 == X.size());
+            ASSERT(0 == mX.tryGetValue(&value, 3));
+            ASSERT("three" == *value);
+
+            g_evicted_p = 0;
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CLOCK EVICTION
+        //
+        // Concerns:
+        //: 1 An item that has been read since it was last examined by the
+        //:   clock hand is not evicted, but is moved to the back of the
+        //:   eviction queue and its mark is cleared.
+        //:
+        //: 2 If every item is marked, eviction still terminates, evicting the
+        //:   oldest item after clearing all marks.
+        //:
+        //: 3 'tryGetValue' with 'modifyEvictionQueue == false' does not mark
+        //:   the item.
+        //
+        // Plan:
+        //: 1 Using a single shard with watermarks of 4, insert 4 items, read
+        //:   some of them, insert another item, and verify the evicted keys
+        //:   and the resulting eviction order.  (C-1..3)
+        //
+        // Testing:
+        //   CLOCK EVICTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLOCK EVICTION" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            bsl::vector<int> evicted(&ta);
+            g_evicted_p = &evicted;
+
+            Obj mX(Policy::e_CLOCK, 4, 4, 1, &ta);
+            mX.setPostEvictionCallback(&recordEviction);
+
+            for (int i = 0; i < 4; ++i) {
+                mX.insert(i, toString(i));
+            }
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            ASSERT(0 == mX.tryGetValue(&value, 1, false));
+            ASSERT(0 == mX.tryGetValue(&value, 2));
+
+            mX.insert(4, toString(4));
+
+            // 0 is given a second chance, 1 is evicted.
+
+            ASSERT(1 == evicted.size());
+            ASSERT(1 == evicted[0]);
+
+            bsl::vector<int> keys(&ta);
+            KeyCollector     collector(&keys);
+            mX.visit(collector);
+
+            const int EXP1[] = { 2, 3, 0, 4 };
+            ASSERT(4 == keys.size());
+            for (int i = 0; i < 4 && i < static_cast<int>(keys.size()); ++i) {
+                ASSERTV(i, keys[i], EXP1[i] == keys[i]);
+            }
+
+            // Mark every item; the oldest item is evicted after a full sweep.
+
+            for (int i = 0; i < 5; ++i) {
+                mX.tryGetValue(&value, i);
+            }
+            evicted.clear();
+            mX.insert(5, toString(5));
+
+            ASSERT(1 == evicted.size());
+            ASSERT(2 == evicted[0]);
+            ASSERT(4 == mX.size());
+
+            g_evicted_p = 0;
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // LRU AND FIFO EVICTION ORDER
+        //
+        // Concerns:
+        //: 1 With a single shard, the LRU and FIFO eviction order is the same
+        //:   as that of 'bdlcc::Cache' having the same watermarks.
+        //:
+        //: 2 With several shards, the size of each shard is limited to its
+        //:   share of the watermarks.
+        //:
+        //: 3 'visit' iterates in eviction order and stops when the visitor
+        //:   returns 'false'.
+        //
+        // Plan:
+        //: 1 Perform the same pseudo-random sequence of 'insert' and
+        //:   'tryGetValue' on a single-shard 'bdlcc::ShardedCache' and on a
+        //:   'bdlcc::Cache', and compare the keys visited in both after each
+        //:   operation.  (C-1,3)
+        //:
+        //: 2 Insert many keys into a cache having 4 shards, and verify the
+        //:   total size is bounded by the sum of the shard watermarks.  (C-2)
+        //
+        // Testing:
+        //   LRU AND FIFO EVICTION ORDER
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LRU AND FIFO EVICTION ORDER" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const Policy::Enum POLICY = ti ? Policy::e_FIFO : Policy::e_LRU;
+            const bdlcc::CacheEvictionPolicy::Enum ORACLE_POLICY =
+                                  ti ? bdlcc::CacheEvictionPolicy::e_FIFO
+                                     : bdlcc::CacheEvictionPolicy::e_LRU;
+
+            bdlcc::ShardedCache<int, int> mX(POLICY, 6, 9, 1, &ta);
+            bdlcc::Cache<int, int>        oracle(ORACLE_POLICY, 6, 9, &ta);
+
+            unsigned int state = 7;
+            for (int i = 0; i < 2000; ++i) {
+                state = state * 1103515245 + 12345;
+                const int key = (state >> 8) % 20;
+
+                if ((state >> 20) % 2) {
+                    mX.insert(key, i);
+                    oracle.insert(key, i);
+                }
+                else {
+                    bsl::shared_ptr<int> v1, v2;
+                    int rc1 = mX.tryGetValue(&v1, key);
+                    int rc2 = oracle.tryGetValue(&v2, key);
+                    ASSERTV(ti, i, rc1, rc2, rc1 == rc2);
+                    if (0 == rc1 && 0 == rc2) {
+                        ASSERTV(ti, i, *v1 == *v2);
+                    }
+                }
+
+                bsl::vector<int> keys1(&ta), keys2(&ta);
+                KeyCollector     c1(&keys1), c2(&keys2);
+                mX.visit(c1);
+                oracle.visit(c2);
+                ASSERTV(ti, i, keys1 == keys2);
+            }
+
+            StopAfterTwo stopper;
+            mX.visit(stopper);
+            ASSERTV(stopper.d_count, 2 == stopper.d_count);
+        }
+
+        {
+            bdlcc::ShardedCache<int, int> mX(Policy::e_LRU, 10, 13, 4, &ta);
+            ASSERT(4 == mX.numShards());
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i, i);
+
+                // Each shard holds at most 'ceil(13 / 4) == 4' items.
+
+                ASSERTV(i, mX.size(), mX.size() <= 16);
+            }
+            ASSERTV(mX.size(), mX.size() >= 12);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, INSERT, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an empty cache having the specified
+        //:   attributes, with the number of shards rounded up to a power of 2.
+        //:
+        //: 2 All memory is obtained from the supplied allocator, and is
+        //:   released on destruction.
+        //:
+        //: 3 'insert' adds a new item, or replaces the value of an existing
+        //:   item, and 'tryGetValue' retrieves it.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, verify the attributes,
+        //:   and perform inserts and lookups using a test allocator.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   explicit ShardedCache(bslma::Allocator *basicAllocator);
+        //   ShardedCache(policy, low, high, numShards, basicAllocator);
+        //   ShardedCache(policy, low, high, numShards, hash, equal, alloc);
+        //   ~ShardedCache();
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, MovableRef<VALUE> value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   int tryGetValue(value, key, modifyEvictionQueue);
+        //   EQUAL equalFunction() const;
+        //   ShardedCacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsl::size_t numShards() const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, INSERT, AND BASIC ACCESSORS" << endl
+                          << "=====================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(Policy::e_LRU             == X.evictionPolicy());
+            ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+            ASSERT(0                         == X.size());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                            X.lowWatermark());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                           X.highWatermark());
+            ASSERT(0 <  ta.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        {
+            const struct {
+                int          d_line;
+                bsl::size_t  d_numShards;
+                bsl::size_t  d_expShards;
+            } DATA[] = {
+                { L_,  1,  1 },
+                { L_,  2,  2 },
+                { L_,  3,  4 },
+                { L_,  8,  8 },
+                { L_,  9, 16 },
+                { L_, 64, 64 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                Obj mX(Policy::e_FIFO, 10, 20, DATA[ti].d_numShards, &ta);
+                const Obj& X = mX;
+
+                ASSERTV(LINE, DATA[ti].d_expShards == X.numShards());
+                ASSERTV(LINE, Policy::e_FIFO       == X.evictionPolicy());
+                ASSERTV(LINE, 10                   == X.lowWatermark());
+                ASSERTV(LINE, 20                   == X.highWatermark());
+            }
+        }
+
+        {
+            bdlcc::ShardedCache<int, bsl::string, ModHash> mX(
+                                                         Policy::e_CLOCK,
+                                                         10,
+                                                         20,
+                                                         4,
+                                                         ModHash(),
+                                                         bsl::equal_to<int>(),
+                                                         &ta);
+            const bdlcc::ShardedCache<int, bsl::string, ModHash>& X = mX;
+
+            ASSERT(Policy::e_CLOCK == X.evictionPolicy());
+            ASSERT(7 == X.hashFunction()(7));
+            ASSERT(X.equalFunction()(3, 3));
+            ASSERT(!X.equalFunction()(3, 4));
+
+            const bsl::string LONG("a string long enough to allocate memory",
+                                   &ta);
+
+            mX.insert(1, LONG);
+            ASSERT(1 == X.size());
+
+            bsl::string moved(LONG, &ta);
+            mX.insert(2, bslmf::MovableRefUtil::move(moved));
+            ASSERT(2 == X.size());
+
+            bsl::shared_ptr<bsl::string> ptr;
+            ptr.createInplace(&ta, "three", &ta);
+            mX.insert(3, ptr);
+            ASSERT(3 == X.size());
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, 1));
+            ASSERT(LONG == *value);
+            ASSERT(&ta == value->get_allocator().mechanism());
+
+            ASSERT(0 == mX.tryGetValue(&value, 3));
+            ASSERT(ptr == value);
+
+            ASSERT(1 == mX.tryGetValue(&value, 4));
+            ASSERT(ptr == value);
+
+            mX.insert(1, "replaced");
+            ASSERT(3 == X.size());
+            ASSERT(0 == mX.tryGetValue(&value, 1));
+            ASSERT("replaced" == *value);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, look up, and erase a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj mX(Policy::e_LRU, 100, 200, 4, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 50; ++i) {
+                mX.insert(i, toString(i));
+            }
+            ASSERT(50 == X.size());
+
+            for (int i = 0; i < 50; ++i) {
+                bsl::shared_ptr<bsl::string> value;
+                ASSERTV(i, 0 == mX.tryGetValue(&value, i));
+                ASSERTV(i, toString(i) == *value);
+            }
+
+            ASSERT(0 == mX.erase(10));
+            ASSERT(1 == mX.erase(10));
+            ASSERT(49 == X.size());
+
+            mX.clear();
+            ASSERT(0 == X.size());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // READ PERFORMANCE
+        //
+        // Concerns:
+        //: 1 Lookups in a 'bdlcc::ShardedCache' scale with the number of
+        //:   threads better than lookups in a 'bdlcc::Cache'.
+        //
+        // Plan:
+        //: 1 Pre-populate a 'bdlcc::Cache' and 'bdlcc::ShardedCache' objects
+        //:   having each eviction policy, and measure the time taken by a
+        //:   number of threads each performing many lookups.  (C-1)
+        //
+        // Testing:
+        //   READ PERFORMANCE
+        // --------------------------------------------------------------------
+
+        int numThreads = argc > 2 ? atoi(argv[2]) : 8;
+        int numReads   = argc > 3 ? atoi(argv[3]) : 1000000;
+
+        cout << "READ PERFORMANCE: " << numThreads << " threads, "
+             << numReads << " reads per thread" << endl;
+
+        bslma::TestAllocator ta("perf", veryVeryVeryVerbose);
+
+        {
+            bdlcc::Cache<int, int> cache(bdlcc::CacheEvictionPolicy::e_LRU,
+                                         2 * k_NUM_READ_KEYS,
+                                         2 * k_NUM_READ_KEYS,
+                                         &ta);
+            cout << "Cache        LRU:   "
+                 << measureReads(&cache, numThreads, numReads) << endl;
+        }
+        {
+            bdlcc::Cache<int, int> cache(bdlcc::CacheEvictionPolicy::e_FIFO,
+                                         2 * k_NUM_READ_KEYS,
+                                         2 * k_NUM_READ_KEYS,
+                                         &ta);
+            cout << "Cache        FIFO:  "
+                 << measureReads(&cache, numThreads, numReads) << endl;
+        }
+
+        const char *NAMES[] = { "LRU:   ", "FIFO:  ", "CLOCK: " };
+        const Policy::Enum POLICIES[] = {
+            Policy::e_LRU, Policy::e_FIFO, Policy::e_CLOCK
+        };
+        for (int i = 0; i < 3; ++i) {
+            bdlcc::ShardedCache<int, int> cache(POLICIES[i],
+                                                2 * k_NUM_READ_KEYS,
+                                                2 * k_NUM_READ_KEYS,
+                                                64,
+                                                &ta);
+            cout << "ShardedCache " << NAMES[i]
+                 << measureReads(&cache, numThreads, numReads) << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (test >= 0) {
+        // CONCERN: In no case does memory come from the default allocator.
+
+        ASSERT(dam.isTotalSame());
+
+        // CONCERN: In no case does memory come from the global allocator.
+
+        ASSERT(gam.isTotalSame());
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -19,6 +19,62 @@ BSLS_IDENT_RCSID(bdlcc_stripedunorderedcontainerimpl,"$Id$ $CSID$")
 // table, but the stripes are locked one at a time.
 //
 // The number of stripes must not be bigger than the number of buckets.
+//
+// In read-mostly mode each stripe's lock element is a reader-indicator lock:
+// a reader increments the indicator of its slot (chosen by hashing the thread
+// id) and then checks the writer flag of the stripe; a writer acquires the
+// reader-writer mutex (excluding other writers), sets the writer flag, and
+// then waits for all indicators of the stripe to drain.  Because both sides
+// use sequentially consistent operations (store-then-load on each side), at
+// least one of them observes the other, so a reader never runs concurrently
+// with a writer.  A reader that observes the flag withdraws its indicator and
+// waits for the writer by briefly acquiring the mutex for read.
+//
+// The indicators are laid out slot-major: the row of a slot holds one
+// indicator per stripe, and rows are aligned to (and padded to a multiple of)
+// the effective cache-line size.  Readers in different slots therefore never
+// write to the same cache line, while a single thread's indicators for all
+// the stripes are packed together.  Optimistic (sequence-lock or epoch-based)
+// reads were not used: writers free nodes and modify values in place, and
+// the container has no deferred reclamation scheme that would make reading
+// through a concurrently modified bucket safe.
+
+namespace BloombergLP {
+namespace bdlcc {
+
+             // -----------------------------------------------
+             // class StripedUnorderedContainerImpl_LockElement
+             // -----------------------------------------------
+
+// PRIVATE MANIPULATORS
+void StripedUnorderedContainerImpl_LockElement::lockRSlow(
+                                                  bsls::AtomicInt *readerCount)
+{
+    do {
+        readerCount->addAcqRel(-1);
+
+        // Block until the writer releases 'd_lock'.
+
+        d_lock.lockRead();
+        d_lock.unlockRead();
+
+        readerCount->add(1);
+    } while (0 != d_writerActive.load());
+}
+
+void StripedUnorderedContainerImpl_LockElement::waitForReaders()
+{
+    for (int i = 0; i < k_NUM_READER_SLOTS; ++i) {
+        const bsls::AtomicInt& readerCount =
+                                    d_readerCounts_p[i * d_readerCountsStride];
+        while (0 != readerCount.load()) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
 // Copyright 2018 Bloomberg Finance L.P.
@@ -60,6 +60,22 @@ BSLS_IDENT("$Id: $")
 // plateau is reached roughly at four times the number of the threads
 // *concurrently* using the hash map.
 //
+///Read-Mostly Mode
+///----------------
+// By default ('e_READ_LOCKED'), 'getValue' acquires the read lock of the
+// stripe, which writes to the cache line of that lock; with many concurrent
+// readers of the same stripe that line is contended even though no writer is
+// active.  A container created with 'e_READ_MOSTLY' instead gives each stripe
+// a set of 64 reader indicators ("slots"), in cache lines private to the
+// slot, to which reader threads are assigned by hashing their thread id.
+// A reader increments its indicator and proceeds unless a writer is active;
+// a writer acquires the lock of the stripe, flags itself as active, and waits
+// until the indicators of the stripe drain.  Reads therefore scale with the
+// number of reader threads, while every write operation (including 'clear',
+// 'rehash', and 'visit') pays for a scan of the indicators.  This mode is
+// appropriate when reads vastly outnumber writes.  The indicators occupy 64
+// cache-line-aligned rows of 'numStripes()' integers.
+//
 ///Rehash
 ///------
 //
@@ -100,6 +116,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslma_allocator.h>
 #include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
 #include <bslma_default.h>
 #include <bslma_destructionutil.h>
 #include <bslma_destructorproctor.h>
@@ -111,12 +128,15 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_readerwritermutex.h>
 #include <bslmt_readlockguard.h>
+#include <bslmt_threadutil.h>
 #include <bslmt_writelockguard.h>
 
+#include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>   // BSLS_PLATFORM_CPU_X86_64
+#include <bsls_types.h>
 
 #include <bslstl_hash.h>
 #include <bslstl_pair.h>
@@ -407,6 +427,16 @@ class StripedUnorderedContainerImpl {
         k_DEFAULT_NUM_STRIPES  =  4  // Default # of stripes
     };
 
+    enum ReadMode {
+        // Enumeration of the synchronization used by readers (see
+        // {Read-Mostly Mode}).
+
+        e_READ_LOCKED = 0,  // Readers acquire the read lock of the stripe.
+
+        e_READ_MOSTLY       // Readers announce themselves in per-thread
+                            // indicators; writers wait for them to drain.
+    };
+
     typedef StripedUnorderedContainerImpl_Node<KEY, VALUE> Node;
         // Node in a bucket.
 
@@ -510,6 +540,10 @@ class StripedUnorderedContainerImpl {
         // Pointer to an array of locks for the stripes.  Note that mutex can't
         // be moved or copied, hence can't be in a vector.
 
+    void                             *d_readerCounts_p;
+        // Memory holding the reader indicators of all the stripes in
+        // 'e_READ_MOSTLY' mode, or 0 in 'e_READ_LOCKED' mode (owned)
+
     bslma::Allocator                 *d_allocator_p;
         // memory allocator (held, not owned)
 
@@ -542,6 +576,11 @@ class StripedUnorderedContainerImpl {
         // Perform a rehash if the 'loadFactor() > maxLoadFactor()', and
         // 'true == canRehash()'.
 
+    void createLocks(ReadMode readMode);
+        // Allocate and construct the lock elements of the stripes, and, if the
+        // specified 'readMode' is 'e_READ_MOSTLY', their reader indicators.
+        // This method is called only by the constructors.
+
     bsl::size_t erase(const KEY& key, Scope scope);
         // Remove from this hash map the element, if any, having the specified
         // 'key'.  If there a multiple elements having 'key' and the specified
@@ -698,7 +737,21 @@ class StripedUnorderedContainerImpl {
         // of buckets and the (fixed) number of stripes in this map.
         // Optionally specify a 'basicAllocator' used to supply memory.  If
         // 'basicAllocator' is 0, the currently installed default allocator is
-        // used.  The hash map has rehash enabled.
+        // used.  The hash map has rehash enabled, and its readers acquire the
+        // read lock of the stripe (i.e., 'e_READ_LOCKED == readMode()').
+
+    StripedUnorderedContainerImpl(bsl::size_t       numInitialBuckets,
+                                  bsl::size_t       numStripes,
+                                  ReadMode          readMode,
+                                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'StripedUnorderedContainerImpl' object, a fully
+        // thread-safe hash map where access is divided into "stripes", having
+        // at least the specified 'numInitialBuckets' buckets and the
+        // specified (fixed) 'numStripes' stripes, whose readers use the
+        // synchronization indicated by the specified 'readMode' (see
+        // {Read-Mostly Mode}).  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The hash map has rehash enabled.
 
     ~StripedUnorderedContainerImpl();
         // Destroy this hash map.  This method is *not* thread-safe.
@@ -998,6 +1051,9 @@ class StripedUnorderedContainerImpl {
     bsl::size_t numStripes() const;
         // Return the number of stripes in the hash.
 
+    ReadMode readMode() const;
+        // Return the synchronization used by readers of this hash map.
+
     bsl::size_t size() const;
         // Return the current number of elements in this hash.
 
@@ -1061,7 +1117,22 @@ class StripedUnorderedContainerImpl_TestUtil {
                 // ===============================================
 
 class StripedUnorderedContainerImpl_LockElement {
-    // A mutex + support info; padded to cacheline size, one per stripe
+    // A mutex + support info; padded to cacheline size, one per stripe.  A
+    // lock element optionally refers to a column of reader indicators (see
+    // {Read-Mostly Mode}), in which case readers announce themselves by
+    // incrementing the indicator of their slot instead of acquiring 'd_lock',
+    // and writers wait for every indicator of the column to drain.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_READER_SLOT_BITS = 6,
+        // log2 of the number of reader indicators per stripe
+
+        k_NUM_READER_SLOTS = 1 << k_READER_SLOT_BITS
+        // Number of reader indicators per stripe.  Reader threads are hashed
+        // onto slots by thread id.
+    };
 
   private:
     // PRIVATE TYPES
@@ -1078,19 +1149,67 @@ class StripedUnorderedContainerImpl_LockElement {
         k_EFFECTIVE_CACHELINE_SIZE = (1 + k_PREFETCH_ENABLED) *
                                             bslmt::Platform::e_CACHE_LINE_SIZE,
         // Cacheline size to use; may be 1 or 2 cachelines
-        k_LOCK_PADDING = k_EFFECTIVE_CACHELINE_SIZE >= sizeof(LockType) ?
-                         k_EFFECTIVE_CACHELINE_SIZE -  sizeof(LockType) :
-                     2 * k_EFFECTIVE_CACHELINE_SIZE -  sizeof(LockType)
+        k_DATA_SIZE = sizeof(LockType)
+                    + sizeof(bsls::AtomicInt)
+                    + sizeof(bsls::AtomicInt *)
+                    + sizeof(bsl::size_t),
+        // Size of the data members, excluding the padding
+        k_LOCK_PADDING = k_EFFECTIVE_CACHELINE_SIZE >= k_DATA_SIZE ?
+                         k_EFFECTIVE_CACHELINE_SIZE -  k_DATA_SIZE :
+                     2 * k_EFFECTIVE_CACHELINE_SIZE -  k_DATA_SIZE
     };
 
     // DATA
-    LockType        d_lock;
-    const char      d_pad[k_LOCK_PADDING];
+    LockType         d_lock;
+        // Lock held by writers, and by readers when 'd_readerCounts_p' is 0
+
+    bsls::AtomicInt  d_writerActive;
+        // 1 while a writer holds, or is acquiring, 'd_lock'; used only when
+        // 'd_readerCounts_p' is not 0
+
+    bsls::AtomicInt *d_readerCounts_p;
+        // Address of the reader indicator in slot 0 for this stripe, or 0 if
+        // readers acquire 'd_lock' (held, not owned)
+
+    bsl::size_t      d_readerCountsStride;
+        // Distance, in 'bsls::AtomicInt' objects, between the indicators of
+        // two consecutive slots
+
+    const char       d_pad[k_LOCK_PADDING];
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t readerSlot();
+        // Return the reader-indicator slot of the calling thread.
+
+    // PRIVATE MANIPULATORS
+    void lockRSlow(bsls::AtomicInt *readerCount);
+        // Wait for the active writer to release this lock element, and
+        // announce the calling thread as a reader using the specified
+        // 'readerCount' indicator, which was incremented by the caller.
+
+    void waitForReaders();
+        // Block until every reader indicator of this lock element is 0.
+
+    // NOT IMPLEMENTED
+    StripedUnorderedContainerImpl_LockElement(
+                            const StripedUnorderedContainerImpl_LockElement&);
+    StripedUnorderedContainerImpl_LockElement& operator=(
+                            const StripedUnorderedContainerImpl_LockElement&);
 
   public:
     // CREATORS
     StripedUnorderedContainerImpl_LockElement();
-        // Create an empty 'StripedUnorderedContainerImpl_LockElement' object.
+        // Create an empty 'StripedUnorderedContainerImpl_LockElement' object
+        // whose readers acquire the reader-writer mutex.
+
+    StripedUnorderedContainerImpl_LockElement(bsls::AtomicInt *readerCounts,
+                                              bsl::size_t      stride);
+        // Create an empty 'StripedUnorderedContainerImpl_LockElement' object
+        // whose readers announce themselves in the 'k_NUM_READER_SLOTS'
+        // reader indicators starting at the specified 'readerCounts' and
+        // separated by the specified 'stride' elements.  The behavior is
+        // undefined unless each of those indicators is 0, and they outlive
+        // this object.
 
     // MANIPULATORS
     void lockR();
@@ -1100,7 +1219,8 @@ class StripedUnorderedContainerImpl_LockElement {
         // Write lock the lock element.
 
     void unlockR();
-        // Read unlock the lock element.
+        // Read unlock the lock element.  The behavior is undefined unless the
+        // calling thread holds a read lock on this lock element.
 
     void unlockW();
         // Write unlock the lock element.
@@ -1573,11 +1693,41 @@ bslma::Allocator *StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::allocator()
              // class StripedUnorderedContainerImpl_LockElement
              // -----------------------------------------------
 
+// PRIVATE CLASS METHODS
+inline
+bsl::size_t StripedUnorderedContainerImpl_LockElement::readerSlot()
+{
+    // Fibonacci hashing of the thread id; the high bits of the product are
+    // well mixed even when thread ids are aligned addresses.
+
+    const bsls::Types::Uint64 k_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<bsl::size_t>(
+                      (bslmt::ThreadUtil::selfIdAsUint64() * k_MULTIPLIER) >>
+                                                    (64 - k_READER_SLOT_BITS));
+}
+
 // CREATORS
 inline
 StripedUnorderedContainerImpl_LockElement::
                                     StripedUnorderedContainerImpl_LockElement()
-: d_pad()
+: d_writerActive(0)
+, d_readerCounts_p(0)
+, d_readerCountsStride(0)
+, d_pad()
+{
+    (void)d_pad;
+}
+
+inline
+StripedUnorderedContainerImpl_LockElement::
+                                     StripedUnorderedContainerImpl_LockElement(
+                                               bsls::AtomicInt *readerCounts,
+                                               bsl::size_t      stride)
+: d_writerActive(0)
+, d_readerCounts_p(readerCounts)
+, d_readerCountsStride(stride)
+, d_pad()
 {
     (void)d_pad;
 }
@@ -1586,24 +1736,49 @@ StripedUnorderedContainerImpl_LockElement::
 inline
 void StripedUnorderedContainerImpl_LockElement::lockR()
 {
-    d_lock.lockRead();
+    if (!d_readerCounts_p) {
+        d_lock.lockRead();
+        return;                                                       // RETURN
+    }
+
+    // Announce the reader, then check for a writer.  Both operations are
+    // sequentially consistent, pairing with the store to 'd_writerActive'
+    // and the loads of the indicators in 'lockW'.
+
+    bsls::AtomicInt *readerCount = d_readerCounts_p +
+                                           readerSlot() * d_readerCountsStride;
+    readerCount->add(1);
+    if (0 != d_writerActive.load()) {
+        lockRSlow(readerCount);
+    }
 }
 
 inline
 void StripedUnorderedContainerImpl_LockElement::lockW()
 {
     d_lock.lockWrite();
+    if (d_readerCounts_p) {
+        d_writerActive.store(1);
+        waitForReaders();
+    }
 }
 
 inline
 void StripedUnorderedContainerImpl_LockElement::unlockR()
 {
-    d_lock.unlockRead();
+    if (!d_readerCounts_p) {
+        d_lock.unlockRead();
+        return;                                                       // RETURN
+    }
+    d_readerCounts_p[readerSlot() * d_readerCountsStride].addAcqRel(-1);
 }
 
 inline
 void StripedUnorderedContainerImpl_LockElement::unlockW()
 {
+    if (d_readerCounts_p) {
+        d_writerActive.storeRelease(0);
+    }
     d_lock.unlockWrite();
 }
 
@@ -1724,6 +1899,63 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::checkRehash()
     }
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::createLocks(
+                                                             ReadMode readMode)
+{
+    d_readerCounts_p = 0;
+
+    bsls::AtomicInt *readerCounts = 0;
+    bsl::size_t      stride       = 0;
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(0, d_allocator_p);
+
+    if (e_READ_MOSTLY == readMode) {
+        // Allocate one row of indicators per reader slot, each row holding
+        // one indicator per stripe and occupying whole (effective) cache
+        // lines, so that readers in different slots do not share a line.
+
+        const bsl::size_t k_COUNTS_PER_LINE =
+                          k_EFFECTIVE_CACHELINE_SIZE / sizeof(bsls::AtomicInt);
+
+        stride = (d_numStripes + k_COUNTS_PER_LINE - 1)
+               / k_COUNTS_PER_LINE * k_COUNTS_PER_LINE;
+
+        const bsl::size_t numCounts = LockElement::k_NUM_READER_SLOTS * stride;
+
+        d_readerCounts_p = d_allocator_p->allocate(
+                                        numCounts * sizeof(bsls::AtomicInt)
+                                                + k_EFFECTIVE_CACHELINE_SIZE);
+        proctor.reset(d_readerCounts_p);
+
+        char *buffer = static_cast<char *>(d_readerCounts_p);
+        readerCounts = reinterpret_cast<bsls::AtomicInt *>(
+                buffer + bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                 buffer,
+                                                 k_EFFECTIVE_CACHELINE_SIZE));
+        for (bsl::size_t i = 0; i < numCounts; ++i) {
+            bslma::ConstructionUtil::construct(readerCounts + i,
+                                               d_allocator_p);
+        }
+    }
+
+    // Allocate array of 'LockElement' objects, and construct them.
+    d_locks_p = reinterpret_cast<LockElement*>(
+                  d_allocator_p->allocate(d_numStripes * sizeof(LockElement)));
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        if (readerCounts) {
+            bslma::ConstructionUtil::construct(&d_locks_p[i],
+                                               d_allocator_p,
+                                               readerCounts + i,
+                                               stride);
+        }
+        else {
+            bslma::ConstructionUtil::construct(&d_locks_p[i], d_allocator_p);
+        }
+    }
+    proctor.release();
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::erase(
                                                               const KEY& key,
@@ -2177,12 +2409,32 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
     d_state       = k_REHASH_ENABLED; // Rehash enabled, not in progress
     d_numElements = 0; // Hash empty
 
-    // Allocate array of 'LockElement' objects, and construct them.
-    d_locks_p = reinterpret_cast<LockElement*>(
-                  d_allocator_p->allocate(d_numStripes * sizeof(LockElement)));
-    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
-        bslma::ConstructionUtil::construct(&d_locks_p[i], d_allocator_p);
-    }
+    createLocks(e_READ_LOCKED);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
+                                                 StripedUnorderedContainerImpl(
+                                           bsl::size_t       numInitialBuckets,
+                                           bsl::size_t       numStripes,
+                                           ReadMode          readMode,
+                                           bslma::Allocator *basicAllocator)
+: d_numStripes(powerCeil(numStripes))
+, d_numBuckets(adjustBuckets(numInitialBuckets, d_numStripes))
+, d_hashMask(d_numStripes - 1)
+, d_maxLoadFactor(1.0)
+, d_hasher()
+, d_comparator()
+, d_statePad()
+, d_numElementsPad()
+, d_buckets(d_numBuckets, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_state       = k_REHASH_ENABLED; // Rehash enabled, not in progress
+    d_numElements = 0; // Hash empty
+
+    createLocks(readMode);
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2194,6 +2446,9 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
         bslma::DestructionUtil::destroy(&d_locks_p[i]);
     }
     d_allocator_p->deallocate(d_locks_p);
+    if (d_readerCounts_p) {
+        d_allocator_p->deallocate(d_readerCounts_p);
+    }
 }
 
 // MANIPULATORS
@@ -2706,6 +2961,14 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::numStripes() const
     return static_cast<bsl::size_t>(d_numStripes);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::ReadMode
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::readMode() const
+{
+    return d_readerCounts_p ? e_READ_MOSTLY : e_READ_LOCKED;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bsl::size_t
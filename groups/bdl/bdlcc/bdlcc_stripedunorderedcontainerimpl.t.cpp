@@ -85,7 +85,7 @@ using namespace bsl;
 // other types in special cases.
 //
 // Single-threaded behavior is tested in test cases [1 .. 18].  Multi-threaded
-// issues are addressed in test cases [19 .. 21].  Two techniques are used:
+// issues are addressed in test cases [19 .. 22].  Two techniques are used:
 //
 //: 1 The component defines a component "private" class, a 'friend' of the hash
 //:   map, that allows users to explicitly lock and unlock specified stripes.
@@ -106,6 +106,7 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // CREATORS
 // [ 2] StripedUnorderedContainerImpl(numInitialBuckets, numStripes, *ba);
+// [22] StripedUnorderedContainerImpl(numBuckets, numStripes, readMode, *ba);
 // [ 2] ~StripedUnorderedContainerImpl();
 //
 // MANIPULATORS
@@ -146,6 +147,7 @@ using namespace bsl;
 // [15] float loadFactor() const;
 // [15] float maxLoadFactor() const;
 // [ 4] bsl::size_t numStripes() const;
+// [22] ReadMode readMode() const;
 // [ 4] bsl::size_t size() const;
 //
 // [ 4] bslma::Allocator *allocator() const;
@@ -321,6 +323,12 @@ extern "C" void *workThread(void *arg)
     return 0;
 }
 
+void verifyLockInteractions(StripType::ReadMode readMode);
+    // Verify, using 'bdlcc::StripedUnorderedContainerImpl_TestUtil', that the
+    // read and write locks of a stripe of a hash map created with the
+    // specified 'readMode' exclude each other and other write locks, and that
+    // read locks do not exclude each other.
+
 void testTestingUtil()
     // Test the locking methods in
     // 'bdlcc::StripedUnorderedContainerImpl_TestUtil'.
@@ -375,7 +383,12 @@ void testTestingUtil()
                       << "TEST HELPER CLASS" << endl
                       << "-----------------" << endl;
 
-    StripType           strip(16, 4, &talloc);
+    verifyLockInteractions(StripType::e_READ_LOCKED);
+} // END 'testTestingUtil'
+
+void verifyLockInteractions(StripType::ReadMode readMode)
+{
+    StripType           strip(16, 4, readMode, &talloc);
     Strip_TestUtilType  strip_TestUtil(strip);
     bslmt::ThreadUtil::Handle
                         handle;
@@ -453,7 +466,7 @@ void testTestingUtil()
 
         ASSERT(durationRR < k_SLEEP_PERIOD / 2);
     }
-} // END 'testTestingUtil'
+} // END 'verifyLockInteractions'
 
 struct TestUpdater {
     // Updater to the test 'bdlcc:StripedUnorderedContainerImpl' in
@@ -943,6 +956,12 @@ extern "C" void *workerThread(void *v_arg)
     return (void*) v_arg;
 }
 
+void stressTest(ThreadArg::StripType::ReadMode readMode);
+    // Run, for a few seconds, a set of threads performing random 'getValue',
+    // 'insertUnique', and 'setValueFirst' operations on a hash map created
+    // with the specified 'readMode', then verify the final value of every
+    // element and that the hash map was rehashed.
+
 void threadedTest1()
     // Multi threaded stress test.
 {
@@ -984,11 +1003,16 @@ void threadedTest1()
                       << "MULTI-THREADED STRESS TEST" << endl
                       << "--------------------------" << endl;
 
+    stressTest(ThreadArg::StripType::e_READ_LOCKED);
+}
+
+void stressTest(ThreadArg::StripType::ReadMode readMode)
+{
     const int k_NUM_WORKERS =  10;
     const int k_NUM_ITEMS   = 128;
 
     bslma::TestAllocator supplied("supplied", veryVeryVeryVerbose);
-    ThreadArg::StripType strip(16, 8, &supplied);
+    ThreadArg::StripType strip(16, 8, readMode, &supplied);
     bsls::AtomicInt      writeCounts[k_NUM_ITEMS];  // default 0
     bsls::AtomicInt      stop(0);
 
@@ -1033,6 +1057,144 @@ void threadedTest1()
             initialNumBuckets < finalNumBuckets);
 }
 
+void testReadMostly()
+    // Test the read-mostly mode.
+{
+    // ------------------------------------------------------------------------
+    // READ-MOSTLY MODE
+    //   In 'e_READ_MOSTLY' mode the lock element of each stripe uses reader
+    //   indicators rather than the read lock of its mutex.  Ensure that the
+    //   mode is reported correctly, that its memory is managed, and that the
+    //   locking protocol provides the same exclusion as the mutex.
+    //
+    // Concerns:
+    //: 1 'readMode' returns 'e_READ_LOCKED' for a hash map created without
+    //:   an explicit mode, and returns the mode supplied at construction
+    //:   otherwise.
+    //:
+    //: 2 The reader indicators are allocated from the supplied allocator, no
+    //:   memory is allocated from the default allocator, and all memory is
+    //:   released on destruction.
+    //:
+    //: 3 A read lock excludes a write lock, a write lock excludes both
+    //:   flavors of lock, and read locks do not exclude each other.
+    //:
+    //: 4 The hash map remains consistent when manipulated concurrently by
+    //:   several threads, including during a concurrent rehash.
+    //:
+    //: 5 Single-threaded operations behave as in 'e_READ_LOCKED' mode.
+    //
+    // Plan:
+    //: 1 Create hash maps with and without an explicit mode, and check
+    //:   'readMode'.  (C-1)
+    //:
+    //: 2 Use test allocators to verify the allocations of hash maps in both
+    //:   modes and for several numbers of stripes.  (C-2)
+    //:
+    //: 3 Run the lock-interaction checks of the test helper class on a hash
+    //:   map in 'e_READ_MOSTLY' mode.  (C-3)
+    //:
+    //: 4 Run the multi-threaded stress test on a hash map in 'e_READ_MOSTLY'
+    //:   mode.  (C-4)
+    //:
+    //: 5 Insert, look up, and erase elements of a hash map in 'e_READ_MOSTLY'
+    //:   mode, across a rehash.  (C-5)
+    //
+    // Testing:
+    //   StripedUnorderedContainerImpl(numBuckets, numStripes, readMode, *ba);
+    //   ReadMode readMode() const;
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << endl
+                      << "READ-MOSTLY MODE" << endl
+                      << "----------------" << endl;
+
+    typedef bdlcc::StripedUnorderedContainerImpl<int, int> Obj;
+
+    bslma::TestAllocator         da("default",   veryVeryVeryVerbose);
+    bslma::TestAllocator         sa("supplied",  veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (veryVerbose) cout << "Read mode accessor" << endl;
+    {
+        Obj mX(16, 4, &sa);                    const Obj& X = mX;
+        Obj mY(16, 4, Obj::e_READ_LOCKED, &sa); const Obj& Y = mY;
+        Obj mZ(16, 4, Obj::e_READ_MOSTLY, &sa); const Obj& Z = mZ;
+
+        ASSERTV(Obj::e_READ_LOCKED == X.readMode());
+        ASSERTV(Obj::e_READ_LOCKED == Y.readMode());
+        ASSERTV(Obj::e_READ_MOSTLY == Z.readMode());
+    }
+    ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+
+    if (veryVerbose) cout << "Memory" << endl;
+    {
+        const bsl::size_t STRIPES[] = { 1, 2, 4, 16, 64, 100, 1024 };
+        const int         NUM_STRIPES = sizeof STRIPES / sizeof *STRIPES;
+
+        for (int ti = 0; ti < NUM_STRIPES; ++ti) {
+            const bsl::size_t NS = STRIPES[ti];
+
+            bsls::Types::Int64 lockedBytes;
+            {
+                Obj mX(NS, NS, Obj::e_READ_LOCKED, &sa);
+                lockedBytes = sa.numBytesInUse();
+            }
+            {
+                Obj mX(NS, NS, Obj::e_READ_MOSTLY, &sa); const Obj& X = mX;
+
+                ASSERTV(NS, X.numStripes() >= NS);
+
+                // At least one cache line per reader slot.
+
+                ASSERTV(NS, lockedBytes, sa.numBytesInUse(),
+                        lockedBytes + 64 * 64 <= sa.numBytesInUse());
+                ASSERTV(NS, sa.numBlocksInUse(), 3 == sa.numBlocksInUse());
+            }
+            ASSERTV(NS, sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        }
+    }
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+    if (veryVerbose) cout << "Single-threaded operations" << endl;
+    {
+        Obj mX(4, 2, Obj::e_READ_MOSTLY, &sa); const Obj& X = mX;
+
+        const int k_NUM_ITEMS = 200;
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            ASSERTV(i, 1 == mX.insertUnique(i, i * 3));
+        }
+        ASSERTV(X.bucketCount(), 4 < X.bucketCount());
+
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            int value = -1;
+            ASSERTV(i, 1 == X.getValue(&value, i));
+            ASSERTV(i, value, i * 3 == value);
+        }
+        for (int i = 0; i < k_NUM_ITEMS; i += 2) {
+            ASSERTV(i, 1 == mX.eraseFirst(i));
+        }
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            int value = -1;
+            ASSERTV(i, (i % 2) == static_cast<int>(X.getValue(&value, i)));
+        }
+        mX.clear();
+        ASSERTV(X.size(), 0 == X.size());
+    }
+    ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+    if (veryVerbose) cout << "Lock interactions" << endl;
+    {
+        testLock::verifyLockInteractions(testLock::StripType::e_READ_MOSTLY);
+    }
+
+    if (veryVerbose) cout << "Multi-threaded stress" << endl;
+    {
+        stressTest(Obj::e_READ_MOSTLY);
+    }
+}
+
 }  // close namespace threaded
 
 // TestDriver template
@@ -8161,6 +8323,9 @@ int main(int argc, char *argv[])
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
+      case 22: {
+        threaded::testReadMostly();
+      } break;
       case 21: {
         threaded::threadedTest1();
       } break;
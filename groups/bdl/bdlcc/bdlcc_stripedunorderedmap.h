@@ -74,6 +74,26 @@ BSLS_IDENT("$Id: $")
 // plateau is reached roughly at four times the number of the threads
 // *concurrently* using the hash map.
 //
+///Read-Mostly Mode
+///----------------
+// By default, 'getValue' acquires the read lock of the stripe of the key,
+// and so concurrent readers of a stripe contend on the cache line of that
+// lock even when no writer is active.  For workloads dominated by reads, a
+// map can be constructed in 'e_READ_MOSTLY' mode, in which readers announce
+// themselves in per-thread-slot indicators that are private to a cache line,
+// and never write to shared state unless a writer is active on the stripe.
+// The price is paid by writers: every manipulator (including 'clear',
+// 'rehash', and 'visit') waits for the indicators of each stripe it locks to
+// drain, and the map uses additional memory for 64 cache-line-aligned rows of
+// 'numStripes()' indicators.  The mode is fixed at construction and is
+// reported by the 'readMode' accessor:
+//..
+//  typedef bdlcc::StripedUnorderedMap<int, bsl::string> Map;
+//
+//  Map map(1024, 16, Map::e_READ_MOSTLY);
+//  assert(Map::e_READ_MOSTLY == map.readMode());
+//..
+//
 ///Set vs. Insert Methods
 ///----------------------
 // This container provides several 'set*' methods and analogously named
@@ -400,6 +420,18 @@ class StripedUnorderedMap {
     };
 
     // PUBLIC TYPES
+    enum ReadMode {
+        // Enumeration of the synchronization used by readers (see
+        // {Read-Mostly Mode}).
+
+        e_READ_LOCKED = Impl::e_READ_LOCKED,  // Readers acquire the read lock
+                                              // of the stripe (default).
+
+        e_READ_MOSTLY = Impl::e_READ_MOSTLY   // Readers use per-thread
+                                              // indicators; writers wait for
+                                              // them to drain.
+    };
+
     typedef bsl::pair<KEY, VALUE> KVType;
         // Value type of a bulk insert entry.
 
@@ -430,6 +462,18 @@ class StripedUnorderedMap {
         // stripes will not change after construction, but the number of
         // buckets may (unless rehashing is disabled via 'disableRehash').
 
+    StripedUnorderedMap(bsl::size_t       numInitialBuckets,
+                        bsl::size_t       numStripes,
+                        ReadMode          readMode,
+                        bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'StripedUnorderedMap' object, a fully thread-safe
+        // hash map having at least the specified 'numInitialBuckets' buckets
+        // and the specified (fixed) 'numStripes' stripes, whose readers use
+        // the synchronization indicated by the specified 'readMode' (see
+        // {Read-Mostly Mode}).  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The hash map has rehash enabled.
+
     //! ~StripedUnorderedMap() = default;
         // Destroy this hash map.
 
@@ -640,6 +684,9 @@ class StripedUnorderedMap {
     bsl::size_t numStripes() const;
         // Return the number of stripes in the hash.
 
+    ReadMode readMode() const;
+        // Return the synchronization used by readers of this hash map.
+
     bsl::size_t size() const;
         // Return the current number of elements in this hash map.
 
@@ -670,6 +717,20 @@ StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::StripedUnorderedMap(
 {
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::StripedUnorderedMap(
+                                           bsl::size_t       numInitialBuckets,
+                                           bsl::size_t       numStripes,
+                                           ReadMode          readMode,
+                                           bslma::Allocator *basicAllocator)
+: d_imp(numInitialBuckets,
+        numStripes,
+        static_cast<typename Impl::ReadMode>(readMode),
+        basicAllocator)
+{
+}
+
 // MANIPULATORS
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
@@ -888,6 +949,14 @@ bsl::size_t StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::numStripes() const
     return d_imp.numStripes();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::ReadMode
+StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::readMode() const
+{
+    return static_cast<ReadMode>(d_imp.readMode());
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bsl::size_t StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::size() const
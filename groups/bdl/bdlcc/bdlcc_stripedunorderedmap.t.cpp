@@ -112,6 +112,7 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // CREATORS
 // [ 2] StripedUnorderedMap(numInitialBuckets, numStripes, *basicAllocator);
+// [20] StripedUnorderedMap(numBuckets, numStripes, readMode, *ba);
 // [ 2] ~StripedUnorderedMap();
 //
 // MANIPULATORS
@@ -143,12 +144,13 @@ using namespace bsl;
 // [14] float loadFactor() const;
 // [14] float maxLoadFactor() const;
 // [ 4] bsl::size_t numStripes() const;
+// [20] ReadMode readMode() const;
 // [ 4] bsl::size_t size() const;
 //
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [20] USAGE EXAMPLE
+// [21] USAGE EXAMPLE
 // [15] TYPE TRAITS
 // [18] MULTI-THREADED STRESS TEST
 // [19] DRQS 155023497: 'erase' MEMORY CORRUPTION
@@ -156,6 +158,7 @@ using namespace bsl;
 // [-2] PERFORMANCE TEST STRING->INT64
 // [-4] READ WRITE PERFORMANCE
 // [-8] READ/WRITE PERFORMANCE TEST WITH LONG KEY
+// [-9] READER SCALING PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1937,6 +1940,202 @@ void threadedTest1()
     }
 }
 
+struct ReadMostlyArg {
+    typedef bdlcc::StripedUnorderedMap<int, bsl::string> MapType;
+
+    MapType          *d_map_p;
+    bsls::AtomicInt  *d_stop_p;
+    bsls::AtomicInt  *d_numReads_p;
+    bsls::AtomicInt  *d_numErrors_p;
+    int               d_numItems;
+    bslma::Allocator *d_allocator_p;
+};
+
+void makeReadMostlyValue(bsl::string *value, int key, int generation)
+    // Load into the specified 'value' the value associated with the specified
+    // 'key' by the specified 'generation' of writes: a string whose length
+    // varies with 'generation' (sometimes exceeding the short-string buffer)
+    // and whose characters are all derived from 'key'.
+{
+    value->assign(static_cast<bsl::size_t>(1 + generation % 40),
+                  static_cast<char>('a' + key % 26));
+}
+
+bool isReadMostlyValue(const bsl::string& value, int key)
+    // Return 'true' if the specified 'value' could have been produced by
+    // 'makeReadMostlyValue' for the specified 'key', and 'false' otherwise.
+{
+    if (value.empty()) {
+        return false;                                                 // RETURN
+    }
+    for (bsl::size_t i = 0; i < value.size(); ++i) {
+        if (value[i] != static_cast<char>('a' + key % 26)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+extern "C" void *readMostlyReader(void *v_arg)
+    // Repeatedly look up random keys in the map of the specified 'v_arg',
+    // counting the elements found and the malformed values observed.
+{
+    ReadMostlyArg *arg = static_cast<ReadMostlyArg *>(v_arg);
+
+    int seed = static_cast<int>(bslmt::ThreadUtil::selfIdAsUint64());
+
+    bsl::string value(arg->d_allocator_p);
+    int         numReads = 0;
+    while (0 == *arg->d_stop_p) {
+        int key = bdlb::Random::generate15(&seed) % arg->d_numItems;
+        if (arg->d_map_p->getValue(&value, key)) {
+            ++numReads;
+            if (!isReadMostlyValue(value, key)) {
+                ++*arg->d_numErrors_p;
+            }
+        }
+    }
+    *arg->d_numReads_p += numReads;
+    return v_arg;
+}
+
+void readMostlyTest()
+    // Multi-threaded test of a map in 'e_READ_MOSTLY' mode.
+{
+    // ------------------------------------------------------------------------
+    // READ-MOSTLY MODE
+    //   A map constructed in 'e_READ_MOSTLY' mode replaces the read lock of
+    //   each stripe with per-thread reader indicators.
+    //
+    // Concerns:
+    //: 1 'readMode' returns 'e_READ_LOCKED' unless 'e_READ_MOSTLY' is
+    //:   supplied at construction.
+    //:
+    //: 2 The constructor taking a read mode forwards the number of buckets,
+    //:   number of stripes, and allocator.
+    //:
+    //: 3 Readers never observe an element while a writer modifies it,
+    //:   including while elements are erased, re-inserted, and rehashed.
+    //:
+    //: 4 All memory comes from the supplied allocator and is released.
+    //
+    // Plan:
+    //: 1 Construct maps with and without a read mode, and verify 'readMode',
+    //:   'numStripes', 'bucketCount', and 'allocator'.  (C-1..2)
+    //:
+    //: 2 Run several reader threads that verify each value they look up
+    //:   against a pattern derived from the key, while the main thread
+    //:   rewrites values with different lengths, erases and re-inserts
+    //:   elements, and rehashes the map.  (C-3)
+    //:
+    //: 3 Use a test allocator to verify allocations.  (C-4)
+    //
+    // Testing:
+    //   StripedUnorderedMap(numBuckets, numStripes, readMode, *ba);
+    //   ReadMode readMode() const;
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << endl
+                      << "READ-MOSTLY MODE" << endl
+                      << "----------------" << endl;
+
+    typedef ReadMostlyArg::MapType Obj;
+
+    bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (veryVerbose) cout << "Construction and accessors" << endl;
+    {
+        Obj mX(16, 4, &sa);                     const Obj& X = mX;
+        Obj mY(16, 4, Obj::e_READ_LOCKED, &sa); const Obj& Y = mY;
+        Obj mZ(64, 8, Obj::e_READ_MOSTLY, &sa); const Obj& Z = mZ;
+        Obj mW(16, 4, Obj::e_READ_MOSTLY);      const Obj& W = mW;
+
+        ASSERTV(Obj::e_READ_LOCKED == X.readMode());
+        ASSERTV(Obj::e_READ_LOCKED == Y.readMode());
+        ASSERTV(Obj::e_READ_MOSTLY == Z.readMode());
+        ASSERTV(Obj::e_READ_MOSTLY == W.readMode());
+
+        ASSERTV(Z.numStripes(),  8 == Z.numStripes());
+        ASSERTV(Z.bucketCount(), 64 == Z.bucketCount());
+        ASSERTV(&sa == Z.allocator());
+        ASSERTV(&da == W.allocator());
+        ASSERTV(0 <  da.numBlocksInUse());
+    }
+    ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+    ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+    const bsls::Types::Int64 numDefaultBlocks = da.numBlocksTotal();
+
+    if (veryVerbose) cout << "Concurrent readers and writer" << endl;
+    {
+        const int k_NUM_READERS =   8;
+        const int k_NUM_ITEMS   = 256;
+
+        Obj mX(16, 4, Obj::e_READ_MOSTLY, &sa); const Obj& X = mX;
+
+        bsl::string value(&sa);
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            makeReadMostlyValue(&value, i, 0);
+            mX.insert(i, value);
+        }
+
+        bsls::AtomicInt stop(0);
+        bsls::AtomicInt numReads(0);
+        bsls::AtomicInt numErrors(0);
+
+        ReadMostlyArg arg = { &mX, &stop, &numReads, &numErrors,
+                              k_NUM_ITEMS, &sa };
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_READERS];
+        for (int i = 0; i < k_NUM_READERS; ++i) {
+            ASSERTV(i, 0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      readMostlyReader,
+                                                      &arg));
+        }
+
+        const bsl::size_t initialNumBuckets = X.bucketCount();
+
+        for (int generation = 1; generation <= 200; ++generation) {
+            for (int i = 0; i < k_NUM_ITEMS; ++i) {
+                makeReadMostlyValue(&value, i, generation);
+                if (0 == (i + generation) % 7) {
+                    mX.erase(i);
+                    mX.insert(i, value);
+                }
+                else {
+                    mX.setValue(i, value);
+                }
+            }
+            if (0 == generation % 50) {
+                mX.rehash(X.bucketCount() * 2);
+            }
+        }
+
+        stop = 1;
+        for (int i = 0; i < k_NUM_READERS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        ASSERTV(numErrors, 0 == numErrors);
+        ASSERTV(numReads,  0 <  numReads);
+        ASSERTV(X.size(), k_NUM_ITEMS == static_cast<int>(X.size()));
+        ASSERTV(initialNumBuckets, X.bucketCount(),
+                initialNumBuckets < X.bucketCount());
+
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            ASSERTV(i, 1 == X.getValue(&value, i));
+            ASSERTV(i, value, isReadMostlyValue(value, i));
+        }
+    }
+    ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+    ASSERTV(numDefaultBlocks,
+            da.numBlocksTotal(),
+            numDefaultBlocks == da.numBlocksTotal());
+}
+
 }  // close namespace threaded
 
 // TestDriver template
@@ -6093,6 +6292,111 @@ void HBenchmark<KEY, VAL>::erase(int)
         d_curValue = 0;
 }
 
+template <class KEY, class VAL>
+class ReaderScalingBenchmark {
+    // This class provides the test functions for measuring the throughput of
+    // 'getValue' on a 'bdlcc::StripedUnorderedMap' as the number of reader
+    // threads grows, optionally with concurrent writer threads.
+
+  public:
+    typedef bdlcc::StripedUnorderedMap<KEY, VAL> MapType;
+
+  private:
+    // PRIVATE CONSTANTS
+    enum { k_CURSOR_STRIDE = 32 };  // 'int' objects between the cursors of
+                                    // two threads, to avoid false sharing
+
+    // DATA
+    typename MapType::ReadMode  d_readMode;    // read mode of the map
+    int                         d_numStripes;  // # of stripes
+    int                         d_numElements; // # of elements in the map
+    MapType                    *d_map_p;       // map under test (owned)
+    bsl::vector<int>            d_cursors;     // next key, per thread
+    bsls::AtomicInt             d_countErr;    // # of failed lookups
+    bslma::Allocator           *d_allocator_p; // memory allocator
+
+    // NOT IMPLEMENTED
+    ReaderScalingBenchmark(const ReaderScalingBenchmark&);
+    ReaderScalingBenchmark& operator=(const ReaderScalingBenchmark&);
+
+    // PRIVATE MANIPULATORS
+    int nextKey(int group, int threadIndex)
+        // Return the next key to be used by the thread having the specified
+        // 'threadIndex' in the specified thread 'group' (0 for readers, 1 for
+        // writers).
+    {
+        int& cursor = d_cursors[(group * 64 + threadIndex) * k_CURSOR_STRIDE];
+        if (++cursor >= d_numElements) {
+            cursor = 0;
+        }
+        return cursor;
+    }
+
+  public:
+    // CREATORS
+    ReaderScalingBenchmark(typename MapType::ReadMode  readMode,
+                           int                         numStripes,
+                           int                         numElements,
+                           bslma::Allocator           *basicAllocator)
+        // Create a 'ReaderScalingBenchmark' object for a map in the specified
+        // 'readMode' having the specified 'numStripes' and 'numElements',
+        // using the specified 'basicAllocator' to supply memory.  Up to 64
+        // reader and 64 writer threads are supported.
+    : d_readMode(readMode)
+    , d_numStripes(numStripes)
+    , d_numElements(numElements)
+    , d_map_p(0)
+    , d_cursors(2 * 64 * k_CURSOR_STRIDE, 0, basicAllocator)
+    , d_countErr(0)
+    , d_allocator_p(basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+    void initializeSample(bool)
+        // Create and populate the map before a sample.
+    {
+        d_map_p = new (*d_allocator_p) MapType(
+                                       static_cast<bsl::size_t>(d_numElements),
+                                       static_cast<bsl::size_t>(d_numStripes),
+                                       d_readMode,
+                                       d_allocator_p);
+        for (int i = 0; i < d_numElements; ++i) {
+            d_map_p->insert(i, VAL());
+        }
+    }
+
+    void cleanupSample(bool)
+        // Destroy the map after a sample.
+    {
+        d_allocator_p->deleteObject(d_map_p);
+    }
+
+    void read(int threadIndex)
+        // Look up an element that exists in the map.
+    {
+        VAL         value;
+        bsl::size_t num = d_map_p->getValue(&value, nextKey(0, threadIndex));
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == num)) {
+            ++d_countErr;
+        }
+    }
+
+    void write(int threadIndex)
+        // Set the value of an element that exists in the map.
+    {
+        int key = nextKey(1, threadIndex);
+        d_map_p->setValue(key, VAL(key));
+    }
+
+    // ACCESSORS
+    int countErr() const
+        // Return the number of failed lookups accumulated through the run.
+    {
+        return d_countErr;
+    }
+};
+
 }  // close namespace hPerf
 
 int main(int argc, char *argv[])
@@ -6116,7 +6420,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 20: {
+      case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -6204,6 +6508,9 @@ int main(int argc, char *argv[])
         ASSERT(numBytesInUse == supplied.numBytesInUse());
       } break;
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
+      case 20: {
+        threaded::readMostlyTest();
+      } break;
       case 18: {
         threaded::threadedTest1();
       } break;
@@ -6862,6 +7169,127 @@ int main(int argc, char *argv[])
         hp.runTests(&times, args, hashPerf::HashPerformance::testReadWrite2);
         hp.printResult();
       } break;
+      case -9: {
+        // --------------------------------------------------------------------
+        // READER SCALING PERFORMANCE TEST
+        //   Measures the throughput of 'getValue' on an int to int map as the
+        //   number of reader threads grows, in each read mode.  To provide
+        //   control over the test, command line parameters are used.
+        //   2nd parameter: read modes (0-'e_READ_LOCKED', 1-'e_READ_MOSTLY';
+        //       defaults to "0,1").
+        //   3rd parameter: numbers of reader threads (defaults to
+        //       "1,2,4,8,16,32,64").
+        //   4th parameter: number of writer threads (defaults to 0).
+        //   5th parameter: number of stripes (defaults to 4).
+        //   6th parameter: number of elements (defaults to 1024).
+        //   7th parameter: number of milliseconds each sample runs (defaults
+        //       to 1000).
+        //   8th parameter: number of samples to run (defaults to 5).
+        //
+        // Note that parameters 2,3,4,5,6 can be provided as a comma separated
+        // list of values.
+        //
+        // Concerns:
+        //: 1 Report the median throughput of the reader threads, and of the
+        //:   writer threads if any, for each combination of parameters.
+        //
+        // Plan:
+        //: 1 For each combination of parameters, create a
+        //:   'ReaderScalingBenchmark' and run it with a
+        //:   'bslmt::ThroughputBenchmark' having a group of reader threads
+        //:   and, optionally, a group of writer threads.  (C-1)
+        //
+        // Testing:
+        //   READER SCALING PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "READER SCALING PERFORMANCE TEST" << endl
+                 << "===============================" << endl;
+
+        bslma::NewDeleteAllocator nalloc;
+
+        bsl::string readMode    = argc > 2 ? argv[2] : "0,1";
+        bsl::string numReader   = argc > 3 ? argv[3] : "1,2,4,8,16,32,64";
+        bsl::string numWriter   = argc > 4 ? argv[4] : "0";
+        bsl::string numStripe   = argc > 5 ? argv[5] : "4";
+        bsl::string numElement  = argc > 6 ? argv[6] : "1024";
+        int         numMillis   = argc > 7 ? atoi(argv[7]) : 1000;
+        int         numSamples  = argc > 8 ? atoi(argv[8]) :    5;
+
+        vector<int> readModes   = stringSplit(readMode);
+        vector<int> numReaders  = stringSplit(numReader);
+        vector<int> numWriters  = stringSplit(numWriter);
+        vector<int> numStripes  = stringSplit(numStripe);
+        vector<int> numElements = stringSplit(numElement);
+
+        typedef hPerf::ReaderScalingBenchmark<int, int> Bench;
+
+        bsl::cout << "Mode,NR,NW,NS,NE,Reads/s,Writes/s,ErrCount\n";
+
+        for (bsl::size_t mi = 0; mi < readModes.size(); ++mi) {
+        for (bsl::size_t si = 0; si < numStripes.size(); ++si) {
+        for (bsl::size_t ei = 0; ei < numElements.size(); ++ei) {
+        for (bsl::size_t wi = 0; wi < numWriters.size(); ++wi) {
+        for (bsl::size_t ri = 0; ri < numReaders.size(); ++ri) {
+            const int NR = bsl::min(64, numReaders[ri]);
+            const int NW = bsl::min(64, numWriters[wi]);
+
+            Bench hb(readModes[mi] ? Bench::MapType::e_READ_MOSTLY
+                                   : Bench::MapType::e_READ_LOCKED,
+                     numStripes[si],
+                     numElements[ei],
+                     &nalloc);
+
+            bslmt::ThroughputBenchmark       tb(&nalloc);
+            bslmt::ThroughputBenchmarkResult res(&nalloc);
+
+            int readerGroup = tb.addThreadGroup(
+                      bdlf::BindUtil::bind(&Bench::read,
+                                           &hb,
+                                           bdlf::PlaceHolders::_1),
+                      NR,
+                      0);
+            int writerGroup = -1;
+            if (NW > 0) {
+                writerGroup = tb.addThreadGroup(
+                      bdlf::BindUtil::bind(&Bench::write,
+                                           &hb,
+                                           bdlf::PlaceHolders::_1),
+                      NW,
+                      0);
+            }
+
+            tb.execute(&res,
+                       numMillis,
+                       numSamples,
+                       bdlf::BindUtil::bind(&Bench::initializeSample,
+                                            &hb,
+                                            bdlf::PlaceHolders::_1),
+                       bslmt::ThroughputBenchmark::ShutdownSampleFunction(),
+                       bdlf::BindUtil::bind(&Bench::cleanupSample,
+                                            &hb,
+                                            bdlf::PlaceHolders::_1));
+
+            double readMedian  = 0.0;
+            double writeMedian = 0.0;
+            res.getMedian(&readMedian, readerGroup);
+            if (writerGroup >= 0) {
+                res.getMedian(&writeMedian, writerGroup);
+            }
+
+            bsl::cout << bsl::fixed << bsl::setprecision(0)
+                      << readModes[mi] << "," << NR << "," << NW << ","
+                      << numStripes[si] << "," << numElements[ei] << ","
+                      << readMedian << "," << writeMedian << ","
+                      << hb.countErr() << "\n";
+        }
+        }
+        }
+        }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
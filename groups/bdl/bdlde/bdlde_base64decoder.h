@@ -153,6 +153,20 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Contiguous Buffers
+///------------------
+// When 'convert' is supplied a contiguous input buffer (i.e., the input
+// iterators are of type 'const char *' or 'char *') and a contiguous output
+// buffer (i.e., the output iterator is of type 'char *'), runs of numeric
+// Base64 characters (possibly separated by ignorable characters such as line
+// breaks) are decoded many characters at a time rather than one character at
+// a time.  On x86 platforms a vectorized implementation (using AVX2 or SSSE3
+// instructions) is selected at run time according to the capabilities of the
+// processor, and a portable implementation is used otherwise.  The output,
+// the values loaded into 'numOut' and 'numIn', the returned status, and the
+// resulting state of the decoder, including the detection and position of
+// errors, are identical to those produced for any other iterator types.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Decoder' object to
@@ -453,6 +467,46 @@ class Base64Decoder {
     Base64Decoder(const Base64Decoder&);
     Base64Decoder& operator=(const Base64Decoder&);
 
+    // PRIVATE MANIPULATORS
+    template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+    void convertBulk(OUTPUT_ITERATOR *out,
+                     int             *numEmitted,
+                     INPUT_ITERATOR  *begin,
+                     INPUT_ITERATOR   end,
+                     int             *numIn,
+                     int              maxNumOut);
+        // Do nothing.  Note that this overload is selected unless the
+        // specified 'out' and 'begin' refer to contiguous character buffers,
+        // in which case all input is consumed by the character-at-a-time loop
+        // in 'convert'; the specified 'numEmitted', 'end', 'numIn', and
+        // 'maxNumOut' are ignored.
+
+    void convertBulk(char        **out,
+                     int          *numEmitted,
+                     const char  **begin,
+                     const char   *end,
+                     int          *numIn,
+                     int           maxNumOut);
+    void convertBulk(char  **out,
+                     int    *numEmitted,
+                     char  **begin,
+                     char   *end,
+                     int    *numIn,
+                     int     maxNumOut);
+        // Consume input characters starting at the specified '*begin' up to,
+        // but not including, the specified 'end', and emit the resulting
+        // output starting at the specified '*out', many characters at a time
+        // where possible, leaving this object in the same state as would the
+        // character-at-a-time loop in 'convert'.  Advance '*begin' and '*out'
+        // past the consumed input and emitted output, respectively, and add
+        // the number of characters consumed and bytes emitted to the
+        // specified '*numIn' and '*numEmitted', respectively.  Stop early,
+        // leaving the remaining input to 'convert', on reaching a character
+        // that is neither a numeric Base64 character nor ignorable, or when
+        // '*numEmitted' equals the specified 'maxNumOut'.  The behavior is
+        // undefined unless this object is in the general input state and all
+        // output that can be emitted has been emitted.
+
   public:
     // CLASS METHODS
     static int maxDecodedLength(int inputLength);
@@ -579,6 +633,32 @@ class Base64Decoder {
                             // class Base64Decoder
                             // -------------------
 
+// PRIVATE MANIPULATORS
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+inline
+void Base64Decoder::convertBulk(OUTPUT_ITERATOR *,
+                                int             *,
+                                INPUT_ITERATOR  *,
+                                INPUT_ITERATOR   ,
+                                int             *,
+                                int              )
+{
+}
+
+inline
+void Base64Decoder::convertBulk(char  **out,
+                                int    *numEmitted,
+                                char  **begin,
+                                char   *end,
+                                int    *numIn,
+                                int     maxNumOut)
+{
+    const char *constBegin = *begin;
+
+    convertBulk(out, numEmitted, &constBegin, end, numIn, maxNumOut);
+    *begin += constBegin - *begin;
+}
+
 // CLASS METHODS
 inline
 int Base64Decoder::maxDecodedLength(int inputLength)
@@ -642,11 +722,16 @@ int Base64Decoder::convert(OUTPUT_ITERATOR  out,
         ++numEmitted;
     }
 
-    // Consume as many input bytes as possible.
+    // Consume as many input bytes as possible, in bulk if the buffers are
+    // contiguous.
 
     *numIn = 0;
 
     if (e_INPUT_STATE == d_state) {
+        if (8 > d_bitsInStack) {
+            convertBulk(&out, &numEmitted, &begin, end, numIn, maxNumOut);
+        }
+
         while (18 >= d_bitsInStack && begin != end) {
             const unsigned char byte = static_cast<unsigned char>(*begin);
 
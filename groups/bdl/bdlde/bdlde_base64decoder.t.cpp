@@ -16,6 +16,7 @@
 
 #include <bslma_testallocator.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -221,6 +222,8 @@ using bsl::flush;
 //*[ 8] That a specified maximum output length is observed.
 //*[ 8] That surplus output beyond 'maxNumOut' is buffered properly.
 //*[10] STRESS TEST: The decoder properly decodes all encoded output.
+// [12] CONCERN: contiguous buffers are decoded in bulk correctly.
+// [-1] PERFORMANCE TEST
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1269,6 +1272,72 @@ bool base64OrEquals(char c)
     return ret;
 }
 
+                        // ========================
+                        // class CharOutputIterator
+                        // ========================
+
+class CharOutputIterator {
+    // This class provides a minimal output iterator over a character buffer.
+    // Supplying it to 'convert' selects the character-at-a-time
+    // implementation, which is the reference for the bulk implementation
+    // selected for 'char *'.
+
+    // DATA
+    char *d_cursor_p;  // current position
+
+  public:
+    // CREATORS
+    explicit CharOutputIterator(char *cursor)
+        // Create an iterator referring to the specified 'cursor'.
+    : d_cursor_p(cursor)
+    {
+    }
+
+    // MANIPULATORS
+    char& operator*()
+        // Return a reference to the current character.
+    {
+        return *d_cursor_p;
+    }
+
+    CharOutputIterator& operator++()
+        // Advance this iterator and return a reference to it.
+    {
+        ++d_cursor_p;
+        return *this;
+    }
+};
+
+void fillPseudoRandom(char *buffer, int length, unsigned seed)
+    // Load the specified 'length' pseudo-random bytes generated from the
+    // specified 'seed' into the specified 'buffer'.
+{
+    for (int i = 0; i < length; ++i) {
+        seed = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<char>(seed >> 16);
+    }
+}
+
+void encode(bsl::vector<char> *result,
+            const char        *input,
+            int                length,
+            int                maxLineLength)
+    // Load into the specified 'result' the Base64 encoding, with the specified
+    // 'maxLineLength', of the specified 'length' bytes at the specified
+    // 'input'.
+{
+    bdlde::Base64Encoder encoder(maxLineLength);
+
+    result->resize(bdlde::Base64Encoder::encodedLength(length,
+                                                       maxLineLength));
+
+    int numOut, numIn, endNumOut;
+    encoder.convert(result->data(), &numOut, &numIn, input, input + length);
+    encoder.endConvert(result->data() + numOut, &endNumOut);
+
+    ASSERT(static_cast<int>(result->size()) == numOut + endNumOut);
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -1937,6 +2006,229 @@ void testCase##NUMBER(bool verbose,                                           \
                       bool veryVeryVerbose,                                   \
                       bool veryVeryVeryVerbose)
 
+DEFINE_TEST_CASE(12)
+{
+        (void)veryVeryVerbose;
+        (void)veryVeryVeryVerbose;
+
+        // --------------------------------------------------------------------
+        // TESTING CONTIGUOUS-BUFFER CONVERSION
+        //
+        // Concerns:
+        //: 1 Decoding from a 'const char *' or 'char *' input buffer to a
+        //:   'char *' output buffer produces the same output as decoding
+        //:   through any other iterator type.
+        //:
+        //: 2 The values loaded into 'numOut' and 'numIn', the returned
+        //:   status, and the state of the decoder are the same as for any
+        //:   other iterator type, in both error-reporting modes, for input
+        //:   supplied in chunks of every size, and for every 'maxNumOut'.
+        //:
+        //: 3 Line breaks, ignorable characters, padding, and invalid
+        //:   characters at any position, and in particular within a block
+        //:   decoded in bulk, are handled exactly as by the
+        //:   character-at-a-time implementation.
+        //
+        // Plan:
+        //: 1 For a set of encodings of pseudo-random data of varying length
+        //:   and maximum line length, and for variants of each in which a
+        //:   single character is replaced or inserted at each position,
+        //:   decode the input with one decoder writing to 'char *' and another
+        //:   writing through a minimal output iterator, in chunks of various
+        //:   sizes and with various 'maxNumOut', and verify that every call
+        //:   has the same results.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: contiguous buffers are decoded in bulk correctly.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONTIGUOUS-BUFFER CONVERSION" << endl
+                          << "====================================" << endl;
+
+        const char GARBAGE = char(0xa5);
+
+        const int LENGTHS[] = { 0, 1, 2, 3, 11, 12, 13, 24, 25, 47, 48, 49,
+                                57, 100, 1000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int LINE_LENGTHS[] = { 0, 4, 17, 76 };
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS
+                                                        / sizeof *LINE_LENGTHS;
+
+        const char EDITS[] = { ' ', '\n', '=', '!', '\x80', 'A', '/' };
+        const int NUM_EDITS = sizeof EDITS / sizeof *EDITS;
+
+        const int CHUNKS[] = { 1, 3, 16, 17, INT_MAX };
+        const int NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+
+        const int MAX_OUTS[] = { -1, 1, 2, 12, 13 };
+        const int NUM_MAX_OUTS = sizeof MAX_OUTS / sizeof *MAX_OUTS;
+
+        for (int ti = 0; ti < NUM_LENGTHS;      ++ti) {
+        for (int tj = 0; tj < NUM_LINE_LENGTHS; ++tj) {
+            const int LENGTH = LENGTHS[ti];
+            const int LINE   = LINE_LENGTHS[tj];
+
+            bsl::vector<char> data(LENGTH + 1);
+            u::fillPseudoRandom(data.data(), LENGTH, LENGTH);
+
+            bsl::vector<char> encoded;
+            u::encode(&encoded, data.data(), LENGTH, LINE);
+
+            const int ENCODED_LENGTH = static_cast<int>(encoded.size());
+
+            // Positions are sampled sparsely for long inputs.
+
+            const int STEP = ENCODED_LENGTH > 100 ? 23 : 1;
+
+            // Edit -1 is the unmodified encoding; edits '0 .. NUM_EDITS - 1'
+            // replace the character at 'POS', and edits
+            // 'NUM_EDITS .. 2 * NUM_EDITS - 1' insert a character before it.
+
+            for (int te = -1; te < 2 * NUM_EDITS;           ++te) {
+            for (int tp = 0;  tp <= ENCODED_LENGTH; tp += STEP) {
+                const int  POS    = tp;
+                const bool INSERT = te >= NUM_EDITS;
+
+                if (-1 == te && 0 != POS) {
+                    break;
+                }
+                if (0 <= te && !INSERT && POS == ENCODED_LENGTH) {
+                    continue;
+                }
+
+                bsl::vector<char> input(encoded);
+                if (0 <= te) {
+                    const char EDIT = EDITS[te % NUM_EDITS];
+                    if (INSERT) {
+                        input.insert(input.begin() + POS, EDIT);
+                    }
+                    else {
+                        input[POS] = EDIT;
+                    }
+                }
+
+                const int INPUT_LENGTH = static_cast<int>(input.size());
+                input.push_back('\0');
+
+                for (int tm = 0; tm < 2;            ++tm) {
+                for (int tk = 0; tk < NUM_CHUNKS;   ++tk) {
+                for (int tn = 0; tn < NUM_MAX_OUTS; ++tn) {
+                    const bool STRICT  = tm;
+                    const int  CHUNK   = CHUNKS[tk];
+                    const int  MAX_OUT = MAX_OUTS[tn];
+
+                    if (veryVerbose) {
+                        P_(LENGTH) P_(LINE) P_(te) P_(POS) P_(STRICT)
+                        P_(CHUNK) P(MAX_OUT)
+                    }
+
+                    const int OUT_LENGTH = Obj::maxDecodedLength(INPUT_LENGTH);
+
+                    bsl::vector<char> expected(OUT_LENGTH + 1, GARBAGE);
+                    bsl::vector<char> actual(OUT_LENGTH + 1, GARBAGE);
+
+                    Obj mX(STRICT);  const Obj& X = mX;  // bulk
+                    Obj mY(STRICT);  const Obj& Y = mY;  // reference
+
+                    const char *cursor = input.data();
+                    const char *end    = input.data() + INPUT_LENGTH;
+                    char       *out    = actual.data();
+                    char       *refOut = expected.data();
+
+                    bool failed = false;
+
+                    while (cursor != end) {
+                        const char *chunkEnd = end - cursor > CHUNK
+                                             ? cursor + CHUNK
+                                             : end;
+
+                        int numOutX = -7, numInX = -7;
+                        int numOutY = -9, numInY = -9;
+
+                        const int rcX = mX.convert(out,
+                                                   &numOutX,
+                                                   &numInX,
+                                                   cursor,
+                                                   chunkEnd,
+                                                   MAX_OUT);
+                        const int rcY = mY.convert(
+                                                u::CharOutputIterator(refOut),
+                                                &numOutY,
+                                                &numInY,
+                                                cursor,
+                                                chunkEnd,
+                                                MAX_OUT);
+
+                        ASSERTV(LENGTH, LINE, te, POS, CHUNK, MAX_OUT,
+                                rcX == rcY);
+                        ASSERTV(LENGTH, LINE, te, POS, CHUNK, MAX_OUT,
+                                numOutX == numOutY);
+                        ASSERTV(LENGTH, LINE, te, POS, CHUNK, MAX_OUT,
+                                numInX  == numInY);
+                        ASSERTV(LENGTH, LINE, te, POS, CHUNK, MAX_OUT,
+                                X.isError() == Y.isError());
+                        ASSERTV(LENGTH, LINE, te, POS, CHUNK, MAX_OUT,
+                                X.isAcceptable() == Y.isAcceptable());
+                        ASSERTV(LENGTH, LINE, te, POS, CHUNK, MAX_OUT,
+                                X.isMaximal() == Y.isMaximal());
+
+                        if (rcX != rcY || numOutX != numOutY
+                                       || numInX  != numInY) {
+                            failed = true;
+                            break;
+                        }
+                        if (0 > rcX || (0 == numInX && 0 == numOutX)) {
+                            break;
+                        }
+
+                        out    += numOutX;
+                        refOut += numOutY;
+                        cursor += numInX;
+                    }
+
+                    if (failed) {
+                        continue;
+                    }
+
+                    int numOutX = -7, numOutY = -9;
+
+                    const int rcX = mX.endConvert(out, &numOutX);
+                    const int rcY = mY.endConvert(
+                                                u::CharOutputIterator(refOut),
+                                                &numOutY);
+
+                    ASSERTV(LENGTH, LINE, te, POS, CHUNK, MAX_OUT,
+                            rcX == rcY);
+                    ASSERTV(LENGTH, LINE, te, POS, CHUNK, MAX_OUT,
+                            numOutX == numOutY);
+                    ASSERTV(LENGTH, LINE, te, POS, CHUNK, MAX_OUT,
+                            X.isDone() == Y.isDone());
+                    ASSERTV(LENGTH, LINE, te, POS, CHUNK, MAX_OUT,
+                            X.outputLength() == Y.outputLength());
+                    ASSERTV(LENGTH, LINE, te, POS, CHUNK, MAX_OUT,
+                            expected == actual);
+
+                    if (-1 == te) {
+                        ASSERTV(LENGTH, LINE, STRICT, CHUNK, MAX_OUT,
+                                X.isDone());
+                        ASSERTV(LENGTH, LINE, STRICT, CHUNK, MAX_OUT,
+                                LENGTH == X.outputLength());
+                        ASSERTV(LENGTH, LINE, STRICT, CHUNK, MAX_OUT,
+                                0 == bsl::memcmp(data.data(),
+                                                 actual.data(),
+                                                 LENGTH));
+                    }
+                }
+                }
+                }
+            }
+            }
+        }
+        }
+}
+
 DEFINE_TEST_CASE(11)
 {
         (void)veryVeryVerbose;
@@ -6345,6 +6637,7 @@ int main(int argc, char *argv[])
   case NUMBER: testCase##NUMBER(verbose, veryVerbose, veryVeryVerbose,        \
                                                     veryVeryVeryVerbose); break
 
+        CASE(12);
         CASE(11);
         CASE(10);
         CASE(9);
@@ -6357,6 +6650,90 @@ int main(int argc, char *argv[])
         CASE(2);
         CASE(1);
 #undef CASE
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Decoding contiguous buffers in bulk is faster than decoding
+        //:   through a general output iterator.
+        //
+        // Plan:
+        //: 1 Decode a large encoding of pseudo-random data repeatedly, with
+        //:   and without line breaks, writing to 'char *' and through a
+        //:   minimal output iterator, and report the throughput of each.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int LENGTH         = 3 * 1024 * 1024;
+        const int NUM_ITERATIONS = 20;
+
+        bsl::vector<char> data(LENGTH);
+        u::fillPseudoRandom(data.data(), LENGTH, 1);
+
+        bsl::vector<char> output(LENGTH);
+
+        const int LINES[] = { 0, 76 };
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const int LINE = LINES[ti];
+
+            bsl::vector<char> input;
+            u::encode(&input, data.data(), LENGTH, LINE);
+
+            const int INPUT_LENGTH = static_cast<int>(input.size());
+
+            double elapsed[2];
+
+            for (int bulk = 0; bulk < 2; ++bulk) {
+                bsls::Stopwatch timer;
+                timer.start();
+
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    Obj mX(true);
+
+                    int numOut, numIn, endNumOut;
+                    if (bulk) {
+                        mX.convert(output.data(),
+                                   &numOut,
+                                   &numIn,
+                                   input.data(),
+                                   input.data() + INPUT_LENGTH);
+                        mX.endConvert(output.data() + numOut, &endNumOut);
+                    }
+                    else {
+                        mX.convert(u::CharOutputIterator(output.data()),
+                                   &numOut,
+                                   &numIn,
+                                   input.data(),
+                                   input.data() + INPUT_LENGTH);
+                        mX.endConvert(
+                                u::CharOutputIterator(output.data() + numOut),
+                                &endNumOut);
+                    }
+                    ASSERT(LENGTH == numOut + endNumOut);
+                }
+
+                timer.stop();
+                elapsed[bulk] = timer.elapsedTime();
+            }
+
+            const double megabytes = double(INPUT_LENGTH) * NUM_ITERATIONS
+                                                             / (1024 * 1024);
+
+            cout << "maxLineLength = " << LINE
+                 << ": character-at-a-time " << megabytes / elapsed[0]
+                 << " MB/s, bulk " << megabytes / elapsed[1] << " MB/s"
+                 << ", speedup " << elapsed[0] / elapsed[1] << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
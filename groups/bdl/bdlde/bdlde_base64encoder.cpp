@@ -13,6 +13,21 @@
 BSLS_IDENT_RCSID(bdlde_base64encoder_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstddef.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <immintrin.h>
+#endif
 
 namespace BloombergLP {
 
@@ -35,6 +50,203 @@ static const char enc[] = {
     '4', '5', '6', '7', '8', '9', '+', '/',  // 070
 };
 
+namespace {
+
+enum {
+    k_BLOCK_INPUT_LENGTH  = 12,  // input bytes encoded by one block
+
+    k_BLOCK_OUTPUT_LENGTH = 16,  // characters emitted for one block
+
+    k_BLOCK_OVERREAD      =  4,  // bytes read beyond the input of the last
+                                 // block by the vectorized implementations
+
+    k_MAX_BYTE_OUTPUT     =  6   // maximum characters (including soft line
+                                 // breaks) emitted for one input byte
+};
+
+void encodeQuanta(char *out, const unsigned char *in, int numQuanta)
+    // Encode the specified 'numQuanta' 3-byte quanta starting at the
+    // specified 'in', and write the resulting '4 * numQuanta' characters to
+    // the specified 'out'.
+{
+    const unsigned char *end = in + numQuanta * 3;
+
+    for (; in != end; in += 3, out += 4) {
+        const unsigned value = (in[0] << 16) | (in[1] << 8) | in[2];
+
+        out[0] = enc[ value >> 18        ];
+        out[1] = enc[(value >> 12) & 0x3f];
+        out[2] = enc[(value >>  6) & 0x3f];
+        out[3] = enc[ value        & 0x3f];
+    }
+}
+
+#if defined(LIKE_X86_GCC)
+
+// The vectorized implementations below follow the approach described by
+// Wojciech Mula and Daniel Lemire in "Faster Base64 Encoding and Decoding
+// using AVX2 Instructions": the 12 input bytes of a block are shuffled so that
+// each 32-bit lane holds the 3 bytes of one quantum, the four 6-bit indices
+// of each quantum are moved to byte boundaries with two multiplies, and the
+// indices are translated to characters with a 16-entry table of offsets.
+
+__attribute__((target("ssse3")))
+inline
+__m128i encodeBlockSsse3(__m128i input)
+    // Return the 16 Base64 characters encoding the low 12 bytes of the
+    // specified 'input'.
+{
+    const __m128i shuffled = _mm_shuffle_epi8(
+                                     input,
+                                     _mm_setr_epi8(1,  0,  2,  1,
+                                                   4,  3,  5,  4,
+                                                   7,  6,  8,  7,
+                                                   10, 9, 11, 10));
+
+    const __m128i t0 = _mm_and_si128(shuffled, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(shuffled, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+
+    // Reduce each index to a table slot: 0 for 'A'..'Z', 1 for 'a'..'z',
+    // 2..11 for '0'..'9', 12 for '+', and 13 for '/'.
+
+    __m128i slots = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    slots = _mm_or_si128(slots, _mm_and_si128(less, _mm_set1_epi8(13)));
+
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '+' - 62,
+                                          '/' - 63, 'A',      0,        0);
+
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, slots), indices);
+}
+
+__attribute__((target("ssse3")))
+void encodeBlocksSsse3(char                *out,
+                       const unsigned char *in,
+                       int                  numBlocks)
+    // Encode the specified 'numBlocks' blocks of 'k_BLOCK_INPUT_LENGTH' bytes
+    // starting at the specified 'in', and write the resulting
+    // 'numBlocks * k_BLOCK_OUTPUT_LENGTH' characters to the specified 'out'.
+    // The behavior is undefined unless 'k_BLOCK_OVERREAD' bytes following
+    // the input can be read.
+{
+    for (int i = 0; i < numBlocks; ++i) {
+        const __m128i input = _mm_loadu_si128(
+                                        reinterpret_cast<const __m128i *>(in));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         encodeBlockSsse3(input));
+
+        in  += k_BLOCK_INPUT_LENGTH;
+        out += k_BLOCK_OUTPUT_LENGTH;
+    }
+}
+
+__attribute__((target("avx2")))
+void encodeBlocksAvx2(char                *out,
+                      const unsigned char *in,
+                      int                  numBlocks)
+    // Encode the specified 'numBlocks' blocks of 'k_BLOCK_INPUT_LENGTH' bytes
+    // starting at the specified 'in', and write the resulting
+    // 'numBlocks * k_BLOCK_OUTPUT_LENGTH' characters to the specified 'out'.
+    // The behavior is undefined unless 'k_BLOCK_OVERREAD' bytes following
+    // the input can be read.
+{
+    const __m256i shuffle = _mm256_setr_epi8(1,  0,  2,  1,
+                                             4,  3,  5,  4,
+                                             7,  6,  8,  7,
+                                             10, 9, 11, 10,
+                                             1,  0,  2,  1,
+                                             4,  3,  5,  4,
+                                             7,  6,  8,  7,
+                                             10, 9, 11, 10);
+    const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '+' - 62,
+                                             '/' - 63, 'A',      0,        0,
+                                             'a' - 26, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '+' - 62,
+                                             '/' - 63, 'A',      0,        0);
+
+    // Each iteration encodes two blocks, one per 128-bit lane.
+
+    for (; numBlocks >= 2; numBlocks -= 2) {
+        const __m128i low  = _mm_loadu_si128(
+                                        reinterpret_cast<const __m128i *>(in));
+        const __m128i high = _mm_loadu_si128(
+                 reinterpret_cast<const __m128i *>(in + k_BLOCK_INPUT_LENGTH));
+        const __m256i input = _mm256_inserti128_si256(
+                                         _mm256_castsi128_si256(low), high, 1);
+
+        const __m256i shuffled = _mm256_shuffle_epi8(input, shuffle);
+
+        const __m256i t0 = _mm256_and_si256(shuffled,
+                                            _mm256_set1_epi32(0x0fc0fc00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0,
+                                              _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(shuffled,
+                                            _mm256_set1_epi32(0x003f03f0));
+        const __m256i t3 = _mm256_mullo_epi16(t2,
+                                              _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(t1, t3);
+
+        __m256i slots = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        slots = _mm256_or_si256(slots,
+                                _mm256_and_si256(less, _mm256_set1_epi8(13)));
+
+        _mm256_storeu_si256(
+                     reinterpret_cast<__m256i *>(out),
+                     _mm256_add_epi8(_mm256_shuffle_epi8(offsets, slots),
+                                     indices));
+
+        in  += 2 * k_BLOCK_INPUT_LENGTH;
+        out += 2 * k_BLOCK_OUTPUT_LENGTH;
+    }
+
+    if (numBlocks) {
+        const __m128i input = _mm_loadu_si128(
+                                        reinterpret_cast<const __m128i *>(in));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         encodeBlockSsse3(input));
+    }
+}
+
+#endif  // LIKE_X86_GCC
+
+void encodeBlocks(char *out, const unsigned char *in, int numBlocks)
+    // Encode the specified 'numBlocks' blocks of 'k_BLOCK_INPUT_LENGTH' bytes
+    // starting at the specified 'in', and write the resulting
+    // 'numBlocks * k_BLOCK_OUTPUT_LENGTH' characters to the specified 'out',
+    // using the fastest implementation supported by the processor.  The
+    // behavior is undefined unless 'k_BLOCK_OVERREAD' bytes following the
+    // input can be read.
+{
+#if defined(LIKE_X86_GCC)
+    if (__builtin_cpu_supports("avx2")) {
+        encodeBlocksAvx2(out, in, numBlocks);
+        return;                                                       // RETURN
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        encodeBlocksSsse3(out, in, numBlocks);
+        return;                                                       // RETURN
+    }
+#endif
+
+    encodeQuanta(out, in, numBlocks * (k_BLOCK_INPUT_LENGTH / 3));
+}
+
+}  // close unnamed namespace
+
 namespace bdlde {
 
                          // -------------------
@@ -56,6 +268,113 @@ Base64Encoder::~Base64Encoder()
     BSLS_ASSERT(0 <= d_outputLength);
 }
 
+// PRIVATE MANIPULATORS
+void Base64Encoder::convertBulk(char       **out,
+                                const char **begin,
+                                const char  *end,
+                                int         *numIn,
+                                int          maxLength)
+{
+    BSLS_ASSERT(out);
+    BSLS_ASSERT(begin);
+    BSLS_ASSERT(numIn);
+    BSLS_ASSERT(4 >= d_bitsInStack);
+
+    const unsigned char *input    = reinterpret_cast<const unsigned char *>(
+                                                                       *begin);
+    const unsigned char *inputEnd = reinterpret_cast<const unsigned char *>(
+                                                                          end);
+    char                *output   = *out;
+
+    // Note that a 'maxLength' less than the current output length indicates
+    // that no limit is imposed (see 'convert').
+
+    const bool isLimited = maxLength >= d_outputLength;
+
+    while (input != inputEnd) {
+        const int available = isLimited ? maxLength - d_outputLength
+                                        : INT_MAX;
+
+        if (available < k_MAX_BYTE_OUTPUT) {
+            break;
+        }
+
+        if (0 == d_bitsInStack) {
+            if (d_maxLineLength && d_lineLength == d_maxLineLength) {
+                // Emit the pending soft line break, as encoding the next
+                // input byte would.
+
+                output[0]       = '\r';
+                output[1]       = '\n';
+                output         += 2;
+                d_outputLength += 2;
+                d_lineLength    = 0;
+                continue;
+            }
+
+            // Encode as many whole blocks, and then as many whole quanta, as
+            // fit in the input, the output limit, and the current line.
+
+            const int lineRoom = d_maxLineLength
+                                 ? d_maxLineLength - d_lineLength
+                                 : INT_MAX;
+            const int room     = lineRoom < available ? lineRoom : available;
+
+            bsl::ptrdiff_t numBlocks = (inputEnd - input - k_BLOCK_OVERREAD)
+                                     / k_BLOCK_INPUT_LENGTH;
+            if (numBlocks > room / k_BLOCK_OUTPUT_LENGTH) {
+                numBlocks = room / k_BLOCK_OUTPUT_LENGTH;
+            }
+
+            if (0 < numBlocks) {
+                const int n = static_cast<int>(numBlocks);
+
+                encodeBlocks(output, input, n);
+
+                input          += n * k_BLOCK_INPUT_LENGTH;
+                output         += n * k_BLOCK_OUTPUT_LENGTH;
+                d_outputLength += n * k_BLOCK_OUTPUT_LENGTH;
+                d_lineLength   += n * k_BLOCK_OUTPUT_LENGTH;
+                continue;
+            }
+
+            bsl::ptrdiff_t numQuanta = (inputEnd - input) / 3;
+            if (numQuanta > room / 4) {
+                numQuanta = room / 4;
+            }
+
+            if (0 < numQuanta) {
+                const int n = static_cast<int>(numQuanta);
+
+                encodeQuanta(output, input, n);
+
+                input          += n * 3;
+                output         += n * 4;
+                d_outputLength += n * 4;
+                d_lineLength   += n * 4;
+                continue;
+            }
+        }
+
+        // Consume one byte exactly as 'convert' does; soft line breaks and
+        // partial blocks are handled here.
+
+        d_stack        = (d_stack << 8) | *input;
+        d_bitsInStack += 8;
+        ++input;
+
+        encode(&output, maxLength);
+        if (6 <= d_bitsInStack) {
+            encode(&output, maxLength);
+        }
+    }
+
+    *numIn += static_cast<int>(
+                 input - reinterpret_cast<const unsigned char *>(*begin));
+    *begin  = reinterpret_cast<const char *>(input);
+    *out    = output;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -153,6 +153,18 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Contiguous Buffers
+///------------------
+// When 'convert' is supplied a contiguous input buffer (i.e., the input
+// iterators are of type 'const char *' or 'char *') and a contiguous output
+// buffer (i.e., the output iterator is of type 'char *'), the bulk of the
+// input is processed many bytes at a time rather than one byte at a time.  On
+// x86 platforms a vectorized implementation (using AVX2 or SSSE3 instructions)
+// is selected at run time according to the capabilities of the processor, and
+// a portable implementation is used otherwise.  The output, the values loaded
+// into 'numOut' and 'numIn', the returned status, and the resulting state of
+// the encoder are identical to those produced for any other iterator types.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Encoder' object to
@@ -454,6 +466,41 @@ class Base64Encoder {
         // does not equal 'maxLength' at entry to this method and the internal
         // buffer contains at least one character of output.
 
+    template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+    void convertBulk(OUTPUT_ITERATOR *out,
+                     INPUT_ITERATOR  *begin,
+                     INPUT_ITERATOR   end,
+                     int             *numIn,
+                     int              maxLength);
+        // Do nothing.  Note that this overload is selected unless the
+        // specified 'out' and 'begin' refer to contiguous character buffers,
+        // in which case all input is consumed by the byte-at-a-time loop in
+        // 'convert'; the specified 'end', 'numIn', and 'maxLength' are
+        // ignored.
+
+    void convertBulk(char        **out,
+                     const char  **begin,
+                     const char   *end,
+                     int          *numIn,
+                     int           maxLength);
+    void convertBulk(char  **out,
+                     char  **begin,
+                     char   *end,
+                     int    *numIn,
+                     int     maxLength);
+        // Consume input characters starting at the specified '*begin' up to,
+        // but not including, the specified 'end', and emit the resulting
+        // output starting at the specified '*out', many bytes at a time where
+        // possible, leaving this object in the same state as would the
+        // byte-at-a-time loop in 'convert'.  Advance '*begin' and '*out' past
+        // the consumed input and emitted output, respectively, and add the
+        // number of characters consumed to the specified '*numIn'.  Stop
+        // early, leaving the remaining input to 'convert', if emitting the
+        // output of one more input byte could make the total number of
+        // emitted characters equal the specified 'maxLength'.  The behavior
+        // is undefined unless '4 >= d_bitsInStack' and all output that can
+        // be emitted has been emitted.
+
   public:
     // CLASS METHODS
     static int encodedLength(int inputLength);
@@ -679,6 +726,29 @@ void Base64Encoder::encode(OUTPUT_ITERATOR *out, int maxLength)
     ++d_lineLength;
 }
 
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+inline
+void Base64Encoder::convertBulk(OUTPUT_ITERATOR *,
+                                INPUT_ITERATOR  *,
+                                INPUT_ITERATOR   ,
+                                int             *,
+                                int              )
+{
+}
+
+inline
+void Base64Encoder::convertBulk(char **out,
+                                char **begin,
+                                char  *end,
+                                int   *numIn,
+                                int    maxLength)
+{
+    const char *constBegin = *begin;
+
+    convertBulk(out, &constBegin, end, numIn, maxLength);
+    *begin += constBegin - *begin;
+}
+
 // CLASS METHODS
 inline
 int Base64Encoder::encodedLength(int inputLength, int maxLineLength)
@@ -806,10 +876,15 @@ int Base64Encoder::convert(OUTPUT_ITERATOR  out,
         encode(&out, maxLength);
     }
 
-    // Consume as many input bytes as possible.
+    // Consume as many input bytes as possible, in bulk if the buffers are
+    // contiguous.
 
     int tmpNumIn = 0;
 
+    if (6 > d_bitsInStack) {
+        convertBulk(&out, &begin, end, &tmpNumIn, maxLength);
+    }
+
     while (4 >= d_bitsInStack && begin != end) {
         const unsigned char byte = static_cast<unsigned char>(*begin);
 
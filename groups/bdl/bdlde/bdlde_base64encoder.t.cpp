@@ -15,6 +15,7 @@
 #include <bsls_assert.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>    // isgraph(), isalpha()
@@ -137,6 +138,8 @@ using bsl::flush;
 // [ 7] That each bit of a 2-byte quantum finds its appropriate spot.
 // [ 7] That each bit of a 1-byte quantum finds its appropriate spot.
 // [ 7] That output length is calculated properly.
+// [14] CONCERN: contiguous buffers are encoded in bulk correctly.
+// [-1] PERFORMANCE TEST
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -372,6 +375,52 @@ bool notBase64NotEqualsOrCRLF(char c)
     return !(bsl::isalnum(uc) || bsl::strchr("+/", uc));
 }
 
+                        // ========================
+                        // class CharOutputIterator
+                        // ========================
+
+class CharOutputIterator {
+    // This class provides a minimal output iterator over a character buffer.
+    // Supplying it to 'convert' selects the byte-at-a-time implementation,
+    // which is the reference for the bulk implementation selected for
+    // 'char *'.
+
+    // DATA
+    char *d_cursor_p;  // current position
+
+  public:
+    // CREATORS
+    explicit CharOutputIterator(char *cursor)
+        // Create an iterator referring to the specified 'cursor'.
+    : d_cursor_p(cursor)
+    {
+    }
+
+    // MANIPULATORS
+    char& operator*()
+        // Return a reference to the current character.
+    {
+        return *d_cursor_p;
+    }
+
+    CharOutputIterator& operator++()
+        // Advance this iterator and return a reference to it.
+    {
+        ++d_cursor_p;
+        return *this;
+    }
+};
+
+void fillPseudoRandom(char *buffer, int length, unsigned seed)
+    // Load the specified 'length' pseudo-random bytes generated from the
+    // specified 'seed' into the specified 'buffer'.
+{
+    for (int i = 0; i < length; ++i) {
+        seed = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<char>(seed >> 16);
+    }
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -1665,6 +1714,142 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING CONTIGUOUS-BUFFER CONVERSION
+        //
+        // Concerns:
+        //: 1 Encoding from a 'const char *' or 'char *' input buffer to a
+        //:   'char *' output buffer produces the same output as encoding
+        //:   through any other iterator type.
+        //:
+        //: 2 The values loaded into 'numOut' and 'numIn', the returned
+        //:   status, and the state of the encoder are the same as for any
+        //:   other iterator type, for every maximum line length, for input
+        //:   supplied in chunks of every size, and for every 'maxNumOut'
+        //:   supplied to 'convert'.
+        //:
+        //: 3 Input of every length, and in particular lengths around the
+        //:   size of the blocks encoded in bulk, is encoded correctly.
+        //
+        // Plan:
+        //: 1 For a set of pseudo-random inputs of varying length, maximum
+        //:   line lengths, chunk sizes, and 'maxNumOut' values, encode the
+        //:   input with one encoder writing to 'char *' and another writing
+        //:   through a minimal output iterator, and verify that every call
+        //:   has the same results.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: contiguous buffers are encoded in bulk correctly.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONTIGUOUS-BUFFER CONVERSION" << endl
+                          << "====================================" << endl;
+
+        const char GARBAGE = char(0xaf);
+
+        const int LENGTHS[] = { 0,  1,  2,  3,  4,  5,  11,  12,  13,  15,
+                               16, 17, 23, 24, 25, 27,  28,  29,  47,  48,
+                               49, 63, 64, 65, 99, 100, 257, 1000, 4099 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int LINE_LENGTHS[] = { 0, 1, 2, 3, 4, 5, 15, 16, 17, 31, 32,
+                                     33, 76 };
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS
+                                                        / sizeof *LINE_LENGTHS;
+
+        const int CHUNKS[] = { 1, 2, 3, 5, 13, 16, 17, 64, INT_MAX };
+        const int NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+
+        const int MAX_OUTS[] = { -1, 1, 2, 3, 5, 16, 17, 100 };
+        const int NUM_MAX_OUTS = sizeof MAX_OUTS / sizeof *MAX_OUTS;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            bsl::vector<char> input(LENGTH + 1);
+            u::fillPseudoRandom(input.data(), LENGTH, LENGTH);
+
+            for (int tj = 0; tj < NUM_LINE_LENGTHS; ++tj) {
+            for (int tk = 0; tk < NUM_CHUNKS;       ++tk) {
+            for (int tm = 0; tm < NUM_MAX_OUTS;     ++tm) {
+                const int LINE    = LINE_LENGTHS[tj];
+                const int CHUNK   = CHUNKS[tk];
+                const int MAX_OUT = MAX_OUTS[tm];
+
+                if (veryVerbose) { P_(LENGTH) P_(LINE) P_(CHUNK) P(MAX_OUT) }
+
+                const int OUT_LENGTH = Obj::encodedLength(LENGTH, LINE);
+
+                bsl::vector<char> expected(OUT_LENGTH + 1, GARBAGE);
+                bsl::vector<char> actual(OUT_LENGTH + 1, GARBAGE);
+
+                Obj mX(LINE);  const Obj& X = mX;  // bulk
+                Obj mY(LINE);  const Obj& Y = mY;  // reference
+
+                const char *cursor = input.data();
+                const char *end    = input.data() + LENGTH;
+                char       *out    = actual.data();
+
+                u::CharOutputIterator refOut(expected.data());
+
+                while (cursor != end) {
+                    const char *chunkEnd = end - cursor > CHUNK
+                                         ? cursor + CHUNK
+                                         : end;
+
+                    int numOutX = -7, numInX = -7;
+                    int numOutY = -9, numInY = -9;
+
+                    const int rcX = mX.convert(out,
+                                               &numOutX,
+                                               &numInX,
+                                               cursor,
+                                               chunkEnd,
+                                               MAX_OUT);
+                    const int rcY = mY.convert(refOut,
+                                               &numOutY,
+                                               &numInY,
+                                               cursor,
+                                               chunkEnd,
+                                               MAX_OUT);
+
+                    ASSERTV(LENGTH, LINE, CHUNK, MAX_OUT, rcX == rcY);
+                    ASSERTV(LENGTH, LINE, CHUNK, MAX_OUT, numOutX == numOutY);
+                    ASSERTV(LENGTH, LINE, CHUNK, MAX_OUT, numInX  == numInY);
+                    ASSERTV(LENGTH, LINE, CHUNK, MAX_OUT,
+                            X.outputLength() == Y.outputLength());
+
+                    if (numInX != numInY || numOutX != numOutY || 0 > rcX) {
+                        break;
+                    }
+
+                    for (int i = 0; i < numOutY; ++i) {
+                        ++refOut;
+                    }
+                    out    += numOutX;
+                    cursor += numInX;
+                }
+
+                int numOutX = -7, numOutY = -9;
+
+                const int rcX = mX.endConvert(out,    &numOutX);
+                const int rcY = mY.endConvert(refOut, &numOutY);
+
+                ASSERTV(LENGTH, LINE, CHUNK, MAX_OUT, rcX == rcY);
+                ASSERTV(LENGTH, LINE, CHUNK, MAX_OUT, numOutX == numOutY);
+
+                ASSERTV(LENGTH, LINE, CHUNK, MAX_OUT, X.isDone());
+                ASSERTV(LENGTH, LINE, CHUNK, MAX_OUT, Y.isDone());
+                ASSERTV(LENGTH, LINE, CHUNK, MAX_OUT,
+                        OUT_LENGTH == X.outputLength());
+                ASSERTV(LENGTH, LINE, CHUNK, MAX_OUT, expected == actual);
+            }
+            }
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING OPTIONAL NUMIN, NUMOUT
@@ -4009,6 +4194,84 @@ LOOP4_ASSERT(LINE, index, totalOut, localTotalOut, totalOut == localTotalOut);
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Encoding contiguous buffers in bulk is faster than encoding
+        //:   through a general output iterator.
+        //
+        // Plan:
+        //: 1 Encode a large pseudo-random buffer repeatedly, with and without
+        //:   line breaks, writing to 'char *' and through a minimal output
+        //:   iterator, and report the throughput of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int LENGTH         = 4 * 1024 * 1024;
+        const int NUM_ITERATIONS = 20;
+
+        bsl::vector<char> input(LENGTH);
+        u::fillPseudoRandom(input.data(), LENGTH, 1);
+
+        const int LINES[] = { 0, 76 };
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const int LINE = LINES[ti];
+
+            bsl::vector<char> output(Obj::encodedLength(LENGTH, LINE));
+
+            double elapsed[2];
+
+            for (int bulk = 0; bulk < 2; ++bulk) {
+                bsls::Stopwatch timer;
+                timer.start();
+
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    Obj mX(LINE);
+
+                    int numOut, numIn, endNumOut;
+                    if (bulk) {
+                        mX.convert(output.data(),
+                                   &numOut,
+                                   &numIn,
+                                   input.data(),
+                                   input.data() + LENGTH);
+                        mX.endConvert(output.data() + numOut, &endNumOut);
+                    }
+                    else {
+                        mX.convert(u::CharOutputIterator(output.data()),
+                                   &numOut,
+                                   &numIn,
+                                   input.data(),
+                                   input.data() + LENGTH);
+                        mX.endConvert(
+                                u::CharOutputIterator(output.data() + numOut),
+                                &endNumOut);
+                    }
+                    ASSERT(LENGTH == numIn);
+                }
+
+                timer.stop();
+                elapsed[bulk] = timer.elapsedTime();
+            }
+
+            const double megabytes = double(LENGTH) * NUM_ITERATIONS
+                                                             / (1024 * 1024);
+
+            cout << "maxLineLength = " << LINE
+                 << ": byte-at-a-time " << megabytes / elapsed[0] << " MB/s"
+                 << ", bulk " << megabytes / elapsed[1] << " MB/s"
+                 << ", speedup " << elapsed[0] / elapsed[1] << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
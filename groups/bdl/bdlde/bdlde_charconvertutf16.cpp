@@ -19,11 +19,16 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bslmf_issame.h>
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>  // 'min'
 #include <bsl_climits.h>    // 'CHAR_BIT'
 #include <bsl_cstdint.h>    // 'WCHAR_WIDTH'
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 ///IMPLEMENTATION NOTES
 ///--------------------
 // This UTF-8 documentation was copied verbatim from RFC 3629.  The original
@@ -308,6 +313,120 @@ wchar_t hostToSwapped<wchar_t, 4>(wchar_t uc)
     return (static_cast<unsigned int>(uc) << 24) | ((uc & 0xff00) << 8);
 }
 
+// 'widenAscii' and 'narrowAscii' functions
+// - - - - - - - - - - - - - - - - - - - -
+// These two template functions translate runs of ASCII between bytes and
+// words of host byte order, which is the most common case, in bulk.  Where
+// SSE2 is available, 16 code points are translated at a time, by
+// interleaving the bytes with zeros or by packing the words into bytes,
+// respectively.
+
+template <class WORD>
+bsl::size_t widenAscii(WORD                *dst,
+                       const unsigned char *src,
+                       bsl::size_t          length)
+    // Copy to the specified 'dst', widening each byte to a 'WORD', the
+    // longest prefix of the specified 'length' bytes at the specified 'src'
+    // that contains only ASCII, and return the length of that prefix.
+{
+    BSLMF_ASSERT(2 == sizeof(WORD) || 4 == sizeof(WORD));
+
+    bsl::size_t i = 0;
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; length - i >= 16; i += 16) {
+        const __m128i input = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(src + i));
+        if (_mm_movemask_epi8(input)) {
+            break;
+        }
+
+        __m128i *out = reinterpret_cast<__m128i *>(dst + i);
+
+        const __m128i low  = _mm_unpacklo_epi8(input, zero);
+        const __m128i high = _mm_unpackhi_epi8(input, zero);
+        if (2 == sizeof(WORD)) {
+            _mm_storeu_si128(out,     low);
+            _mm_storeu_si128(out + 1, high);
+        }
+        else {
+            _mm_storeu_si128(out,     _mm_unpacklo_epi16(low,  zero));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low,  zero));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+        }
+    }
+#endif
+
+    for (; i < length && src[i] < 0x80; ++i) {
+        dst[i] = static_cast<WORD>(src[i]);
+    }
+
+    return i;
+}
+
+template <class BYTE, class WORD>
+bsl::size_t narrowAscii(BYTE *dst, const WORD *src, bsl::size_t length)
+    // Copy to the specified 'dst', narrowing each word to a 'BYTE', the
+    // longest prefix of the specified 'length' words at the specified 'src'
+    // that contains only ASCII, and return the length of that prefix.
+{
+    BSLMF_ASSERT(1 == sizeof(BYTE));
+    BSLMF_ASSERT(2 == sizeof(WORD) || 4 == sizeof(WORD));
+
+    bsl::size_t i = 0;
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; length - i >= 16; i += 16) {
+        const __m128i *in = reinterpret_cast<const __m128i *>(src + i);
+        __m128i        packed;
+
+        if (2 == sizeof(WORD)) {
+            const __m128i w0 = _mm_loadu_si128(in);
+            const __m128i w1 = _mm_loadu_si128(in + 1);
+
+            const __m128i high = _mm_and_si128(
+                                   _mm_or_si128(w0, w1),
+                                   _mm_set1_epi16(static_cast<short>(0xff80)));
+            if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi16(high, zero))) {
+                break;
+            }
+
+            packed = _mm_packus_epi16(w0, w1);
+        }
+        else {
+            const __m128i w0 = _mm_loadu_si128(in);
+            const __m128i w1 = _mm_loadu_si128(in + 1);
+            const __m128i w2 = _mm_loadu_si128(in + 2);
+            const __m128i w3 = _mm_loadu_si128(in + 3);
+
+            const __m128i high = _mm_and_si128(
+                                          _mm_or_si128(_mm_or_si128(w0, w1),
+                                                       _mm_or_si128(w2, w3)),
+                                          _mm_set1_epi32(~0x7f));
+            if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi32(high, zero))) {
+                break;
+            }
+
+            packed = _mm_packus_epi16(_mm_packs_epi32(w0, w1),
+                                      _mm_packs_epi32(w2, w3));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), packed);
+    }
+#endif
+
+    for (; i < length && 0 == (src[i] & ~static_cast<WORD>(0x7f)); ++i) {
+        dst[i] = static_cast<BYTE>(src[i]);
+    }
+
+    return i;
+}
+
 struct Capacity {
     // Functor passed to 'localUtf8ToUtf16' and 'localUtf16ToUtf8' in cases
     // where we monitor capacity available in output.  Initialize in c'tor with
@@ -325,13 +444,16 @@ struct Capacity {
     void operator--() { --d_capacity; }
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta) { d_capacity -= delta; }
+    void operator-=(bsl::size_t delta) { d_capacity -= delta; }
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
     bool operator<(bsl::size_t rhs) const { return d_capacity < rhs; }
         // Return 'true' if 'd_capacity' is less than the specified 'rhs', and
         // 'false' otherwise.
+
+    bsl::size_t available() const { return d_capacity; }
+        // Return 'd_capacity'.
 };
 
 struct NoOpCapacity {
@@ -345,12 +467,15 @@ struct NoOpCapacity {
     void operator--() {}
         // No-op.
 
-    void operator-=(int) {}
+    void operator-=(bsl::size_t) {}
         // No-op.
 
     // ACCESSORS
     bool operator<(bsl::size_t) const { return false; }
         // Return 'false'.
+
+    bsl::size_t available() const { return ~bsl::size_t(0); }
+        // Return the maximum value of 'bsl::size_t'.
 };
 
 // LOCAL HELPER STRUCT
@@ -418,6 +543,14 @@ struct Utf8 {
             }
         }
 
+        bsl::size_t numReadable(const OctetType *position) const
+            // Return the number of octets of input from the specified
+            // 'position' to the end.  The behavior is undefined unless
+            // 'position <= d_end'.
+        {
+            return d_end - position;
+        }
+
         const OctetType *skipContinuations(const OctetType *octets) const
             // Return a pointer to after all the consecutive continuation
             // bytes following the specified 'octets' that are prior to
@@ -479,6 +612,13 @@ struct Utf8 {
             return 0 == *position;
         }
 
+        bsl::size_t numReadable(const OctetType *) const
+            // Return 0.  Note that the length of null-terminated input is not
+            // known in advance, so it is never translated in bulk.
+        {
+            return 0;
+        }
+
         const OctetType *skipContinuations(const OctetType *octets) const
             // Return a pointer to after all the consecutive continuation
             // bytes following the specified 'octets'.  The behavior is
@@ -752,6 +892,14 @@ struct Utf16 {
                 return true;                                          // RETURN
             }
         }
+
+        bsl::size_t numReadable(const UTF16_WORD *utf16Buf) const
+            // Return the number of words of input from the specified
+            // 'utf16Buf' to the end.  The behavior is undefined unless
+            // 'utf16Buf <= d_end'.
+        {
+            return d_end - utf16Buf;
+        }
     };
 
     template <class UTF16_WORD>
@@ -772,6 +920,13 @@ struct Utf16 {
         {
             return !*u16Buf;
         }
+
+        bsl::size_t numReadable(const UTF16_WORD *) const
+            // Return 0.  Note that the length of null-terminated input is not
+            // known in advance, so it is never translated in bulk.
+        {
+            return 0;
+        }
     };
 
     // CLASS METHODS
@@ -953,6 +1108,42 @@ struct Swapper {
 
         return BloombergLP::bsls::ByteOrderUtil::swapBytes(utf16Word);
     }
+
+    static
+    bsl::size_t widenAscii(UTF16_WORD            *u16Buf,
+                           const Utf8::OctetType *octets,
+                           bsl::size_t            length)
+        // Write to the specified 'u16Buf' the swapped single-word encodings
+        // of the longest prefix of the specified 'length' octets at the
+        // specified 'octets' that are single-octet code points, and return
+        // the length of that prefix.
+    {
+        bsl::size_t i = 0;
+        for (; i < length && Utf8::isSingleOctet(octets[i]); ++i) {
+            u16Buf[i] = encodeSingleWord(octets[i]);
+        }
+        return i;
+    }
+
+    static
+    bsl::size_t narrowAscii(char             *dstBuf,
+                            const UTF16_WORD *u16Buf,
+                            bsl::size_t       length)
+        // Write to the specified 'dstBuf' the single-octet UTF-8 encodings of
+        // the longest prefix of the specified 'length' swapped words at the
+        // specified 'u16Buf' that are single-octet code points, and return
+        // the length of that prefix.
+    {
+        bsl::size_t i = 0;
+        for (; i < length; ++i) {
+            const UnicodeCodePoint word = decodeSingleWord(u16Buf + i);
+            if (!Utf16::isSingleUtf8(word)) {
+                break;
+            }
+            dstBuf[i] = Utf16::getUtf8Value(word);
+        }
+        return i;
+    }
 };
 
 template <class UTF16_WORD>
@@ -1002,6 +1193,30 @@ struct NoOpSwapper {
     {
         return utf16Word;
     }
+
+    static
+    bsl::size_t widenAscii(UTF16_WORD            *u16Buf,
+                           const Utf8::OctetType *octets,
+                           bsl::size_t            length)
+        // Write to the specified 'u16Buf' the single-word encodings, in host
+        // byte order, of the longest prefix of the specified 'length' octets
+        // at the specified 'octets' that are single-octet code points, and
+        // return the length of that prefix.
+    {
+        return ::widenAscii(u16Buf, octets, length);
+    }
+
+    static
+    bsl::size_t narrowAscii(char             *dstBuf,
+                            const UTF16_WORD *u16Buf,
+                            bsl::size_t       length)
+        // Write to the specified 'dstBuf' the single-octet UTF-8 encodings of
+        // the longest prefix of the specified 'length' words, in host byte
+        // order, at the specified 'u16Buf' that are single-octet code points,
+        // and return the length of that prefix.
+    {
+        return ::narrowAscii(dstBuf, u16Buf, length);
+    }
 };
 
 // These compile-time asserts aren't strictly necessary, but we may plan to
@@ -1176,6 +1391,23 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
                 break;
             }
 
+            // Translate as much of the run of single-octet code points
+            // starting here as the input and the output (less room for the
+            // null) allow in bulk.
+
+            const bsl::size_t numAscii = SWAPPER::widenAscii(
+                                    dstBuffer,
+                                    octets,
+                                    bsl::min(endFunctor.numReadable(octets),
+                                             dstCapacity.available() - 1));
+            if (numAscii) {
+                octets      += numAscii;
+                dstBuffer   += numAscii;
+                dstCapacity -= numAscii;
+                nCodePoints += numAscii;
+                continue;
+            }
+
             *dstBuffer = SWAPPER::encodeSingleWord(*octets);
             ++octets;
             ++dstBuffer;
@@ -1474,6 +1706,24 @@ int localUtf16ToUtf8(char             *dstBuffer,
                 returnStatus |= OUT_OF_SPACE_BIT;
                 break;
             }
+
+            // Translate as much of the run of single-octet code points
+            // starting here as the input and the output (less room for the
+            // null) allow in bulk.
+
+            const bsl::size_t numAscii = SWAPPER::narrowAscii(
+                                 dstBuffer,
+                                 srcBuffer,
+                                 bsl::min(endFunctor.numReadable(srcBuffer),
+                                          dstCapacity.available() - 1));
+            if (numAscii) {
+                srcBuffer   += numAscii;
+                dstBuffer   += numAscii;
+                dstCapacity -= numAscii;
+                nCodePoints += numAscii;
+                continue;
+            }
+
             *dstBuffer = Utf16::getUtf8Value(word0);
             ++srcBuffer;
             ++dstBuffer;
@@ -31,6 +31,8 @@
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>
 #include <bsl_c_ctype.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -128,6 +130,7 @@ using namespace bsl;
 // Exercise boundary cases for both of the conversion mappings as well as
 // handling of buffer capacity issues.
 //-----------------------------------------------------------------------------
+// [16] BULK TRANSLATION OF ASCII
 // [15] USAGE EXAMPLE 2
 // [14] USAGE EXAMPLE 1
 // [13] BACKWARDS BYTE ORDER TEST
@@ -4425,6 +4428,142 @@ bsl::size_t localUtf16Len(const UTF16_WORD *str)
     return pws - str;
 }
 
+static
+int utf16ToUtf8WithLength(char                   *dstBuffer,
+                          bsl::size_t             dstCapacity,
+                          const unsigned short   *srcString,
+                          bsl::size_t             srcLengthInWords,
+                          bsl::size_t            *numCodePointsWritten,
+                          bsl::size_t            *numBytesWritten,
+                          bdlde::ByteOrder::Enum  byteOrder)
+    // Call the 'Util::utf16ToUtf8' overload taking a buffer of the specified
+    // 'dstCapacity' at the specified 'dstBuffer' and the specified
+    // 'srcLengthInWords' words at the specified 'srcString', passing the
+    // specified 'numCodePointsWritten', 'numBytesWritten', and 'byteOrder',
+    // and return the result.
+{
+    return Util::utf16ToUtf8(dstBuffer,
+                             dstCapacity,
+                             srcString,
+                             srcLengthInWords,
+                             numCodePointsWritten,
+                             numBytesWritten,
+                             '?',
+                             byteOrder);
+}
+
+static
+int utf16ToUtf8WithLength(char                   *dstBuffer,
+                          bsl::size_t             dstCapacity,
+                          const wchar_t          *srcString,
+                          bsl::size_t             srcLengthInWords,
+                          bsl::size_t            *numCodePointsWritten,
+                          bsl::size_t            *numBytesWritten,
+                          bdlde::ByteOrder::Enum  byteOrder)
+    // Call the 'Util::utf16ToUtf8' overload taking a buffer of the specified
+    // 'dstCapacity' at the specified 'dstBuffer' and a string reference to
+    // the specified 'srcLengthInWords' words at the specified 'srcString',
+    // passing the specified 'numCodePointsWritten', 'numBytesWritten', and
+    // 'byteOrder', and return the result.
+{
+    return Util::utf16ToUtf8(dstBuffer,
+                             dstCapacity,
+                             bslstl::StringRefWide(srcString,
+                                                   srcLengthInWords),
+                             numCodePointsWritten,
+                             numBytesWritten,
+                             '?',
+                             byteOrder);
+}
+
+template <class UTF16_WORD>
+static
+void testBulkTranslation(int                     line,
+                         const bsl::string&      utf8,
+                         bdlde::ByteOrder::Enum  byteOrder)
+    // Translate the specified 'utf8' to UTF-16 in the specified 'byteOrder'
+    // and back, into buffers of every capacity up to that needed, and verify
+    // that the overloads taking input of known length, which translate runs
+    // of ASCII in bulk, yield the same results as the overloads taking
+    // null-terminated input, which do not.  Use the specified 'line' to
+    // identify failures.  The behavior is undefined unless 'utf8' contains no
+    // null bytes.
+{
+    const bsl::size_t LEN = utf8.length();
+
+    bsl::vector<UTF16_WORD> u16A(LEN + 1);
+    bsl::vector<UTF16_WORD> u16B(LEN + 1);
+
+    int         rcA, rcB;
+    bsl::size_t numCpA, numCpB, numA, numB;
+
+    for (bsl::size_t cap = 0; cap <= LEN + 1; ++cap) {
+        numCpA = numCpB = numA = numB = 12345;
+
+        rcA = Util::utf8ToUtf16(&u16A[0],
+                                cap,
+                                bslstl::StringRef(utf8),
+                                &numCpA,
+                                &numA,
+                                '?',
+                                byteOrder);
+        rcB = Util::utf8ToUtf16(&u16B[0],
+                                cap,
+                                utf8.c_str(),
+                                &numCpB,
+                                &numB,
+                                '?',
+                                byteOrder);
+
+        ASSERTV(line, cap, rcA, rcB, rcA == rcB);
+        ASSERTV(line, cap, numCpA, numCpB, numCpA == numCpB);
+        ASSERTV(line, cap, numA, numB, numA == numB);
+        ASSERTV(line, cap, numA <= cap);
+        ASSERTV(line, cap, bsl::equal(u16A.begin(),
+                                      u16A.begin() + numA,
+                                      u16B.begin()));
+    }
+
+    // 'u16A' now holds the whole translation, including the null.
+
+    const bsl::size_t U16_LEN = numA - 1;
+
+    // Introduce an unpaired surrogate, which is invalid.
+
+    if (bdlde::ByteOrder::e_HOST == byteOrder && U16_LEN) {
+        u16A[line % U16_LEN] = static_cast<UTF16_WORD>(0xdc00);
+    }
+
+    bsl::vector<char> u8A(LEN + 1);
+    bsl::vector<char> u8B(LEN + 1);
+
+    for (bsl::size_t cap = 0; cap <= LEN + 1; ++cap) {
+        numCpA = numCpB = numA = numB = 12345;
+
+        rcA = utf16ToUtf8WithLength(&u8A[0],
+                                    cap,
+                                    &u16A[0],
+                                    U16_LEN,
+                                    &numCpA,
+                                    &numA,
+                                    byteOrder);
+        rcB = Util::utf16ToUtf8(&u8B[0],
+                                cap,
+                                &u16A[0],
+                                &numCpB,
+                                &numB,
+                                '?',
+                                byteOrder);
+
+        ASSERTV(line, cap, rcA, rcB, rcA == rcB);
+        ASSERTV(line, cap, numCpA, numCpB, numCpA == numCpB);
+        ASSERTV(line, cap, numA, numB, numA == numB);
+        ASSERTV(line, cap, numA <= cap);
+        ASSERTV(line, cap, bsl::equal(u8A.begin(),
+                                      u8A.begin() + numA,
+                                      u8B.begin()));
+    }
+}
 
 // ============================================================================
 //                               MAIN PROGRAM
@@ -4448,6 +4587,81 @@ int main(int argc, char**argv)
     bslma::DefaultAllocatorGuard daGuard(&da);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 16: {
+        // --------------------------------------------------------------------
+        // BULK TRANSLATION OF ASCII
+        //
+        // Concerns:
+        //: 1 Runs of ASCII in input of known length, which are translated in
+        //:   bulk, are translated exactly as they are in null-terminated
+        //:   input, which is translated one code point at a time.
+        //:
+        //: 2 Runs of ASCII of every length, including runs ending at the end
+        //:   of the input or at an invalid sequence, are translated.
+        //:
+        //: 3 Translation into a fixed-size buffer stops, leaving room for the
+        //:   null terminator, at the same point whether or not it is in the
+        //:   middle of a run of ASCII.
+        //:
+        //: 4 Bulk translation honors the byte order of the UTF-16.
+        //
+        // Plan:
+        //: 1 Generate pseudo-random strings consisting of runs of ASCII of
+        //:   random length separated by multi-octet code points and invalid
+        //:   sequences.
+        //:
+        //: 2 Translate each string from UTF-8 to UTF-16 and back, in both
+        //:   byte orders, for both 'unsigned short' and 'wchar_t' words, into
+        //:   buffers of every capacity up to that needed, and verify that the
+        //:   results of the overloads taking input of known length and of the
+        //:   overloads taking null-terminated input are the same.  (C-1..4)
+        //
+        // Testing:
+        //   BULK TRANSLATION OF ASCII
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BULK TRANSLATION OF ASCII\n"
+                             "=========================\n";
+
+        bslma::TestAllocator         ta(veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard daGuard(&ta);
+
+        static const char *const SEPARATORS[] = {
+            "\xc3\xa9",              // 2-octet code point
+            "\xe2\x82\xac",          // 3-octet code point
+            "\xf0\x9f\x98\x80",      // 4-octet code point
+            "\xff",                  // invalid octet
+            "\x80",                  // unexpected continuation
+            "\xe2\x82",              // truncated sequence
+        };
+        enum { k_NUM_SEPARATORS = sizeof SEPARATORS / sizeof *SEPARATORS };
+
+        unsigned int seed = 12345;
+
+        for (int ti = 0; ti < 300; ++ti) {
+            bsl::string utf8;
+
+            while (utf8.length() < static_cast<bsl::size_t>(ti / 2)) {
+                seed = seed * 1103515245 + 12345;
+                const unsigned numAscii = (seed >> 16) % 40;
+                for (unsigned ii = 0; ii < numAscii; ++ii) {
+                    utf8 += static_cast<char>(' ' + (ii * 7 + ti) % 95);
+                }
+                if (seed & 1) {
+                    utf8 += SEPARATORS[(seed >> 8) % k_NUM_SEPARATORS];
+                }
+            }
+
+            if (veryVerbose) { P_(ti);    P(utf8.length()); }
+
+            testBulkTranslation<unsigned short>(ti,
+                                                utf8,
+                                                bdlde::ByteOrder::e_HOST);
+            testBulkTranslation<unsigned short>(ti, utf8, e_BACKWARDS);
+            testBulkTranslation<wchar_t>(ti, utf8, bdlde::ByteOrder::e_HOST);
+            testBulkTranslation<wchar_t>(ti, utf8, e_BACKWARDS);
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
@@ -18,6 +18,7 @@ BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>    // 'bsl::find'
@@ -25,6 +26,10 @@ BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
 #include <bsl_climits.h>      // 'CHAR_BIT'
 #include <bsl_cstring.h>
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 ///IMPLEMENTATION NOTES
 ///--------------------
 // This UTF-8 documentation was copied verbatim from RFC 3629.  The original
@@ -161,6 +166,120 @@ enum Utf8Bits {
     k_FOUR_OCTET_TAG     = k_THREE_OCTET_MASK // compare this to masked bits
 };
 
+// 'widenAscii' and 'narrowAscii' functions
+// - - - - - - - - - - - - - - - - - - - -
+// These two template functions translate runs of ASCII between UTF-8 and
+// UTF-32 in host byte order, which is the most common case, in bulk.  Where
+// SSE2 is available, 16 code points are translated at a time, by
+// interleaving the bytes with zeros or by packing the words into bytes,
+// respectively.
+
+template <class WORD>
+bsl::size_t widenAscii(WORD                *dst,
+                       const unsigned char *src,
+                       bsl::size_t          length)
+    // Copy to the specified 'dst', widening each byte to a 'WORD', the
+    // longest prefix of the specified 'length' bytes at the specified 'src'
+    // that contains only ASCII, and return the length of that prefix.
+{
+    BSLMF_ASSERT(2 == sizeof(WORD) || 4 == sizeof(WORD));
+
+    bsl::size_t i = 0;
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; length - i >= 16; i += 16) {
+        const __m128i input = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(src + i));
+        if (_mm_movemask_epi8(input)) {
+            break;
+        }
+
+        __m128i *out = reinterpret_cast<__m128i *>(dst + i);
+
+        const __m128i low  = _mm_unpacklo_epi8(input, zero);
+        const __m128i high = _mm_unpackhi_epi8(input, zero);
+        if (2 == sizeof(WORD)) {
+            _mm_storeu_si128(out,     low);
+            _mm_storeu_si128(out + 1, high);
+        }
+        else {
+            _mm_storeu_si128(out,     _mm_unpacklo_epi16(low,  zero));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low,  zero));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+        }
+    }
+#endif
+
+    for (; i < length && src[i] < 0x80; ++i) {
+        dst[i] = static_cast<WORD>(src[i]);
+    }
+
+    return i;
+}
+
+template <class BYTE, class WORD>
+bsl::size_t narrowAscii(BYTE *dst, const WORD *src, bsl::size_t length)
+    // Copy to the specified 'dst', narrowing each word to a 'BYTE', the
+    // longest prefix of the specified 'length' words at the specified 'src'
+    // that contains only ASCII, and return the length of that prefix.
+{
+    BSLMF_ASSERT(1 == sizeof(BYTE));
+    BSLMF_ASSERT(2 == sizeof(WORD) || 4 == sizeof(WORD));
+
+    bsl::size_t i = 0;
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; length - i >= 16; i += 16) {
+        const __m128i *in = reinterpret_cast<const __m128i *>(src + i);
+        __m128i        packed;
+
+        if (2 == sizeof(WORD)) {
+            const __m128i w0 = _mm_loadu_si128(in);
+            const __m128i w1 = _mm_loadu_si128(in + 1);
+
+            const __m128i high = _mm_and_si128(
+                                   _mm_or_si128(w0, w1),
+                                   _mm_set1_epi16(static_cast<short>(0xff80)));
+            if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi16(high, zero))) {
+                break;
+            }
+
+            packed = _mm_packus_epi16(w0, w1);
+        }
+        else {
+            const __m128i w0 = _mm_loadu_si128(in);
+            const __m128i w1 = _mm_loadu_si128(in + 1);
+            const __m128i w2 = _mm_loadu_si128(in + 2);
+            const __m128i w3 = _mm_loadu_si128(in + 3);
+
+            const __m128i high = _mm_and_si128(
+                                          _mm_or_si128(_mm_or_si128(w0, w1),
+                                                       _mm_or_si128(w2, w3)),
+                                          _mm_set1_epi32(~0x7f));
+            if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi32(high, zero))) {
+                break;
+            }
+
+            packed = _mm_packus_epi16(_mm_packs_epi32(w0, w1),
+                                      _mm_packs_epi32(w2, w3));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), packed);
+    }
+#endif
+
+    for (; i < length && 0 == (src[i] & ~static_cast<WORD>(0x7f)); ++i) {
+        dst[i] = static_cast<BYTE>(src[i]);
+    }
+
+    return i;
+}
+
                            // =====================
                            // local struct Capacity
                            // =====================
@@ -182,7 +301,7 @@ struct Capacity {
     void operator--();
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta);
+    void operator-=(bsl::size_t delta);
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
@@ -190,6 +309,9 @@ struct Capacity {
         // Return 'true' if 'd_capacity' is less than the specified 'rhs', and
         // 'false' otherwise.
 
+    bsl::size_t available() const;
+        // Return 'd_capacity'.
+
     bool operator>=(bsl::size_t rhs) const;
         // Return 'true' if 'd_capacity' is greater than or equal to the
         // specified 'rhs', and 'false' otherwise.
@@ -214,7 +336,7 @@ void Capacity::operator--()
 }
 
 inline
-void Capacity::operator-=(int delta)
+void Capacity::operator-=(bsl::size_t delta)
     // Decrement 'd_capacity' by 'delta'.
 {
     d_capacity -= delta;
@@ -237,6 +359,13 @@ bool Capacity::operator>=(bsl::size_t rhs) const
     return d_capacity >= rhs;
 }
 
+inline
+bsl::size_t Capacity::available() const
+    // Return 'd_capacity'.
+{
+    return d_capacity;
+}
+
                          // =========================
                          // local struct NoopCapacity
                          // =========================
@@ -257,7 +386,7 @@ struct NoopCapacity {
     void operator--();
         // No-op.
 
-    void operator-=(int);
+    void operator-=(bsl::size_t);
         // No-op.
 
     // ACCESSORS
@@ -266,6 +395,9 @@ struct NoopCapacity {
 
     bool operator>=(bsl::size_t) const;
         // Return 'true'.
+
+    bsl::size_t available() const;
+        // Return the maximum value of 'bsl::size_t'.
 };
 
                          // -------------------------
@@ -285,7 +417,7 @@ void NoopCapacity::operator--()
 {}
 
 inline
-void NoopCapacity::operator-=(int)
+void NoopCapacity::operator-=(bsl::size_t)
     // No-op.
 {}
 
@@ -304,6 +436,13 @@ bool NoopCapacity::operator>=(bsl::size_t) const
     return true;
 }
 
+inline
+bsl::size_t NoopCapacity::available() const
+    // Return the maximum value of 'bsl::size_t'.
+{
+    return ~bsl::size_t(0);
+}
+
                             // ====================
                             // local struct Swapper
                             // ====================
@@ -315,6 +454,22 @@ struct Swapper {
     // CLASS METHODS
     static unsigned int swapBytes(unsigned int x);
         // Return the specified 'x' with its byte order reversed;
+
+    static bsl::size_t widenAscii(unsigned int    *dst,
+                                  const OctetType *src,
+                                  bsl::size_t      length);
+        // Write to the specified 'dst', with their byte order reversed, the
+        // UTF-32 words of the longest prefix of the specified 'length' octets
+        // at the specified 'src' that are single-octet code points, and
+        // return the length of that prefix.
+
+    static bsl::size_t narrowAscii(OctetType          *dst,
+                                   const unsigned int *src,
+                                   bsl::size_t         length);
+        // Write to the specified 'dst' the single-octet UTF-8 encodings of
+        // the longest prefix of the specified 'length' words at the specified
+        // 'src', whose byte order is reversed, that are single-octet code
+        // points, and return the length of that prefix.
 };
 
 inline
@@ -323,6 +478,34 @@ unsigned int Swapper::swapBytes(unsigned int x)
     return BloombergLP::bsls::ByteOrderUtil::swapBytes(x);
 }
 
+inline
+bsl::size_t Swapper::widenAscii(unsigned int    *dst,
+                                const OctetType *src,
+                                bsl::size_t      length)
+{
+    bsl::size_t i = 0;
+    for (; i < length && src[i] < 0x80; ++i) {
+        dst[i] = swapBytes(src[i]);
+    }
+    return i;
+}
+
+inline
+bsl::size_t Swapper::narrowAscii(OctetType          *dst,
+                                 const unsigned int *src,
+                                 bsl::size_t         length)
+{
+    bsl::size_t i = 0;
+    for (; i < length; ++i) {
+        const unsigned int uc = swapBytes(src[i]);
+        if (uc >= 0x80) {
+            break;
+        }
+        dst[i] = static_cast<OctetType>(uc);
+    }
+    return i;
+}
+
                           // ========================
                           // local struct NoopSwapper
                           // ========================
@@ -337,6 +520,21 @@ struct NoopSwapper {
     // CLASS METHODS
     static unsigned int swapBytes(unsigned int x);
         // Return the specified 'x' without modification.
+
+    static bsl::size_t widenAscii(unsigned int    *dst,
+                                  const OctetType *src,
+                                  bsl::size_t      length);
+        // Write to the specified 'dst' the UTF-32 words of the longest prefix
+        // of the specified 'length' octets at the specified 'src' that are
+        // single-octet code points, and return the length of that prefix.
+
+    static bsl::size_t narrowAscii(OctetType          *dst,
+                                   const unsigned int *src,
+                                   bsl::size_t         length);
+        // Write to the specified 'dst' the single-octet UTF-8 encodings of
+        // the longest prefix of the specified 'length' words at the specified
+        // 'src' that are single-octet code points, and return the length of
+        // that prefix.
 };
 
 inline
@@ -345,6 +543,22 @@ unsigned int NoopSwapper::swapBytes(unsigned int x)
     return x;
 }
 
+inline
+bsl::size_t NoopSwapper::widenAscii(unsigned int    *dst,
+                                    const OctetType *src,
+                                    bsl::size_t      length)
+{
+    return ::widenAscii(dst, src, length);
+}
+
+inline
+bsl::size_t NoopSwapper::narrowAscii(OctetType          *dst,
+                                     const unsigned int *src,
+                                     bsl::size_t         length)
+{
+    return ::narrowAscii(dst, src, length);
+}
+
                         // ===========================
                         // local class Utf8PtrBasedEnd
                         // ===========================
@@ -370,6 +584,10 @@ class Utf8PtrBasedEnd {
         // 'false' otherwise.  The behavior is undefined unless
         // 'position <= d_end'.
 
+    bsl::size_t numReadable(const OctetType *position) const;
+        // Return the number of octets of input from the specified 'position'
+        // to the end.  The behavior is undefined unless 'position <= d_end'.
+
     const OctetType *skipContinuations(const OctetType *octets,
                                        int              skipBy) const;
         // Return a pointer to after the specified 'skipBy' consecutive
@@ -406,6 +624,12 @@ bool Utf8PtrBasedEnd::isFinished(const OctetType *position) const
     }
 }
 
+inline
+bsl::size_t Utf8PtrBasedEnd::numReadable(const OctetType *position) const
+{
+    return d_end - position;
+}
+
 inline
 const OctetType *Utf8PtrBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -462,6 +686,10 @@ struct Utf8ZeroBasedEnd {
         // Return 'true' if the specified 'position' is at the end of input,
         // and 'false' otherwise.
 
+    bsl::size_t numReadable(const OctetType *position) const;
+        // Return 0.  Note that the length of null-terminated input is not
+        // known in advance, so it is never translated in bulk.
+
     const OctetType *skipContinuations(const OctetType *octets,
                                        int              skipBy) const;
         // Return a pointer to after up to the specified 'skipBy' consecutive
@@ -493,6 +721,12 @@ bool Utf8ZeroBasedEnd::isFinished(const OctetType *position) const
     return 0 == *position;
 }
 
+inline
+bsl::size_t Utf8ZeroBasedEnd::numReadable(const OctetType *) const
+{
+    return 0;
+}
+
 inline
 const OctetType *Utf8ZeroBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -554,6 +788,10 @@ class Utf32PtrBasedEnd {
         // Return 'true' if the specified 'position' is at the end of input and
         // 'false' otherwise.  The behavior is undefined unless
         // 'position <= d_end'.
+
+    bsl::size_t numReadable(const unsigned int *position) const;
+        // Return the number of words of input from the specified 'position'
+        // to the end.  The behavior is undefined unless 'position <= d_end'.
 };
 
                         // ---------------------------
@@ -579,6 +817,12 @@ bool Utf32PtrBasedEnd::isFinished(const unsigned int *position) const
     }
 }
 
+inline
+bsl::size_t Utf32PtrBasedEnd::numReadable(const unsigned int *position) const
+{
+    return d_end_p - position;
+}
+
                        // ==============================
                        // local struct Utf32ZeroBasedEnd
                        // ==============================
@@ -592,6 +836,10 @@ struct Utf32ZeroBasedEnd {
     bool isFinished(const unsigned int *position) const;
         // Return 'true' if the specified 'position' is at the end of input,
         // and 'false' otherwise.
+
+    bsl::size_t numReadable(const unsigned int *position) const;
+        // Return 0.  Note that the length of null-terminated input is not
+        // known in advance, so it is never translated in bulk.
 };
 
                        // ------------------------------
@@ -611,6 +859,12 @@ bool Utf32ZeroBasedEnd::isFinished(const unsigned int *position) const
     return 0 == *position;
 }
 
+inline
+bsl::size_t Utf32ZeroBasedEnd::numReadable(const unsigned int *) const
+{
+    return 0;
+}
+
 }  // close unnamed namespace
 
 static inline
@@ -1083,6 +1337,22 @@ int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::decodeCodePoint()
     }
 
     if      (isSingleOctet(     firstOctet)) {
+        // Translate as much of the run of single-octet code points starting
+        // here as the input and the output (less room for the null) allow in
+        // bulk.
+
+        const bsl::size_t numAscii = SWAPPER::widenAscii(
+                                   d_output,
+                                   d_input,
+                                   bsl::min(d_endFunctor.numReadable(d_input),
+                                            d_capacity.available() - 1));
+        if (numAscii) {
+            d_input    += numAscii;
+            d_output   += numAscii;
+            d_capacity -= numAscii;
+            return 0;                                                 // RETURN
+        }
+
         len = 1;
         good = true;
         decodedCodePoint = firstOctet;
@@ -1261,6 +1531,13 @@ class Utf32ToUtf8Translator {
         // Return a non-zero value if there was insufficient capacity for the
         // output, and 0 otherwise.
 
+    bsl::size_t encodeSingleOctets(bsl::size_t numReadable);
+        // Translate, in bulk, as much of the run of code points that can be
+        // encoded as single octets at 'd_input' as the specified
+        // 'numReadable' words of input and the output, less room for a
+        // terminating null, allow, and update this object accordingly.
+        // Return the number of code points translated.
+
     int decodeCodePoint(const unsigned int uc);
         // Translate the specified UTF-32 code point 'uc' to UTF-8 in the
         // output stream, updating this object appropriately.  If insufficient
@@ -1352,6 +1629,27 @@ int Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::handleInvalidWord()
     }
 }
 
+template <class CAPACITY, class END_FUNCTOR, class SWAPPER>
+inline
+bsl::size_t
+Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::encodeSingleOctets(
+                                                       bsl::size_t numReadable)
+{
+    BSLS_ASSERT(d_capacity >= 1);
+
+    const bsl::size_t numAscii = SWAPPER::narrowAscii(
+                                  d_output,
+                                  d_input,
+                                  bsl::min(numReadable,
+                                           d_capacity.available() - 1));
+    d_input                += numAscii;
+    d_output               += numAscii;
+    d_capacity             -= numAscii;
+    d_numCodePointsWritten += numAscii;
+
+    return numAscii;
+}
+
 template <class CAPACITY, class END_FUNCTOR, class SWAPPER>
 int Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::decodeCodePoint(
                                                          const unsigned int uc)
@@ -1432,7 +1730,13 @@ int Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
     int          ret = 0;
     unsigned int uc;
     while (!endFunctor.isFinished(translator.d_input)) {
-        uc = SWAPPER::swapBytes(*translator.d_input++);
+        uc = SWAPPER::swapBytes(*translator.d_input);
+        if (fitsInSingleOctet(uc) && translator.encodeSingleOctets(
+                                endFunctor.numReadable(translator.d_input))) {
+            continue;
+        }
+
+        ++translator.d_input;
         if (0 != translator.decodeCodePoint(uc)) {
             BSLS_ASSERT((bsl::is_same<CAPACITY, Capacity>::value));
             ret |= k_OUT_OF_SPACE_BIT;
@@ -26,6 +26,8 @@
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -74,6 +76,7 @@ using bsl::size_t;
 //:   capacity specified was adequate, and is never set on translations with
 //:   STL container output destinations.
 // ----------------------------------------------------------------------------
+// [19] BULK TRANSLATION OF ASCII
 // [17] USAGE EXAMPLE
 // [16] UTF-32 <- UTF-8 Random garbage input, random error word
 // [15] UTF-32 <- UTF-8 Table generated random sequences, random error word
@@ -2742,6 +2745,155 @@ int main(int argc, char **argv)
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 19: {
+        // --------------------------------------------------------------------
+        // BULK TRANSLATION OF ASCII
+        //
+        // Concerns:
+        //: 1 Runs of ASCII in input of known length, which are translated in
+        //:   bulk, are translated exactly as they are in null-terminated
+        //:   input, which is translated one code point at a time.
+        //:
+        //: 2 Runs of ASCII of every length, including runs ending at the end
+        //:   of the input or at an invalid sequence, are translated.
+        //:
+        //: 3 Translation into a fixed-size buffer stops, leaving room for the
+        //:   null terminator, at the same point whether or not it is in the
+        //:   middle of a run of ASCII.
+        //:
+        //: 4 Bulk translation honors the byte order of the UTF-32.
+        //
+        // Plan:
+        //: 1 Generate pseudo-random strings consisting of runs of ASCII of
+        //:   random length separated by multi-octet code points and invalid
+        //:   sequences.
+        //:
+        //: 2 Translate each string from UTF-8 to UTF-32 and back, in both
+        //:   byte orders, into buffers of every capacity up to that needed,
+        //:   and verify that the results of the overloads taking input of
+        //:   known length and of the overloads taking null-terminated input
+        //:   are the same.  (C-1..4)
+        //
+        // Testing:
+        //   BULK TRANSLATION OF ASCII
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BULK TRANSLATION OF ASCII\n"
+                             "=========================\n";
+
+        static const char *const SEPARATORS[] = {
+            "\xc3\xa9",              // 2-octet code point
+            "\xe2\x82\xac",          // 3-octet code point
+            "\xf0\x9f\x98\x80",      // 4-octet code point
+            "\xff",                  // invalid octet
+            "\x80",                  // unexpected continuation
+            "\xe2\x82",              // truncated sequence
+        };
+        enum { k_NUM_SEPARATORS = sizeof SEPARATORS / sizeof *SEPARATORS };
+
+        const bdlde::ByteOrder::Enum ORDERS[] = {
+            bdlde::ByteOrder::e_HOST,
+            oppositeEndian
+        };
+
+        unsigned int seed = 12345;
+
+        for (int ti = 0; ti < 300; ++ti) {
+            bsl::string utf8;
+
+            while (utf8.length() < static_cast<bsl::size_t>(ti / 2)) {
+                seed = seed * 1103515245 + 12345;
+                const unsigned numAscii = (seed >> 16) % 40;
+                for (unsigned ii = 0; ii < numAscii; ++ii) {
+                    utf8 += static_cast<char>(' ' + (ii * 7 + ti) % 95);
+                }
+                if (seed & 1) {
+                    utf8 += SEPARATORS[(seed >> 8) % k_NUM_SEPARATORS];
+                }
+            }
+
+            if (veryVerbose) { P_(ti);    P(utf8.length()); }
+
+            const bsl::size_t LEN = utf8.length();
+
+            for (int tj = 0; tj < 2; ++tj) {
+                const bdlde::ByteOrder::Enum ORDER = ORDERS[tj];
+
+                bsl::vector<unsigned int> u32A(LEN + 1);
+                bsl::vector<unsigned int> u32B(LEN + 1);
+
+                int         rcA, rcB;
+                bsl::size_t numCpA, numCpB, numA, numB;
+
+                for (bsl::size_t cap = 0; cap <= LEN + 1; ++cap) {
+                    numCpA = numCpB = 12345;
+
+                    rcA = Util::utf8ToUtf32(&u32A[0],
+                                            cap,
+                                            bslstl::StringRef(utf8),
+                                            &numCpA,
+                                            '?',
+                                            ORDER);
+                    rcB = Util::utf8ToUtf32(&u32B[0],
+                                            cap,
+                                            utf8.c_str(),
+                                            &numCpB,
+                                            '?',
+                                            ORDER);
+
+                    LOOP5_ASSERT(ti, tj, cap, rcA, rcB, rcA == rcB);
+                    LOOP5_ASSERT(ti, tj, cap, numCpA, numCpB,
+                                 numCpA == numCpB);
+                    LOOP3_ASSERT(ti, tj, cap, numCpA <= cap);
+                    LOOP3_ASSERT(ti, tj, cap,
+                                 bsl::equal(u32A.begin(),
+                                            u32A.begin() + numCpA,
+                                            u32B.begin()));
+                }
+
+                // 'u32A' now holds the whole translation, including the null.
+                // Introduce an invalid code point.
+
+                const bsl::size_t U32_LEN = numCpA - 1;
+                if (bdlde::ByteOrder::e_HOST == ORDER && U32_LEN) {
+                    u32A[ti % U32_LEN] = 0xd800;
+                }
+
+                bsl::vector<char> u8A(LEN + 1);
+                bsl::vector<char> u8B(LEN + 1);
+
+                for (bsl::size_t cap = 0; cap <= LEN + 1; ++cap) {
+                    numCpA = numCpB = numA = numB = 12345;
+
+                    rcA = Util::utf32ToUtf8(&u8A[0],
+                                            cap,
+                                            &u32A[0],
+                                            U32_LEN,
+                                            &numCpA,
+                                            &numA,
+                                            '?',
+                                            ORDER);
+                    rcB = Util::utf32ToUtf8(&u8B[0],
+                                            cap,
+                                            &u32A[0],
+                                            &numCpB,
+                                            &numB,
+                                            '?',
+                                            ORDER);
+
+                    LOOP5_ASSERT(ti, tj, cap, rcA, rcB, rcA == rcB);
+                    LOOP5_ASSERT(ti, tj, cap, numCpA, numCpB,
+                                 numCpA == numCpB);
+                    LOOP5_ASSERT(ti, tj, cap, numA, numB, numA == numB);
+                    LOOP3_ASSERT(ti, tj, cap, numA <= cap);
+                    LOOP3_ASSERT(ti, tj, cap,
+                                 bsl::equal(u8A.begin(),
+                                            u8A.begin() + numA,
+                                            u8B.begin()));
+                }
+            }
+        }
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
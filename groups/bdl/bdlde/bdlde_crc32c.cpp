@@ -31,6 +31,7 @@ BSLS_IDENT_RCSID(bdlde_crc32c_cpp,"$Id$ $CSID$")
 
 #if defined(LIKE_X86_GCC)
 #include <cpuid.h>
+#include <immintrin.h>
 #endif
 
 // #define BDLDE_SUPPORT_SPARC_HARDWARE_OPTIMIZATION
@@ -666,6 +667,62 @@ const unsigned int k_CRC_TABLE_IL8_O88[256] =
     0xC451B7CC, 0x8D6DCAEB, 0x56294D82, 0x1F1530A5
 };
 
+const unsigned int k_REFLECTED_POLYNOMIAL = 0x82F63B78;
+    // The Castagnoli polynomial in the bit-reflected representation used by
+    // the CRC32-C register: bit 'i' of a value is the coefficient of
+    // 'x^(31 - i)'.
+
+const unsigned int k_X_POW_2_POW_K[31] =
+    // The 'k'th entry of this table is 'x^(2^k)' modulo the Castagnoli
+    // polynomial, in the bit-reflected representation.  Note that
+    // 'x^(2^31) == x' modulo the polynomial, so the powers for larger values
+    // of 'k' are found at index 'k % 31'.
+{
+    0x40000000, 0x20000000, 0x08000000, 0x00800000,
+    0x00008000, 0x82F63B78, 0x6EA2D55C, 0x18B8EA18,
+    0x510AC59A, 0xB82BE955, 0xB8FDB1E7, 0x88E56F72,
+    0x74C360A4, 0xE4172B16, 0x0D65762A, 0x35D73A62,
+    0x28461564, 0xBF455269, 0xE2EA32DC, 0xFE7740E6,
+    0xF946610B, 0x3C204F8F, 0x538586E3, 0x59726915,
+    0x734D5309, 0xBC1AC763, 0x7D0722CC, 0xD289CABE,
+    0xE94CA9BC, 0x05B74F3F, 0xA51E1F42
+};
+
+unsigned int multiplyModP(unsigned int a, unsigned int b)
+    // Return the product of the specified 'a' and 'b' modulo the Castagnoli
+    // polynomial, where all three values are polynomials in the bit-reflected
+    // representation.
+{
+    // Scan the coefficients of 'a' from 'x^0' upwards while multiplying 'b'
+    // by 'x', avoiding branches on the (unpredictable) bits of either value.
+
+    unsigned int result = 0;
+
+    for (int i = 0; i < 32; ++i) {
+        result ^= b & (0U - (a >> 31));
+        a      <<= 1;
+        b        = (b >> 1) ^ (k_REFLECTED_POLYNOMIAL & (0U - (b & 1)));
+    }
+    return result;
+}
+
+unsigned int shiftCrc32c(unsigned int crc, bsl::size_t length)
+    // Return the specified CRC32-C register value 'crc' advanced over the
+    // specified 'length' number of zero bytes, i.e., 'crc * x^(8 * length)'
+    // modulo the Castagnoli polynomial.
+{
+    int k = 3;  // 'x^(8 * length) == (x^(2^3))^length'
+
+    while (length) {
+        if (length & 1) {
+            crc = multiplyModP(k_X_POW_2_POW_K[k], crc);
+        }
+        length >>= 1;
+        k = 30 == k ? 0 : k + 1;
+    }
+    return crc;
+}
+
                         //=======================
                         // class Crc32cCalculator
                         //=======================
@@ -1154,6 +1211,130 @@ unsigned int crc32cSse64bit(const unsigned char *data,
     return ~crc;
 }
 
+enum {
+    k_LONG_LANE  = 8192,  // lane length (in bytes) for large buffers
+
+    k_SHORT_LANE = 256    // lane length (in bytes) for the remainder
+};
+
+// The following constants are 'x^(8 * n - 33)' modulo the Castagnoli
+// polynomial (in the bit-reflected representation) for 'n' equal to one, two
+// and three lane lengths.
+
+const long long k_LONG_SHIFT1  = 0x54A86326;  // n == 1 * k_LONG_LANE
+const long long k_LONG_SHIFT2  = 0x1DC403CC;  // n == 2 * k_LONG_LANE
+const long long k_LONG_SHIFT3  = 0x6A173FA1;  // n == 3 * k_LONG_LANE
+const long long k_SHORT_SHIFT1 = 0xB9E02B86;  // n == 1 * k_SHORT_LANE
+const long long k_SHORT_SHIFT2 = 0xDD7E3B0C;  // n == 2 * k_SHORT_LANE
+const long long k_SHORT_SHIFT3 = 0xD7A4825C;  // n == 3 * k_SHORT_LANE
+
+__attribute__((target("sse4.2,pclmul")))
+inline
+unsigned int crc32cThreeLanes(const unsigned char *data,
+                              bsl::size_t          laneLength,
+                              const __m128i&       shifts12,
+                              const __m128i&       shift3,
+                              unsigned int         crc)
+    // Return the CRC32-C register value obtained by advancing the specified
+    // 'crc' register value over the '3 * laneLength' bytes starting at the
+    // specified 'data', where the low and high 64 bits of the specified
+    // 'shifts12', and the low 64 bits of the specified 'shift3', hold the
+    // constants for advancing a register value over one, two, and three
+    // lanes of the specified 'laneLength', respectively.  The three
+    // consecutive lanes are processed in parallel (keeping three 'crc32'
+    // instructions in flight), and the lane register values and 'crc' are
+    // then combined with carry-less multiplication.  The behavior is
+    // undefined unless 'laneLength' is a multiple of 8.
+{
+    const bsl::size_t numWords = laneLength / 8;
+
+    const bsls::Types::Uint64 *b1 =
+                           reinterpret_cast<const bsls::Types::Uint64 *>(data);
+    const bsls::Types::Uint64 *b2 = b1 + numWords;
+    const bsls::Types::Uint64 *b3 = b2 + numWords;
+
+    // All three lanes start from a zero register so that they do not depend
+    // on 'crc', which lets the processor overlap this block with the
+    // combination step of the previous one.
+
+    bsls::Types::Uint64 c1 = 0;
+    bsls::Types::Uint64 c2 = 0;
+    bsls::Types::Uint64 c3 = 0;
+
+    for (bsl::size_t i = 0; i < numWords; ++i) {
+        c1 = __builtin_ia32_crc32di(c1, b1[i]);
+        c2 = __builtin_ia32_crc32di(c2, b2[i]);
+        c3 = __builtin_ia32_crc32di(c3, b3[i]);
+    }
+
+    // The carry-less product of a register value 'c' and 'x^(8 * n - 33)'
+    // reduced with a 'crc32' instruction (which multiplies by the remaining
+    // 'x^33') is 'c * x^(8 * n)', i.e., 'c' advanced over 'n' zero bytes.
+    // The products are reduced with a single 'crc32' since it is linear.
+
+    const __m128i r0 = _mm_cvtsi64_si128(static_cast<long long>(crc));
+    const __m128i r1 = _mm_cvtsi64_si128(static_cast<long long>(c1));
+    const __m128i r2 = _mm_cvtsi64_si128(static_cast<long long>(c2));
+
+    const __m128i p0 = _mm_clmulepi64_si128(r0, shift3,   0x00);
+    const __m128i p1 = _mm_clmulepi64_si128(r1, shifts12, 0x10);
+    const __m128i p2 = _mm_clmulepi64_si128(r2, shifts12, 0x00);
+
+    const bsls::Types::Uint64 product = static_cast<bsls::Types::Uint64>(
+                  _mm_cvtsi128_si64(_mm_xor_si128(p0, _mm_xor_si128(p1, p2))));
+
+    return static_cast<unsigned int>(c3 ^ __builtin_ia32_crc32di(0, product));
+}
+
+__attribute__((target("sse4.2,pclmul")))
+unsigned int crc32cPclmul(const unsigned char *data,
+                          bsl::size_t          length,
+                          unsigned int         crc)
+    // Calculate the CRC32-C value (using SSE4.2 and PCLMULQDQ intrinsics) for
+    // the specified 'data' over the specified 'length' number of bytes, using
+    // the specified 'crc' value as the starting point for the calculation.
+    // The data is processed in blocks of three lanes of 'k_LONG_LANE', then
+    // of 'k_SHORT_LANE', bytes (see 'crc32cThreeLanes'), and the remaining
+    // bytes in slices of 8 bytes.  Unlike 'crc32cSse64bit', the lanes are
+    // combined with two carry-less multiplications rather than lookup tables,
+    // which allows for long lanes and keeps the three 'crc32' pipelines busy
+    // on large buffers.  Note that the 'data' is permitted to be null if the
+    // 'length' is 0.
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    crc = ~crc;
+
+    const __m128i longShifts12  = _mm_set_epi64x(k_LONG_SHIFT2,
+                                                 k_LONG_SHIFT1);
+    const __m128i longShift3    = _mm_cvtsi64_si128(k_LONG_SHIFT3);
+    const __m128i shortShifts12 = _mm_set_epi64x(k_SHORT_SHIFT2,
+                                                 k_SHORT_SHIFT1);
+    const __m128i shortShift3   = _mm_cvtsi64_si128(k_SHORT_SHIFT3);
+
+    while (length >= 3 * k_LONG_LANE) {
+        crc     = crc32cThreeLanes(data,
+                                   k_LONG_LANE,
+                                   longShifts12,
+                                   longShift3,
+                                   crc);
+        data   += 3 * k_LONG_LANE;
+        length -= 3 * k_LONG_LANE;
+    }
+
+    while (length >= 3 * k_SHORT_LANE) {
+        crc     = crc32cThreeLanes(data,
+                                   k_SHORT_LANE,
+                                   shortShifts12,
+                                   shortShift3,
+                                   crc);
+        data   += 3 * k_SHORT_LANE;
+        length -= 3 * k_SHORT_LANE;
+    }
+
+    return ~crc32c8s(data, length, crc);
+}
+
 #  endif // BSLS_PLATFORM_CPU_64_BIT
 
 unsigned int crc32cHardwareSerial(const unsigned char *data,
@@ -1228,9 +1409,17 @@ Crc32cCalculator::Crc32cCalculator()
     if (ecx & BDLDE_SSE4_2) { // SSE 4.2 Support for CRC32-C
 
 #ifdef BSLS_PLATFORM_CPU_64_BIT
-        BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
-                      "(SSE4.2 instructions available, 64-bit mode)");
-        s_crc32cFn = crc32cSse64bit;
+        if (ecx & bit_PCLMUL) {
+            BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                          "(SSE4.2 and PCLMULQDQ instructions available, "
+                          "64-bit mode)");
+            s_crc32cFn = crc32cPclmul;
+        }
+        else {
+            BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                          "(SSE4.2 instructions available, 64-bit mode)");
+            s_crc32cFn = crc32cSse64bit;
+        }
 
 #else
         BSLS_LOG_INFO("Using hardware version (serial) for CRC32-C "
@@ -1315,6 +1504,17 @@ unsigned int Crc32c::calculate(const void   *data,
     return calculator(static_cast<const unsigned char *>(data), length, crc);
 }
 
+unsigned int Crc32c::combine(unsigned int crc1,
+                             unsigned int crc2,
+                             bsl::size_t  length2)
+{
+    // Since the checksum of 'length2' bytes is an affine function of its
+    // starting point, 'calculate(data2, length2, crc1) ^ crc2' is
+    // 'crc1 * x^(8 * length2)' modulo the polynomial.
+
+    return shiftCrc32c(crc1, length2) ^ crc2;
+}
+
                              // ------------------
                              // struct Crc32c_Impl
                              // ------------------
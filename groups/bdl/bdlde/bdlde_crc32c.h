@@ -39,6 +39,11 @@ BSLS_IDENT("$Id$")
 //: o sparc: runtime check is detected by the 'is_sparc_crc32c_avail' system
 //:   call
 //
+// On x86-64, when the 'pclmulqdq' (carry-less multiplication) instruction is
+// also available, large buffers are processed in three interleaved lanes
+// whose checksums are combined with carry-less multiplication, which allows
+// for longer lanes than the table-based combination used otherwise.
+//
 ///Performance
 ///-----------
 // See the test driver for this component in the '.t.cpp' to compare
@@ -76,6 +81,34 @@ BSLS_IDENT("$Id$")
 //                                      newChunk.size(),
 //                                      checksum);
 //..
+//
+///Example 2: Combining checksums of separate ranges
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// The checksum of a dataset can also be assembled from the checksums of its
+// ranges, e.g., when the ranges are held in separate buffers or are
+// processed by different threads.
+//
+// First, we compute the checksums of the two halves of a message
+// independently:
+//..
+//  const char        *data   = "The quick brown fox jumps over a dog";
+//  const bsl::size_t  length = bsl::strlen(data);
+//  const bsl::size_t  half   = length / 2;
+//
+//  unsigned int first  = bdlde::Crc32c::calculate(data, half);
+//  unsigned int second = bdlde::Crc32c::calculate(data + half,
+//                                                 length - half);
+//..
+// Then, we combine them, supplying the length of the second range:
+//..
+//  unsigned int combined = bdlde::Crc32c::combine(first,
+//                                                 second,
+//                                                 length - half);
+//..
+// Finally, we observe that the result is the checksum of the whole message:
+//..
+//  assert(bdlde::Crc32c::calculate(data, length) == combined);
+//..
 
 #include <bdlscm_version.h>
 
@@ -106,6 +139,19 @@ struct Crc32c {
         // the specified 'length' number of bytes, using the optionally
         // specified 'crc' value as the starting point for the calculation.
         // Note that if 'data' is 0, then 'length' also must be 0.
+
+    static unsigned int combine(unsigned int crc1,
+                                unsigned int crc2,
+                                bsl::size_t  length2);
+        // Return the CRC32-C value of the concatenation of two datasets,
+        // given the specified 'crc1' CRC32-C value of the first dataset and
+        // the specified 'crc2' CRC32-C value of the second dataset, which
+        // comprises the specified 'length2' number of bytes.  The behavior is
+        // undefined unless 'crc2' was calculated with 'k_NULL_CRC32C' as the
+        // starting point.  Note that this function allows the checksums of
+        // separately processed (e.g., concurrently processed) ranges of a
+        // dataset to be merged without access to the data, in time
+        // logarithmic in 'length2'.
 };
 
                              // ==================
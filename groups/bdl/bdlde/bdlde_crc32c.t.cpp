@@ -227,16 +227,20 @@ using namespace bsl;
 // [3] int Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
 // [4] int Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
 // [6] int Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
+// [7] int Crc32c::calculate(const void *, size_t, unsigned int);
+// [8] int Crc32c::combine(unsigned int, unsigned int, size_t);
 // [2] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
 // [3] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
+// [7] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [-1] DEFAULT PERFORMANCE TEST
 // [-2] SOFTWARE PERFORMANCE TEST
 // [-3] THROUGPUT DEFAULT & SOFTWARE BENCHMARK
 // [-4] DEFAULT & FOLLY PERFORMANCE TEST
 // [-5] PERFORMANCE TEST ON USER INPUT
+// [-6] THROUGHPUT ON LARGE BUFFERS (GB/s)
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1311,6 +1315,221 @@ void test6_multithreadedCrc32cSoftware()
     }
 }
 
+void test7_calculateOnLargeBuffer()
+    // ------------------------------------------------------------------------
+    // CALCULATE CRC32-C ON LARGE BUFFER
+    //
+    // Concerns:
+    //: 1 Calculating CRC32-C on a buffer large enough to be processed in
+    //:   interleaved lanes yields the same result as the software
+    //:   implementation, for lengths just below, at, and just above each
+    //:   multiple of the lane block sizes.
+    //:
+    //: 2 The result does not depend on the alignment of the buffer or on the
+    //:   starting 'crc' value.
+    //
+    // Plan:
+    //: 1 Fill a buffer with pseudo-random bytes.  For a table of lengths
+    //:   around the block sizes of the hardware implementations (768, 1024,
+    //:   and 24576 bytes and their multiples), and for each offset in
+    //:   '[0 .. 7]', compare the results of 'calculate',
+    //:   'calculateHardwareSerial' and 'calculateSoftware' for several
+    //:   starting 'crc' values.  (C-1..2)
+    //
+    // Testing:
+    //   bdlde::Crc32c::calculate(const void *, size_t, unsigned int);
+    //   bdlde::Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
+    //   bdlde::Crc32c_Impl::calculateHardwareSerial(const void *,size_t,uint);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout
+                     << bsl::endl
+                     << "CALCULATE CRC32-C ON LARGE BUFFER" << bsl::endl
+                     << "=================================" << bsl::endl;
+
+    const bsl::size_t k_BUFFER_SIZE = 4 * 24576 + 64;
+
+    bsl::vector<char> buffer(k_BUFFER_SIZE);
+    unsigned int      seed = 12345;
+    for (bsl::size_t i = 0; i < k_BUFFER_SIZE; ++i) {
+        seed      = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<char>(seed >> 16);
+    }
+
+    const bsl::size_t LENGTHS[] = {
+        767, 768, 769, 1023, 1024, 1025, 1535, 1536, 1543, 2048, 2311,
+        24575, 24576, 24577, 25344, 25351, 49152, 49159, 73727, 73728,
+        4 * 24576 + 7
+    };
+    const bsl::size_t NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+    const unsigned int CRCS[] = { 0, 1, 0xFFFFFFFF, 0x8A9136AA };
+    const bsl::size_t  NUM_CRCS = sizeof CRCS / sizeof *CRCS;
+
+    for (bsl::size_t ti = 0; ti < NUM_LENGTHS; ++ti) {
+        const bsl::size_t LENGTH = LENGTHS[ti];
+
+        if (veryVerbose) {
+            T_  P(LENGTH);
+        }
+
+        for (bsl::size_t offset = 0; offset < 8; ++offset) {
+            const char *DATA = &buffer[offset];
+
+            BSLS_ASSERT_OPT(offset + LENGTH <= k_BUFFER_SIZE);
+
+            for (bsl::size_t ci = 0; ci < NUM_CRCS; ++ci) {
+                const unsigned int CRC = CRCS[ci];
+
+                const unsigned int EXPECTED =
+                      Crc32c_Impl::calculateSoftware(DATA, LENGTH, CRC);
+
+                const unsigned int crc32cDefault =
+                                      Crc32c::calculate(DATA, LENGTH, CRC);
+
+                const unsigned int crc32cHWSerial =
+                Crc32c_Impl::calculateHardwareSerial(DATA, LENGTH, CRC);
+
+                ASSERTV(LENGTH, offset, CRC, crc32cDefault, EXPECTED,
+                        crc32cDefault == EXPECTED);
+                ASSERTV(LENGTH, offset, CRC, crc32cHWSerial, EXPECTED,
+                        crc32cHWSerial == EXPECTED);
+            }
+        }
+    }
+}
+
+void test8_combine()
+    // ------------------------------------------------------------------------
+    // COMBINE
+    //
+    // Concerns:
+    //: 1 'combine' returns the CRC32-C of the concatenation of two ranges
+    //:   given the CRC32-C values of the ranges and the length of the second.
+    //:
+    //: 2 Combining with an empty second range returns the first CRC32-C, and
+    //:   combining an empty first range ('k_NULL_CRC32C') with a second
+    //:   range returns the second CRC32-C.
+    //:
+    //: 3 'combine' is correct for lengths having any bit set, including
+    //:   lengths larger than the period of the table of powers of 'x'.
+    //
+    // Plan:
+    //: 1 For a buffer of pseudo-random bytes, split it at a variety of
+    //:   points, compute the CRC32-C of the two parts, and verify that the
+    //:   combined value is the CRC32-C of the whole.  (C-1..2)
+    //:
+    //: 2 Verify that the checksums of several consecutive ranges can be
+    //:   folded left-to-right with 'combine'.  (C-1)
+    //:
+    //: 3 Verify that, for lengths 'n' that are too large to materialize,
+    //:   'combine(combine(c, 0, n), 0, n)' equals 'combine(c, 0, 2 * n)',
+    //:   where a zero 'crc2' corresponds to a "virtual" second range that
+    //:   leaves the register unchanged, and compare results for lengths
+    //:   that differ by '8 * (2^31 - 1)' bytes (the period of the table of
+    //:   powers of 'x').  (C-3)
+    //
+    // Testing:
+    //   unsigned int Crc32c::combine(unsigned int, unsigned int, size_t);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout << bsl::endl
+                           << "COMBINE" << bsl::endl
+                           << "=======" << bsl::endl;
+
+    const bsl::size_t k_BUFFER_SIZE = 70000;
+
+    bsl::vector<char> buffer(k_BUFFER_SIZE);
+    unsigned int      seed = 54321;
+    for (bsl::size_t i = 0; i < k_BUFFER_SIZE; ++i) {
+        seed      = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<char>(seed >> 16);
+    }
+    const char *DATA = buffer.data();
+
+    if (verbose) cout << "\nCombine two ranges." << endl;
+    {
+        const bsl::size_t LENGTHS[] = { 0, 1, 2, 7, 8, 9, 100, 1024, 70000 };
+        const bsl::size_t NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (bsl::size_t ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH   = LENGTHS[ti];
+            const unsigned    EXPECTED = Crc32c::calculate(DATA, LENGTH);
+
+            for (bsl::size_t split = 0; split <= LENGTH;
+                                        split += 1 + split / 3) {
+                const unsigned int CRC1 = Crc32c::calculate(DATA, split);
+                const unsigned int CRC2 = Crc32c::calculate(DATA + split,
+                                                            LENGTH - split);
+
+                const unsigned int combined = Crc32c::combine(CRC1,
+                                                              CRC2,
+                                                              LENGTH - split);
+
+                ASSERTV(LENGTH, split, combined, EXPECTED,
+                        combined == EXPECTED);
+            }
+
+            ASSERTV(LENGTH, EXPECTED == Crc32c::combine(EXPECTED,
+                                                        Crc32c::k_NULL_CRC32C,
+                                                        0));
+            ASSERTV(LENGTH, EXPECTED == Crc32c::combine(Crc32c::k_NULL_CRC32C,
+                                                        EXPECTED,
+                                                        LENGTH));
+        }
+    }
+
+    if (verbose) cout << "\nFold consecutive ranges." << endl;
+    {
+        const bsl::size_t RANGE_LENGTHS[] = { 3, 1000, 0, 8192, 17, 60000 };
+        const bsl::size_t NUM_RANGES = sizeof RANGE_LENGTHS
+                                                       / sizeof *RANGE_LENGTHS;
+
+        unsigned int crc    = Crc32c::k_NULL_CRC32C;
+        bsl::size_t  offset = 0;
+
+        for (bsl::size_t ti = 0; ti < NUM_RANGES; ++ti) {
+            const bsl::size_t LENGTH = RANGE_LENGTHS[ti];
+
+            crc = Crc32c::combine(crc,
+                                  Crc32c::calculate(DATA + offset, LENGTH),
+                                  LENGTH);
+            offset += LENGTH;
+
+            ASSERTV(ti, crc == Crc32c::calculate(DATA, offset));
+        }
+    }
+
+    if (verbose) cout << "\nVery large lengths." << endl;
+    {
+        const unsigned int CRC = Crc32c::calculate(DATA, 100);
+
+        const bsl::size_t LENGTHS[] = {
+            1000003,
+            0x3FFFFFFF,
+            0x7FFFFFFF,
+            static_cast<bsl::size_t>(-1) / 4
+        };
+        const bsl::size_t NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (bsl::size_t ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH = LENGTHS[ti];
+
+            const unsigned int once  = Crc32c::combine(CRC, 0, LENGTH);
+            const unsigned int twice = Crc32c::combine(once, 0, LENGTH);
+
+            ASSERTV(LENGTH, twice == Crc32c::combine(CRC, 0, 2 * LENGTH));
+        }
+
+        // 'x^(8 * (2^31 - 1)) == 1' modulo the Castagnoli polynomial.
+
+        const bsl::size_t PERIOD = 0x7FFFFFFF;
+        ASSERTV(CRC == Crc32c::combine(CRC, 0, PERIOD));
+        ASSERTV(Crc32c::combine(CRC, 0, 12345) ==
+                               Crc32c::combine(CRC, 0, PERIOD + 12345));
+    }
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -1831,6 +2050,111 @@ void testN5_performanceDefaultUserInput()
          << "\n\n";
 }
 
+void testN6_throughputLargeBuffers()
+    // ------------------------------------------------------------------------
+    // BENCHMARK: CRC32-C THROUGHPUT ON LARGE BUFFERS
+    //
+    // Concerns:
+    //: 1 Report the throughput (in GB/s) of the default, hardware serial and
+    //:   software implementations, and of 'combine', for buffer sizes from
+    //:   4 KiB to 16 MiB, so that the benefit of processing interleaved lanes
+    //:   can be assessed.
+    //
+    // Plan:
+    //: 1 For each buffer size, time enough iterations of each implementation
+    //:   to process about 4 GB, and report the resulting throughput.
+    //
+    // Testing:
+    //   bdlde::Crc32c::calculate(const void *, size_t, unsigned int);
+    //   bdlde::Crc32c::combine(unsigned int, unsigned int, size_t);
+    //   bdlde::Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
+    //   bdlde::Crc32c_Impl::calculateHardwareSerial(const void *,size_t,uint);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout
+                   << bsl::endl
+                   << "BENCHMARK: CRC32-C THROUGHPUT ON LARGE BUFFERS"
+                   << bsl::endl
+                   << "=============================================="
+                   << bsl::endl;
+
+    typedef unsigned int (*CalculateFn)(const void   *,
+                                        bsl::size_t   ,
+                                        unsigned int  );
+
+    const struct {
+        const char  *d_name;
+        CalculateFn  d_function;
+        int          d_divisor;   // fraction of the work done by this
+                                  // (slower) implementation
+    } IMPLS[] = {
+        { "Default",         &Crc32c::calculate,                   1 },
+        { "Hardware serial", &Crc32c_Impl::calculateHardwareSerial, 2 },
+        { "Software",        &Crc32c_Impl::calculateSoftware,       16 }
+    };
+    const int NUM_IMPLS = static_cast<int>(sizeof IMPLS / sizeof *IMPLS);
+
+    const bsl::size_t SIZES[] = { 4 << 10, 64 << 10, 1 << 20, 16 << 20 };
+    const int         NUM_SIZES = static_cast<int>(sizeof SIZES
+                                                            / sizeof *SIZES);
+
+    const bsls::Types::Int64 k_TOTAL_BYTES = 4LL << 30;
+
+    bsl::vector<char> buffer(SIZES[NUM_SIZES - 1]);
+    for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+        buffer[i] = static_cast<char>(i * 31 + (i >> 8));
+    }
+
+    printf("%10s", "Size(B)");
+    for (int ii = 0; ii < NUM_IMPLS; ++ii) {
+        printf(" | %15s", IMPLS[ii].d_name);
+    }
+    printf("   (GB/s)\n");
+
+    unsigned int result = 0;
+
+    for (int si = 0; si < NUM_SIZES; ++si) {
+        const bsl::size_t SIZE = SIZES[si];
+
+        printf("%10d", static_cast<int>(SIZE));
+
+        for (int ii = 0; ii < NUM_IMPLS; ++ii) {
+            const bsls::Types::Int64 numIters =
+                       k_TOTAL_BYTES / IMPLS[ii].d_divisor
+                                     / static_cast<bsls::Types::Int64>(SIZE);
+
+            const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+            for (bsls::Types::Int64 i = 0; i < numIters; ++i) {
+                result ^= IMPLS[ii].d_function(buffer.data(), SIZE, result);
+            }
+            const bsls::Types::Int64 elapsed =
+                                          bsls::TimeUtil::getTimer() - start;
+
+            printf(" | %15.2f",
+                   static_cast<double>(numIters)
+                 * static_cast<double>(SIZE) / static_cast<double>(elapsed));
+        }
+        printf("\n");
+    }
+
+    // 'combine' is independent of the data, so its cost is reported per
+    // call.
+
+    const int                k_NUM_COMBINES = 1000000;
+    const bsls::Types::Int64 start          = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < k_NUM_COMBINES; ++i) {
+        result = Crc32c::combine(result, i, (16 << 20) + i);
+    }
+    const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+    printf("\ncombine: %.1f ns per call\n",
+           static_cast<double>(elapsed) / k_NUM_COMBINES);
+
+    if (veryVerbose) {
+        P(result);
+    }
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -1864,20 +2188,20 @@ int main(int argc, char* argv[])
     bsls::Log::setSeverityThreshold(bsls::LogSeverity::e_INFO);
 
     switch(test) { case 0:
-      case 7: {
+      case 9: {
         // --------------------------------------------------------------------
-        // TESTING USAGE EXAMPLE 1
+        // TESTING USAGE EXAMPLES
         //
         // Concerns:
-        //   The usage example provided in the component header file must
+        //   The usage examples provided in the component header file must
         //   compile, link, and run on all platforms as shown.
         //
         // Plan:
-        //   Run the usage example 1
+        //   Run the usage examples
         // --------------------------------------------------------------------
 
-        if (verbose) cout << "\nTesting Usage Example 1"
-                          << "\n=======================" << endl;
+        if (verbose) cout << "\nTesting Usage Examples"
+                          << "\n======================" << endl;
 
 ///Example 1: Computing and updating a checksum
 /// - - - - - - - - - - - - - - - - - - - - - -
@@ -1906,6 +2230,40 @@ int main(int argc, char* argv[])
                                             newChunk.size(),
                                             checksum);
 //..
+//
+///Example 2: Combining checksums of separate ranges
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// The checksum of a dataset can also be assembled from the checksums of its
+// ranges, e.g., when the ranges are held in separate buffers or are
+// processed by different threads.
+//
+// First, we compute the checksums of the two halves of a message
+// independently:
+//..
+        const char        *data   = "The quick brown fox jumps over a dog";
+        const bsl::size_t  length = bsl::strlen(data);
+        const bsl::size_t  half   = length / 2;
+
+        unsigned int first  = bdlde::Crc32c::calculate(data, half);
+        unsigned int second = bdlde::Crc32c::calculate(data + half,
+                                                       length - half);
+//..
+// Then, we combine them, supplying the length of the second range:
+//..
+        unsigned int combined = bdlde::Crc32c::combine(first,
+                                                       second,
+                                                       length - half);
+//..
+// Finally, we observe that the result is the checksum of the whole message:
+//..
+        ASSERT(bdlde::Crc32c::calculate(data, length) == combined);
+//..
+      } break;
+      case  8: {
+        test8_combine();
+      } break;
+      case  7: {
+        test7_calculateOnLargeBuffer();
       } break;
       case  6: {
         test6_multithreadedCrc32cSoftware();
@@ -1940,6 +2298,9 @@ int main(int argc, char* argv[])
       case -5: {
         testN5_performanceDefaultUserInput();
       } break;
+      case -6: {
+        testN6_throughputLargeBuffers();
+      } break;
       default: {
         cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
         testStatus = -1;
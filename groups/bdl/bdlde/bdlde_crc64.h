@@ -21,6 +21,15 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+///Performance
+///-----------
+// On x86-64 processors supporting the 'pclmulqdq' (carry-less
+// multiplication) instruction, 'update' processes buffers of 64 bytes or more
+// by folding 16-byte chunks with carry-less multiplication, which is more
+// than an order of magnitude faster than the table-driven byte-at-a-time
+// implementation used for short buffers and on other platforms.  The test
+// driver reports the throughput of 'update' for a range of buffer sizes.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate a typical use of the
@@ -77,6 +77,7 @@ using namespace bsl;  // automatically added by script
 // [ 4] bsls::Types::Uint64 checksumAndReset();
 // [13] void reset();
 // [11] void update(const void *data, int length);
+// [15] void update(const void *data, int length);
 //
 // ACCESSORS
 // [10] STREAM& bdexStreamOut(STREAM& stream, int version) const;
@@ -89,10 +90,11 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream&, const bdlde::Crc64&);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
 // [-1] PERFORMANCE TEST
+// [-2] THROUGHPUT TEST
 //
 // [ 3] int ggg(bdlde::Crc64 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc64& gg(bdlde::Crc64 *object, const char *spec);
@@ -484,7 +486,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -514,6 +516,90 @@ int main(int argc, char *argv[])
 
         receiverExample(in);
 
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'update' ON LARGE BUFFERS
+        //   Buffers of 64 bytes or more may be processed by folding 128-bit
+        //   chunks with carry-less multiplication.
+        //
+        // Concerns:
+        //: 1 'update' produces the same checksum as the oracle for buffers of
+        //:   any length, including lengths just below, at, and above the
+        //:   multiples of the 16- and 64-byte folding granularities.
+        //:
+        //: 2 The checksum does not depend on the alignment of the data.
+        //:
+        //: 3 The checksum does not depend on how the data is split across
+        //:   calls to 'update', and on the value accumulated by prior calls.
+        //
+        // Plan:
+        //: 1 Fill a buffer with pseudo-random bytes.  For every length in
+        //:   '[0 .. 300]' and for a set of larger lengths, and for each
+        //:   offset in '[0 .. 15]', compare the checksum computed by a single
+        //:   call to 'update' to that of the oracle 'crc'.  (C-1..2)
+        //:
+        //: 2 For a large buffer, call 'update' on consecutive ranges of
+        //:   various lengths and verify the result against the oracle.  (C-3)
+        //
+        // Testing:
+        //   void update(const void *data, int length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n" "TESTING 'update' ON LARGE BUFFERS"
+                             "\n" "=================================" "\n";
+
+        const int k_BUFFER_SIZE = 70000;
+
+        bsl::vector<char> buffer(k_BUFFER_SIZE);
+        unsigned int      seed = 2718;
+        for (int i = 0; i < k_BUFFER_SIZE; ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        if (verbose) cout << "\nSingle call to 'update'." << endl;
+
+        bsl::vector<int> lengths;
+        for (int i = 0; i <= 300; ++i) {
+            lengths.push_back(i);
+        }
+        const int LARGE[] = { 1023, 1024, 1025, 4096 + 63, 65536, 69984 };
+        lengths.insert(lengths.end(),
+                       LARGE,
+                       LARGE + sizeof LARGE / sizeof *LARGE);
+
+        for (bsl::size_t li = 0; li < lengths.size(); ++li) {
+            const int LENGTH = lengths[li];
+
+            for (int offset = 0; offset < 16; ++offset) {
+                const char *DATA = &buffer[offset];
+
+                const bsls::Types::Uint64 EXPECTED = crc(DATA, LENGTH);
+
+                Obj mX(DATA, LENGTH);  const Obj& X = mX;
+
+                LOOP3_ASSERT(LENGTH, offset, X.checksum(),
+                             EXPECTED == X.checksum());
+            }
+        }
+
+        if (verbose) cout << "\nConsecutive calls to 'update'." << endl;
+
+        const int RANGES[] = { 5, 64, 100, 3, 16, 4000, 63, 65, 10000 };
+        const int NUM_RANGES = sizeof RANGES / sizeof *RANGES;
+
+        Obj        mX;
+        const Obj& X = mX;
+        int        offset = 0;
+
+        for (int i = 0; i < NUM_RANGES; ++i) {
+            mX.update(&buffer[offset], RANGES[i]);
+            offset += RANGES[i];
+
+            LOOP_ASSERT(i, crc(buffer.data(), offset) == X.checksum());
+        }
+
       } break;
       case 14: {
         // --------------------------------------------------------------------
@@ -2658,6 +2744,79 @@ int main(int argc, char *argv[])
                       << bsl::endl;
         }
 
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT TEST
+        //
+        // Concerns:
+        //: 1 Report the throughput (in GB/s) of 'update' on large buffers, and
+        //:   compare it to that of the byte-at-a-time oracle.
+        //
+        // Plan:
+        //: 1 For buffer sizes from 64 bytes to 16 MiB, time enough calls of
+        //:   'update' (and of the oracle) to process about 2 GB (resp.
+        //:   128 MB), and report the resulting throughput.  (C-1)
+        //
+        // Testing:
+        //   THROUGHPUT TEST
+        //   void update(const void *data, int length);  // performance
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTHROUGHPUT TEST"
+                          << "\n===============" << endl;
+
+        const int SIZES[] = { 64, 256, 4 << 10, 64 << 10, 1 << 20, 16 << 20 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        const bsls::Types::Int64 k_TOTAL_BYTES = 2LL << 30;
+
+        bsl::vector<char> buffer(SIZES[NUM_SIZES - 1]);
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            buffer[i] = static_cast<char>(i * 31 + (i >> 8));
+        }
+
+        bsls::Types::Uint64 result = 0;
+
+        cout << "Size(B)\tupdate (GB/s)\toracle (GB/s)" << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int                SIZE     = SIZES[si];
+            const bsls::Types::Int64 numIters = k_TOTAL_BYTES / SIZE;
+
+            Obj             mX;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < numIters; ++i) {
+                mX.update(buffer.data(), SIZE);
+            }
+            timer.stop();
+
+            const double updateRate = static_cast<double>(numIters) * SIZE
+                                    / timer.elapsedTime() / 1.0e9;
+
+            result ^= mX.checksum();
+
+            const bsls::Types::Int64 numOracleIters = numIters / 16;
+
+            timer.reset();
+            timer.start();
+            for (bsls::Types::Int64 i = 0; i < numOracleIters; ++i) {
+                result ^= crc(buffer.data(), SIZE);
+            }
+            timer.stop();
+
+            const double oracleRate = static_cast<double>(numOracleIters)
+                                    * SIZE / timer.elapsedTime() / 1.0e9;
+
+            cout << SIZE << '\t' << updateRate << '\t' << oracleRate << endl;
+        }
+
+        if (veryVerbose) {
+            P(result);
+        }
+
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -1,10 +1,41 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_ostream.h>
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The block transform of SHA-224 and SHA-256 is dispatched at run time.  On
+// x86 processors that support the SHA extensions ('sha256rnds2' and friends),
+// each 64-byte block is hashed by the dedicated instructions, which process
+// two rounds per instruction and are several times faster than the portable
+// implementation.  Otherwise the portable implementation is used.
+//
+// 'Sha256::loadDigests' hashes independent messages.  When the processor
+// supports AVX2 but not the SHA extensions, up to eight messages are hashed
+// at once, each in a separate 32-bit lane of the 256-bit registers: every lane
+// is fed blocks from its own message, and as soon as a message (including its
+// padding) is exhausted its digest is stored and the lane is refilled with the
+// next pending message.  When the SHA extensions are available they are
+// faster than the eight-lane AVX2 code, and the messages are simply hashed
+// one after another.
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -153,6 +184,12 @@ const bsl::uint32_t sha256Constants[64] =
              0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
              0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
 
+// First 32 bits of the fractional part of the square root of the first 8
+// primes.
+const bsl::uint32_t sha256InitialValues[8] =
+            {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+             0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
 // First 64 bits of fractional part of the cube roots of the first 80 primes.
 const bsl::uint64_t sha512Constants[80] =
             {0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL,
@@ -247,6 +284,499 @@ void transform(INTEGER             *state,
     }
 }
 
+bsl::uint64_t loadSha256Tail(unsigned char        (&tail)[128],
+                             const unsigned char  *message,
+                             bsl::size_t           length)
+    // Load into the specified 'tail' the bytes of the specified 'message'
+    // having the specified 'length' that follow its last complete 64-byte
+    // block, followed by the SHA-256 padding, and return the number (1 or 2)
+    // of 64-byte blocks of 'tail' that are used.
+{
+    const bsl::size_t   remainder  = length % 64;
+    const bsl::uint64_t numBuffers = remainder + 1 + 8 <= 64 ? 1 : 2;
+
+    bsl::fill(tail, tail + 128, 0);
+    bsl::copy(message + (length - remainder), message + length, tail);
+    tail[remainder] = 1 << 7;
+    unpack(static_cast<bsl::uint64_t>(length) * 8, tail + numBuffers * 64 - 8);
+
+    return numBuffers;
+}
+
+#if defined(LIKE_X86_GCC)
+struct CpuFeatures {
+    // This 'struct' describes the instruction set extensions used by this
+    // component that are supported by the current processor.
+
+    // DATA
+    bool d_hasShaExtensions;  // 'sha256rnds2' etc. and SSE4.1 are usable
+
+    bool d_hasAvx2;           // AVX2 is usable
+
+    // CREATORS
+    CpuFeatures();
+        // Create a 'CpuFeatures' object describing the current processor.
+};
+
+CpuFeatures::CpuFeatures()
+: d_hasShaExtensions(false)
+, d_hasAvx2(__builtin_cpu_supports("avx2"))
+{
+    if (__get_cpuid_max(0, 0) >= 7 && __builtin_cpu_supports("sse4.1")) {
+        unsigned int eax, ebx, ecx, edx;
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        d_hasShaExtensions = 0 != (ebx & bit_SHA);
+    }
+}
+
+const CpuFeatures& cpuFeatures()
+    // Return a reference providing non-modifiable access to the description
+    // of the current processor.
+{
+    static const CpuFeatures s_features;
+    return s_features;
+}
+
+__attribute__((target("sha,sse4.1")))
+void transformShaExtensions(bsl::uint32_t       *state,
+                            const unsigned char *message,
+                            bsl::uint64_t        numberOfBuffers)
+    // Update the specified 'state' with the SHA-256 hashed contents of the
+    // specified 'message' having a length equal to 64 times the specified
+    // 'numberOfBuffers', using the SHA extensions.  The behavior is undefined
+    // unless the processor supports the SHA and SSE4.1 extensions.
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL,
+                                            0x0405060700010203LL);
+
+    // 'sha256rnds2' operates on the working variables grouped as
+    // '(a, b, e, f)' and '(c, d, g, h)', so regroup the state accordingly.
+
+    __m128i tmp    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                                    state));
+    __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                                state + 4));
+    tmp    = _mm_shuffle_epi32(tmp, 0xB1);                         // CDAB
+    state1 = _mm_shuffle_epi32(state1, 0x1B);                      // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);              // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);                   // CDGH
+
+    for (; 0 != numberOfBuffers; --numberOfBuffers, message += 64) {
+        const __m128i saved0 = state0;
+        const __m128i saved1 = state1;
+
+        __m128i w[4];  // the last 16 words of the message schedule
+        for (int index = 0; index != 4; ++index) {
+            w[index] = _mm_shuffle_epi8(
+                             _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                        message + index * 16)),
+                             byteSwap);
+        }
+
+        for (int group = 0; group != 16; ++group) {
+            __m128i& words = w[group & 3];
+            if (4 <= group) {
+                // Compute words '4 * group' through '4 * group + 3' of the
+                // message schedule from the preceding 16 words.
+
+                const __m128i& w12 = w[(group + 1) & 3];
+                const __m128i& w8  = w[(group + 2) & 3];
+                const __m128i& w4  = w[(group + 3) & 3];
+
+                words = _mm_sha256msg2_epu32(
+                            _mm_add_epi32(_mm_sha256msg1_epu32(words, w12),
+                                          _mm_alignr_epi8(w4, w8, 4)),
+                            w4);
+            }
+            const __m128i k = _mm_add_epi32(
+                            words,
+                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                sha256Constants + group * 4)));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, k);
+            state0 = _mm_sha256rnds2_epu32(state0,
+                                           state1,
+                                           _mm_shuffle_epi32(k, 0x0E));
+        }
+
+        state0 = _mm_add_epi32(state0, saved0);
+        state1 = _mm_add_epi32(state1, saved1);
+    }
+
+    tmp    = _mm_shuffle_epi32(state0, 0x1B);                      // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);                      // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);                   // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);                      // HGFE
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), state1);
+}
+
+__attribute__((target("avx2")))
+inline
+__m256i rotateRightX8(__m256i value, int shift)
+    // Return the specified 'value' with each of its eight 32-bit lanes
+    // rotated by the specified 'shift' bits to the right.
+{
+    return _mm256_or_si256(_mm256_srli_epi32(value, shift),
+                           _mm256_slli_epi32(value, 32 - shift));
+}
+
+__attribute__((target("avx2")))
+inline
+void loadTransposedX8(__m256i                    *words,
+                      const unsigned char *const *messages,
+                      int                         offset)
+    // Load into the specified 'words' the eight big-endian 32-bit words
+    // starting at the specified 'offset' of each of the eight specified
+    // 'messages', such that lane 'i' of 'words[j]' holds word 'j' of message
+    // 'i'.
+{
+    __m256i row[8];
+    for (int lane = 0; lane != 8; ++lane) {
+        row[lane] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                                                     messages[lane] + offset));
+    }
+
+    __m256i pairs[8];
+    for (int index = 0; index != 8; index += 2) {
+        pairs[index]     = _mm256_unpacklo_epi32(row[index], row[index + 1]);
+        pairs[index + 1] = _mm256_unpackhi_epi32(row[index], row[index + 1]);
+    }
+
+    __m256i quads[8];
+    for (int index = 0; index != 8; index += 4) {
+        quads[index]     = _mm256_unpacklo_epi64(pairs[index],
+                                                 pairs[index + 2]);
+        quads[index + 1] = _mm256_unpackhi_epi64(pairs[index],
+                                                 pairs[index + 2]);
+        quads[index + 2] = _mm256_unpacklo_epi64(pairs[index + 1],
+                                                 pairs[index + 3]);
+        quads[index + 3] = _mm256_unpackhi_epi64(pairs[index + 1],
+                                                 pairs[index + 3]);
+    }
+
+    const __m256i byteSwap = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11,
+                                             4,  5,  6,  7,  0, 1, 2,  3,
+                                             12, 13, 14, 15, 8, 9, 10, 11,
+                                             4,  5,  6,  7,  0, 1, 2,  3);
+    for (int index = 0; index != 4; ++index) {
+        words[index]     = _mm256_shuffle_epi8(
+                         _mm256_permute2x128_si256(quads[index],
+                                                   quads[index + 4],
+                                                   0x20),
+                         byteSwap);
+        words[index + 4] = _mm256_shuffle_epi8(
+                         _mm256_permute2x128_si256(quads[index],
+                                                   quads[index + 4],
+                                                   0x31),
+                         byteSwap);
+    }
+}
+
+__attribute__((target("avx2")))
+void transformAvx2(bsl::uint32_t              (*state)[8],
+                   const unsigned char *const  *messages,
+                   bsl::uint64_t                numberOfBuffers)
+    // Update each of the eight SHA-256 states held in the specified 'state',
+    // where 'state[j][i]' is word 'j' of the state of lane 'i', with the
+    // hashed contents of the corresponding one of the eight specified
+    // 'messages', each having a length equal to 64 times the specified
+    // 'numberOfBuffers'.  The behavior is undefined unless the processor
+    // supports AVX2.
+{
+    __m256i s[8];
+    for (int index = 0; index != 8; ++index) {
+        s[index] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                                                                state[index]));
+    }
+
+    const unsigned char *message[8];
+    bsl::copy(messages, messages + 8, message);
+
+    for (; 0 != numberOfBuffers; --numberOfBuffers) {
+        __m256i w[16];  // the last 16 words of the message schedule
+        loadTransposedX8(w,     message,  0);
+        loadTransposedX8(w + 8, message, 32);
+
+        __m256i a = s[0], b = s[1], c = s[2], d = s[3];
+        __m256i e = s[4], f = s[5], g = s[6], h = s[7];
+        for (int index = 0; index != 64; ++index) {
+            __m256i& word = w[index & 15];
+            if (16 <= index) {
+                const __m256i w2  = w[(index -  2) & 15];
+                const __m256i w15 = w[(index - 15) & 15];
+                const __m256i f4  = _mm256_xor_si256(
+                                   _mm256_xor_si256(rotateRightX8(w2, 17),
+                                                    rotateRightX8(w2, 19)),
+                                   _mm256_srli_epi32(w2, 10));
+                const __m256i f3  = _mm256_xor_si256(
+                                   _mm256_xor_si256(rotateRightX8(w15, 7),
+                                                    rotateRightX8(w15, 18)),
+                                   _mm256_srli_epi32(w15, 3));
+                word = _mm256_add_epi32(
+                             _mm256_add_epi32(word, f3),
+                             _mm256_add_epi32(w[(index - 7) & 15], f4));
+            }
+
+            const __m256i f2 = _mm256_xor_si256(
+                                    _mm256_xor_si256(rotateRightX8(e, 6),
+                                                     rotateRightX8(e, 11)),
+                                    rotateRightX8(e, 25));
+            const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f),
+                                                _mm256_andnot_si256(e, g));
+            const __m256i t1 = _mm256_add_epi32(
+                  _mm256_add_epi32(_mm256_add_epi32(h, f2),
+                                   _mm256_add_epi32(ch, word)),
+                  _mm256_set1_epi32(static_cast<int>(sha256Constants[index])));
+
+            const __m256i f1 = _mm256_xor_si256(
+                                    _mm256_xor_si256(rotateRightX8(a, 2),
+                                                     rotateRightX8(a, 13)),
+                                    rotateRightX8(a, 22));
+            const __m256i maj = _mm256_or_si256(
+                             _mm256_and_si256(a, b),
+                             _mm256_and_si256(_mm256_or_si256(a, b), c));
+            const __m256i t2 = _mm256_add_epi32(f1, maj);
+
+            h = g;
+            g = f;
+            f = e;
+            e = _mm256_add_epi32(d, t1);
+            d = c;
+            c = b;
+            b = a;
+            a = _mm256_add_epi32(t1, t2);
+        }
+
+        s[0] = _mm256_add_epi32(s[0], a);
+        s[1] = _mm256_add_epi32(s[1], b);
+        s[2] = _mm256_add_epi32(s[2], c);
+        s[3] = _mm256_add_epi32(s[3], d);
+        s[4] = _mm256_add_epi32(s[4], e);
+        s[5] = _mm256_add_epi32(s[5], f);
+        s[6] = _mm256_add_epi32(s[6], g);
+        s[7] = _mm256_add_epi32(s[7], h);
+
+        for (int lane = 0; lane != 8; ++lane) {
+            message[lane] += 64;
+        }
+    }
+
+    for (int index = 0; index != 8; ++index) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[index]),
+                            s[index]);
+    }
+}
+
+struct MultiBufferLane {
+    // This 'struct' describes the progress of hashing one message in one
+    // lane of 'transformAvx2'.  A message is hashed as a run of complete
+    // blocks read in place, followed by a run of one or two blocks copied to
+    // 'd_tail' together with the SHA-256 padding.
+
+    // DATA
+    bool                 d_isActive;       // 'true' if hashing a message
+
+    bool                 d_isInTail;       // 'true' if hashing 'd_tail'
+
+    bsl::size_t          d_message;        // index of the message
+
+    const unsigned char *d_next_p;         // next block to hash
+
+    bsl::uint64_t        d_numBuffers;     // blocks left in the current run
+
+    bsl::uint64_t        d_numTailBuffers; // number of blocks in 'd_tail'
+
+    unsigned char        d_tail[128];      // final blocks, including padding
+};
+
+void loadDigestsAvx2(unsigned char       *results,
+                     const void * const  *messages,
+                     const bsl::size_t   *lengths,
+                     bsl::size_t          numMessages)
+    // Load into 'k_DIGEST_SIZE' bytes of the specified 'results' at offset
+    // 'index * Sha256::k_DIGEST_SIZE' the SHA-256 digest of the message
+    // '[messages[index], messages[index] + lengths[index])', for each 'index'
+    // in '[0, numMessages)', hashing up to eight messages concurrently.  The
+    // behavior is undefined unless the processor supports AVX2.
+{
+    enum { k_NUM_LANES = 8, k_BLOCK_SIZE = 64 };
+
+    static const unsigned char k_IDLE_BLOCK[k_BLOCK_SIZE] = {};
+        // input of the lanes for which no message remains
+
+    bsl::uint32_t        state[8][k_NUM_LANES];
+    const unsigned char *blocks[k_NUM_LANES];
+    MultiBufferLane      lanes[k_NUM_LANES];
+    bsl::size_t          nextMessage = 0;
+    int                  numActive   = 0;
+
+    for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+        lanes[lane].d_isActive = false;
+    }
+
+    while (true) {
+        for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+            MultiBufferLane& current = lanes[lane];
+            if (current.d_isActive && 0 == current.d_numBuffers) {
+                if (!current.d_isInTail) {
+                    current.d_isInTail   = true;
+                    current.d_next_p     = current.d_tail;
+                    current.d_numBuffers = current.d_numTailBuffers;
+                }
+                else {
+                    unsigned char *result = results
+                                          + current.d_message
+                                          * Sha256::k_DIGEST_SIZE;
+                    for (int index = 0; index != 8; ++index) {
+                        unpack(state[index][lane], result + index * 4);
+                    }
+                    current.d_isActive = false;
+                    --numActive;
+                }
+            }
+
+            if (!current.d_isActive && nextMessage != numMessages) {
+                const bsl::size_t length = lengths[nextMessage];
+                const unsigned char *data =
+                     static_cast<const unsigned char *>(messages[nextMessage]);
+
+                current.d_isActive       = true;
+                current.d_message        = nextMessage;
+                current.d_next_p         = data;
+                current.d_numBuffers     = length / k_BLOCK_SIZE;
+                current.d_numTailBuffers = loadSha256Tail(current.d_tail,
+                                                          data,
+                                                          length);
+
+                current.d_isInTail = 0 == current.d_numBuffers;
+                if (current.d_isInTail) {
+                    current.d_next_p     = current.d_tail;
+                    current.d_numBuffers = current.d_numTailBuffers;
+                }
+
+                for (int index = 0; index != 8; ++index) {
+                    state[index][lane] = sha256InitialValues[index];
+                }
+                ++nextMessage;
+                ++numActive;
+            }
+        }
+
+        if (0 == numActive) {
+            break;                                                     // BREAK
+        }
+
+        // Hash as many blocks as every lane has left in its current run.  An
+        // idle lane hashes a dummy block, so only one block is hashed at a
+        // time once the messages are running out.
+
+        bsl::uint64_t numBuffers = numActive == k_NUM_LANES
+                                 ? lanes[0].d_numBuffers
+                                 : 1;
+        for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+            if (lanes[lane].d_isActive) {
+                numBuffers   = bsl::min(numBuffers, lanes[lane].d_numBuffers);
+                blocks[lane] = lanes[lane].d_next_p;
+            }
+            else {
+                blocks[lane] = k_IDLE_BLOCK;
+            }
+        }
+
+        transformAvx2(state, blocks, numBuffers);
+
+        for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+            if (lanes[lane].d_isActive) {
+                lanes[lane].d_next_p     += numBuffers * k_BLOCK_SIZE;
+                lanes[lane].d_numBuffers -= numBuffers;
+            }
+        }
+    }
+}
+#endif
+
+void transform(bsl::uint32_t             *state,
+               const unsigned char       *message,
+               bsl::uint64_t              numberOfBuffers,
+               bsl::uint64_t              bufferSize,
+               const bsl::uint32_t      (&constants)[64])
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'bufferSize' times the
+    // specified 'numberOfBuffers', mixing it with the values in the specified
+    // 'constants', using the SHA extensions if the processor supports them.
+    // The behavior is undefined unless 'constants' is 'sha256Constants' and
+    // 'bufferSize' is 64.  Note that this overload is preferred over the
+    // portable template above for SHA-224 and SHA-256.
+{
+#if defined(LIKE_X86_GCC)
+    if (cpuFeatures().d_hasShaExtensions) {
+        transformShaExtensions(state, message, numberOfBuffers);
+        return;                                                       // RETURN
+    }
+#endif
+
+    transform<bsl::uint32_t, 64>(state,
+                                 message,
+                                 numberOfBuffers,
+                                 bufferSize,
+                                 constants);
+}
+
+typedef void (*Sha256Transform)(bsl::uint32_t       *state,
+                                const unsigned char *message,
+                                bsl::uint64_t        numberOfBuffers);
+    // 'Sha256Transform' is an alias for a function that updates 'state' with
+    // the SHA-256 hashed contents of 'message' having a length equal to 64
+    // times 'numberOfBuffers'.
+
+void transformPortable(bsl::uint32_t       *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numberOfBuffers)
+    // Update the specified 'state' with the SHA-256 hashed contents of the
+    // specified 'message' having a length equal to 64 times the specified
+    // 'numberOfBuffers', using the portable implementation.
+{
+    transform<bsl::uint32_t, 64>(state,
+                                 message,
+                                 numberOfBuffers,
+                                 64,
+                                 sha256Constants);
+}
+
+void loadDigestsSerially(unsigned char       *results,
+                         const void * const  *messages,
+                         const bsl::size_t   *lengths,
+                         bsl::size_t          numMessages,
+                         Sha256Transform      transformFunction)
+    // Load into 'k_DIGEST_SIZE' bytes of the specified 'results' at offset
+    // 'index * Sha256::k_DIGEST_SIZE' the SHA-256 digest of the message
+    // '[messages[index], messages[index] + lengths[index])', for each 'index'
+    // in '[0, numMessages)', hashing one message after another using the
+    // specified 'transformFunction'.
+{
+    for (bsl::size_t index = 0; index != numMessages; ++index) {
+        const unsigned char *data =
+                           static_cast<const unsigned char *>(messages[index]);
+        const bsl::size_t    length = lengths[index];
+
+        bsl::uint32_t state[8];
+        bsl::copy(sha256InitialValues, sha256InitialValues + 8, state);
+        transformFunction(state, data, length / 64);
+
+        unsigned char       tail[128];
+        const bsl::uint64_t numTailBuffers = loadSha256Tail(tail,
+                                                            data,
+                                                            length);
+        transformFunction(state, tail, numTailBuffers);
+
+        unsigned char *result = results + index * Sha256::k_DIGEST_SIZE;
+        for (int word = 0; word != 8; ++word) {
+            unpack(state[word], result + word * 4);
+        }
+    }
+}
+
 template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
 void updateImpl(INTEGER             *state,
                 bsl::uint64_t       *totalSize,
@@ -346,6 +876,78 @@ void toHex(char *output, const unsigned char (&input)[SIZE])
 
 } // close unnamed namespace
 
+bool Sha2_Impl::isSupported(Sha256Implementation implementation)
+{
+    switch (implementation) {
+      case e_PORTABLE: {
+        return true;                                                  // RETURN
+      }
+#if defined(LIKE_X86_GCC)
+      case e_SHA_EXTENSIONS: {
+        return cpuFeatures().d_hasShaExtensions;                      // RETURN
+      }
+      case e_AVX2: {
+        return cpuFeatures().d_hasAvx2;                               // RETURN
+      }
+#endif
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+}
+
+void Sha2_Impl::loadSha256Digests(Sha256Implementation  implementation,
+                                  unsigned char        *results,
+                                  const void * const   *messages,
+                                  const bsl::size_t    *lengths,
+                                  bsl::size_t           numMessages)
+{
+    switch (implementation) {
+#if defined(LIKE_X86_GCC)
+      case e_SHA_EXTENSIONS: {
+        loadDigestsSerially(results,
+                            messages,
+                            lengths,
+                            numMessages,
+                            &transformShaExtensions);
+      } break;
+      case e_AVX2: {
+        loadDigestsAvx2(results, messages, lengths, numMessages);
+      } break;
+#endif
+      default: {
+        loadDigestsSerially(results,
+                            messages,
+                            lengths,
+                            numMessages,
+                            &transformPortable);
+      }
+    }
+}
+
+void Sha256::loadDigests(unsigned char       *results,
+                         const void * const  *messages,
+                         const bsl::size_t   *lengths,
+                         bsl::size_t          numMessages)
+{
+    // The SHA extensions, where available, outperform the eight-lane AVX2
+    // implementation.
+
+    Sha2_Impl::Sha256Implementation implementation = Sha2_Impl::e_PORTABLE;
+    if (Sha2_Impl::isSupported(Sha2_Impl::e_SHA_EXTENSIONS)) {
+        implementation = Sha2_Impl::e_SHA_EXTENSIONS;
+    }
+    else if (Sha2_Impl::isSupported(Sha2_Impl::e_AVX2)) {
+        implementation = Sha2_Impl::e_AVX2;
+    }
+
+    Sha2_Impl::loadSha256Digests(implementation,
+                                 results,
+                                 messages,
+                                 lengths,
+                                 numMessages);
+}
+
 Sha224::Sha224()
 {
     reset();
@@ -410,16 +1012,7 @@ void Sha256::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // First 32 bits of the fractional part of the square root of the first 8
-    // primes.
-    d_state[0] = 0x6a09e667;
-    d_state[1] = 0xbb67ae85;
-    d_state[2] = 0x3c6ef372;
-    d_state[3] = 0xa54ff53a;
-    d_state[4] = 0x510e527f;
-    d_state[5] = 0x9b05688c;
-    d_state[6] = 0x1f83d9ab;
-    d_state[7] = 0x5be0cd19;
+    bsl::copy(sha256InitialValues, sha256InitialValues + 8, d_state);
 }
 
 void Sha384::reset()
@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -86,6 +87,13 @@ using namespace bsl;
 //    o void loadDigest(unsigned char *result) const;
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [26] void Sha256::loadDigests(results, messages, lengths, numMessages);
+//
+// Sha2_Impl
+// [26] bool isSupported(Sha256Implementation);
+// [26] void loadSha256Digests(impl, results, messages, lengths, num);
+//
 // CREATORS
 // [ 2] Sha224::Sha224();
 // [ 3] Sha256::Sha256();
@@ -135,7 +143,7 @@ using namespace bsl;
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -483,6 +491,46 @@ void testReset(const char (&message)[LENGTH])
     ASSERT(digest1 == digest2);
 }
 
+typedef bdlde::Sha2_Impl Impl;
+
+const int k_NUM_SHA256_IMPLEMENTATIONS = Impl::e_AVX2 + 2;
+    // Number of ways of hashing a batch of messages: 'Sha256::loadDigests'
+    // and each 'Sha2_Impl::Sha256Implementation'.
+
+bool isSha256ImplementationSupported(int implementation)
+    // Return 'true' if the specified 'implementation' of batch hashing (as
+    // understood by 'loadSha256Digests') is supported by the current
+    // processor, and 'false' otherwise.
+{
+    return 0 == implementation
+        || Impl::isSupported(
+                  static_cast<Impl::Sha256Implementation>(implementation - 1));
+}
+
+void loadSha256Digests(int                 implementation,
+                       unsigned char      *results,
+                       const void * const *messages,
+                       const bsl::size_t  *lengths,
+                       bsl::size_t         numMessages)
+    // Load into the specified 'results' the SHA-256 digests of the specified
+    // 'numMessages' messages described by the specified 'messages' and
+    // 'lengths', using 'Sha256::loadDigests' if the specified
+    // 'implementation' is 0, and 'Sha2_Impl::loadSha256Digests' with
+    // 'implementation - 1' otherwise.
+{
+    if (0 == implementation) {
+        bdlde::Sha256::loadDigests(results, messages, lengths, numMessages);
+    }
+    else {
+        Impl::loadSha256Digests(
+                  static_cast<Impl::Sha256Implementation>(implementation - 1),
+                     results,
+                     messages,
+                     lengths,
+                     numMessages);
+    }
+}
+
 template<class HASHER, bsl::size_t LENGTH>
 void testTwoArgumentConstructor(const char (&message)[LENGTH])
     // Test the two-argument constructor accepting the specified 'message' and
@@ -509,7 +557,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -531,6 +579,158 @@ int main(int argc, char *argv[])
 
         assertPasswordIsExpected();
       } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'Sha256::loadDigests'
+        //   This will test hashing a batch of independent messages.
+        //
+        // Concerns:
+        //: 1 The digest of each message is the same as the one computed by a
+        //:   'Sha256' object for that message alone, and is stored at the
+        //:   position of the message in the batch.
+        //:
+        //: 2 Messages of any length are hashed correctly, including empty
+        //:   messages and messages whose padding requires an extra block.
+        //:
+        //: 3 Messages of very different lengths in one batch, and batches of
+        //:   any size (including empty batches and batches that are not a
+        //:   multiple of the number of messages hashed concurrently), are
+        //:   hashed correctly.
+        //:
+        //: 4 No memory outside the messages and the results is accessed.
+        //:
+        //: 5 Each implementation supported by the processor (portable, SHA
+        //:   extensions, and eight-lane AVX2) satisfies concerns 1-4, whether
+        //:   or not 'Sha256::loadDigests' selects it on this processor.
+        //
+        // Plan:
+        //: 1 Perform the following steps with 'Sha256::loadDigests' and with
+        //:   'Sha2_Impl::loadSha256Digests' for each implementation for which
+        //:   'Sha2_Impl::isSupported' returns 'true'.  (C-5)
+        //:
+        //: 2 Hash the known messages as a batch and compare the results with
+        //:   the known hashes.  (C-1)
+        //:
+        //: 3 For batches of 0 to 20 messages having lengths chosen from a
+        //:   table of interesting values (and depending on the position in
+        //:   the batch), compare each result with that of a 'Sha256' object.
+        //:   Check that the bytes following the results are not modified.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   void Sha256::loadDigests(results, messages, lengths, numMessages);
+        //   bool isSupported(Sha256Implementation);
+        //   void loadSha256Digests(impl, results, messages, lengths, num);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'Sha256::loadDigests'" "\n"
+                             "=============================" "\n";
+
+        const bsl::size_t DIGEST_SIZE = bdlde::Sha256::k_DIGEST_SIZE;
+
+        ASSERT(Impl::isSupported(Impl::e_PORTABLE));
+
+        for (int impl = 0; impl != k_NUM_SHA256_IMPLEMENTATIONS; ++impl) {
+          if (!isSha256ImplementationSupported(impl)) {
+            if (verbose) cout << "Implementation " << impl
+                              << " is not supported." "\n";
+            continue;
+          }
+
+          if (verbose) cout << "Known hashes, implementation " << impl
+                            << "." "\n";
+          {
+              const bsl::size_t NUM_MESSAGES = arraySize(inputMessages);
+
+              const void    *messages[NUM_MESSAGES];
+              bsl::size_t    lengths[NUM_MESSAGES];
+              unsigned char  results[NUM_MESSAGES * DIGEST_SIZE];
+
+              for (bsl::size_t i = 0; i != NUM_MESSAGES; ++i) {
+                  messages[i] = inputMessages[i].c_str();
+                  lengths[i]  = inputMessages[i].size();
+              }
+
+              loadSha256Digests(impl,
+                                results,
+                                messages,
+                                lengths,
+                                NUM_MESSAGES);
+
+              unsigned char digest[DIGEST_SIZE];
+              bsl::string   hexDigest;
+              for (bsl::size_t i = 0; i != NUM_MESSAGES; ++i) {
+                  bsl::copy(results + i * DIGEST_SIZE,
+                            results + (i + 1) * DIGEST_SIZE,
+                            digest);
+                  toHex(&hexDigest, digest);
+                  ASSERTV(impl, i, hexDigest, hexDigest == sha256Results[i]);
+              }
+          }
+
+          if (verbose) cout << "Batches of messages of various lengths, "
+                               "implementation " << impl << "." "\n";
+          {
+              static const bsl::size_t LENGTHS[] = {
+                  0, 1, 3, 31, 32, 55, 56, 63, 64, 65, 100, 119, 120, 128, 129,
+                  200, 511, 1000, 4096, 10000
+              };
+              const bsl::size_t NUM_LENGTHS = arraySize(LENGTHS);
+              const bsl::size_t MAX_MESSAGES = 20;
+              const bsl::size_t MAX_LENGTH   = 10000;
+              const bsl::size_t GUARD_SIZE   = 16;
+
+              bsl::vector<char> data(MAX_MESSAGES * MAX_LENGTH);
+              for (bsl::size_t i = 0; i != data.size(); ++i) {
+                  data[i] = static_cast<char>(i * 131 + i / 256);
+              }
+
+              for (bsl::size_t numMessages = 0;
+                   numMessages <= MAX_MESSAGES;
+                   ++numMessages) {
+                  for (bsl::size_t offset = 0;
+                       offset != NUM_LENGTHS;
+                       ++offset) {
+                      const void    *messages[MAX_MESSAGES];
+                      bsl::size_t    lengths[MAX_MESSAGES];
+                      unsigned char  results[MAX_MESSAGES * DIGEST_SIZE
+                                                                + GUARD_SIZE];
+
+                      for (bsl::size_t i = 0; i != numMessages; ++i) {
+                          messages[i] = &data[i * MAX_LENGTH + i % 7];
+                          lengths[i]  = bsl::min(
+                                      LENGTHS[(offset + i * i) % NUM_LENGTHS],
+                                      MAX_LENGTH - i % 7);
+                      }
+
+                      bsl::fill(results, results + sizeof results, 0xA5);
+
+                      loadSha256Digests(impl,
+                                        results,
+                                        messages,
+                                        lengths,
+                                        numMessages);
+
+                      for (bsl::size_t i = 0; i != numMessages; ++i) {
+                          unsigned char expected[DIGEST_SIZE];
+                          const bdlde::Sha256 hasher(messages[i], lengths[i]);
+                          hasher.loadDigest(expected);
+                          ASSERTV(impl, numMessages, offset, i, lengths[i],
+                                  bsl::equal(expected,
+                                             expected + DIGEST_SIZE,
+                                             results + i * DIGEST_SIZE));
+                      }
+                      for (bsl::size_t i = numMessages * DIGEST_SIZE;
+                           i != sizeof results;
+                           ++i) {
+                          ASSERTV(impl, numMessages, offset, i,
+                                  0xA5 == results[i]);
+                      }
+                  }
+              }
+          }
+        }
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING PRINTING AND OUTPUT (<<) OPERATOR FOR SHA-512
@@ -1250,6 +1450,166 @@ int main(int argc, char *argv[])
             ASSERT(hasher == hasher);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SINGLE MESSAGE THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput of hashing a single message with each of
+        //:   'Sha256' and 'Sha512' for short and long messages.
+        //
+        // Plan:
+        //: 1 Hash about 256 MiB of data as messages of several sizes, and
+        //:   report the throughput and the time per message.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: SINGLE MESSAGE THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: SINGLE MESSAGE THROUGHPUT" "\n"
+                             "======================================" "\n";
+
+        const bsl::size_t SIZES[] = { 16, 64, 256, 1024, 64 * 1024,
+                                      1024 * 1024 };
+        const bsl::size_t TOTAL   = 256 * 1024 * 1024;
+
+        bsl::vector<char> data(SIZES[arraySize(SIZES) - 1]);
+        for (bsl::size_t i = 0; i != data.size(); ++i) {
+            data[i] = static_cast<char>(i * 131);
+        }
+
+        unsigned int sink = 0;
+        for (bsl::size_t i = 0; i != arraySize(SIZES); ++i) {
+            const bsl::size_t SIZE       = SIZES[i];
+            const bsl::size_t ITERATIONS = TOTAL / SIZE;
+
+            unsigned char   digest256[bdlde::Sha256::k_DIGEST_SIZE];
+            bsls::Stopwatch timer;
+            timer.start();
+            for (bsl::size_t j = 0; j != ITERATIONS; ++j) {
+                bdlde::Sha256 hasher(data.data(), SIZE);
+                hasher.loadDigest(digest256);
+                sink += digest256[0];
+            }
+            timer.stop();
+            const double time256 = timer.elapsedTime();
+
+            unsigned char digest512[bdlde::Sha512::k_DIGEST_SIZE];
+            timer.reset();
+            timer.start();
+            for (bsl::size_t j = 0; j != ITERATIONS; ++j) {
+                bdlde::Sha512 hasher(data.data(), SIZE);
+                hasher.loadDigest(digest512);
+                sink += digest512[0];
+            }
+            timer.stop();
+            const double time512 = timer.elapsedTime();
+
+            cout << "size: "            << SIZE
+                 << "\tSHA-256 MB/s: "  << TOTAL / time256 / 1e6
+                 << "\tns/message: "    << time256 * 1e9 / ITERATIONS
+                 << "\tSHA-512 MB/s: "  << TOTAL / time512 / 1e6
+                 << "\tns/message: "    << time512 * 1e9 / ITERATIONS
+                 << "\n";
+        }
+        if (verbose) P(sink);
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BATCHED SHA-256 THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput of 'Sha256::loadDigests', and of each of
+        //:   its implementations supported by the processor, compared to
+        //:   hashing the same messages one at a time, for short and long
+        //:   messages.
+        //
+        // Plan:
+        //: 1 Hash about 256 MiB of data as batches of 64 messages of several
+        //:   sizes, with 'loadDigests', with each supported implementation
+        //:   of 'Sha2_Impl::loadSha256Digests', and with a 'Sha256' object
+        //:   per message, and report the throughput and the time per message.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BATCHED SHA-256 THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: BATCHED SHA-256 THROUGHPUT" "\n"
+                             "=======================================" "\n";
+
+        const bsl::size_t DIGEST_SIZE  = bdlde::Sha256::k_DIGEST_SIZE;
+        const bsl::size_t NUM_MESSAGES = 64;
+        const bsl::size_t SIZES[]      = { 16, 64, 256, 1024, 16 * 1024 };
+        const bsl::size_t MAX_SIZE     = SIZES[arraySize(SIZES) - 1];
+        const bsl::size_t TOTAL        = 256 * 1024 * 1024;
+
+        bsl::vector<char> data(NUM_MESSAGES * MAX_SIZE);
+        for (bsl::size_t i = 0; i != data.size(); ++i) {
+            data[i] = static_cast<char>(i * 131);
+        }
+
+        const void    *messages[NUM_MESSAGES];
+        bsl::size_t    lengths[NUM_MESSAGES];
+        unsigned char  results[NUM_MESSAGES * DIGEST_SIZE];
+
+        unsigned int sink = 0;
+        for (bsl::size_t i = 0; i != arraySize(SIZES); ++i) {
+            const bsl::size_t SIZE       = SIZES[i];
+            const bsl::size_t ITERATIONS = TOTAL / SIZE / NUM_MESSAGES;
+
+            for (bsl::size_t j = 0; j != NUM_MESSAGES; ++j) {
+                messages[j] = &data[j * SIZE];
+                lengths[j]  = SIZE;
+            }
+
+            const double numHashed = static_cast<double>(ITERATIONS)
+                                   * NUM_MESSAGES;
+
+            cout << "size: " << SIZE;
+
+            bsls::Stopwatch timer;
+            for (int impl = 0; impl != k_NUM_SHA256_IMPLEMENTATIONS; ++impl) {
+                if (!isSha256ImplementationSupported(impl)) {
+                    continue;
+                }
+
+                timer.reset();
+                timer.start();
+                for (bsl::size_t j = 0; j != ITERATIONS; ++j) {
+                    loadSha256Digests(impl,
+                                      results,
+                                      messages,
+                                      lengths,
+                                      NUM_MESSAGES);
+                    sink += results[0];
+                }
+                timer.stop();
+                const double batchTime = timer.elapsedTime();
+
+                cout << "\tbatched (" << impl << ") MB/s: "
+                     << TOTAL / batchTime / 1e6
+                     << "\tns/message: " << batchTime * 1e9 / numHashed;
+            }
+
+            timer.reset();
+            timer.start();
+            for (bsl::size_t j = 0; j != ITERATIONS; ++j) {
+                for (bsl::size_t k = 0; k != NUM_MESSAGES; ++k) {
+                    const bdlde::Sha256 hasher(messages[k], lengths[k]);
+                    hasher.loadDigest(results + k * DIGEST_SIZE);
+                }
+                sink += results[0];
+            }
+            timer.stop();
+            const double singleTime = timer.elapsedTime();
+
+            cout << "\tone-by-one MB/s: "  << TOTAL / singleTime / 1e6
+                 << "\tns/message: "       << singleTime * 1e9 / numHashed
+                 << "\n";
+        }
+        if (verbose) P(sink);
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
@@ -15,11 +15,24 @@ BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 #include <bsla_fallthrough.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_streambuf.h>
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <immintrin.h>
+#endif
+
 // LOCAL MACROS
 
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
@@ -164,6 +177,366 @@ int get4ByteValue(const char *pc)
                                |  (pc[3] & k_CONT_VALUE_MASK);
 }
 
+static inline
+int sequenceLength(char firstOctet)
+    // Return the number of bytes in the UTF-8 sequence that the specified
+    // 'firstOctet', which must not be a continuation byte, begins.  Note that
+    // an invalid initial octet is treated as beginning a 4-byte sequence.
+{
+    const unsigned char uc = static_cast<unsigned char>(firstOctet);
+
+    return uc < 0x80 ? 1 : uc < 0xe0 ? 2 : uc < 0xf0 ? 3 : 4;
+}
+
+static
+const char *backUpToSequenceStart(int        *count,
+                                  const char *string,
+                                  const char *position)
+    // Return the address of the first byte of the UTF-8 sequence that
+    // straddles the specified 'position' in the specified 'string', and
+    // decrement the specified 'count' of code points whose first byte lies
+    // before 'position', if such a sequence exists, and return 'position'
+    // otherwise.  The behavior is undefined unless the bytes in the range
+    // '[ string, position )' are valid UTF-8, with the possible exception of
+    // an incomplete final sequence.
+{
+    for (int distance = 1; distance <= 3; ++distance) {
+        if (distance > position - string) {
+            break;
+        }
+
+        const char octet = position[-distance];
+        if (isNotContinuation(octet)) {
+            if (sequenceLength(octet) > distance) {
+                --*count;
+                return position - distance;                           // RETURN
+            }
+            break;
+        }
+    }
+
+    return position;
+}
+
+static
+const char *skipAsciiWords(int *count, const char *string, const char *end)
+    // Return the address of the first 8-byte word in the range
+    // '[ string, end )' that contains a byte having its high bit set, or of
+    // the partial word at the end of the range if there is no such word, and
+    // add the number of bytes skipped to the specified 'count'.
+{
+    const char *pc = string;
+
+    while (end - pc >= 8) {
+        bsls::Types::Uint64 word;
+        bsl::memcpy(&word, pc, sizeof(word));
+        if (word & 0x8080808080808080ULL) {
+            break;
+        }
+        pc += 8;
+    }
+
+    *count += static_cast<int>(pc - string);
+    return pc;
+}
+
+#if defined(LIKE_X86_GCC)
+
+// The vectorized validation below follows the "lookup" algorithm described by
+// John Keiser and Daniel Lemire in "Validating UTF-8 In Less Than One
+// Instruction Per Byte": every byte is classified, together with the byte
+// preceding it, by three 16-entry tables indexed by nibbles, whose entries
+// are sets of the errors the nibble is consistent with.  A pair of bytes is
+// invalid if the intersection of the three sets is not empty.  The third and
+// fourth bytes of 3- and 4-byte sequences are checked separately, by
+// comparing the bytes 2 and 3 positions earlier with the lowest 3- and 4-byte
+// initial octets.  A block that ends in an incomplete sequence is flagged, so
+// that a following block of ASCII is not accepted without the full check.
+
+enum {
+    k_TOO_SHORT      = 1 << 0,  // initial octet not followed by continuation
+    k_TOO_LONG       = 1 << 1,  // ASCII followed by continuation
+    k_OVERLONG_3     = 1 << 2,  // 0xe0 followed by 0x80-0x9f
+    k_TOO_LARGE      = 1 << 3,  // 0xf4 followed by 0x90-0xbf, or 0xf5-0xff
+    k_SURROGATE_PAIR = 1 << 4,  // 0xed followed by 0xa0-0xbf
+    k_OVERLONG_2     = 1 << 5,  // 0xc0 or 0xc1
+    k_TOO_LARGE_1000 = 1 << 6,  // 0xf5-0xff followed by 0x80-0x8f
+    k_OVERLONG_4     = 1 << 6,  // 0xf0 followed by 0x80-0x8f
+    k_TWO_CONTS      = 1 << 7,  // continuation followed by continuation
+
+    k_CARRY          = k_TOO_SHORT | k_TOO_LONG | k_TWO_CONTS
+};
+
+// The following tables are indexed, respectively, by the high and low nibbles
+// of the first byte of a pair, and by the high nibble of the second byte.
+
+static const unsigned char byte1HighTable[16] = {
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+    k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS,
+    k_TOO_SHORT | k_OVERLONG_2,
+    k_TOO_SHORT,
+    k_TOO_SHORT | k_OVERLONG_3 | k_SURROGATE_PAIR,
+    k_TOO_SHORT | k_TOO_LARGE | k_TOO_LARGE_1000 | k_OVERLONG_4
+};
+
+static const unsigned char byte1LowTable[16] = {
+    k_CARRY | k_OVERLONG_3 | k_OVERLONG_2 | k_OVERLONG_4,
+    k_CARRY | k_OVERLONG_2,
+    k_CARRY,
+    k_CARRY,
+    k_CARRY | k_TOO_LARGE,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000 | k_SURROGATE_PAIR,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000
+};
+
+static const unsigned char byte2HighTable[16] = {
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3
+                                         | k_TOO_LARGE_1000 | k_OVERLONG_4,
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3 | k_TOO_LARGE,
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE_PAIR | k_TOO_LARGE,
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE_PAIR | k_TOO_LARGE,
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT
+};
+
+__attribute__((target("ssse3")))
+static
+const char *skipValidBlocksSsse3(int        *count,
+                                 const char *string,
+                                 const char *end)
+    // Return the address following the longest sequence of consecutive
+    // 16-byte blocks, starting at the specified 'string' and ending at or
+    // before the specified 'end', whose bytes are consistent with valid UTF-8
+    // (i.e., valid, except possibly for an incomplete final sequence), and
+    // add to the specified 'count' the number of initial octets in those
+    // blocks.  The behavior is undefined unless 'string' is the first byte of
+    // a UTF-8 sequence.
+{
+    const __m128i high1 = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(byte1HighTable));
+    const __m128i low1  = _mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(byte1LowTable));
+    const __m128i high2 = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(byte2HighTable));
+
+    const __m128i zero       = _mm_setzero_si128();
+    const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+    const __m128i highBit    = _mm_set1_epi8(static_cast<char>(0x80));
+    const __m128i min3Byte   = _mm_set1_epi8(0xe0 - 0x80);
+    const __m128i min4Byte   = _mm_set1_epi8(0xf0 - 0x80);
+    const __m128i maxCont    = _mm_set1_epi8(static_cast<char>(0xbf));
+
+    // A block is incomplete if its last byte is at least 0xc0, its second to
+    // last byte at least 0xe0, or its third to last byte at least 0xf0.
+
+    const __m128i maxComplete = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                              -1, -1, -1, -1, -1,
+                                              static_cast<char>(0xef),
+                                              static_cast<char>(0xdf),
+                                              static_cast<char>(0xbf));
+
+    __m128i     previous   = zero;
+    bool        incomplete = false;
+    const char *pc         = string;
+
+    while (end - pc >= 16) {
+        const __m128i input = _mm_loadu_si128(
+                                        reinterpret_cast<const __m128i *>(pc));
+
+        if (0 == _mm_movemask_epi8(input)) {
+            if (incomplete) {
+                break;
+            }
+            *count   += 16;
+            pc       += 16;
+            previous  = input;
+            continue;
+        }
+
+        const __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+        const __m128i prev2 = _mm_alignr_epi8(input, previous, 14);
+        const __m128i prev3 = _mm_alignr_epi8(input, previous, 13);
+
+        const __m128i special = _mm_and_si128(
+            _mm_and_si128(
+                _mm_shuffle_epi8(high1,
+                                 _mm_and_si128(_mm_srli_epi16(prev1, 4),
+                                               nibbleMask)),
+                _mm_shuffle_epi8(low1, _mm_and_si128(prev1, nibbleMask))),
+            _mm_shuffle_epi8(high2,
+                             _mm_and_si128(_mm_srli_epi16(input, 4),
+                                           nibbleMask)));
+
+        const __m128i must23 = _mm_and_si128(
+                                     _mm_or_si128(_mm_subs_epu8(prev2,
+                                                                min3Byte),
+                                                  _mm_subs_epu8(prev3,
+                                                                min4Byte)),
+                                     highBit);
+
+        const __m128i error = _mm_xor_si128(must23, special);
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(error, zero))) {
+            break;
+        }
+
+        *count += __builtin_popcount(
+                    _mm_movemask_epi8(_mm_cmpgt_epi8(input, maxCont)));
+        incomplete = 0xffff != _mm_movemask_epi8(
+                             _mm_cmpeq_epi8(_mm_subs_epu8(input, maxComplete),
+                                            zero));
+        pc       += 16;
+        previous  = input;
+    }
+
+    return pc;
+}
+
+__attribute__((target("avx2")))
+static
+const char *skipValidBlocksAvx2(int        *count,
+                                const char *string,
+                                const char *end)
+    // Return the address following the longest sequence of consecutive
+    // 32-byte blocks, starting at the specified 'string' and ending at or
+    // before the specified 'end', whose bytes are consistent with valid UTF-8
+    // (i.e., valid, except possibly for an incomplete final sequence), and
+    // add to the specified 'count' the number of initial octets in those
+    // blocks.  The behavior is undefined unless 'string' is the first byte of
+    // a UTF-8 sequence.
+{
+    const __m256i high1 = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(byte1HighTable)));
+    const __m256i low1  = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(byte1LowTable)));
+    const __m256i high2 = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(byte2HighTable)));
+
+    const __m256i zero       = _mm256_setzero_si256();
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+    const __m256i highBit    = _mm256_set1_epi8(static_cast<char>(0x80));
+    const __m256i min3Byte   = _mm256_set1_epi8(0xe0 - 0x80);
+    const __m256i min4Byte   = _mm256_set1_epi8(0xf0 - 0x80);
+    const __m256i maxCont    = _mm256_set1_epi8(static_cast<char>(0xbf));
+
+    const __m256i maxComplete = _mm256_setr_epi8(
+                              -1, -1, -1, -1, -1, -1, -1, -1,
+                              -1, -1, -1, -1, -1, -1, -1, -1,
+                              -1, -1, -1, -1, -1, -1, -1, -1,
+                              -1, -1, -1, -1, -1,
+                              static_cast<char>(0xef),
+                              static_cast<char>(0xdf),
+                              static_cast<char>(0xbf));
+
+    __m256i     previous   = zero;
+    bool        incomplete = false;
+    const char *pc         = string;
+
+    while (end - pc >= 32) {
+        const __m256i input = _mm256_loadu_si256(
+                                        reinterpret_cast<const __m256i *>(pc));
+
+        if (0 == _mm256_movemask_epi8(input)) {
+            if (incomplete) {
+                break;
+            }
+            *count   += 32;
+            pc       += 32;
+            previous  = input;
+            continue;
+        }
+
+        // '_mm256_alignr_epi8' shifts within 128-bit lanes, so the bytes
+        // preceding each lane are first gathered into one register.
+
+        const __m256i shifted = _mm256_permute2x128_si256(previous,
+                                                          input,
+                                                          0x21);
+        const __m256i prev1   = _mm256_alignr_epi8(input, shifted, 15);
+        const __m256i prev2   = _mm256_alignr_epi8(input, shifted, 14);
+        const __m256i prev3   = _mm256_alignr_epi8(input, shifted, 13);
+
+        const __m256i special = _mm256_and_si256(
+            _mm256_and_si256(
+                _mm256_shuffle_epi8(high1,
+                                    _mm256_and_si256(_mm256_srli_epi16(prev1,
+                                                                       4),
+                                                     nibbleMask)),
+                _mm256_shuffle_epi8(low1,
+                                    _mm256_and_si256(prev1, nibbleMask))),
+            _mm256_shuffle_epi8(high2,
+                                _mm256_and_si256(_mm256_srli_epi16(input, 4),
+                                                 nibbleMask)));
+
+        const __m256i must23 = _mm256_and_si256(
+                               _mm256_or_si256(_mm256_subs_epu8(prev2,
+                                                                min3Byte),
+                                               _mm256_subs_epu8(prev3,
+                                                                min4Byte)),
+                               highBit);
+
+        const __m256i error = _mm256_xor_si256(must23, special);
+        if (!_mm256_testz_si256(error, error)) {
+            break;
+        }
+
+        *count += __builtin_popcount(static_cast<unsigned>(
+                     _mm256_movemask_epi8(_mm256_cmpgt_epi8(input, maxCont))));
+
+        const __m256i tail = _mm256_subs_epu8(input, maxComplete);
+        incomplete = !_mm256_testz_si256(tail, tail);
+        pc       += 32;
+        previous  = input;
+    }
+
+    return pc;
+}
+
+#endif  // defined(LIKE_X86_GCC)
+
+static
+const char *skipValidPrefix(int                    *count,
+                            const char             *string,
+                            bsls::Types::size_type  length)
+    // Return the address of the first byte of a UTF-8 sequence in the
+    // specified 'string' having the specified 'length' such that the bytes
+    // preceding it are valid UTF-8, and add to the specified 'count' the
+    // number of code points in those bytes.  Note that the returned address
+    // is determined by examining the input in blocks, using the widest vector
+    // instructions supported by the processor, and that the validation of the
+    // remainder of 'string' is left to the caller.
+{
+    const char *const end = string + length;
+
+#if defined(LIKE_X86_GCC)
+    if (__builtin_cpu_supports("avx2")) {
+        return backUpToSequenceStart(count,
+                                     string,
+                                     skipValidBlocksAvx2(count, string, end));
+                                                                      // RETURN
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return backUpToSequenceStart(count,
+                                     string,
+                                     skipValidBlocksSsse3(count,
+                                                          string,
+                                                          end));      // RETURN
+    }
+#endif
+
+    return skipAsciiWords(count, string, end);
+}
+
 static
 int validateAndCountCodePoints(const char **invalidString, const char *string)
     // Return the number of Unicode code points in the specified 'string' if it
@@ -327,10 +700,15 @@ static int validateAndCountCodePoints(const char             **invalidString,
         return 0;                                                     // RETURN
     }
 
-    const char       *pc     = string;
     const char *const pcEnd4 = string + length - 4;
 
-    int count = 0;
+    // Skip the longest valid prefix that can be identified in bulk; the
+    // remainder, including any invalid sequence, is examined one code point
+    // at a time so that the error reported is that of the first invalid
+    // sequence.
+
+    int         count = 0;
+    const char *pc    = skipValidPrefix(&count, string, length);
 
     while (pc <= pcEnd4) {
         switch (static_cast<unsigned char>(*pc) >> 4) {
@@ -17,6 +17,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_log.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -84,6 +85,9 @@ using bsl::size_t;
 //: o Test case 14 is negative testing.
 //:
 //: o Test cases 15, 16, and 17 are USAGE EXAMPLES.
+//:
+//: o Test case 18 tests that the bulk validation performed by the overloads
+//:   taking a length agrees with the null-terminated overloads.
 //
 //-----------------------------------------------------------------------------
 // To fit functions on one line, 'typedef const char cchar'.
@@ -154,8 +158,10 @@ using bsl::size_t;
 // [15] USAGE EXAMPLE 1
 // [16] USAGE EXAMPLE 2
 // [17] USAGE EXAMPLE 3
+// [18] TESTING BULK VALIDATION
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] BULK VALIDATION PERFORMANCE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -3026,6 +3032,112 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING BULK VALIDATION
+        //
+        // Concerns:
+        //: 1 The overloads of 'isValid' and 'numCodePointsIfValid' taking a
+        //:   length, which validate their input in blocks, report the same
+        //:   count, and the same error at the same position, as the
+        //:   null-terminated overloads, which examine one code point at a
+        //:   time.
+        //:
+        //: 2 Invalid sequences are detected wherever they occur relative to
+        //:   the block boundaries, including straddling them, and in the
+        //:   partial block at the end of the input.
+        //:
+        //: 3 Sequences truncated by the end of the input are detected, even
+        //:   when the preceding blocks are valid.
+        //:
+        //: 4 Long runs of ASCII are counted correctly, including when
+        //:   preceded by an incomplete sequence.
+        //
+        // Plan:
+        //: 1 Generate strings of random valid code points interleaved with
+        //:   runs of ASCII of random length, and verify that they are valid
+        //:   and have the expected number of code points.  (C-1, 4)
+        //:
+        //: 2 Overwrite each byte of the strings, in turn, with each of a set
+        //:   of bytes that introduce each kind of error, and compare the
+        //:   results of the overloads taking a length with those of the
+        //:   null-terminated overloads and 'advanceIfValid'.  (C-1..2, 4)
+        //:
+        //: 3 Validate every prefix of the strings.  (C-3)
+        //
+        // Testing:
+        //   TESTING BULK VALIDATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING BULK VALIDATION\n"
+                             "=======================\n";
+
+        static const char BYTES[] = {
+            'a', '\x7f', '\x80', '\xbf', '\xc0', '\xc1', '\xc2', '\xdf',
+            '\xe0', '\xed', '\xef', '\xf0', '\xf4', '\xf5', '\xf8', '\xff' };
+        enum { k_NUM_BYTES = sizeof BYTES / sizeof *BYTES };
+
+        for (int ti = 0; ti < 200; ++ti) {
+            bsl::string str;
+            IntPtr      expCount = 0;
+
+            while (str.length() < static_cast<size_t>(ti * 2)) {
+                const int numAscii = randUnsigned() % 4
+                                   ? 0
+                                   : randUnsigned() % 80;
+                for (int ii = 0; ii < numAscii; ++ii) {
+                    appendRand1Byte(&str);
+                }
+                appendRandCorrectCodePoint(&str, false);
+                expCount += numAscii + 1;
+            }
+
+            if (veryVerbose) { P_(ti);    P(str.length()); }
+
+            const char *invalid = 0;
+            ASSERTV(ti, allValid(str));
+            ASSERTV(ti, expCount == allNumCodePointsIfValid(&invalid, str));
+            ASSERTV(ti, 0 == invalid);
+
+            for (size_t ii = 0; ii < str.length(); ++ii) {
+                for (int tj = 0; tj < k_NUM_BYTES; ++tj) {
+                    bsl::string mutant(str);
+                    mutant[ii] = BYTES[tj];
+
+                    const IntPtr ret = allNumCodePointsIfValid(&invalid,
+                                                               mutant);
+                    ASSERTV(ti, ii, tj, ret, (0 <= ret) == !invalid);
+                    ASSERTV(ti, ii, tj, (0 <= ret) == allValid(mutant));
+
+                    // 'advanceIfValid' reports the code points preceding
+                    // the first error.
+
+                    int          status;
+                    const char  *result;
+                    const IntPtr numAdvanced = allAdvanceIfValid(&status,
+                                                                 &result,
+                                                                 mutant);
+                    if (0 <= ret) {
+                        ASSERTV(ti, ii, tj, 0 == status);
+                        ASSERTV(ti, ii, tj, ret == numAdvanced);
+                    }
+                    else {
+                        ASSERTV(ti, ii, tj, ret == status);
+                        ASSERTV(ti, ii, tj, invalid == result);
+                    }
+                }
+            }
+
+            for (size_t ii = 0; ii <= str.length(); ++ii) {
+                const bsl::string prefix(str.data(), ii);
+
+                const IntPtr ret = allNumCodePointsIfValid(&invalid, prefix);
+                ASSERTV(ti, ii, (0 <= ret) == !invalid);
+                ASSERTV(ti, ii, (0 <= ret) == allValid(prefix));
+                ASSERTV(ti, ii, (0 <= ret) == Obj::isValid(str.data(), ii));
+            }
+        }
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 3: 'readIfValid'
@@ -6232,6 +6344,72 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // BULK VALIDATION PERFORMANCE
+        //
+        // Concerns:
+        //: 1 The overloads of 'isValid' taking a length, which validate their
+        //:   input in blocks, are faster than the null-terminated overloads,
+        //:   which examine one code point at a time.
+        //
+        // Plan:
+        //: 1 Time both overloads on 1MB of ASCII, and of text in which 1 in
+        //:   16 code points is multi-byte, and of text in which all code
+        //:   points are multi-byte, and report the throughput.
+        //
+        // Testing:
+        //   BULK VALIDATION PERFORMANCE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BULK VALIDATION PERFORMANCE\n"
+                             "===========================\n";
+
+        enum { k_LENGTH = 1024 * 1024, k_NUM_ITERATIONS = 200 };
+
+        static const char *const NAMES[] = { "ascii", "mixed", "multi-byte" };
+
+        for (int ti = 0; ti < 3; ++ti) {
+            bsl::string str;
+            while (str.length() < k_LENGTH) {
+                if (0 == ti || (1 == ti && randUnsigned() % 16)) {
+                    appendRand1Byte(&str);
+                }
+                else {
+                    appendRandCorrectCodePoint(&str,
+                                               false,
+                                               2 + randUnsigned() % 3);
+                }
+            }
+
+            bool            valid = true;
+            bsls::Stopwatch timer;
+
+            timer.start(true);
+            for (int ii = 0; ii < k_NUM_ITERATIONS; ++ii) {
+                valid &= Obj::isValid(str.data(), str.length());
+            }
+            timer.stop();
+            const double lengthTime = timer.accumulatedUserTime();
+
+            timer.reset();
+            timer.start(true);
+            for (int ii = 0; ii < k_NUM_ITERATIONS; ++ii) {
+                valid &= Obj::isValid(str.c_str());
+            }
+            timer.stop();
+            const double nullTime = timer.accumulatedUserTime();
+
+            ASSERT(valid);
+
+            const double megabytes = static_cast<double>(str.length())
+                                   * k_NUM_ITERATIONS / (1024 * 1024);
+
+            cout << NAMES[ti] << ": length: "
+                 << megabytes / lengthTime << " MB/s, null-terminated: "
+                 << megabytes / nullTime   << " MB/s\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,773 @@
+// bdlma_threadcachingallocator.cpp                                   -*-C++-*-
+#include <bdlma_threadcachingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadcachingallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlma_pool.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+
+#include <new>           // placement 'new'
+
+// IMPLEMENTATION NOTES
+// --------------------
+// Every block dispensed by a 'bdlma::ThreadCachingAllocator' is preceded by a
+// maximally-aligned 'Header' holding the index of the pool that supplied the
+// block (or -1 for a "large" block obtained from 'd_blockList').  The header
+// of a pooled block is written once, when the block is carved out of its
+// pool, and is left untouched while the block moves between per-thread caches
+// and the shared free-block stack of its size class.
+//
+// A per-thread cache holds, for each size class, a fixed-capacity array
+// ("magazine") of free blocks, used as a stack.  An empty magazine is refilled
+// with (up to) 'k_BATCH_SIZE' blocks taken from the shared stack of its size
+// class or, if that stack is empty, newly carved out of the pool of that size
+// class.  When a full magazine receives a block, the 'k_BATCH_SIZE' blocks at
+// its bottom (i.e., the least recently used) are returned to the shared stack.
+// Both transfers take the lock of the size class exactly once.
+//
+// The shared stack of a size class always has capacity for every block ever
+// carved out of its pool (see 'ThreadCachingAllocator_SizeClass::takeBlocks'),
+// so returning blocks to it never allocates, and therefore 'deallocate' never
+// throws.
+//
+// The number of blocks in a magazine, and the statistics of a cache, are
+// modified only by the thread owning the cache, but are read by
+// 'loadCacheStatistics' from other threads; they are therefore atomic
+// variables, accessed with relaxed memory ordering, which on common
+// platforms compiles to plain loads and stores.
+
+extern "C" {
+
+static void bdlma_ThreadCachingAllocator_destroyCache(void *cache);
+    // Destroy the specified 'cache', a 'bdlma::ThreadCachingAllocator_Cache'
+    // of a thread that is exiting.
+
+}  // extern "C"
+
+namespace BloombergLP {
+namespace {
+
+enum {
+    k_DEFAULT_NUM_POOLS      = 10,
+    k_DEFAULT_MAX_CHUNK_SIZE = 32,
+    k_MIN_BLOCK_SIZE         = 8,
+
+    k_CACHE_CAPACITY         = 64,  // maximum number of blocks held per size
+                                    // class in a per-thread cache
+
+    k_BATCH_SIZE             = 32   // number of blocks moved between a
+                                    // per-thread cache and the shared stack
+                                    // of a size class at once
+};
+
+union Header {
+    // Leading header of each block dispensed by the allocator.
+
+    int                                 d_poolIdx;  // pool used for this
+                                                    // block, or -1
+
+    bsls::AlignmentUtil::MaxAlignedType d_dummy;    // forces alignment
+};
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                   // =======================================
+                   // struct ThreadCachingAllocator_SizeClass
+                   // =======================================
+
+struct ThreadCachingAllocator_SizeClass {
+    // This 'struct' holds the shared state of one size class of a
+    // 'ThreadCachingAllocator': the pool from which blocks of that size are
+    // carved, and the stack of free blocks returned by per-thread caches.
+
+    // DATA
+    bslmt::Mutex        d_mutex;       // protects all members
+
+    bsl::vector<void *> d_freeBlocks;  // free blocks (including headers)
+
+    Pool                d_pool;        // supplies new blocks
+
+    int                 d_numBlocks;   // number of blocks carved out of
+                                       // 'd_pool'
+
+    // CREATORS
+    ThreadCachingAllocator_SizeClass(
+                               bsls::Types::size_type       blockSize,
+                               bsls::BlockGrowth::Strategy  growthStrategy,
+                               int                          maxBlocksPerChunk,
+                               bslma::Allocator            *basicAllocator);
+        // Create a size class for blocks of the specified 'blockSize'
+        // (including the header), whose pool uses the specified
+        // 'growthStrategy', 'maxBlocksPerChunk', and 'basicAllocator'.
+
+    // MANIPULATORS
+    void carveBlocks(int numBlocks, int poolIndex);
+        // Carve the specified 'numBlocks' blocks out of 'd_pool', set their
+        // headers to the specified 'poolIndex', and push them onto
+        // 'd_freeBlocks'.  The behavior is undefined unless 'd_mutex' is
+        // locked by the calling thread.
+
+    void putBlocks(void *const *blocks, int numBlocks);
+        // Push the specified 'numBlocks' blocks at the specified 'blocks' onto
+        // the stack of free blocks.  This method does not throw.
+
+    void release();
+        // Release all blocks carved out of 'd_pool'.
+
+    void reserve(int numBlocks, int poolIndex);
+        // Ensure the stack of free blocks holds at least the specified
+        // 'numBlocks' blocks, carving new blocks having the specified
+        // 'poolIndex' as needed.
+
+    int takeBlocks(void **result, int numBlocks, int poolIndex);
+        // Load into the specified 'result' up to the specified 'numBlocks'
+        // free blocks, carving new blocks having the specified 'poolIndex' if
+        // the stack of free blocks is empty, and return the number of blocks
+        // loaded, which is at least 1.
+};
+
+                   // =======================================
+                   // struct ThreadCachingAllocator_Magazine
+                   // =======================================
+
+struct ThreadCachingAllocator_Magazine {
+    // This 'struct' holds the free blocks of one size class cached by a
+    // thread.
+
+    // DATA
+    bsls::AtomicInt  d_count;                     // number of blocks held
+
+    void            *d_blocks[k_CACHE_CAPACITY];  // free blocks (stack)
+};
+
+                     // ===================================
+                     // struct ThreadCachingAllocator_Cache
+                     // ===================================
+
+struct ThreadCachingAllocator_Cache {
+    // This 'struct' holds the per-thread cache of one thread using a
+    // 'ThreadCachingAllocator'.
+
+    // DATA
+    ThreadCachingAllocator          *d_allocator_p;       // owning allocator
+                                                          // (held)
+
+    ThreadCachingAllocator_Cache    *d_next_p;            // next in list
+
+    ThreadCachingAllocator_Cache    *d_prev_p;            // previous in list
+
+    bsls::Types::Uint64              d_threadId;          // owning thread
+
+    bsls::AtomicInt64                d_numAllocations;    // statistics
+
+    bsls::AtomicInt64                d_numDeallocations;
+
+    bsls::AtomicInt64                d_numRefills;
+
+    bsls::AtomicInt64                d_numFlushes;
+
+    ThreadCachingAllocator_Magazine *d_magazines_p;       // one per pool
+                                                          // (owned)
+
+    // CLASS METHODS
+    static void destroy(void *cache);
+        // Destroy the specified 'cache', a 'ThreadCachingAllocator_Cache'
+        // whose thread is exiting.
+
+    static void increment(bsls::AtomicInt64 *counter);
+        // Increment the specified 'counter', which is modified only by the
+        // calling thread.
+
+    // ACCESSORS
+    void loadStatistics(ThreadCachingAllocator::CacheStatistics *result,
+                        int                                      numPools)
+                                                                        const;
+        // Load into the specified 'result' the statistics of this cache,
+        // having the specified 'numPools' magazines.
+};
+
+                   // ---------------------------------------
+                   // struct ThreadCachingAllocator_SizeClass
+                   // ---------------------------------------
+
+// CREATORS
+ThreadCachingAllocator_SizeClass::ThreadCachingAllocator_SizeClass(
+                               bsls::Types::size_type       blockSize,
+                               bsls::BlockGrowth::Strategy  growthStrategy,
+                               int                          maxBlocksPerChunk,
+                               bslma::Allocator            *basicAllocator)
+: d_freeBlocks(basicAllocator)
+, d_pool(blockSize, growthStrategy, maxBlocksPerChunk, basicAllocator)
+, d_numBlocks(0)
+{
+}
+
+// MANIPULATORS
+void ThreadCachingAllocator_SizeClass::carveBlocks(int numBlocks,
+                                                   int poolIndex)
+{
+    // Reserve room for every block of this size class before carving, so
+    // that blocks can later be returned without allocating.
+
+    const bsl::size_t required =
+                             static_cast<bsl::size_t>(d_numBlocks + numBlocks);
+    if (d_freeBlocks.capacity() < required) {
+        d_freeBlocks.reserve(bsl::max(required, 2 * d_freeBlocks.capacity()));
+    }
+
+    for (int i = 0; i < numBlocks; ++i) {
+        Header *h = static_cast<Header *>(d_pool.allocate());
+        h->d_poolIdx = poolIndex;
+        d_freeBlocks.push_back(h);
+        ++d_numBlocks;
+    }
+}
+
+void ThreadCachingAllocator_SizeClass::putBlocks(void *const *blocks,
+                                                 int          numBlocks)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    BSLS_ASSERT(d_freeBlocks.size() + numBlocks <= d_freeBlocks.capacity());
+
+    d_freeBlocks.insert(d_freeBlocks.end(), blocks, blocks + numBlocks);
+}
+
+void ThreadCachingAllocator_SizeClass::release()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_freeBlocks.clear();
+    d_pool.release();
+    d_numBlocks = 0;
+}
+
+void ThreadCachingAllocator_SizeClass::reserve(int numBlocks, int poolIndex)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    const int numFree = static_cast<int>(d_freeBlocks.size());
+    if (numFree < numBlocks) {
+        carveBlocks(numBlocks - numFree, poolIndex);
+    }
+}
+
+int ThreadCachingAllocator_SizeClass::takeBlocks(void **result,
+                                                 int    numBlocks,
+                                                 int    poolIndex)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_freeBlocks.empty()) {
+        carveBlocks(numBlocks, poolIndex);
+    }
+
+    const int numFree = static_cast<int>(d_freeBlocks.size());
+    const int count   = bsl::min(numBlocks, numFree);
+
+    bsl::memcpy(result,
+                d_freeBlocks.data() + (numFree - count),
+                count * sizeof *result);
+    d_freeBlocks.resize(numFree - count);
+
+    return count;
+}
+
+                     // -----------------------------------
+                     // struct ThreadCachingAllocator_Cache
+                     // -----------------------------------
+
+// CLASS METHODS
+void ThreadCachingAllocator_Cache::destroy(void *cache)
+{
+    ThreadCachingAllocator_Cache *c =
+                            static_cast<ThreadCachingAllocator_Cache *>(cache);
+
+    c->d_allocator_p->destroyThreadCache(c);
+}
+
+inline
+void ThreadCachingAllocator_Cache::increment(bsls::AtomicInt64 *counter)
+{
+    counter->storeRelaxed(counter->loadRelaxed() + 1);
+}
+
+// ACCESSORS
+void ThreadCachingAllocator_Cache::loadStatistics(
+                       ThreadCachingAllocator::CacheStatistics *result,
+                       int                                      numPools) const
+{
+    result->d_threadId         = d_threadId;
+    result->d_numAllocations   = d_numAllocations.loadRelaxed();
+    result->d_numDeallocations = d_numDeallocations.loadRelaxed();
+    result->d_numRefills       = d_numRefills.loadRelaxed();
+    result->d_numFlushes       = d_numFlushes.loadRelaxed();
+    result->d_numCachedBlocks  = 0;
+
+    for (int i = 0; i < numPools; ++i) {
+        result->d_numCachedBlocks += d_magazines_p[i].d_count.loadRelaxed();
+    }
+}
+
+                       // ----------------------------
+                       // class ThreadCachingAllocator
+                       // ----------------------------
+
+// PRIVATE MANIPULATORS
+ThreadCachingAllocator_Cache *ThreadCachingAllocator::createThreadCache()
+{
+    if (!d_hasKey) {
+        return 0;                                                     // RETURN
+    }
+
+    typedef ThreadCachingAllocator_Cache    Cache;
+    typedef ThreadCachingAllocator_Magazine Magazine;
+
+    Cache *cache = 0;
+
+    BSLS_TRY {
+        cache = static_cast<Cache *>(d_allocAdapter.allocate(sizeof *cache));
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(cache,
+                                                            &d_allocAdapter);
+
+        Magazine *magazines = static_cast<Magazine *>(
+                      d_allocAdapter.allocate(d_numPools * sizeof *magazines));
+
+        proctor.release();
+
+        new (cache) Cache();
+        cache->d_allocator_p = this;
+        cache->d_next_p      = 0;
+        cache->d_prev_p      = 0;
+        cache->d_threadId    = bslmt::ThreadUtil::selfIdAsUint64();
+        cache->d_magazines_p = magazines;
+
+        for (int i = 0; i < d_numPools; ++i) {
+            new (magazines + i) Magazine();
+        }
+    }
+    BSLS_CATCH(...) {
+        return 0;                                                     // RETURN
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_key, cache)) {
+        d_allocAdapter.deallocate(cache->d_magazines_p);
+        d_allocAdapter.deallocate(cache);
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+    cache->d_next_p = d_caches_p;
+    if (d_caches_p) {
+        d_caches_p->d_prev_p = cache;
+    }
+    d_caches_p = cache;
+
+    return cache;
+}
+
+void ThreadCachingAllocator::destroyThreadCache(
+                                           ThreadCachingAllocator_Cache *cache)
+{
+    flushCache(cache);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+        CacheStatistics stats;
+        cache->loadStatistics(&stats, d_numPools);
+
+        d_retiredStatistics.d_numAllocations   += stats.d_numAllocations;
+        d_retiredStatistics.d_numDeallocations += stats.d_numDeallocations;
+        d_retiredStatistics.d_numRefills       += stats.d_numRefills;
+        d_retiredStatistics.d_numFlushes       += stats.d_numFlushes;
+
+        if (cache->d_prev_p) {
+            cache->d_prev_p->d_next_p = cache->d_next_p;
+        }
+        else {
+            d_caches_p = cache->d_next_p;
+        }
+        if (cache->d_next_p) {
+            cache->d_next_p->d_prev_p = cache->d_prev_p;
+        }
+    }
+
+    d_allocAdapter.deallocate(cache->d_magazines_p);
+    d_allocAdapter.deallocate(cache);
+}
+
+void ThreadCachingAllocator::flushCache(ThreadCachingAllocator_Cache *cache)
+{
+    for (int i = 0; i < d_numPools; ++i) {
+        ThreadCachingAllocator_Magazine& magazine = cache->d_magazines_p[i];
+
+        const int count = magazine.d_count.loadRelaxed();
+        if (count) {
+            d_sizeClasses_p[i].putBlocks(magazine.d_blocks, count);
+            magazine.d_count.storeRelaxed(0);
+            ThreadCachingAllocator_Cache::increment(&cache->d_numFlushes);
+        }
+    }
+}
+
+void ThreadCachingAllocator::initialize(
+                                 bsls::BlockGrowth::Strategy growthStrategy,
+                                 int                         maxBlocksPerChunk)
+{
+    BSLS_ASSERT(1 <= d_numPools);
+    BSLS_ASSERT(1 <= maxBlocksPerChunk);
+
+    typedef ThreadCachingAllocator_SizeClass SizeClass;
+
+    d_caches_p = 0;
+
+    d_retiredStatistics.d_threadId         = 0;
+    d_retiredStatistics.d_numAllocations   = 0;
+    d_retiredStatistics.d_numDeallocations = 0;
+    d_retiredStatistics.d_numRefills       = 0;
+    d_retiredStatistics.d_numFlushes       = 0;
+    d_retiredStatistics.d_numCachedBlocks  = 0;
+
+    d_maxBlockSize = k_MIN_BLOCK_SIZE;
+
+    d_sizeClasses_p = static_cast<SizeClass *>(
+                d_allocAdapter.allocate(d_numPools * sizeof *d_sizeClasses_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoDeallocator(
+                                                              d_sizeClasses_p,
+                                                              &d_allocAdapter);
+    bslma::AutoDestructor<SizeClass> autoDtor(d_sizeClasses_p, 0);
+
+    for (int i = 0; i < d_numPools; ++i, ++autoDtor) {
+        new (d_sizeClasses_p + i) SizeClass(d_maxBlockSize + sizeof(Header),
+                                            growthStrategy,
+                                            maxBlocksPerChunk,
+                                            &d_allocAdapter);
+
+        BSLS_ASSERT(d_maxBlockSize <=
+                       bsl::numeric_limits<bsls::Types::size_type>::max() / 2);
+
+        d_maxBlockSize *= 2;
+    }
+
+    d_maxBlockSize /= 2;
+
+    d_hasKey = 0 == bslmt::ThreadUtil::createKey(
+                                   &d_key,
+                                   &bdlma_ThreadCachingAllocator_destroyCache);
+
+    autoDtor.release();
+    autoDeallocator.release();
+}
+
+inline
+ThreadCachingAllocator_Cache *ThreadCachingAllocator::threadCache()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_hasKey)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    void *cache = bslmt::ThreadUtil::getSpecific(d_key);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(cache)) {
+        return static_cast<ThreadCachingAllocator_Cache *>(cache);    // RETURN
+    }
+
+    return createThreadCache();
+}
+
+// PRIVATE ACCESSORS
+inline
+int ThreadCachingAllocator::findPool(bsls::Types::size_type size) const
+{
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(static_cast<bsl::uint32_t>(
+                                ((size + k_MIN_BLOCK_SIZE - 1) >> 3) * 2 - 1));
+}
+
+// CREATORS
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_hasKey(false)
+, d_numPools(k_DEFAULT_NUM_POOLS)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(bsls::BlockGrowth::BSLS_GEOMETRIC, k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_hasKey(false)
+, d_numPools(numPools)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(bsls::BlockGrowth::BSLS_GEOMETRIC, k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                int                          numPools,
+                                bsls::BlockGrowth::Strategy  growthStrategy,
+                                int                          maxBlocksPerChunk,
+                                bslma::Allocator            *basicAllocator)
+: d_hasKey(false)
+, d_numPools(numPools)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(growthStrategy, maxBlocksPerChunk);
+}
+
+ThreadCachingAllocator::~ThreadCachingAllocator()
+{
+    if (d_hasKey) {
+        // Disassociate the calling thread from its cache, and prevent the
+        // caches of other threads from being destroyed when they exit.
+
+        bslmt::ThreadUtil::setSpecific(d_key, 0);
+        bslmt::ThreadUtil::deleteKey(d_key);
+    }
+
+    while (d_caches_p) {
+        ThreadCachingAllocator_Cache *cache = d_caches_p;
+        d_caches_p = cache->d_next_p;
+
+        d_allocAdapter.deallocate(cache->d_magazines_p);
+        d_allocAdapter.deallocate(cache);
+    }
+
+    for (int i = 0; i < d_numPools; ++i) {
+        d_sizeClasses_p[i].~ThreadCachingAllocator_SizeClass();
+    }
+    d_allocAdapter.deallocate(d_sizeClasses_p);
+
+    d_blockList.release();
+}
+
+// MANIPULATORS
+void *ThreadCachingAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (size <= d_maxBlockSize) {
+        const int                     pool  = findPool(size);
+        ThreadCachingAllocator_Cache *cache = threadCache();
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            void *block;
+            d_sizeClasses_p[pool].takeBlocks(&block, 1, pool);
+            return static_cast<Header *>(block) + 1;                  // RETURN
+        }
+
+        ThreadCachingAllocator_Magazine& magazine =
+                                                   cache->d_magazines_p[pool];
+
+        int count = magazine.d_count.loadRelaxed();
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == count)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            count = d_sizeClasses_p[pool].takeBlocks(magazine.d_blocks,
+                                                     k_BATCH_SIZE,
+                                                     pool);
+            ThreadCachingAllocator_Cache::increment(&cache->d_numRefills);
+        }
+
+        --count;
+        magazine.d_count.storeRelaxed(count);
+        ThreadCachingAllocator_Cache::increment(&cache->d_numAllocations);
+
+        return static_cast<Header *>(magazine.d_blocks[count]) + 1;   // RETURN
+    }
+
+    // The requested size is large and will not be pooled.
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Header *p = static_cast<Header *>(
+                                 d_blockList.allocate(size + sizeof(Header)));
+
+    p->d_poolIdx = -1;
+
+    return p + 1;
+}
+
+void ThreadCachingAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header *h = static_cast<Header *>(address) - 1;
+
+    const int pool = h->d_poolIdx;
+
+    if (-1 == pool) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_blockList.deallocate(h);
+        return;                                                       // RETURN
+    }
+
+    ThreadCachingAllocator_Cache *cache = threadCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        void *block = h;
+        d_sizeClasses_p[pool].putBlocks(&block, 1);
+        return;                                                       // RETURN
+    }
+
+    ThreadCachingAllocator_Magazine& magazine = cache->d_magazines_p[pool];
+
+    int count = magazine.d_count.loadRelaxed();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(k_CACHE_CAPACITY == count)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Return the least recently cached blocks to the shared stack.
+
+        d_sizeClasses_p[pool].putBlocks(magazine.d_blocks, k_BATCH_SIZE);
+        count -= k_BATCH_SIZE;
+        bsl::memmove(magazine.d_blocks,
+                     magazine.d_blocks + k_BATCH_SIZE,
+                     count * sizeof *magazine.d_blocks);
+        ThreadCachingAllocator_Cache::increment(&cache->d_numFlushes);
+    }
+
+    magazine.d_blocks[count] = h;
+    magazine.d_count.storeRelaxed(count + 1);
+    ThreadCachingAllocator_Cache::increment(&cache->d_numDeallocations);
+}
+
+void ThreadCachingAllocator::flushThreadCache()
+{
+    if (!d_hasKey) {
+        return;                                                       // RETURN
+    }
+
+    void *cache = bslmt::ThreadUtil::getSpecific(d_key);
+    if (cache) {
+        flushCache(static_cast<ThreadCachingAllocator_Cache *>(cache));
+    }
+}
+
+void ThreadCachingAllocator::release()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+        for (ThreadCachingAllocator_Cache *cache = d_caches_p;
+             cache;
+             cache = cache->d_next_p) {
+            for (int i = 0; i < d_numPools; ++i) {
+                cache->d_magazines_p[i].d_count.storeRelaxed(0);
+            }
+        }
+    }
+
+    for (int i = 0; i < d_numPools; ++i) {
+        d_sizeClasses_p[i].release();
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_blockList.release();
+}
+
+void ThreadCachingAllocator::reserveCapacity(bsls::Types::size_type size,
+                                             int                    numBlocks)
+{
+    BSLS_ASSERT(size <= d_maxBlockSize);
+    BSLS_ASSERT(0 <= numBlocks);
+
+    if (0 == size) {
+        return;                                                       // RETURN
+    }
+
+    const int pool = findPool(size);
+    d_sizeClasses_p[pool].reserve(numBlocks, pool);
+}
+
+// ACCESSORS
+void ThreadCachingAllocator::loadCacheStatistics(
+                                   bsl::vector<CacheStatistics> *result) const
+{
+    BSLS_ASSERT(result);
+
+    result->clear();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+    for (const ThreadCachingAllocator_Cache *cache = d_caches_p;
+         cache;
+         cache = cache->d_next_p) {
+        CacheStatistics stats;
+        cache->loadStatistics(&stats, d_numPools);
+        result->push_back(stats);
+    }
+}
+
+ThreadCachingAllocator::CacheStatistics
+ThreadCachingAllocator::retiredCacheStatistics() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+    return d_retiredStatistics;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+extern "C" {
+
+static void bdlma_ThreadCachingAllocator_destroyCache(void *cache)
+{
+    BloombergLP::bdlma::ThreadCachingAllocator_Cache::destroy(cache);
+}
+
+}  // extern "C"
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
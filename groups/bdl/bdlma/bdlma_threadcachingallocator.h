@@ -0,0 +1,438 @@
+// bdlma_threadcachingallocator.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADCACHINGALLOCATOR
+#define INCLUDED_BDLMA_THREADCACHINGALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe pooling allocator with per-thread caches.
+//
+//@CLASSES:
+//  bdlma::ThreadCachingAllocator: multipool allocator with per-thread caches
+//
+//@SEE_ALSO: bdlma_concurrentmultipoolallocator, bdlma_pool
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bdlma::ThreadCachingAllocator', that implements the
+// 'bdlma::ManagedAllocator' protocol and, like
+// 'bdlma::ConcurrentMultipoolAllocator', dispenses memory blocks from a
+// configurable number of pools, each managing blocks of a unique size.  Unlike
+// 'bdlma::ConcurrentMultipoolAllocator', whose pools are shared by all threads
+// through a lock-free free list per block size, a
+// 'bdlma::ThreadCachingAllocator' places a small cache of free blocks of each
+// size in front of the shared pools for each thread that uses it:
+//..
+//   thread 1              thread 2              thread N
+//  ,-------------.       ,-------------.       ,-------------.
+//  | 8 16 ... 4k |       | 8 16 ... 4k |  ...  | 8 16 ... 4k |  per-thread
+//  `-------------'       `-------------'       `-------------'  caches
+//         |  ^                  |  ^                  |  ^
+//   refill|  |flush             |  |                  |  |      batches of
+//         V  |                  V  |                  V  |      blocks
+//  ,-------------------------------------------------------.
+//  |   8   |   16   |   32   |  ...  |  2k   |     4k      |    shared pools
+//  `-------------------------------------------------------'
+//..
+// An allocation request of a pooled size is satisfied from the calling
+// thread's cache without any synchronization.  When that cache holds no block
+// of the requested size, it is refilled with a batch of blocks taken from (or
+// newly carved out by) the shared pool for that size, under a single lock
+// acquisition.  Symmetrically, a deallocated block is placed in the cache of
+// the calling thread (which need not be the thread that allocated it), and
+// when that cache is full, a batch of blocks is returned to the shared pool.
+// Therefore, in the steady state, threads that allocate and deallocate memory
+// concurrently do not contend on shared cache lines.  Requests for blocks
+// larger than the largest pooled block size are satisfied directly from the
+// underlying allocator, under a lock.
+//
+// A thread's cache is created the first time the thread allocates or
+// deallocates memory using the allocator.  When the thread exits, the blocks
+// held in its cache are returned to the shared pools, and the cache itself is
+// destroyed.  Both the 'release' method and the destructor of a
+// 'bdlma::ThreadCachingAllocator' release all memory currently allocated via
+// the object, including the blocks held in per-thread caches.
+//
+// Each 'bdlma::ThreadCachingAllocator' object consumes one thread-specific
+// storage key of the process (see 'bslmt::ThreadUtil::createKey') for its
+// lifetime.  The allocator is therefore intended for long-lived, shared
+// instances (e.g., one installed as the default allocator), rather than for
+// large numbers of short-lived instances.  If no key is available when the
+// allocator is created, the allocator operates correctly, but without
+// per-thread caches.
+//
+///Configuration at Construction
+///-----------------------------
+// When creating a 'bdlma::ThreadCachingAllocator', clients can optionally
+// configure:
+//
+//: 1 NUMBER OF POOLS -- the number of pools (the block size managed by the
+//:   first pool is eight bytes, with each successive pool managing blocks of a
+//:   size twice that of the previous pool).
+//:
+//: 2 GROWTH STRATEGY -- geometrically growing chunk size starting from 1 (in
+//:   terms of the number of memory blocks per chunk), or fixed chunk size,
+//:   used by the shared pools to obtain memory from the underlying allocator.
+//:
+//: 3 MAX BLOCKS PER CHUNK -- the maximum number of memory blocks within a
+//:   chunk obtained by a shared pool from the underlying allocator.
+//:
+//: 4 BASIC ALLOCATOR -- the allocator used to supply memory.
+//
+// If not specified, the allocator manages 10 pools (i.e., pools managing
+// blocks of up to 4096 bytes), with geometric growth and at most 32 blocks
+// per chunk.
+//
+///Cache Statistics
+///----------------
+// The 'loadCacheStatistics' method loads a 'CacheStatistics' object for the
+// cache of each thread currently using the allocator, and the
+// 'retiredCacheStatistics' method returns the accumulated statistics of the
+// caches of threads that have exited.  The statistics of a cache include the
+// number of pooled allocations and deallocations performed by its thread, the
+// number of times the cache was refilled from, or flushed to, the shared
+// pools, and the number of blocks it currently holds.  A high ratio of refills
+// and flushes to allocations indicates that a thread predominantly frees
+// memory allocated by other threads (or vice versa).  Statistics are
+// maintained without synchronization, and a snapshot taken while threads are
+// using the allocator is therefore approximate.
+//
+///Thread Safety
+///-------------
+// 'bdlma::ThreadCachingAllocator' is *fully thread-safe*, meaning any
+// operation on the same object can be safely invoked from any thread, with the
+// exception of 'release', which must not be called while other threads are
+// using the allocator.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Installing a Thread-Caching Default Allocator
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a server in which many worker threads concurrently
+// create and destroy small objects using the default allocator, and that
+// profiling shows contention in the allocator.  We install a
+// 'bdlma::ThreadCachingAllocator' as the default allocator at the start of
+// 'main', before any threads are created.
+//
+// First, we create the allocator, which must outlive all uses of the default
+// allocator, and install it.  Note that the allocator is supplied an explicit
+// underlying allocator, as using the default allocator would prevent the
+// default allocator from being changed:
+//..
+//  static bdlma::ThreadCachingAllocator allocator(
+//                                  &bslma::NewDeleteAllocator::singleton());
+//
+//  int rc = bslma::Default::setDefaultAllocator(&allocator);
+//  assert(0 == rc);
+//..
+// Then, we define a function run by each worker thread, which builds strings
+// using the default allocator:
+//..
+//  extern "C" void *workerFunction(void *)
+//  {
+//      for (int i = 0; i < 1000; ++i) {
+//          bsl::string s("a string that is too long for the short buffer");
+//          s.append(s);
+//      }
+//      return 0;
+//  }
+//..
+// Next, we run several workers concurrently:
+//..
+//  enum { k_NUM_THREADS = 4 };
+//
+//  bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      rc = bslmt::ThreadUtil::create(&handles[i],
+//                                     workerFunction,
+//                                     0);
+//      assert(0 == rc);
+//  }
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      rc = bslmt::ThreadUtil::join(handles[i]);
+//      assert(0 == rc);
+//  }
+//..
+// Finally, we inspect the statistics of the caches of the workers, which have
+// exited.  Every allocation made by the workers was matched by a
+// deallocation, and the blocks held in their caches were returned to the
+// shared pools:
+//..
+//  bdlma::ThreadCachingAllocator::CacheStatistics stats =
+//                                          allocator.retiredCacheStatistics();
+//
+//  assert(k_NUM_THREADS * 2000 <= stats.d_numAllocations);
+//  assert(stats.d_numAllocations == stats.d_numDeallocations);
+//  assert(0                      == stats.d_numCachedBlocks);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_blocklist.h>
+#include <bdlma_concurrentallocatoradapter.h>
+#include <bdlma_managedallocator.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_blockgrowth.h>
+#include <bsls_types.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+struct ThreadCachingAllocator_Cache;
+struct ThreadCachingAllocator_SizeClass;
+
+                       // ============================
+                       // class ThreadCachingAllocator
+                       // ============================
+
+class ThreadCachingAllocator : public ManagedAllocator {
+    // This class implements the 'bdlma::ManagedAllocator' protocol to provide
+    // a thread-safe allocator that dispenses memory blocks of pooled sizes
+    // from per-thread caches, which are refilled from, and flushed to, shared
+    // pools in batches.
+
+  public:
+    // PUBLIC TYPES
+    struct CacheStatistics {
+        // This 'struct' provides the statistics of one or more per-thread
+        // caches.
+
+        bsls::Types::Uint64 d_threadId;          // id of the thread owning
+                                                 // the cache (see
+                                                 // 'bslmt::ThreadUtil::
+                                                 // selfIdAsUint64'); 0 for
+                                                 // accumulated statistics
+
+        bsls::Types::Int64  d_numAllocations;    // pooled allocations
+
+        bsls::Types::Int64  d_numDeallocations;  // pooled deallocations
+
+        bsls::Types::Int64  d_numRefills;        // batches taken from the
+                                                 // shared pools
+
+        bsls::Types::Int64  d_numFlushes;        // batches returned to the
+                                                 // shared pools
+
+        bsls::Types::Int64  d_numCachedBlocks;   // blocks currently cached
+    };
+
+  private:
+    // DATA
+    bslmt::ThreadUtil::Key        d_key;             // thread-specific key
+                                                     // for per-thread caches
+
+    bool                          d_hasKey;          // 'true' if 'd_key' was
+                                                     // created
+
+    int                           d_numPools;        // number of pools
+
+    bsls::Types::size_type        d_maxBlockSize;    // largest pooled block
+                                                     // size
+
+    ThreadCachingAllocator_SizeClass
+                                 *d_sizeClasses_p;   // array of shared pools,
+                                                     // one per block size
+
+    ThreadCachingAllocator_Cache *d_caches_p;        // list of the caches of
+                                                     // live threads
+
+    CacheStatistics               d_retiredStatistics;
+                                                     // accumulated statistics
+                                                     // of destroyed caches
+
+    mutable bslmt::Mutex          d_cachesMutex;     // protects 'd_caches_p'
+                                                     // and
+                                                     // 'd_retiredStatistics'
+
+    bdlma::BlockList              d_blockList;       // memory manager for
+                                                     // "large" memory blocks
+
+    bslmt::Mutex                  d_mutex;           // protects 'd_blockList'
+                                                     // and the underlying
+                                                     // allocator
+
+    ConcurrentAllocatorAdapter    d_allocAdapter;    // thread-safe adapter
+
+    // FRIENDS
+    friend struct ThreadCachingAllocator_Cache;
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingAllocator(const ThreadCachingAllocator&);
+    ThreadCachingAllocator& operator=(const ThreadCachingAllocator&);
+
+    // PRIVATE MANIPULATORS
+    ThreadCachingAllocator_Cache *createThreadCache();
+        // Create a cache for the calling thread, associate it with the calling
+        // thread, and return its address.  Return 0, and create no cache, if
+        // this allocator does not use per-thread caches, or if memory for the
+        // cache cannot be obtained or the cache cannot be associated with the
+        // calling thread.  Note that this method does not throw.
+
+    void destroyThreadCache(ThreadCachingAllocator_Cache *cache);
+        // Return the blocks held in the specified 'cache' to the shared pools,
+        // add the statistics of 'cache' to the retired statistics of this
+        // allocator, and destroy 'cache'.
+
+    void flushCache(ThreadCachingAllocator_Cache *cache);
+        // Return all of the blocks held in the specified 'cache' to the shared
+        // pools.
+
+    void initialize(bsls::BlockGrowth::Strategy growthStrategy,
+                    int                         maxBlocksPerChunk);
+        // Create the shared pools of this allocator, using the specified
+        // 'growthStrategy' and 'maxBlocksPerChunk', and the thread-specific
+        // key used for per-thread caches.
+
+    ThreadCachingAllocator_Cache *threadCache();
+        // Return the address of the cache of the calling thread, creating it
+        // if needed, or 0 if this allocator does not use per-thread caches.
+
+    // PRIVATE ACCESSORS
+    int findPool(bsls::Types::size_type size) const;
+        // Return the index of the pool managing blocks of the smallest size
+        // not less than the specified 'size'.  The behavior is undefined
+        // unless '0 < size <= maxPooledBlockSize()'.
+
+  public:
+    // CREATORS
+    explicit ThreadCachingAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit ThreadCachingAllocator(int               numPools,
+                                    bslma::Allocator *basicAllocator = 0);
+    ThreadCachingAllocator(int                          numPools,
+                           bsls::BlockGrowth::Strategy  growthStrategy,
+                           int                          maxBlocksPerChunk,
+                           bslma::Allocator            *basicAllocator = 0);
+        // Create a thread-caching allocator.  Optionally specify 'numPools',
+        // indicating the number of pools, the first managing blocks of 8
+        // bytes, and each successive pool managing blocks of a size twice that
+        // of the previous pool.  If 'numPools' is not specified, 10 pools are
+        // used.  Optionally specify a 'growthStrategy' and
+        // 'maxBlocksPerChunk' used by each pool to obtain memory from the
+        // underlying allocator.  If 'growthStrategy' and 'maxBlocksPerChunk'
+        // are not specified, geometric growth and 32 blocks per chunk are
+        // used.  Optionally specify a 'basicAllocator' used to supply memory.
+        // If 'basicAllocator' is 0, the currently installed default allocator
+        // is used.  The behavior is undefined unless '1 <= numPools' and
+        // '1 <= maxBlocksPerChunk'.
+
+    virtual ~ThreadCachingAllocator();
+        // Destroy this allocator.  All memory allocated from this allocator is
+        // released.  The behavior is undefined unless no other thread is using
+        // this allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  If
+        // 'size <= maxPooledBlockSize()', the block is taken from the cache
+        // of the calling thread, which is refilled from the shared pool for
+        // blocks of that size if needed.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to this
+        // allocator.  If 'address' is 0, this function has no effect.  A
+        // pooled block is placed in the cache of the calling thread, a batch
+        // of blocks being returned to the shared pool for blocks of that size
+        // if that cache is full.  The behavior is undefined unless 'address'
+        // was allocated using this allocator object and has not already been
+        // deallocated.
+
+    void flushThreadCache();
+        // Return all of the blocks held in the cache of the calling thread to
+        // the shared pools.  This method can be used to make those blocks
+        // available to other threads, e.g., before the calling thread becomes
+        // idle for an extended period.
+
+    virtual void release();
+        // Release all memory currently allocated through this allocator,
+        // including the blocks held in per-thread caches.  The behavior is
+        // undefined unless no other thread is using this allocator.
+
+    void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+        // Reserve memory from this allocator to satisfy memory requests for
+        // at least the specified 'numBlocks' having the specified 'size' (in
+        // bytes) before the shared pool for blocks of that size replenishes.
+        // If 'size' is 0, this method has no effect.  The behavior is
+        // undefined unless 'size <= maxPooledBlockSize()' and
+        // '0 <= numBlocks'.
+
+    // ACCESSORS
+    void loadCacheStatistics(bsl::vector<CacheStatistics> *result) const;
+        // Load into the specified 'result' the statistics of the cache of each
+        // thread currently using this allocator, in an unspecified order.
+
+    bsls::Types::size_type maxPooledBlockSize() const;
+        // Return the maximum size of memory blocks that are pooled by this
+        // allocator.
+
+    int numPools() const;
+        // Return the number of pools managed by this allocator.
+
+    CacheStatistics retiredCacheStatistics() const;
+        // Return the accumulated statistics of the caches of the threads that
+        // have used this allocator and exited.  The 'd_threadId' and
+        // 'd_numCachedBlocks' members of the returned object are 0.
+
+    bool usesThreadCaches() const;
+        // Return 'true' if this allocator uses per-thread caches, and 'false'
+        // otherwise (i.e., if no thread-specific storage key was available
+        // when this allocator was created).
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // class ThreadCachingAllocator
+                       // ----------------------------
+
+// ACCESSORS
+inline
+bsls::Types::size_type ThreadCachingAllocator::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+inline
+int ThreadCachingAllocator::numPools() const
+{
+    return d_numPools;
+}
+
+inline
+bool ThreadCachingAllocator::usesThreadCaches() const
+{
+    return d_hasKey;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
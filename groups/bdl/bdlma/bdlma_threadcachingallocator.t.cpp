@@ -0,0 +1,1132 @@
+// bdlma_threadcachingallocator.t.cpp                                 -*-C++-*-
+#include <bdlma_threadcachingallocator.h>
+
+#include <bdlma_concurrentmultipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>     // 'memset'
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlma::ThreadCachingAllocator' is a thread-safe managed allocator whose
+// pooled blocks circulate between per-thread caches and shared pools.  We
+// verify that blocks are maximally aligned and distinct, that freed blocks are
+// reused by the freeing thread, that blocks may be freed by a thread other
+// than the allocating one, that caches are flushed when their threads exit,
+// that the reported statistics are consistent, and that 'release' and the
+// destructor return all memory to the underlying allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingAllocator(Allocator *ba = 0);
+// [ 2] ThreadCachingAllocator(int numPools, Allocator *ba = 0);
+// [ 2] ThreadCachingAllocator(int, Strategy, int, Allocator *ba = 0);
+// [ 2] ~ThreadCachingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void flushThreadCache();
+// [ 6] void release();
+// [ 6] void reserveCapacity(size_type size, int numBlocks);
+//
+// ACCESSORS
+// [ 4] void loadCacheStatistics(bsl::vector<CacheStatistics> *) const;
+// [ 2] size_type maxPooledBlockSize() const;
+// [ 2] int numPools() const;
+// [ 5] CacheStatistics retiredCacheStatistics() const;
+// [ 2] bool usesThreadCaches() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: MULTI-THREADED SCALING
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::ThreadCachingAllocator  Obj;
+typedef Obj::CacheStatistics           Stats;
+typedef bsls::Types::size_type         size_type;
+typedef bsls::Types::Uint64            Uint64;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                     HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool isMaxAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address) % MAX_ALIGN;
+}
+
+static const Stats *findStats(const bsl::vector<Stats>& stats, Uint64 id)
+    // Return the address of the element of the specified 'stats' for the
+    // thread having the specified 'id', or 0 if there is no such element.
+{
+    for (bsl::size_t i = 0; i < stats.size(); ++i) {
+        if (id == stats[i].d_threadId) {
+            return &stats[i];                                         // RETURN
+        }
+    }
+    return 0;
+}
+
+                        // =========================
+                        // CONCURRENCY TEST (CASE 5)
+                        // =========================
+
+namespace case5 {
+
+enum {
+    k_NUM_THREADS    = 4,
+    k_NUM_BLOCKS     = 500,
+    k_NUM_ITERATIONS = 20
+};
+
+struct Control {
+    Obj                   *d_allocator_p;
+    bslmt::Barrier        *d_barrier_p;
+    bsl::vector<char *>    d_blocks[k_NUM_THREADS];
+};
+
+struct ThreadArg {
+    Control *d_control_p;
+    int      d_index;
+};
+
+static size_type blockSize(int i)
+    // Return the size of the block at the specified index 'i' of a batch.
+{
+    return 1 + (i * 37) % 600;
+}
+
+extern "C" void *workerThread(void *arg)
+    // Repeatedly allocate a batch of blocks, tag each with the index of the
+    // calling thread, and then verify and deallocate the batch allocated by
+    // the next thread, as described by the specified 'arg'.
+{
+    ThreadArg *threadArg = static_cast<ThreadArg *>(arg);
+    Control   *control   = threadArg->d_control_p;
+    const int  index     = threadArg->d_index;
+    const int  next      = (index + 1) % k_NUM_THREADS;
+
+    bsl::vector<char *>& mine   = control->d_blocks[index];
+    bsl::vector<char *>& theirs = control->d_blocks[next];
+
+    for (int iteration = 0; iteration < k_NUM_ITERATIONS; ++iteration) {
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            const size_type size = blockSize(i);
+
+            char *p = static_cast<char *>(
+                                       control->d_allocator_p->allocate(size));
+            ASSERTV(index, i, isMaxAligned(p));
+            bsl::memset(p, 'a' + index, size);
+            mine[i] = p;
+        }
+
+        control->d_barrier_p->wait();
+
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            const size_type size = blockSize(i);
+
+            char *p = theirs[i];
+            ASSERTV(index, i, 'a' + next == p[0]);
+            ASSERTV(index, i, 'a' + next == p[size - 1]);
+            control->d_allocator_p->deallocate(p);
+        }
+
+        control->d_barrier_p->wait();
+    }
+
+    return 0;
+}
+
+}  // close namespace case5
+
+                         // ===========================
+                         // PERFORMANCE TEST (CASE -1)
+                         // ===========================
+
+namespace caseMinus1 {
+
+enum { k_BATCH = 64 };
+
+struct Control {
+    bslma::Allocator *d_allocator_p;
+    bslmt::Barrier   *d_barrier_p;
+    int               d_iterations;
+};
+
+extern "C" void *benchThread(void *arg)
+    // Repeatedly allocate and deallocate batches of blocks of assorted small
+    // sizes using the allocator described by the specified 'arg'.
+{
+    Control *control = static_cast<Control *>(arg);
+
+    bslma::Allocator *allocator = control->d_allocator_p;
+    void             *blocks[k_BATCH];
+
+    control->d_barrier_p->wait();
+
+    for (int iteration = 0; iteration < control->d_iterations; ++iteration) {
+        for (int i = 0; i < k_BATCH; ++i) {
+            blocks[i] = allocator->allocate(8 + (i * 24) % 256);
+            *static_cast<char *>(blocks[i]) = static_cast<char>(i);
+        }
+        for (int i = 0; i < k_BATCH; ++i) {
+            allocator->deallocate(blocks[i]);
+        }
+    }
+
+    return 0;
+}
+
+static double run(bslma::Allocator *allocator,
+                  int               numThreads,
+                  int               iterations)
+    // Return the elapsed time (in seconds) for the specified 'numThreads'
+    // threads to each perform the specified 'iterations' batches of
+    // allocations and deallocations using the specified 'allocator'.
+{
+    bslmt::Barrier barrier(numThreads + 1);
+
+    Control control;
+    control.d_allocator_p = allocator;
+    control.d_barrier_p   = &barrier;
+    control.d_iterations  = iterations;
+
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        int rc = bslmt::ThreadUtil::create(&handles[i], benchThread, &control);
+        ASSERTV(rc, 0 == rc);
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    barrier.wait();
+
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close namespace caseMinus1
+
+// ============================================================================
+//                             USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Installing a Thread-Caching Default Allocator
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a server in which many worker threads concurrently
+// create and destroy small objects using the default allocator, and that
+// profiling shows contention in the allocator.  We install a
+// 'bdlma::ThreadCachingAllocator' as the default allocator at the start of
+// 'main', before any threads are created.
+//
+// Then, we define a function run by each worker thread, which builds strings
+// using the default allocator:
+//..
+    extern "C" void *workerFunction(void *)
+    {
+        for (int i = 0; i < 1000; ++i) {
+            bsl::string s("a string that is too long for the short buffer");
+            s.append(s);
+        }
+        return 0;
+    }
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // Note that the default allocator is not installed here, as the usage
+    // example installs a 'bdlma::ThreadCachingAllocator' as the default.
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// First, we create the allocator, which must outlive all uses of the default
+// allocator, and install it.  Note that the allocator is supplied an explicit
+// underlying allocator, as using the default allocator would prevent the
+// default allocator from being changed:
+//..
+    static bdlma::ThreadCachingAllocator allocator(
+                                    &bslma::NewDeleteAllocator::singleton());
+
+    int rc = bslma::Default::setDefaultAllocator(&allocator);
+    ASSERT(0 == rc);
+//..
+// Next, we run several workers concurrently:
+//..
+    enum { k_NUM_THREADS = 4 };
+
+    bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        rc = bslmt::ThreadUtil::create(&handles[i],
+                                       usage::workerFunction,
+                                       0);
+        ASSERT(0 == rc);
+    }
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        rc = bslmt::ThreadUtil::join(handles[i]);
+        ASSERT(0 == rc);
+    }
+//..
+// Finally, we inspect the statistics of the caches of the workers, which have
+// exited.  Every allocation made by the workers was matched by a
+// deallocation, and the blocks held in their caches were returned to the
+// shared pools:
+//..
+    bdlma::ThreadCachingAllocator::CacheStatistics stats =
+                                          allocator.retiredCacheStatistics();
+
+    ASSERT(k_NUM_THREADS * 2000 <= stats.d_numAllocations);
+    ASSERT(stats.d_numAllocations == stats.d_numDeallocations);
+    ASSERT(0                      == stats.d_numCachedBlocks);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'release' AND 'reserveCapacity'
+        //
+        // Concerns:
+        //: 1 'release' returns all pooled and large blocks, including blocks
+        //:   held in per-thread caches, to the underlying allocator.
+        //:
+        //: 2 The allocator is usable after 'release', and the caches of
+        //:   existing threads remain usable.
+        //:
+        //: 3 After 'reserveCapacity(size, n)', 'n' blocks of 'size' can be
+        //:   allocated without requesting memory from the underlying
+        //:   allocator.
+        //:
+        //: 4 'reserveCapacity' with a 'size' of 0 has no effect.
+        //
+        // Plan:
+        //: 1 Allocate pooled and large blocks, some of which are deallocated
+        //:   into the cache of the calling thread, and call 'release'.  Verify
+        //:   that the number of blocks in use by the underlying test
+        //:   allocator drops to the number held before any block was
+        //:   allocated, plus the cache of the calling thread, and that the
+        //:   cache holds no blocks.  (C-1)
+        //:
+        //: 2 Allocate and deallocate again after 'release'.  (C-2)
+        //:
+        //: 3 Call 'reserveCapacity', then allocate the reserved blocks, and
+        //:   verify that the underlying test allocator was not used.  (C-3..4)
+        //
+        // Testing:
+        //   void release();
+        //   void reserveCapacity(size_type size, int numBlocks);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'release' AND 'reserveCapacity'" << endl
+                          << "===============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const bsls::Types::Int64 INITIAL = ta.numBlocksInUse();
+
+            // Create the cache of this thread.
+
+            mX.deallocate(mX.allocate(1));
+
+            const bsls::Types::Int64 WITH_CACHE = ta.numBlocksInUse();
+            ASSERTV(INITIAL, WITH_CACHE, INITIAL < WITH_CACHE);
+
+            bsl::vector<void *> blocks;
+            for (int i = 0; i < 300; ++i) {
+                blocks.push_back(mX.allocate(1 + i % 100));
+            }
+            blocks.push_back(mX.allocate(X.maxPooledBlockSize() + 1));
+            blocks.push_back(mX.allocate(10000));
+
+            for (int i = 0; i < 100; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            ASSERT(WITH_CACHE < ta.numBlocksInUse());
+
+            if (veryVerbose) cout << "\tTesting 'release'." << endl;
+
+            mX.release();
+
+            // The shared stacks retain their capacity.
+
+            bsl::vector<Stats> stats;
+            X.loadCacheStatistics(&stats);
+            ASSERTV(stats.size(), 1 == stats.size());
+            ASSERTV(stats[0].d_numCachedBlocks,
+                    0 == stats[0].d_numCachedBlocks);
+
+            const bsls::Types::Int64 RELEASED = ta.numBlocksInUse();
+
+            for (int i = 0; i < 10; ++i) {
+                void *p = mX.allocate(16);
+                ASSERT(isMaxAligned(p));
+                bsl::memset(p, 0xA5, 16);
+                mX.deallocate(p);
+            }
+            mX.release();
+            ASSERTV(RELEASED, ta.numBlocksInUse(),
+                    RELEASED == ta.numBlocksInUse());
+
+            if (veryVerbose) cout << "\tTesting 'reserveCapacity'." << endl;
+
+            mX.reserveCapacity(0, 100);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            mX.reserveCapacity(100, 100);
+            ASSERT(NUM_ALLOCATIONS < ta.numAllocations());
+
+            const bsls::Types::Int64 RESERVED = ta.numAllocations();
+
+            blocks.clear();
+            for (int i = 0; i < 100; ++i) {
+                blocks.push_back(mX.allocate(100));
+            }
+            ASSERTV(RESERVED, ta.numAllocations(),
+                    RESERVED == ta.numAllocations());
+
+            for (int i = 0; i < 100; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Threads concurrently allocating and deallocating receive distinct
+        //:   blocks.
+        //:
+        //: 2 A block may be deallocated by a thread other than the one that
+        //:   allocated it.
+        //:
+        //: 3 When a thread exits, its cache is destroyed, its blocks are
+        //:   returned to the shared pools, and its statistics are added to the
+        //:   retired statistics.
+        //:
+        //: 4 All memory is returned to the underlying allocator when the
+        //:   allocator is destroyed.
+        //
+        // Plan:
+        //: 1 Run several threads, each of which repeatedly allocates a batch
+        //:   of blocks of assorted sizes, fills each block with a pattern
+        //:   identifying the thread, and, after all threads have done so,
+        //:   verifies and deallocates the batch of the next thread.  (C-1..2)
+        //:
+        //: 2 After joining the threads, verify that the retired statistics
+        //:   account for all of their allocations and deallocations, that no
+        //:   cache of an exited thread remains, and that the number of refills
+        //:   and flushes is non-zero.  (C-3)
+        //:
+        //: 3 Destroy the allocator and verify that the underlying test
+        //:   allocator has no blocks in use.  (C-4)
+        //
+        // Testing:
+        //   CacheStatistics retiredCacheStatistics() const;
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        using namespace case5;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(X.usesThreadCaches());
+
+            bslmt::Barrier barrier(k_NUM_THREADS);
+
+            Control control;
+            control.d_allocator_p = &mX;
+            control.d_barrier_p   = &barrier;
+
+            ThreadArg                 args[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                control.d_blocks[i].resize(k_NUM_BLOCKS);
+                args[i].d_control_p = &control;
+                args[i].d_index     = i;
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                int rc = bslmt::ThreadUtil::create(&handles[i],
+                                                   workerThread,
+                                                   &args[i]);
+                ASSERTV(i, rc, 0 == rc);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                int rc = bslmt::ThreadUtil::join(handles[i]);
+                ASSERTV(i, rc, 0 == rc);
+            }
+
+            bsl::vector<Stats> live;
+            X.loadCacheStatistics(&live);
+            ASSERTV(live.size(), live.empty());
+
+            const Stats             RETIRED = X.retiredCacheStatistics();
+            const bsls::Types::Int64 TOTAL  =
+                                   k_NUM_THREADS * k_NUM_BLOCKS *
+                                   static_cast<int>(k_NUM_ITERATIONS);
+
+            if (veryVerbose) {
+                P_(RETIRED.d_numAllocations);
+                P_(RETIRED.d_numDeallocations);
+                P_(RETIRED.d_numRefills);
+                P(RETIRED.d_numFlushes);
+            }
+
+            ASSERTV(RETIRED.d_threadId, 0 == RETIRED.d_threadId);
+            ASSERTV(RETIRED.d_numAllocations,
+                    TOTAL == RETIRED.d_numAllocations);
+            ASSERTV(RETIRED.d_numDeallocations,
+                    TOTAL == RETIRED.d_numDeallocations);
+            ASSERTV(RETIRED.d_numCachedBlocks,
+                    0 == RETIRED.d_numCachedBlocks);
+            ASSERT(0 < RETIRED.d_numRefills);
+            ASSERT(0 < RETIRED.d_numFlushes);
+
+            // The blocks returned by the exited threads are reused.
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                control.d_blocks[0][i] = static_cast<char *>(
+                                                  mX.allocate(blockSize(i)));
+            }
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(control.d_blocks[0][i]);
+            }
+
+            // Only the cache of this thread is allocated.
+
+            ASSERTV(NUM_ALLOCATIONS, ta.numAllocations(),
+                    NUM_ALLOCATIONS + 2 == ta.numAllocations());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CACHE STATISTICS
+        //
+        // Concerns:
+        //: 1 No cache exists for a thread that has not used the allocator.
+        //:
+        //: 2 The statistics of the cache of the calling thread identify the
+        //:   thread, and count its allocations, deallocations, refills, and
+        //:   flushes, and the blocks it holds.
+        //:
+        //: 3 'flushThreadCache' returns all blocks held in the cache of the
+        //:   calling thread to the shared pools.
+        //:
+        //: 4 Large blocks are not counted.
+        //
+        // Plan:
+        //: 1 Verify that 'loadCacheStatistics' loads no element for a new
+        //:   allocator.  (C-1)
+        //:
+        //: 2 Allocate and deallocate sequences of blocks of one size and
+        //:   verify the statistics against the values expected from the
+        //:   batch size (32) and cache capacity (64) of the implementation.
+        //:   (C-2)
+        //:
+        //: 3 Call 'flushThreadCache' and verify that the cache holds no
+        //:   blocks.  (C-3)
+        //:
+        //: 4 Allocate and deallocate a large block and verify that the
+        //:   statistics are unchanged.  (C-4)
+        //
+        // Testing:
+        //   void flushThreadCache();
+        //   void loadCacheStatistics(bsl::vector<CacheStatistics> *) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CACHE STATISTICS" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        const Uint64 SELF = bslmt::ThreadUtil::selfIdAsUint64();
+
+        bsl::vector<Stats> stats;
+
+        X.loadCacheStatistics(&stats);
+        ASSERTV(stats.size(), stats.empty());
+
+        mX.flushThreadCache();  // no cache yet
+
+        X.loadCacheStatistics(&stats);
+        ASSERTV(stats.size(), stats.empty());
+
+        void *blocks[100];
+        for (int i = 0; i < 100; ++i) {
+            blocks[i] = mX.allocate(24);
+        }
+
+        X.loadCacheStatistics(&stats);
+        ASSERTV(stats.size(), 1 == stats.size());
+
+        const Stats *s = findStats(stats, SELF);
+        ASSERT(s);
+
+        // 100 blocks were allocated in 4 batches of 32, leaving 28 cached.
+
+        ASSERTV(s->d_numAllocations,   100 == s->d_numAllocations);
+        ASSERTV(s->d_numDeallocations, 0   == s->d_numDeallocations);
+        ASSERTV(s->d_numRefills,       4   == s->d_numRefills);
+        ASSERTV(s->d_numFlushes,       0   == s->d_numFlushes);
+        ASSERTV(s->d_numCachedBlocks,  28  == s->d_numCachedBlocks);
+
+        for (int i = 0; i < 100; ++i) {
+            mX.deallocate(blocks[i]);
+        }
+
+        // The cache held 28 blocks and received 100: it became full after 36,
+        // and after each further 32, with 128 - 3 * 32 = 32 remaining.
+
+        X.loadCacheStatistics(&stats);
+        s = findStats(stats, SELF);
+        ASSERT(s);
+
+        ASSERTV(s->d_numDeallocations, 100 == s->d_numDeallocations);
+        ASSERTV(s->d_numFlushes,       2   == s->d_numFlushes);
+        ASSERTV(s->d_numCachedBlocks,  64  == s->d_numCachedBlocks);
+
+        mX.flushThreadCache();
+
+        X.loadCacheStatistics(&stats);
+        s = findStats(stats, SELF);
+        ASSERT(s);
+
+        ASSERTV(s->d_numFlushes,      3 == s->d_numFlushes);
+        ASSERTV(s->d_numCachedBlocks, 0 == s->d_numCachedBlocks);
+
+        void *p = mX.allocate(X.maxPooledBlockSize() + 1);
+        mX.deallocate(p);
+
+        X.loadCacheStatistics(&stats);
+        s = findStats(stats, SELF);
+        ASSERT(s);
+
+        ASSERTV(s->d_numAllocations,   100 == s->d_numAllocations);
+        ASSERTV(s->d_numDeallocations, 100 == s->d_numDeallocations);
+
+        const Stats RETIRED = X.retiredCacheStatistics();
+        ASSERT(0 == RETIRED.d_threadId);
+        ASSERT(0 == RETIRED.d_numAllocations);
+        ASSERT(0 == RETIRED.d_numDeallocations);
+        ASSERT(0 == RETIRED.d_numRefills);
+        ASSERT(0 == RETIRED.d_numFlushes);
+        ASSERT(0 == RETIRED.d_numCachedBlocks);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally-aligned, distinct blocks of at least
+        //:   the requested size, for pooled and large sizes.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 A block deallocated by a thread is the next block of its size
+        //:   class allocated by that thread.
+        //:
+        //: 4 Large blocks are obtained from, and returned to, the underlying
+        //:   allocator directly.
+        //
+        // Plan:
+        //: 1 For every size up to twice the maximum pooled block size,
+        //:   allocate a block, verify its alignment and distinctness, and
+        //:   write to all of its bytes.  (C-1)
+        //:
+        //: 2 Directly test 'allocate(0)' and 'deallocate(0)'.  (C-2)
+        //:
+        //: 3 Deallocate a block and allocate a block of a size in the same
+        //:   size class; verify that the address is the same.  (C-3)
+        //:
+        //: 4 Verify the number of blocks in use by the underlying test
+        //:   allocator before and after allocating and deallocating a large
+        //:   block.  (C-4)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            ASSERT(64 == X.maxPooledBlockSize());
+
+            if (veryVerbose) cout << "\tAlignment and distinctness." << endl;
+
+            bsl::vector<char *> blocks;
+            bsl::set<char *>    addresses;
+
+            for (size_type size = 1; size <= 2 * X.maxPooledBlockSize();
+                                                                     ++size) {
+                for (int j = 0; j < 50; ++j) {
+                    char *p = static_cast<char *>(mX.allocate(size));
+                    ASSERTV(size, j, isMaxAligned(p));
+                    ASSERTV(size, j, addresses.insert(p).second);
+                    bsl::memset(p, static_cast<int>(size), size);
+                    blocks.push_back(p);
+                }
+            }
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            if (veryVerbose) cout << "\tZero size and null address." << endl;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            if (veryVerbose) cout << "\tReuse by the same thread." << endl;
+
+            for (size_type size = 1; size <= X.maxPooledBlockSize(); ++size) {
+                void *p = mX.allocate(size);
+                mX.deallocate(p);
+
+                void *q = mX.allocate(size);
+                ASSERTV(size, p == q);
+                mX.deallocate(q);
+            }
+
+            void *p = mX.allocate(33);
+            mX.deallocate(p);
+            ASSERT(p == mX.allocate(64));
+            mX.deallocate(p);
+
+            if (veryVerbose) cout << "\tLarge blocks." << endl;
+
+            const bsls::Types::Int64 IN_USE = ta.numBlocksInUse();
+
+            p = mX.allocate(X.maxPooledBlockSize() + 1);
+            ASSERT(isMaxAligned(p));
+            ASSERTV(IN_USE, ta.numBlocksInUse(),
+                    IN_USE + 1 == ta.numBlocksInUse());
+
+            mX.deallocate(p);
+            ASSERTV(IN_USE, ta.numBlocksInUse(),
+                    IN_USE == ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor configures the number of pools, and hence the
+        //:   maximum pooled block size, and uses the specified underlying
+        //:   allocator, or the default allocator if none is specified.
+        //:
+        //: 2 The growth strategy and maximum number of blocks per chunk are
+        //:   honored by the shared pools.
+        //:
+        //: 3 The destructor returns all memory, including blocks allocated
+        //:   and not deallocated, to the underlying allocator.
+        //
+        // Plan:
+        //: 1 Construct objects using each constructor, with and without an
+        //:   underlying test allocator (installing a test allocator as the
+        //:   default), and verify 'numPools', 'maxPooledBlockSize', and
+        //:   'usesThreadCaches', and which allocator supplied memory.  (C-1)
+        //:
+        //: 2 Using a constant growth strategy and a maximum of 'N' blocks per
+        //:   chunk, allocate a block and verify the size of the chunk
+        //:   obtained from the underlying allocator.  (C-2)
+        //:
+        //: 3 Allocate blocks, destroy the object, and verify that the test
+        //:   allocator has no blocks in use.  (C-3)
+        //
+        // Testing:
+        //   ThreadCachingAllocator(Allocator *ba = 0);
+        //   ThreadCachingAllocator(int numPools, Allocator *ba = 0);
+        //   ThreadCachingAllocator(int, Strategy, int, Allocator *ba = 0);
+        //   ~ThreadCachingAllocator();
+        //   size_type maxPooledBlockSize() const;
+        //   int numPools() const;
+        //   bool usesThreadCaches() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::TestAllocator ta("object",  veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (veryVerbose) cout << "\tDefault configuration." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(10   == X.numPools());
+            ASSERT(4096 == X.maxPooledBlockSize());
+            ASSERT(X.usesThreadCaches());
+            ASSERT(0 < da.numBlocksInUse());
+
+            mX.allocate(100);
+            mX.allocate(5000);
+        }
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+        {
+            const bsls::Types::Int64 NUM_ALLOCATIONS = da.numAllocations();
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(10   == X.numPools());
+            ASSERT(4096 == X.maxPooledBlockSize());
+            ASSERT(0 < ta.numBlocksInUse());
+
+            mX.allocate(100);
+            mX.allocate(5000);
+
+            ASSERTV(NUM_ALLOCATIONS, da.numAllocations(),
+                    NUM_ALLOCATIONS == da.numAllocations());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (veryVerbose) cout << "\tNumber of pools." << endl;
+
+        for (int numPools = 1; numPools <= 12; ++numPools) {
+            const bsls::Types::Int64 NUM_ALLOCATIONS = da.numAllocations();
+            {
+                Obj mX(numPools, &ta);  const Obj& X = mX;
+
+                ASSERTV(numPools, numPools == X.numPools());
+                ASSERTV(numPools, X.maxPooledBlockSize(),
+                        size_type(8) << (numPools - 1) ==
+                                                      X.maxPooledBlockSize());
+
+                for (size_type size = 1; size <= X.maxPooledBlockSize() + 1;
+                                                                 size *= 2) {
+                    mX.allocate(size);
+                }
+            }
+            ASSERTV(numPools, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+            ASSERTV(numPools, NUM_ALLOCATIONS == da.numAllocations());
+            {
+                Obj mX(numPools);  const Obj& X = mX;
+
+                ASSERTV(numPools, numPools == X.numPools());
+            }
+            ASSERTV(numPools, da.numBlocksInUse(), 0 == da.numBlocksInUse());
+        }
+
+        if (veryVerbose) cout << "\tGrowth strategy." << endl;
+
+        for (int maxBlocks = 1; maxBlocks <= 64; maxBlocks *= 2) {
+            Obj mX(1, bsls::BlockGrowth::BSLS_CONSTANT, maxBlocks, &ta);
+
+            // Create the cache of this thread using a large block.
+
+            mX.deallocate(mX.allocate(1000));
+
+            const bsls::Types::Int64 TOTAL = ta.numBytesTotal();
+
+            // A refill carves a batch of 32 blocks, obtaining chunks of
+            // 'maxBlocks' blocks of 8 bytes plus a header.
+
+            mX.allocate(1);
+
+            const bsls::Types::Int64 CHUNKS = (32 + maxBlocks - 1) / maxBlocks;
+
+            ASSERTV(maxBlocks, TOTAL, ta.numBytesTotal(),
+                    TOTAL + CHUNKS * maxBlocks * (8 + MAX_ALIGN) <=
+                                                           ta.numBytesTotal());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        {
+            Obj mX(3, bsls::BlockGrowth::BSLS_GEOMETRIC, 8);
+            const Obj& X = mX;
+
+            ASSERT(3  == X.numPools());
+            ASSERT(32 == X.maxPooledBlockSize());
+            ASSERT(0 < da.numBlocksInUse());
+        }
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, allocate and deallocate blocks of several sizes
+        //:   from the main thread and another thread, and destroy the object.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Obj mX(&ta);
+
+            const size_type SIZES[] = { 1, 8, 9, 100, 4096, 4097, 100000 };
+            const int       NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            void *blocks[NUM_SIZES];
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                blocks[i] = mX.allocate(SIZES[i]);
+                ASSERTV(i, blocks[i]);
+                ASSERTV(i, isMaxAligned(blocks[i]));
+                bsl::memset(blocks[i], 0xFF, SIZES[i]);
+            }
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            bsl::vector<Stats> stats;
+            mX.loadCacheStatistics(&stats);
+            ASSERTV(stats.size(), 1 == stats.size());
+            ASSERTV(stats[0].d_numAllocations, 5 == stats[0].d_numAllocations);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: MULTI-THREADED SCALING
+        //
+        // Concerns:
+        //: 1 The throughput of 'bdlma::ThreadCachingAllocator' scales with the
+        //:   number of threads allocating concurrently.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, ... up to the specified maximum number of threads,
+        //:   time each thread repeatedly allocating and deallocating batches
+        //:   of blocks of assorted small sizes using
+        //:   'bslma::NewDeleteAllocator',
+        //:   'bdlma::ConcurrentMultipoolAllocator', and
+        //:   'bdlma::ThreadCachingAllocator', and report the elapsed times.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: MULTI-THREADED SCALING
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST: MULTI-THREADED SCALING" << endl
+             << "========================================" << endl;
+
+        using namespace caseMinus1;
+
+        const int maxThreads = argc > 2 ? atoi(argv[2]) : 8;
+        const int iterations = argc > 3 ? atoi(argv[3]) : 20000;
+
+        printf("%d iterations of %d allocations and deallocations"
+               " per thread\n\n", iterations, static_cast<int>(k_BATCH));
+        printf("%8s %14s %14s %14s\n",
+               "threads", "new/delete", "multipool", "thread-caching");
+
+        for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+            double newDelete = run(&bslma::NewDeleteAllocator::singleton(),
+                                   numThreads,
+                                   iterations);
+
+            double multipool;
+            {
+                bdlma::ConcurrentMultipoolAllocator allocator(
+                                      &bslma::NewDeleteAllocator::singleton());
+                multipool = run(&allocator, numThreads, iterations);
+            }
+
+            double threadCaching;
+            {
+                Obj allocator(&bslma::NewDeleteAllocator::singleton());
+                threadCaching = run(&allocator, numThreads, iterations);
+            }
+
+            printf("%8d %13.3fs %13.3fs %13.3fs\n",
+                   numThreads,
+                   newDelete,
+                   multipool,
+                   threadCaching);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
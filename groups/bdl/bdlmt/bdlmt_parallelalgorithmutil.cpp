@@ -0,0 +1,193 @@
+// bdlmt_parallelalgorithmutil.cpp                                    -*-C++-*-
+#include <bdlmt_parallelalgorithmutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_parallelalgorithmutil_cpp,"$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+
+#include <bslmt_latch.h>
+
+namespace BloombergLP {
+namespace {
+
+void runTask(bdlmt::ParallelAlgorithmUtil_Impl::TaskFunction  function,
+             void                                            *context,
+             int                                              taskIndex,
+             bslmt::Latch                                    *latch)
+    // Invoke the specified 'function' with the specified 'context' and
+    // 'taskIndex', then arrive at the specified 'latch'.
+{
+    function(context, taskIndex);
+    latch->arrive();
+}
+
+                            // ==================
+                            // class LatchProctor
+                            // ==================
+
+class LatchProctor {
+    // This class implements a proctor that, on destruction, counts down the
+    // managed latch by the number of tasks that have not been handed off to
+    // another thread or performed, and then waits on the latch.  This ensures
+    // that the state referred to by tasks running in other threads outlives
+    // those tasks, even if a task performed by the calling thread throws.
+
+    // DATA
+    bslmt::Latch *d_latch_p;       // managed latch
+    int           d_numRemaining;  // tasks neither handed off nor performed
+
+  public:
+    // CREATORS
+    LatchProctor(bslmt::Latch *latch, int numTasks)
+        // Create a proctor managing the specified 'latch' for the specified
+        // 'numTasks' tasks.
+    : d_latch_p(latch)
+    , d_numRemaining(numTasks)
+    {
+    }
+
+    ~LatchProctor()
+        // Count down the managed latch by the number of remaining tasks, and
+        // wait on it.
+    {
+        if (d_numRemaining) {
+            d_latch_p->countDown(d_numRemaining);
+        }
+        d_latch_p->wait();
+    }
+
+    // MANIPULATORS
+    void release()
+        // Record that one more task has been handed off or performed.
+    {
+        --d_numRemaining;
+    }
+};
+
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+                     // ---------------------------------
+                     // struct ParallelAlgorithmUtil_Impl
+                     // ---------------------------------
+
+// CLASS METHODS
+void ParallelAlgorithmUtil_Impl::execute(FixedThreadPool *pool,
+                                         int              numTasks,
+                                         TaskFunction     function,
+                                         void            *context)
+{
+    BSLS_ASSERT(pool);
+    BSLS_ASSERT(0 < numTasks);
+    BSLS_ASSERT(function);
+
+    if (1 == numTasks) {
+        function(context, 0);
+        return;                                                       // RETURN
+    }
+
+    // Tasks '1' to 'numTasks - 1' are handed to the pool; task 0 is performed
+    // by this thread while the pool is busy with the others.
+
+    bslmt::Latch latch(numTasks - 1);
+    LatchProctor proctor(&latch, numTasks - 1);
+
+    for (int i = 1; i < numTasks; ++i) {
+        if (0 != pool->enqueueJob(bdlf::BindUtil::bind(&runTask,
+                                                       function,
+                                                       context,
+                                                       i,
+                                                       &latch))) {
+            // The pool is not accepting jobs; perform the task here.
+
+            function(context, i);
+            latch.arrive();
+        }
+        proctor.release();
+    }
+
+    function(context, 0);
+}
+
+int ParallelAlgorithmUtil_Impl::numTasks(const FixedThreadPool& pool,
+                                         Int64                  numElements)
+{
+    Int64 result = numElements
+                 / ParallelAlgorithmUtil::k_MIN_ELEMENTS_PER_TASK;
+
+    if (result > pool.numThreads() + 1) {
+        result = pool.numThreads() + 1;
+    }
+
+    return result < 1 ? 1 : static_cast<int>(result);
+}
+
+void ParallelAlgorithmUtil_Impl::makeMergeItems(
+                                         bsl::vector<MergeItem> *items,
+                                         bsl::vector<Int64>     *runs,
+                                         Int64                   numElements,
+                                         int                     numTasks)
+{
+    BSLS_ASSERT(items);
+    BSLS_ASSERT(runs);
+    BSLS_ASSERT(3 <= runs->size());
+    BSLS_ASSERT(0 < numElements);
+    BSLS_ASSERT(0 < numTasks);
+
+    bsl::vector<Int64>& r       = *runs;
+    const int           numRuns = static_cast<int>(r.size()) - 1;
+
+    items->clear();
+
+    // The boundaries of the merged runs overwrite those of the input runs in
+    // place; the merged run starting at 'r[i]' is recorded at 'r[i / 2]'.
+
+    int numMerged = 0;
+    for (int i = 0; i < numRuns; i += 2) {
+        MergeItem item;
+        item.d_first  = r[i];
+        item.d_middle = r[i + 1];
+        item.d_last   = i + 1 < numRuns ? r[i + 2] : r[i + 1];
+
+        // Divide the merge into pieces in proportion to its share of the
+        // whole range.
+
+        const Int64 length    = item.d_last - item.d_first;
+        Int64       numPieces = (length * numTasks + numElements / 2)
+                              / numElements;
+        if (numPieces < 1) {
+            numPieces = 1;
+        }
+
+        for (Int64 k = 0; k < numPieces; ++k) {
+            item.d_begin = length * k       / numPieces;
+            item.d_end   = length * (k + 1) / numPieces;
+            items->push_back(item);
+        }
+
+        r[numMerged++] = item.d_first;
+    }
+    r[numMerged++] = numElements;
+    r.resize(numMerged);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
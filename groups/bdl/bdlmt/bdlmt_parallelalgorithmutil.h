@@ -0,0 +1,1030 @@
+// bdlmt_parallelalgorithmutil.h                                      -*-C++-*-
+#ifndef INCLUDED_BDLMT_PARALLELALGORITHMUTIL
+#define INCLUDED_BDLMT_PARALLELALGORITHMUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide parallel versions of standard algorithms using a pool.
+//
+//@CLASSES:
+//  bdlmt::ParallelAlgorithmUtil: namespace for parallel algorithms
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bsl_algorithm
+//
+//@DESCRIPTION: This component provides a 'struct',
+// 'bdlmt::ParallelAlgorithmUtil', that serves as a namespace for parallel
+// versions of the standard algorithms 'for_each', 'transform', 'reduce',
+// 'inclusive_scan', and 'sort', operating on random-access ranges.  Each
+// function partitions its input range into contiguous chunks, processes the
+// chunks concurrently on the threads of a caller-supplied
+// 'bdlmt::FixedThreadPool' (and on the calling thread), and returns once the
+// whole range has been processed.  Scratch memory needed by 'reduce',
+// 'inclusiveScan', and 'sort' is supplied by an optionally specified
+// allocator.
+//
+// A range is split into at most one chunk more than the number of threads in
+// the pool (the calling thread processes one of the chunks itself), and into
+// no chunk smaller than 'k_MIN_ELEMENTS_PER_TASK' elements, so that small
+// ranges are processed entirely by the calling thread without involving the
+// pool.  If the pool does not accept a job (e.g., because it is not started),
+// the corresponding chunk is processed by the calling thread.
+//
+///Algorithms
+///----------
+// The following algorithms are provided:
+//
+//: o 'forEach' invokes a functor on every element of a range.
+//:
+//: o 'transform' stores, for every element of a range, the result of a
+//:   functor applied to that element into an output range.
+//:
+//: o 'reduce' combines the elements of a range, and an initial value, using a
+//:   binary operation.  The operation must be *associative*; each chunk is
+//:   reduced separately, and the per-chunk results are then combined in
+//:   order, so the operation need not be commutative.
+//:
+//: o 'inclusiveScan' stores into an output range, at each position, the
+//:   combination (using a binary operation) of all the elements of the input
+//:   range up to and including that position.  The operation must be
+//:   *associative*.  The output range may be the same as the input range.
+//:   Three passes are used: the total of each chunk is computed in parallel,
+//:   those totals are combined in order, and then each chunk is scanned in
+//:   parallel starting from the combined total of the preceding chunks.
+//:
+//: o 'sort' sorts a range.  Each chunk is sorted in parallel using 'bsl::sort'
+//:   and the sorted runs are then merged pairwise, in rounds.  Every merge is
+//:   split into pieces of roughly equal size (by binary search for the
+//:   co-ranks of the piece boundaries, the "merge path" method), so that all
+//:   threads contribute to every round.  A scratch buffer holding a copy of
+//:   the range is allocated from the supplied allocator.  As with 'bsl::sort',
+//:   the sort is not stable.
+//
+///Requirements on Functors
+///------------------------
+// The functors and operations supplied to these functions are invoked
+// concurrently from several threads, through a single shared instance, and
+// so must be safe to invoke concurrently.  They must not throw exceptions: an
+// exception escaping a job run by a thread of the pool terminates the
+// program.
+//
+///Thread Safety
+///-------------
+// The functions in this component may be called concurrently from any number
+// of threads, including with the same pool, provided that the ranges being
+// processed do not overlap.  Note that the behavior is undefined if any of
+// these functions is called from a job running in the supplied pool: the
+// calling thread waits for the jobs it submitted to the pool, which may be
+// queued behind the job that is waiting for them and so never run, and the
+// call deadlocks.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Processing a Large Data Set
+/// - - - - - - - - - - - - - - - - - - -
+// In this example, we sort a large set of values, and compute their sum and
+// running totals, using all the threads of a pool.
+//
+// First, we create and start a pool:
+//..
+//  bdlmt::FixedThreadPool pool(4, 100);
+//
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Then, we create our data set, the integers from 0 to 'k_NUM_VALUES - 1' in
+// descending order:
+//..
+//  enum { k_NUM_VALUES = 1000000 };
+//
+//  bsl::vector<bsls::Types::Int64> values(k_NUM_VALUES);
+//  for (int i = 0; i < k_NUM_VALUES; ++i) {
+//      values[i] = k_NUM_VALUES - 1 - i;
+//  }
+//..
+// Next, we sort the data set in parallel:
+//..
+//  bdlmt::ParallelAlgorithmUtil::sort(&pool, values.begin(), values.end());
+//
+//  assert(0                == values.front());
+//  assert(k_NUM_VALUES - 1 == values.back());
+//..
+// Then, we compute, in parallel, the sum of the values:
+//..
+//  bsls::Types::Int64 sum = bdlmt::ParallelAlgorithmUtil::reduce(
+//                                                    &pool,
+//                                                    values.begin(),
+//                                                    values.end(),
+//                                                    bsls::Types::Int64(0));
+//
+//  assert(bsls::Types::Int64(k_NUM_VALUES) * (k_NUM_VALUES - 1) / 2 == sum);
+//..
+// Finally, we replace the values with their running totals, in place:
+//..
+//  bdlmt::ParallelAlgorithmUtil::inclusiveScan(&pool,
+//                                              values.begin(),
+//                                              values.end(),
+//                                              values.begin());
+//
+//  assert(sum == values.back());
+//  assert(3   == values[3] - values[2]);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_functional.h>
+#include <bsl_iterator.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                       // ============================
+                       // struct ParallelAlgorithmUtil
+                       // ============================
+
+struct ParallelAlgorithmUtil {
+    // This 'struct' provides a namespace for parallel versions of standard
+    // algorithms, each of which partitions a random-access range into chunks
+    // that are processed concurrently by the threads of a supplied
+    // 'FixedThreadPool' and by the calling thread.
+
+    // TYPES
+    enum {
+        k_MIN_ELEMENTS_PER_TASK = 2048  // minimum number of elements in each
+                                        // chunk processed by a single task
+    };
+
+    // CLASS METHODS
+    template <class RANDOM_ITER, class FUNCTOR>
+    static void forEach(FixedThreadPool *pool,
+                        RANDOM_ITER      first,
+                        RANDOM_ITER      last,
+                        FUNCTOR          function);
+        // Invoke the specified 'function' on each element in the range
+        // '[first, last)', using the threads of the specified 'pool' and the
+        // calling thread.  The behavior is undefined unless
+        // '[first, last)' is a valid range, 'function' can be invoked
+        // concurrently from several threads, and the calling thread is not a
+        // thread of 'pool'.
+
+    template <class RANDOM_ITER, class OUTPUT_ITER, class UNARY_OPERATION>
+    static OUTPUT_ITER transform(FixedThreadPool *pool,
+                                 RANDOM_ITER      first,
+                                 RANDOM_ITER      last,
+                                 OUTPUT_ITER      result,
+                                 UNARY_OPERATION  operation);
+        // Assign to each position 'result + i' the value of
+        // 'operation(*(first + i))', for each 'i' in '[0, last - first)',
+        // using the threads of the specified 'pool' and the calling thread.
+        // Return 'result + (last - first)'.  'OUTPUT_ITER' must be a
+        // random-access iterator.  The behavior is undefined unless
+        // '[first, last)' is a valid range, the output range has at least
+        // 'last - first' elements, 'operation' can be invoked concurrently
+        // from several threads, and the calling thread is not a thread of
+        // 'pool'.  Note that the output range may be the same as the input
+        // range.
+
+    template <class RANDOM_ITER, class VALUE>
+    static VALUE reduce(FixedThreadPool *pool,
+                        RANDOM_ITER      first,
+                        RANDOM_ITER      last,
+                        VALUE            initialValue);
+    template <class RANDOM_ITER, class VALUE, class BINARY_OPERATION>
+    static VALUE reduce(FixedThreadPool  *pool,
+                        RANDOM_ITER       first,
+                        RANDOM_ITER       last,
+                        VALUE             initialValue,
+                        BINARY_OPERATION  operation,
+                        bslma::Allocator *basicAllocator = 0);
+        // Return the combination of the specified 'initialValue' and the
+        // elements in the range '[first, last)', in order, using the
+        // optionally specified binary 'operation' (or 'bsl::plus<VALUE>' if
+        // 'operation' is not specified), computed by the threads of the
+        // specified 'pool' and the calling thread.  Optionally specify a
+        // 'basicAllocator' used to supply scratch memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  'VALUE' must be assignable from the element type of the
+        // range.  The behavior is undefined unless '[first, last)' is a valid
+        // range, 'operation' is associative and can be invoked concurrently
+        // from several threads, and the calling thread is not a thread of
+        // 'pool'.
+
+    template <class RANDOM_ITER, class OUTPUT_ITER>
+    static OUTPUT_ITER inclusiveScan(FixedThreadPool *pool,
+                                     RANDOM_ITER      first,
+                                     RANDOM_ITER      last,
+                                     OUTPUT_ITER      result);
+    template <class RANDOM_ITER, class OUTPUT_ITER, class BINARY_OPERATION>
+    static OUTPUT_ITER inclusiveScan(
+                                   FixedThreadPool  *pool,
+                                   RANDOM_ITER       first,
+                                   RANDOM_ITER       last,
+                                   OUTPUT_ITER       result,
+                                   BINARY_OPERATION  operation,
+                                   bslma::Allocator *basicAllocator = 0);
+        // Assign to each position 'result + i' the combination, in order, of
+        // the elements in the range '[first, first + i]' using the optionally
+        // specified binary 'operation' (or 'bsl::plus' of the element type if
+        // 'operation' is not specified), for each 'i' in
+        // '[0, last - first)', using the threads of the specified 'pool' and
+        // the calling thread.  Return 'result + (last - first)'.  Optionally
+        // specify a 'basicAllocator' used to supply scratch memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  'OUTPUT_ITER' must be a random-access iterator whose elements
+        // can be read back after they are assigned.  The behavior is
+        // undefined unless '[first, last)' is a valid range, the output range
+        // has at least 'last - first' elements and either is the same as, or
+        // does not overlap, the input range, 'operation' is associative and
+        // can be invoked concurrently from several threads, and the calling
+        // thread is not a thread of 'pool'.
+
+    template <class RANDOM_ITER>
+    static void sort(FixedThreadPool *pool,
+                     RANDOM_ITER      first,
+                     RANDOM_ITER      last);
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void sort(FixedThreadPool  *pool,
+                     RANDOM_ITER       first,
+                     RANDOM_ITER       last,
+                     COMPARATOR        comparator,
+                     bslma::Allocator *basicAllocator = 0);
+        // Sort the elements in the range '[first, last)' into ascending order
+        // as defined by the optionally specified 'comparator' (or 'operator<'
+        // if 'comparator' is not specified), using the threads of the
+        // specified 'pool' and the calling thread.  Optionally specify a
+        // 'basicAllocator' used to supply scratch memory, including a copy of
+        // each element.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '[first, last)' is a valid range, 'comparator' defines a strict
+        // weak ordering and can be invoked concurrently from several threads,
+        // and the calling thread is not a thread of 'pool'.  Note that the
+        // relative order of equivalent elements is not preserved.
+};
+
+                     // =================================
+                     // struct ParallelAlgorithmUtil_Impl
+                     // =================================
+
+struct ParallelAlgorithmUtil_Impl {
+    // [!PRIVATE!] This 'struct' provides a namespace for the implementation
+    // of 'ParallelAlgorithmUtil'.  Each algorithm is expressed as a set of
+    // tasks, each identified by an index, that are invoked through a function
+    // having the 'TaskFunction' signature on a context object describing the
+    // algorithm's state.
+
+    // TYPES
+    typedef bsls::Types::Int64 Int64;
+
+    typedef void (*TaskFunction)(void *context, int taskIndex);
+        // 'TaskFunction' is an alias for a function that performs the task
+        // having the specified 'taskIndex' on the specified 'context'.
+
+    struct MergeItem {
+        // This 'struct' describes one piece of the merge of two adjacent
+        // sorted runs: the piece comprises positions '[d_begin, d_end)',
+        // relative to 'd_first', of the merged output.
+
+        Int64 d_first;  // offset of the first run
+        Int64 d_middle; // offset of the second run
+        Int64 d_last;   // offset of the end of the second run
+        Int64 d_begin;  // first output position, relative to 'd_first'
+        Int64 d_end;    // end output position, relative to 'd_first'
+    };
+
+    template <class RANDOM_ITER, class FUNCTOR>
+    struct ForEachContext {
+        // This 'struct' holds the state of a 'forEach' invocation.
+
+        RANDOM_ITER  d_first;
+        Int64        d_numElements;
+        int          d_numTasks;
+        FUNCTOR     *d_function_p;
+
+        static void run(void *context, int taskIndex);
+            // Invoke the function on each element of the chunk having the
+            // specified 'taskIndex' of the 'ForEachContext' addressed by the
+            // specified 'context'.
+    };
+
+    template <class RANDOM_ITER, class OUTPUT_ITER, class UNARY_OPERATION>
+    struct TransformContext {
+        // This 'struct' holds the state of a 'transform' invocation.
+
+        RANDOM_ITER      d_first;
+        OUTPUT_ITER      d_result;
+        Int64            d_numElements;
+        int              d_numTasks;
+        UNARY_OPERATION *d_operation_p;
+
+        static void run(void *context, int taskIndex);
+            // Transform the chunk having the specified 'taskIndex' of the
+            // 'TransformContext' addressed by the specified 'context'.
+    };
+
+    template <class RANDOM_ITER, class VALUE, class BINARY_OPERATION>
+    struct ReduceContext {
+        // This 'struct' holds the state of a 'reduce' invocation, and of the
+        // first pass of an 'inclusiveScan' invocation.
+
+        RANDOM_ITER       d_first;
+        Int64             d_numElements;
+        int               d_numTasks;
+        BINARY_OPERATION *d_operation_p;
+        VALUE            *d_partials_p;   // one result per chunk
+
+        static void run(void *context, int taskIndex);
+            // Combine the elements of the chunk having the specified
+            // 'taskIndex' of the 'ReduceContext' addressed by the specified
+            // 'context' into the corresponding element of 'd_partials_p'.
+    };
+
+    template <class RANDOM_ITER, class OUTPUT_ITER, class BINARY_OPERATION>
+    struct ScanContext {
+        // This 'struct' holds the state of the final pass of an
+        // 'inclusiveScan' invocation.
+
+        RANDOM_ITER       d_first;
+        OUTPUT_ITER       d_result;
+        Int64             d_numElements;
+        int               d_numTasks;
+        BINARY_OPERATION *d_operation_p;
+        const typename bsl::iterator_traits<RANDOM_ITER>::value_type
+                         *d_offsets_p;    // total of the preceding chunks
+
+        static void run(void *context, int taskIndex);
+            // Scan the chunk having the specified 'taskIndex' of the
+            // 'ScanContext' addressed by the specified 'context', starting
+            // from the total of the preceding chunks.
+    };
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    struct SortContext {
+        // This 'struct' holds the state of the first pass of a 'sort'
+        // invocation.
+
+        typedef typename bsl::iterator_traits<RANDOM_ITER>::value_type Value;
+
+        RANDOM_ITER       d_first;
+        Int64             d_numElements;
+        int               d_numTasks;
+        COMPARATOR       *d_comparator_p;
+        Value            *d_buffer_p;     // uninitialized scratch buffer
+        bslma::Allocator *d_allocator_p;
+
+        static void run(void *context, int taskIndex);
+            // Sort the chunk having the specified 'taskIndex' of the
+            // 'SortContext' addressed by the specified 'context', and
+            // copy-construct the sorted chunk into the scratch buffer.
+    };
+
+    template <class SOURCE_ITER, class DESTINATION_ITER, class COMPARATOR>
+    struct MergeContext {
+        // This 'struct' holds the state of one round of merging of a 'sort'
+        // invocation.
+
+        SOURCE_ITER       d_source;
+        DESTINATION_ITER  d_destination;
+        const MergeItem  *d_items_p;
+        COMPARATOR       *d_comparator_p;
+
+        static void run(void *context, int taskIndex);
+            // Perform the merge piece having the specified 'taskIndex' of the
+            // 'MergeContext' addressed by the specified 'context'.
+    };
+
+    template <class RANDOM_ITER>
+    struct SortFinishContext {
+        // This 'struct' holds the state of the final pass of a 'sort'
+        // invocation.
+
+        typedef typename bsl::iterator_traits<RANDOM_ITER>::value_type Value;
+
+        RANDOM_ITER  d_first;
+        Int64        d_numElements;
+        int          d_numTasks;
+        Value       *d_buffer_p;
+        bool         d_copyBack;          // 'true' if result is in buffer
+
+        static void run(void *context, int taskIndex);
+            // Copy, if 'd_copyBack' is 'true', the chunk having the specified
+            // 'taskIndex' of the scratch buffer of the 'SortFinishContext'
+            // addressed by the specified 'context' back into the range, and
+            // destroy the elements of that chunk of the buffer.
+    };
+
+    // CLASS METHODS
+    static void execute(FixedThreadPool *pool,
+                        int              numTasks,
+                        TaskFunction     function,
+                        void            *context);
+        // Invoke the specified 'function' with the specified 'context' and
+        // each task index in '[0, numTasks)', using the threads of the
+        // specified 'pool' and the calling thread, and return once all
+        // invocations have completed.  Tasks that 'pool' does not accept are
+        // performed by the calling thread.  The behavior is undefined unless
+        // '0 < numTasks' and the calling thread is not a thread of 'pool'.
+
+    static void chunk(Int64 *begin,
+                      Int64 *end,
+                      Int64  numElements,
+                      int    numTasks,
+                      int    taskIndex);
+        // Load into the specified 'begin' and 'end' the bounds of the chunk
+        // having the specified 'taskIndex' when 'numElements' elements are
+        // divided into the specified 'numTasks' chunks of nearly equal size.
+
+    static int numTasks(const FixedThreadPool& pool, Int64 numElements);
+        // Return the number of tasks into which to divide the specified
+        // 'numElements' elements to be processed using the specified 'pool':
+        // one more than the number of threads in 'pool', but such that each
+        // task has at least 'k_MIN_ELEMENTS_PER_TASK' elements, and at least
+        // 1.
+
+    static void makeMergeItems(bsl::vector<MergeItem> *items,
+                               bsl::vector<Int64>     *runs,
+                               Int64                   numElements,
+                               int                     numTasks);
+        // Load into the specified 'items' the pieces of a round of merging of
+        // adjacent pairs of the sorted runs whose boundaries are the
+        // specified 'runs', dividing the specified 'numElements' elements
+        // into approximately the specified 'numTasks' pieces, and update
+        // 'runs' to the boundaries of the runs resulting from the round.  A
+        // final, unpaired, run is merged with an empty run (i.e., copied).
+        // The behavior is undefined unless 'runs' has at least 3 elements.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static Int64 mergePath(RANDOM_ITER first1,
+                           Int64       length1,
+                           RANDOM_ITER first2,
+                           Int64       length2,
+                           Int64       diagonal,
+                           COMPARATOR *comparator);
+        // Return the number of elements taken from the sorted range of the
+        // specified 'length1' starting at the specified 'first1' among the
+        // first 'diagonal' elements produced by merging (as by 'bsl::merge')
+        // that range with the sorted range of the specified 'length2'
+        // starting at the specified 'first2', using the specified
+        // 'comparator'.  The behavior is undefined unless
+        // '0 <= diagonal <= length1 + length2'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // ---------------------------------
+                     // struct ParallelAlgorithmUtil_Impl
+                     // ---------------------------------
+
+// CLASS METHODS
+template <class RANDOM_ITER, class FUNCTOR>
+void ParallelAlgorithmUtil_Impl::ForEachContext<RANDOM_ITER, FUNCTOR>::run(
+                                                         void *context,
+                                                         int   taskIndex)
+{
+    ForEachContext *self = static_cast<ForEachContext *>(context);
+
+    Int64 begin, end;
+    chunk(&begin, &end, self->d_numElements, self->d_numTasks, taskIndex);
+
+    RANDOM_ITER it = self->d_first + begin;
+    for (Int64 i = begin; i < end; ++i, ++it) {
+        (*self->d_function_p)(*it);
+    }
+}
+
+template <class RANDOM_ITER, class OUTPUT_ITER, class UNARY_OPERATION>
+void ParallelAlgorithmUtil_Impl::TransformContext<RANDOM_ITER,
+                                                  OUTPUT_ITER,
+                                                  UNARY_OPERATION>::run(
+                                                         void *context,
+                                                         int   taskIndex)
+{
+    TransformContext *self = static_cast<TransformContext *>(context);
+
+    Int64 begin, end;
+    chunk(&begin, &end, self->d_numElements, self->d_numTasks, taskIndex);
+
+    RANDOM_ITER it  = self->d_first  + begin;
+    OUTPUT_ITER out = self->d_result + begin;
+    for (Int64 i = begin; i < end; ++i, ++it, ++out) {
+        *out = (*self->d_operation_p)(*it);
+    }
+}
+
+template <class RANDOM_ITER, class VALUE, class BINARY_OPERATION>
+void ParallelAlgorithmUtil_Impl::ReduceContext<RANDOM_ITER,
+                                               VALUE,
+                                               BINARY_OPERATION>::run(
+                                                         void *context,
+                                                         int   taskIndex)
+{
+    ReduceContext *self = static_cast<ReduceContext *>(context);
+
+    Int64 begin, end;
+    chunk(&begin, &end, self->d_numElements, self->d_numTasks, taskIndex);
+
+    BSLS_ASSERT(begin < end);
+
+    VALUE&      partial = self->d_partials_p[taskIndex];
+    RANDOM_ITER it      = self->d_first + begin;
+
+    partial = *it;
+    for (Int64 i = begin + 1; i < end; ++i) {
+        ++it;
+        partial = (*self->d_operation_p)(partial, *it);
+    }
+}
+
+template <class RANDOM_ITER, class OUTPUT_ITER, class BINARY_OPERATION>
+void ParallelAlgorithmUtil_Impl::ScanContext<RANDOM_ITER,
+                                             OUTPUT_ITER,
+                                             BINARY_OPERATION>::run(
+                                                         void *context,
+                                                         int   taskIndex)
+{
+    ScanContext *self = static_cast<ScanContext *>(context);
+
+    Int64 begin, end;
+    chunk(&begin, &end, self->d_numElements, self->d_numTasks, taskIndex);
+
+    BSLS_ASSERT(begin < end);
+
+    RANDOM_ITER it  = self->d_first  + begin;
+    OUTPUT_ITER out = self->d_result + begin;
+
+    // Each output element is computed from the previous output element, so
+    // that no accumulator object (which might allocate memory) is needed.
+
+    if (0 == taskIndex) {
+        *out = *it;
+    }
+    else {
+        *out = (*self->d_operation_p)(self->d_offsets_p[taskIndex - 1], *it);
+    }
+
+    for (Int64 i = begin + 1; i < end; ++i) {
+        OUTPUT_ITER previous = out;
+        ++it;
+        ++out;
+        *out = (*self->d_operation_p)(*previous, *it);
+    }
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+void ParallelAlgorithmUtil_Impl::SortContext<RANDOM_ITER, COMPARATOR>::run(
+                                                         void *context,
+                                                         int   taskIndex)
+{
+    SortContext *self = static_cast<SortContext *>(context);
+
+    Int64 begin, end;
+    chunk(&begin, &end, self->d_numElements, self->d_numTasks, taskIndex);
+
+    bsl::sort(self->d_first + begin,
+              self->d_first + end,
+              *self->d_comparator_p);
+
+    RANDOM_ITER it = self->d_first + begin;
+    for (Int64 i = begin; i < end; ++i, ++it) {
+        bslma::ConstructionUtil::construct(self->d_buffer_p + i,
+                                           self->d_allocator_p,
+                                           *it);
+    }
+}
+
+template <class SOURCE_ITER, class DESTINATION_ITER, class COMPARATOR>
+void ParallelAlgorithmUtil_Impl::MergeContext<SOURCE_ITER,
+                                              DESTINATION_ITER,
+                                              COMPARATOR>::run(
+                                                         void *context,
+                                                         int   taskIndex)
+{
+    MergeContext    *self = static_cast<MergeContext *>(context);
+    const MergeItem& item = self->d_items_p[taskIndex];
+
+    const SOURCE_ITER first1  = self->d_source + item.d_first;
+    const SOURCE_ITER first2  = self->d_source + item.d_middle;
+    const Int64       length1 = item.d_middle - item.d_first;
+    const Int64       length2 = item.d_last   - item.d_middle;
+
+    const Int64 begin1 = mergePath(first1,
+                                   length1,
+                                   first2,
+                                   length2,
+                                   item.d_begin,
+                                   self->d_comparator_p);
+    const Int64 end1   = mergePath(first1,
+                                   length1,
+                                   first2,
+                                   length2,
+                                   item.d_end,
+                                   self->d_comparator_p);
+
+    bsl::merge(first1 + begin1,
+               first1 + end1,
+               first2 + (item.d_begin - begin1),
+               first2 + (item.d_end   - end1),
+               self->d_destination + (item.d_first + item.d_begin),
+               *self->d_comparator_p);
+}
+
+template <class RANDOM_ITER>
+void ParallelAlgorithmUtil_Impl::SortFinishContext<RANDOM_ITER>::run(
+                                                         void *context,
+                                                         int   taskIndex)
+{
+    SortFinishContext *self = static_cast<SortFinishContext *>(context);
+
+    Int64 begin, end;
+    chunk(&begin, &end, self->d_numElements, self->d_numTasks, taskIndex);
+
+    if (self->d_copyBack) {
+        bsl::copy(self->d_buffer_p + begin,
+                  self->d_buffer_p + end,
+                  self->d_first + begin);
+    }
+
+    bslalg::ArrayDestructionPrimitives::destroy(self->d_buffer_p + begin,
+                                                self->d_buffer_p + end);
+}
+
+inline
+void ParallelAlgorithmUtil_Impl::chunk(Int64 *begin,
+                                       Int64 *end,
+                                       Int64  numElements,
+                                       int    numTasks,
+                                       int    taskIndex)
+{
+    BSLS_ASSERT(begin);
+    BSLS_ASSERT(end);
+    BSLS_ASSERT(0 < numTasks);
+    BSLS_ASSERT(0 <= taskIndex);
+    BSLS_ASSERT(taskIndex < numTasks);
+
+    *begin = numElements * taskIndex       / numTasks;
+    *end   = numElements * (taskIndex + 1) / numTasks;
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+ParallelAlgorithmUtil_Impl::Int64 ParallelAlgorithmUtil_Impl::mergePath(
+                                                    RANDOM_ITER first1,
+                                                    Int64       length1,
+                                                    RANDOM_ITER first2,
+                                                    Int64       length2,
+                                                    Int64       diagonal,
+                                                    COMPARATOR *comparator)
+{
+    BSLS_ASSERT(0 <= diagonal);
+    BSLS_ASSERT(diagonal <= length1 + length2);
+
+    // Find the smallest 'i' for which the element 'first2[diagonal - i - 1]'
+    // is ordered before 'first1[i]'; 'bsl::merge' takes every element of the
+    // first range that is not ordered after the corresponding element of the
+    // second range first.
+
+    Int64 low  = diagonal > length2 ? diagonal - length2 : 0;
+    Int64 high = diagonal < length1 ? diagonal : length1;
+
+    while (low < high) {
+        const Int64 middle = low + (high - low) / 2;
+
+        if ((*comparator)(first2[diagonal - middle - 1], first1[middle])) {
+            high = middle;
+        }
+        else {
+            low = middle + 1;
+        }
+    }
+
+    return low;
+}
+
+                        // ----------------------------
+                        // struct ParallelAlgorithmUtil
+                        // ----------------------------
+
+// CLASS METHODS
+template <class RANDOM_ITER, class FUNCTOR>
+void ParallelAlgorithmUtil::forEach(FixedThreadPool *pool,
+                                    RANDOM_ITER      first,
+                                    RANDOM_ITER      last,
+                                    FUNCTOR          function)
+{
+    BSLS_ASSERT(pool);
+
+    typedef ParallelAlgorithmUtil_Impl                         Impl;
+    typedef Impl::ForEachContext<RANDOM_ITER, FUNCTOR>         Context;
+
+    const Impl::Int64 numElements = last - first;
+    if (0 == numElements) {
+        return;                                                       // RETURN
+    }
+
+    Context context;
+    context.d_first       = first;
+    context.d_numElements = numElements;
+    context.d_numTasks    = Impl::numTasks(*pool, numElements);
+    context.d_function_p  = &function;
+
+    Impl::execute(pool, context.d_numTasks, &Context::run, &context);
+}
+
+template <class RANDOM_ITER, class OUTPUT_ITER, class UNARY_OPERATION>
+OUTPUT_ITER ParallelAlgorithmUtil::transform(FixedThreadPool *pool,
+                                             RANDOM_ITER      first,
+                                             RANDOM_ITER      last,
+                                             OUTPUT_ITER      result,
+                                             UNARY_OPERATION  operation)
+{
+    BSLS_ASSERT(pool);
+
+    typedef ParallelAlgorithmUtil_Impl                          Impl;
+    typedef Impl::TransformContext<RANDOM_ITER,
+                                   OUTPUT_ITER,
+                                   UNARY_OPERATION>             Context;
+
+    const Impl::Int64 numElements = last - first;
+    if (0 == numElements) {
+        return result;                                                // RETURN
+    }
+
+    Context context;
+    context.d_first       = first;
+    context.d_result      = result;
+    context.d_numElements = numElements;
+    context.d_numTasks    = Impl::numTasks(*pool, numElements);
+    context.d_operation_p = &operation;
+
+    Impl::execute(pool, context.d_numTasks, &Context::run, &context);
+
+    return result + numElements;
+}
+
+template <class RANDOM_ITER, class VALUE>
+inline
+VALUE ParallelAlgorithmUtil::reduce(FixedThreadPool *pool,
+                                    RANDOM_ITER      first,
+                                    RANDOM_ITER      last,
+                                    VALUE            initialValue)
+{
+    return reduce(pool, first, last, initialValue, bsl::plus<VALUE>());
+}
+
+template <class RANDOM_ITER, class VALUE, class BINARY_OPERATION>
+VALUE ParallelAlgorithmUtil::reduce(FixedThreadPool  *pool,
+                                    RANDOM_ITER       first,
+                                    RANDOM_ITER       last,
+                                    VALUE             initialValue,
+                                    BINARY_OPERATION  operation,
+                                    bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(pool);
+
+    typedef ParallelAlgorithmUtil_Impl                          Impl;
+    typedef Impl::ReduceContext<RANDOM_ITER,
+                                VALUE,
+                                BINARY_OPERATION>               Context;
+
+    const Impl::Int64 numElements = last - first;
+    if (0 == numElements) {
+        return initialValue;                                          // RETURN
+    }
+
+    const int numTasks = Impl::numTasks(*pool, numElements);
+
+    bsl::vector<VALUE> partials(numTasks, initialValue, basicAllocator);
+
+    Context context;
+    context.d_first       = first;
+    context.d_numElements = numElements;
+    context.d_numTasks    = numTasks;
+    context.d_operation_p = &operation;
+    context.d_partials_p  = partials.data();
+
+    Impl::execute(pool, numTasks, &Context::run, &context);
+
+    for (int i = 0; i < numTasks; ++i) {
+        initialValue = operation(initialValue, partials[i]);
+    }
+
+    return initialValue;
+}
+
+template <class RANDOM_ITER, class OUTPUT_ITER>
+inline
+OUTPUT_ITER ParallelAlgorithmUtil::inclusiveScan(FixedThreadPool *pool,
+                                                 RANDOM_ITER      first,
+                                                 RANDOM_ITER      last,
+                                                 OUTPUT_ITER      result)
+{
+    typedef typename bsl::iterator_traits<RANDOM_ITER>::value_type Value;
+
+    return inclusiveScan(pool, first, last, result, bsl::plus<Value>());
+}
+
+template <class RANDOM_ITER, class OUTPUT_ITER, class BINARY_OPERATION>
+OUTPUT_ITER ParallelAlgorithmUtil::inclusiveScan(
+                                             FixedThreadPool  *pool,
+                                             RANDOM_ITER       first,
+                                             RANDOM_ITER       last,
+                                             OUTPUT_ITER       result,
+                                             BINARY_OPERATION  operation,
+                                             bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(pool);
+
+    typedef ParallelAlgorithmUtil_Impl                              Impl;
+    typedef typename bsl::iterator_traits<RANDOM_ITER>::value_type  Value;
+    typedef Impl::ReduceContext<RANDOM_ITER,
+                                Value,
+                                BINARY_OPERATION>                   Reduce;
+    typedef Impl::ScanContext<RANDOM_ITER,
+                              OUTPUT_ITER,
+                              BINARY_OPERATION>                     Scan;
+
+    const Impl::Int64 numElements = last - first;
+    if (0 == numElements) {
+        return result;                                                // RETURN
+    }
+
+    const int numTasks = Impl::numTasks(*pool, numElements);
+
+    bsl::vector<Value> partials(basicAllocator);
+
+    if (1 < numTasks) {
+        // Compute the total of each chunk but the last, then the running
+        // totals of those.
+
+        partials.resize(numTasks - 1, *first);
+
+        Reduce reduceContext;
+        reduceContext.d_first       = first;
+        reduceContext.d_numElements = numElements;
+        reduceContext.d_numTasks    = numTasks;
+        reduceContext.d_operation_p = &operation;
+        reduceContext.d_partials_p  = partials.data();
+
+        Impl::execute(pool, numTasks - 1, &Reduce::run, &reduceContext);
+
+        for (int i = 1; i < numTasks - 1; ++i) {
+            partials[i] = operation(partials[i - 1], partials[i]);
+        }
+    }
+
+    Scan scanContext;
+    scanContext.d_first       = first;
+    scanContext.d_result      = result;
+    scanContext.d_numElements = numElements;
+    scanContext.d_numTasks    = numTasks;
+    scanContext.d_operation_p = &operation;
+    scanContext.d_offsets_p   = partials.data();
+
+    Impl::execute(pool, numTasks, &Scan::run, &scanContext);
+
+    return result + numElements;
+}
+
+template <class RANDOM_ITER>
+inline
+void ParallelAlgorithmUtil::sort(FixedThreadPool *pool,
+                                 RANDOM_ITER      first,
+                                 RANDOM_ITER      last)
+{
+    typedef typename bsl::iterator_traits<RANDOM_ITER>::value_type Value;
+
+    sort(pool, first, last, bsl::less<Value>());
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+void ParallelAlgorithmUtil::sort(FixedThreadPool  *pool,
+                                 RANDOM_ITER       first,
+                                 RANDOM_ITER       last,
+                                 COMPARATOR        comparator,
+                                 bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(pool);
+
+    typedef ParallelAlgorithmUtil_Impl                              Impl;
+    typedef typename bsl::iterator_traits<RANDOM_ITER>::value_type  Value;
+    typedef Impl::SortContext<RANDOM_ITER, COMPARATOR>              Sort;
+    typedef Impl::MergeContext<RANDOM_ITER, Value *, COMPARATOR>    MergeOut;
+    typedef Impl::MergeContext<Value *, RANDOM_ITER, COMPARATOR>    MergeIn;
+    typedef Impl::SortFinishContext<RANDOM_ITER>                    Finish;
+
+    const Impl::Int64 numElements = last - first;
+    const int         numTasks    = Impl::numTasks(*pool, numElements);
+
+    if (numTasks < 2) {
+        bsl::sort(first, last, comparator);
+        return;                                                       // RETURN
+    }
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    // Sort each chunk, copying the sorted chunk into the scratch buffer.
+
+    Value *buffer = static_cast<Value *>(
+                             allocator->allocate(numElements * sizeof(Value)));
+
+    Sort sortContext;
+    sortContext.d_first        = first;
+    sortContext.d_numElements  = numElements;
+    sortContext.d_numTasks     = numTasks;
+    sortContext.d_comparator_p = &comparator;
+    sortContext.d_buffer_p     = buffer;
+    sortContext.d_allocator_p  = allocator;
+
+    Impl::execute(pool, numTasks, &Sort::run, &sortContext);
+
+    // Merge adjacent runs, alternately from the buffer into the range and
+    // from the range into the buffer, until there is a single run.
+
+    bsl::vector<Impl::Int64>     runs(allocator);
+    bsl::vector<Impl::MergeItem> items(allocator);
+
+    runs.reserve(numTasks + 1);
+    for (int i = 0; i < numTasks; ++i) {
+        Impl::Int64 begin, end;
+        Impl::chunk(&begin, &end, numElements, numTasks, i);
+        runs.push_back(begin);
+    }
+    runs.push_back(numElements);
+
+    bool inBuffer = true;
+    while (runs.size() > 2) {
+        Impl::makeMergeItems(&items, &runs, numElements, numTasks);
+
+        const int numItems = static_cast<int>(items.size());
+
+        if (inBuffer) {
+            MergeIn mergeContext;
+            mergeContext.d_source       = buffer;
+            mergeContext.d_destination  = first;
+            mergeContext.d_items_p      = items.data();
+            mergeContext.d_comparator_p = &comparator;
+
+            Impl::execute(pool, numItems, &MergeIn::run, &mergeContext);
+        }
+        else {
+            MergeOut mergeContext;
+            mergeContext.d_source       = first;
+            mergeContext.d_destination  = buffer;
+            mergeContext.d_items_p      = items.data();
+            mergeContext.d_comparator_p = &comparator;
+
+            Impl::execute(pool, numItems, &MergeOut::run, &mergeContext);
+        }
+        inBuffer = !inBuffer;
+    }
+
+    // Copy the result back into the range if necessary, and destroy the
+    // buffer.
+
+    Finish finishContext;
+    finishContext.d_first       = first;
+    finishContext.d_numElements = numElements;
+    finishContext.d_numTasks    = numTasks;
+    finishContext.d_buffer_p    = buffer;
+    finishContext.d_copyBack    = inBuffer;
+
+    Impl::execute(pool, numTasks, &Finish::run, &finishContext);
+
+    allocator->deallocate(buffer);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
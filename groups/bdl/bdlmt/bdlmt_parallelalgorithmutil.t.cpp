@@ -0,0 +1,1243 @@
+// bdlmt_parallelalgorithmutil.t.cpp                                  -*-C++-*-
+#include <bdlmt_parallelalgorithmutil.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_numeric.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides parallel versions of standard algorithms
+// implemented by dividing a range into chunks and running a task per chunk on
+// a 'bdlmt::FixedThreadPool'.  We first test the private helpers that divide
+// the work and run the tasks, then verify each algorithm against its serial
+// counterpart for ranges of a variety of lengths (including lengths that do
+// not divide evenly among tasks, and lengths small enough to be processed
+// without the pool), for pools having a variety of numbers of threads, and
+// for a pool that is not started.  Operations that are associative but not
+// commutative are used to verify that 'reduce' and 'inclusiveScan' combine
+// elements in order.  For 'sort', we additionally verify that scratch memory
+// is obtained from the supplied allocator, using an element type that
+// allocates memory.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] void forEach(FixedThreadPool *, RANDOM_ITER, RANDOM_ITER, FUNC);
+// [ 5] OUTPUT_ITER transform(FixedThreadPool *, IT, IT, OUTPUT_ITER, OP);
+// [ 6] VALUE reduce(FixedThreadPool *, IT, IT, VALUE);
+// [ 6] VALUE reduce(FixedThreadPool *, IT, IT, VALUE, OP, Allocator *);
+// [ 7] OUTPUT_ITER inclusiveScan(FixedThreadPool *, IT, IT, OUTPUT_ITER);
+// [ 7] OUTPUT_ITER inclusiveScan(Pool *, IT, IT, OUT, OP, Allocator *);
+// [ 8] void sort(FixedThreadPool *, RANDOM_ITER, RANDOM_ITER);
+// [ 8] void sort(FixedThreadPool *, IT, IT, COMPARATOR, Allocator *);
+//
+// ParallelAlgorithmUtil_Impl
+// [ 2] void chunk(Int64 *, Int64 *, Int64, int, int);
+// [ 2] int numTasks(const FixedThreadPool&, Int64);
+// [ 2] Int64 mergePath(IT, Int64, IT, Int64, Int64, COMPARATOR *);
+// [ 2] void makeMergeItems(vector<MergeItem> *, vector<Int64> *, Int64, int);
+// [ 3] void execute(FixedThreadPool *, int, TaskFunction, void *);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: PARALLEL VS. SERIAL ALGORITHMS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::ParallelAlgorithmUtil      Util;
+typedef bdlmt::ParallelAlgorithmUtil_Impl Impl;
+typedef bsls::Types::Int64                Int64;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+const int MIN = Util::k_MIN_ELEMENTS_PER_TASK;
+
+// Range lengths exercising small ranges, ranges of a few chunks, and ranges
+// that do not divide evenly.
+
+const int LENGTHS[] = { 0, 1, 2, 17, MIN - 1, MIN, MIN + 1, 3 * MIN + 7,
+                        10 * MIN + 3, 64 * MIN + 11 };
+const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+// Numbers of threads in the pools used, where 0 denotes a pool having one
+// thread that is not started.
+
+const int NUM_THREADS[] = { 0, 1, 2, 3, 7 };
+const int NUM_NUM_THREADS = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear congruential 'state' and return a value in
+    // the range '[0, 2^15)'.
+{
+    *state = *state * 1103515245U + 12345U;
+    return (*state >> 16) & 0x7FFF;
+}
+
+void fillRandom(bsl::vector<int> *values, int length, int modulus)
+    // Load into the specified 'values' the specified 'length' pseudo-random
+    // integers in the range '[0, modulus)'.
+{
+    unsigned int state = static_cast<unsigned int>(length) + 1;
+
+    values->resize(length);
+    for (int i = 0; i < length; ++i) {
+        (*values)[i] = static_cast<int>(
+                          ((nextRandom(&state) << 15) | nextRandom(&state))
+                          % static_cast<unsigned int>(modulus));
+    }
+}
+
+struct Increment {
+    // This functor increments its argument.
+
+    void operator()(int& value) const
+        // Increment the specified 'value'.
+    {
+        ++value;
+    }
+};
+
+struct CountCalls {
+    // This functor counts the number of times it is invoked.
+
+    bsls::AtomicInt *d_count_p;
+
+    void operator()(const int&) const
+        // Increment the counter.
+    {
+        ++*d_count_p;
+    }
+};
+
+struct Square {
+    // This functor returns the square of its argument.
+
+    Int64 operator()(int value) const
+        // Return the square of the specified 'value'.
+    {
+        return static_cast<Int64>(value) * value;
+    }
+};
+
+struct LastNonZero {
+    // This functor implements an associative, but not commutative, binary
+    // operation: the result is the second argument unless it is zero.
+
+    int operator()(int lhs, int rhs) const
+        // Return the specified 'rhs' if it is not zero, and the specified
+        // 'lhs' otherwise.
+    {
+        return 0 != rhs ? rhs : lhs;
+    }
+};
+
+struct Concatenate {
+    // This functor implements string concatenation.
+
+    bsl::string operator()(const bsl::string& lhs,
+                           const bsl::string& rhs) const
+        // Return the concatenation of the specified 'lhs' and 'rhs'.
+    {
+        return lhs + rhs;
+    }
+};
+
+struct ByValue {
+    // This functor orders integers by their value divided by 100.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' divided by 100 is less than the
+        // specified 'rhs' divided by 100, and 'false' otherwise.
+    {
+        return lhs / 100 < rhs / 100;
+    }
+};
+
+struct TaskRecord {
+    // This 'struct' records the tasks run by 'recordTask'.
+
+    bsls::AtomicInt d_counts[64];
+};
+
+void recordTask(void *context, int taskIndex)
+    // Record in the 'TaskRecord' addressed by the specified 'context' that the
+    // task having the specified 'taskIndex' was run.
+{
+    ++static_cast<TaskRecord *>(context)->d_counts[taskIndex];
+}
+
+struct PoolHolder {
+    // This 'struct' owns a 'bdlmt::FixedThreadPool', started or not as
+    // specified on construction.
+
+    bdlmt::FixedThreadPool d_pool;
+
+    PoolHolder(int numThreads, bslma::Allocator *allocator)
+        // Create a pool having the specified 'numThreads' threads, started,
+        // or having one thread, not started, if 'numThreads' is 0.  Use the
+        // specified 'allocator' to supply memory.
+    : d_pool(numThreads ? numThreads : 1, 1000, allocator)
+    {
+        if (numThreads) {
+            int rc = d_pool.start();
+            ASSERT(0 == rc);
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Processing a Large Data Set
+/// - - - - - - - - - - - - - - - - - - -
+// In this example, we sort a large set of values, and compute their sum and
+// running totals, using all the threads of a pool.
+//
+// First, we create and start a pool:
+//..
+    bdlmt::FixedThreadPool pool(4, 100);
+
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Then, we create our data set, the integers from 0 to 'k_NUM_VALUES - 1' in
+// descending order:
+//..
+    enum { k_NUM_VALUES = 1000000 };
+
+    bsl::vector<bsls::Types::Int64> values(k_NUM_VALUES);
+    for (int i = 0; i < k_NUM_VALUES; ++i) {
+        values[i] = k_NUM_VALUES - 1 - i;
+    }
+//..
+// Next, we sort the data set in parallel:
+//..
+    bdlmt::ParallelAlgorithmUtil::sort(&pool, values.begin(), values.end());
+
+    ASSERT(0                == values.front());
+    ASSERT(k_NUM_VALUES - 1 == values.back());
+//..
+// Then, we compute, in parallel, the sum of the values:
+//..
+    bsls::Types::Int64 sum = bdlmt::ParallelAlgorithmUtil::reduce(
+                                                      &pool,
+                                                      values.begin(),
+                                                      values.end(),
+                                                      bsls::Types::Int64(0));
+
+    ASSERT(bsls::Types::Int64(k_NUM_VALUES) * (k_NUM_VALUES - 1) / 2 == sum);
+//..
+// Finally, we replace the values with their running totals, in place:
+//..
+    bdlmt::ParallelAlgorithmUtil::inclusiveScan(&pool,
+                                                values.begin(),
+                                                values.end(),
+                                                values.begin());
+
+    ASSERT(sum == values.back());
+    ASSERT(3   == values[3] - values[2]);
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // 'sort'
+        //
+        // Concerns:
+        //: 1 'sort' leaves the range sorted, and a permutation of the input,
+        //:   for any length of range and number of threads.
+        //:
+        //: 2 The comparator, if supplied, is used.
+        //:
+        //: 3 Ranges having many equivalent elements are sorted correctly.
+        //:
+        //: 4 Scratch memory, including the copies of elements, is supplied by
+        //:   the specified allocator, and is released.
+        //
+        // Plan:
+        //: 1 For each length and number of threads, sort pseudo-random
+        //:   integers drawn from a large and from a small set of values, with
+        //:   and without a comparator, and compare the result with that of
+        //:   'bsl::sort'.  (C-1..3)
+        //:
+        //: 2 Sort a range of 'bsl::string' objects, long enough to allocate
+        //:   memory, with a test allocator supplied; verify that the default
+        //:   allocator is not used and that the test allocator was used and
+        //:   has no blocks in use afterwards.  (C-4)
+        //
+        // Testing:
+        //   void sort(FixedThreadPool *, RANDOM_ITER, RANDOM_ITER);
+        //   void sort(FixedThreadPool *, IT, IT, COMPARATOR, Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'sort'" << endl
+                          << "======" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_NUM_THREADS; ++ti) {
+            PoolHolder holder(NUM_THREADS[ti], &ta);
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH = LENGTHS[li];
+
+                for (int mi = 0; mi < 2; ++mi) {
+                    const int MODULUS = mi ? 7 : 1 << 30;
+
+                    bsl::vector<int> values(&ta);
+                    fillRandom(&values, LENGTH, MODULUS);
+
+                    bsl::vector<int> expected(values, &ta);
+                    bsl::sort(expected.begin(), expected.end());
+
+                    bsl::vector<int> mX(values, &ta);
+                    Util::sort(&holder.d_pool, mX.begin(), mX.end());
+                    ASSERTV(NUM_THREADS[ti], LENGTH, MODULUS, expected == mX);
+
+                    bsl::sort(expected.begin(),
+                              expected.end(),
+                              bsl::greater<int>());
+
+                    mX = values;
+                    Util::sort(&holder.d_pool,
+                               mX.begin(),
+                               mX.end(),
+                               bsl::greater<int>(),
+                               &sa);
+                    ASSERTV(NUM_THREADS[ti], LENGTH, MODULUS, expected == mX);
+                    ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+                }
+            }
+        }
+
+        if (verbose) cout << "\tAllocator propagation." << endl;
+        {
+            PoolHolder holder(3, &ta);
+
+            const int LENGTH = 8 * MIN;
+
+            bsl::vector<int> values(&ta);
+            fillRandom(&values, LENGTH, 1 << 30);
+
+            bsl::vector<bsl::string> mX(&ta);
+            mX.reserve(LENGTH);
+            for (int i = 0; i < LENGTH; ++i) {
+                bsl::string s("a string long enough to allocate memory: ",
+                              &ta);
+                s.push_back(static_cast<char>('a' + values[i] % 26));
+                s.push_back(static_cast<char>('a' + values[i] / 26 % 26));
+                s.push_back(static_cast<char>('a' + values[i] / 676 % 26));
+                mX.push_back(s);
+            }
+            bsl::vector<bsl::string> expected(mX, &ta);
+            bsl::sort(expected.begin(), expected.end());
+
+            const Int64 numAllocations = sa.numAllocations();
+
+            const Int64 numDefault = defaultAllocator.numAllocations();
+
+            Util::sort(&holder.d_pool,
+                       mX.begin(),
+                       mX.end(),
+                       bsl::less<bsl::string>(),
+                       &sa);
+
+            ASSERT(expected == mX);
+            ASSERTV(numDefault == defaultAllocator.numAllocations());
+            ASSERTV(LENGTH < sa.numAllocations() - numAllocations);
+            ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'inclusiveScan'
+        //
+        // Concerns:
+        //: 1 'inclusiveScan' produces the running totals of the range, for any
+        //:   length of range and number of threads, and returns the end of
+        //:   the output range.
+        //:
+        //: 2 Elements are combined in order.
+        //:
+        //: 3 The output range may be the input range.
+        //:
+        //: 4 Scratch memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 For each length and number of threads, compute the running totals
+        //:   of pseudo-random integers, into a separate output range and in
+        //:   place, and compare with the serially computed result.  (C-1, 3)
+        //:
+        //: 2 Repeat P-1 using the associative, but not commutative,
+        //:   'LastNonZero' operation on sparse data, supplying a test
+        //:   allocator, and verify that the test allocator is used only when
+        //:   the range is processed in more than one chunk.  (C-2, 4)
+        //
+        // Testing:
+        //   OUTPUT_ITER inclusiveScan(FixedThreadPool *, IT, IT, OUTPUT_ITER);
+        //   OUTPUT_ITER inclusiveScan(Pool *, IT, IT, OUT, OP, Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'inclusiveScan'" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_NUM_THREADS; ++ti) {
+            PoolHolder holder(NUM_THREADS[ti], &ta);
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH = LENGTHS[li];
+
+                bsl::vector<int> values(&ta);
+                fillRandom(&values, LENGTH, 1000);
+
+                bsl::vector<int> expected(&ta);
+                expected.resize(LENGTH);
+                for (int i = 0; i < LENGTH; ++i) {
+                    expected[i] = values[i] + (i ? expected[i - 1] : 0);
+                }
+
+                bsl::vector<int> output(&ta);
+                output.resize(LENGTH);
+
+                bsl::vector<int>::iterator end = Util::inclusiveScan(
+                                                              &holder.d_pool,
+                                                              values.begin(),
+                                                              values.end(),
+                                                              output.begin());
+                ASSERTV(NUM_THREADS[ti], LENGTH, output.end() == end);
+                ASSERTV(NUM_THREADS[ti], LENGTH, expected == output);
+
+                bsl::vector<int> mX(values, &ta);
+                Util::inclusiveScan(&holder.d_pool,
+                                    mX.begin(),
+                                    mX.end(),
+                                    mX.begin());
+                ASSERTV(NUM_THREADS[ti], LENGTH, expected == mX);
+
+                // Non-commutative operation on sparse data.
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    if (values[i] % 97) {
+                        values[i] = 0;
+                    }
+                    expected[i] = LastNonZero()(i ? expected[i - 1] : 0,
+                                                values[i]);
+                }
+
+                const Int64 numAllocations = sa.numAllocations();
+
+                Util::inclusiveScan(&holder.d_pool,
+                                    values.begin(),
+                                    values.end(),
+                                    output.begin(),
+                                    LastNonZero(),
+                                    &sa);
+                ASSERTV(NUM_THREADS[ti], LENGTH, expected == output);
+
+                const bool MULTIPLE =
+                          1 < Impl::numTasks(holder.d_pool, LENGTH);
+                ASSERTV(NUM_THREADS[ti], LENGTH,
+                        MULTIPLE == (numAllocations < sa.numAllocations()));
+                ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+            }
+        }
+
+        // Only the overload not taking an allocator uses the default
+        // allocator.
+
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'reduce'
+        //
+        // Concerns:
+        //: 1 'reduce' returns the combination of the initial value and all the
+        //:   elements, for any length of range and number of threads.
+        //:
+        //: 2 Elements are combined in order.
+        //:
+        //: 3 The initial value is returned for an empty range.
+        //:
+        //: 4 Scratch memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 For each length and number of threads, sum pseudo-random integers
+        //:   and compare with the serially computed sum.  (C-1, 3)
+        //:
+        //: 2 For each length and number of threads, concatenate a range of
+        //:   short strings using a test allocator, and compare with the
+        //:   serially computed concatenation.  (C-2, 4)
+        //
+        // Testing:
+        //   VALUE reduce(FixedThreadPool *, IT, IT, VALUE);
+        //   VALUE reduce(FixedThreadPool *, IT, IT, VALUE, OP, Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'reduce'" << endl
+                          << "========" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_NUM_THREADS; ++ti) {
+            PoolHolder holder(NUM_THREADS[ti], &ta);
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH = LENGTHS[li];
+
+                bsl::vector<int> values(&ta);
+                fillRandom(&values, LENGTH, 1 << 20);
+
+                Int64 expected = 17;
+                for (int i = 0; i < LENGTH; ++i) {
+                    expected += values[i];
+                }
+
+                const Int64 result = Util::reduce(&holder.d_pool,
+                                                  values.begin(),
+                                                  values.end(),
+                                                  Int64(17));
+                ASSERTV(NUM_THREADS[ti], LENGTH, expected == result);
+
+                // Non-commutative operation.
+
+                bsl::vector<bsl::string> strings(&ta);
+                strings.reserve(LENGTH);
+
+                bsl::string expectedString("<", &ta);
+                for (int i = 0; i < LENGTH; ++i) {
+                    strings.push_back(bsl::string(
+                                    1,
+                                    static_cast<char>('a' + values[i] % 26)));
+                    expectedString += strings.back();
+                }
+
+                bslma::DefaultAllocatorGuard guard(&sa);
+
+                const bsl::string resultString = Util::reduce(
+                                                         &holder.d_pool,
+                                                         strings.begin(),
+                                                         strings.end(),
+                                                         bsl::string("<"),
+                                                         Concatenate(),
+                                                         &sa);
+                ASSERTV(NUM_THREADS[ti], LENGTH,
+                        expectedString == resultString);
+            }
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'transform'
+        //
+        // Concerns:
+        //: 1 'transform' assigns the result of the operation on each element
+        //:   to the corresponding output element, for any length of range and
+        //:   number of threads, and returns the end of the output range.
+        //:
+        //: 2 The output range may be the input range.
+        //:
+        //: 3 No memory is allocated.
+        //
+        // Plan:
+        //: 1 For each length and number of threads, square pseudo-random
+        //:   integers into a separate output range, and compare with the
+        //:   serially computed result.  (C-1)
+        //:
+        //: 2 Negate a range in place.  (C-2)
+        //:
+        //: 3 Verify that the default allocator is not used.  (C-3)
+        //
+        // Testing:
+        //   OUTPUT_ITER transform(FixedThreadPool *, IT, IT, OUTPUT_ITER, OP);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'transform'" << endl
+                          << "===========" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_NUM_THREADS; ++ti) {
+            PoolHolder holder(NUM_THREADS[ti], &ta);
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH = LENGTHS[li];
+
+                bsl::vector<int> values(&ta);
+                fillRandom(&values, LENGTH, 1 << 30);
+
+                bsl::vector<Int64> output(&ta);
+                output.resize(LENGTH);
+
+                bsl::vector<Int64>::iterator end = Util::transform(
+                                                              &holder.d_pool,
+                                                              values.begin(),
+                                                              values.end(),
+                                                              output.begin(),
+                                                              Square());
+                ASSERTV(NUM_THREADS[ti], LENGTH, output.end() == end);
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    ASSERTV(NUM_THREADS[ti], LENGTH, i,
+                            Square()(values[i]) == output[i]);
+                }
+
+                bsl::vector<int> mX(values, &ta);
+                Util::transform(&holder.d_pool,
+                                mX.begin(),
+                                mX.end(),
+                                mX.begin(),
+                                bsl::negate<int>());
+                for (int i = 0; i < LENGTH; ++i) {
+                    ASSERTV(NUM_THREADS[ti], LENGTH, i, -values[i] == mX[i]);
+                }
+            }
+        }
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'forEach'
+        //
+        // Concerns:
+        //: 1 'forEach' invokes the functor exactly once on each element, for
+        //:   any length of range and number of threads.
+        //:
+        //: 2 The functor may modify the elements.
+        //:
+        //: 3 No memory is allocated.
+        //
+        // Plan:
+        //: 1 For each length and number of threads, increment each element of
+        //:   a range of integers and verify the result; count the invocations
+        //:   of a functor.  (C-1..2)
+        //:
+        //: 2 Verify that the default allocator is not used.  (C-3)
+        //
+        // Testing:
+        //   void forEach(FixedThreadPool *, RANDOM_ITER, RANDOM_ITER, FUNC);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'forEach'" << endl
+                          << "=========" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_NUM_THREADS; ++ti) {
+            PoolHolder holder(NUM_THREADS[ti], &ta);
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH = LENGTHS[li];
+
+                bsl::vector<int> mX(&ta);
+                mX.resize(LENGTH);
+                for (int i = 0; i < LENGTH; ++i) {
+                    mX[i] = i;
+                }
+
+                Util::forEach(&holder.d_pool,
+                              mX.begin(),
+                              mX.end(),
+                              Increment());
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    ASSERTV(NUM_THREADS[ti], LENGTH, i, i + 1 == mX[i]);
+                }
+
+                bsls::AtomicInt count(0);
+                CountCalls      counter = { &count };
+
+                Util::forEach(&holder.d_pool, mX.begin(), mX.end(), counter);
+                ASSERTV(NUM_THREADS[ti], LENGTH, count, LENGTH == count);
+            }
+        }
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'ParallelAlgorithmUtil_Impl::execute'
+        //
+        // Concerns:
+        //: 1 Each task index in '[0, numTasks)' is run exactly once, and all
+        //:   tasks have completed when 'execute' returns.
+        //:
+        //: 2 Tasks are run on the calling thread if the pool does not accept
+        //:   them.
+        //:
+        //: 3 No memory is obtained from the default allocator.
+        //
+        // Plan:
+        //: 1 For a variety of numbers of tasks, run tasks that record their
+        //:   indices, on a started pool and on a pool that is not started, and
+        //:   verify the records.  (C-1..2)
+        //:
+        //: 2 Verify that the default allocator is not used.  (C-3)
+        //
+        // Testing:
+        //   void execute(FixedThreadPool *, int, TaskFunction, void *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'ParallelAlgorithmUtil_Impl::execute'" << endl
+                          << "=====================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_NUM_THREADS; ++ti) {
+            PoolHolder holder(NUM_THREADS[ti], &ta);
+
+            for (int numTasks = 1; numTasks <= 64; numTasks += 7) {
+                TaskRecord record;
+                for (int i = 0; i < 64; ++i) {
+                    record.d_counts[i] = 0;
+                }
+
+                Impl::execute(&holder.d_pool, numTasks, &recordTask, &record);
+
+                for (int i = 0; i < 64; ++i) {
+                    ASSERTV(NUM_THREADS[ti], numTasks, i, record.d_counts[i],
+                            (i < numTasks) == record.d_counts[i]);
+                }
+            }
+        }
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'ParallelAlgorithmUtil_Impl' HELPERS
+        //
+        // Concerns:
+        //: 1 'chunk' divides a range into contiguous chunks that cover the
+        //:   range and whose sizes differ by at most one.
+        //:
+        //: 2 'numTasks' returns one more than the number of threads in the
+        //:   pool, except that no task has fewer than
+        //:   'k_MIN_ELEMENTS_PER_TASK' elements, and the result is at least 1.
+        //:
+        //: 3 'mergePath' returns the number of elements taken from the first
+        //:   range by 'bsl::merge' among the first 'diagonal' outputs,
+        //:   including when the ranges have equivalent elements.
+        //:
+        //: 4 'makeMergeItems' produces pieces that exactly cover each pair of
+        //:   runs, and halves the number of runs (rounding up).
+        //
+        // Plan:
+        //: 1 Use the table-driven technique to verify 'chunk' and 'numTasks'.
+        //:   (C-1..2)
+        //:
+        //: 2 For all diagonals of pairs of short sorted sequences having
+        //:   duplicates, compare 'mergePath' with the result of merging
+        //:   sequences of tagged elements using 'bsl::merge'.  (C-3)
+        //:
+        //: 3 Call 'makeMergeItems' repeatedly on a variety of run boundaries,
+        //:   and verify the pieces and the new boundaries.  (C-4)
+        //
+        // Testing:
+        //   void chunk(Int64 *, Int64 *, Int64, int, int);
+        //   int numTasks(const FixedThreadPool&, Int64);
+        //   Int64 mergePath(IT, Int64, IT, Int64, Int64, COMPARATOR *);
+        //   void makeMergeItems(vector<MergeItem> *, vector<Int64> *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'ParallelAlgorithmUtil_Impl' HELPERS" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\t'chunk'." << endl;
+        {
+            const Int64 NUM_ELEMENTS[] = { 0, 1, 7, 100, 4096, 1000003 };
+            const int   NUM_DATA = sizeof NUM_ELEMENTS / sizeof *NUM_ELEMENTS;
+
+            for (int di = 0; di < NUM_DATA; ++di) {
+                for (int numTasks = 1; numTasks <= 17; ++numTasks) {
+                    Int64 previousEnd = 0;
+                    Int64 minSize = NUM_ELEMENTS[di], maxSize = 0;
+
+                    for (int t = 0; t < numTasks; ++t) {
+                        Int64 begin, end;
+                        Impl::chunk(&begin,
+                                    &end,
+                                    NUM_ELEMENTS[di],
+                                    numTasks,
+                                    t);
+                        ASSERTV(di, numTasks, t, previousEnd == begin);
+                        ASSERTV(di, numTasks, t, begin <= end);
+                        previousEnd = end;
+                        minSize = bsl::min(minSize, end - begin);
+                        maxSize = bsl::max(maxSize, end - begin);
+                    }
+                    ASSERTV(di, numTasks, NUM_ELEMENTS[di] == previousEnd);
+                    ASSERTV(di, numTasks, maxSize - minSize <= 1);
+                }
+            }
+        }
+
+        if (verbose) cout << "\t'numTasks'." << endl;
+        {
+            static const struct {
+                int   d_line;
+                int   d_numThreads;
+                Int64 d_numElements;
+                int   d_expected;
+            } DATA[] = {
+                { L_, 1,                0, 1 },
+                { L_, 1,              100, 1 },
+                { L_, 1,      2 * MIN - 1, 1 },
+                { L_, 1,          2 * MIN, 2 },
+                { L_, 1,     1000000 * 10, 2 },
+                { L_, 4,          3 * MIN, 3 },
+                { L_, 4,      5 * MIN - 1, 4 },
+                { L_, 4,          5 * MIN, 5 },
+                { L_, 4,     1000000 * 10, 5 },
+                { L_, 8,              MIN, 1 },
+                { L_, 8,     1000000 * 10, 9 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int di = 0; di < NUM_DATA; ++di) {
+                const int LINE = DATA[di].d_line;
+
+                bdlmt::FixedThreadPool pool(DATA[di].d_numThreads, 10, &ta);
+
+                ASSERTV(LINE, DATA[di].d_expected ==
+                              Impl::numTasks(pool, DATA[di].d_numElements));
+            }
+        }
+
+        if (verbose) cout << "\t'mergePath'." << endl;
+        {
+            // Elements are encoded as 'value * 100 + position', with
+            // positions in the second sequence offset by 50, and compared by
+            // value only, so that the merged output reveals the origin of
+            // each element.
+
+            const char *SPECS[] = { "", "1", "11", "13", "123", "1223",
+                                    "2", "22", "000", "1133", "0246" };
+            const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+            for (int i1 = 0; i1 < NUM_SPECS; ++i1) {
+                for (int i2 = 0; i2 < NUM_SPECS; ++i2) {
+                    bsl::vector<int> a(&ta), b(&ta), merged(&ta);
+                    for (const char *p = SPECS[i1]; *p; ++p) {
+                        a.push_back((*p - '0') * 100 + int(p - SPECS[i1]));
+                    }
+                    for (const char *p = SPECS[i2]; *p; ++p) {
+                        b.push_back((*p - '0') * 100 + 50
+                                                     + int(p - SPECS[i2]));
+                    }
+                    merged.resize(a.size() + b.size());
+                    bsl::merge(a.begin(),
+                               a.end(),
+                               b.begin(),
+                               b.end(),
+                               merged.begin(),
+                               ByValue());
+
+                    ByValue comparator;
+                    Int64   fromFirst = 0;
+                    for (Int64 d = 0;
+                         d <= static_cast<Int64>(merged.size());
+                         ++d) {
+                        if (d > 0 && merged[d - 1] % 100 < 50) {
+                            ++fromFirst;
+                        }
+
+                        const Int64 result = Impl::mergePath(
+                                                               a.begin(),
+                                                               Int64(a.size()),
+                                                               b.begin(),
+                                                               Int64(b.size()),
+                                                               d,
+                                                               &comparator);
+                        ASSERTV(SPECS[i1], SPECS[i2], d, result, fromFirst,
+                                fromFirst == result);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\t'makeMergeItems'." << endl;
+        {
+            for (int numRuns = 2; numRuns <= 9; ++numRuns) {
+                for (int numTasks = 1; numTasks <= 9; ++numTasks) {
+                    const Int64 NUM_ELEMENTS = 1000 + numRuns;
+
+                    bsl::vector<Int64> runs(&ta);
+                    for (int r = 0; r < numRuns; ++r) {
+                        Int64 begin, end;
+                        Impl::chunk(&begin, &end, NUM_ELEMENTS, numRuns, r);
+                        runs.push_back(begin);
+                    }
+                    runs.push_back(NUM_ELEMENTS);
+
+                    bsl::vector<Impl::MergeItem> items(&ta);
+
+                    while (runs.size() > 2) {
+                        const bsl::vector<Int64> previous(runs, &ta);
+                        const int currentRuns = int(runs.size()) - 1;
+
+                        Impl::makeMergeItems(&items,
+                                             &runs,
+                                             NUM_ELEMENTS,
+                                             numTasks);
+
+                        ASSERTV(numRuns, numTasks,
+                                (currentRuns + 1) / 2 + 1 ==
+                                                         int(runs.size()));
+
+                        // The pieces cover the whole output contiguously.
+
+                        Int64 position = 0;
+                        for (bsl::size_t i = 0; i < items.size(); ++i) {
+                            const Impl::MergeItem& item = items[i];
+                            ASSERTV(numRuns, numTasks, i,
+                                    position == item.d_first + item.d_begin);
+                            ASSERTV(numRuns, numTasks, i,
+                                    item.d_begin < item.d_end);
+                            ASSERTV(numRuns, numTasks, i,
+                                    item.d_end <= item.d_last - item.d_first);
+                            position = item.d_first + item.d_end;
+                        }
+                        ASSERTV(numRuns, numTasks, NUM_ELEMENTS == position);
+
+                        for (int r = 0; r + 1 < int(runs.size()); ++r) {
+                            ASSERTV(numRuns, numTasks, r,
+                                    previous[2 * r] == runs[r]);
+                        }
+                        ASSERTV(NUM_ELEMENTS == runs.back());
+                    }
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Run each algorithm once on a range large enough to be divided
+        //:   among the threads of a pool, and verify the result.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        bdlmt::FixedThreadPool pool(4, 100, &ta);
+        ASSERT(0 == pool.start());
+
+        const int LENGTH = 100 * MIN;
+
+        bsl::vector<int> values(&ta);
+        fillRandom(&values, LENGTH, 1000);
+
+        bsl::vector<int> expected(values, &ta);
+
+        Util::forEach(&pool, values.begin(), values.end(), Increment());
+        for (int i = 0; i < LENGTH; ++i) {
+            ++expected[i];
+        }
+        ASSERT(expected == values);
+
+        Util::transform(&pool,
+                        values.begin(),
+                        values.end(),
+                        values.begin(),
+                        bsl::negate<int>());
+        for (int i = 0; i < LENGTH; ++i) {
+            expected[i] = -expected[i];
+        }
+        ASSERT(expected == values);
+
+        Int64 sum = 0;
+        for (int i = 0; i < LENGTH; ++i) {
+            sum += expected[i];
+        }
+        ASSERT(sum == Util::reduce(&pool,
+                                   values.begin(),
+                                   values.end(),
+                                   Int64(0)));
+
+        Util::sort(&pool, values.begin(), values.end());
+        bsl::sort(expected.begin(), expected.end());
+        ASSERT(expected == values);
+
+        Util::inclusiveScan(&pool,
+                            values.begin(),
+                            values.end(),
+                            values.begin());
+        ASSERT(sum == values.back());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PARALLEL VS. SERIAL ALGORITHMS
+        //
+        // Concerns:
+        //: 1 The parallel algorithms are faster than their serial
+        //:   counterparts on large ranges.
+        //
+        // Plan:
+        //: 1 Time each algorithm, and its serial counterpart, on a range of
+        //:   (by default) 10 million integers using a pool having (by default)
+        //:   as many threads as there are hardware threads, less one.  The
+        //:   number of elements and threads can be supplied as the second and
+        //:   third arguments.
+        //
+        // Testing:
+        //   PERFORMANCE: PARALLEL VS. SERIAL ALGORITHMS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: PARALLEL VS. SERIAL ALGORITHMS"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::NewDeleteAllocator    nalloc;
+        bslma::DefaultAllocatorGuard guard(&nalloc);
+
+        int length     = 10 * 1000 * 1000;
+        int numThreads = static_cast<int>(
+                                 bslmt::ThreadUtil::hardwareConcurrency()) - 1;
+
+        if (argc > 2 && atoi(argv[2]) > 0) length     = atoi(argv[2]);
+        if (argc > 3 && atoi(argv[3]) > 0) numThreads = atoi(argv[3]);
+        if (numThreads < 1) numThreads = 1;
+
+        cout << "elements=" << length << " threads=" << numThreads << endl;
+
+        bdlmt::FixedThreadPool pool(numThreads, 1000);
+        pool.start();
+
+        bsl::vector<int> values;
+        fillRandom(&values, length, 1 << 30);
+
+        bsl::vector<int>   work(values);
+        bsl::vector<Int64> output(length);
+        bsls::Stopwatch    timer;
+
+#define TIME(NAME, EXPRESSION)                                                \
+        work = values;                                                        \
+        timer.reset();                                                        \
+        timer.start();                                                        \
+        EXPRESSION;                                                           \
+        timer.stop();                                                         \
+        cout << NAME << ": " << timer.elapsedTime() << "s" << endl;
+
+        TIME("serial   for_each ",
+             bsl::for_each(work.begin(), work.end(), Increment()));
+        TIME("parallel forEach  ",
+             Util::forEach(&pool, work.begin(), work.end(), Increment()));
+        TIME("serial   transform",
+             bsl::transform(work.begin(),
+                            work.end(),
+                            output.begin(),
+                            Square()));
+        TIME("parallel transform",
+             Util::transform(&pool,
+                             work.begin(),
+                             work.end(),
+                             output.begin(),
+                             Square()));
+
+        Int64 serialSum = 0, parallelSum = 0;
+        TIME("serial   accumulate",
+             serialSum = bsl::accumulate(work.begin(), work.end(), Int64(0)));
+        TIME("parallel reduce    ",
+             parallelSum = Util::reduce(&pool,
+                                        work.begin(),
+                                        work.end(),
+                                        Int64(0)));
+        ASSERT(serialSum == parallelSum);
+
+        TIME("serial   partial_sum  ",
+             bsl::partial_sum(work.begin(), work.end(), work.begin()));
+        TIME("parallel inclusiveScan",
+             Util::inclusiveScan(&pool,
+                                 work.begin(),
+                                 work.end(),
+                                 work.begin()));
+
+        bsl::vector<int> sorted;
+        TIME("serial   sort",
+             bsl::sort(work.begin(), work.end()); sorted = work);
+        TIME("parallel sort",
+             Util::sort(&pool, work.begin(), work.end()));
+        ASSERT(sorted == work);
+
+#undef TIME
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
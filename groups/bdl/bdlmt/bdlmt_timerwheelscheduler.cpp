@@ -0,0 +1,1120 @@
+// bdlmt_timerwheelscheduler.cpp                                      -*-C++-*-
+#include <bdlmt_timerwheelscheduler.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_timerwheelscheduler_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlt_timeunitratio.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_systemtime.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstdint.h>
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+const Int64 k_NANOSECONDS_PER_SECOND = 1000000000;
+
+const Int64 k_MAX_NANOSECONDS        = static_cast<Int64>(1) << 62;
+    // magnitude at which times are saturated when converted to nanoseconds,
+    // so that tick arithmetic cannot overflow
+
+const Int64 k_MAX_SECONDS            = k_MAX_NANOSECONDS
+                                     / k_NANOSECONDS_PER_SECOND;
+
+const Int64 k_NO_WAKE_TICK           = LLONG_MIN;
+    // value of 'd_wakeTick' when the dispatcher thread is not waiting
+
+const Int64 k_MAX_TICK               = LLONG_MAX;
+    // value of 'd_wakeTick' when the dispatcher thread waits until signaled
+
+const Int64 k_DEFAULT_TICK_NANOSECONDS = 1000000;
+    // default tick interval (one millisecond)
+
+bsl::function<bsls::TimeInterval()> createDefaultCurrentTimeFunctor(
+                                         bsls::SystemClockType::Enum clockType)
+{
+    // Must cast the pointer to 'now' to the correct signature so that the
+    // correct now function is passed to the bind template.
+
+    return bdlf::BindUtil::bind(
+              static_cast<bsls::TimeInterval (*)(bsls::SystemClockType::Enum)>(
+                                                       &bsls::SystemTime::now),
+              clockType);
+}
+
+void defaultDispatcherFunction(const bsl::function<void()>& callback)
+{
+    callback();
+}
+
+inline
+Uint64 rotateRight(Uint64 value, int shift)
+    // Return the specified 'value' rotated right by the specified 'shift'
+    // bits.  The behavior is undefined unless '0 <= shift < 64'.
+{
+    return 0 == shift ? value : (value >> shift) | (value << (64 - shift));
+}
+
+Int64 toNanoseconds(const bsls::TimeInterval& interval)
+    // Return the specified 'interval' in nanoseconds, saturated to the range
+    // '[-k_MAX_NANOSECONDS, k_MAX_NANOSECONDS]'.
+{
+    if (interval.seconds() >= k_MAX_SECONDS) {
+        return k_MAX_NANOSECONDS;                                     // RETURN
+    }
+    if (interval.seconds() <= -k_MAX_SECONDS) {
+        return -k_MAX_NANOSECONDS;                                    // RETURN
+    }
+    return interval.totalNanoseconds();
+}
+
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+               // ============================================
+               // class TimerWheelSchedulerTestTimeSource_Data
+               // ============================================
+
+class TimerWheelSchedulerTestTimeSource_Data {
+    // This 'class' provides storage for the current time and a mutex to
+    // protect access to the current time.
+
+    // DATA
+    bsls::TimeInterval   d_currentTime;       // the current time
+
+    mutable bslmt::Mutex d_currentTimeMutex;  // mutex used to synchronize
+                                              // 'd_currentTime' access
+
+    // NOT IMPLEMENTED
+    TimerWheelSchedulerTestTimeSource_Data(
+                                const TimerWheelSchedulerTestTimeSource_Data&);
+    TimerWheelSchedulerTestTimeSource_Data& operator=(
+                                const TimerWheelSchedulerTestTimeSource_Data&);
+
+  public:
+    // CREATORS
+    explicit
+    TimerWheelSchedulerTestTimeSource_Data(bsls::TimeInterval currentTime);
+        // Construct a test time-source data object that will store the
+        // "system-time", initialized to the specified 'currentTime'.
+
+    // MANIPULATORS
+    bsls::TimeInterval advanceTime(bsls::TimeInterval amount);
+        // Advance this object's current-time value by the specified 'amount'
+        // of time.  Return the updated current-time value.
+
+    // ACCESSORS
+    bsls::TimeInterval currentTime() const;
+        // Return this object's current-time value.
+};
+
+// CREATORS
+TimerWheelSchedulerTestTimeSource_Data::TimerWheelSchedulerTestTimeSource_Data(
+                                                bsls::TimeInterval currentTime)
+: d_currentTime(currentTime)
+{
+}
+
+// MANIPULATORS
+bsls::TimeInterval TimerWheelSchedulerTestTimeSource_Data::advanceTime(
+                                                     bsls::TimeInterval amount)
+{
+    BSLS_ASSERT(amount > 0);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_currentTimeMutex);
+    d_currentTime += amount;
+    return d_currentTime;
+}
+
+// ACCESSORS
+bsls::TimeInterval TimerWheelSchedulerTestTimeSource_Data::currentTime() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_currentTimeMutex);
+    return d_currentTime;
+}
+
+                   // =====================================
+                   // struct TimerWheelScheduler_Dispatcher
+                   // =====================================
+
+struct TimerWheelScheduler_Dispatcher {
+    // This class just contains the method called to run the dispatcher
+    // thread.  Once started, it loops, either waiting for or dispatching
+    // events, until the scheduler is stopped.
+
+    // CLASS METHODS
+    static void dispatchEvents(TimerWheelScheduler *scheduler);
+        // Dispatch the events of the specified 'scheduler' until it is
+        // stopped.
+};
+
+extern "C" void *TimerWheelScheduler_DispatcherThread(void *scheduler)
+{
+    TimerWheelScheduler_Dispatcher::dispatchEvents(
+                                static_cast<TimerWheelScheduler *>(scheduler));
+    return scheduler;
+}
+
+void TimerWheelScheduler_Dispatcher::dispatchEvents(
+                                                TimerWheelScheduler *scheduler)
+{
+    BSLS_ASSERT(scheduler);
+
+    bsl::vector<bsl::function<void()> >& callbacks =
+                                                 scheduler->d_pendingCallbacks;
+
+    while (1) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&scheduler->d_mutex);
+
+            if (!scheduler->d_running.loadRelaxed()) {
+                return;                                               // RETURN
+            }
+            ++scheduler->d_iterations;
+
+            scheduler->d_wakeTick = k_NO_WAKE_TICK;
+
+            scheduler->collectDueNodes(
+                      scheduler->toTick(scheduler->d_currentTimeFunctor(),
+                                        false));
+
+            if (callbacks.empty()) {
+                // Nothing is due.  Wait (interruptibly) until the next tick at
+                // which something might be due, if any.
+
+                Int64 wakeTick = k_MAX_TICK;
+                if (0 != scheduler->d_numScheduled) {
+                    wakeTick = scheduler->nextTick(scheduler->d_currentTick);
+                }
+
+                if (wakeTick < k_MAX_NANOSECONDS
+                                             / scheduler->d_tickNanoseconds) {
+                    bsls::TimeInterval wakeTime;
+                    wakeTime.setTotalNanoseconds(
+                                      wakeTick * scheduler->d_tickNanoseconds);
+
+                    scheduler->d_wakeTick = wakeTick;
+                    scheduler->d_condition.timedWait(&scheduler->d_mutex,
+                                                     wakeTime);
+                }
+                else {
+                    scheduler->d_wakeTick = k_MAX_TICK;
+                    scheduler->d_condition.wait(&scheduler->d_mutex);
+                }
+                continue;
+            }
+        }
+
+        // We just unlocked the mutex.  Note that a callback (and only a
+        // callback) may cancel the callbacks that follow it in the batch.
+
+        const int numCallbacks = static_cast<int>(callbacks.size());
+
+        for (int i = 0; i < numCallbacks; ++i) {
+            scheduler->d_currentPendingIndex = i;
+
+            if (callbacks[i]) {
+                scheduler->d_dispatcherFunctor(callbacks[i]);
+            }
+            if (!scheduler->d_pendingIsClock[i]) {
+                --scheduler->d_numEvents;
+            }
+        }
+
+        scheduler->d_currentPendingIndex = INT_MAX;
+
+        callbacks.clear();
+        scheduler->d_pendingHandles.clear();
+        scheduler->d_pendingIsClock.clear();
+    }
+}
+
+                        // -------------------------
+                        // class TimerWheelScheduler
+                        // -------------------------
+
+// PRIVATE MANIPULATORS
+int TimerWheelScheduler::allocateNode()
+{
+    if (-1 != d_freeHead) {
+        const int index = d_freeHead;
+
+        d_freeHead = d_nodes[index].d_next;
+        if (-1 == d_freeHead) {
+            d_freeTail = -1;
+        }
+        return index;                                                 // RETURN
+    }
+
+    const int index = static_cast<int>(d_nodes.size());
+    if (k_MAX_NODES <= index) {
+        return -1;                                                    // RETURN
+    }
+
+    Node node;
+    node.d_expiry     = 0;
+    node.d_next       = -1;
+    node.d_prev       = -1;
+    node.d_slot       = -1;
+    node.d_generation = 0;
+
+    d_callbacks.resize(index + 1);
+    d_nodes.push_back(node);
+
+    return index;
+}
+
+int TimerWheelScheduler::cancelPending(Handle handle)
+{
+    int rc = 1;
+
+    for (int i = d_currentPendingIndex + 1;
+         i < static_cast<int>(d_pendingHandles.size());
+         ++i) {
+        if (handle == d_pendingHandles[i] && d_pendingCallbacks[i]) {
+            d_pendingCallbacks[i] = bsl::function<void()>();
+            rc = 0;
+        }
+    }
+    return rc;
+}
+
+void TimerWheelScheduler::cascade(int level)
+{
+    BSLS_ASSERT(0 < level);
+    BSLS_ASSERT(level < k_NUM_LEVELS);
+
+    const int slot = static_cast<int>((d_currentTick >> (level * k_SLOT_BITS))
+                                                         & (k_NUM_SLOTS - 1));
+
+    int index = d_slots[level][slot];
+
+    d_slots[level][slot] = -1;
+    d_occupied[level] &= ~(static_cast<Uint64>(1) << slot);
+
+    while (-1 != index) {
+        const int next = d_nodes[index].d_next;
+
+        --d_numScheduled;
+        insertNode(index);
+
+        index = next;
+    }
+}
+
+void TimerWheelScheduler::collectDueNodes(Int64 nowTick)
+{
+    // Overdue nodes are collected regardless of 'nowTick'.  Clocks that are
+    // still overdue once rescheduled are collected in the next batch.
+
+    const int overdueHead = d_overdueHead;
+
+    d_overdueHead = -1;
+    collectNodes(overdueHead);
+
+    while (d_currentTick <= nowTick) {
+        if (0 == d_numScheduled) {
+            break;
+        }
+
+        const Int64 tick = nextTick(d_currentTick);
+        if (tick > nowTick) {
+            break;
+        }
+
+        // Nothing is due, and no occupied slot is cascaded, before 'tick'.
+
+        d_currentTick = tick;
+
+        for (int level = 1; level < k_NUM_LEVELS; ++level) {
+            const Int64 mask = (static_cast<Int64>(1) << (level * k_SLOT_BITS))
+                             - 1;
+            if (0 != (tick & mask)) {
+                break;
+            }
+            cascade(level);
+        }
+
+        const int slot = static_cast<int>(tick & (k_NUM_SLOTS - 1));
+        const int head = d_slots[0][slot];
+
+        d_slots[0][slot] = -1;
+        d_occupied[0] &= ~(static_cast<Uint64>(1) << slot);
+
+        // Clocks are rescheduled relative to the next tick, so that an
+        // occurrence due in a later tick is collected by this call.
+
+        d_currentTick = tick + 1;
+
+        collectNodes(head);
+    }
+
+    if (d_currentTick <= nowTick) {
+        d_currentTick = nowTick + 1;
+    }
+}
+
+void TimerWheelScheduler::collectNodes(int head)
+{
+    int index = head;
+
+    while (-1 != index) {
+        Node&     node = d_nodes[index];
+        const int next = node.d_next;
+
+        --d_numScheduled;
+        node.d_slot = -1;
+
+        d_pendingHandles.push_back((node.d_generation << k_INDEX_BITS)
+                                                                     | index);
+        d_pendingCallbacks.resize(d_pendingCallbacks.size() + 1);
+
+        if (bsls::TimeInterval() == node.d_interval) {
+            d_pendingIsClock.push_back(false);
+            d_pendingCallbacks.back().swap(d_callbacks[index]);
+            freeNode(index);
+        }
+        else {
+            d_pendingIsClock.push_back(true);
+            d_pendingCallbacks.back() = d_callbacks[index];
+
+            node.d_time  += node.d_interval;
+            node.d_expiry = toTick(node.d_time, true);
+            insertNode(index);
+        }
+
+        index = next;
+    }
+}
+
+void TimerWheelScheduler::freeNode(int index)
+{
+    Node& node = d_nodes[index];
+
+    BSLS_ASSERT(-1 == node.d_slot);
+
+    node.d_generation = (node.d_generation + 1) & k_GENERATION_MASK;
+    node.d_next       = -1;
+
+    d_callbacks[index] = bsl::function<void()>();
+
+    if (-1 == d_freeTail) {
+        d_freeHead = index;
+    }
+    else {
+        d_nodes[d_freeTail].d_next = index;
+    }
+    d_freeTail = index;
+}
+
+void TimerWheelScheduler::insertNode(int index)
+{
+    Node& node = d_nodes[index];
+
+    Int64       expiry = node.d_expiry;
+    const Int64 delta  = expiry - d_currentTick;
+    int         level  = 0;
+
+    if (delta < 0) {
+        // The tick of the node has already been processed: collect the node
+        // in the next batch.
+
+        node.d_prev = -1;
+        node.d_next = d_overdueHead;
+        node.d_slot = k_OVERDUE_SLOT;
+        if (-1 != d_overdueHead) {
+            d_nodes[d_overdueHead].d_prev = index;
+        }
+        d_overdueHead = index;
+        ++d_numScheduled;
+
+        if (k_NO_WAKE_TICK != d_wakeTick) {
+            d_wakeTick = k_NO_WAKE_TICK;
+            d_condition.signal();
+        }
+        return;                                                       // RETURN
+    }
+
+    if (delta >= k_NUM_SLOTS) {
+        const Int64 maxDelta = (static_cast<Int64>(1)
+                                         << (k_NUM_LEVELS * k_SLOT_BITS)) - 1;
+
+        if (delta > maxDelta) {
+            // The node is beyond the last wheel: keep it in the farthest slot,
+            // from which it is cascaded (and reinserted) in due course.
+
+            expiry = d_currentTick + maxDelta;
+            level  = k_NUM_LEVELS - 1;
+        }
+        else {
+            level = (63 - bdlb::BitUtil::numLeadingUnsetBits(
+                                          static_cast<bsl::uint64_t>(delta)))
+                  / k_SLOT_BITS;
+        }
+    }
+
+    const int slot = static_cast<int>((expiry >> (level * k_SLOT_BITS))
+                                                         & (k_NUM_SLOTS - 1));
+
+    int& head = d_slots[level][slot];
+
+    node.d_prev = -1;
+    node.d_next = head;
+    node.d_slot = level * k_NUM_SLOTS + slot;
+    if (-1 != head) {
+        d_nodes[head].d_prev = index;
+    }
+    head = index;
+
+    d_occupied[level] |= static_cast<Uint64>(1) << slot;
+    ++d_numScheduled;
+
+    if (node.d_expiry < d_wakeTick) {
+        // The dispatcher thread is waiting, and would wake up too late.
+
+        d_wakeTick = node.d_expiry;
+        d_condition.signal();
+    }
+}
+
+void TimerWheelScheduler::removeNode(int index)
+{
+    Node& node = d_nodes[index];
+
+    BSLS_ASSERT(0 <= node.d_slot);
+
+    if (-1 != node.d_prev) {
+        d_nodes[node.d_prev].d_next = node.d_next;
+    }
+    else if (k_OVERDUE_SLOT == node.d_slot) {
+        d_overdueHead = node.d_next;
+    }
+    else {
+        const int level = node.d_slot / k_NUM_SLOTS;
+        const int slot  = node.d_slot % k_NUM_SLOTS;
+
+        d_slots[level][slot] = node.d_next;
+        if (-1 == node.d_next) {
+            d_occupied[level] &= ~(static_cast<Uint64>(1) << slot);
+        }
+    }
+    if (-1 != node.d_next) {
+        d_nodes[node.d_next].d_prev = node.d_prev;
+    }
+
+    node.d_slot = -1;
+    --d_numScheduled;
+}
+
+void TimerWheelScheduler::reset(const bsls::TimeInterval& currentTime)
+{
+    BSLS_ASSERT(0 == d_numScheduled);
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        bsl::fill(d_slots[level], d_slots[level] + k_NUM_SLOTS, -1);
+        d_occupied[level] = 0;
+    }
+    d_overdueHead = -1;
+    d_currentTick = toTick(currentTime, false);
+}
+
+void TimerWheelScheduler::yieldToDispatcher()
+{
+    if (d_running.loadRelaxed() && !isDispatcherThread()) {
+        const int it = d_iterations.loadRelaxed();
+        while (it == d_iterations.loadRelaxed() && d_running.loadRelaxed()) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+                d_condition.signal();
+            }
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+int TimerWheelScheduler::findNode(Handle handle, bool isClock) const
+{
+    if (handle < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    const int index      = handle & k_MAX_NODES;
+    const int generation = handle >> k_INDEX_BITS;
+
+    if (index >= static_cast<int>(d_nodes.size())) {
+        return -1;                                                    // RETURN
+    }
+
+    const Node& node = d_nodes[index];
+
+    if (generation != node.d_generation
+     || -1 == node.d_slot
+     || isClock != (bsls::TimeInterval() != node.d_interval)) {
+        return -1;                                                    // RETURN
+    }
+    return index;
+}
+
+bool TimerWheelScheduler::isDispatcherThread() const
+{
+    return d_running.loadRelaxed()
+        && bslmt::ThreadUtil::selfIdAsUint64() == d_dispatcherId.loadRelaxed();
+}
+
+Int64 TimerWheelScheduler::nextTick(Int64 tick) const
+{
+    BSLS_ASSERT(0 < d_numScheduled);
+
+    // The slots of wheel 'level' are visited at the ticks that are multiples
+    // of '1 << (level * k_SLOT_BITS)', slot 'i' being visited at those ticks
+    // 't' for which '(t >> (level * k_SLOT_BITS)) % k_NUM_SLOTS == i'.
+
+    Int64 result = k_MAX_TICK;
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        if (0 == d_occupied[level]) {
+            continue;                                               // CONTINUE
+        }
+
+        const int   shift  = level * k_SLOT_BITS;
+        const Int64 period = static_cast<Int64>(1) << shift;
+        const Int64 first  = (tick + period - 1) >> shift;
+        const int   slot   = static_cast<int>(first & (k_NUM_SLOTS - 1));
+        const int   offset = bdlb::BitUtil::numTrailingUnsetBits(
+                static_cast<bsl::uint64_t>(rotateRight(d_occupied[level],
+                                                       slot)));
+
+        result = bsl::min(result, (first + offset) << shift);
+    }
+    return result;
+}
+
+Int64 TimerWheelScheduler::toTick(const bsls::TimeInterval& time,
+                                  bool                      roundUp) const
+{
+    const Int64 nanoseconds = toNanoseconds(time);
+
+    if (nanoseconds >= 0) {
+        return roundUp
+               ? (nanoseconds + d_tickNanoseconds - 1) / d_tickNanoseconds
+               : nanoseconds / d_tickNanoseconds;                     // RETURN
+    }
+    return roundUp
+           ? -(-nanoseconds / d_tickNanoseconds)
+           : -((-nanoseconds + d_tickNanoseconds - 1) / d_tickNanoseconds);
+}
+
+// CREATORS
+TimerWheelScheduler::TimerWheelScheduler(bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(),
+                       basicAllocator,
+                       createDefaultCurrentTimeFunctor(
+                                            bsls::SystemClockType::e_REALTIME))
+, d_tickNanoseconds(k_DEFAULT_TICK_NANOSECONDS)
+, d_currentTick(0)
+, d_wakeTick(k_NO_WAKE_TICK)
+, d_overdueHead(-1)
+, d_numScheduled(0)
+, d_nodes(basicAllocator)
+, d_callbacks(basicAllocator)
+, d_freeHead(-1)
+, d_freeTail(-1)
+, d_pendingCallbacks(basicAllocator)
+, d_pendingHandles(basicAllocator)
+, d_pendingIsClock(basicAllocator)
+, d_currentPendingIndex(INT_MAX)
+, d_dispatcherFunctor(bsl::allocator_arg_t(),
+                      basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_dispatcherId(0)
+, d_running(0)
+, d_iterations(0)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(bsls::SystemClockType::e_REALTIME)
+{
+    reset(d_currentTimeFunctor());
+}
+
+TimerWheelScheduler::TimerWheelScheduler(
+                                 const bsls::TimeInterval&  tickInterval,
+                                 bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(),
+                       basicAllocator,
+                       createDefaultCurrentTimeFunctor(
+                                            bsls::SystemClockType::e_REALTIME))
+, d_tickNanoseconds(tickInterval.totalNanoseconds())
+, d_currentTick(0)
+, d_wakeTick(k_NO_WAKE_TICK)
+, d_overdueHead(-1)
+, d_numScheduled(0)
+, d_nodes(basicAllocator)
+, d_callbacks(basicAllocator)
+, d_freeHead(-1)
+, d_freeTail(-1)
+, d_pendingCallbacks(basicAllocator)
+, d_pendingHandles(basicAllocator)
+, d_pendingIsClock(basicAllocator)
+, d_currentPendingIndex(INT_MAX)
+, d_dispatcherFunctor(bsl::allocator_arg_t(),
+                      basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_dispatcherId(0)
+, d_running(0)
+, d_iterations(0)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(bsls::SystemClockType::e_REALTIME)
+{
+    BSLS_ASSERT(0 < d_tickNanoseconds);
+    BSLS_ASSERT(tickInterval <= bsls::TimeInterval(
+                                     bdlt::TimeUnitRatio::k_SECONDS_PER_DAY));
+
+    reset(d_currentTimeFunctor());
+}
+
+TimerWheelScheduler::TimerWheelScheduler(
+                               const bsls::TimeInterval&    tickInterval,
+                               bsls::SystemClockType::Enum  clockType,
+                               bslma::Allocator            *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(),
+                       basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_tickNanoseconds(tickInterval.totalNanoseconds())
+, d_currentTick(0)
+, d_wakeTick(k_NO_WAKE_TICK)
+, d_overdueHead(-1)
+, d_numScheduled(0)
+, d_nodes(basicAllocator)
+, d_callbacks(basicAllocator)
+, d_freeHead(-1)
+, d_freeTail(-1)
+, d_pendingCallbacks(basicAllocator)
+, d_pendingHandles(basicAllocator)
+, d_pendingIsClock(basicAllocator)
+, d_currentPendingIndex(INT_MAX)
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(),
+                      basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_dispatcherId(0)
+, d_running(0)
+, d_iterations(0)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(0 < d_tickNanoseconds);
+    BSLS_ASSERT(tickInterval <= bsls::TimeInterval(
+                                     bdlt::TimeUnitRatio::k_SECONDS_PER_DAY));
+
+    reset(d_currentTimeFunctor());
+}
+
+TimerWheelScheduler::TimerWheelScheduler(
+                               const bsls::TimeInterval&    tickInterval,
+                               const Dispatcher&            dispatcherFunctor,
+                               bsls::SystemClockType::Enum  clockType,
+                               bslma::Allocator            *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(),
+                       basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_tickNanoseconds(tickInterval.totalNanoseconds())
+, d_currentTick(0)
+, d_wakeTick(k_NO_WAKE_TICK)
+, d_overdueHead(-1)
+, d_numScheduled(0)
+, d_nodes(basicAllocator)
+, d_callbacks(basicAllocator)
+, d_freeHead(-1)
+, d_freeTail(-1)
+, d_pendingCallbacks(basicAllocator)
+, d_pendingHandles(basicAllocator)
+, d_pendingIsClock(basicAllocator)
+, d_currentPendingIndex(INT_MAX)
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(),
+                      basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_dispatcherId(0)
+, d_running(0)
+, d_iterations(0)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(0 < d_tickNanoseconds);
+    BSLS_ASSERT(tickInterval <= bsls::TimeInterval(
+                                     bdlt::TimeUnitRatio::k_SECONDS_PER_DAY));
+
+    reset(d_currentTimeFunctor());
+}
+
+TimerWheelScheduler::~TimerWheelScheduler()
+{
+    stop();
+}
+
+// MANIPULATORS
+int TimerWheelScheduler::start()
+{
+    bslmt::ThreadAttributes attr;
+
+    return start(attr);
+}
+
+int TimerWheelScheduler::start(const bslmt::ThreadAttributes& threadAttributes)
+{
+    // Implementation note: 'd_dispatcherMutex' is in a lock hierarchy with
+    // 'd_mutex' and must always be locked first.
+
+    bslmt::LockGuard<bslmt::Mutex> dispatcherLock(&d_dispatcherMutex);
+
+    BSLS_ASSERT(!isDispatcherThread());
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    if (d_running.loadRelaxed()) {
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::ThreadAttributes modAttr(threadAttributes);
+    modAttr.setDetachedState(bslmt::ThreadAttributes::e_CREATE_JOINABLE);
+
+    if (bslmt::ThreadUtil::create(&d_dispatcherThread,
+                                  modAttr,
+                                  &TimerWheelScheduler_DispatcherThread,
+                                  this)) {
+        return -1;                                                    // RETURN
+    }
+    d_dispatcherId = bslmt::ThreadUtil::idAsUint64(
+                            bslmt::ThreadUtil::handleToId(d_dispatcherThread));
+    d_running = 1;
+
+    return 0;
+}
+
+void TimerWheelScheduler::stop()
+{
+    // Implementation note: 'd_dispatcherMutex' is in a lock hierarchy with
+    // 'd_mutex' and must always be locked first.
+
+    bslmt::LockGuard<bslmt::Mutex> dispatcherLock(&d_dispatcherMutex);
+
+    BSLS_ASSERT(!isDispatcherThread());
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        if (!d_running.loadRelaxed()) {
+            return;                                                   // RETURN
+        }
+
+        d_running = 0;
+        d_condition.signal();
+    }
+
+    bslmt::ThreadUtil::join(d_dispatcherThread);
+    d_dispatcherId = 0;
+}
+
+TimerWheelScheduler::Handle
+TimerWheelScheduler::scheduleEvent(const bsls::TimeInterval&    time,
+                                   const bsl::function<void()>& callback)
+{
+    // Copy 'callback', which may allocate, before locking the mutex.
+
+    bsl::function<void()> copy(bsl::allocator_arg_t(),
+                               d_allocator_p,
+                               callback);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const int index = allocateNode();
+    if (0 > index) {
+        return e_INVALID_HANDLE;                                      // RETURN
+    }
+
+    Node& node = d_nodes[index];
+
+    node.d_time     = time;
+    node.d_interval = bsls::TimeInterval();
+    node.d_expiry   = toTick(time, true);
+
+    d_callbacks[index].swap(copy);
+    insertNode(index);
+
+    ++d_numEvents;
+
+    return (node.d_generation << k_INDEX_BITS) | index;
+}
+
+int TimerWheelScheduler::rescheduleEvent(Handle                    handle,
+                                         const bsls::TimeInterval& newTime,
+                                         bool                      wait)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        const int index = findNode(handle, false);
+        if (0 <= index) {
+            Node& node = d_nodes[index];
+
+            removeNode(index);
+            node.d_time   = newTime;
+            node.d_expiry = toTick(newTime, true);
+            insertNode(index);
+
+            return 0;                                                 // RETURN
+        }
+    }
+
+    if (wait) {
+        yieldToDispatcher();
+    }
+    return 1;
+}
+
+int TimerWheelScheduler::cancelEvent(Handle handle, bool wait)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        const int index = findNode(handle, false);
+        if (0 <= index) {
+            removeNode(index);
+            freeNode(index);
+            --d_numEvents;
+
+            return 0;                                                 // RETURN
+        }
+    }
+
+    // The event, if valid, has been collected for dispatch.  A callback being
+    // dispatched may still cancel the callbacks that follow it in its batch.
+
+    if (isDispatcherThread()) {
+        return cancelPending(handle);                                 // RETURN
+    }
+
+    if (wait && e_INVALID_HANDLE != handle) {
+        yieldToDispatcher();
+    }
+    return 1;
+}
+
+void TimerWheelScheduler::cancelAllEvents(bool wait)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        const int numNodes = static_cast<int>(d_nodes.size());
+        for (int index = 0; index < numNodes; ++index) {
+            const Node& node = d_nodes[index];
+
+            if (-1 != node.d_slot
+             && bsls::TimeInterval() == node.d_interval) {
+                removeNode(index);
+                freeNode(index);
+                --d_numEvents;
+            }
+        }
+    }
+
+    if (wait) {
+        yieldToDispatcher();
+    }
+}
+
+TimerWheelScheduler::Handle
+TimerWheelScheduler::startClock(const bsls::TimeInterval&    interval,
+                                const bsl::function<void()>& callback,
+                                const bsls::TimeInterval&    startTime)
+{
+    BSLS_ASSERT(bsls::TimeInterval() < interval);
+
+    bsls::TimeInterval time(startTime);
+    if (bsls::TimeInterval() == time) {
+        time = d_currentTimeFunctor() + interval;
+    }
+
+    bsl::function<void()> copy(bsl::allocator_arg_t(),
+                               d_allocator_p,
+                               callback);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const int index = allocateNode();
+    if (0 > index) {
+        return e_INVALID_HANDLE;                                      // RETURN
+    }
+
+    Node& node = d_nodes[index];
+
+    node.d_time     = time;
+    node.d_interval = interval;
+    node.d_expiry   = toTick(time, true);
+
+    d_callbacks[index].swap(copy);
+    insertNode(index);
+
+    ++d_numClocks;
+
+    return (node.d_generation << k_INDEX_BITS) | index;
+}
+
+int TimerWheelScheduler::cancelClock(Handle handle, bool wait)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        const int index = findNode(handle, true);
+        if (0 > index) {
+            return 1;                                                 // RETURN
+        }
+
+        removeNode(index);
+        freeNode(index);
+        --d_numClocks;
+    }
+
+    if (isDispatcherThread()) {
+        cancelPending(handle);
+    }
+    else if (wait) {
+        yieldToDispatcher();
+    }
+    return 0;
+}
+
+void TimerWheelScheduler::cancelAllClocks(bool wait)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        const int numNodes = static_cast<int>(d_nodes.size());
+        for (int index = 0; index < numNodes; ++index) {
+            const Node& node = d_nodes[index];
+
+            if (-1 != node.d_slot
+             && bsls::TimeInterval() != node.d_interval) {
+                removeNode(index);
+                freeNode(index);
+                --d_numClocks;
+            }
+        }
+    }
+
+    if (isDispatcherThread()) {
+        for (int i = d_currentPendingIndex + 1;
+             i < static_cast<int>(d_pendingIsClock.size());
+             ++i) {
+            if (d_pendingIsClock[i]) {
+                d_pendingCallbacks[i] = bsl::function<void()>();
+            }
+        }
+    }
+    else if (wait) {
+        yieldToDispatcher();
+    }
+}
+
+                  // ---------------------------------------
+                  // class TimerWheelSchedulerTestTimeSource
+                  // ---------------------------------------
+
+// CREATORS
+TimerWheelSchedulerTestTimeSource::TimerWheelSchedulerTestTimeSource(
+                                                TimerWheelScheduler *scheduler)
+: d_scheduler_p(scheduler)
+{
+    BSLS_ASSERT(scheduler);
+
+    // As for 'TimerEventSchedulerTestTimeSource', the test time starts 1000
+    // days in the future, so that the system clock (which controls the
+    // scheduler's condition variable) always lags behind the test time, and
+    // the dispatcher thread sleeps until the test time is advanced.  The data
+    // is allocated with the default allocator since its lifetime is shared
+    // with the scheduler.
+
+    d_data_p = bsl::make_shared<TimerWheelSchedulerTestTimeSource_Data>(
+                                bsls::SystemTime::now(scheduler->d_clockType)
+                              + 1000 * bdlt::TimeUnitRatio::k_SECONDS_PER_DAY);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_scheduler_p->d_mutex);
+
+    d_scheduler_p->d_currentTimeFunctor = bdlf::BindUtil::bind(
+                          &TimerWheelSchedulerTestTimeSource_Data::currentTime,
+                          d_data_p);
+    d_scheduler_p->reset(d_data_p->currentTime());
+}
+
+// MANIPULATORS
+bsls::TimeInterval TimerWheelSchedulerTestTimeSource::advanceTime(
+                                                     bsls::TimeInterval amount)
+{
+    BSLS_ASSERT(amount > 0);
+
+    bsls::TimeInterval ret = d_data_p->advanceTime(amount);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_scheduler_p->d_mutex);
+
+        // Now that the time has changed, signal the scheduler's condition
+        // variable so that the dispatcher thread can be alerted to the
+        // change.
+
+        d_scheduler_p->d_condition.signal();
+    }
+
+    return ret;
+}
+
+// ACCESSORS
+bsls::TimeInterval TimerWheelSchedulerTestTimeSource::now() const
+{
+    return d_data_p->currentTime();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
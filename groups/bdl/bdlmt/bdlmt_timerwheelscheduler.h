@@ -0,0 +1,791 @@
+// bdlmt_timerwheelscheduler.h                                        -*-C++-*-
+#ifndef INCLUDED_BDLMT_TIMERWHEELSCHEDULER
+#define INCLUDED_BDLMT_TIMERWHEELSCHEDULER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an event scheduler backed by a hierarchical timing wheel.
+//
+//@CLASSES:
+//  bdlmt::TimerWheelScheduler: thread-safe timing-wheel event scheduler
+//  bdlmt::TimerWheelSchedulerTestTimeSource: test clock for the scheduler
+//
+//@SEE_ALSO: bdlmt_eventscheduler, bdlmt_timereventscheduler
+//
+//@DESCRIPTION: This component provides a thread-safe event scheduler,
+// 'bdlmt::TimerWheelScheduler', having the same interface as
+// 'bdlmt::TimerEventScheduler' (see 'bdlmt_timereventscheduler'): it provides
+// methods to schedule, reschedule, and cancel non-recurring events and
+// recurring events (also referred to as clocks), identified by light-weight
+// integral handles, and it dispatches their callbacks from a separate thread
+// (the dispatcher thread), optionally through a user-supplied dispatcher
+// functor.  'bdlmt::TimerWheelScheduler' is intended for applications that
+// schedule and cancel very large numbers of events, nearly all of which are
+// cancelled before they are due (e.g., per-request timeouts and heartbeats).
+//
+///Timing Wheel
+///------------
+// Both 'bdlmt::EventScheduler' and 'bdlmt::TimerEventScheduler' keep events in
+// a container ordered by time, so that scheduling or cancelling an event costs
+// time logarithmic in the number of scheduled events.  A
+// 'bdlmt::TimerWheelScheduler' instead divides time into *ticks* of a fixed
+// duration (the *tick* *interval*, supplied at construction, 1 millisecond by
+// default), and keeps events in a hierarchy of six wheels of 64 slots each:
+//
+//: o Each slot of the first wheel holds the events due in one of the next 64
+//:   ticks.
+//:
+//: o Each slot of the second wheel holds the events due in one of the next 64
+//:   periods of 64 ticks, and so on, each wheel spanning 64 times the period
+//:   of the previous one.  Events too far in the future for the last wheel are
+//:   kept in its farthest slot.
+//
+// Scheduling, rescheduling, or cancelling an event therefore costs constant
+// time (independent of the number of scheduled events).  Whenever the first
+// wheel completes a revolution, the events in the next slot of the second
+// wheel are redistributed ("cascaded") among the slots of the first wheel,
+// and so on for the other wheels.  An event is cascaded at most once per wheel
+// before it is dispatched, and the dispatcher thread skips directly over
+// empty slots (i.e., it does not wake up once per tick while there are no
+// events due).  Finally, all of the events due at the same time are collected
+// as a batch, with a single acquisition of the scheduler's mutex, before being
+// dispatched.
+//
+///Order of Execution of Events
+///----------------------------
+// An event is never dispatched before its time, and is dispatched as soon as
+// possible after the end of the tick containing its time.  That is, events
+// are dispatched late by up to one tick interval (in addition to any delay
+// caused by thread contention or long-running callbacks).  Events are
+// dispatched in increasing order of their ticks, but the order in which events
+// due in the *same* tick are dispatched is unspecified.  Clients that require
+// events to be dispatched in the exact order of their times should use
+// 'bdlmt::EventScheduler' or 'bdlmt::TimerEventScheduler', or a tick interval
+// fine enough for their purpose.
+//
+// The time of each occurrence of a clock is computed from the start time of
+// the clock and its interval (i.e., a late dispatch does not delay the
+// subsequent occurrences).  When a clock falls behind (e.g., because the
+// dispatcher thread was busy for several of its intervals), each of its
+// missed occurrences is dispatched, in order, as soon as possible.
+//
+// Note that it is possible to schedule events in a scheduler that has not been
+// started yet.  When starting a scheduler, scheduled events whose times have
+// already passed will be dispatched as soon as possible after the start time.
+//
+///Comparison to 'bdlmt::TimerEventScheduler'
+///- - - - - - - - - - - - - - - - - - - - -
+// 'bdlmt::TimerWheelScheduler' provides the same manipulators and accessors
+// as 'bdlmt::TimerEventScheduler', with the same contracts (other than the
+// order of execution described above), except that it does not support event
+// keys.  As for 'bdlmt::TimerEventScheduler', the number of events and clocks
+// that can be scheduled at any one time is limited to 2**24 - 1, and
+// 'e_INVALID_HANDLE' is returned by 'scheduleEvent' and 'startClock' when that
+// limit would be exceeded.
+//
+///The Dispatcher Thread and the Dispatcher Functor
+///------------------------------------------------
+// Between calls to 'start' and 'stop', the scheduler creates a separate thread
+// (called the *dispatcher thread*) to process all the callbacks.  The
+// dispatcher thread executes the callbacks by passing them to the dispatcher
+// functor (optionally specified at creation time).  The default dispatcher
+// functor simply invokes the passed callback, effectively executing it in the
+// dispatcher thread.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::TimerWheelScheduler' class is both *fully thread-safe* (i.e.,
+// all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Supported Clock-Types
+///---------------------
+// As for 'bdlmt::TimerEventScheduler', times supplied to the methods of a
+// 'bdlmt::TimerWheelScheduler' are absolute offsets from the epoch of the
+// clock indicated at construction (see 'bsls::SystemClockType'), and the
+// current time according to that clock is available via the 'now' accessor.
+//
+///Event Clock Substitution
+///------------------------
+// For testing purposes, a class 'bdlmt::TimerWheelSchedulerTestTimeSource' is
+// provided to allow manual manipulation of the system-time observed by a
+// 'bdlmt::TimerWheelScheduler'.  A 'bdlmt::TimerWheelSchedulerTestTimeSource'
+// can be constructed for any existing 'bdlmt::TimerWheelScheduler' object that
+// has not been started and has not had any events scheduled, and it replaces
+// the clock of that scheduler.  The internal clock of the test time source is
+// initialized with an arbitrary value, and advances only when explicitly
+// instructed to do so by a call to 'advanceTime'.  Test events should
+// therefore be scheduled at offsets from the time reported by 'now'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Request Timeouts
+///- - - - - - - - - - - - - -
+// Suppose that a server must abandon each request for which no response has
+// been received within a timeout.  Most requests complete in time, so the
+// timeout of nearly every request is scheduled and then cancelled, making a
+// 'bdlmt::TimerWheelScheduler' a good fit.
+//
+// First, we define a class that tracks outstanding requests:
+//..
+//  class RequestTracker {
+//      // This class tracks outstanding requests, abandoning those that do
+//      // not complete within a timeout.
+//
+//      // DATA
+//      bdlmt::TimerWheelScheduler                         *d_scheduler_p;
+//      bsls::TimeInterval                                  d_timeout;
+//      bsl::map<int, bdlmt::TimerWheelScheduler::Handle>   d_requests;
+//      bsl::vector<int>                                    d_abandoned;
+//      bslmt::Mutex                                        d_mutex;
+//
+//      // PRIVATE MANIPULATORS
+//      void abandon(int requestId)
+//          // Abandon the request having the specified 'requestId'.
+//      {
+//          bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+//
+//          if (d_requests.erase(requestId)) {
+//              d_abandoned.push_back(requestId);
+//          }
+//      }
+//
+//    public:
+//      // CREATORS
+//      RequestTracker(bdlmt::TimerWheelScheduler *scheduler,
+//                     const bsls::TimeInterval&   timeout)
+//          // Create a request tracker that uses the specified 'scheduler' to
+//          // abandon requests after the specified 'timeout'.
+//      : d_scheduler_p(scheduler)
+//      , d_timeout(timeout)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      void sendRequest(int requestId)
+//          // Track the request having the specified 'requestId'.
+//      {
+//          bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+//
+//          d_requests[requestId] = d_scheduler_p->scheduleEvent(
+//                   d_scheduler_p->now() + d_timeout,
+//                   bdlf::BindUtil::bind(&RequestTracker::abandon,
+//                                        this,
+//                                        requestId));
+//      }
+//
+//      void receiveResponse(int requestId)
+//          // Stop tracking the request having the specified 'requestId'.
+//      {
+//          bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+//
+//          bsl::map<int, bdlmt::TimerWheelScheduler::Handle>::iterator it =
+//                                                 d_requests.find(requestId);
+//          if (it != d_requests.end()) {
+//              d_scheduler_p->cancelEvent(it->second);
+//              d_requests.erase(it);
+//          }
+//      }
+//
+//      // ACCESSORS
+//      bsl::vector<int> abandoned()
+//          // Return the identifiers of the abandoned requests.
+//      {
+//          bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+//
+//          return d_abandoned;
+//      }
+//  };
+//..
+// Then, we create a scheduler, having the default tick interval of one
+// millisecond, attach a test time source to it so that this example does not
+// depend on the speed of the machine running it, and start it:
+//..
+//  bdlmt::TimerWheelScheduler                scheduler;
+//  bdlmt::TimerWheelSchedulerTestTimeSource  timeSource(&scheduler);
+//
+//  scheduler.start();
+//
+//  RequestTracker tracker(&scheduler, bsls::TimeInterval(0.5));
+//..
+// Next, we send three requests, and receive the response to two of them:
+//..
+//  tracker.sendRequest(1);
+//  tracker.sendRequest(2);
+//  tracker.sendRequest(3);
+//
+//  tracker.receiveResponse(1);
+//  tracker.receiveResponse(3);
+//..
+// Then, we let the timeout elapse:
+//..
+//  timeSource.advanceTime(bsls::TimeInterval(1));
+//..
+// Finally, once the dispatcher thread has processed the timeout, we observe
+// that only the second request was abandoned:
+//..
+//  while (0 != scheduler.numEvents()) {
+//      bslmt::ThreadUtil::yield();
+//  }
+//  scheduler.stop();
+//
+//  assert(1 == tracker.abandoned().size());
+//  assert(2 == tracker.abandoned()[0]);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+class TimerWheelSchedulerTestTimeSource_Data;
+
+                        // =========================
+                        // class TimerWheelScheduler
+                        // =========================
+
+class TimerWheelScheduler {
+    // This class provides a thread-safe event scheduler, backed by a
+    // hierarchical timing wheel, that dispatches the callbacks of scheduled
+    // events and clocks from a separate dispatcher thread.  See the
+    // component-level documentation for details.
+
+  public:
+    // TYPES
+    typedef int Handle;
+        // Defines a type alias for a handle that identifies a scheduled clock
+        // or event.
+
+    typedef bsl::function<void(const bsl::function<void()>&)> Dispatcher;
+        // Defines a type alias for the dispatcher functor type.
+
+    // CONSTANTS
+    enum {
+        e_INVALID_HANDLE = -1  // value of an invalid event or clock handle
+    };
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        k_NUM_LEVELS      = 6,                         // number of wheels
+        k_SLOT_BITS       = 6,                         // log2(k_NUM_SLOTS)
+        k_NUM_SLOTS       = 1 << k_SLOT_BITS,          // slots per wheel
+        k_OVERDUE_SLOT    = k_NUM_LEVELS * k_NUM_SLOTS,
+                                                       // 'd_slot' of an
+                                                       // overdue node
+        k_INDEX_BITS      = 24,                        // node index bits of a
+                                                       // handle
+        k_MAX_NODES       = (1 << k_INDEX_BITS) - 1,   // maximum number of
+                                                       // events and clocks
+        k_GENERATION_MASK = 0x7F                       // generation bits of a
+                                                       // handle
+    };
+
+    // PRIVATE TYPES
+    struct Node {
+        // This 'struct' describes a scheduled event or clock.  The callback
+        // of a node is stored separately, in 'd_callbacks'.
+
+        bsls::TimeInterval  d_time;        // time of (next) dispatch
+        bsls::TimeInterval  d_interval;    // period of a clock, or 0 for an
+                                           // event
+        bsls::Types::Int64  d_expiry;      // tick of (next) dispatch
+        int                 d_next;        // next node in slot or free list,
+                                           // or -1
+        int                 d_prev;        // previous node in slot, or -1
+        int                 d_slot;        // slot holding this node, or -1
+        int                 d_generation;  // incremented when freed
+    };
+
+    typedef bsl::function<bsls::TimeInterval()> CurrentTimeFunctor;
+
+    // DATA
+    bslma::Allocator           *d_allocator_p;      // memory allocator (held)
+
+    CurrentTimeFunctor          d_currentTimeFunctor;
+                                                    // when called, returns the
+                                                    // current time
+
+    bsls::Types::Int64          d_tickNanoseconds;  // tick interval
+
+    bsls::Types::Int64          d_currentTick;      // next tick to process
+
+    bsls::Types::Int64          d_wakeTick;         // tick at which the
+                                                    // waiting dispatcher
+                                                    // thread will wake up
+
+    int                         d_slots[k_NUM_LEVELS][k_NUM_SLOTS];
+                                                    // first node of each slot,
+                                                    // or -1
+
+    bsls::Types::Uint64         d_occupied[k_NUM_LEVELS];
+                                                    // bit 'i' of element 'l'
+                                                    // is set if slot 'i' of
+                                                    // wheel 'l' is not empty
+
+    int                         d_overdueHead;      // first node due before
+                                                    // 'd_currentTick', or -1
+
+    int                         d_numScheduled;     // number of nodes in the
+                                                    // wheels and the overdue
+                                                    // list
+
+    bsl::vector<Node>           d_nodes;            // scheduled and free nodes
+
+    bsl::vector<bsl::function<void()> >
+                                d_callbacks;        // callback of each node
+
+    int                         d_freeHead;         // first free node, or -1
+
+    int                         d_freeTail;         // last free node, or -1
+
+    bsl::vector<bsl::function<void()> >
+                                d_pendingCallbacks; // batch of callbacks being
+                                                    // dispatched (used only by
+                                                    // the dispatcher thread)
+
+    bsl::vector<Handle>         d_pendingHandles;   // handles of the callbacks
+                                                    // in 'd_pendingCallbacks'
+
+    bsl::vector<char>           d_pendingIsClock;   // whether each callback in
+                                                    // 'd_pendingCallbacks' is
+                                                    // that of a clock
+
+    int                         d_currentPendingIndex;
+                                                    // index of the callback
+                                                    // being dispatched
+
+    bslmt::Mutex                d_dispatcherMutex;  // serialize starting and
+                                                    // stopping the dispatcher
+
+    bslmt::Mutex                d_mutex;            // protect the wheels and
+                                                    // nodes
+
+    bslmt::Condition            d_condition;        // signaled when an event
+                                                    // is due sooner than the
+                                                    // dispatcher thread wakes
+
+    Dispatcher                  d_dispatcherFunctor;
+                                                    // functor used to dispatch
+                                                    // callbacks
+
+    bslmt::ThreadUtil::Handle   d_dispatcherThread; // dispatcher thread handle
+
+    bsls::AtomicUint64          d_dispatcherId;     // id of dispatcher thread
+
+    bsls::AtomicInt             d_running;          // 1 if the dispatcher
+                                                    // thread is running
+
+    bsls::AtomicInt             d_iterations;       // dispatcher cycle
+                                                    // iteration
+
+    bsls::AtomicInt             d_numEvents;        // number of events
+
+    bsls::AtomicInt             d_numClocks;        // number of clocks
+
+    bsls::SystemClockType::Enum d_clockType;        // clock type used
+
+    // FRIENDS
+    friend struct TimerWheelScheduler_Dispatcher;
+    friend class  TimerWheelSchedulerTestTimeSource;
+
+    // NOT IMPLEMENTED
+    TimerWheelScheduler(const TimerWheelScheduler&);
+    TimerWheelScheduler& operator=(const TimerWheelScheduler&);
+
+    // PRIVATE MANIPULATORS
+    int allocateNode();
+        // Return the index of a free node, having an empty callback, or -1 if
+        // 'k_MAX_NODES' nodes are in use.  The behavior is undefined unless
+        // 'd_mutex' is locked.
+
+    int cancelPending(Handle handle);
+        // Discard the callbacks, identified by the specified 'handle', that
+        // are in the batch being dispatched and follow the callback being
+        // dispatched.  Return 0 if at least one callback was discarded, and a
+        // non-zero value otherwise.  The behavior is undefined unless this
+        // method is invoked from the dispatcher thread.
+
+    void cascade(int level);
+        // Redistribute the nodes of the slot of the specified 'level' that is
+        // due at 'd_currentTick'.  The behavior is undefined unless 'd_mutex'
+        // is locked.
+
+    void collectDueNodes(bsls::Types::Int64 nowTick);
+        // Collect the overdue nodes, then process the ticks up to and
+        // including the specified 'nowTick', collecting the nodes due (see
+        // 'collectNodes').  The behavior is undefined unless 'd_mutex' is
+        // locked.
+
+    void collectNodes(int head);
+        // Append to 'd_pendingCallbacks' the callbacks of the nodes of the
+        // detached list starting at the specified 'head', freeing the nodes
+        // of events and rescheduling those of clocks.  The behavior is
+        // undefined unless 'd_mutex' is locked.
+
+    void freeNode(int index);
+        // Append the node at the specified 'index' to the free list, and
+        // invalidate the handles referring to it.  The behavior is undefined
+        // unless 'd_mutex' is locked, and the node is not in a slot.
+
+    void insertNode(int index);
+        // Link the node at the specified 'index' into the slot corresponding
+        // to its expiry tick, or into the overdue list if that tick has
+        // already been processed.  The behavior is undefined unless 'd_mutex'
+        // is locked.
+
+    void removeNode(int index);
+        // Unlink the node at the specified 'index' from its slot.  The
+        // behavior is undefined unless 'd_mutex' is locked, and the node is in
+        // a slot.
+
+    void reset(const bsls::TimeInterval& currentTime);
+        // Empty the wheels, and set the next tick to process to the tick
+        // containing the specified 'currentTime'.  The behavior is undefined
+        // unless no events or clocks are scheduled.
+
+    void yieldToDispatcher();
+        // Wait until the dispatcher thread has completed its current
+        // iteration.  This method has no effect if the dispatcher thread is
+        // not running or if invoked from the dispatcher thread.
+
+    // PRIVATE ACCESSORS
+    int findNode(Handle handle, bool isClock) const;
+        // Return the index of the scheduled node, identified by the specified
+        // 'handle', that is a clock if the specified 'isClock' is 'true' and
+        // an event otherwise, or -1 if there is no such node.  The behavior is
+        // undefined unless 'd_mutex' is locked.
+
+    bool isDispatcherThread() const;
+        // Return 'true' if this method is invoked from the dispatcher thread,
+        // and 'false' otherwise.
+
+    bsls::Types::Int64 nextTick(bsls::Types::Int64 tick) const;
+        // Return the first tick, at or after the specified 'tick', at which a
+        // node is due or an occupied slot is cascaded.  The behavior is
+        // undefined unless 'd_mutex' is locked and at least one node is
+        // scheduled.
+
+    bsls::Types::Int64 toTick(const bsls::TimeInterval& time,
+                              bool                      roundUp) const;
+        // Return the tick containing the specified 'time', if the specified
+        // 'roundUp' is 'false', and the first tick starting at or after
+        // 'time' otherwise.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TimerWheelScheduler,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TimerWheelScheduler(bslma::Allocator *basicAllocator = 0);
+        // Construct a scheduler having a tick interval of one millisecond and
+        // using the default dispatcher functor (see the "The Dispatcher Thread
+        // and the Dispatcher Functor" section in component-level
+        // documentation) and the realtime clock epoch for all time intervals
+        // (see {Supported Clock-Types} in the component documentation).
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    explicit TimerWheelScheduler(
+                      const bsls::TimeInterval&    tickInterval,
+                      bslma::Allocator            *basicAllocator = 0);
+    TimerWheelScheduler(const bsls::TimeInterval&    tickInterval,
+                        bsls::SystemClockType::Enum  clockType,
+                        bslma::Allocator            *basicAllocator = 0);
+    TimerWheelScheduler(const bsls::TimeInterval&    tickInterval,
+                        const Dispatcher&            dispatcherFunctor,
+                        bsls::SystemClockType::Enum  clockType,
+                        bslma::Allocator            *basicAllocator = 0);
+        // Construct a scheduler having the specified 'tickInterval'.
+        // Optionally specify a 'dispatcherFunctor' used to dispatch the
+        // callbacks; if 'dispatcherFunctor' is not specified, the callbacks
+        // are invoked directly by the dispatcher thread.  Optionally specify
+        // the 'clockType' indicating the epoch used for all time intervals;
+        // if 'clockType' is not specified, the realtime clock is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // '0 < tickInterval.totalNanoseconds()' and 'tickInterval' is at most
+        // one day.
+
+    ~TimerWheelScheduler();
+        // Stop this scheduler, discard all the unprocessed events and destroy
+        // this object.
+
+    // MANIPULATORS
+    int start();
+        // Begin dispatching events on this scheduler using default attributes
+        // for the dispatcher thread.  Return 0 on success, and a nonzero value
+        // otherwise.  If another thread is currently executing 'stop', wait
+        // until the dispatcher thread stops before starting a new one.  If
+        // this scheduler has already started (and is not currently being
+        // stopped by another thread) then this invocation has no effect and 0
+        // is returned.  The behavior is undefined if this method is invoked in
+        // the dispatcher thread (i.e., in a job executed by this scheduler).
+        // Note that any event whose time has already passed is pending and
+        // will be dispatched immediately.
+
+    int start(const bslmt::ThreadAttributes& threadAttributes);
+        // Begin dispatching events on this scheduler using the specified
+        // 'threadAttributes' for the dispatcher thread (except that the
+        // DETACHED attribute is ignored).  Return 0 on success, and a nonzero
+        // value otherwise.  If another thread is currently executing 'stop',
+        // wait until the dispatcher thread stops before starting a new one.
+        // If this scheduler has already started (and is not currently being
+        // stopped by another thread) then this invocation has no effect and 0
+        // is returned.  The behavior is undefined if this method is invoked in
+        // the dispatcher thread (i.e., in a job executed by this scheduler).
+
+    void stop();
+        // End the dispatching of events on this scheduler (but do not remove
+        // any pending events), and wait for the batch of callbacks currently
+        // being dispatched, if any, to complete.  If the scheduler is already
+        // stopped then this method has no effect.  This scheduler can be
+        // restarted by invoking 'start'.  The behavior is undefined if this
+        // method is invoked from the dispatcher thread.  Note that callbacks
+        // that were collected for dispatch but not yet dispatched when 'stop'
+        // is invoked are dispatched before 'stop' returns.
+
+    Handle scheduleEvent(const bsls::TimeInterval&    time,
+                         const bsl::function<void()>& callback);
+        // Schedule the specified 'callback' to be dispatched at the specified
+        // 'time'.  On success, return a handle that can be used to cancel the
+        // 'callback' (by invoking 'cancelEvent'), or return 'e_INVALID_HANDLE'
+        // if scheduling this event would exceed the maximum number of
+        // scheduled events and clocks.  The 'time' is an absolute time
+        // represented as an interval from the epoch of the clock indicated at
+        // construction.
+
+    int rescheduleEvent(Handle                    handle,
+                        const bsls::TimeInterval& newTime,
+                        bool                      wait = false);
+        // Reschedule the event having the specified 'handle' at the specified
+        // 'newTime'.  If the optionally specified 'wait' is true, then ensure
+        // that the event having the 'handle' (if it is valid) is either
+        // successfully rescheduled or dispatched before the call returns.
+        // Return 0 on successful reschedule, and a non-zero value if the
+        // 'handle' is invalid *or* if the event has already been dispatched
+        // *or* if the event has not yet been dispatched but will soon be
+        // dispatched.  If this method is being invoked from the dispatcher
+        // thread then the 'wait' is ignored to avoid deadlock.
+
+    int cancelEvent(Handle handle, bool wait = false);
+        // Cancel the event having the specified 'handle'.  If the optionally
+        // specified 'wait' is true, then ensure that the dispatcher thread has
+        // resumed execution before returning.  Return 0 on successful
+        // cancellation, and a non-zero value if the 'handle' is invalid *or*
+        // if it is too late to cancel the event.  If this method is being
+        // invoked from the dispatcher thread then the 'wait' is ignored to
+        // avoid deadlock.
+
+    void cancelAllEvents(bool wait = false);
+        // Cancel all the events.  If the optionally specified 'wait' is true,
+        // then ensure any event still in this scheduler is either cancelled or
+        // has been dispatched before this call returns.  If this method is
+        // being invoked from the dispatcher thread then the 'wait' is ignored
+        // to avoid deadlock.
+
+    Handle startClock(
+               const bsls::TimeInterval&    interval,
+               const bsl::function<void()>& callback,
+               const bsls::TimeInterval&    startTime = bsls::TimeInterval(0));
+        // Schedule a recurring event that invokes the specified 'callback' at
+        // every specified 'interval', starting at the optionally specified
+        // 'startTime'.  On success, return a handle that can be use to cancel
+        // the clock (by invoking 'cancelClock'), or return 'e_INVALID_HANDLE'
+        // if scheduling this clock would exceed the maximum number of
+        // scheduled events and clocks.  If no start time is specified, it is
+        // assumed to be the 'interval' time from now.  The 'startTime' is an
+        // absolute time represented as an interval from the epoch of the clock
+        // indicated at construction.  The behavior is undefined unless
+        // '0 < interval'.
+
+    int cancelClock(Handle handle, bool wait = false);
+        // Cancel the clock having the specified 'handle'.  If the optionally
+        // specified 'wait' is true, then ensure that any scheduled event for
+        // the clock having 'handle' is either cancelled or has been dispatched
+        // before this call returns.  Return 0 on success, and a non-zero value
+        // if the 'handle' is invalid.  If this method is being invoked from
+        // the dispatcher thread, then the 'wait' is ignored to avoid deadlock.
+
+    void cancelAllClocks(bool wait = false);
+        // Cancel all clocks.  If the optionally specified 'wait' is true, then
+        // ensure that any clock event still in this scheduler is either
+        // cancelled or has been dispatched before this call returns.  If this
+        // method is being invoked from the dispatcher thread, then the 'wait'
+        // is ignored to avoid deadlock.
+
+    // ACCESSORS
+    bsls::SystemClockType::Enum clockType() const;
+        // Return the value of the clock type that this object was created
+        // with.
+
+    bsls::TimeInterval now() const;
+        // Return the current epoch time, an absolute time represented as an
+        // interval from the epoch of the clock indicated at construction.
+
+    int numClocks() const;
+        // Return a *snapshot* of the number of registered clocks with this
+        // scheduler.
+
+    int numEvents() const;
+        // Return a *snapshot* of the number of pending events and events being
+        // dispatched in this scheduler.
+
+    bsls::TimeInterval tickInterval() const;
+        // Return the tick interval of this scheduler.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+                  // =======================================
+                  // class TimerWheelSchedulerTestTimeSource
+                  // =======================================
+
+class TimerWheelSchedulerTestTimeSource {
+    // This class provides a means to change the clock that is used by a given
+    // timer-wheel scheduler to determine when events should be triggered.
+    // Constructing a 'TimerWheelSchedulerTestTimeSource' alters the behavior
+    // of the supplied scheduler.  After a test time-source is created, the
+    // underlying scheduler will run events according to a discrete timeline,
+    // whose successive values are determined by calls to 'advanceTime' on the
+    // test time-source, and can be retrieved by calling 'now' on that test
+    // time-source.
+
+    // DATA
+    bsl::shared_ptr<TimerWheelSchedulerTestTimeSource_Data>
+                         d_data_p;        // shared pointer to the state whose
+                                          // lifetime must be as long as
+                                          // '*this' and '*d_scheduler_p'
+
+    TimerWheelScheduler *d_scheduler_p;   // pointer to the scheduler that we
+                                          // are augmenting
+
+    // NOT IMPLEMENTED
+    TimerWheelSchedulerTestTimeSource(
+                                     const TimerWheelSchedulerTestTimeSource&);
+    TimerWheelSchedulerTestTimeSource& operator=(
+                                     const TimerWheelSchedulerTestTimeSource&);
+
+  public:
+    // CREATORS
+    explicit TimerWheelSchedulerTestTimeSource(TimerWheelScheduler *scheduler);
+        // Construct a test time-source object that will control the
+        // "system-time" observed by the specified 'scheduler'.  The behavior
+        // is undefined unless 'scheduler' has not been started and has no
+        // scheduled events or clocks.
+
+    //! ~TimerWheelSchedulerTestTimeSource() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    bsls::TimeInterval advanceTime(bsls::TimeInterval amount);
+        // Advance this object's current-time value by the specified 'amount'
+        // of time, notify the scheduler that the time has changed, and return
+        // the updated current-time value.  The behavior is undefined unless
+        // 'amount' is positive, and 'now + amount' is within the range that
+        // can be represented with a 'bsls::TimeInterval'.
+
+    // ACCESSORS
+    bsls::TimeInterval now() const;
+        // Return this object's current-time value.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // -------------------------
+                        // class TimerWheelScheduler
+                        // -------------------------
+
+// ACCESSORS
+inline
+bsls::SystemClockType::Enum TimerWheelScheduler::clockType() const
+{
+    return d_clockType;
+}
+
+inline
+bsls::TimeInterval TimerWheelScheduler::now() const
+{
+    return d_currentTimeFunctor();
+}
+
+inline
+int TimerWheelScheduler::numClocks() const
+{
+    return d_numClocks;
+}
+
+inline
+int TimerWheelScheduler::numEvents() const
+{
+    return d_numEvents;
+}
+
+inline
+bsls::TimeInterval TimerWheelScheduler::tickInterval() const
+{
+    bsls::TimeInterval interval;
+    interval.setTotalNanoseconds(d_tickNanoseconds);
+    return interval;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *TimerWheelScheduler::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1782 @@
+// bdlmt_timerwheelscheduler.t.cpp                                    -*-C++-*-
+#include <bdlmt_timerwheelscheduler.h>
+
+#include <bdlmt_eventscheduler.h>
+#include <bdlmt_timereventscheduler.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlt_timeunitratio.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_systemtime.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlmt::TimerWheelScheduler' is a thread-safe event scheduler backed by a
+// hierarchical timing wheel.  Most tests replace the clock of the scheduler
+// with a 'bdlmt::TimerWheelSchedulerTestTimeSource', so that the times at
+// which callbacks are dispatched are deterministic.  We verify that handles
+// are valid exactly as long as their events or clocks are scheduled, that
+// events on every wheel (and beyond the last wheel) are dispatched neither
+// before their time nor more than one tick after it, that clocks recur at the
+// expected times and may be cancelled from their own callbacks, that
+// 'cancelAllEvents' and 'cancelAllClocks' discard exactly the expected
+// callbacks, and that the scheduler behaves correctly when used concurrently
+// with the real clock.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] TimerWheelScheduler(Allocator *ba = 0);
+// [ 3] TimerWheelScheduler(const TimeInterval&, Allocator *ba = 0);
+// [ 6] TimerWheelScheduler(const TimeInterval&, Enum, Allocator *ba = 0);
+// [ 5] TimerWheelScheduler(const TimeInterval&, Dispatcher, Enum, ba=0);
+// [ 1] ~TimerWheelScheduler();
+//
+// MANIPULATORS
+// [ 1] int start();
+// [ 6] int start(const bslmt::ThreadAttributes& threadAttributes);
+// [ 1] void stop();
+// [ 2] Handle scheduleEvent(const TimeInterval&, const function&);
+// [ 2] int rescheduleEvent(Handle, const TimeInterval&, bool = false);
+// [ 2] int cancelEvent(Handle handle, bool wait = false);
+// [ 5] void cancelAllEvents(bool wait = false);
+// [ 4] Handle startClock(const TimeInterval&, const function&, ...);
+// [ 4] int cancelClock(Handle handle, bool wait = false);
+// [ 5] void cancelAllClocks(bool wait = false);
+//
+// ACCESSORS
+// [ 1] bsls::SystemClockType::Enum clockType() const;
+// [ 2] bsls::TimeInterval now() const;
+// [ 2] int numClocks() const;
+// [ 2] int numEvents() const;
+// [ 1] bsls::TimeInterval tickInterval() const;
+// [ 1] bslma::Allocator *allocator() const;
+//
+// TimerWheelSchedulerTestTimeSource
+// [ 2] TimerWheelSchedulerTestTimeSource(TimerWheelScheduler *scheduler);
+// [ 3] bsls::TimeInterval advanceTime(bsls::TimeInterval amount);
+// [ 2] bsls::TimeInterval now() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] DISPATCH TIMES ACROSS WHEELS
+// [ 6] CONCURRENCY TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: SCHEDULE/CANCEL AND DISPATCH THROUGHPUT
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::TimerWheelScheduler               Obj;
+typedef bdlmt::TimerWheelSchedulerTestTimeSource TestTimeSource;
+typedef bsls::Types::Int64                       Int64;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+const double k_MAX_WAIT_SECONDS = 30.0;
+    // time after which a test waiting for the dispatcher thread gives up
+
+// ============================================================================
+//                     HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static void setFlag(bsls::AtomicInt *flag)
+    // Set the specified 'flag'.
+{
+    *flag = 1;
+}
+
+static void increment(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+static bool waitForNumEvents(const Obj& scheduler, int numEvents)
+    // Wait until the specified 'scheduler' has the specified 'numEvents'
+    // pending events.  Return 'true' on success, and 'false' if that did not
+    // happen within 'k_MAX_WAIT_SECONDS'.
+{
+    bsls::Stopwatch timer;
+    timer.start();
+    while (numEvents != scheduler.numEvents()) {
+        if (timer.accumulatedWallTime() > k_MAX_WAIT_SECONDS) {
+            return false;                                             // RETURN
+        }
+        bslmt::ThreadUtil::yield();
+    }
+    return true;
+}
+
+static bool waitForCount(const bsls::AtomicInt& counter, int value)
+    // Wait until the specified 'counter' reaches the specified 'value'.
+    // Return 'true' on success, and 'false' if that did not happen within
+    // 'k_MAX_WAIT_SECONDS'.
+{
+    bsls::Stopwatch timer;
+    timer.start();
+    while (counter < value) {
+        if (timer.accumulatedWallTime() > k_MAX_WAIT_SECONDS) {
+            return false;                                             // RETURN
+        }
+        bslmt::ThreadUtil::yield();
+    }
+    return true;
+}
+
+static bool synchronize(Obj *scheduler)
+    // Wait until the specified 'scheduler' has dispatched all the callbacks
+    // due at its current time.  Return 'true' on success, and 'false' if that
+    // did not happen within 'k_MAX_WAIT_SECONDS'.  The behavior is undefined
+    // unless 'scheduler' is started.  Note that a marker event scheduled in
+    // the past may be collected in the same batch as the callbacks due at the
+    // current time, but a second marker, scheduled after the first one is
+    // dispatched, is collected in a later batch.
+{
+    for (int i = 0; i < 2; ++i) {
+        bsls::AtomicInt flag(0);
+
+        scheduler->scheduleEvent(
+                               scheduler->now() - scheduler->tickInterval(),
+                               bdlf::BindUtil::bind(&setFlag, &flag));
+        if (!waitForCount(flag, 1)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+static bsls::TimeInterval multiply(const bsls::TimeInterval& interval,
+                                   int                       factor)
+    // Return the specified 'interval' multiplied by the specified 'factor'.
+{
+    bsls::TimeInterval result;
+    result.setTotalNanoseconds(interval.totalNanoseconds() * factor);
+    return result;
+}
+
+static void sleepAndSet(bsls::AtomicInt *started, bsls::AtomicInt *finished)
+    // Set the specified 'started', sleep for 100 milliseconds, and set the
+    // specified 'finished'.
+{
+    *started = 1;
+    bslmt::ThreadUtil::microSleep(100000);
+    *finished = 1;
+}
+
+static Int64 ceilTick(const bsls::TimeInterval& time, Int64 tickNanoseconds)
+    // Return the index of the first tick of the specified 'tickNanoseconds'
+    // that starts at or after the specified 'time'.
+{
+    const Int64 ns = time.totalNanoseconds();
+    return ns >= 0 ? (ns + tickNanoseconds - 1) / tickNanoseconds
+                   : -(-ns / tickNanoseconds);
+}
+
+static Int64 floorTick(const bsls::TimeInterval& time, Int64 tickNanoseconds)
+    // Return the index of the tick of the specified 'tickNanoseconds' that
+    // contains the specified 'time'.
+{
+    const Int64 ns = time.totalNanoseconds();
+    return ns >= 0 ? ns / tickNanoseconds
+                   : -((-ns + tickNanoseconds - 1) / tickNanoseconds);
+}
+
+                              // ==============
+                              // class Recorder
+                              // ==============
+
+class Recorder {
+    // This class records the identifiers of the callbacks dispatched by a
+    // scheduler, together with the time of the scheduler at which they were
+    // dispatched.
+
+  public:
+    // TYPES
+    typedef bsl::pair<int, bsls::TimeInterval> Record;
+
+  private:
+    // DATA
+    const Obj           *d_scheduler_p;  // scheduler (held, not owned)
+    bsl::vector<Record>  d_records;      // dispatched callbacks
+    mutable bslmt::Mutex d_mutex;        // protects 'd_records'
+
+  public:
+    // CREATORS
+    explicit Recorder(const Obj *scheduler)
+        // Create a recorder for callbacks dispatched by the specified
+        // 'scheduler'.
+    : d_scheduler_p(scheduler)
+    {
+    }
+
+    // MANIPULATORS
+    void record(int id)
+        // Record that the callback having the specified 'id' is dispatched.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_records.push_back(Record(id, d_scheduler_p->now()));
+    }
+
+    // ACCESSORS
+    bsl::vector<Record> records() const
+        // Return the recorded callbacks, in the order they were dispatched.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_records;
+    }
+};
+
+                              // ===============
+                              // class Canceller
+                              // ===============
+
+struct Canceller {
+    // This class provides callbacks that cancel events and clocks from the
+    // dispatcher thread.
+
+    // DATA
+    Obj             *d_scheduler_p;  // scheduler (held, not owned)
+    Obj::Handle      d_handle;       // handle to cancel
+    int              d_rc;           // value returned by the cancellation
+    bsls::AtomicInt  d_count;        // number of invocations
+
+    // CREATORS
+    explicit Canceller(Obj *scheduler)
+        // Create a canceller for the specified 'scheduler'.
+    : d_scheduler_p(scheduler)
+    , d_handle(Obj::e_INVALID_HANDLE)
+    , d_rc(-1)
+    , d_count(0)
+    {
+    }
+
+    // MANIPULATORS
+    void cancelEvent()
+        // Cancel the event having 'd_handle', and record the status.
+    {
+        d_rc = d_scheduler_p->cancelEvent(d_handle, true);
+        ++d_count;
+    }
+
+    void cancelClock()
+        // Cancel the clock having 'd_handle', and record the status.
+    {
+        d_rc = d_scheduler_p->cancelClock(d_handle, true);
+        ++d_count;
+    }
+
+    void cancelAllClocks()
+        // Cancel all the clocks.
+    {
+        d_scheduler_p->cancelAllClocks(true);
+        ++d_count;
+    }
+};
+
+static bsls::AtomicInt s_numDispatched(0);
+
+static void countingDispatcher(const bsl::function<void()>& callback)
+    // Increment 's_numDispatched' and invoke the specified 'callback'.
+{
+    ++s_numDispatched;
+    callback();
+}
+
+                         // ========================
+                         // struct ConcurrencyRecord
+                         // ========================
+
+struct ConcurrencyRecord {
+    // This 'struct' records the fate of an event scheduled by the concurrency
+    // test.
+
+    bsls::TimeInterval d_time;        // time of the event
+    bsls::AtomicInt    d_numCalls;    // number of dispatches
+    bsls::AtomicInt    d_early;       // set if dispatched early
+    int                d_cancelRc;    // status of the cancellation, or 1
+};
+
+static void concurrencyCallback(ConcurrencyRecord *record, const Obj *obj)
+    // Record in the specified 'record' the dispatch of its event by the
+    // specified 'obj'.
+{
+    if (obj->now() < record->d_time) {
+        record->d_early = 1;
+    }
+    ++record->d_numCalls;
+}
+
+static void concurrencyThread(Obj               *obj,
+                              ConcurrencyRecord *records,
+                              int                numRecords,
+                              int                seed)
+    // Schedule events on the specified 'obj' at random times in the next few
+    // milliseconds, recording their fate in the specified 'records' having the
+    // specified 'numRecords' elements, and cancel or reschedule some of them
+    // using the specified 'seed' for random numbers.
+{
+    bsl::vector<Obj::Handle> handles(numRecords);
+
+    unsigned int state = seed;
+    for (int i = 0; i < numRecords; ++i) {
+        state = state * 1103515245 + 12345;
+
+        ConcurrencyRecord& record = records[i];
+
+        record.d_time = obj->now()
+                      + bsls::TimeInterval(0, (state >> 8) % 5000000);
+        record.d_cancelRc = 1;
+
+        handles[i] = obj->scheduleEvent(
+                            record.d_time,
+                            bdlf::BindUtil::bind(&concurrencyCallback,
+                                                 &record,
+                                                 obj));
+        ASSERTV(i, Obj::e_INVALID_HANDLE != handles[i]);
+
+        if (i >= 8 && 0 == (state >> 4) % 3) {
+            const int j = i - static_cast<int>((state >> 12) % 8);
+
+            if (0 == obj->cancelEvent(handles[j])) {
+                records[j].d_cancelRc = 0;
+            }
+        }
+        if (0 == i % 64) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Request Timeouts
+///- - - - - - - - - - - - - -
+// Suppose that a server must abandon each request for which no response has
+// been received within a timeout.  Most requests complete in time, so the
+// timeout of nearly every request is scheduled and then cancelled, making a
+// 'bdlmt::TimerWheelScheduler' a good fit.
+//
+// First, we define a class that tracks outstanding requests:
+//..
+    class RequestTracker {
+        // This class tracks outstanding requests, abandoning those that do
+        // not complete within a timeout.
+
+        // DATA
+        bdlmt::TimerWheelScheduler                         *d_scheduler_p;
+        bsls::TimeInterval                                  d_timeout;
+        bsl::map<int, bdlmt::TimerWheelScheduler::Handle>   d_requests;
+        bsl::vector<int>                                    d_abandoned;
+        bslmt::Mutex                                        d_mutex;
+
+        // PRIVATE MANIPULATORS
+        void abandon(int requestId)
+            // Abandon the request having the specified 'requestId'.
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            if (d_requests.erase(requestId)) {
+                d_abandoned.push_back(requestId);
+            }
+        }
+
+      public:
+        // CREATORS
+        RequestTracker(bdlmt::TimerWheelScheduler *scheduler,
+                       const bsls::TimeInterval&   timeout)
+            // Create a request tracker that uses the specified 'scheduler' to
+            // abandon requests after the specified 'timeout'.
+        : d_scheduler_p(scheduler)
+        , d_timeout(timeout)
+        {
+        }
+
+        // MANIPULATORS
+        void sendRequest(int requestId)
+            // Track the request having the specified 'requestId'.
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_requests[requestId] = d_scheduler_p->scheduleEvent(
+                     d_scheduler_p->now() + d_timeout,
+                     bdlf::BindUtil::bind(&RequestTracker::abandon,
+                                          this,
+                                          requestId));
+        }
+
+        void receiveResponse(int requestId)
+            // Stop tracking the request having the specified 'requestId'.
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            bsl::map<int, bdlmt::TimerWheelScheduler::Handle>::iterator it =
+                                                   d_requests.find(requestId);
+            if (it != d_requests.end()) {
+                d_scheduler_p->cancelEvent(it->second);
+                d_requests.erase(it);
+            }
+        }
+
+        // ACCESSORS
+        bsl::vector<int> abandoned()
+            // Return the identifiers of the abandoned requests.
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            return d_abandoned;
+        }
+    };
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a scheduler, having the default tick interval of one
+// millisecond, attach a test time source to it so that this example does not
+// depend on the speed of the machine running it, and start it:
+//..
+    bdlmt::TimerWheelScheduler                scheduler;
+    bdlmt::TimerWheelSchedulerTestTimeSource  timeSource(&scheduler);
+
+    scheduler.start();
+
+    RequestTracker tracker(&scheduler, bsls::TimeInterval(0.5));
+//..
+// Next, we send three requests, and receive the response to two of them:
+//..
+    tracker.sendRequest(1);
+    tracker.sendRequest(2);
+    tracker.sendRequest(3);
+
+    tracker.receiveResponse(1);
+    tracker.receiveResponse(3);
+//..
+// Then, we let the timeout elapse:
+//..
+    timeSource.advanceTime(bsls::TimeInterval(1));
+//..
+// Finally, once the dispatcher thread has processed the timeout, we observe
+// that only the second request was abandoned:
+//..
+    while (0 != scheduler.numEvents()) {
+        bslmt::ThreadUtil::yield();
+    }
+    scheduler.stop();
+
+    ASSERT(1 == tracker.abandoned().size());
+    ASSERT(2 == tracker.abandoned()[0]);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Events scheduled, cancelled, and dispatched concurrently, using
+        //:   the real clock, are dispatched exactly once, unless successfully
+        //:   cancelled, in which case they are never dispatched.
+        //:
+        //: 2 No event is dispatched before its time.
+        //:
+        //: 3 'numEvents' returns to 0 once all events are dispatched, and all
+        //:   memory is supplied by the object allocator.
+        //
+        // Plan:
+        //: 1 Start a scheduler having a tick of 100 microseconds using the
+        //:   monotonic clock, and concurrently schedule, from several threads,
+        //:   events at random times in the next 5 milliseconds, cancelling
+        //:   some of them soon after.  Once all events are processed, verify
+        //:   that each event was dispatched once if and only if it was not
+        //:   successfully cancelled, and not before its time.  (C-1..3)
+        //
+        // Testing:
+        //   TimerWheelScheduler(const TimeInterval&, Enum, Allocator *ba = 0);
+        //   int start(const bslmt::ThreadAttributes& threadAttributes);
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 20000 };
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        ConcurrencyRecord *records =
+                          new ConcurrencyRecord[k_NUM_THREADS * k_NUM_RECORDS];
+        {
+            Obj mX(bsls::TimeInterval(0, 100000),
+                   bsls::SystemClockType::e_MONOTONIC,
+                   &ta);
+            const Obj& X = mX;
+
+            bslmt::ThreadAttributes attributes;
+            attributes.setStackSize(256 * 1024);
+            ASSERT(0 == mX.start(attributes));
+
+            bslmt::ThreadGroup threads;
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(
+                                             &concurrencyThread,
+                                             &mX,
+                                             &records[i * k_NUM_RECORDS],
+                                             static_cast<int>(k_NUM_RECORDS),
+                                             i + 1));
+            }
+            threads.joinAll();
+
+            ASSERT(waitForNumEvents(X, 0));
+            mX.stop();
+        }
+
+        int numCancelled = 0;
+        for (int i = 0; i < k_NUM_THREADS * k_NUM_RECORDS; ++i) {
+            const ConcurrencyRecord& record = records[i];
+
+            if (0 == record.d_cancelRc) {
+                ++numCancelled;
+            }
+            ASSERTV(i, record.d_cancelRc, record.d_numCalls,
+                    (0 == record.d_cancelRc) == (0 == record.d_numCalls));
+            ASSERTV(i, record.d_numCalls, record.d_numCalls <= 1);
+            ASSERTV(i, 0 == record.d_early);
+        }
+        if (verbose) { P(numCancelled); }
+
+        delete[] records;
+
+        ASSERT(0 <  numCancelled);
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CANCELLING ALL EVENTS AND CLOCKS
+        //
+        // Concerns:
+        //: 1 'cancelAllEvents' cancels all scheduled events, but no clocks.
+        //:
+        //: 2 'cancelAllClocks' cancels all clocks, but no events.
+        //:
+        //: 3 When 'wait' is 'true', the callbacks being dispatched at the time
+        //:   of the call have completed when these methods return.
+        //:
+        //: 4 Cancelling from a callback discards the callbacks due in the same
+        //:   tick that have not been dispatched yet, and 'cancelEvent' returns
+        //:   0 in that case.
+        //:
+        //: 5 The callbacks are passed to the dispatcher functor.
+        //
+        // Plan:
+        //: 1 Using a test time source, schedule events and clocks, cancel all
+        //:   events (resp. clocks), advance time, and verify that only the
+        //:   clocks (resp. events) are dispatched.  (C-1..2)
+        //:
+        //: 2 Schedule an event whose callback sleeps, and verify that, once
+        //:   it is being dispatched, 'cancelAllEvents(true)' returns after the
+        //:   callback completes.  (C-3)
+        //:
+        //: 3 Schedule, in the same tick, an event whose callback cancels a
+        //:   second event, or all clocks, and verify that exactly one of the
+        //:   callbacks due in that tick is dispatched, whichever is dispatched
+        //:   first.  (C-4)
+        //:
+        //: 4 Use a dispatcher functor that counts its invocations.  (C-5)
+        //
+        // Testing:
+        //   TimerWheelScheduler(const TimeInterval&, Dispatcher, Enum, ba=0);
+        //   void cancelAllEvents(bool wait = false);
+        //   void cancelAllClocks(bool wait = false);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CANCELLING ALL EVENTS AND CLOCKS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const bsls::TimeInterval TICK(0, 1000000);
+
+        if (verbose) cout << "\tCancel all events or all clocks." << endl;
+        {
+            s_numDispatched = 0;
+
+            Obj            mX(TICK,
+                              &countingDispatcher,
+                              bsls::SystemClockType::e_REALTIME,
+                              &ta);
+            const Obj&     X = mX;
+            TestTimeSource timeSource(&mX);
+
+            bsls::AtomicInt numEventCalls(0);
+            bsls::AtomicInt numClockCalls(0);
+
+            const bsls::TimeInterval T0 = timeSource.now();
+
+            for (int i = 0; i < 10; ++i) {
+                mX.scheduleEvent(T0 + bsls::TimeInterval(i % 3 + 1),
+                                 bdlf::BindUtil::bind(&increment,
+                                                      &numEventCalls));
+            }
+            mX.startClock(bsls::TimeInterval(1),
+                          bdlf::BindUtil::bind(&increment, &numClockCalls));
+            mX.startClock(bsls::TimeInterval(2),
+                          bdlf::BindUtil::bind(&increment, &numClockCalls));
+
+            ASSERT(10 == X.numEvents());
+            ASSERT( 2 == X.numClocks());
+
+            mX.cancelAllEvents();
+
+            ASSERT( 0 == X.numEvents());
+            ASSERT( 2 == X.numClocks());
+
+            ASSERT(0 == mX.start());
+
+            timeSource.advanceTime(bsls::TimeInterval(2) + TICK);
+            ASSERT(synchronize(&mX));
+
+            ASSERTV(numEventCalls, 0 == numEventCalls);
+            ASSERTV(numClockCalls, 3 == numClockCalls);
+
+            for (int i = 0; i < 10; ++i) {
+                mX.scheduleEvent(timeSource.now() + bsls::TimeInterval(i + 1),
+                                 bdlf::BindUtil::bind(&increment,
+                                                      &numEventCalls));
+            }
+            mX.cancelAllClocks(true);
+
+            ASSERT(10 == X.numEvents());
+            ASSERT( 0 == X.numClocks());
+
+            timeSource.advanceTime(bsls::TimeInterval(10) + TICK);
+            ASSERT(waitForNumEvents(X, 0));
+            ASSERT(synchronize(&mX));
+
+            ASSERTV(numEventCalls, 10 == numEventCalls);
+            ASSERTV(numClockCalls,  3 == numClockCalls);
+
+            mX.stop();
+
+            // 13 callbacks, and 2 markers per call to 'synchronize'.
+
+            ASSERTV(s_numDispatched, 17 == s_numDispatched);
+        }
+
+        if (verbose) cout << "\tWait for the callback being dispatched."
+                          << endl;
+        {
+            Obj            mX(TICK, &ta);
+            TestTimeSource timeSource(&mX);
+
+            bsls::AtomicInt started(0);
+            bsls::AtomicInt finished(0);
+
+            mX.scheduleEvent(timeSource.now() + TICK,
+                             bdlf::BindUtil::bind(&sleepAndSet,
+                                                  &started,
+                                                  &finished));
+            ASSERT(0 == mX.start());
+
+            timeSource.advanceTime(multiply(TICK, 2));
+            ASSERT(waitForCount(started, 1));
+
+            mX.cancelAllEvents(true);
+            ASSERT(1 == finished);
+
+            mX.stop();
+        }
+
+        if (verbose) cout << "\tCancel from the dispatcher thread." << endl;
+        {
+            for (int ti = 0; ti < 20; ++ti) {
+                Obj            mX(TICK, &ta);
+                const Obj&     X = mX;
+                TestTimeSource timeSource(&mX);
+                Canceller      c1(&mX);
+                Canceller      c2(&mX);
+
+                const bsls::TimeInterval T = timeSource.now() + TICK;
+
+                // Two events due in the same tick, each cancelling the other.
+
+                c2.d_handle = mX.scheduleEvent(
+                                  T,
+                                  bdlf::BindUtil::bind(&Canceller::cancelEvent,
+                                                       &c1));
+                c1.d_handle = mX.scheduleEvent(
+                                  T,
+                                  bdlf::BindUtil::bind(&Canceller::cancelEvent,
+                                                       &c2));
+                ASSERT(0 == mX.start());
+
+                timeSource.advanceTime(multiply(TICK, 2));
+                ASSERT(waitForNumEvents(X, 0));
+
+                ASSERTV(ti, c1.d_count, c2.d_count,
+                        1 == c1.d_count + c2.d_count);
+                ASSERTV(ti, c1.d_rc, c2.d_rc,
+                        0 == (c1.d_count ? c1.d_rc : c2.d_rc));
+
+                mX.stop();
+            }
+
+            Obj            mX(TICK, &ta);
+            TestTimeSource timeSource(&mX);
+            Canceller      canceller(&mX);
+
+            bsls::AtomicInt numClockCalls(0);
+
+            const bsls::TimeInterval T = timeSource.now() + TICK;
+
+            mX.startClock(bsls::TimeInterval(1),
+                          bdlf::BindUtil::bind(&Canceller::cancelAllClocks,
+                                               &canceller),
+                          T);
+            mX.startClock(bsls::TimeInterval(1),
+                          bdlf::BindUtil::bind(&increment, &numClockCalls),
+                          T);
+            ASSERT(0 == mX.start());
+
+            timeSource.advanceTime(bsls::TimeInterval(5));
+            ASSERT(synchronize(&mX));
+
+            // The second clock may be dispatched (once) before the first one.
+
+            ASSERTV(canceller.d_count, 1 == canceller.d_count);
+            ASSERTV(numClockCalls, numClockCalls <= 1);
+            ASSERT(0 == mX.numClocks());
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CLOCKS
+        //
+        // Concerns:
+        //: 1 A clock is dispatched once per interval, starting at its start
+        //:   time (or one interval from now by default), and the times of its
+        //:   occurrences do not drift when dispatched late.
+        //:
+        //: 2 When time advances by several intervals at once, each missed
+        //:   occurrence is dispatched.
+        //:
+        //: 3 'cancelClock' returns 0 for a clock, and 1 for an invalid handle
+        //:   or the handle of an event, and no occurrence of a cancelled clock
+        //:   is dispatched afterwards, including when cancelled from its own
+        //:   callback.
+        //
+        // Plan:
+        //: 1 Using a test time source, start clocks having intervals that are
+        //:   and are not multiples of the tick, advance time by various
+        //:   amounts, and verify the number and the times of the occurrences.
+        //:   (C-1..2)
+        //:
+        //: 2 Start a clock whose callback cancels it, and verify that it is
+        //:   dispatched once.  (C-3)
+        //
+        // Testing:
+        //   Handle startClock(const TimeInterval&, const function&, ...);
+        //   int cancelClock(Handle handle, bool wait = false);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLOCKS" << endl
+                          << "======" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const Int64              TICK_NS = 1000000;
+        const bsls::TimeInterval TICK(0, static_cast<int>(TICK_NS));
+
+        if (verbose) cout << "\tOccurrence times." << endl;
+        {
+            static const struct {
+                int d_line;
+                int d_intervalUs;      // clock interval
+                int d_stepUs;          // amount by which time advances
+                int d_numSteps;        // number of advances
+            } DATA[] = {
+                //LINE  INTERVAL   STEP  STEPS
+                //----  --------  -----  -----
+                { L_,      10000,  1000,   100 },
+                { L_,      10000,  5000,    40 },
+                { L_,      10000, 50000,     4 },
+                { L_,       2500,  1000,    50 },
+                { L_,       2500,   700,    50 },
+                { L_,        300,  1000,    10 },
+                { L_,    1000000, 90000,    40 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE     = DATA[ti].d_line;
+                const int INTERVAL = DATA[ti].d_intervalUs;
+                const int STEP     = DATA[ti].d_stepUs;
+                const int NUM      = DATA[ti].d_numSteps;
+
+                if (veryVerbose) { T_ P_(LINE) P_(INTERVAL) P(STEP) }
+
+                Obj            mX(TICK, &ta);
+                TestTimeSource timeSource(&mX);
+                Recorder       recorder(&mX);
+
+                const bsls::TimeInterval I(0, INTERVAL * 1000);
+                const bsls::TimeInterval T0 = timeSource.now();
+
+                const Obj::Handle H = mX.startClock(
+                                       I,
+                                       bdlf::BindUtil::bind(&Recorder::record,
+                                                            &recorder,
+                                                            0));
+                ASSERTV(LINE, Obj::e_INVALID_HANDLE != H);
+                ASSERTV(LINE, 1 == mX.numClocks());
+
+                ASSERT(0 == mX.start());
+
+                for (int i = 0; i < NUM; ++i) {
+                    timeSource.advanceTime(bsls::TimeInterval(0, STEP * 1000));
+                    ASSERTV(LINE, i, synchronize(&mX));
+                }
+
+                const bsls::TimeInterval NOW = timeSource.now();
+
+                // Occurrence 'k' (from 1) is due at 'T0 + k * I', and is
+                // dispatched once its tick has started and the previous
+                // occurrence has been dispatched, i.e., at most one tick per
+                // occurrence, in the same advance.
+
+                bsl::vector<Recorder::Record> records = recorder.records();
+
+                int expected = 0;
+                while (floorTick(NOW, TICK_NS) >=
+                         ceilTick(T0 + multiply(I, expected + 1), TICK_NS)) {
+                    ++expected;
+                }
+                if (INTERVAL >= TICK_NS / 1000) {
+                    ASSERTV(LINE, expected, records.size(),
+                            expected == static_cast<int>(records.size()));
+                }
+                else {
+                    // Several occurrences are due in each tick, and those
+                    // overdue are dispatched one per batch: only an upper
+                    // bound is known.
+
+                    ASSERTV(LINE, expected, records.size(),
+                            expected >= static_cast<int>(records.size()));
+                    ASSERTV(LINE,
+                            records.size(),
+                            NUM <= static_cast<int>(records.size()));
+                }
+
+                for (int k = 0; k < static_cast<int>(records.size()); ++k) {
+                    const bsls::TimeInterval DUE = T0 + multiply(I, k + 1);
+
+                    ASSERTV(LINE, k, DUE <= records[k].second);
+                    if (INTERVAL >= TICK_NS / 1000) {
+                        ASSERTV(LINE, k,
+                                floorTick(records[k].second, TICK_NS)
+                              < ceilTick(DUE, TICK_NS)
+                              + (STEP * 1000 + TICK_NS - 1) / TICK_NS
+                              + 1);
+                    }
+                }
+
+                ASSERTV(LINE, 0 == mX.cancelClock(H));
+                ASSERTV(LINE, 1 == mX.cancelClock(H));
+                ASSERTV(LINE, 0 == mX.numClocks());
+
+                timeSource.advanceTime(multiply(I, 3));
+                ASSERTV(LINE, synchronize(&mX));
+
+                ASSERTV(LINE, records.size() == recorder.records().size());
+
+                mX.stop();
+            }
+        }
+
+        if (verbose) cout << "\tExplicit start time." << endl;
+        {
+            Obj            mX(TICK, &ta);
+            TestTimeSource timeSource(&mX);
+            Recorder       recorder(&mX);
+
+            const bsls::TimeInterval T0 = timeSource.now();
+            const bsls::TimeInterval S  = T0 + bsls::TimeInterval(0.25);
+
+            mX.startClock(bsls::TimeInterval(0.1),
+                          bdlf::BindUtil::bind(&Recorder::record,
+                                               &recorder,
+                                               1),
+                          S);
+            ASSERT(0 == mX.start());
+
+            timeSource.advanceTime(bsls::TimeInterval(0.2));
+            ASSERT(synchronize(&mX));
+            ASSERT(0 == recorder.records().size());
+
+            timeSource.advanceTime(bsls::TimeInterval(0.1));
+            ASSERT(synchronize(&mX));
+            ASSERT(1 == recorder.records().size());
+
+            timeSource.advanceTime(bsls::TimeInterval(0.1));
+            ASSERT(synchronize(&mX));
+            ASSERT(2 == recorder.records().size());
+
+            mX.stop();
+        }
+
+        if (verbose) cout << "\tInvalid handles." << endl;
+        {
+            Obj            mX(TICK, &ta);
+            TestTimeSource timeSource(&mX);
+
+            bsls::AtomicInt numCalls(0);
+
+            const Obj::Handle HE = mX.scheduleEvent(
+                                   timeSource.now() + TICK,
+                                   bdlf::BindUtil::bind(&increment,
+                                                        &numCalls));
+            const Obj::Handle HC = mX.startClock(
+                                   TICK,
+                                   bdlf::BindUtil::bind(&increment,
+                                                        &numCalls));
+
+            ASSERT(1 == mX.cancelClock(HE));
+            ASSERT(1 == mX.cancelClock(Obj::e_INVALID_HANDLE));
+            ASSERT(1 == mX.cancelClock(HC + 1));
+            ASSERT(1 == mX.cancelEvent(HC));
+            ASSERT(1 == mX.rescheduleEvent(HC, timeSource.now()));
+
+            ASSERT(0 == mX.cancelClock(HC));
+            ASSERT(0 == mX.cancelEvent(HE));
+        }
+
+        if (verbose) cout << "\tCancel a clock from its callback." << endl;
+        {
+            Obj            mX(TICK, &ta);
+            TestTimeSource timeSource(&mX);
+            Canceller      canceller(&mX);
+
+            canceller.d_handle = mX.startClock(
+                                  TICK,
+                                  bdlf::BindUtil::bind(&Canceller::cancelClock,
+                                                       &canceller));
+            ASSERT(0 == mX.start());
+
+            // The clock is due 10 times, and all of its occurrences are
+            // collected in the same batch.
+
+            timeSource.advanceTime(multiply(TICK, 10));
+            ASSERT(synchronize(&mX));
+
+            ASSERTV(canceller.d_count, 1 == canceller.d_count);
+            ASSERTV(canceller.d_rc, 0 == canceller.d_rc);
+            ASSERT(0 == mX.numClocks());
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // DISPATCH TIMES ACROSS WHEELS
+        //
+        // Concerns:
+        //: 1 An event is never dispatched before its time, and is dispatched
+        //:   once the tick following its time has started, whether it is kept
+        //:   in the first wheel, in any of the other wheels, or beyond the
+        //:   last wheel.
+        //:
+        //: 2 Events are dispatched in increasing order of their ticks.
+        //:
+        //: 3 Events in the past are dispatched as soon as possible.
+        //:
+        //: 4 Time may advance by arbitrary amounts, including skipping over
+        //:   several revolutions of all wheels.
+        //:
+        //: 5 The above holds for various tick intervals.
+        //
+        // Plan:
+        //: 1 For a set of tick intervals, and using a test time source,
+        //:   schedule events at offsets (from now) of up to 2**40 ticks, each
+        //:   offset being placed shortly before, at, or after the boundaries
+        //:   of the periods of the wheels.  Then, repeatedly advance time to
+        //:   two ticks before the time of the next pending event, then by half
+        //:   ticks until it is dispatched, each time waiting for the expected
+        //:   number of events to be dispatched.  Verify that each event is
+        //:   dispatched at the expected time, in order.  (C-1..5)
+        //
+        // Testing:
+        //   TimerWheelScheduler(const TimeInterval&, Allocator *ba = 0);
+        //   bsls::TimeInterval advanceTime(bsls::TimeInterval amount);
+        //   DISPATCH TIMES ACROSS WHEELS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DISPATCH TIMES ACROSS WHEELS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        static const Int64 TICKS_NS[] = {
+            1000000, 1, 777, 1000000000, 86400LL * 1000000000
+        };
+        const int NUM_TICKS = static_cast<int>(sizeof TICKS_NS
+                                               / sizeof *TICKS_NS);
+
+        for (int ti = 0; ti < NUM_TICKS; ++ti) {
+            const Int64              TICK_NS = TICKS_NS[ti];
+            bsls::TimeInterval       tick;
+            tick.setTotalNanoseconds(TICK_NS);
+            const bsls::TimeInterval TICK = tick;
+
+            if (verbose) { T_ P(TICK) }
+
+            Obj            mX(TICK, &ta);
+            const Obj&     X = mX;
+            TestTimeSource timeSource(&mX);
+            Recorder       recorder(&mX);
+
+            ASSERT(TICK == X.tickInterval());
+
+            const bsls::TimeInterval T0 = timeSource.now();
+
+            // Offsets, in ticks, around the period of each wheel, and well
+            // beyond the last wheel.
+
+            bsl::vector<Int64> offsets;
+            offsets.push_back(-5);
+            offsets.push_back(0);
+            for (int level = 0; level <= 6; ++level) {
+                const Int64 period = static_cast<Int64>(1) << (6 * level);
+                offsets.push_back(period - 1);
+                offsets.push_back(period);
+                offsets.push_back(period + 1);
+                offsets.push_back(3 * period + 7);
+            }
+            offsets.push_back(static_cast<Int64>(1) << 40);
+
+            // Events too far in the future for their time to be represented
+            // in nanoseconds are skipped.
+
+            const Int64 maxOffset = (static_cast<Int64>(1) << 61) / TICK_NS;
+
+            bsl::vector<bsls::TimeInterval> times;
+            for (int i = 0; i < static_cast<int>(offsets.size()); ++i) {
+                if (offsets[i] > maxOffset) {
+                    continue;                                       // CONTINUE
+                }
+
+                // Schedule one event exactly at the start of a tick, and one
+                // inside the tick (if the tick is longer than 1ns).
+
+                bsls::TimeInterval t;
+                t.setTotalNanoseconds(
+                          (floorTick(T0, TICK_NS) + offsets[i]) * TICK_NS);
+                times.push_back(t);
+                if (1 < TICK_NS) {
+                    t.addNanoseconds(TICK_NS / 2);
+                    times.push_back(t);
+                }
+            }
+
+            for (int i = 0; i < static_cast<int>(times.size()); ++i) {
+                const Obj::Handle H = mX.scheduleEvent(
+                                       times[i],
+                                       bdlf::BindUtil::bind(&Recorder::record,
+                                                            &recorder,
+                                                            i));
+                ASSERTV(i, Obj::e_INVALID_HANDLE != H);
+            }
+            ASSERT(static_cast<int>(times.size()) == X.numEvents());
+
+            ASSERT(0 == mX.start());
+
+            bsl::vector<Int64> ticks;
+            for (int i = 0; i < static_cast<int>(times.size()); ++i) {
+                ticks.push_back(ceilTick(times[i], TICK_NS));
+            }
+            bsl::vector<Int64> sortedTicks(ticks);
+            bsl::sort(sortedTicks.begin(), sortedTicks.end());
+
+            // The events due by the tick containing the start time are
+            // dispatched immediately.
+
+            const int NUM_EVENTS = static_cast<int>(times.size());
+            int       numDispatched = static_cast<int>(
+                              bsl::upper_bound(sortedTicks.begin(),
+                                               sortedTicks.end(),
+                                               floorTick(T0, TICK_NS))
+                            - sortedTicks.begin());
+
+            ASSERTV(TICK, numDispatched,
+                    waitForNumEvents(X, NUM_EVENTS - numDispatched));
+
+            while (numDispatched < NUM_EVENTS) {
+                const Int64 nowTick  = floorTick(timeSource.now(), TICK_NS);
+                const Int64 nextTick = sortedTicks[numDispatched];
+
+                if (nextTick - 2 > nowTick) {
+                    bsls::TimeInterval target;
+                    target.setTotalNanoseconds((nextTick - 2) * TICK_NS);
+                    timeSource.advanceTime(target - timeSource.now());
+                }
+                else {
+                    bsls::TimeInterval step;
+                    step.setTotalNanoseconds(bsl::max<Int64>(TICK_NS / 2, 1));
+                    timeSource.advanceTime(step);
+                }
+
+                const Int64 tick = floorTick(timeSource.now(), TICK_NS);
+                numDispatched = static_cast<int>(
+                              bsl::upper_bound(sortedTicks.begin(),
+                                               sortedTicks.end(),
+                                               tick) - sortedTicks.begin());
+
+                ASSERTV(TICK, numDispatched,
+                        waitForNumEvents(X, NUM_EVENTS - numDispatched));
+                if (NUM_EVENTS - numDispatched != X.numEvents()) {
+                    break;
+                }
+            }
+
+            mX.stop();
+
+            bsl::vector<Recorder::Record> records = recorder.records();
+            ASSERTV(TICK, records.size(),
+                    NUM_EVENTS == static_cast<int>(records.size()));
+
+            Int64 previousTick = LLONG_MIN;
+            for (int k = 0; k < static_cast<int>(records.size()); ++k) {
+                const int                ID   = records[k].first;
+                const bsls::TimeInterval TIME = records[k].second;
+                const Int64              EXP  = bsl::max(
+                                                      ticks[ID],
+                                                      floorTick(T0, TICK_NS));
+
+                if (veryVeryVerbose) { T_ T_ P_(ID) P_(times[ID]) P(TIME) }
+
+                ASSERTV(TICK, ID, times[ID], TIME, times[ID] <= TIME);
+                ASSERTV(TICK, ID, times[ID], TIME,
+                        floorTick(TIME, TICK_NS) <= EXP);
+                ASSERTV(TICK, k, previousTick <= EXP);
+
+                previousTick = EXP;
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SCHEDULING, RESCHEDULING, AND CANCELLING EVENTS
+        //
+        // Concerns:
+        //: 1 'scheduleEvent' returns a valid handle, and increments
+        //:   'numEvents'.
+        //:
+        //: 2 'cancelEvent' returns 0 and decrements 'numEvents' exactly when
+        //:   the event is scheduled, and returns 1 for an invalid handle, for
+        //:   an event that was dispatched or cancelled, or for the handle of
+        //:   a clock.
+        //:
+        //: 3 The handle of a cancelled or dispatched event is not valid even
+        //:   after its storage is reused for another event.
+        //:
+        //: 4 'rescheduleEvent' moves a scheduled event, and fails for an
+        //:   invalid handle.
+        //:
+        //: 5 'now' returns the time of the test time source.
+        //:
+        //: 6 All memory is supplied by the object allocator, and storage for
+        //:   cancelled events is reused.
+        //
+        // Plan:
+        //: 1 Using a test time source, schedule and cancel events, checking
+        //:   the returned values and 'numEvents'.  (C-1..3)
+        //:
+        //: 2 Reschedule events, advance time, and verify the dispatched
+        //:   events.  (C-4..5)
+        //:
+        //: 3 Schedule and cancel many events, and verify that the memory in
+        //:   use does not grow.  (C-6)
+        //
+        // Testing:
+        //   Handle scheduleEvent(const TimeInterval&, const function&);
+        //   int rescheduleEvent(Handle, const TimeInterval&, bool = false);
+        //   int cancelEvent(Handle handle, bool wait = false);
+        //   bsls::TimeInterval now() const;
+        //   int numClocks() const;
+        //   int numEvents() const;
+        //   TimerWheelSchedulerTestTimeSource(TimerWheelScheduler *scheduler);
+        //   bsls::TimeInterval now() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SCHEDULING, RESCHEDULING, AND CANCELLING EVENTS"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj            mX(&ta);
+            const Obj&     X = mX;
+            TestTimeSource timeSource(&mX);
+            Recorder       recorder(&mX);
+
+            ASSERT(timeSource.now() == X.now());
+
+            const bsls::TimeInterval T0 = timeSource.now();
+            const bsls::TimeInterval S(1);
+
+            ASSERT(0 == X.numEvents());
+            ASSERT(0 == X.numClocks());
+
+            const Obj::Handle H1 = mX.scheduleEvent(
+                                       T0 + S,
+                                       bdlf::BindUtil::bind(&Recorder::record,
+                                                            &recorder,
+                                                            1));
+            const Obj::Handle H2 = mX.scheduleEvent(
+                                       T0 + multiply(S, 2),
+                                       bdlf::BindUtil::bind(&Recorder::record,
+                                                            &recorder,
+                                                            2));
+            const Obj::Handle H3 = mX.scheduleEvent(
+                                       T0 + multiply(S, 3),
+                                       bdlf::BindUtil::bind(&Recorder::record,
+                                                            &recorder,
+                                                            3));
+
+            ASSERT(Obj::e_INVALID_HANDLE != H1);
+            ASSERT(Obj::e_INVALID_HANDLE != H2);
+            ASSERT(Obj::e_INVALID_HANDLE != H3);
+            ASSERT(H1 != H2);
+            ASSERT(H2 != H3);
+            ASSERT(H1 != H3);
+
+            ASSERT(3 == X.numEvents());
+            ASSERT(0 == X.numClocks());
+
+            ASSERT(1 == mX.cancelEvent(Obj::e_INVALID_HANDLE));
+            ASSERT(1 == mX.cancelEvent(12345));
+            ASSERT(1 == mX.cancelEvent(-12345));
+            ASSERT(3 == X.numEvents());
+
+            ASSERT(0 == mX.cancelEvent(H2));
+            ASSERT(2 == X.numEvents());
+            ASSERT(1 == mX.cancelEvent(H2));
+            ASSERT(2 == X.numEvents());
+
+            // The storage of the second event is reused, but its handle
+            // remains invalid.
+
+            const Obj::Handle H4 = mX.scheduleEvent(
+                                       T0 + multiply(S, 4),
+                                       bdlf::BindUtil::bind(&Recorder::record,
+                                                            &recorder,
+                                                            4));
+            ASSERT(H4 != H2);
+            ASSERT(3  == X.numEvents());
+            ASSERT(1  == mX.cancelEvent(H2));
+            ASSERT(1  == mX.rescheduleEvent(H2, T0));
+            ASSERT(3  == X.numEvents());
+
+            // Reschedule the third event before the first one.
+
+            ASSERT(0 == mX.rescheduleEvent(H3, T0 + bsls::TimeInterval(0.5)));
+            ASSERT(1 == mX.rescheduleEvent(Obj::e_INVALID_HANDLE, T0));
+
+            ASSERT(0 == mX.start());
+
+            // Events are dispatched once the tick following their time has
+            // started.
+
+            const bsls::TimeInterval T1 =
+                        timeSource.advanceTime(S + bsls::TimeInterval(0.001));
+            ASSERT(waitForNumEvents(X, 1));
+
+            bsl::vector<Recorder::Record> records = recorder.records();
+            ASSERTV(records.size(), 2 == records.size());
+            if (2 == records.size()) {
+                ASSERT(3 == records[0].first);
+                ASSERT(1 == records[1].first);
+                ASSERT(T1 == records[0].second);
+            }
+
+            ASSERT(1 == mX.cancelEvent(H1));
+            ASSERT(1 == mX.cancelEvent(H3));
+            ASSERT(1 == mX.rescheduleEvent(H1, T0 + multiply(S, 10)));
+
+            // Reschedule the fourth event in the past.
+
+            ASSERT(0 == mX.rescheduleEvent(H4, T0, true));
+            ASSERT(waitForNumEvents(X, 0));
+            ASSERT(3 == recorder.records().size());
+            ASSERT(1 == mX.cancelEvent(H4, true));
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tReuse of storage." << endl;
+        {
+            Obj            mX(&ta);
+            const Obj&     X = mX;
+            TestTimeSource timeSource(&mX);
+
+            bsls::AtomicInt numCalls(0);
+
+            bsl::vector<Obj::Handle> handles;
+            for (int i = 0; i < 1000; ++i) {
+                handles.push_back(mX.scheduleEvent(
+                              timeSource.now() + bsls::TimeInterval(0, i),
+                              bdlf::BindUtil::bind(&increment, &numCalls)));
+            }
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, 0 == mX.cancelEvent(handles[i]));
+            }
+            ASSERT(0 == X.numEvents());
+
+            const Int64 numBlocks = ta.numBlocksTotal();
+
+            for (int j = 0; j < 100; ++j) {
+                for (int i = 0; i < 1000; ++i) {
+                    handles[i] = mX.scheduleEvent(
+                              timeSource.now() + bsls::TimeInterval(j, i),
+                              bdlf::BindUtil::bind(&increment, &numCalls));
+                    ASSERTV(i, Obj::e_INVALID_HANDLE != handles[i]);
+                }
+                for (int i = 0; i < 1000; ++i) {
+                    ASSERTV(j, i, 0 == mX.cancelEvent(handles[i]));
+                    ASSERTV(j, i, 1 == mX.cancelEvent(handles[i]));
+                }
+            }
+            ASSERT(0 == X.numEvents());
+            ASSERT(0 == numCalls);
+            ASSERTV(numBlocks, ta.numBlocksTotal(),
+                    numBlocks == ta.numBlocksTotal());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Using the real clock, schedule an event and a clock, and verify
+        //:   that they are dispatched.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   TimerWheelScheduler(Allocator *ba = 0);
+        //   ~TimerWheelScheduler();
+        //   int start();
+        //   void stop();
+        //   bsls::SystemClockType::Enum clockType() const;
+        //   bsls::TimeInterval tickInterval() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj        mX(&ta);
+            const Obj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(bsls::SystemClockType::e_REALTIME == X.clockType());
+            ASSERT(bsls::TimeInterval(0, 1000000) == X.tickInterval());
+
+            bsls::AtomicInt numEventCalls(0);
+            bsls::AtomicInt numClockCalls(0);
+
+            const bsls::TimeInterval T0 = bsls::SystemTime::nowRealtimeClock();
+
+            mX.scheduleEvent(T0 + bsls::TimeInterval(0.05),
+                             bdlf::BindUtil::bind(&increment,
+                                                  &numEventCalls));
+            const Obj::Handle HC = mX.startClock(
+                                 bsls::TimeInterval(0.02),
+                                 bdlf::BindUtil::bind(&increment,
+                                                      &numClockCalls));
+
+            ASSERT(1 == X.numEvents());
+            ASSERT(1 == X.numClocks());
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.start());
+
+            ASSERT(waitForNumEvents(X, 0));
+            ASSERT(1 == numEventCalls);
+            ASSERT(T0 + bsls::TimeInterval(0.05) <=
+                                        bsls::SystemTime::nowRealtimeClock());
+
+            ASSERT(waitForCount(numClockCalls, 3));
+
+            ASSERT(0 == mX.cancelClock(HC, true));
+            const int numCalls = numClockCalls;
+
+            bslmt::ThreadUtil::microSleep(50000);
+            ASSERT(numCalls == numClockCalls);
+
+            mX.stop();
+            mX.stop();
+
+            // Restart and schedule an event in the past.
+
+            ASSERT(0 == mX.start());
+            mX.scheduleEvent(T0,
+                             bdlf::BindUtil::bind(&increment,
+                                                  &numEventCalls));
+            ASSERT(waitForNumEvents(X, 0));
+            ASSERT(2 == numEventCalls);
+
+            // Destroy while running.
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: SCHEDULE/CANCEL AND DISPATCH THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Scheduling and cancelling events costs constant time, whatever
+        //:   the number of scheduled events.
+        //:
+        //: 2 Dispatching many events is cheaper than with the other
+        //:   schedulers.
+        //
+        // Plan:
+        //: 1 With 'N' (1,000,000 by default, or the second argument) events
+        //:   scheduled at random times in the next 60 seconds, measure the
+        //:   time taken to schedule and then cancel 'N' more events, for
+        //:   'bdlmt::TimerWheelScheduler', 'bdlmt::EventScheduler', and
+        //:   'bdlmt::TimerEventScheduler'.
+        //:
+        //: 2 Measure the time taken by each scheduler to dispatch 'N' events
+        //:   scheduled in the past.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: SCHEDULE/CANCEL AND DISPATCH THROUGHPUT
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST: SCHEDULE/CANCEL AND DISPATCH THROUGHPUT"
+             << endl
+             << "========================================================="
+             << endl;
+
+        const int N = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bslma::Allocator *alloc = bslma::Default::globalAllocator();
+        bslma::DefaultAllocatorGuard guard(alloc);
+
+        bsls::AtomicInt numCalls(0);
+
+        const bsl::function<void()> callback =
+                                  bdlf::BindUtil::bind(&increment, &numCalls);
+
+        bsl::vector<bsls::TimeInterval> offsets(N);
+        unsigned int state = 1;
+        for (int i = 0; i < N; ++i) {
+            state = state * 1103515245 + 12345;
+            offsets[i] = bsls::TimeInterval(10 + (state >> 8) % 50,
+                                            (state >> 4) % 1000000000);
+        }
+
+        bsls::Stopwatch timer;
+
+        cout << "Schedule and cancel " << N << " events, with " << N
+             << " other events scheduled:" << endl;
+        {
+            Obj                      mX(alloc);
+            bsl::vector<Obj::Handle> handles(N);
+            const bsls::TimeInterval T0 = mX.now();
+
+            for (int i = 0; i < N; ++i) {
+                mX.scheduleEvent(T0 + offsets[N - 1 - i], callback);
+            }
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < N; ++i) {
+                handles[i] = mX.scheduleEvent(T0 + offsets[i], callback);
+            }
+            for (int i = 0; i < N; ++i) {
+                mX.cancelEvent(handles[i]);
+            }
+            timer.stop();
+            cout << "\tTimerWheelScheduler: " << timer.accumulatedWallTime()
+                 << "s" << endl;
+        }
+        {
+            bdlmt::EventScheduler                           mX(alloc);
+            bsl::vector<bdlmt::EventScheduler::EventHandle> handles(N);
+            const bsls::TimeInterval T0 = mX.now();
+
+            for (int i = 0; i < N; ++i) {
+                mX.scheduleEvent(T0 + offsets[N - 1 - i], callback);
+            }
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < N; ++i) {
+                mX.scheduleEvent(&handles[i], T0 + offsets[i], callback);
+            }
+            for (int i = 0; i < N; ++i) {
+                mX.cancelEvent(&handles[i]);
+            }
+            timer.stop();
+            cout << "\tEventScheduler:      " << timer.accumulatedWallTime()
+                 << "s" << endl;
+        }
+        {
+            // 'bdlmt::TimerEventScheduler' supports at most 2**24 - 1 events.
+
+            const int M = bsl::min(N, (1 << 23) - 1);
+
+            bdlmt::TimerEventScheduler mX(2 * M, 0, alloc);
+            bsl::vector<bdlmt::TimerEventScheduler::Handle> handles(M);
+            const bsls::TimeInterval T0 = mX.now();
+
+            for (int i = 0; i < M; ++i) {
+                mX.scheduleEvent(T0 + offsets[M - 1 - i], callback);
+            }
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < M; ++i) {
+                handles[i] = mX.scheduleEvent(T0 + offsets[i], callback);
+            }
+            for (int i = 0; i < M; ++i) {
+                mX.cancelEvent(handles[i]);
+            }
+            timer.stop();
+            cout << "\tTimerEventScheduler: " << timer.accumulatedWallTime()
+                 << "s" << endl;
+        }
+
+        cout << "Dispatch " << N << " events due in the same second:"
+             << endl;
+        {
+            numCalls = 0;
+
+            Obj mX(alloc);
+            const bsls::TimeInterval T0 = mX.now() - bsls::TimeInterval(1);
+
+            for (int i = 0; i < N; ++i) {
+                const bsls::TimeInterval OFFSET(0, offsets[i].nanoseconds());
+
+                mX.scheduleEvent(T0 + OFFSET, callback);
+            }
+
+            timer.reset();
+            timer.start();
+            mX.start();
+            waitForCount(numCalls, N);
+            timer.stop();
+            mX.stop();
+            cout << "\tTimerWheelScheduler: " << timer.accumulatedWallTime()
+                 << "s" << endl;
+        }
+        {
+            numCalls = 0;
+
+            bdlmt::EventScheduler mX(alloc);
+            const bsls::TimeInterval T0 = mX.now() - bsls::TimeInterval(1);
+
+            for (int i = 0; i < N; ++i) {
+                const bsls::TimeInterval OFFSET(0, offsets[i].nanoseconds());
+
+                mX.scheduleEvent(T0 + OFFSET, callback);
+            }
+
+            timer.reset();
+            timer.start();
+            mX.start();
+            waitForCount(numCalls, N);
+            timer.stop();
+            mX.stop();
+            cout << "\tEventScheduler:      " << timer.accumulatedWallTime()
+                 << "s" << endl;
+        }
+        {
+            numCalls = 0;
+
+            const int M = bsl::min(N, (1 << 23) - 1);
+
+            bdlmt::TimerEventScheduler mX(M, 0, alloc);
+            const bsls::TimeInterval T0 = mX.now() - bsls::TimeInterval(1);
+
+            for (int i = 0; i < M; ++i) {
+                const bsls::TimeInterval OFFSET(0, offsets[i].nanoseconds());
+
+                mX.scheduleEvent(T0 + OFFSET, callback);
+            }
+
+            timer.reset();
+            timer.start();
+            mX.start();
+            waitForCount(numCalls, M);
+            timer.stop();
+            mX.stop();
+            cout << "\tTimerEventScheduler: " << timer.accumulatedWallTime()
+                 << "s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,649 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_performancehint.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_functional.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The worker thread life cycle (the "gate" through which worker threads pass
+// on each change of the control state, and the 'e_RUN', 'e_DRAIN', and
+// 'e_STOP' states themselves) is that of 'bdlmt::FixedThreadPool'; only the
+// way in which a worker thread finds its next job differs.
+//
+// A worker thread that finds no job increments 'd_numThreadsWaiting' and then
+// checks the shared queue and every deque again before blocking on
+// 'd_queueSemaphore'; a submitting thread publishes its job and then checks
+// 'd_numThreadsWaiting', posting the semaphore if it is non-zero.  Since both
+// sequences consist of sequentially consistent operations, either the worker
+// observes the job or the submitter observes the waiting worker, so a job
+// cannot be left pending while every worker thread is blocked.
+//
+// During 'drain', each worker thread keeps executing jobs until its own deque,
+// the shared queue, and all other deques are observed to be empty.  A job
+// submitted by a job running in the pool is pushed onto the deque of the
+// thread running it, so that thread finds it before passing through the gate.
+// Therefore, when all worker threads have reached the gate, every job
+// submitted from within the pool has completed.
+
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void initBlockSet(sigset_t *blockSet)
+{
+    sigfillset(blockSet);
+
+    const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+     #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+      SIGIOT
+     #endif
+    };
+
+    const int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i=0; i < SIZE; ++i) {
+        sigdelset(blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+inline
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified xorshift 'state' and return its new value.
+{
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                    // ----------------------------------
+                    // class WorkStealingThreadPool_Deque
+                    // ----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Deque::WorkStealingThreadPool_Deque(
+                                            int               capacity,
+                                            bslma::Allocator *basicAllocator)
+: d_top(0)
+, d_topPad()
+, d_bottom(0)
+, d_bottomPad()
+, d_buffer_p(0)
+, d_mask(capacity - 1)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    d_buffer_p = static_cast<bsls::AtomicPointer<Job> *>(
+              d_allocator_p->allocate(capacity * sizeof *d_buffer_p));
+
+    for (int i = 0; i < capacity; ++i) {
+        new (&d_buffer_p[i]) bsls::AtomicPointer<Job>();
+    }
+}
+
+WorkStealingThreadPool_Deque::~WorkStealingThreadPool_Deque()
+{
+    BSLS_ASSERT(isEmpty());
+
+    d_allocator_p->deallocate(d_buffer_p);
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+void WorkStealingThreadPool::construct()
+{
+    d_deques_p = static_cast<Deque *>(
+                      d_allocator_p->allocate(d_numThreads * sizeof(Deque)));
+
+    int i = 0;
+    BSLS_TRY {
+        for (; i < d_numThreads; ++i) {
+            bslma::ConstructionUtil::construct(
+                                           &d_deques_p[i],
+                                           d_allocator_p,
+                                           static_cast<int>(k_DEQUE_CAPACITY));
+        }
+    }
+    BSLS_CATCH(...) {
+        while (i > 0) {
+            bslma::DestructionUtil::destroy(&d_deques_p[--i]);
+        }
+        d_allocator_p->deallocate(d_deques_p);
+        BSLS_RETHROW;
+    }
+
+    int rc = bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+
+    disable();
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+}
+
+int WorkStealingThreadPool::currentWorkerIndex()
+{
+    // The key value is one more than the index so that the value for threads
+    // other than this pool's worker threads (0) yields -1.
+
+    return static_cast<int>(reinterpret_cast<bsl::intptr_t>(
+                             bslmt::ThreadUtil::getSpecific(d_workerKey))) - 1;
+}
+
+void WorkStealingThreadPool::deleteJob(Job *job)
+{
+    d_jobPool.deleteObject(job);
+}
+
+int WorkStealingThreadPool::enqueueJobImp(Job *job, bool blockFlag)
+{
+    BSLS_ASSERT(job);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_queue.isEnabled())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        deleteJob(job);
+        return -1;                                                    // RETURN
+    }
+
+    const int index = currentWorkerIndex();
+
+    int rc = 0 <= index ? d_deques_p[index].pushBack(job) : -1;
+
+    if (0 != rc) {
+        rc = blockFlag ? d_queue.pushBack(job) : d_queue.tryPushBack(job);
+    }
+
+    if (0 != rc) {
+        deleteJob(job);
+        return rc;                                                    // RETURN
+    }
+
+    if (d_numThreadsWaiting) {
+        // Wake up a waiting thread.
+
+        d_queueSemaphore.post();
+    }
+
+    return 0;
+}
+
+void WorkStealingThreadPool::interruptWorkerThreads()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_gateMutex); // acquire barrier
+
+    int numThreadsWaiting = d_numThreadsWaiting;
+
+    for (int i = 0; i < numThreadsWaiting; ++i) {
+        // Wake up waiting threads.
+
+        d_queueSemaphore.post();
+    }
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::nextJob(
+                                                   int           index,
+                                                   unsigned int *randomState)
+{
+    Job *job = d_deques_p[index].popBack();
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(job)) {
+        return job;                                                   // RETURN
+    }
+
+    if (0 == d_queue.tryPopFront(&job)) {
+        return job;                                                   // RETURN
+    }
+
+    if (1 == d_numThreads) {
+        return 0;                                                     // RETURN
+    }
+
+    // Visit every other deque once, starting from a random victim.
+
+    const int start = static_cast<int>(
+                         nextRandom(randomState) % (d_numThreads - 1));
+
+    for (int i = 0; i < d_numThreads - 1; ++i) {
+        int victim = (start + i) % (d_numThreads - 1);
+        if (victim >= index) {
+            ++victim;
+        }
+
+        job = d_deques_p[victim].steal();
+        if (job) {
+            return job;                                               // RETURN
+        }
+    }
+
+    return 0;
+}
+
+void WorkStealingThreadPool::processJobs(int index, unsigned int *randomState)
+{
+    while (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                        e_RUN == d_control.loadRelaxed())) {
+        Job *job = nextJob(index, randomState);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == job)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            ++d_numThreadsWaiting;
+
+            if (e_RUN == d_control && !hasPendingJobs()) {
+                d_queueSemaphore.wait();
+            }
+
+            d_numThreadsWaiting.addRelaxed(-1);
+        }
+        else {
+            (*job)();
+            deleteJob(job);
+        }
+    }
+}
+
+void WorkStealingThreadPool::drainJobs(int index, unsigned int *randomState)
+{
+    while (e_DRAIN == d_control.loadRelaxed()) {
+        Job *job = nextJob(index, randomState);
+
+        if (0 == job) {
+            return;                                                   // RETURN
+        }
+
+        (*job)();
+        deleteJob(job);
+    }
+}
+
+void WorkStealingThreadPool::releaseWorkerThreads()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_gateMutex);
+    d_numThreadsReady = 0;
+    ++d_gateCount;
+    d_gateCond.broadcast();
+
+    // d_gateMutex.unlock() emits a release barrier.
+}
+
+void WorkStealingThreadPool::removeAllJobs()
+{
+    Job *job;
+
+    while (0 == d_queue.tryPopFront(&job)) {
+        deleteJob(job);
+    }
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        while (0 != (job = d_deques_p[i].steal())) {
+            deleteJob(job);
+        }
+    }
+}
+
+int WorkStealingThreadPool::startNewThread(int index)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    bsl::function<void()> workerThreadFunc = bdlf::BindUtil::bind(
+                                        &WorkStealingThreadPool::workerThread,
+                                        this,
+                                        index);
+
+    int rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    return rc;
+}
+
+void WorkStealingThreadPool::waitWorkerThreads()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_gateMutex);
+
+    while (d_numThreadsReady != d_numThreads) {
+        d_threadsReadyCond.wait(&d_gateMutex);
+    }
+}
+
+void WorkStealingThreadPool::workerThread(int index)
+{
+    bslmt::ThreadUtil::setSpecific(
+                     d_workerKey,
+                     reinterpret_cast<void *>(static_cast<bsl::intptr_t>(index)
+                                              + 1));
+
+    unsigned int randomState = static_cast<unsigned int>(index) * 2654435761U
+                             + 1;
+
+    int gateCount = d_gateCount;
+
+    while (1) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_gateMutex);
+
+            ++d_numThreadsReady;
+            d_threadsReadyCond.signal();
+
+            while (gateCount == d_gateCount) {
+                d_gateCond.wait(&d_gateMutex);
+            }
+
+            gateCount = d_gateCount;
+        }
+
+        int control = d_control.loadRelaxed();
+
+        if (e_RUN == control) {
+            processJobs(index, &randomState);
+            control = d_control;
+        }
+
+        if (e_DRAIN == control) {
+            drainJobs(index, &randomState);
+        }
+        else if (e_SUSPEND == control) {
+            continue;
+        }
+        else {
+            BSLS_ASSERT(e_STOP == control);
+            return;                                                   // RETURN
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+bool WorkStealingThreadPool::hasPendingJobs() const
+{
+    if (!d_queue.isEmpty()) {
+        return true;                                                  // RETURN
+    }
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        if (!d_deques_p[i].isEmpty()) {
+            return true;                                              // RETURN
+        }
+    }
+
+    return false;
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             int                             maxNumPendingJobs,
+                             bslma::Allocator               *basicAllocator)
+: d_queue(maxNumPendingJobs, basicAllocator)
+, d_deques_p(0)
+, d_jobPool(sizeof(Job), basicAllocator)
+, d_control(e_STOP)
+, d_gateCount(0)
+, d_numThreadsReady(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1          <= numThreads);
+    BSLS_ASSERT_OPT(1          <= maxNumPendingJobs);
+    BSLS_ASSERT_OPT(0x01FFFFFF >= maxNumPendingJobs);
+
+    construct();
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                           int               numThreads,
+                                           int               maxNumPendingJobs,
+                                           bslma::Allocator *basicAllocator)
+: d_queue(maxNumPendingJobs, basicAllocator)
+, d_deques_p(0)
+, d_jobPool(sizeof(Job), basicAllocator)
+, d_control(e_STOP)
+, d_gateCount(0)
+, d_numThreadsReady(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1          <= numThreads);
+    BSLS_ASSERT_OPT(1          <= maxNumPendingJobs);
+    BSLS_ASSERT_OPT(0x01FFFFFF >= maxNumPendingJobs);
+
+    construct();
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    // Jobs may have been enqueued while the pool was never started.
+
+    removeAllJobs();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        bslma::DestructionUtil::destroy(&d_deques_p[i]);
+    }
+    d_allocator_p->deallocate(d_deques_p);
+
+    bslmt::ThreadUtil::deleteKey(d_workerKey);
+}
+
+// MANIPULATORS
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    BSLS_ASSERT(functor);
+
+    Job *job = new (d_jobPool) Job(bsl::allocator_arg_t(),
+                                   bsl::allocator<Job>(d_allocator_p),
+                                   functor);
+
+    return enqueueJobImp(job, true);
+}
+
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
+
+    Job *job = new (d_jobPool) Job(bsl::allocator_arg_t(),
+                                   bsl::allocator<Job>(d_allocator_p),
+                                   bslmf::MovableRefUtil::move(functor));
+
+    return enqueueJobImp(job, true);
+}
+
+int WorkStealingThreadPool::tryEnqueueJob(const Job& functor)
+{
+    BSLS_ASSERT(functor);
+
+    Job *job = new (d_jobPool) Job(bsl::allocator_arg_t(),
+                                   bsl::allocator<Job>(d_allocator_p),
+                                   functor);
+
+    return enqueueJobImp(job, false);
+}
+
+int WorkStealingThreadPool::tryEnqueueJob(bslmf::MovableRef<Job> functor)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
+
+    Job *job = new (d_jobPool) Job(bsl::allocator_arg_t(),
+                                   bsl::allocator<Job>(d_allocator_p),
+                                   bslmf::MovableRefUtil::move(functor));
+
+    return enqueueJobImp(job, false);
+}
+
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (e_RUN == d_control.loadRelaxed()) {
+        d_control = e_DRAIN;
+
+        // 'interruptWorkerThreads' emits an initial acquire barrier (mutex
+        // lock).  Guaranteeing that no instructions in
+        // 'interruptWorkerThreads' will be executed before the previous store.
+
+        interruptWorkerThreads();
+        waitWorkerThreads();
+
+        d_control = e_RUN;
+
+        // 'releaseWorkerThreads' emits a release barrier so that the worker
+        // threads can't return from wait without observing the previous store.
+
+        releaseWorkerThreads();
+    }
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (e_RUN == d_control.loadRelaxed()) {
+        d_queue.disable();
+        d_control = e_STOP;
+
+        // 'interruptWorkerThreads' emits an initial acquire barrier (mutex
+        // lock).  Guaranteeing that no instructions in
+        // 'interruptWorkerThreads' will be executed before the previous store.
+
+        interruptWorkerThreads();
+
+        d_threadGroup.joinAll();
+
+        removeAllJobs();
+    }
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (e_STOP != d_control.loadRelaxed()) {
+        return 0;                                                     // RETURN
+    }
+
+    for (int i = d_threadGroup.numThreads(); i < d_numThreads; ++i)  {
+        if (0 != startNewThread(i)) {
+
+            releaseWorkerThreads();
+            d_threadGroup.joinAll();
+            return -1;                                                // RETURN
+        }
+    }
+
+    waitWorkerThreads();
+
+    d_queue.enable();
+    d_control = e_RUN;
+
+    // 'releaseWorkerThreads' emits a release barrier so that the worker
+    // threads can't return from wait without observing the previous store.
+
+    releaseWorkerThreads();
+
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (e_RUN == d_control.loadRelaxed()) {
+        d_queue.disable();
+        d_control = e_DRAIN;
+
+        // 'interruptWorkerThreads' has an initial acquire barrier (mutex
+        // lock).  Guaranteeing that no instructions in
+        // 'interruptWorkerThreads' will be executed before the previous store.
+
+        interruptWorkerThreads();
+
+        waitWorkerThreads();
+
+        d_control = e_STOP;
+
+        // 'releaseWorkerThreads' emits a release barrier so that the worker
+        // threads can't return from wait without observing the previous store.
+
+        releaseWorkerThreads();
+        d_threadGroup.joinAll();
+    }
+}
+
+// ACCESSORS
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    int numJobs = d_queue.length();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        numJobs += d_deques_p[i].length();
+    }
+
+    return numJobs;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,808 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size pool of threads with per-thread job deques.
+//
+//@CLASSES:
+//  bdlmt::WorkStealingThreadPool: fixed-size work-stealing thread pool
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that executes user-defined functions
+// ("jobs") on a fixed number of processing threads, and that is designed for
+// workloads in which jobs themselves submit many further (typically small)
+// jobs.  'bdlmt::WorkStealingThreadPool' provides the same interface, and the
+// same 'start', 'drain', 'stop', and 'shutdown' semantics, as
+// 'bdlmt::FixedThreadPool', so that an existing client of
+// 'bdlmt::FixedThreadPool' can switch to a work-stealing pool by changing a
+// type name (or a 'typedef').
+//
+///Scheduling
+///----------
+// A 'bdlmt::FixedThreadPool' funnels every job through a single shared queue,
+// so that when many small jobs are submitted concurrently, the cost of
+// contention on that queue dominates the cost of the jobs themselves.  A
+// 'bdlmt::WorkStealingThreadPool' instead gives each processing thread its own
+// bounded double-ended queue ("deque") of jobs:
+//
+//: o A job submitted from one of the pool's own processing threads (i.e., by a
+//:   job running in the pool) is pushed onto the back of that thread's deque
+//:   without any locking, and that thread subsequently takes jobs from the
+//:   back of its deque (i.e., in last-in, first-out order, which favors cache
+//:   locality).  If the deque is full, the job is enqueued on the shared
+//:   queue instead.
+//:
+//: o A job submitted from any other thread is enqueued on a shared, bounded,
+//:   queue (having the capacity supplied at construction).
+//:
+//: o A processing thread whose deque is empty takes the next job from the
+//:   shared queue, or, if that is also empty, attempts to "steal" the oldest
+//:   job from the front of the deque of another processing thread, visiting
+//:   the other threads starting at a randomly chosen one.  A processing thread
+//:   that finds no job anywhere blocks until a job is submitted.
+//
+// The deques are implementations of the lock-free work-stealing deque
+// described by Chase and Lev ("Dynamic Circular Work-Stealing Deque", SPAA
+// 2005), in the fixed-capacity form (i.e., without array growth), with the
+// memory-ordering constraints of Le et al. ("Correct and Efficient
+// Work-Stealing for Weak Memory Models", PPoPP 2013).
+//
+// Note that, in contrast to 'bdlmt::FixedThreadPool', jobs are *not*
+// guaranteed to start executing in the order in which they were submitted,
+// even when submitted by a single thread.  Also note that the capacity
+// supplied at construction bounds the number of jobs in the shared queue; up
+// to 'k_DEQUE_CAPACITY' additional jobs may be pending in the deque of each
+// processing thread.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As with 'bdlmt::FixedThreadPool', on unix platforms, all the threads in the
+// pool block all asynchronous signals.  Specifically all the signals, except
+// the following synchronous signals are blocked:
+//..
+// SIGBUS
+// SIGFPE
+// SIGILL
+// SIGSEGV
+// SIGSYS
+// SIGABRT
+// SIGTRAP
+// SIGIOT
+//..
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Fanning Out Recursively Subdivided Work
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we sum the elements of a large array by recursively
+// splitting the array in half, submitting one job for each half, until the
+// pieces are small enough to be summed directly.  All but the first job are
+// submitted by jobs running in the pool, and so are pushed onto the deque of
+// the submitting thread, from which idle threads steal them.
+//
+// First, we define a structure describing the shared state of the
+// computation, and a function that processes one range of the array:
+//..
+//  struct SumContext {
+//      // This 'struct' holds the state shared by all jobs of a summation.
+//
+//      bdlmt::WorkStealingThreadPool *d_pool_p;   // pool running the jobs
+//      const int                     *d_data_p;   // data being summed
+//      bsls::AtomicInt64              d_sum;      // running total
+//  };
+//
+//  void sumRange(SumContext *context, int begin, int end)
+//      // Add to the total in the specified 'context' the sum of the elements
+//      // of the array in 'context' in the range defined by the specified
+//      // 'begin' and 'end' indices, submitting jobs to the pool in 'context'
+//      // for each half of the range if the range is large.
+//  {
+//      enum { k_GRAIN_SIZE = 1000 };
+//
+//      if (end - begin > k_GRAIN_SIZE) {
+//          const int middle = begin + (end - begin) / 2;
+//
+//          context->d_pool_p->enqueueJob(
+//                    bdlf::BindUtil::bind(&sumRange, context, begin, middle));
+//          context->d_pool_p->enqueueJob(
+//                      bdlf::BindUtil::bind(&sumRange, context, middle, end));
+//          return;                                                   // RETURN
+//      }
+//
+//      bsls::Types::Int64 sum = 0;
+//      for (int i = begin; i < end; ++i) {
+//          sum += context->d_data_p[i];
+//      }
+//      context->d_sum.addRelaxed(sum);
+//  }
+//..
+// Then, we create and start a pool having four threads, and a shared queue
+// with capacity for 100 jobs submitted from outside of the pool:
+//..
+//  bdlmt::WorkStealingThreadPool pool(4, 100);
+//
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we create the data to be summed:
+//..
+//  enum { k_NUM_ELEMENTS = 100000 };
+//
+//  bsl::vector<int> data(k_NUM_ELEMENTS);
+//  for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+//      data[i] = i % 10;
+//  }
+//..
+// Then, we submit the single job that starts the computation:
+//..
+//  SumContext context;
+//  context.d_pool_p = &pool;
+//  context.d_data_p = data.data();
+//  context.d_sum    = 0;
+//
+//  pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                       &context,
+//                                       0,
+//                                       static_cast<int>(k_NUM_ELEMENTS)));
+//..
+// Finally, we wait for all jobs, including those submitted by other jobs, to
+// complete, and verify the result:
+//..
+//  pool.drain();
+//
+//  assert(450000 == context.d_sum);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_fixedqueue.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_functional.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigset_t
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+                    // ==================================
+                    // class WorkStealingThreadPool_Deque
+                    // ==================================
+
+class WorkStealingThreadPool_Deque {
+    // [!PRIVATE!] This class implements a fixed-capacity, lock-free,
+    // work-stealing deque of pointers to jobs.  A single "owner" thread may
+    // call 'pushBack' and 'popBack'; any thread may call 'steal' and the
+    // accessors concurrently with the owner.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Int64 Int64;
+
+    // DATA
+    bsls::AtomicInt64         d_top;       // index of the oldest job (the
+                                           // next to be stolen)
+
+    const char                d_topPad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                       - sizeof(bsls::AtomicInt64)];
+                                           // padding to prevent 'd_bottom'
+                                           // from being in the same cache
+                                           // line as 'd_top'
+
+    bsls::AtomicInt64         d_bottom;    // index one past the newest job
+                                           // (modified only by the owner)
+
+    const char                d_bottomPad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                          - sizeof(bsls::AtomicInt64)];
+                                           // padding to prevent subsequent
+                                           // data from being in the same
+                                           // cache line as 'd_bottom'
+
+    bsls::AtomicPointer<Job> *d_buffer_p;  // circular buffer of jobs
+
+    const Int64               d_mask;      // capacity minus one
+
+    bslma::Allocator         *d_allocator_p;
+                                           // memory allocator (held, not
+                                           // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool_Deque(const WorkStealingThreadPool_Deque&);
+    WorkStealingThreadPool_Deque& operator=(
+                                          const WorkStealingThreadPool_Deque&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool_Deque,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit WorkStealingThreadPool_Deque(
+                                       int               capacity,
+                                       bslma::Allocator *basicAllocator = 0);
+        // Create an empty deque having the specified 'capacity'.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'capacity' is a positive
+        // power of two.
+
+    ~WorkStealingThreadPool_Deque();
+        // Destroy this deque.  The behavior is undefined unless this deque is
+        // empty.
+
+    // MANIPULATORS
+    Job *popBack();
+        // Remove and return the newest job in this deque, or return 0 if this
+        // deque is empty.  The behavior is undefined unless this method is
+        // invoked by the owner thread.
+
+    int pushBack(Job *job);
+        // Append the specified 'job' to this deque.  Return 0 on success, and
+        // a non-zero value, with no effect, if this deque is full.  The
+        // behavior is undefined unless 'job' is not 0 and this method is
+        // invoked by the owner thread.
+
+    Job *steal();
+        // Remove and return the oldest job in this deque, or return 0 if this
+        // deque is empty or if the oldest job was concurrently removed by
+        // another thread.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the maximum number of jobs this deque can hold.
+
+    bool isEmpty() const;
+        // Return 'true' if this deque held no jobs at some point during the
+        // invocation of this method, and 'false' otherwise.
+
+    int length() const;
+        // Return a snapshot of the number of jobs in this deque.
+};
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a fixed-size thread pool in which each processing
+    // thread has its own deque of jobs, and idle threads steal jobs from the
+    // deques of busy threads.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+    enum {
+        e_STOP
+      , e_RUN
+      , e_SUSPEND
+      , e_DRAIN
+    };
+
+    enum {
+        k_DEQUE_CAPACITY = 1024  // maximum number of jobs pending in the
+                                 // deque of each processing thread
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Deque Deque;
+    typedef bdlcc::FixedQueue<Job *>     Queue;
+
+    // DATA
+    Queue                   d_queue;              // shared queue of jobs
+                                                  // submitted from outside of
+                                                  // the pool
+
+    Deque                  *d_deques_p;           // array of 'd_numThreads'
+                                                  // per-thread deques
+
+    bdlma::ConcurrentPool   d_jobPool;            // pool supplying the memory
+                                                  // of pending jobs
+
+    bslmt::Semaphore        d_queueSemaphore;     // used to block idle worker
+                                                  // threads
+
+    bsls::AtomicInt         d_numThreadsWaiting;  // number of idle threads in
+                                                  // the pool
+
+    bslmt::Mutex            d_metaMutex;          // mutex to ensure that there
+                                                  // is only one controlling
+                                                  // thread at any time
+
+    bsls::AtomicInt         d_control;            // controls which action is
+                                                  // to be performed by the
+                                                  // worker threads (i.e.,
+                                                  // e_RUN, e_DRAIN, or e_STOP)
+
+    int                     d_gateCount;          // count incremented every
+                                                  // time worker threads are
+                                                  // allowed to proceed through
+                                                  // the gate
+
+    int                     d_numThreadsReady;    // number of worker threads
+                                                  // ready to go through the
+                                                  // gate
+
+    bslmt::Mutex            d_gateMutex;          // mutex used to protect the
+                                                  // gate count
+
+    bslmt::Condition        d_threadsReadyCond;   // condition signaled when a
+                                                  // worker thread is ready at
+                                                  // the gate
+
+    bslmt::Condition        d_gateCond;           // condition signaled when
+                                                  // the gate count is
+                                                  // incremented
+
+    bslmt::ThreadUtil::Key  d_workerKey;          // thread-specific key whose
+                                                  // value, in a worker thread,
+                                                  // is one more than the index
+                                                  // of that thread's deque
+
+    bslmt::ThreadGroup      d_threadGroup;        // threads used by this pool
+
+    bslmt::ThreadAttributes d_threadAttributes;   // thread attributes to be
+                                                  // used when constructing
+                                                  // processing threads
+
+    const int               d_numThreads;         // number of configured
+                                                  // processing threads
+
+    bslma::Allocator       *d_allocator_p;        // memory allocator (held,
+                                                  // not owned)
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                d_blockSet;           // set of signals to be
+                                                  // blocked in managed threads
+#endif
+
+    // PRIVATE MANIPULATORS
+    void construct();
+        // Perform the construction steps common to all constructors.
+
+    int currentWorkerIndex();
+        // Return the index of the deque of the calling thread if it is a
+        // processing thread of this pool, and -1 otherwise.
+
+    void deleteJob(Job *job);
+        // Destroy the specified 'job' and return its memory to the job pool.
+
+    int enqueueJobImp(Job *job, bool blockFlag);
+        // Submit the specified 'job' to be executed by the next available
+        // thread: onto the deque of the calling thread if it is a processing
+        // thread of this pool and that deque is not full, and onto the shared
+        // queue otherwise, blocking until the shared queue has room if the
+        // specified 'blockFlag' is 'true'.  Return 0 on success and a non-zero
+        // value otherwise, in which case 'job' is deleted.
+
+    void interruptWorkerThreads();
+        // Awaken any waiting worker threads by signaling the queue semaphore.
+
+    Job *nextJob(int index, unsigned int *randomState);
+        // Return the next job to be executed by the worker thread whose deque
+        // has the specified 'index', taken from its own deque, from the shared
+        // queue, or stolen from another thread's deque (using and updating the
+        // specified 'randomState' to select the first victim), in that order
+        // of preference, or return 0 if no job was found.
+
+    void processJobs(int index, unsigned int *randomState);
+        // Repeatedly retrieve the next job for the worker thread whose deque
+        // has the specified 'index' (using the specified 'randomState') and
+        // process it, or block until one is available.  This function
+        // terminates when it detects a change in the control state.
+
+    void drainJobs(int index, unsigned int *randomState);
+        // Repeatedly retrieve the next job for the worker thread whose deque
+        // has the specified 'index' (using the specified 'randomState') and
+        // process it, until no job can be found.
+
+    void releaseWorkerThreads();
+        // Allow worker threads to proceed through the gate.
+
+    void removeAllJobs();
+        // Delete, without executing, all jobs pending in the shared queue and
+        // in the per-thread deques.  The behavior is undefined unless no
+        // worker thread is running.
+
+    int startNewThread(int index);
+        // Spawn a new processing thread that owns the deque having the
+        // specified 'index'.  Note that this method must be called with
+        // 'd_metaMutex' locked.
+
+    void waitWorkerThreads();
+        // Wait for worker threads to be ready at the gate.
+
+    void workerThread(int index);
+        // The main function executed by the worker thread that owns the deque
+        // having the specified 'index'.
+
+    // PRIVATE ACCESSORS
+    bool hasPendingJobs() const;
+        // Return 'true' if a job was observed in the shared queue or in any
+        // of the per-thread deques, and 'false' otherwise.
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // CREATORS
+    WorkStealingThreadPool(int               numThreads,
+                           int               maxNumPendingJobs,
+                           bslma::Allocator *basicAllocator = 0);
+        // Construct a thread pool with the specified 'numThreads' number of
+        // threads and a shared job queue of capacity sufficient to enqueue the
+        // specified 'maxNumPendingJobs' without blocking.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numThreads' and
+        // '1 <= maxNumPendingJobs <= 0x01FFFFFF'.
+
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           int                             maxNumPendingJobs,
+                           bslma::Allocator               *basicAllocator = 0);
+        // Construct a thread pool with the specified 'threadAttributes',
+        // 'numThreads' number of threads, and a shared job queue with capacity
+        // sufficient to enqueue the specified 'maxNumPendingJobs' without
+        // blocking.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '1 <= numThreads' and '1 <= maxNumPendingJobs <= 0x01FFFFFF'.
+
+    ~WorkStealingThreadPool();
+        // Remove all pending jobs without executing them, block until all
+        // currently running jobs complete, and then destroy this thread pool.
+
+    // MANIPULATORS
+    void disable();
+        // Disable queuing into this pool.  Subsequent calls to 'enqueueJob'
+        // or 'tryEnqueueJob' will immediately fail.  Note that this method has
+        // no effect on jobs currently in the pool.
+
+    void enable();
+        // Enable queuing into this pool.
+
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' to be executed by the next available
+        // thread.  Return 0 if enqueued successfully, and a non-zero value if
+        // queuing is currently disabled.  If the calling thread is a
+        // processing thread of this pool, 'functor' is pushed onto that
+        // thread's deque if it is not full.  Note that this function can block
+        // if 'functor' is enqueued on the shared queue and that queue has
+        // reached full capacity; use 'tryEnqueueJob' instead for
+        // non-blocking.  The behavior is undefined unless 'functor' is not
+        // "unset".
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by the next
+        // available thread.  The specified 'userData' pointer will be passed
+        // to the function by the processing thread.  Return 0 if enqueued
+        // successfully, and a non-zero value if queuing is currently disabled.
+
+    int tryEnqueueJob(const Job& functor);
+    int tryEnqueueJob(bslmf::MovableRef<Job> functor);
+        // Attempt to enqueue the specified 'functor' to be executed by the
+        // next available thread.  Return 0 if enqueued successfully, and a
+        // non-zero value if queuing is currently disabled or 'functor' would
+        // be enqueued on the shared queue and that queue is full.  The
+        // behavior is undefined unless 'functor' is not "unset".
+
+    int tryEnqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Attempt to enqueue the specified 'function' to be executed by the
+        // next available thread.  The specified 'userData' pointer will be
+        // passed to the function by the processing thread.  Return 0 if
+        // enqueued successfully, and a non-zero value if queuing is currently
+        // disabled or the job would be enqueued on the shared queue and that
+        // queue is full.
+
+    void drain();
+        // Wait until all pending jobs, including those submitted by jobs
+        // executing in this pool, complete.  Note that if any jobs are
+        // submitted concurrently with this method from outside of the pool,
+        // this method may or may not wait until they have also completed.
+        // The behavior is undefined if this method is invoked from a
+        // processing thread of this pool.
+
+    void shutdown();
+        // Disable queuing on this thread pool, cancel all pending jobs, and
+        // after all active jobs have completed, join all processing threads.
+        // The behavior is undefined if this method is invoked from a
+        // processing thread of this pool.
+
+    int start();
+        // Spawn 'numThreads()' processing threads.  On success, enable
+        // enqueuing and return 0.  Return a non-zero value otherwise.  If
+        // 'numThreads()' threads were not successfully started, all threads
+        // are stopped.
+
+    void stop();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // complete, then shut down all processing threads.  Note that jobs
+        // executing during this call cannot submit further jobs.  The
+        // behavior is undefined if this method is invoked from a processing
+        // thread of this pool.
+
+    // ACCESSORS
+    bool isEnabled() const;
+        // Return 'true' if queuing is enabled on this thread pool, and 'false'
+        // otherwise.
+
+    bool isStarted() const;
+        // Return 'true' if 'numThreads()' are started on this thread pool and
+        // 'false' otherwise (indicating that 0 threads are started on this
+        // thread pool).
+
+    int numActiveThreads() const;
+        // Return a snapshot of the number of threads that are currently
+        // processing a job for this thread pool.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs currently enqueued, in the
+        // shared queue or in any per-thread deque, to be processed by this
+        // thread pool.
+
+    int numThreads() const;
+        // Return the number of threads passed to this thread pool at
+        // construction.
+
+    int numThreadsStarted() const;
+        // Return a snapshot of the number of threads currently started by this
+        // thread pool.
+
+    int queueCapacity() const;
+        // Return the capacity of the shared queue used to enqueue jobs
+        // submitted from outside of this thread pool.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                    // ----------------------------------
+                    // class WorkStealingThreadPool_Deque
+                    // ----------------------------------
+
+// MANIPULATORS
+inline
+WorkStealingThreadPool_Deque::Job *WorkStealingThreadPool_Deque::popBack()
+{
+    // The sequentially consistent store to 'd_bottom' followed by the
+    // sequentially consistent load of 'd_top' ensures that this thread and a
+    // concurrent thief cannot both claim the last job.
+
+    const Int64 bottom = d_bottom.loadRelaxed() - 1;
+    d_bottom = bottom;
+
+    Int64 top = d_top;
+
+    if (top > bottom) {
+        // The deque was empty.
+
+        d_bottom.storeRelaxed(bottom + 1);
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_buffer_p[bottom & d_mask].loadRelaxed();
+
+    if (top == bottom) {
+        // This is the last job; race against thieves for it.
+
+        if (top != d_top.testAndSwap(top, top + 1)) {
+            job = 0;
+        }
+        d_bottom.storeRelaxed(bottom + 1);
+    }
+
+    return job;
+}
+
+inline
+int WorkStealingThreadPool_Deque::pushBack(Job *job)
+{
+    BSLS_ASSERT(job);
+
+    const Int64 bottom = d_bottom.loadRelaxed();
+    const Int64 top    = d_top.loadAcquire();
+
+    if (bottom - top > d_mask) {
+        return -1;                                                    // RETURN
+    }
+
+    d_buffer_p[bottom & d_mask].storeRelaxed(job);
+
+    // A sequentially consistent store both publishes 'job' to thieves and
+    // orders the store before any subsequent check, by the caller, for idle
+    // threads to awaken.
+
+    d_bottom = bottom + 1;
+
+    return 0;
+}
+
+inline
+WorkStealingThreadPool_Deque::Job *WorkStealingThreadPool_Deque::steal()
+{
+    const Int64 top    = d_top;
+    const Int64 bottom = d_bottom;
+
+    if (top >= bottom) {
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_buffer_p[top & d_mask].loadAcquire();
+
+    if (top != d_top.testAndSwap(top, top + 1)) {
+        // Lost the race to another thief or to the owner.
+
+        return 0;                                                     // RETURN
+    }
+
+    return job;
+}
+
+// ACCESSORS
+inline
+int WorkStealingThreadPool_Deque::capacity() const
+{
+    return static_cast<int>(d_mask + 1);
+}
+
+inline
+bool WorkStealingThreadPool_Deque::isEmpty() const
+{
+    return d_top >= d_bottom;
+}
+
+inline
+int WorkStealingThreadPool_Deque::length() const
+{
+    const Int64 top    = d_top;
+    const Int64 bottom = d_bottom;
+
+    return top < bottom ? static_cast<int>(bottom - top) : 0;
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+void WorkStealingThreadPool::disable()
+{
+    d_queue.disable();
+}
+
+inline
+void WorkStealingThreadPool::enable()
+{
+    d_queue.enable();
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(
+                                     WorkStealingThreadPoolJobFunc  function,
+                                     void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+inline
+int WorkStealingThreadPool::tryEnqueueJob(
+                                     WorkStealingThreadPoolJobFunc  function,
+                                     void                          *userData)
+{
+    return tryEnqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    return d_queue.isEnabled();
+}
+
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return d_numThreads == d_threadGroup.numThreads();
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    int numStarted = d_threadGroup.numThreads();
+    return d_numThreads == numStarted
+         ? numStarted - d_numThreadsWaiting.loadRelaxed()
+         : 0;
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_threadGroup.numThreads();
+}
+
+inline
+int WorkStealingThreadPool::queueCapacity() const
+{
+    return d_queue.size();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1466 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_latch.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#include <bsl_c_signal.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// A work-stealing thread pool dispatches jobs onto a fixed number of threads,
+// each of which owns a lock-free deque of jobs, falling back on a shared
+// queue for jobs submitted from outside of the pool.  We first verify the
+// deque, a private class, in isolation: its LIFO behavior for the owner, FIFO
+// behavior for thieves, its capacity limit, and that, under concurrent
+// popping and stealing, each job is taken exactly once.  We then verify that
+// the pool can be started, drained, stopped, and shut down with the same
+// semantics as 'bdlmt::FixedThreadPool', that jobs submitted from within the
+// pool (which go to per-thread deques) are executed before 'drain' returns,
+// that 'tryEnqueueJob' fails when the shared queue is full or the pool is
+// disabled, and that no memory is leaked when jobs are discarded.
+//
+// In addition to positive test cases, a negative test case -1 compares the
+// throughput of this pool with that of 'bdlmt::FixedThreadPool' and
+// 'bdlmt::ThreadPool' on a fan-out workload.
+// ----------------------------------------------------------------------------
+// WorkStealingThreadPool_Deque
+// [ 2] WorkStealingThreadPool_Deque(int capacity, Allocator *ba = 0);
+// [ 2] ~WorkStealingThreadPool_Deque();
+// [ 2] Job *popBack();
+// [ 2] int pushBack(Job *job);
+// [ 2] Job *steal();
+// [ 2] int capacity() const;
+// [ 2] bool isEmpty() const;
+// [ 2] int length() const;
+//
+// WorkStealingThreadPool
+// [ 3] WorkStealingThreadPool(int, int, Allocator *ba = 0);
+// [ 3] WorkStealingThreadPool(const ThreadAttributes&, int, int, Alloc*);
+// [ 3] ~WorkStealingThreadPool();
+// [ 3] int start();
+// [ 3] void stop();
+// [ 3] bool isStarted() const;
+// [ 3] int numThreads() const;
+// [ 3] int numThreadsStarted() const;
+// [ 3] int queueCapacity() const;
+// [ 4] int enqueueJob(const Job&);
+// [ 4] int enqueueJob(bslmf::MovableRef<Job>);
+// [ 4] int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 4] void drain();
+// [ 4] int numPendingJobs() const;
+// [ 5] int tryEnqueueJob(const Job&);
+// [ 5] int tryEnqueueJob(bslmf::MovableRef<Job>);
+// [ 5] int tryEnqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 5] void disable();
+// [ 5] void enable();
+// [ 5] bool isEnabled() const;
+// [ 6] void stop();
+// [ 6] void shutdown();
+// [ 6] int numActiveThreads() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] CONCERN: JOBS SUBMITTED FROM JOBS
+// [ 8] CONCERN: SYNCHRONOUS SIGNALS
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: FAN-OUT THROUGHPUT COMPARISON
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool       Obj;
+typedef bdlmt::WorkStealingThreadPool_Deque Deque;
+typedef Obj::Job                            Job;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void increment(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+extern "C" void incrementCallback(void *counter)
+    // Increment the 'bsls::AtomicInt' addressed by the specified 'counter'.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+void waitOnBarrier(bslmt::Barrier *barrier, bsls::AtomicInt *counter)
+    // Wait on the specified 'barrier', then increment the specified 'counter'.
+{
+    barrier->wait();
+    ++*counter;
+}
+
+void spawnTree(Obj *pool, int depth, bsls::AtomicInt *counter)
+    // Increment the specified 'counter' and, if the specified 'depth' is
+    // positive, submit to the specified 'pool' two jobs that recursively do
+    // the same for 'depth - 1'.  The total number of increments performed is
+    // '2^(depth + 1) - 1'.
+{
+    ++*counter;
+
+    if (0 < depth) {
+        ASSERT(0 == pool->enqueueJob(
+                  bdlf::BindUtil::bind(&spawnTree, pool, depth - 1, counter)));
+        ASSERT(0 == pool->enqueueJob(
+                  bdlf::BindUtil::bind(&spawnTree, pool, depth - 1, counter)));
+    }
+}
+
+void spawnFlat(Obj *pool, int numJobs, bsls::AtomicInt *counter)
+    // Submit to the specified 'pool' the specified 'numJobs' jobs, each of
+    // which increments the specified 'counter'.
+{
+    for (int i = 0; i < numJobs; ++i) {
+        ASSERT(0 == pool->enqueueJob(
+                                  bdlf::BindUtil::bind(&increment, counter)));
+    }
+}
+
+struct DequeTestContext {
+    // This 'struct' holds the state shared by the owner and thieves in the
+    // concurrent deque test.
+
+    Deque               *d_deque_p;
+    bsl::vector<Job>    *d_jobs_p;
+    bsls::AtomicInt     *d_taken_p;     // per-job count of times taken
+    bsls::AtomicInt      d_numTaken;
+    bsls::AtomicInt      d_done;
+};
+
+void takeJob(DequeTestContext *context, Job *job)
+    // Record in the specified 'context' that the specified 'job' was taken.
+{
+    const int index = static_cast<int>(job - context->d_jobs_p->data());
+    ++context->d_taken_p[index];
+    ++context->d_numTaken;
+}
+
+void dequeOwner(DequeTestContext *context)
+    // Push all jobs in the specified 'context' onto its deque, popping some of
+    // them back along the way, and then pop until the deque is empty.
+{
+    Deque            *deque = context->d_deque_p;
+    bsl::vector<Job>& jobs  = *context->d_jobs_p;
+
+    for (bsl::size_t i = 0; i < jobs.size(); ++i) {
+        while (0 != deque->pushBack(&jobs[i])) {
+            Job *job = deque->popBack();
+            if (job) {
+                takeJob(context, job);
+            }
+        }
+        if (0 == i % 3) {
+            Job *job = deque->popBack();
+            if (job) {
+                takeJob(context, job);
+            }
+        }
+    }
+
+    Job *job;
+    while (0 != (job = deque->popBack())) {
+        takeJob(context, job);
+    }
+
+    context->d_done = 1;
+}
+
+void dequeThief(DequeTestContext *context)
+    // Steal jobs from the deque in the specified 'context' until the owner is
+    // done and the deque is empty.
+{
+    while (1) {
+        Job *job = context->d_deque_p->steal();
+        if (job) {
+            takeJob(context, job);
+        }
+        else if (context->d_done && context->d_deque_p->isEmpty()) {
+            return;                                                   // RETURN
+        }
+    }
+}
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void testSynchronousSignals(bsls::AtomicInt *counter)
+    // Verify that the synchronous signals are not blocked in this thread, and
+    // that some asynchronous signal is, then increment the specified
+    // 'counter'.
+{
+    sigset_t blockedSet;
+    sigemptyset(&blockedSet);
+    pthread_sigmask(SIG_BLOCK, NULL, &blockedSet);
+
+    static const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+#ifdef SIGIOT
+      SIGIOT
+#endif
+    };
+
+    int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        ASSERT(sigismember(&blockedSet, synchronousSignals[i]) == 0);
+    }
+
+#ifndef BSLS_PLATFORM_OS_CYGWIN
+    ASSERT(sigismember(&blockedSet, SIGINT) == 1);
+#endif
+
+    ++*counter;
+}
+#endif
+
+                       // =========================
+                       // namespace FanOutBenchmark
+                       // =========================
+
+namespace FanOutBenchmark {
+
+enum { k_FAN_OUT = 64 };
+
+void leaf(bslmt::Latch *latch, bsls::AtomicInt64 *sink)
+    // Perform a trivial amount of work, recording it in the specified 'sink',
+    // and count down the specified 'latch'.
+{
+    sink->addRelaxed(1);
+    latch->arrive();
+}
+
+template <class POOL>
+void root(POOL *pool, bslmt::Latch *latch, bsls::AtomicInt64 *sink)
+    // Submit to the specified 'pool' 'k_FAN_OUT' leaf jobs, each of which
+    // counts down the specified 'latch' and updates the specified 'sink'.
+{
+    for (int i = 0; i < k_FAN_OUT; ++i) {
+        pool->enqueueJob(bdlf::BindUtil::bind(&leaf, latch, sink));
+    }
+}
+
+template <class POOL>
+void run(POOL *pool, bsls::AtomicInt64 *sink, int)
+    // Submit to the specified 'pool' a root job that fans out into
+    // 'k_FAN_OUT' leaf jobs, and wait for the leaf jobs to complete.  Update
+    // the specified 'sink' from each leaf job.
+{
+    bslmt::Latch latch(k_FAN_OUT);
+
+    pool->enqueueJob(bdlf::BindUtil::bind(&root<POOL>, pool, &latch, sink));
+
+    latch.wait();
+}
+
+template <class POOL>
+double measure(POOL *pool, int numSubmitters, int numMillis, int numSamples)
+    // Return the median throughput, in root jobs per second, measured by a
+    // 'bslmt::ThroughputBenchmark' having the specified 'numSubmitters'
+    // threads submitting fan-out work to the specified 'pool' for the
+    // specified 'numSamples' samples of the specified 'numMillis' duration.
+{
+    bslma::NewDeleteAllocator nalloc;
+
+    bsls::AtomicInt64 sink(0);
+
+    bslmt::ThroughputBenchmark       tb(&nalloc);
+    bslmt::ThroughputBenchmarkResult res(&nalloc);
+
+    bsl::function<void(int)> runFunc = bdlf::BindUtil::bind(
+                                                      &run<POOL>,
+                                                      pool,
+                                                      &sink,
+                                                      bdlf::PlaceHolders::_1);
+
+    int id = tb.addThreadGroup(runFunc, numSubmitters, 0);
+
+    tb.execute(&res, numMillis, numSamples);
+
+    double median;
+    res.getMedian(&median, id);
+
+    return median;
+}
+
+}  // close namespace FanOutBenchmark
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace UsageExample1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Fanning Out Recursively Subdivided Work
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we sum the elements of a large array by recursively
+// splitting the array in half, submitting one job for each half, until the
+// pieces are small enough to be summed directly.  All but the first job are
+// submitted by jobs running in the pool, and so are pushed onto the deque of
+// the submitting thread, from which idle threads steal them.
+//
+// First, we define a structure describing the shared state of the
+// computation, and a function that processes one range of the array:
+//..
+    struct SumContext {
+        // This 'struct' holds the state shared by all jobs of a summation.
+
+        bdlmt::WorkStealingThreadPool *d_pool_p;   // pool running the jobs
+        const int                     *d_data_p;   // data being summed
+        bsls::AtomicInt64              d_sum;      // running total
+    };
+
+    void sumRange(SumContext *context, int begin, int end)
+        // Add to the total in the specified 'context' the sum of the elements
+        // of the array in 'context' in the range defined by the specified
+        // 'begin' and 'end' indices, submitting jobs to the pool in 'context'
+        // for each half of the range if the range is large.
+    {
+        enum { k_GRAIN_SIZE = 1000 };
+
+        if (end - begin > k_GRAIN_SIZE) {
+            const int middle = begin + (end - begin) / 2;
+
+            context->d_pool_p->enqueueJob(
+                      bdlf::BindUtil::bind(&sumRange, context, begin, middle));
+            context->d_pool_p->enqueueJob(
+                        bdlf::BindUtil::bind(&sumRange, context, middle, end));
+            return;                                                   // RETURN
+        }
+
+        bsls::Types::Int64 sum = 0;
+        for (int i = begin; i < end; ++i) {
+            sum += context->d_data_p[i];
+        }
+        context->d_sum.addRelaxed(sum);
+    }
+//..
+
+}  // close namespace UsageExample1
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace UsageExample1;
+
+// Then, we create and start a pool having four threads, and a shared queue
+// with capacity for 100 jobs submitted from outside of the pool:
+//..
+    bdlmt::WorkStealingThreadPool pool(4, 100);
+
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we create the data to be summed:
+//..
+    enum { k_NUM_ELEMENTS = 100000 };
+
+    bsl::vector<int> data(k_NUM_ELEMENTS);
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        data[i] = i % 10;
+    }
+//..
+// Then, we submit the single job that starts the computation:
+//..
+    SumContext context;
+    context.d_pool_p = &pool;
+    context.d_data_p = data.data();
+    context.d_sum    = 0;
+
+    pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                         &context,
+                                         0,
+                                         static_cast<int>(k_NUM_ELEMENTS)));
+//..
+// Finally, we wait for all jobs, including those submitted by other jobs, to
+// complete, and verify the result:
+//..
+    pool.drain();
+
+    ASSERT(450000 == context.d_sum);
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCERN: SYNCHRONOUS SIGNALS
+        //
+        // Concerns:
+        //: 1 On unix platforms, the processing threads block all asynchronous
+        //:   signals and no synchronous signals.
+        //
+        // Plan:
+        //: 1 Submit jobs that inspect the signal mask of the thread running
+        //:   them.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: SYNCHRONOUS SIGNALS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: SYNCHRONOUS SIGNALS" << endl
+                          << "============================" << endl;
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        bsls::AtomicInt counter(0);
+        {
+            Obj mX(4, 16, &ta);
+            ASSERT(0 == mX.start());
+
+            for (int i = 0; i < 16; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                     bdlf::BindUtil::bind(&testSynchronousSignals, &counter)));
+            }
+            mX.drain();
+        }
+        ASSERTV(counter, 16 == counter);
+#endif
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCERN: JOBS SUBMITTED FROM JOBS
+        //
+        // Concerns:
+        //: 1 Jobs submitted by jobs running in the pool are executed, and are
+        //:   complete before 'drain' returns.
+        //:
+        //: 2 A job may submit more jobs than fit in the deque of its thread;
+        //:   the excess goes to the shared queue.
+        //:
+        //: 3 Jobs submitted by a single job are executed by more than one
+        //:   thread (i.e., they are stolen).
+        //:
+        //: 4 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Submit a single job that recursively submits a binary tree of
+        //:   jobs, drain, and verify the number of jobs executed.  (C-1)
+        //:
+        //: 2 Using a pool with a shared queue large enough to hold the excess,
+        //:   submit a single job that submits 'k_DEQUE_CAPACITY + 100' jobs,
+        //:   drain, and verify the count.  (C-2)
+        //:
+        //: 3 Submit a job that submits jobs that each wait on a barrier for
+        //:   all of the pool's threads; that the barrier is passed shows that
+        //:   every thread took one of the jobs.  (C-3)
+        //:
+        //: 4 Use a test allocator as the default allocator.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: JOBS SUBMITTED FROM JOBS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: JOBS SUBMITTED FROM JOBS" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tBinary tree of jobs." << endl;
+        {
+            const int DEPTHS[] = { 0, 1, 5, 10, 14 };
+            const int NUM_DEPTHS = sizeof DEPTHS / sizeof *DEPTHS;
+
+            for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+                Obj mX(numThreads, 4, &ta);
+                ASSERT(0 == mX.start());
+
+                for (int ti = 0; ti < NUM_DEPTHS; ++ti) {
+                    const int DEPTH = DEPTHS[ti];
+
+                    bsls::AtomicInt counter(0);
+
+                    ASSERT(0 == mX.enqueueJob(
+                                    bdlf::BindUtil::bind(&spawnTree,
+                                                         &mX,
+                                                         DEPTH,
+                                                         &counter)));
+                    mX.drain();
+
+                    ASSERTV(numThreads, DEPTH, counter,
+                            (2 << DEPTH) - 1 == counter);
+                    ASSERTV(mX.numPendingJobs(), 0 == mX.numPendingJobs());
+                }
+            }
+        }
+
+        if (verbose) cout << "\tOverflow of a deque." << endl;
+        {
+            const int NUM_JOBS = Obj::k_DEQUE_CAPACITY + 100;
+
+            for (int numThreads = 1; numThreads <= 4; numThreads *= 2) {
+                Obj mX(numThreads, 200, &ta);
+                ASSERT(0 == mX.start());
+
+                bsls::AtomicInt counter(0);
+
+                ASSERT(0 == mX.enqueueJob(
+                                    bdlf::BindUtil::bind(&spawnFlat,
+                                                         &mX,
+                                                         NUM_JOBS,
+                                                         &counter)));
+                mX.drain();
+
+                ASSERTV(numThreads, counter, NUM_JOBS == counter);
+            }
+        }
+
+        if (verbose) cout << "\tStealing." << endl;
+        {
+            const int NUM_THREADS = 4;
+
+            Obj mX(NUM_THREADS, 4, &ta);
+            ASSERT(0 == mX.start());
+
+            bslmt::Barrier  barrier(NUM_THREADS);
+            bsls::AtomicInt counter(0);
+
+            bsl::function<void()> waitJob = bdlf::BindUtil::bind(
+                                                               &waitOnBarrier,
+                                                               &barrier,
+                                                               &counter);
+
+            // The job below submits 'NUM_THREADS' jobs to its own deque and
+            // returns; the barrier is passed only if the other threads steal.
+
+            struct Local {
+                static void submit(Obj *pool, const bsl::function<void()> *j)
+                {
+                    for (int i = 0; i < NUM_THREADS; ++i) {
+                        ASSERT(0 == pool->enqueueJob(*j));
+                    }
+                }
+            };
+
+            ASSERT(0 == mX.enqueueJob(
+                         bdlf::BindUtil::bind(&Local::submit, &mX, &waitJob)));
+            mX.drain();
+
+            ASSERTV(counter, NUM_THREADS == counter);
+        }
+
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // STOP AND SHUTDOWN
+        //
+        // Concerns:
+        //: 1 'stop' completes all pending jobs, including those submitted by
+        //:   jobs while stopping, and stops the threads.
+        //:
+        //: 2 'shutdown' discards pending jobs, and releases their memory.
+        //:
+        //: 3 The pool can be restarted after 'stop' and 'shutdown'.
+        //:
+        //: 4 Destroying a pool that was never started releases the memory of
+        //:   jobs that were submitted to it.
+        //:
+        //: 5 'numActiveThreads' is 0 for an idle pool, and equal to the number
+        //:   of busy threads otherwise.
+        //
+        // Plan:
+        //: 1 Submit a number of jobs, 'stop' the pool, and verify that every
+        //:   job ran.  (C-1)
+        //:
+        //: 2 Block all threads on a barrier, submit more jobs, then
+        //:   'shutdown' concurrently with releasing the barrier; verify that
+        //:   fewer jobs ran than were submitted and that the test allocator
+        //:   reports no outstanding blocks other than the pool's own.  (C-2)
+        //:
+        //: 3 'start' the pool again and repeat P-1.  (C-3)
+        //:
+        //: 4 Submit jobs to a pool that is not started and destroy it; the
+        //:   test allocator verifies that nothing leaked.  (C-4)
+        //:
+        //: 5 Check 'numActiveThreads' while all threads are blocked and after
+        //:   draining.  (C-5)
+        //
+        // Testing:
+        //   void stop();
+        //   void shutdown();
+        //   int numActiveThreads() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STOP AND SHUTDOWN" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const int NUM_THREADS = 4;
+        const int NUM_JOBS    = 50;
+
+        {
+            Obj mX(NUM_THREADS, NUM_JOBS, &ta);
+
+            if (verbose) cout << "\t'stop' completes pending jobs." << endl;
+
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                                  bdlf::BindUtil::bind(&increment, &counter)));
+            }
+            mX.stop();
+
+            ASSERTV(counter, NUM_JOBS == counter);
+            ASSERT(!mX.isStarted());
+            ASSERT(!mX.isEnabled());
+            ASSERT(0 != mX.enqueueJob(
+                                  bdlf::BindUtil::bind(&increment, &counter)));
+
+            if (verbose) cout << "\t'numActiveThreads'." << endl;
+
+            ASSERT(0 == mX.start());
+
+            bslmt::Barrier barrier(NUM_THREADS + 1);
+            counter = 0;
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                    bdlf::BindUtil::bind(&waitOnBarrier, &barrier, &counter)));
+            }
+
+            // Wait until every thread has taken one of the jobs.
+
+            while (NUM_THREADS != mX.numActiveThreads() ||
+                   0 != mX.numPendingJobs()) {
+                bslmt::ThreadUtil::yield();
+            }
+            barrier.wait();
+            mX.drain();
+
+            ASSERTV(counter, NUM_THREADS == counter);
+
+            // Threads released by 'drain' are briefly active before finding
+            // that there are no jobs.
+
+            for (int i = 0; i < 1000 && 0 != mX.numActiveThreads(); ++i) {
+                bslmt::ThreadUtil::microSleep(1000);
+            }
+            ASSERTV(mX.numActiveThreads(), 0 == mX.numActiveThreads());
+
+            if (verbose) cout << "\t'shutdown' discards pending jobs."
+                              << endl;
+
+            counter = 0;
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                    bdlf::BindUtil::bind(&waitOnBarrier, &barrier, &counter)));
+            }
+            while (NUM_THREADS != mX.numActiveThreads() ||
+                   0 != mX.numPendingJobs()) {
+                bslmt::ThreadUtil::yield();
+            }
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                                  bdlf::BindUtil::bind(&increment, &counter)));
+            }
+            ASSERTV(mX.numPendingJobs(), NUM_JOBS == mX.numPendingJobs());
+
+            // Release the blocked threads only once 'shutdown' has begun,
+            // which we cannot observe directly; disable the pool first so
+            // that 'shutdown' is the only way in which the pool can proceed.
+
+            mX.disable();
+            bslmt::ThreadUtil::Handle handle;
+            bsl::function<void()>     releaseFunc = bdlf::BindUtil::bind(
+                                                         &bslmt::Barrier::wait,
+                                                            &barrier);
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(&handle,
+                                                               releaseFunc,
+                                                               &ta));
+            mX.shutdown();
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERTV(counter, NUM_JOBS + NUM_THREADS >= counter);
+            ASSERTV(counter, NUM_THREADS <= counter);
+            ASSERTV(mX.numPendingJobs(), 0 == mX.numPendingJobs());
+            ASSERT(!mX.isStarted());
+
+            if (verbose) cout << "\tRestart after 'shutdown'." << endl;
+
+            ASSERT(0 == mX.start());
+            counter = 0;
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                                  bdlf::BindUtil::bind(&increment, &counter)));
+            }
+            mX.stop();
+            ASSERTV(counter, NUM_JOBS == counter);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tDestroying a pool that was never started."
+                          << endl;
+        {
+            Obj mX(NUM_THREADS, NUM_JOBS, &ta);
+            mX.enable();
+
+            bsls::AtomicInt counter(0);
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                                  bdlf::BindUtil::bind(&increment, &counter)));
+            }
+            ASSERTV(mX.numPendingJobs(), NUM_JOBS == mX.numPendingJobs());
+            ASSERT(0 == counter);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TRY ENQUEUE, ENABLE, AND DISABLE
+        //
+        // Concerns:
+        //: 1 'tryEnqueueJob' succeeds while the shared queue has capacity and
+        //:   fails, without blocking, when the shared queue is full.
+        //:
+        //: 2 A pool is disabled until started, and no job can be submitted to
+        //:   a disabled pool.
+        //:
+        //: 3 All three overloads of 'tryEnqueueJob' behave the same way.
+        //
+        // Plan:
+        //: 1 Without starting the pool, enable it and fill the shared queue
+        //:   with 'tryEnqueueJob', using each overload; verify the next call
+        //:   fails.  Then start the pool, drain, and verify the jobs ran.
+        //:   (C-1, 3)
+        //:
+        //: 2 Verify 'isEnabled' before 'start', after 'start', and after
+        //:   'disable' and 'enable'; verify that submitting to a disabled pool
+        //:   fails.  (C-2)
+        //
+        // Testing:
+        //   int tryEnqueueJob(const Job&);
+        //   int tryEnqueueJob(bslmf::MovableRef<Job>);
+        //   int tryEnqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   void disable();
+        //   void enable();
+        //   bool isEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TRY ENQUEUE, ENABLE, AND DISABLE" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const int CAPACITY = 30;
+
+        {
+            Obj mX(2, CAPACITY, &ta);  const Obj& X = mX;
+
+            ASSERT(!X.isEnabled());
+
+            bsls::AtomicInt counter(0);
+
+            ASSERT(0 != mX.tryEnqueueJob(
+                                  bdlf::BindUtil::bind(&increment, &counter)));
+            ASSERT(0 != mX.enqueueJob(&incrementCallback, &counter));
+
+            mX.enable();
+            ASSERT(X.isEnabled());
+
+            for (int i = 0; i < CAPACITY; ++i) {
+                int rc;
+                switch (i % 3) {
+                  case 0: {
+                    rc = mX.tryEnqueueJob(
+                                   bdlf::BindUtil::bind(&increment, &counter));
+                  } break;
+                  case 1: {
+                    Job job = bdlf::BindUtil::bind(&increment, &counter);
+                    rc = mX.tryEnqueueJob(bslmf::MovableRefUtil::move(job));
+                  } break;
+                  default: {
+                    rc = mX.tryEnqueueJob(&incrementCallback, &counter);
+                  } break;
+                }
+                ASSERTV(i, 0 == rc);
+            }
+
+            ASSERTV(X.numPendingJobs(), CAPACITY == X.numPendingJobs());
+
+            ASSERT(0 != mX.tryEnqueueJob(
+                                  bdlf::BindUtil::bind(&increment, &counter)));
+            {
+                Job job = bdlf::BindUtil::bind(&increment, &counter);
+                ASSERT(0 != mX.tryEnqueueJob(
+                                            bslmf::MovableRefUtil::move(job)));
+            }
+            ASSERT(0 != mX.tryEnqueueJob(&incrementCallback, &counter));
+
+            ASSERT(0 == mX.start());
+            ASSERT(X.isEnabled());
+            mX.drain();
+
+            ASSERTV(counter, CAPACITY == counter);
+
+            mX.disable();
+            ASSERT(!X.isEnabled());
+            ASSERT(0 != mX.enqueueJob(
+                                  bdlf::BindUtil::bind(&increment, &counter)));
+            ASSERT(0 != mX.tryEnqueueJob(&incrementCallback, &counter));
+
+            mX.enable();
+            ASSERT(X.isEnabled());
+            ASSERT(0 == mX.tryEnqueueJob(&incrementCallback, &counter));
+            mX.drain();
+
+            ASSERTV(counter, CAPACITY + 1 == counter);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ENQUEUE AND DRAIN
+        //
+        // Concerns:
+        //: 1 Jobs submitted from outside of the pool with each 'enqueueJob'
+        //:   overload are executed.
+        //:
+        //: 2 'drain' returns only when all submitted jobs have completed, and
+        //:   leaves the pool running.
+        //:
+        //: 3 'enqueueJob' blocks, rather than fails, when the shared queue is
+        //:   full.
+        //:
+        //: 4 Jobs may be submitted concurrently from several threads.
+        //
+        // Plan:
+        //: 1 For a variety of thread counts, submit many more jobs than the
+        //:   capacity of the shared queue, using each overload in turn, from
+        //:   several threads concurrently; drain and verify the count.
+        //:   Repeat to verify the pool is still running.  (C-1..4)
+        //
+        // Testing:
+        //   int enqueueJob(const Job&);
+        //   int enqueueJob(bslmf::MovableRef<Job>);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   void drain();
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ENQUEUE AND DRAIN" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const int NUM_SUBMITTERS = 3;
+        const int NUM_JOBS       = 1000;
+
+        struct Local {
+            static void submit(Obj *pool, bsls::AtomicInt *counter)
+            {
+                for (int i = 0; i < NUM_JOBS; ++i) {
+                    int rc;
+                    switch (i % 3) {
+                      case 0: {
+                        rc = pool->enqueueJob(
+                                    bdlf::BindUtil::bind(&increment, counter));
+                      } break;
+                      case 1: {
+                        Job job = bdlf::BindUtil::bind(&increment, counter);
+                        rc = pool->enqueueJob(
+                                             bslmf::MovableRefUtil::move(job));
+                      } break;
+                      default: {
+                        rc = pool->enqueueJob(&incrementCallback, counter);
+                      } break;
+                    }
+                    ASSERTV(i, 0 == rc);
+                }
+            }
+        };
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            Obj mX(numThreads, 16, &ta);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            for (int iteration = 0; iteration < 2; ++iteration) {
+                bsls::AtomicInt counter(0);
+
+                bslmt::ThreadGroup submitters(&ta);
+                submitters.addThreads(
+                           bdlf::BindUtil::bind(&Local::submit, &mX, &counter),
+                           NUM_SUBMITTERS);
+                submitters.joinAll();
+
+                mX.drain();
+
+                ASSERTV(numThreads, counter,
+                        NUM_SUBMITTERS * NUM_JOBS == counter);
+                ASSERTV(X.numPendingJobs(), 0 == X.numPendingJobs());
+                ASSERT(X.isStarted());
+                ASSERT(X.isEnabled());
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Both constructors create a pool having the specified number of
+        //:   threads and shared-queue capacity, that is not started.
+        //:
+        //: 2 'start' starts the specified number of threads, and 'stop' stops
+        //:   them.  Calling 'start' on a started pool has no effect.
+        //:
+        //: 3 All memory is supplied by the specified allocator, and is
+        //:   released on destruction.
+        //
+        // Plan:
+        //: 1 Construct pools with each constructor for a variety of arguments,
+        //:   using a test allocator, and verify the accessors before and after
+        //:   'start' and 'stop'.  (C-1..2)
+        //:
+        //: 2 Verify, using a test allocator installed as the default, that no
+        //:   memory is obtained from the default allocator, and that the
+        //:   object allocator has no blocks in use after destruction.  (C-3)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(int, int, Allocator *ba = 0);
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, int, Alloc*);
+        //   ~WorkStealingThreadPool();
+        //   int start();
+        //   void stop();
+        //   bool isStarted() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        //   int queueCapacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_numThreads;
+            int d_capacity;
+        } DATA[] = {
+            { L_,  1,    1 },
+            { L_,  1,  100 },
+            { L_,  2,   10 },
+            { L_,  4,   30 },
+            { L_, 10, 1000 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE        = DATA[ti].d_line;
+            const int NUM_THREADS = DATA[ti].d_numThreads;
+            const int CAPACITY    = DATA[ti].d_capacity;
+
+            for (char cfg = 'a'; cfg <= 'b'; ++cfg) {
+                bslmt::ThreadAttributes attributes(&ta);
+                attributes.setStackSize(1024 * 1024);
+
+                Obj *objPtr = 'a' == cfg
+                            ? new (ta) Obj(NUM_THREADS, CAPACITY, &ta)
+                            : new (ta) Obj(attributes,
+                                           NUM_THREADS,
+                                           CAPACITY,
+                                           &ta);
+                Obj& mX = *objPtr;  const Obj& X = mX;
+
+                ASSERTV(LINE, cfg, NUM_THREADS == X.numThreads());
+                ASSERTV(LINE, cfg, CAPACITY <= X.queueCapacity());
+                ASSERTV(LINE, cfg, 0 == X.numThreadsStarted());
+                ASSERTV(LINE, cfg, !X.isStarted());
+                ASSERTV(LINE, cfg, !X.isEnabled());
+                ASSERTV(LINE, cfg, 0 == X.numPendingJobs());
+                ASSERTV(LINE, cfg, 0 == X.numActiveThreads());
+
+                ASSERTV(LINE, cfg, 0 == mX.start());
+                ASSERTV(LINE, cfg, NUM_THREADS == X.numThreadsStarted());
+                ASSERTV(LINE, cfg, X.isStarted());
+                ASSERTV(LINE, cfg, X.isEnabled());
+
+                ASSERTV(LINE, cfg, 0 == mX.start());
+                ASSERTV(LINE, cfg, NUM_THREADS == X.numThreadsStarted());
+
+                mX.stop();
+                ASSERTV(LINE, cfg, 0 == X.numThreadsStarted());
+                ASSERTV(LINE, cfg, !X.isStarted());
+                ASSERTV(LINE, cfg, !X.isEnabled());
+
+                ASSERTV(LINE, cfg, 0 == mX.start());
+                ASSERTV(LINE, cfg, X.isStarted());
+
+                ta.deleteObject(objPtr);
+
+                ASSERTV(LINE, cfg, ta.numBlocksInUse(),
+                        0 == ta.numBlocksInUse());
+            }
+        }
+
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // WORK-STEALING DEQUE
+        //
+        // Concerns:
+        //: 1 The owner takes jobs from the back (LIFO), and thieves take jobs
+        //:   from the front (FIFO).
+        //:
+        //: 2 'pushBack' fails when the deque holds 'capacity' jobs, and
+        //:   succeeds again once a job has been removed.
+        //:
+        //: 3 'popBack' and 'steal' return 0 when the deque is empty.
+        //:
+        //: 4 'length' and 'isEmpty' reflect the number of jobs held.
+        //:
+        //: 5 Under concurrent 'popBack' and 'steal', every job pushed is taken
+        //:   exactly once, including when the deque holds a single job.
+        //:
+        //: 6 Memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Push, pop, and steal sequences of jobs from a single thread for a
+        //:   variety of capacities, verifying the order of results and the
+        //:   accessors.  (C-1..4, 6)
+        //:
+        //: 2 Have one owner thread push, and periodically pop, a large number
+        //:   of jobs onto a small deque, while several thief threads steal
+        //:   concurrently; verify that each job was taken exactly once.
+        //:   (C-5)
+        //
+        // Testing:
+        //   WorkStealingThreadPool_Deque(int capacity, Allocator *ba = 0);
+        //   ~WorkStealingThreadPool_Deque();
+        //   Job *popBack();
+        //   int pushBack(Job *job);
+        //   Job *steal();
+        //   int capacity() const;
+        //   bool isEmpty() const;
+        //   int length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WORK-STEALING DEQUE" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tSingle-threaded behavior." << endl;
+        {
+            const int CAPACITIES[] = { 1, 2, 4, 16, 1024 };
+            const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+            bsl::vector<Job> jobs(&ta);
+            jobs.resize(2048);
+
+            for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+                const int CAPACITY = CAPACITIES[ti];
+
+                Deque mX(CAPACITY, &ta);  const Deque& X = mX;
+
+                ASSERTV(CAPACITY, 2 == ta.numBlocksInUse());
+                ASSERTV(CAPACITY, CAPACITY == X.capacity());
+                ASSERTV(CAPACITY, X.isEmpty());
+                ASSERTV(CAPACITY, 0 == X.length());
+                ASSERTV(CAPACITY, 0 == mX.popBack());
+                ASSERTV(CAPACITY, 0 == mX.steal());
+
+                // Repeat to exercise wrap-around of the indices.
+
+                for (int round = 0; round < 3; ++round) {
+                    for (int i = 0; i < CAPACITY; ++i) {
+                        ASSERTV(CAPACITY, i, 0 == mX.pushBack(&jobs[i]));
+                        ASSERTV(CAPACITY, i, i + 1 == X.length());
+                        ASSERTV(CAPACITY, i, !X.isEmpty());
+                    }
+                    ASSERTV(CAPACITY, 0 != mX.pushBack(&jobs[CAPACITY]));
+                    ASSERTV(CAPACITY, CAPACITY == X.length());
+
+                    // Steal the front half, pop the back half.
+
+                    const int HALF = CAPACITY / 2;
+                    for (int i = 0; i < HALF; ++i) {
+                        ASSERTV(CAPACITY, i, &jobs[i] == mX.steal());
+                    }
+                    for (int i = CAPACITY - 1; i >= HALF; --i) {
+                        ASSERTV(CAPACITY, i, &jobs[i] == mX.popBack());
+                    }
+                    ASSERTV(CAPACITY, X.isEmpty());
+                    ASSERTV(CAPACITY, 0 == X.length());
+                    ASSERTV(CAPACITY, 0 == mX.popBack());
+                    ASSERTV(CAPACITY, 0 == mX.steal());
+                }
+
+                // Removing a job from a full deque makes room for another.
+
+                for (int i = 0; i < CAPACITY; ++i) {
+                    ASSERTV(CAPACITY, i, 0 == mX.pushBack(&jobs[i]));
+                }
+                ASSERTV(CAPACITY, &jobs[0] == mX.steal());
+                ASSERTV(CAPACITY, 0 == mX.pushBack(&jobs[CAPACITY]));
+                ASSERTV(CAPACITY, &jobs[CAPACITY] == mX.popBack());
+                while (mX.popBack()) {
+                }
+                ASSERTV(CAPACITY, X.isEmpty());
+            }
+            ASSERTV(ta.numBlocksInUse(), 1 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tConcurrent 'popBack' and 'steal'." << endl;
+        {
+            const int NUM_JOBS    = 200000;
+            const int NUM_THIEVES = 3;
+
+            for (int capacity = 1; capacity <= 64; capacity *= 8) {
+                bsl::vector<Job> jobs(&ta);
+                jobs.resize(NUM_JOBS);
+
+                bsls::AtomicInt *taken = static_cast<bsls::AtomicInt *>(
+                                   ta.allocate(NUM_JOBS * sizeof *taken));
+                for (int i = 0; i < NUM_JOBS; ++i) {
+                    new (&taken[i]) bsls::AtomicInt(0);
+                }
+
+                Deque mX(capacity, &ta);
+
+                DequeTestContext context;
+                context.d_deque_p = &mX;
+                context.d_jobs_p  = &jobs;
+                context.d_taken_p = taken;
+                context.d_numTaken = 0;
+                context.d_done     = 0;
+
+                bslmt::ThreadGroup threads(&ta);
+                threads.addThreads(bdlf::BindUtil::bind(&dequeThief,
+                                                        &context),
+                                   NUM_THIEVES);
+                threads.addThread(bdlf::BindUtil::bind(&dequeOwner,
+                                                       &context));
+                threads.joinAll();
+
+                ASSERTV(capacity, context.d_numTaken,
+                        NUM_JOBS == context.d_numTaken);
+                for (int i = 0; i < NUM_JOBS; ++i) {
+                    ASSERTV(capacity, i, taken[i], 1 == taken[i]);
+                }
+                ta.deallocate(taken);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a pool, start it, submit jobs from outside and from within
+        //:   the pool, drain it, and stop it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(4, 10, &ta);  const Obj& X = mX;
+
+            ASSERT(4  == X.numThreads());
+            ASSERT(10 <= X.queueCapacity());
+            ASSERT(!X.isStarted());
+
+            ASSERT(0 == mX.start());
+            ASSERT(X.isStarted());
+            ASSERT(4 == X.numThreadsStarted());
+
+            bsls::AtomicInt counter(0);
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                                  bdlf::BindUtil::bind(&increment, &counter)));
+            }
+            ASSERT(0 == mX.enqueueJob(
+                          bdlf::BindUtil::bind(&spawnTree, &mX, 3, &counter)));
+
+            mX.drain();
+            ASSERTV(counter, 10 + 15 == counter);
+
+            mX.stop();
+            ASSERT(!X.isStarted());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FAN-OUT THROUGHPUT COMPARISON
+        //
+        // Concerns:
+        //: 1 On a workload in which each submitted job submits many small
+        //:   jobs, 'bdlmt::WorkStealingThreadPool' sustains a higher
+        //:   throughput than 'bdlmt::FixedThreadPool' and 'bdlmt::ThreadPool'.
+        //
+        // Plan:
+        //: 1 Using 'bslmt::ThroughputBenchmark', have a varying number of
+        //:   submitting threads each repeatedly submit a root job that fans
+        //:   out into 'k_FAN_OUT' leaf jobs and wait for the leaves to
+        //:   complete, for each kind of pool having the same number of
+        //:   processing threads.  Report the median number of root jobs per
+        //:   second.  (C-1)
+        //:
+        //: 2 Optional arguments select the number of processing threads, the
+        //:   sample duration in milliseconds, and the number of samples.
+        //
+        // Testing:
+        //   PERFORMANCE: FAN-OUT THROUGHPUT COMPARISON
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: FAN-OUT THROUGHPUT COMPARISON"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        bslma::NewDeleteAllocator nalloc;
+        bslma::DefaultAllocatorGuard guard(&nalloc);
+
+        int numThreads = static_cast<int>(
+                                   bslmt::ThreadUtil::hardwareConcurrency());
+        if (numThreads < 2) {
+            numThreads = 2;
+        }
+        int numMillis  = 1000;
+        int numSamples = 5;
+
+        if (argc > 2 && atoi(argv[2]) > 0) numThreads = atoi(argv[2]);
+        if (argc > 3 && atoi(argv[3]) > 0) numMillis  = atoi(argv[3]);
+        if (argc > 4 && atoi(argv[4]) > 0) numSamples = atoi(argv[4]);
+
+        const int QUEUE_CAPACITY = 1 << 16;
+
+        cout << "threads=" << numThreads
+             << " fanOut=" << FanOutBenchmark::k_FAN_OUT
+             << " millis=" << numMillis
+             << " samples=" << numSamples << endl;
+        cout << "submitters,FixedThreadPool,ThreadPool,WorkStealingThreadPool"
+             << endl;
+
+        for (int numSubmitters = 1;
+             numSubmitters <= numThreads;
+             numSubmitters *= 2) {
+            double fixedRate, dynamicRate, stealingRate;
+            {
+                bdlmt::FixedThreadPool pool(numThreads,
+                                            QUEUE_CAPACITY,
+                                            &nalloc);
+                pool.start();
+                fixedRate = FanOutBenchmark::measure(&pool,
+                                                     numSubmitters,
+                                                     numMillis,
+                                                     numSamples);
+                pool.stop();
+            }
+            {
+                bslmt::ThreadAttributes attributes;
+                bdlmt::ThreadPool pool(attributes,
+                                       numThreads,
+                                       numThreads,
+                                       1000,
+                                       &nalloc);
+                pool.start();
+                dynamicRate = FanOutBenchmark::measure(&pool,
+                                                       numSubmitters,
+                                                       numMillis,
+                                                       numSamples);
+                pool.stop();
+            }
+            {
+                Obj pool(numThreads, QUEUE_CAPACITY, &nalloc);
+                pool.start();
+                stealingRate = FanOutBenchmark::measure(&pool,
+                                                        numSubmitters,
+                                                        numMillis,
+                                                        numSamples);
+                pool.stop();
+            }
+            cout << fixed << setprecision(0)
+                 << numSubmitters << ","
+                 << fixedRate << "," << dynamicRate << ","
+                 << stealingRate << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
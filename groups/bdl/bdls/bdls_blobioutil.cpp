@@ -0,0 +1,454 @@
+// bdls_blobioutil.cpp                                                -*-C++-*-
+#include <bdls_blobioutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdls_blobioutil_cpp,"$Id$ $CSID$")
+
+#include <bdls_filesystemutil_unixplatform.h>
+
+#include <bdlbb_blobutil.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_utility.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+# include <windows.h>
+#else
+# include <bsl_c_errno.h>
+# include <bsl_c_limits.h>
+# include <sys/types.h>
+# include <sys/uio.h>
+# include <unistd.h>
+#endif
+
+// MACROS
+#if defined(BSLS_PLATFORM_OS_UNIX)                          \
+ && defined(BDLS_FILESYSTEMUTIL_UNIXPLATFORM_64_BIT_OFF64)
+    // 'Offset' is 'off64_t', which requires the 'xxx64'-suffixed positional
+    // I/O functions.
+# define U_PREAD  ::pread64
+# define U_PWRITE ::pwrite64
+#elif defined(BSLS_PLATFORM_OS_UNIX)
+# define U_PREAD  ::pread
+# define U_PWRITE ::pwrite
+#endif
+
+#if defined(BSLS_PLATFORM_OS_LINUX)                          \
+ && !defined(BDLS_FILESYSTEMUTIL_UNIXPLATFORM_64_BIT_OFF64)
+    // Vectored positional I/O is available, and takes an 'off_t' offset.
+# define U_HAS_PREADV
+#endif
+
+namespace BloombergLP {
+namespace {
+
+typedef bdls::BlobIoUtil::FileDescriptor FileDescriptor;
+typedef bdls::BlobIoUtil::Offset         Offset;
+
+enum Direction {
+    // This 'enum' enumerates the directions in which data is transferred.
+
+    e_READ,
+    e_WRITE
+};
+
+                            // ================
+                            // class BlobCursor
+                            // ================
+
+class BlobCursor {
+    // This class provides a position within the data of a blob, expressed as
+    // a buffer index and an offset within that buffer, that can be advanced
+    // without searching the blob from its start.
+
+    // DATA
+    const bdlbb::Blob *d_blob_p;        // blob (held, not owned)
+    int                d_index;         // index of the current buffer
+    int                d_bufferOffset;  // offset within the current buffer
+
+  public:
+    // CREATORS
+    BlobCursor(const bdlbb::Blob *blob, int offset)
+        // Create a cursor positioned at the specified 'offset' within the
+        // specified 'blob'.  The behavior is undefined unless
+        // '0 <= offset < blob->length()'.
+    : d_blob_p(blob)
+    {
+        const bsl::pair<int, int> place =
+                      bdlbb::BlobUtil::findBufferIndexAndOffset(*blob, offset);
+        d_index        = place.first;
+        d_bufferOffset = place.second;
+    }
+
+    // MANIPULATORS
+    void advance(int numBytes)
+        // Move this cursor forward by the specified 'numBytes', skipping any
+        // empty buffers.  The behavior is undefined unless the new position is
+        // within the data of the blob, or immediately after it.
+    {
+        d_bufferOffset += numBytes;
+        while (d_index < d_blob_p->numBuffers()
+            && d_bufferOffset >= d_blob_p->buffer(d_index).size()) {
+            d_bufferOffset -= d_blob_p->buffer(d_index).size();
+            ++d_index;
+        }
+    }
+
+    // ACCESSORS
+    char *data() const
+        // Return the address of the byte at the position of this cursor.
+    {
+        return d_blob_p->buffer(d_index).data() + d_bufferOffset;
+    }
+
+    int index() const
+        // Return the index of the buffer holding the byte at the position of
+        // this cursor.
+    {
+        return d_index;
+    }
+
+    int numContiguousBytes() const
+        // Return the number of bytes from the position of this cursor to the
+        // end of the buffer holding it.
+    {
+        return d_blob_p->buffer(d_index).size() - d_bufferOffset;
+    }
+};
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+
+#if defined(IOV_MAX) && IOV_MAX < 64
+const int k_MAX_NUM_IOVECS = IOV_MAX;
+#else
+const int k_MAX_NUM_IOVECS = 64;
+#endif
+    // maximum number of 'iovec' elements supplied to a single system call
+
+int loadIovecsFromCursor(struct iovec      *iovecs,
+                         int                maxNumIovecs,
+                         const BlobCursor&  cursor,
+                         const bdlbb::Blob& blob,
+                         int                length)
+    // Load into the specified 'iovecs' array, having the specified
+    // 'maxNumIovecs' elements, the descriptions of the memory regions holding
+    // the specified 'length' bytes of the specified 'blob' that start at the
+    // position of the specified 'cursor', and return the number of elements
+    // loaded.
+{
+    int index     = cursor.index();
+    int numIovecs = 0;
+
+    if (0 < length) {
+        const int n = bsl::min(cursor.numContiguousBytes(), length);
+
+        iovecs[0].iov_base = cursor.data();
+        iovecs[0].iov_len  = n;
+        numIovecs          = 1;
+        length            -= n;
+        ++index;
+    }
+
+    while (0 < length && numIovecs < maxNumIovecs) {
+        const bdlbb::BlobBuffer& buffer = blob.buffer(index++);
+        if (0 == buffer.size()) {
+            continue;                                               // CONTINUE
+        }
+
+        const int n = bsl::min(buffer.size(), length);
+
+        iovecs[numIovecs].iov_base = buffer.data();
+        iovecs[numIovecs].iov_len  = n;
+        ++numIovecs;
+        length -= n;
+    }
+
+    return numIovecs;
+}
+
+ssize_t transferIovecs(FileDescriptor      descriptor,
+                       const struct iovec *iovecs,
+                       int                 numIovecs,
+                       bool                positional,
+                       Offset              fileOffset,
+                       Direction           direction)
+    // Transfer data in the specified 'direction' between the file with the
+    // specified 'descriptor' and the memory described by the specified
+    // 'numIovecs' elements of the specified 'iovecs' array, at the specified
+    // 'fileOffset' if the specified 'positional' is 'true' and at the file
+    // pointer of 'descriptor' otherwise.  Return the number of bytes
+    // transferred, or a negative value if an error occurred before any bytes
+    // were transferred.
+{
+    if (!positional) {
+        return e_READ == direction
+               ? ::readv(descriptor, iovecs, numIovecs)
+               : ::writev(descriptor, iovecs, numIovecs);             // RETURN
+    }
+
+#if defined(U_HAS_PREADV)
+    return e_READ == direction
+           ? ::preadv(descriptor, iovecs, numIovecs, fileOffset)
+           : ::pwritev(descriptor, iovecs, numIovecs, fileOffset);
+#else
+    ssize_t total = 0;
+    for (int i = 0; i < numIovecs; ++i) {
+        const ssize_t rc = e_READ == direction
+                           ? U_PREAD(descriptor,
+                                     iovecs[i].iov_base,
+                                     iovecs[i].iov_len,
+                                     fileOffset + total)
+                           : U_PWRITE(descriptor,
+                                      iovecs[i].iov_base,
+                                      iovecs[i].iov_len,
+                                      fileOffset + total);
+        if (rc < 0) {
+            return 0 < total ? total : rc;                            // RETURN
+        }
+
+        total += rc;
+
+        if (rc < static_cast<ssize_t>(iovecs[i].iov_len)) {
+            break;
+        }
+    }
+    return total;
+#endif
+}
+
+#endif
+
+int transfer(FileDescriptor     descriptor,
+             const bdlbb::Blob& blob,
+             int                offset,
+             int                length,
+             bool               positional,
+             Offset             fileOffset,
+             Direction          direction)
+    // Transfer in the specified 'direction' the bytes in the range
+    // '[offset, offset + length)' of the data of the specified 'blob' between
+    // that blob and the file with the specified 'descriptor', at the
+    // specified 'fileOffset' if the specified 'positional' is 'true' and at
+    // the file pointer of 'descriptor' otherwise.  Return the number of bytes
+    // transferred if that number is positive or no error occurred, and a
+    // negative value otherwise.
+{
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    BlobCursor cursor(&blob, offset);
+    int        total = 0;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    while (total < length) {
+        const DWORD numBytes = static_cast<DWORD>(
+                             bsl::min(cursor.numContiguousBytes(),
+                                      length - total));
+        OVERLAPPED  overlapped  = OVERLAPPED();
+        OVERLAPPED *overlappedP = 0;
+        if (positional) {
+            const Offset position = fileOffset + total;
+
+            overlapped.Offset     = static_cast<DWORD>(position);
+            overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+            overlappedP           = &overlapped;
+        }
+
+        DWORD n  = 0;
+        BOOL  ok = e_READ == direction
+                   ? ReadFile(descriptor,
+                              cursor.data(),
+                              numBytes,
+                              &n,
+                              overlappedP)
+                   : WriteFile(descriptor,
+                               cursor.data(),
+                               numBytes,
+                               &n,
+                               overlappedP);
+        if (!ok) {
+            return 0 < total ? total : -1;                            // RETURN
+        }
+
+        total += static_cast<int>(n);
+        if (n < numBytes) {
+            break;
+        }
+        cursor.advance(static_cast<int>(n));
+    }
+#else
+    struct iovec iovecs[k_MAX_NUM_IOVECS];
+
+    while (total < length) {
+        const int numIovecs = loadIovecsFromCursor(iovecs,
+                                                   k_MAX_NUM_IOVECS,
+                                                   cursor,
+                                                   blob,
+                                                   length - total);
+
+        const ssize_t rc = transferIovecs(descriptor,
+                                          iovecs,
+                                          numIovecs,
+                                          positional,
+                                          fileOffset + total,
+                                          direction);
+        if (rc < 0) {
+            if (EINTR == errno) {
+                continue;                                           // CONTINUE
+            }
+            return 0 < total ? total : -1;                            // RETURN
+        }
+
+        if (0 == rc) {
+            break;
+        }
+
+        total += static_cast<int>(rc);
+        cursor.advance(static_cast<int>(rc));
+    }
+#endif
+
+    return total;
+}
+
+int readIntoBlob(FileDescriptor  descriptor,
+                 bdlbb::Blob    *blob,
+                 int             numBytes,
+                 bool            positional,
+                 Offset          fileOffset)
+    // Read the specified 'numBytes' bytes from the file with the specified
+    // 'descriptor', at the specified 'fileOffset' if the specified
+    // 'positional' is 'true' and at the file pointer of 'descriptor'
+    // otherwise, and append them to the data of the specified 'blob'.  Return
+    // the number of bytes read if that number is positive or no error
+    // occurred, and a negative value otherwise.
+{
+    const int oldLength = blob->length();
+
+    // Grow the blob, through its factory if needed, to hold the data to be
+    // read, and then shrink it to the data actually read.
+
+    blob->setLength(oldLength + numBytes);
+
+    const int rc = transfer(descriptor,
+                            *blob,
+                            oldLength,
+                            numBytes,
+                            positional,
+                            fileOffset,
+                            e_READ);
+
+    blob->setLength(oldLength + (0 < rc ? rc : 0));
+
+    return rc;
+}
+
+}  // close unnamed namespace
+
+namespace bdls {
+
+                              // -----------------
+                              // struct BlobIoUtil
+                              // -----------------
+
+// CLASS METHODS
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+int BlobIoUtil::loadIovecs(struct iovec       *iovecs,
+                           int                 maxNumIovecs,
+                           const bdlbb::Blob&  blob,
+                           int                 offset,
+                           int                 length)
+{
+    BSLS_ASSERT(iovecs);
+    BSLS_ASSERT(0 < maxNumIovecs);
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(offset <= blob.length() - length);
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    return loadIovecsFromCursor(iovecs,
+                                maxNumIovecs,
+                                BlobCursor(&blob, offset),
+                                blob,
+                                length);
+}
+#endif
+
+int BlobIoUtil::read(FileDescriptor  descriptor,
+                     bdlbb::Blob    *blob,
+                     int             numBytes)
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(0 <= numBytes);
+
+    return readIntoBlob(descriptor, blob, numBytes, false, 0);
+}
+
+int BlobIoUtil::readAt(FileDescriptor  descriptor,
+                       bdlbb::Blob    *blob,
+                       int             numBytes,
+                       Offset          fileOffset)
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(0 <= fileOffset);
+
+    return readIntoBlob(descriptor, blob, numBytes, true, fileOffset);
+}
+
+int BlobIoUtil::write(FileDescriptor      descriptor,
+                      const bdlbb::Blob&  blob,
+                      int                 offset,
+                      int                 length)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(offset <= blob.length() - length);
+
+    return transfer(descriptor, blob, offset, length, false, 0, e_WRITE);
+}
+
+int BlobIoUtil::writeAt(FileDescriptor      descriptor,
+                        const bdlbb::Blob&  blob,
+                        int                 offset,
+                        int                 length,
+                        Offset              fileOffset)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(offset <= blob.length() - length);
+    BSLS_ASSERT(0 <= fileOffset);
+
+    return transfer(descriptor,
+                    blob,
+                    offset,
+                    length,
+                    true,
+                    fileOffset,
+                    e_WRITE);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
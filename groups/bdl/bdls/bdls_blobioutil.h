@@ -0,0 +1,279 @@
+// bdls_blobioutil.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLS_BLOBIOUTIL
+#define INCLUDED_BDLS_BLOBIOUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide scatter/gather I/O between blobs and file descriptors.
+//
+//@CLASSES:
+//  bdls::BlobIoUtil: namespace for scatter/gather I/O on 'bdlbb::Blob' data
+//
+//@SEE_ALSO: bdls_filesystemutil, bdlbb_blob, bdlbb_blobutil
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdls::BlobIoUtil', that
+// serves as a namespace for functions that transfer the data of a
+// 'bdlbb::Blob' to and from a 'bdls::FilesystemUtil::FileDescriptor' without
+// first copying that data into a contiguous buffer.
+//
+// A 'bdlbb::Blob' holds its data in a sequence of buffers.  Writing a blob
+// with 'bdls::FilesystemUtil::write' requires either one system call per blob
+// buffer or a copy of the blob's data into a single buffer.  On POSIX systems
+// the functions in this component instead describe a range of the blob's data
+// as an array of 'iovec' structures and transfer the whole range with a single
+// 'writev', 'readv', 'pwritev', or 'preadv' system call (or a few such calls,
+// if the range spans more buffers than one call accepts).  The
+// 'loadIovecs' function exposes this mapping for clients that wish to issue
+// their own system calls (e.g., 'sendmsg' on a socket).
+//
+// The 'read' and 'readAt' functions append the data read to the blob,
+// obtaining any additional buffers needed from the blob's
+// 'bdlbb::BlobBufferFactory'.
+//
+///Return Values
+///-------------
+// The 'read', 'readAt', 'write', and 'writeAt' functions transfer data until
+// the requested number of bytes has been transferred, the end of the file is
+// reached (for reads), no further progress can be made (for writes), or an
+// error occurs.  Interrupted system calls are restarted.  They return the
+// number of bytes transferred if that number is positive or no error
+// occurred, and a negative value if an error occurred before any data was
+// transferred.  Note that, as with the functions of 'bdls::FilesystemUtil',
+// these functions block until the transfer is complete when 'descriptor'
+// refers to a blocking socket or pipe.
+//
+///Platform-Specific Behavior
+///--------------------------
+// Windows does not provide vectored I/O for arbitrary buffers, and therefore
+// on Windows the functions of this component perform one 'ReadFile' or
+// 'WriteFile' call per blob buffer.  'loadIovecs' is not available on
+// Windows.  On POSIX systems that do not provide 'preadv' and 'pwritev', the
+// 'readAt' and 'writeAt' functions perform one 'pread' or 'pwrite' call per
+// blob buffer.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Appending Records to a Journal File
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a journal file to which we append records that
+// have been assembled in a 'bdlbb::Blob', and from which we later read them
+// back.
+//
+// First, we create a blob buffer factory that supplies small buffers, so that
+// our record spans several buffers, and a blob holding the record:
+//..
+//  bdlbb::PooledBlobBufferFactory factory(16);
+//  bdlbb::Blob                    record(&factory);
+//
+//  const char DATA[] = "A journal record that spans several blob buffers.";
+//  const int  LENGTH = static_cast<int>(sizeof DATA) - 1;
+//
+//  bdlbb::BlobUtil::append(&record, DATA, LENGTH);
+//  assert(1 < record.numDataBuffers());
+//..
+// Then, we create a journal file:
+//..
+//  typedef bdls::FilesystemUtil Util;
+//
+//  bsl::string          path;
+//  Util::FileDescriptor fd = Util::createTemporaryFile(&path, "journal");
+//  assert(Util::k_INVALID_FD != fd);
+//..
+// Next, we append the record to the journal.  All of the record's buffers are
+// written by a single system call:
+//..
+//  int rc = bdls::BlobIoUtil::write(fd, record);
+//  assert(LENGTH == rc);
+//..
+// Then, we read the record back from the start of the journal into a new
+// blob, which obtains its buffers from 'factory':
+//..
+//  bdlbb::Blob input(&factory);
+//
+//  rc = bdls::BlobIoUtil::readAt(fd, &input, LENGTH, 0);
+//  assert(LENGTH == rc);
+//  assert(LENGTH == input.length());
+//  assert(0      == bdlbb::BlobUtil::compare(record, input));
+//..
+// Finally, we close and remove the journal file:
+//..
+//  Util::close(fd);
+//  Util::remove(path);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bdlbb_blob.h>
+
+#include <bsls_platform.h>
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+struct iovec;
+#endif
+
+namespace BloombergLP {
+namespace bdls {
+
+                              // =================
+                              // struct BlobIoUtil
+                              // =================
+
+struct BlobIoUtil {
+    // This 'struct' provides a namespace for functions that transfer the data
+    // of a 'bdlbb::Blob' to and from a file descriptor using scatter/gather
+    // I/O.
+
+    // TYPES
+    typedef FilesystemUtil::FileDescriptor FileDescriptor;
+        // 'FileDescriptor' is an alias for the operating system's native file
+        // descriptor / file handle type.
+
+    typedef FilesystemUtil::Offset         Offset;
+        // 'Offset' is an alias for a signed value, representing the offset of
+        // a location within a file.
+
+    // CLASS METHODS
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+    static int loadIovecs(struct iovec       *iovecs,
+                          int                 maxNumIovecs,
+                          const bdlbb::Blob&  blob,
+                          int                 offset,
+                          int                 length);
+        // Load into the specified 'iovecs' array, having the specified
+        // 'maxNumIovecs' elements, the descriptions of the consecutive memory
+        // regions that hold the bytes in the range '[offset, offset + length)'
+        // of the data of the specified 'blob', and return the number of
+        // elements loaded.  If the range spans more than 'maxNumIovecs' blob
+        // buffers, only the first 'maxNumIovecs' regions are loaded, and the
+        // loaded elements describe a prefix of the range.  The behavior is
+        // undefined unless '0 < maxNumIovecs', '0 <= offset', '0 <= length',
+        // and 'offset + length <= blob.length()'.  Note that the loaded
+        // elements refer to the buffers of 'blob', and remain valid only as
+        // long as those buffers are held by 'blob'.  Also note that no
+        // elements are loaded if 'length' is 0.
+#endif
+
+    static int read(FileDescriptor  descriptor,
+                    bdlbb::Blob    *blob,
+                    int             numBytes);
+        // Read the specified 'numBytes' bytes beginning at the file pointer
+        // of the file with the specified 'descriptor', and append them to the
+        // data of the specified 'blob', growing 'blob' through its blob buffer
+        // factory as needed.  Return 'numBytes' on success, the number of
+        // bytes read if the end of the file was reached or an error occurred
+        // after some bytes were read, and a negative value if an error
+        // occurred before any bytes were read.  On return, the length of
+        // 'blob' is increased by the number of bytes read.  The behavior is
+        // undefined unless '0 <= numBytes', and 'blob' was supplied a blob
+        // buffer factory at construction if it does not have sufficient
+        // capacity to hold 'numBytes' additional bytes.  Note that the unused
+        // capacity of 'blob' is retained if fewer than 'numBytes' bytes are
+        // read.
+
+    static int readAt(FileDescriptor  descriptor,
+                      bdlbb::Blob    *blob,
+                      int             numBytes,
+                      Offset          fileOffset);
+        // Read the specified 'numBytes' bytes beginning at the specified
+        // 'fileOffset' of the file with the specified 'descriptor', and append
+        // them to the data of the specified 'blob', growing 'blob' through its
+        // blob buffer factory as needed.  Return 'numBytes' on success, the
+        // number of bytes read if the end of the file was reached or an error
+        // occurred after some bytes were read, and a negative value if an
+        // error occurred before any bytes were read.  On return, the length of
+        // 'blob' is increased by the number of bytes read.  The file pointer
+        // of 'descriptor' is not changed on POSIX systems, and is unspecified
+        // on Windows.  The behavior is undefined unless '0 <= numBytes',
+        // '0 <= fileOffset', 'descriptor' refers to a file capable of seeking,
+        // and 'blob' was supplied a blob buffer factory at construction if it
+        // does not have sufficient capacity to hold 'numBytes' additional
+        // bytes.
+
+    static int write(FileDescriptor descriptor, const bdlbb::Blob& blob);
+    static int write(FileDescriptor      descriptor,
+                     const bdlbb::Blob&  blob,
+                     int                 offset,
+                     int                 length);
+        // Write the data of the specified 'blob' to the file with the
+        // specified 'descriptor', beginning at the file pointer of that file.
+        // Optionally specify 'offset' and 'length' to write only the bytes in
+        // the range '[offset, offset + length)' of the data of 'blob'.  Return
+        // the number of bytes requested to be written on success, the number
+        // of bytes written if space was exhausted or an error occurred after
+        // some bytes were written, and a negative value if an error occurred
+        // before any bytes were written.  The behavior is undefined unless
+        // '0 <= offset', '0 <= length', and
+        // 'offset + length <= blob.length()'.
+
+    static int writeAt(FileDescriptor     descriptor,
+                       const bdlbb::Blob& blob,
+                       Offset             fileOffset);
+    static int writeAt(FileDescriptor      descriptor,
+                       const bdlbb::Blob&  blob,
+                       int                 offset,
+                       int                 length,
+                       Offset              fileOffset);
+        // Write the data of the specified 'blob' to the file with the
+        // specified 'descriptor', beginning at the specified 'fileOffset' of
+        // that file.  Optionally specify 'offset' and 'length' to write only
+        // the bytes in the range '[offset, offset + length)' of the data of
+        // 'blob'.  Return the number of bytes requested to be written on
+        // success, the number of bytes written if space was exhausted or an
+        // error occurred after some bytes were written, and a negative value
+        // if an error occurred before any bytes were written.  The file
+        // pointer of 'descriptor' is not changed on POSIX systems, and is
+        // unspecified on Windows.  The behavior is undefined unless
+        // '0 <= offset', '0 <= length', 'offset + length <= blob.length()',
+        // '0 <= fileOffset', and 'descriptor' refers to a file capable of
+        // seeking.  Note that 'descriptor' should not have been opened in
+        // append mode, as some platforms ignore 'fileOffset' in that case.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // -----------------
+                              // struct BlobIoUtil
+                              // -----------------
+
+// CLASS METHODS
+inline
+int BlobIoUtil::write(FileDescriptor descriptor, const bdlbb::Blob& blob)
+{
+    return write(descriptor, blob, 0, blob.length());
+}
+
+inline
+int BlobIoUtil::writeAt(FileDescriptor     descriptor,
+                        const bdlbb::Blob& blob,
+                        Offset             fileOffset)
+{
+    return writeAt(descriptor, blob, 0, blob.length(), fileOffset);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,837 @@
+// bdls_blobioutil.t.cpp                                              -*-C++-*-
+#include <bdls_blobioutil.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+# include <sys/uio.h>
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility that transfers the data of a blob to
+// and from a file descriptor.  Each function is tested by transferring data
+// held in blobs having a variety of buffer sizes, including blobs having more
+// buffers than a single system call accepts, to and from a temporary file, and
+// comparing the result with the data transferred by 'bdls::FilesystemUtil'.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int loadIovecs(iovec *, int, const Blob&, int, int);
+// [ 4] int read(FileDescriptor, Blob *, int);
+// [ 4] int readAt(FileDescriptor, Blob *, int, Offset);
+// [ 3] int write(FileDescriptor, const Blob&);
+// [ 3] int write(FileDescriptor, const Blob&, int, int);
+// [ 3] int writeAt(FileDescriptor, const Blob&, Offset);
+// [ 3] int writeAt(FileDescriptor, const Blob&, int, int, Offset);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdls::BlobIoUtil     Obj;
+typedef bdls::FilesystemUtil FileUtil;
+
+const int BUFFER_SIZES[] = { 1, 2, 3, 7, 16, 100, 4096 };
+const int NUM_BUFFER_SIZES = static_cast<int>(sizeof BUFFER_SIZES
+                                              / sizeof *BUFFER_SIZES);
+    // buffer sizes of the blob buffer factories used in testing
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+char patternByte(int position)
+    // Return the byte at the specified 'position' of the test data pattern.
+{
+    return static_cast<char>('a' + (position * 7 + position / 26) % 26);
+}
+
+void loadPattern(bsl::string *result, int length)
+    // Load into the specified 'result' the first specified 'length' bytes of
+    // the test data pattern.
+{
+    result->resize(length);
+    for (int i = 0; i < length; ++i) {
+        (*result)[i] = patternByte(i);
+    }
+}
+
+bsl::string blobToString(const bdlbb::Blob& blob)
+    // Return a string holding the data of the specified 'blob'.
+{
+    bsl::string result(blob.length(), '\0');
+    if (0 < blob.length()) {
+        bdlbb::BlobUtil::copy(&result[0], blob, 0, blob.length());
+    }
+    return result;
+}
+
+bsl::string fileContents(FileUtil::FileDescriptor fd)
+    // Return the contents of the file with the specified 'fd'.  Note that the
+    // file pointer of 'fd' is moved to the end of the file.
+{
+    const FileUtil::Offset size = FileUtil::getFileSize(fd);
+    bsl::string            result(static_cast<bsl::size_t>(size), '\0');
+
+    FileUtil::seek(fd, 0, FileUtil::e_SEEK_FROM_BEGINNING);
+    if (0 < size) {
+        const int rc = FileUtil::read(fd, &result[0], static_cast<int>(size));
+        ASSERTV(rc, size, size == rc);
+    }
+    return result;
+}
+
+void truncateFile(FileUtil::FileDescriptor *fd, const bsl::string& path)
+    // Reopen the file at the specified 'path', whose descriptor is the
+    // specified 'fd', with its contents truncated, and load the new
+    // descriptor into 'fd'.
+{
+    FileUtil::close(*fd);
+    *fd = FileUtil::open(path,
+                         FileUtil::e_OPEN,
+                         FileUtil::e_READ_WRITE,
+                         FileUtil::e_TRUNCATE);
+    ASSERT(FileUtil::k_INVALID_FD != *fd);
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    bslma::TestAllocator ta("test", veryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Appending Records to a Journal File
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a journal file to which we append records that
+// have been assembled in a 'bdlbb::Blob', and from which we later read them
+// back.
+//
+// First, we create a blob buffer factory that supplies small buffers, so that
+// our record spans several buffers, and a blob holding the record:
+//..
+    bdlbb::PooledBlobBufferFactory factory(16);
+    bdlbb::Blob                    record(&factory);
+
+    const char DATA[] = "A journal record that spans several blob buffers.";
+    const int  LENGTH = static_cast<int>(sizeof DATA) - 1;
+
+    bdlbb::BlobUtil::append(&record, DATA, LENGTH);
+    ASSERT(1 < record.numDataBuffers());
+//..
+// Then, we create a journal file:
+//..
+    typedef bdls::FilesystemUtil Util;
+
+    bsl::string          path;
+    Util::FileDescriptor fd = Util::createTemporaryFile(&path, "journal");
+    ASSERT(Util::k_INVALID_FD != fd);
+//..
+// Next, we append the record to the journal.  All of the record's buffers are
+// written by a single system call:
+//..
+    int rc = bdls::BlobIoUtil::write(fd, record);
+    ASSERT(LENGTH == rc);
+//..
+// Then, we read the record back from the start of the journal into a new
+// blob, which obtains its buffers from 'factory':
+//..
+    bdlbb::Blob input(&factory);
+
+    rc = bdls::BlobIoUtil::readAt(fd, &input, LENGTH, 0);
+    ASSERT(LENGTH == rc);
+    ASSERT(LENGTH == input.length());
+    ASSERT(0      == bdlbb::BlobUtil::compare(record, input));
+//..
+// Finally, we close and remove the journal file:
+//..
+    Util::close(fd);
+    Util::remove(path);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'read' AND 'readAt'
+        //
+        // Concerns:
+        //: 1 'read' reads the requested number of bytes starting at the file
+        //:   pointer, appends them to the data of the blob, advances the file
+        //:   pointer past them, and returns the number of bytes read.
+        //:
+        //: 2 'readAt' reads the requested number of bytes starting at the
+        //:   specified file offset, and does not move the file pointer.
+        //:
+        //: 3 The blob is grown through its factory as needed, and the data it
+        //:   held before the call is unchanged.
+        //:
+        //: 4 If the end of the file is reached, the number of bytes read is
+        //:   returned, and the length of the blob is increased by only that
+        //:   number.
+        //:
+        //: 5 If an error occurs before any bytes are read, a negative value is
+        //:   returned and the length of the blob is unchanged.
+        //:
+        //: 6 Reads spanning more blob buffers than a single system call
+        //:   accepts are performed correctly.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Write a known pattern to a temporary file.  For each of a set of
+        //:   blob buffer sizes, initial blob lengths, file offsets, and read
+        //:   lengths (including lengths extending past the end of the file),
+        //:   read from the file into a blob using 'read' and 'readAt', and
+        //:   verify the return value, the data of the blob, and the file
+        //:   pointer.  (C-1..4, 6)
+        //:
+        //: 2 Read from an invalid file descriptor and verify the result.
+        //:   (C-5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   int read(FileDescriptor, Blob *, int);
+        //   int readAt(FileDescriptor, Blob *, int, Offset);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'read' AND 'readAt'" << endl
+                          << "===================" << endl;
+
+        const int FILE_LENGTH = 1000;
+
+        bsl::string pattern(&ta);
+        loadPattern(&pattern, FILE_LENGTH);
+
+        bsl::string              path(&ta);
+        FileUtil::FileDescriptor fd = FileUtil::createTemporaryFile(
+                                                  &path,
+                                                  "tmp.bdls_blobioutil.read");
+        ASSERT(FileUtil::k_INVALID_FD != fd);
+        ASSERT(FILE_LENGTH == FileUtil::write(fd,
+                                              pattern.data(),
+                                              FILE_LENGTH));
+
+        const int INITIAL_LENGTHS[] = { 0, 1, 5, 17 };
+        const int NUM_INITIAL_LENGTHS = static_cast<int>(
+                       sizeof INITIAL_LENGTHS / sizeof *INITIAL_LENGTHS);
+
+        const int FILE_OFFSETS[] = { 0, 1, 499, 990, 1000 };
+        const int NUM_FILE_OFFSETS = static_cast<int>(
+                             sizeof FILE_OFFSETS / sizeof *FILE_OFFSETS);
+
+        const int READ_LENGTHS[] = { 0, 1, 2, 10, 200, 1000 };
+        const int NUM_READ_LENGTHS = static_cast<int>(
+                             sizeof READ_LENGTHS / sizeof *READ_LENGTHS);
+
+        for (int bi = 0; bi < NUM_BUFFER_SIZES; ++bi) {
+            const int BUFFER_SIZE = BUFFER_SIZES[bi];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+
+        for (int ii = 0; ii < NUM_INITIAL_LENGTHS; ++ii) {
+            const int INITIAL_LENGTH = INITIAL_LENGTHS[ii];
+
+        for (int fi = 0; fi < NUM_FILE_OFFSETS; ++fi) {
+            const int FILE_OFFSET = FILE_OFFSETS[fi];
+
+        for (int ri = 0; ri < NUM_READ_LENGTHS; ++ri) {
+            const int READ_LENGTH = READ_LENGTHS[ri];
+
+            const int EXP_RC = bsl::min(READ_LENGTH,
+                                        FILE_LENGTH - FILE_OFFSET);
+
+            const bsl::string INITIAL(INITIAL_LENGTH, 'Z', &ta);
+            const bsl::string EXP_DATA = INITIAL
+                                       + pattern.substr(FILE_OFFSET, EXP_RC);
+
+            if (veryVerbose) {
+                P_(BUFFER_SIZE) P_(INITIAL_LENGTH) P_(FILE_OFFSET)
+                P(READ_LENGTH)
+            }
+
+            {
+                bdlbb::Blob blob(&factory, &ta);
+                bdlbb::BlobUtil::append(&blob,
+                                        INITIAL.data(),
+                                        INITIAL_LENGTH);
+
+                ASSERT(FILE_OFFSET == FileUtil::seek(
+                                           fd,
+                                           FILE_OFFSET,
+                                           FileUtil::e_SEEK_FROM_BEGINNING));
+
+                const int rc = Obj::read(fd, &blob, READ_LENGTH);
+
+                ASSERTV(BUFFER_SIZE, INITIAL_LENGTH, FILE_OFFSET, READ_LENGTH,
+                        rc, EXP_RC == rc);
+                ASSERTV(BUFFER_SIZE, INITIAL_LENGTH, FILE_OFFSET, READ_LENGTH,
+                        EXP_DATA == blobToString(blob));
+                ASSERTV(BUFFER_SIZE, INITIAL_LENGTH, FILE_OFFSET, READ_LENGTH,
+                        FILE_OFFSET + EXP_RC == FileUtil::seek(
+                                             fd,
+                                             0,
+                                             FileUtil::e_SEEK_FROM_CURRENT));
+            }
+
+            {
+                bdlbb::Blob blob(&factory, &ta);
+                bdlbb::BlobUtil::append(&blob,
+                                        INITIAL.data(),
+                                        INITIAL_LENGTH);
+
+                ASSERT(3 == FileUtil::seek(fd,
+                                           3,
+                                           FileUtil::e_SEEK_FROM_BEGINNING));
+
+                const int rc = Obj::readAt(fd,
+                                           &blob,
+                                           READ_LENGTH,
+                                           FILE_OFFSET);
+
+                ASSERTV(BUFFER_SIZE, INITIAL_LENGTH, FILE_OFFSET, READ_LENGTH,
+                        rc, EXP_RC == rc);
+                ASSERTV(BUFFER_SIZE, INITIAL_LENGTH, FILE_OFFSET, READ_LENGTH,
+                        EXP_DATA == blobToString(blob));
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+                ASSERTV(BUFFER_SIZE, INITIAL_LENGTH, FILE_OFFSET, READ_LENGTH,
+                        3 == FileUtil::seek(fd,
+                                            0,
+                                            FileUtil::e_SEEK_FROM_CURRENT));
+#endif
+            }
+        }
+        }
+        }
+        }
+
+        if (verbose) cout << "\tTesting an invalid descriptor." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            bdlbb::BlobUtil::append(&blob, "abc", 3);
+
+            ASSERT(0 > Obj::read(FileUtil::k_INVALID_FD, &blob, 100));
+            ASSERT(3 == blob.length());
+            ASSERT(0 > Obj::readAt(FileUtil::k_INVALID_FD, &blob, 100, 0));
+            ASSERT(3 == blob.length());
+            ASSERT("abc" == blobToString(blob));
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            ASSERT_PASS(Obj::read(fd, &blob, 0));
+            ASSERT_FAIL(Obj::read(fd, 0, 0));
+            ASSERT_FAIL(Obj::read(fd, &blob, -1));
+
+            ASSERT_PASS(Obj::readAt(fd, &blob, 0, 0));
+            ASSERT_FAIL(Obj::readAt(fd, 0, 0, 0));
+            ASSERT_FAIL(Obj::readAt(fd, &blob, -1, 0));
+            ASSERT_FAIL(Obj::readAt(fd, &blob, 0, -1));
+        }
+
+        FileUtil::close(fd);
+        FileUtil::remove(path);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'write' AND 'writeAt'
+        //
+        // Concerns:
+        //: 1 'write' writes the requested range of the data of the blob
+        //:   starting at the file pointer, advances the file pointer past it,
+        //:   and returns the number of bytes written.
+        //:
+        //: 2 'writeAt' writes the requested range of the data of the blob
+        //:   starting at the specified file offset, and does not move the file
+        //:   pointer.
+        //:
+        //: 3 The overloads not taking a range write all of the data of the
+        //:   blob.
+        //:
+        //: 4 Writes spanning more blob buffers than a single system call
+        //:   accepts are performed correctly.
+        //:
+        //: 5 If an error occurs before any bytes are written, a negative value
+        //:   is returned.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each of a set of blob buffer sizes, blob lengths, and ranges
+        //:   of the data of the blob, write the range to an empty temporary
+        //:   file using 'write' and 'writeAt', and verify the return value,
+        //:   the file contents, and the file pointer.  (C-1..4)
+        //:
+        //: 2 Write to an invalid file descriptor and verify the result.  (C-5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int write(FileDescriptor, const Blob&);
+        //   int write(FileDescriptor, const Blob&, int, int);
+        //   int writeAt(FileDescriptor, const Blob&, Offset);
+        //   int writeAt(FileDescriptor, const Blob&, int, int, Offset);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'write' AND 'writeAt'" << endl
+                          << "=====================" << endl;
+
+        bsl::string              path(&ta);
+        FileUtil::FileDescriptor fd = FileUtil::createTemporaryFile(
+                                                 &path,
+                                                 "tmp.bdls_blobioutil.write");
+        ASSERT(FileUtil::k_INVALID_FD != fd);
+
+        const int BLOB_LENGTHS[] = { 0, 1, 15, 16, 17, 300 };
+        const int NUM_BLOB_LENGTHS = static_cast<int>(
+                             sizeof BLOB_LENGTHS / sizeof *BLOB_LENGTHS);
+
+        const int FILE_OFFSET = 5;
+
+        for (int bi = 0; bi < NUM_BUFFER_SIZES; ++bi) {
+            const int BUFFER_SIZE = BUFFER_SIZES[bi];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+
+        for (int li = 0; li < NUM_BLOB_LENGTHS; ++li) {
+            const int BLOB_LENGTH = BLOB_LENGTHS[li];
+
+            bsl::string pattern(&ta);
+            loadPattern(&pattern, BLOB_LENGTH);
+
+            bdlbb::Blob blob(&factory, &ta);
+            bdlbb::BlobUtil::append(&blob, pattern.data(), BLOB_LENGTH);
+
+            if (veryVerbose) { P_(BUFFER_SIZE) P(BLOB_LENGTH) }
+
+            // Whole blob.
+
+            truncateFile(&fd, path);
+            ASSERTV(BUFFER_SIZE, BLOB_LENGTH,
+                    BLOB_LENGTH == Obj::write(fd, blob));
+            ASSERTV(BUFFER_SIZE, BLOB_LENGTH,
+                    BLOB_LENGTH == FileUtil::seek(
+                                             fd,
+                                             0,
+                                             FileUtil::e_SEEK_FROM_CURRENT));
+            ASSERTV(BUFFER_SIZE, BLOB_LENGTH, pattern == fileContents(fd));
+
+            truncateFile(&fd, path);
+            ASSERTV(BUFFER_SIZE, BLOB_LENGTH,
+                    BLOB_LENGTH == Obj::writeAt(fd, blob, FILE_OFFSET));
+            {
+                const bsl::string EXP = 0 == BLOB_LENGTH
+                                      ? bsl::string()
+                                      : bsl::string(FILE_OFFSET, '\0')
+                                        + pattern;
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+                ASSERTV(BUFFER_SIZE, BLOB_LENGTH,
+                        0 == FileUtil::seek(fd,
+                                            0,
+                                            FileUtil::e_SEEK_FROM_CURRENT));
+#endif
+                ASSERTV(BUFFER_SIZE, BLOB_LENGTH, EXP == fileContents(fd));
+            }
+
+            // Every range.
+
+            for (int offset = 0; offset <= BLOB_LENGTH; ++offset) {
+                for (int length = 0;
+                     length <= BLOB_LENGTH - offset;
+                     length += 1 + length / 4) {
+                    const bsl::string EXP = pattern.substr(offset, length);
+
+                    truncateFile(&fd, path);
+                    int rc = Obj::write(fd, blob, offset, length);
+                    ASSERTV(BUFFER_SIZE, BLOB_LENGTH, offset, length, rc,
+                            length == rc);
+                    ASSERTV(BUFFER_SIZE, BLOB_LENGTH, offset, length,
+                            EXP == fileContents(fd));
+
+                    truncateFile(&fd, path);
+                    rc = Obj::writeAt(fd, blob, offset, length, 0);
+                    ASSERTV(BUFFER_SIZE, BLOB_LENGTH, offset, length, rc,
+                            length == rc);
+                    ASSERTV(BUFFER_SIZE, BLOB_LENGTH, offset, length,
+                            EXP == fileContents(fd));
+                }
+            }
+        }
+        }
+
+        if (verbose) cout << "\tTesting an invalid descriptor." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            bdlbb::BlobUtil::append(&blob, "abc", 3);
+
+            ASSERT(0 > Obj::write(FileUtil::k_INVALID_FD, blob));
+            ASSERT(0 > Obj::writeAt(FileUtil::k_INVALID_FD, blob, 0));
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            bdlbb::BlobUtil::append(&blob, "abc", 3);
+            truncateFile(&fd, path);
+
+            ASSERT_PASS(Obj::write(fd, blob, 0, 3));
+            ASSERT_PASS(Obj::write(fd, blob, 3, 0));
+            ASSERT_FAIL(Obj::write(fd, blob, -1, 1));
+            ASSERT_FAIL(Obj::write(fd, blob, 0, -1));
+            ASSERT_FAIL(Obj::write(fd, blob, 1, 3));
+
+            ASSERT_PASS(Obj::writeAt(fd, blob, 0, 3, 0));
+            ASSERT_FAIL(Obj::writeAt(fd, blob, -1, 1, 0));
+            ASSERT_FAIL(Obj::writeAt(fd, blob, 0, -1, 0));
+            ASSERT_FAIL(Obj::writeAt(fd, blob, 1, 3, 0));
+            ASSERT_FAIL(Obj::writeAt(fd, blob, 0, 3, -1));
+        }
+
+        FileUtil::close(fd);
+        FileUtil::remove(path);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'loadIovecs'
+        //
+        // Concerns:
+        //: 1 The loaded elements describe, in order, the memory holding the
+        //:   requested range of the data of the blob, one element per blob
+        //:   buffer spanned by the range.
+        //:
+        //: 2 No more than the specified maximum number of elements are
+        //:   loaded, and the loaded elements then describe a prefix of the
+        //:   range.
+        //:
+        //: 3 No elements are loaded for an empty range.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each of a set of blob buffer sizes, and for every range of
+        //:   the data of a blob and a set of maximum numbers of elements, load
+        //:   the elements and verify that they refer to the expected bytes of
+        //:   the blob, and that the number of elements loaded is as expected.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   int loadIovecs(iovec *, int, const Blob&, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'loadIovecs'" << endl
+                          << "============" << endl;
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+        const int BLOB_LENGTH = 40;
+
+        bsl::string pattern(&ta);
+        loadPattern(&pattern, BLOB_LENGTH);
+
+        for (int bi = 0; bi < NUM_BUFFER_SIZES; ++bi) {
+            const int BUFFER_SIZE = BUFFER_SIZES[bi];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            bdlbb::BlobUtil::append(&blob, pattern.data(), BLOB_LENGTH);
+
+            for (int offset = 0; offset <= BLOB_LENGTH; ++offset) {
+            for (int length = 0; length <= BLOB_LENGTH - offset; ++length) {
+            for (int maxNum = 1; maxNum <= 4; maxNum += 3) {
+                struct iovec iovecs[4];
+
+                const int numIovecs = Obj::loadIovecs(iovecs,
+                                                      maxNum,
+                                                      blob,
+                                                      offset,
+                                                      length);
+
+                // Compute the expected number of elements.
+
+                int expNumIovecs = 0;
+                if (0 < length) {
+                    const int first = offset / BUFFER_SIZE;
+                    const int last  = (offset + length - 1) / BUFFER_SIZE;
+
+                    expNumIovecs = bsl::min(last - first + 1, maxNum);
+                }
+
+                ASSERTV(BUFFER_SIZE, offset, length, maxNum, numIovecs,
+                        expNumIovecs == numIovecs);
+
+                int position = offset;
+                for (int i = 0; i < numIovecs; ++i) {
+                    const int   len  = static_cast<int>(iovecs[i].iov_len);
+                    const char *data = static_cast<const char *>(
+                                                           iovecs[i].iov_base);
+
+                    ASSERTV(BUFFER_SIZE, offset, length, i, len, 0 < len);
+                    ASSERTV(BUFFER_SIZE, offset, length, i,
+                            0 == bsl::memcmp(data,
+                                             pattern.data() + position,
+                                             len));
+
+                    position += len;
+                }
+
+                if (numIovecs < maxNum) {
+                    ASSERTV(BUFFER_SIZE, offset, length, maxNum, position,
+                            offset + length == position);
+                }
+                else {
+                    ASSERTV(BUFFER_SIZE, offset, length, maxNum, position,
+                            offset + length >= position);
+                }
+            }
+            }
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            bdlbb::BlobUtil::append(&blob, "abc", 3);
+
+            struct iovec iovecs[4];
+
+            ASSERT_PASS(Obj::loadIovecs(iovecs, 4, blob, 0, 3));
+            ASSERT_PASS(Obj::loadIovecs(iovecs, 4, blob, 3, 0));
+            ASSERT_FAIL(Obj::loadIovecs(0, 4, blob, 0, 3));
+            ASSERT_FAIL(Obj::loadIovecs(iovecs, 0, blob, 0, 3));
+            ASSERT_FAIL(Obj::loadIovecs(iovecs, 4, blob, -1, 1));
+            ASSERT_FAIL(Obj::loadIovecs(iovecs, 4, blob, 0, -1));
+            ASSERT_FAIL(Obj::loadIovecs(iovecs, 4, blob, 1, 3));
+        }
+#else
+        if (verbose) cout << "\tNot available on Windows." << endl;
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a blob spanning many buffers to a temporary file, read it
+        //:   back into a second blob, and verify that the data is unchanged.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bdlbb::PooledBlobBufferFactory factory(3, &ta);
+        bdlbb::Blob                    blob(&factory, &ta);
+
+        bsl::string pattern(&ta);
+        loadPattern(&pattern, 1000);
+
+        bdlbb::BlobUtil::append(&blob, pattern.data(), 1000);
+        ASSERT(300 < blob.numDataBuffers());
+
+        bsl::string              path(&ta);
+        FileUtil::FileDescriptor fd = FileUtil::createTemporaryFile(
+                                                &path,
+                                                "tmp.bdls_blobioutil.breath");
+        ASSERT(FileUtil::k_INVALID_FD != fd);
+
+        ASSERT(1000 == Obj::write(fd, blob));
+        ASSERT(pattern == fileContents(fd));
+
+        bdlbb::Blob input(&factory, &ta);
+
+        ASSERT(1000 == Obj::readAt(fd, &input, 1000, 0));
+        ASSERT(0    == bdlbb::BlobUtil::compare(blob, input));
+
+        ASSERT(0 == Obj::read(fd, &input, 10));
+        ASSERT(1000 == input.length());
+
+        FileUtil::close(fd);
+        FileUtil::remove(path);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    ASSERTV(defaultAllocator.numBlocksInUse(),
+            0 == defaultAllocator.numBlocksInUse());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2021 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -4,7 +4,12 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id$ $CSID$")
 
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
 
 #include <algorithm>
 #include <cctype>
@@ -12,11 +17,16 @@ BSLS_IDENT("$Id$ $CSID$")
 
 #include <limits.h>
 
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+#include <intrin.h>  // '_umul128'
+#endif
+
 namespace {
 namespace u {
 
 using namespace BloombergLP;
 
+typedef bsls::Types::Int64                           Int64;
 typedef bsls::Types::Uint64                          Uint64;
 
 // 'shiftLookup' is a lookup table for quickly determining the number of digits
@@ -394,6 +404,1914 @@ char *toCharsPowerOf2Base(char          *first,
     return first + length;
 }
 
+
+                       // ==============================
+                       // floating-point support: tables
+                       // ==============================
+
+// 'k_POWERS_OF_TEN' holds, for each 'k' from 'k_SMALLEST_POWER_OF_TEN' to
+// 'k_LARGEST_POWER_OF_TEN', the integer 'g = floor(10^-k * 2^-r) + 1', where
+// 'r' is the unique integer for which '2^125 <= g - 1 < 2^126', split into
+// its high and low 63 bits.  This is the table of the "Schubfach" algorithm
+// (Raffaello Giulietti, "The Schubfach way to render doubles", 2021), which
+// computes the shortest decimal that round-trips to a binary floating-point
+// value.  Note that 'g' is an over-approximation of the scaled '10^-k'; the
+// proof of the algorithm shows that it is close enough to decide every
+// comparison the algorithm makes exactly.
+
+const int k_SMALLEST_POWER_OF_TEN = -324;
+const int k_LARGEST_POWER_OF_TEN  =  292;
+
+const Uint64 k_POWERS_OF_TEN[][2] = {
+    { 0x4F0CEDC95A718DD4ULL, 0x5B01E8B09AA0D1B5ULL },  // -324
+    { 0x7E7B160EF71C1621ULL, 0x119CA780F767B5EEULL },  // -323
+    { 0x652F44D8C5B011B4ULL, 0x0E16EC672C52F7F2ULL },  // -322
+    { 0x50F29D7A37C00E29ULL, 0x581256B8F0425FF5ULL },  // -321
+    { 0x40C21794F96671BAULL, 0x79A84560C0351991ULL },  // -320
+    { 0x679CF287F570B5F7ULL, 0x75DA089ACD21C281ULL },  // -319
+    { 0x52E3F5399126F7F9ULL, 0x44AE6D48A41B0201ULL },  // -318
+    { 0x424FF76140EBF994ULL, 0x36F1F106E9AF34CDULL },  // -317
+    { 0x6A198BCECE465C20ULL, 0x57E981A4A918547BULL },  // -316
+    { 0x54E13CA571D1E34DULL, 0x2CBACE1D541376C9ULL },  // -315
+    { 0x43E763B78E4182A4ULL, 0x23C8A4E44342C56EULL },  // -314
+    { 0x6CA56C58E39C043AULL, 0x060DD4A06B9E08B0ULL },  // -313
+    { 0x56EABD13E9499CFBULL, 0x1E7176E6BC7E6D59ULL },  // -312
+    { 0x458897432107B0C8ULL, 0x7EC12BEBC9FEBDE1ULL },  // -311
+    { 0x6F40F20501A5E7A7ULL, 0x7E01DFDFA9979635ULL },  // -310
+    { 0x5900C19D9AEB1FB9ULL, 0x4B34B319547944F7ULL },  // -309
+    { 0x4733CE17AF227FC7ULL, 0x55C3C27AA9FA9D93ULL },  // -308
+    { 0x71EC7CF2B1D0CC72ULL, 0x560603F7765DC8EAULL },  // -307
+    { 0x5B2397288E40A38EULL, 0x7804CFF92B7E3A55ULL },  // -306
+    { 0x48E945BA0B66E93FULL, 0x13370CC755FE9511ULL },  // -305
+    { 0x74A86F90123E41FEULL, 0x51F1AE0BBCCA881BULL },  // -304
+    { 0x5D538C7341CB67FEULL, 0x74C1580963D539AFULL },  // -303
+    { 0x4AA93D29016F8665ULL, 0x43CDE0078310FAF3ULL },  // -302
+    { 0x77752EA8024C0A3CULL, 0x0616333F381B2B1EULL },  // -301
+    { 0x5F90F22001D66E96ULL, 0x3811C298F9AF55B1ULL },  // -300
+    { 0x4C73F4E667DEBEDEULL, 0x600E35472E25DE28ULL },  // -299
+    { 0x7A532170A6313164ULL, 0x3349EED849D6303FULL },  // -298
+    { 0x61DC1AC084F42783ULL, 0x42A18BE03B11C033ULL },  // -297
+    { 0x4E49AF006A5CEC69ULL, 0x1BB46FE695A7CCF5ULL },  // -296
+    { 0x7D42B19A43C7E0A8ULL, 0x2C53E63DBC3FAE55ULL },  // -295
+    { 0x64355AE1CFD31A20ULL, 0x237651CAFCFFBEAAULL },  // -294
+    { 0x502AAF1B0CA8E1B3ULL, 0x35F8416F30CC9888ULL },  // -293
+    { 0x402225AF3D53E7C2ULL, 0x5E603458F3D6E06DULL },  // -292
+    { 0x669D0918621FD937ULL, 0x4A3386F4B957CD7BULL },  // -291
+    { 0x52173A79E8197A92ULL, 0x6E8F9F2A2DDFD796ULL },  // -290
+    { 0x41AC2EC7ECE12EDBULL, 0x720C7F54F17FDFABULL },  // -289
+    { 0x69137E0CAE3517C6ULL, 0x1CE0CBBB1BFFCC45ULL },  // -288
+    { 0x540F980A24F74638ULL, 0x171A3C95AFFFD69EULL },  // -287
+    { 0x433FACD4EA5F6B60ULL, 0x127B63AAF3331218ULL },  // -286
+    { 0x6B991487DD657899ULL, 0x6A5F05DE51EB5026ULL },  // -285
+    { 0x5614106CB11DFA14ULL, 0x5518D17EA7EF7352ULL },  // -284
+    { 0x44DCD9F08DB194DDULL, 0x2A7A41321FF2C2A8ULL },  // -283
+    { 0x6E2E2980E2B5BAFBULL, 0x5D906850331E043FULL },  // -282
+    { 0x5824EE00B55E2F2FULL, 0x647386A68F4B3699ULL },  // -281
+    { 0x4683F19A2AB1BF59ULL, 0x36C2D21ED908F87BULL },  // -280
+    { 0x70D31C29DDE93228ULL, 0x579E1CFE280E5A5DULL },  // -279
+    { 0x5A427CEE4B20F4EDULL, 0x2C7E7D98200B7B7EULL },  // -278
+    { 0x483530BEA280C3F1ULL, 0x09FECAE019A2C932ULL },  // -277
+    { 0x73884DFDD0CE064EULL, 0x43314499C29E0EB6ULL },  // -276
+    { 0x5C6D0B3173D8050BULL, 0x4F5A9D47CEE4D891ULL },  // -275
+    { 0x49F0D5C129799DA2ULL, 0x72AEE4397250AD41ULL },  // -274
+    { 0x764E22CEA8C295D1ULL, 0x377E39F583B44868ULL },  // -273
+    { 0x5EA4E8A553CEDE41ULL, 0x12CB61913629D387ULL },  // -272
+    { 0x4BB72084430BE500ULL, 0x756F8140F8217605ULL },  // -271
+    { 0x792500D39E796E67ULL, 0x6F18CECE59CF233CULL },  // -270
+    { 0x60EA670FB1FABEB9ULL, 0x3F470BD847D8E8FDULL },  // -269
+    { 0x4D885272F4C89894ULL, 0x329F3CAD064720CAULL },  // -268
+    { 0x7C0D50B7EE0DC0EDULL, 0x37652DE1A3A50143ULL },  // -267
+    { 0x633DDA2CBE716724ULL, 0x2C50F1814FB73436ULL },  // -266
+    { 0x4F64AE8A31F45283ULL, 0x3D0D8E010C92902BULL },  // -265
+    { 0x7F077DA9E986EA6BULL, 0x7B48E334E0EA8045ULL },  // -264
+    { 0x659F97BB2138BB89ULL, 0x49071C2A4D88669DULL },  // -263
+    { 0x514C796280FA2FA1ULL, 0x20D27CEEA46D1EE4ULL },  // -262
+    { 0x4109FAB533FB594DULL, 0x670ECA58838A7F1DULL },  // -261
+    { 0x680FF788532BC216ULL, 0x0B4ADD5A6C10CB62ULL },  // -260
+    { 0x533FF939DC2301ABULL, 0x22A24AAEBCDA3C4EULL },  // -259
+    { 0x4299942E49B59AEFULL, 0x354EA22563E1C9D8ULL },  // -258
+    { 0x6A8F537D42BC2B18ULL, 0x554A9D089FCFA95AULL },  // -257
+    { 0x553F75FDCEFCEF46ULL, 0x776EE406E63FBAAEULL },  // -256
+    { 0x4432C4CB0BFD8C38ULL, 0x5F8BE99F1E996225ULL },  // -255
+    { 0x6D1E07AB466279F4ULL, 0x327975CB64289D08ULL },  // -254
+    { 0x574B3955D1E86190ULL, 0x28612B091CED4A6DULL },  // -253
+    { 0x45D5C777DB204E0DULL, 0x06B4226DB0BDD524ULL },  // -252
+    { 0x6FBC72595E9A167BULL, 0x24536A491AC95506ULL },  // -251
+    { 0x59638EADE54811FCULL, 0x1D0F883A7BD44405ULL },  // -250
+    { 0x4782D88B1DD34196ULL, 0x4A72D361FCA9D004ULL },  // -249
+    { 0x726AF411C952028AULL, 0x43EAEBCFFAA94CD3ULL },  // -248
+    { 0x5B88C3416DDB353BULL, 0x4FEF230CC88770A9ULL },  // -247
+    { 0x493A35CDF17C2A96ULL, 0x0CBF4F3D6D3926EEULL },  // -246
+    { 0x7529EFAFE8C6AA89ULL, 0x61321862485B717CULL },  // -245
+    { 0x5DBB262653D22207ULL, 0x675B46B506AF8DFDULL },  // -244
+    { 0x4AFC1E850FDB4E6CULL, 0x52AF6BC405593E64ULL },  // -243
+    { 0x77F9CA6E7FC54A47ULL, 0x377F12D33BC1FD6DULL },  // -242
+    { 0x5FFB085866376E9FULL, 0x45FF42429634CABDULL },  // -241
+    { 0x4CC8D379EB5F8BB2ULL, 0x6B329B68782A3BCBULL },  // -240
+    { 0x7ADAEBF64565AC51ULL, 0x2B842BDA59DD2C77ULL },  // -239
+    { 0x6248BCC5045156A7ULL, 0x3C69BCAEAE4A89F9ULL },  // -238
+    { 0x4EA0970403744552ULL, 0x6387CA25583BA194ULL },  // -237
+    { 0x7DCDBE6CD253A21EULL, 0x05A6103BC05F68EDULL },  // -236
+    { 0x64A498570EA94E7EULL, 0x37B80CFC99E5ED8AULL },  // -235
+    { 0x5083AD1272210B98ULL, 0x2C933D96E184BE08ULL },  // -234
+    { 0x40695741F4E73C79ULL, 0x7075CADF1AD09807ULL },  // -233
+    { 0x670EF2032171FA5CULL, 0x4D8944982AE759A4ULL },  // -232
+    { 0x52725B35B45B2EB0ULL, 0x3E076A135585E150ULL },  // -231
+    { 0x41F515C49048F226ULL, 0x64D2BB42AAD1810DULL },  // -230
+    { 0x698822D41A0E503EULL, 0x07B7920444826815ULL },  // -229
+    { 0x546CE8A9AE71D9CBULL, 0x1FC60E69D0685344ULL },  // -228
+    { 0x438A53BAF1F4AE3CULL, 0x196B3EBB0D20429DULL },  // -227
+    { 0x6C1085F7E9877D2DULL, 0x0F11FDF815006A94ULL },  // -226
+    { 0x56739E5FEE05FDBDULL, 0x58DB319344005543ULL },  // -225
+    { 0x45294B7FF19E6497ULL, 0x60AF5ADC3666AA9CULL },  // -224
+    { 0x6EA878CCB5CA3A8CULL, 0x344BC4938A3DDDC7ULL },  // -223
+    { 0x5886C70A2B082ED6ULL, 0x5D096A0FA1CB17D2ULL },  // -222
+    { 0x46D238D4EF39BF12ULL, 0x173ABB3FB4A27975ULL },  // -221
+    { 0x71505AEE4B8F981DULL, 0x0B912B992103F588ULL },  // -220
+    { 0x5AA6AF25093FACE4ULL, 0x0940EFADB4032AD3ULL },  // -219
+    { 0x488558EA6DCC8A50ULL, 0x07672624900288A9ULL },  // -218
+    { 0x74088E43E2E0DD4CULL, 0x723EA36DB337410EULL },  // -217
+    { 0x5CD3A5031BE71770ULL, 0x5B654F8AF5C5CDA5ULL },  // -216
+    { 0x4A42EA68E31F45F3ULL, 0x62B772D5916B0AEBULL },  // -215
+    { 0x76D1770E38320986ULL, 0x0458B7BC1BDE77DDULL },  // -214
+    { 0x5F0DF8D82CF4D46BULL, 0x1D13C630164B9318ULL },  // -213
+    { 0x4C0B2D79BD90A9EFULL, 0x30DC9E8CDEA2DC13ULL },  // -212
+    { 0x79AB7BF5FC1AA97FULL, 0x0160FDAE31049351ULL },  // -211
+    { 0x6155FCC4C9AEEDFFULL, 0x1AB3FE24F403A90EULL },  // -210
+    { 0x4DDE63D0A158BE65ULL, 0x6229981D9002EDA5ULL },  // -209
+    { 0x7C97061A9BC130A2ULL, 0x69DC2695B337E2A1ULL },  // -208
+    { 0x63AC04E2163426E8ULL, 0x54B01EDE28F9821BULL },  // -207
+    { 0x4FBCD0B4DE901F20ULL, 0x43C018B1BA6134E2ULL },  // -206
+    { 0x7F9481216419CB67ULL, 0x1F99C11C5D68549DULL },  // -205
+    { 0x6610674DE9AE3C52ULL, 0x4C7B00E37DED107EULL },  // -204
+    { 0x51A6B90B21583042ULL, 0x09FC00B5FE574065ULL },  // -203
+    { 0x41522DA2811359CEULL, 0x3B3000919845CD1DULL },  // -202
+    { 0x68837C3734EBC2E3ULL, 0x784CCDB5C06FAE95ULL },  // -201
+    { 0x539C635F5D8968B6ULL, 0x2D0A3E2B00595877ULL },  // -200
+    { 0x42E382B2B13ABA2BULL, 0x3DA1CB5599E11393ULL },  // -199
+    { 0x6B059DEAB52AC378ULL, 0x629C7888F634EC1EULL },  // -198
+    { 0x559E17EEF755692DULL, 0x3549FA072B5D89B1ULL },  // -197
+    { 0x447E798BF91120F1ULL, 0x1107FB38EF7E07C1ULL },  // -196
+    { 0x6D9728DFF4E834B5ULL, 0x01A65EC17F300C68ULL },  // -195
+    { 0x57AC20B32A535D5DULL, 0x4E1EB23465C009EDULL },  // -194
+    { 0x46234D5C21DC4AB1ULL, 0x24E55B5D1E333B24ULL },  // -193
+    { 0x70387BC69C93AAB5ULL, 0x216EF894FD1EC506ULL },  // -192
+    { 0x59C6C96BB076222AULL, 0x4DF2607730E56A6CULL },  // -191
+    { 0x47D23ABC8D2B4E88ULL, 0x3E5B805F5A5121F0ULL },  // -190
+    { 0x72E9F79415121740ULL, 0x63C59A322A1B697FULL },  // -189
+    { 0x5BEE5FA9AA74DF67ULL, 0x03047B5B54E2BACCULL },  // -188
+    { 0x498B7FBAEEC3E5ECULL, 0x0269FC4910B5623DULL },  // -187
+    { 0x75ABFF917E063CACULL, 0x6A432D41B45569FBULL },  // -186
+    { 0x5E2332DACB38308AULL, 0x21CF5767C37787FCULL },  // -185
+    { 0x4B4F5BE23C2CF3A1ULL, 0x67D912B9692C6CCAULL },  // -184
+    { 0x787EF969F9E185CFULL, 0x595B5128A8471476ULL },  // -183
+    { 0x60659454C7E79E3FULL, 0x6115DA86ED05A9F8ULL },  // -182
+    { 0x4D1E1043D31FB1CCULL, 0x4DAB1538BD9E2193ULL },  // -181
+    { 0x7B634D3951CC4FADULL, 0x62AB552795C9CF52ULL },  // -180
+    { 0x62B5D7610E3D0C8BULL, 0x0222AA86116E3F75ULL },  // -179
+    { 0x4EF7DF80D830D6D5ULL, 0x4E822204DABE992AULL },  // -178
+    { 0x7E59659AF38157BCULL, 0x17369CD49130F510ULL },  // -177
+    { 0x65145148C2CDDFC9ULL, 0x5F5EE3DD40F3F740ULL },  // -176
+    { 0x50DD0DD3CF0B196EULL, 0x1918B64A9A5CC5CDULL },  // -175
+    { 0x40B0D7DCA5A27ABEULL, 0x4746F83BAEB09E3EULL },  // -174
+    { 0x678159610903F797ULL, 0x253E59F91780FD2FULL },  // -173
+    { 0x52CDE11A6D9CC612ULL, 0x50FEAE60DF9A6426ULL },  // -172
+    { 0x423E4DAEBE1704DBULL, 0x5A65584D7FAEB685ULL },  // -171
+    { 0x69FD4917968B3AF9ULL, 0x10A226E265E4573BULL },  // -170
+    { 0x54CAA0DFABA29594ULL, 0x0D4E8581EB1D1295ULL },  // -169
+    { 0x43D54D7FBC821143ULL, 0x243ED134BC174211ULL },  // -168
+    { 0x6C887BFF94034ED2ULL, 0x06CAE85460253682ULL },  // -167
+    { 0x56D396661002A574ULL, 0x6BD586A9E6842B9BULL },  // -166
+    { 0x457611EB40021DF7ULL, 0x09779EEE52035616ULL },  // -165
+    { 0x6F234FDECCD02FF1ULL, 0x5BF297E3B66BBCEFULL },  // -164
+    { 0x58E90CB23D73598EULL, 0x165BACB62B8963F3ULL },  // -163
+    { 0x4720D6F4FDF5E13EULL, 0x451623C4EFA11CC2ULL },  // -162
+    { 0x71CE24BB2FEFCECAULL, 0x3B569FA17F682E03ULL },  // -161
+    { 0x5B0B5095BFF30BD5ULL, 0x15DEE61ACC535803ULL },  // -160
+    { 0x48D5DA11665C0977ULL, 0x2B18B8157042ACCFULL },  // -159
+    { 0x74895CE8A3C6758BULL, 0x5E8DF355806AAE18ULL },  // -158
+    { 0x5D3AB0BA1C9EC46FULL, 0x653E5C4466BBBE7AULL },  // -157
+    { 0x4A955A2E7D4BD059ULL, 0x3765169D1EFC9861ULL },  // -156
+    { 0x77555D172EDFB3C2ULL, 0x256E8A94FE60F3CFULL },  // -155
+    { 0x5F777DAC257FC301ULL, 0x6ABED543FEB3F63FULL },  // -154
+    { 0x4C5F97BCEACC9C01ULL, 0x3BCBDDCFFEF65E99ULL },  // -153
+    { 0x7A328C6177ADC668ULL, 0x5FAC961997F0975BULL },  // -152
+    { 0x61C209E792F16B86ULL, 0x7FBD44E1465A12AFULL },  // -151
+    { 0x4E34D4B9425ABC6BULL, 0x7FCA9D810514DBBFULL },  // -150
+    { 0x7D21545B9D5DFA46ULL, 0x32DDC8CE6E87C5FFULL },  // -149
+    { 0x641AA9E2E44B2E9EULL, 0x5BE4A0A525396B32ULL },  // -148
+    { 0x501554B5836F587EULL, 0x7CB6E6EA842DEF5CULL },  // -147
+    { 0x4011109135F2AD32ULL, 0x30925255368B25E3ULL },  // -146
+    { 0x6681B41B89844850ULL, 0x4DB6EA21F0DEA304ULL },  // -145
+    { 0x52015CE2D469D373ULL, 0x57C5881B2718826AULL },  // -144
+    { 0x419AB0B576BB0F8FULL, 0x5FD139AF527A01EFULL },  // -143
+    { 0x68F781225791B27FULL, 0x4C81F5E550C3364AULL },  // -142
+    { 0x53F9341B79415B99ULL, 0x239B2B1DDA35C508ULL },  // -141
+    { 0x432DC3492DCDE2E1ULL, 0x02E288E4AE916A6DULL },  // -140
+    { 0x6B7C6BA849496B01ULL, 0x516A74A1174F10AEULL },  // -139
+    { 0x55FD22ED076DEF34ULL, 0x4121F6E745D8DA25ULL },  // -138
+    { 0x44CA82573924BF5DULL, 0x1A8192529E4714EBULL },  // -137
+    { 0x6E10D08B8EA1322EULL, 0x5D9C1D50FD3E87DDULL },  // -136
+    { 0x580D73A2D880F4F2ULL, 0x17B01773FDCB9FE4ULL },  // -135
+    { 0x4671294F139A5D8EULL, 0x4626792997D61984ULL },  // -134
+    { 0x70B50EE4EC2A2F4AULL, 0x3D0A5B75BFBCF59FULL },  // -133
+    { 0x5A2A7250BCEE8C3BULL, 0x4A6EAF916630C47FULL },  // -132
+    { 0x4821F50D63F209C9ULL, 0x21F2260DEB5A36CCULL },  // -131
+    { 0x736988156CB6760EULL, 0x69837016455D247AULL },  // -130
+    { 0x5C546CDDF091F80BULL, 0x6E02C011D1175062ULL },  // -129
+    { 0x49DD23E4C074C66FULL, 0x719BCCDB0DAC404EULL },  // -128
+    { 0x762E9FD467213D7FULL, 0x68F947C4E2AD33B0ULL },  // -127
+    { 0x5E8BB3105280FDFFULL, 0x6D94396A4EF0F627ULL },  // -126
+    { 0x4BA2F5A6A8673199ULL, 0x3E102DEEA58D91B9ULL },  // -125
+    { 0x7904BC3DDA3EB5C2ULL, 0x3019E3176F48E927ULL },  // -124
+    { 0x60D09697E1CBC49BULL, 0x4014B5AC590720ECULL },  // -123
+    { 0x4D73ABACB4A303AFULL, 0x4CDD5E237A6C1A57ULL },  // -122
+    { 0x7BEC45E12104D2B2ULL, 0x47C8969F2A46908AULL },  // -121
+    { 0x63236B1A80D0A88EULL, 0x6CA0787F5505406FULL },  // -120
+    { 0x4F4F88E200A6ED3FULL, 0x0A19F9FF773766BFULL },  // -119
+    { 0x7EE5A7D0010B1531ULL, 0x5CF65CCBF1F23DFEULL },  // -118
+    { 0x6584864000D5AA8EULL, 0x172B7D6FF4C1CB32ULL },  // -117
+    { 0x5136D1CCCD77BBA4ULL, 0x78EF978CC3CE3C28ULL },  // -116
+    { 0x40F8A7D70AC62FB7ULL, 0x13F2DFA3CFD83020ULL },  // -115
+    { 0x67F43FBE77A37F8BULL, 0x398499061959E699ULL },  // -114
+    { 0x5329CC985FB5FFA2ULL, 0x6136E0D1ADE18548ULL },  // -113
+    { 0x4287D6E04C91994FULL, 0x00F8B3DAF181376DULL },  // -112
+    { 0x6A72F166E0E8F54BULL, 0x1B27862B1C01F247ULL },  // -111
+    { 0x5528C11F1A53F76FULL, 0x2F52D1BC1667F506ULL },  // -110
+    { 0x44209A7F48432C59ULL, 0x0C424163451FF738ULL },  // -109
+    { 0x6D00F7320D3846F4ULL, 0x7A039BD208332526ULL },  // -108
+    { 0x5733F8F4D76038C3ULL, 0x7B361641A028EA85ULL },  // -107
+    { 0x45C32D90AC4CFA36ULL, 0x2F5E78348020BB9EULL },  // -106
+    { 0x6F9EAF4DE07B29F0ULL, 0x4BCA59ED99CDF8FCULL },  // -105
+    { 0x594BBF71806287F3ULL, 0x563B7B247B0B2D96ULL },  // -104
+    { 0x476FCC5ACD1B9FF6ULL, 0x11C92F50626F57ACULL },  // -103
+    { 0x724C7A2AE1C5CCBDULL, 0x02DB7EE703E55912ULL },  // -102
+    { 0x5B7061BBE7D17097ULL, 0x1BE2CBEC031DE0DCULL },  // -101
+    { 0x4926B496530DF3ACULL, 0x164F09899C17E716ULL },  // -100
+    { 0x750ABA8A1E7CB913ULL, 0x3D4B4275C68CA4F0ULL },  // -99
+    { 0x5DA22ED4E530940FULL, 0x4AA29B916BA3B726ULL },  // -98
+    { 0x4AE825771DC07672ULL, 0x6EE87C74561C9285ULL },  // -97
+    { 0x77D9D58B62CD8A51ULL, 0x3173FA53BCFA8408ULL },  // -96
+    { 0x5FE177A2B5713B74ULL, 0x278FFB7630C869A0ULL },  // -95
+    { 0x4CB45FB55DF42F90ULL, 0x1FA662C4F3D387B3ULL },  // -94
+    { 0x7ABA32BBC986B280ULL, 0x32A3D13B1FB8D91FULL },  // -93
+    { 0x622E8EFCA1388ECDULL, 0x0EE9742F4C93E0E6ULL },  // -92
+    { 0x4E8BA596E760723DULL, 0x58BAC3590A0FE71EULL },  // -91
+    { 0x7DAC3C24A5671D2FULL, 0x412AD228101971C9ULL },  // -90
+    { 0x6489C9B6EAB8E426ULL, 0x00EF0E8673478E3BULL },  // -89
+    { 0x506E3AF8BBC71CEBULL, 0x1A58D86B8F6C71C9ULL },  // -88
+    { 0x40582F2D6305B0BCULL, 0x1513E0560C56C16EULL },  // -87
+    { 0x66F37EAF04D5E793ULL, 0x3B530089AD579BE2ULL },  // -86
+    { 0x525C6558D0AB1FA9ULL, 0x15DC006E2446164FULL },  // -85
+    { 0x41E384470D55B2EDULL, 0x5E4999F1B69E783FULL },  // -84
+    { 0x696C06D81555EB15ULL, 0x7D428FE92430C065ULL },  // -83
+    { 0x54566BE0111188DEULL, 0x31020CBA835A3384ULL },  // -82
+    { 0x4378564CDA746D7EULL, 0x5A680A2ECF7B5C69ULL },  // -81
+    { 0x6BF3BD47C3ED7BFDULL, 0x770CDD17B25EFA42ULL },  // -80
+    { 0x565C976C9CBDFCCBULL, 0x1270B0DFC1E59502ULL },  // -79
+    { 0x4516DF8A16FE63D5ULL, 0x5B8D5A4C9B1E10CEULL },  // -78
+    { 0x6E8AFF4357FD6C89ULL, 0x127BC3ADC4FCE7B0ULL },  // -77
+    { 0x586F329C466456D4ULL, 0x0EC96957D0CA52F3ULL },  // -76
+    { 0x46BF5BB038504576ULL, 0x3F07877973D50F29ULL },  // -75
+    { 0x71322C4D26E6D58AULL, 0x31A5A58F1FBB4B75ULL },  // -74
+    { 0x5A8E89D75252446EULL, 0x5AEAEAD8E62F6F91ULL },  // -73
+    { 0x487207DF750E9D25ULL, 0x2F22557A51BF8C74ULL },  // -72
+    { 0x73E9A63254E42EA2ULL, 0x1836EF2A1C65AD86ULL },  // -71
+    { 0x5CBAEB5B771CF21BULL, 0x2CF8BF54E3848AD2ULL },  // -70
+    { 0x4A2F22AF927D8E7CULL, 0x23FA32AA4F9D3BDBULL },  // -69
+    { 0x76B1D118EA627D93ULL, 0x5329EAAA18FB92F8ULL },  // -68
+    { 0x5EF4A74721E86476ULL, 0x0F54BBBB472FA8C6ULL },  // -67
+    { 0x4BF6EC38E7ED1D2BULL, 0x25DD62FC38F2ED6CULL },  // -66
+    { 0x798B138E3FE1C845ULL, 0x22FBD1938E517BDFULL },  // -65
+    { 0x613C0FA4FFE7D36AULL, 0x4F2FDADC71DAC97FULL },  // -64
+    { 0x4DC9A61D998642BBULL, 0x58F3157D27E23ACCULL },  // -63
+    { 0x7C75D695C2706AC5ULL, 0x74B82261D969F7ADULL },  // -62
+    { 0x63917877CEC0556BULL, 0x10934EB4ADEE5FBEULL },  // -61
+    { 0x4FA793930BCD1122ULL, 0x4075D8908B251965ULL },  // -60
+    { 0x7F7285B812E1B504ULL, 0x00BC8DB411D4F56EULL },  // -59
+    { 0x65F537C675815D9CULL, 0x66FD3E29A7DD9125ULL },  // -58
+    { 0x5190F96B91344AE3ULL, 0x6BFDCB54864ADA84ULL },  // -57
+    { 0x4140C78940F6A24FULL, 0x6FFE3C439EA2486AULL },  // -56
+    { 0x6867A5A867F103B2ULL, 0x7FFD2D38FDD073DCULL },  // -55
+    { 0x53861E2053273628ULL, 0x6664242D97D9F64AULL },  // -54
+    { 0x42D1B1B375B8F820ULL, 0x51E9B68ADFE191D5ULL },  // -53
+    { 0x6AE91C5255F4C034ULL, 0x1CA924116635B621ULL },  // -52
+    { 0x558749DB77F70029ULL, 0x63BA83411E915E81ULL },  // -51
+    { 0x446C3B15F9926687ULL, 0x6962029A7EDAB201ULL },  // -50
+    { 0x6D79F82328EA3DA6ULL, 0x0F03375D97C45001ULL },  // -49
+    { 0x5794C6828721CAEBULL, 0x259C2C4ADFD04001ULL },  // -48
+    { 0x46109ECED2816F22ULL, 0x5149BD08B30D0001ULL },  // -47
+    { 0x701A97B150CF1837ULL, 0x3542C80DEB480001ULL },  // -46
+    { 0x59AEDFC10D7279C5ULL, 0x7768A00B22A00001ULL },  // -45
+    { 0x47BF19673DF52E37ULL, 0x79208008E8800001ULL },  // -44
+    { 0x72CB5BD86321E38CULL, 0x5B67334174000001ULL },  // -43
+    { 0x5BD5E313828182D6ULL, 0x7C528F6790000001ULL },  // -42
+    { 0x4977E8DC68679BDFULL, 0x16A872B940000001ULL },  // -41
+    { 0x758CA7C70D7292FEULL, 0x5773EAC200000001ULL },  // -40
+    { 0x5E0A1FD271287598ULL, 0x45F6556800000001ULL },  // -39
+    { 0x4B3B4CA85A86C47AULL, 0x04C5112000000001ULL },  // -38
+    { 0x785EE10D5DA46D90ULL, 0x07A1B50000000001ULL },  // -37
+    { 0x604BE73DE4838AD9ULL, 0x52E7C40000000001ULL },  // -36
+    { 0x4D0985CB1D3608AEULL, 0x0F1FD00000000001ULL },  // -35
+    { 0x7B426FAB61F00DE3ULL, 0x31CC800000000001ULL },  // -34
+    { 0x629B8C891B267182ULL, 0x5B0A000000000001ULL },  // -33
+    { 0x4EE2D6D415B85ACEULL, 0x7C08000000000001ULL },  // -32
+    { 0x7E37BE2022C0914BULL, 0x1340000000000001ULL },  // -31
+    { 0x64F964E68233A76FULL, 0x2900000000000001ULL },  // -30
+    { 0x50C783EB9B5C85F2ULL, 0x5400000000000001ULL },  // -29
+    { 0x409F9CBC7C4A04C2ULL, 0x1000000000000001ULL },  // -28
+    { 0x6765C793FA10079DULL, 0x0000000000000001ULL },  // -27
+    { 0x52B7D2DCC80CD2E4ULL, 0x0000000000000001ULL },  // -26
+    { 0x422CA8B0A00A4250ULL, 0x0000000000000001ULL },  // -25
+    { 0x69E10DE76676D080ULL, 0x0000000000000001ULL },  // -24
+    { 0x54B40B1F852BDA00ULL, 0x0000000000000001ULL },  // -23
+    { 0x43C33C1937564800ULL, 0x0000000000000001ULL },  // -22
+    { 0x6C6B935B8BBD4000ULL, 0x0000000000000001ULL },  // -21
+    { 0x56BC75E2D6310000ULL, 0x0000000000000001ULL },  // -20
+    { 0x4563918244F40000ULL, 0x0000000000000001ULL },  // -19
+    { 0x6F05B59D3B200000ULL, 0x0000000000000001ULL },  // -18
+    { 0x58D15E1762800000ULL, 0x0000000000000001ULL },  // -17
+    { 0x470DE4DF82000000ULL, 0x0000000000000001ULL },  // -16
+    { 0x71AFD498D0000000ULL, 0x0000000000000001ULL },  // -15
+    { 0x5AF3107A40000000ULL, 0x0000000000000001ULL },  // -14
+    { 0x48C2739500000000ULL, 0x0000000000000001ULL },  // -13
+    { 0x746A528800000000ULL, 0x0000000000000001ULL },  // -12
+    { 0x5D21DBA000000000ULL, 0x0000000000000001ULL },  // -11
+    { 0x4A817C8000000000ULL, 0x0000000000000001ULL },  // -10
+    { 0x7735940000000000ULL, 0x0000000000000001ULL },  // -9
+    { 0x5F5E100000000000ULL, 0x0000000000000001ULL },  // -8
+    { 0x4C4B400000000000ULL, 0x0000000000000001ULL },  // -7
+    { 0x7A12000000000000ULL, 0x0000000000000001ULL },  // -6
+    { 0x61A8000000000000ULL, 0x0000000000000001ULL },  // -5
+    { 0x4E20000000000000ULL, 0x0000000000000001ULL },  // -4
+    { 0x7D00000000000000ULL, 0x0000000000000001ULL },  // -3
+    { 0x6400000000000000ULL, 0x0000000000000001ULL },  // -2
+    { 0x5000000000000000ULL, 0x0000000000000001ULL },  // -1
+    { 0x4000000000000000ULL, 0x0000000000000001ULL },  // 0
+    { 0x6666666666666666ULL, 0x3333333333333334ULL },  // 1
+    { 0x51EB851EB851EB85ULL, 0x0F5C28F5C28F5C29ULL },  // 2
+    { 0x4189374BC6A7EF9DULL, 0x5916872B020C49BBULL },  // 3
+    { 0x68DB8BAC710CB295ULL, 0x74F0D844D013A92BULL },  // 4
+    { 0x53E2D6238DA3C211ULL, 0x43F3E0370CDC8755ULL },  // 5
+    { 0x431BDE82D7B634DAULL, 0x698FE69270B06C44ULL },  // 6
+    { 0x6B5FCA6AF2BD215EULL, 0x0F4CA41D811A46D4ULL },  // 7
+    { 0x55E63B88C230E77EULL, 0x3F70834ACDAE9F10ULL },  // 8
+    { 0x44B82FA09B5A52CBULL, 0x4C5A02A23E254C0DULL },  // 9
+    { 0x6DF37F675EF6EADFULL, 0x2D5CD10396A21347ULL },  // 10
+    { 0x57F5FF85E592557FULL, 0x3DE3DA69454E75D3ULL },  // 11
+    { 0x465E6604B7A84465ULL, 0x7E4FE1EDD10B9175ULL },  // 12
+    { 0x709709A125DA0709ULL, 0x4A19697C81AC1BEFULL },  // 13
+    { 0x5A126E1A84AE6C07ULL, 0x54E1213067BCE326ULL },  // 14
+    { 0x480EBE7B9D58566CULL, 0x43E74DC052FD8285ULL },  // 15
+    { 0x734ACA5F6226F0ADULL, 0x530BAF9A1E626A6DULL },  // 16
+    { 0x5C3BD5191B525A24ULL, 0x426FBFAE7EB521F1ULL },  // 17
+    { 0x49C97747490EAE83ULL, 0x4EBFCC8B9890E7F4ULL },  // 18
+    { 0x760F253EDB4AB0D2ULL, 0x4ACC7A78F41B0CBAULL },  // 19
+    { 0x5E72843249088D75ULL, 0x223D2EC729AF3D62ULL },  // 20
+    { 0x4B8ED0283A6D3DF7ULL, 0x34FDBF05BAF29781ULL },  // 21
+    { 0x78E480405D7B9658ULL, 0x54C931A2C4B758CFULL },  // 22
+    { 0x60B6CD004AC94513ULL, 0x5D6DC14F03C5E0A5ULL },  // 23
+    { 0x4D5F0A66A23A9DA9ULL, 0x31249AA59C9E4D51ULL },  // 24
+    { 0x7BCB43D769F762A8ULL, 0x4EA0F76F60FD4882ULL },  // 25
+    { 0x63090312BB2C4EEDULL, 0x254D92BF80CAA068ULL },  // 26
+    { 0x4F3A68DBC8F03F24ULL, 0x1DD7A89933D54D20ULL },  // 27
+    { 0x7EC3DAF941806506ULL, 0x62F2A75B86221500ULL },  // 28
+    { 0x65697BFA9ACD1D9FULL, 0x025BB91604E810CDULL },  // 29
+    { 0x51212FFBAF0A7E18ULL, 0x684960DE6A5340A4ULL },  // 30
+    { 0x40E7599625A1FE7AULL, 0x203AB3E521DC33B6ULL },  // 31
+    { 0x67D88F56A29CCA5DULL, 0x19F7863B696052BDULL },  // 32
+    { 0x5313A5DEE87D6EB0ULL, 0x7B2C6B62BAB37564ULL },  // 33
+    { 0x42761E4BED31255AULL, 0x2F56BC4EFBC2C450ULL },  // 34
+    { 0x6A5696DFE1E83BC3ULL, 0x655793B192D13A1AULL },  // 35
+    { 0x5512124CB4B9C969ULL, 0x377942F475742E7BULL },  // 36
+    { 0x440E750A2A2E3ABAULL, 0x5F9435905DF68B96ULL },  // 37
+    { 0x6CE3EE76A9E3912AULL, 0x65B9EF4D63241289ULL },  // 38
+    { 0x571CBEC554B60DBBULL, 0x6AFB25D782834207ULL },  // 39
+    { 0x45B0989DDD5E7163ULL, 0x08C8EB12CECF6806ULL },  // 40
+    { 0x6F80F42FC8971BD1ULL, 0x5ADB11B7B14BD9A3ULL },  // 41
+    { 0x5933F68CA078E30EULL, 0x157C0E2C8DD647B5ULL },  // 42
+    { 0x475CC53D4D2D8271ULL, 0x5DFCD823A4AB6C91ULL },  // 43
+    { 0x722E086215159D82ULL, 0x632E269F6DDF141BULL },  // 44
+    { 0x5B5806B4DDAAE468ULL, 0x4F581EE5F17F4349ULL },  // 45
+    { 0x49133890B1558386ULL, 0x72ACE584C1329C3BULL },  // 46
+    { 0x74EB8DB44EEF38D7ULL, 0x6AAE3C079B842D2AULL },  // 47
+    { 0x5D893E29D8BF60ACULL, 0x5558300616035755ULL },  // 48
+    { 0x4AD431BB13CC4D56ULL, 0x7779C004DE6912ABULL },  // 49
+    { 0x77B9E92B52E07BBEULL, 0x258F99A163DB5111ULL },  // 50
+    { 0x5FC7EDBC424D2FCBULL, 0x37A614811CAF740DULL },  // 51
+    { 0x4C9FF163683DBFD5ULL, 0x7951AA00E3BF900BULL },  // 52
+    { 0x7A998238A6C932EFULL, 0x754F7667D2CC19ABULL },  // 53
+    { 0x6214682D523A8F26ULL, 0x2AA5F8530F09AE22ULL },  // 54
+    { 0x4E76B9BDDB620C1EULL, 0x55519375A5A1581BULL },  // 55
+    { 0x7D8AC2C95F034697ULL, 0x3BB5B8BC3C3559C5ULL },  // 56
+    { 0x646F023AB2690545ULL, 0x7C9160969691149EULL },  // 57
+    { 0x5058CE955B87376BULL, 0x16DAB3ABABA743B2ULL },  // 58
+    { 0x40470BAAAF9F5F88ULL, 0x78AEF622EFB902F5ULL },  // 59
+    { 0x66D812AAB29898DBULL, 0x0DE4BD04B2C19E54ULL },  // 60
+    { 0x524675555BAD4715ULL, 0x57EA30D08F014B76ULL },  // 61
+    { 0x41D1F7777C8A9F44ULL, 0x4654F3DA0C01092CULL },  // 62
+    { 0x694FF258C7443207ULL, 0x23BB1FC346680EACULL },  // 63
+    { 0x543FF513D29CF4D2ULL, 0x4FC8E635D1ECD88AULL },  // 64
+    { 0x43665DA9754A5D75ULL, 0x263A51C4A7F0AD3BULL },  // 65
+    { 0x6BD6FC425543C8BBULL, 0x56C3B607731AAEC4ULL },  // 66
+    { 0x5645969B77696D62ULL, 0x789C919F8F488BD0ULL },  // 67
+    { 0x4504787C5F878AB5ULL, 0x46E3A7B2D906D640ULL },  // 68
+    { 0x6E6D8D93CC0C1122ULL, 0x3E390C515B3E239AULL },  // 69
+    { 0x5857A4763CD6741BULL, 0x4B60D6A77C31B615ULL },  // 70
+    { 0x46AC8391CA4529AFULL, 0x55E7121F968E2B44ULL },  // 71
+    { 0x711405B6106EA919ULL, 0x0971B698F0E3786DULL },  // 72
+    { 0x5A766AF80D255414ULL, 0x078E2BAD8D82C6BDULL },  // 73
+    { 0x485EBBF9A41DDCDCULL, 0x6C71BC8AD79BD231ULL },  // 74
+    { 0x73CAC65C39C96161ULL, 0x2D82C7448C2C8382ULL },  // 75
+    { 0x5CA23849C7D44DE7ULL, 0x3E023903A356CF9BULL },  // 76
+    { 0x4A1B603B06437185ULL, 0x7E682D9C82ABD949ULL },  // 77
+    { 0x76923391A39F1C09ULL, 0x4A4048FA6AAC8EDBULL },  // 78
+    { 0x5EDB5C7482E5B007ULL, 0x55003A61EEF07249ULL },  // 79
+    { 0x4BE2B05D35848CD2ULL, 0x773361E7F259F507ULL },  // 80
+    { 0x796AB3C855A0E151ULL, 0x3EB89CA6508FEE71ULL },  // 81
+    { 0x6122296D114D810DULL, 0x7EFA16EB73A6585BULL },  // 82
+    { 0x4DB4EDF0DAA4673EULL, 0x3261ABEF8FB846AFULL },  // 83
+    { 0x7C54AFE7C43A3ECAULL, 0x1D691318E5F3A44BULL },  // 84
+    { 0x6376F31FD02E98A1ULL, 0x64540F471E5C836FULL },  // 85
+    { 0x4F925C1973587A1BULL, 0x0376729F4B7D35F3ULL },  // 86
+    { 0x7F50935BEBC0C35EULL, 0x38BD84321261EFEBULL },  // 87
+    { 0x65DA0F7CBC9A35E5ULL, 0x13CAD0280EB4BFEFULL },  // 88
+    { 0x517B3F96FD482B1DULL, 0x5CA240200BC3CCBFULL },  // 89
+    { 0x412F66126439BC17ULL, 0x63B50019A3030A33ULL },  // 90
+    { 0x684BD683D38F9359ULL, 0x1F88002904D1A9EAULL },  // 91
+    { 0x536FDECFDC72DC47ULL, 0x32D3335403DAEE55ULL },  // 92
+    { 0x42BFE57316C249D2ULL, 0x5BDC291003158B77ULL },  // 93
+    { 0x6ACCA251BE03A951ULL, 0x12F9DB4CD1BC1258ULL },  // 94
+    { 0x557081DAFE695440ULL, 0x7594AF70A7C9A847ULL },  // 95
+    { 0x445A017BFEBAA9CDULL, 0x4476F2C0863AED06ULL },  // 96
+    { 0x6D5CCF2CCAC442E2ULL, 0x3A57EACDA3917B3CULL },  // 97
+    { 0x577D728A3BD03581ULL, 0x7B7988A482DAC8FDULL },  // 98
+    { 0x45FDF53B630CF79BULL, 0x15FAD3B6CF156D97ULL },  // 99
+    { 0x6FFCBB923814BF5EULL, 0x565E1F8AE4EF15BEULL },  // 100
+    { 0x5996FC74F9AA32B2ULL, 0x11E4E608B725AAFFULL },  // 101
+    { 0x47ABFD2A6154F55BULL, 0x27EA51A0928488CCULL },  // 102
+    { 0x72ACC843CEEE555EULL, 0x7310829A84074146ULL },  // 103
+    { 0x5BBD6D030BF1DDE5ULL, 0x42739BAED005CDD2ULL },  // 104
+    { 0x49645735A327E4B7ULL, 0x4EC2E2F24004A4A8ULL },  // 105
+    { 0x756D5855D1D96DF2ULL, 0x4AD16B1D333AA10CULL },  // 106
+    { 0x5DF11377DB1457F5ULL, 0x2241227DC2954DA3ULL },  // 107
+    { 0x4B2742C648DD132AULL, 0x4E9A81FE35443E1CULL },  // 108
+    { 0x783ED13D4161B844ULL, 0x175D9CC9EED39694ULL },  // 109
+    { 0x603240FDCDE7C69CULL, 0x7917B0A18BDC7876ULL },  // 110
+    { 0x4CF500CB0B1FD217ULL, 0x1412F3B46FE39392ULL },  // 111
+    { 0x7B219ADE7832E9BEULL, 0x535185ED7FD285B6ULL },  // 112
+    { 0x628148B1F9C25498ULL, 0x42A79E57997537C5ULL },  // 113
+    { 0x4ECDD3C1949B76E0ULL, 0x3552E512E12A9304ULL },  // 114
+    { 0x7E161F9C20F8BE33ULL, 0x6EEB081E3510EB39ULL },  // 115
+    { 0x64DE7FB01A609829ULL, 0x3F226CE4F740BC2EULL },  // 116
+    { 0x50B1FFC0151A1354ULL, 0x3281F0B72C33C9BEULL },  // 117
+    { 0x408E66334414DC43ULL, 0x42018D5F568FD498ULL },  // 118
+    { 0x674A3D1ED354939FULL, 0x1CCF48988A7FBA8DULL },  // 119
+    { 0x52A1CA7F0F76DC7FULL, 0x30A5D3AD3B99620BULL },  // 120
+    { 0x421B0865A5F8B065ULL, 0x73B7DC8A96144E6FULL },  // 121
+    { 0x69C4DA3C3CC11A3CULL, 0x52BFC7442353B0B1ULL },  // 122
+    { 0x549D7B6363CDAE96ULL, 0x756639034F7626F4ULL },  // 123
+    { 0x43B12F82B63E2545ULL, 0x4451C735D92B525DULL },  // 124
+    { 0x6C4EB26ABD303BA2ULL, 0x3A1C71EFC1DEEA2EULL },  // 125
+    { 0x56A55B889759C94EULL, 0x61B05B2634B254F2ULL },  // 126
+    { 0x45511606DF7B0772ULL, 0x1AF37C1E908EAA5BULL },  // 127
+    { 0x6EE8233E325E7250ULL, 0x2B1F2CFDB41776F8ULL },  // 128
+    { 0x58B9B5CB5B7EC1D9ULL, 0x6F4C23FE29AC5F2DULL },  // 129
+    { 0x46FAF7D5E2CBCE47ULL, 0x72A34FFE87BD18F1ULL },  // 130
+    { 0x71918C896ADFB073ULL, 0x04387FFDA5FB5B1BULL },  // 131
+    { 0x5ADAD6D4557FC05CULL, 0x0360666484C915AFULL },  // 132
+    { 0x48AF1243779966B0ULL, 0x02B3851D3707448CULL },  // 133
+    { 0x744B506BF28F0AB3ULL, 0x1DEC082EBE720746ULL },  // 134
+    { 0x5D090D2328726EF5ULL, 0x64BCD358985B3905ULL },  // 135
+    { 0x4A6DA41C205B8BF7ULL, 0x6A30A913AD15C738ULL },  // 136
+    { 0x7715D36033C5ACBFULL, 0x5D1AA81F7B560B8CULL },  // 137
+    { 0x5F44A919C3048A32ULL, 0x7DAEECE5FC44D609ULL },  // 138
+    { 0x4C36EDAE359D3B5BULL, 0x7E258A51969D7808ULL },  // 139
+    { 0x79F17C49EF61F893ULL, 0x16A276E8F0FBF33FULL },  // 140
+    { 0x618DFD07F2B4C6DCULL, 0x121B9253F3FCC299ULL },  // 141
+    { 0x4E0B30D328909F16ULL, 0x41AFA84329970214ULL },  // 142
+    { 0x7CDEB4850DB431BDULL, 0x4F7F739EA8F19CEDULL },  // 143
+    { 0x63E55D373E29C164ULL, 0x3F99294BBA5AE3F1ULL },  // 144
+    { 0x4FEAB0F8FE87CDE9ULL, 0x7FADBAA2FB7BE98DULL },  // 145
+    { 0x7FDDE7F4CA72E30FULL, 0x7F7C5DD1925FDC15ULL },  // 146
+    { 0x664B1FF7085BE8D9ULL, 0x4C637E4141E649ABULL },  // 147
+    { 0x51D5B32C06AFED7AULL, 0x704F983434B83AEFULL },  // 148
+    { 0x4177C2899EF32462ULL, 0x26A6135CF6F9C8BFULL },  // 149
+    { 0x68BF9DA8FE51D3D0ULL, 0x3DD685618B294132ULL },  // 150
+    { 0x53CC7E20CB74A973ULL, 0x4B12044E08EDCDC2ULL },  // 151
+    { 0x4309FE80A2C3BAC2ULL, 0x6F419D0B3A57D7CEULL },  // 152
+    { 0x6B4330CDD1392AD1ULL, 0x320294DEC3BFBFB0ULL },  // 153
+    { 0x55CF5A3E40FA88A7ULL, 0x419BAA4BCFCC995AULL },  // 154
+    { 0x44A5E1CB672ED3B9ULL, 0x1AE2EEA30CA3ADE1ULL },  // 155
+    { 0x6DD636123EB152C1ULL, 0x77D17DD1ADD2AFCFULL },  // 156
+    { 0x57DE91A832277567ULL, 0x797464A7BE42263FULL },  // 157
+    { 0x464BA7B9C1B92AB9ULL, 0x4790508631CE84FFULL },  // 158
+    { 0x70790C5C6928445CULL, 0x0C1A1A704FB0D4CCULL },  // 159
+    { 0x59FA7049EDB9D049ULL, 0x567B4859D95A43D6ULL },  // 160
+    { 0x47FB8D07F161736EULL, 0x11FC39E17AAE9CABULL },  // 161
+    { 0x732C14D98235857DULL, 0x032D2968C44A9445ULL },  // 162
+    { 0x5C2343E134F79DFDULL, 0x4F575453D03BA9D1ULL },  // 163
+    { 0x49B5CFE75D92E4CAULL, 0x72AC4376402FBB0EULL },  // 164
+    { 0x75EFB30BC8EB07ABULL, 0x0446D256CD192B49ULL },  // 165
+    { 0x5E595C096D88D2EFULL, 0x1D0575123DADBC3AULL },  // 166
+    { 0x4B7AB0078AD3DBF2ULL, 0x4A6AC40E97BE302FULL },  // 167
+    { 0x78C44CD8DE1FC650ULL, 0x771139B0F2C9E6B1ULL },  // 168
+    { 0x609D0A4718196B73ULL, 0x78DA948D8F07EBC1ULL },  // 169
+    { 0x4D4A6E9F467ABC5CULL, 0x60AEDD3E0C065634ULL },  // 170
+    { 0x7BAA4A9870C46094ULL, 0x344AFB9679A3BD20ULL },  // 171
+    { 0x62EEA2138D69E6DDULL, 0x103BFC78614FCA80ULL },  // 172
+    { 0x4F254E760ABB1F17ULL, 0x26966393810CA200ULL },  // 173
+    { 0x7EA21723445E9825ULL, 0x2423D2859B476999ULL },  // 174
+    { 0x654E78E9037EE01DULL, 0x69B642047C392148ULL },  // 175
+    { 0x510B93ED9C658017ULL, 0x6E2B680396941AA0ULL },  // 176
+    { 0x40D60FF149EACCDFULL, 0x71BC53361210154DULL },  // 177
+    { 0x67BCE64EDCAAE166ULL, 0x1C6085235019BBAEULL },  // 178
+    { 0x52FD850BE3BBE784ULL, 0x7D1A041C40149625ULL },  // 179
+    { 0x42646A6FE9631F9DULL, 0x4A7B367D0010781DULL },  // 180
+    { 0x6A3A43E642383295ULL, 0x5D91F0C8001A59C8ULL },  // 181
+    { 0x54FB698501C68EDEULL, 0x17A7F3D3334847D4ULL },  // 182
+    { 0x43FC546A67D20BE4ULL, 0x79532975C2A03976ULL },  // 183
+    { 0x6CC6ED770C83463BULL, 0x0EEB75893766C256ULL },  // 184
+    { 0x57058AC5A39C382FULL, 0x25892AD42C523512ULL },  // 185
+    { 0x459E089E1C7CF9BFULL, 0x37A0EF102374F742ULL },  // 186
+    { 0x6F6340FCFA618F98ULL, 0x59017E8038BB2536ULL },  // 187
+    { 0x591C33FD951AD946ULL, 0x7A67986693C8EA91ULL },  // 188
+    { 0x4749C33144157A9FULL, 0x151FAD1EDCA0BBA8ULL },  // 189
+    { 0x720F9EB539BBF765ULL, 0x0832AE97C76792A5ULL },  // 190
+    { 0x5B3FB22A94965F84ULL, 0x068EF21305EC7551ULL },  // 191
+    { 0x48FFC1BBAA11E603ULL, 0x1ED8C1A8D189F774ULL },  // 192
+    { 0x74CC692C434FD66BULL, 0x4AF4690E1C0FF253ULL },  // 193
+    { 0x5D705423690CAB89ULL, 0x225D20D816732843ULL },  // 194
+    { 0x4AC0434F873D5607ULL, 0x35174D79AB8F5369ULL },  // 195
+    { 0x779A054C0B955672ULL, 0x21BEE25C45B21F0EULL },  // 196
+    { 0x5FAE6AA33C77785BULL, 0x3498B5169E2818D8ULL },  // 197
+    { 0x4C8B888296C5F9E2ULL, 0x5D46F7454B534713ULL },  // 198
+    { 0x7A78DA6A8AD65C9DULL, 0x7BA4BED545520B52ULL },  // 199
+    { 0x61FA48553BDEB07EULL, 0x2FB6FF110441A2A8ULL },  // 200
+    { 0x4E61D37763188D31ULL, 0x72F8CC0D9D014EEDULL },  // 201
+    { 0x7D6952589E8DAEB6ULL, 0x1E5AE015C80217E1ULL },  // 202
+    { 0x645441E07ED7BEF8ULL, 0x1848B344A001ACB4ULL },  // 203
+    { 0x504367E6CBDFCBF9ULL, 0x603A2903B3348A2AULL },  // 204
+    { 0x4035ECB8A3196FFBULL, 0x002E873628F6D4EEULL },  // 205
+    { 0x66BCADF43828B32BULL, 0x19E40B89DB2487E3ULL },  // 206
+    { 0x52308B29C686F5BCULL, 0x14B66FA17C1D3983ULL },  // 207
+    { 0x41C06F549ED25E30ULL, 0x1091F2E7967DC79CULL },  // 208
+    { 0x6933E554315096B3ULL, 0x341CB7D8F0C93F5FULL },  // 209
+    { 0x542984435AA6DEF5ULL, 0x767D5FE0C0A0FF80ULL },  // 210
+    { 0x435469CF7BB8B25EULL, 0x2B977FE70080CC66ULL },  // 211
+    { 0x6BBA42E592C11D63ULL, 0x5F58CCA4CD9AE0A3ULL },  // 212
+    { 0x562E9BEADBCDB11CULL, 0x4C470A1D7148B3B6ULL },  // 213
+    { 0x44F216557CA48DB0ULL, 0x3D05A1B1276D5C92ULL },  // 214
+    { 0x6E5023BBFAA0E2B3ULL, 0x7B3C35E83F1560E9ULL },  // 215
+    { 0x58401C96621A4EF6ULL, 0x2F635E5365AAB3EDULL },  // 216
+    { 0x4699B0784E7B725EULL, 0x591C4B75EAEEF658ULL },  // 217
+    { 0x70F5E726E3F8B6FDULL, 0x74FA125644B18A26ULL },  // 218
+    { 0x5A5E5285832D5F31ULL, 0x43FB41DE9D5AD4EBULL },  // 219
+    { 0x484B75379C244C27ULL, 0x4FFC34B2177BDD89ULL },  // 220
+    { 0x73ABEEBF603A1372ULL, 0x4CC6BAB68BF96274ULL },  // 221
+    { 0x5C898BCC4CFB42C2ULL, 0x0A38955ED6611B90ULL },  // 222
+    { 0x4A07A309D72F689BULL, 0x21C6DDE5784DAFA7ULL },  // 223
+    { 0x76729E762518A75EULL, 0x693E2FD58D49190BULL },  // 224
+    { 0x5EC2185E8413B918ULL, 0x5431BFDE0AA0E0D5ULL },  // 225
+    { 0x4BCE79E536762DADULL, 0x29C1664B3BB3E711ULL },  // 226
+    { 0x794A5CA1F0BD15E2ULL, 0x0F9BD6DEC5ECA4E8ULL },  // 227
+    { 0x61084A1B26FDAB1BULL, 0x2616457F04BD50BAULL },  // 228
+    { 0x4DA03B48EBFE227CULL, 0x1E783798D09773C8ULL },  // 229
+    { 0x7C33920E46636A60ULL, 0x30C058F480F252D9ULL },  // 230
+    { 0x635C74D8384F884DULL, 0x0D66AD9067284247ULL },  // 231
+    { 0x4F7D2A469372D370ULL, 0x711EF14052869B6CULL },  // 232
+    { 0x7F2EAA0A85848581ULL, 0x34FE4ECD50D75F14ULL },  // 233
+    { 0x65BEEE6ED136D134ULL, 0x2A650BD773DF7F43ULL },  // 234
+    { 0x51658B8BDA9240F6ULL, 0x551DA312C319329CULL },  // 235
+    { 0x411E093CAEDB672BULL, 0x5DB14F4235ADC217ULL },  // 236
+    { 0x68300EC77E2BD845ULL, 0x7C4EE536BC49368AULL },  // 237
+    { 0x5359A56C64EFE037ULL, 0x7D0BEA92303A9208ULL },  // 238
+    { 0x42AE1DF050BFE693ULL, 0x173CBBA8269541A0ULL },  // 239
+    { 0x6AB02FE6E79970EBULL, 0x3EC792A6A422029AULL },  // 240
+    { 0x5559BFEBEC7AC0BCULL, 0x3239421EE9B4CEE1ULL },  // 241
+    { 0x4447CCBCBD2F0096ULL, 0x5B6101B25490A581ULL },  // 242
+    { 0x6D3FADFAC84B3424ULL, 0x2BCE691D541AA268ULL },  // 243
+    { 0x576624C8A03C29B6ULL, 0x563EBA7DDCE21B87ULL },  // 244
+    { 0x45EB50A08030215EULL, 0x78322ECB171B4939ULL },  // 245
+    { 0x6FDEE76733803564ULL, 0x59E9E47824F87527ULL },  // 246
+    { 0x597F1F85C2CCF783ULL, 0x6187E9F9B72D2A86ULL },  // 247
+    { 0x4798E6049BD72C69ULL, 0x346CBB2E2C242205ULL },  // 248
+    { 0x728E3CD42C8B7A42ULL, 0x20ADF849E039D007ULL },  // 249
+    { 0x5BA4FD768A092E9BULL, 0x33BE603B19C7D99FULL },  // 250
+    { 0x4950CAC53B3A8BAFULL, 0x42FEB3627B0647B3ULL },  // 251
+    { 0x754E113B91F745E5ULL, 0x5197856A5E7072B8ULL },  // 252
+    { 0x5DD80DC941929E51ULL, 0x27AC6ABB7EC05BC6ULL },  // 253
+    { 0x4B133E3A9ADBB1DAULL, 0x52F05562CBCD1638ULL },  // 254
+    { 0x781EC9F75E2C4FC4ULL, 0x1E4D556ADFAE89F3ULL },  // 255
+    { 0x6018A192B1BD0C9CULL, 0x7EA444557FBED4C3ULL },  // 256
+    { 0x4CE0814227CA707DULL, 0x4BB69D1132FF109CULL },  // 257
+    { 0x7B00CED03FAA4D95ULL, 0x5F8A94E851981A93ULL },  // 258
+    { 0x62670BD9CC883E11ULL, 0x32D543ED0E134875ULL },  // 259
+    { 0x4EB8D647D6D364DAULL, 0x5BDDCFF0D80F6D2BULL },  // 260
+    { 0x7DF48A0C8AEBD491ULL, 0x12FC7FE7C018AEABULL },  // 261
+    { 0x64C3A1A3A25643A7ULL, 0x28C9FFEC99AD5889ULL },  // 262
+    { 0x509C814FB511CFB9ULL, 0x0707FFF07AF113A1ULL },  // 263
+    { 0x407D343FC40E3FC7ULL, 0x1F39998D2F2742E7ULL },  // 264
+    { 0x672EB9FFA016CC71ULL, 0x7EC28F484B7204A4ULL },  // 265
+    { 0x528BC7FFB345705BULL, 0x189BA5D36F8E6A1DULL },  // 266
+    { 0x42096CCC8F6AC048ULL, 0x7A161E42BFA521B1ULL },  // 267
+    { 0x69A8AE1418AACD41ULL, 0x435696D132A1CF81ULL },  // 268
+    { 0x5486F1A9AD557101ULL, 0x1C454574288172CEULL },  // 269
+    { 0x439F27BAF1112734ULL, 0x169DD129BA0128A5ULL },  // 270
+    { 0x6C31D92B1B4EA520ULL, 0x242FB50F9001DAA1ULL },  // 271
+    { 0x568E4755AF721DB3ULL, 0x368C90D940017BB4ULL },  // 272
+    { 0x453E9F77BF8E7E29ULL, 0x120A0D7A999AC95DULL },  // 273
+    { 0x6ECA98BF98E3FD0EULL, 0x50101590F5C47561ULL },  // 274
+    { 0x58A213CC7A4FFDA5ULL, 0x26734473F7D05DE8ULL },  // 275
+    { 0x46E80FD6C83FFE1DULL, 0x6B8F69F65FD9E4B9ULL },  // 276
+    { 0x71734C8AD9FFFCFCULL, 0x45B24323CC8FD45CULL },  // 277
+    { 0x5AC2A3A247FFFD96ULL, 0x6AF502830A0CA9E3ULL },  // 278
+    { 0x489BB61B6CCCCADFULL, 0x08C402026E7087E9ULL },  // 279
+    { 0x742C569247AE1164ULL, 0x746CD003E3E73FDBULL },  // 280
+    { 0x5CF04541D2F1A783ULL, 0x76BD73364FEC3315ULL },  // 281
+    { 0x4A59D101758E1F9CULL, 0x5EFDF5C50CBCF5ABULL },  // 282
+    { 0x76F61B3588E365C7ULL, 0x4B2FEFA1ADFB22ABULL },  // 283
+    { 0x5F2B48F7A0B5EB06ULL, 0x08F3261AF195B555ULL },  // 284
+    { 0x4C22A0C61A2B226BULL, 0x20C284E25ADE2AABULL },  // 285
+    { 0x79D1013CF6AB6A45ULL, 0x1AD0D49D5E304444ULL },  // 286
+    { 0x617400FD9222BB6AULL, 0x48A7107DE4F369D0ULL },  // 287
+    { 0x4DF6673141B562BBULL, 0x53B8D9FE50C2BB0DULL },  // 288
+    { 0x7CBD71E869223792ULL, 0x52C15CCA1AD12B48ULL },  // 289
+    { 0x63CAC186BA81C60EULL, 0x75677D6E7BDA8906ULL },  // 290
+    { 0x4FD5679EFB9B04D8ULL, 0x5DEC645863153A6CULL },  // 291
+    { 0x7FBBD8FE5F5E6E27ULL, 0x497A3A2704EEC3DFULL },  // 292
+};
+
+BSLMF_ASSERT(sizeof k_POWERS_OF_TEN / sizeof *k_POWERS_OF_TEN ==
+                   k_LARGEST_POWER_OF_TEN - k_SMALLEST_POWER_OF_TEN + 1);
+
+                       // ================================
+                       // floating-point support: integers
+                       // ================================
+
+inline
+void multiply(Uint64 *high, Uint64 *low, Uint64 lhs, Uint64 rhs)
+    // Load into the specified 'high' and 'low' the high and low 64-bit words
+    // of the 128-bit product of the specified 'lhs' and 'rhs'.
+{
+#if (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))      \
+ && defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 Uint128;
+
+    const Uint128 product = static_cast<Uint128>(lhs) * rhs;
+
+    *high = static_cast<Uint64>(product >> 64);
+    *low  = static_cast<Uint64>(product);
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+    *low = _umul128(lhs, rhs, high);
+#else
+    const Uint64 lhsLow  = lhs & 0xFFFFFFFF;
+    const Uint64 lhsHigh = lhs >> 32;
+    const Uint64 rhsLow  = rhs & 0xFFFFFFFF;
+    const Uint64 rhsHigh = rhs >> 32;
+
+    const Uint64 lowLow   = lhsLow  * rhsLow;
+    const Uint64 lowHigh  = lhsLow  * rhsHigh;
+    const Uint64 highLow  = lhsHigh * rhsLow;
+    const Uint64 highHigh = lhsHigh * rhsHigh;
+
+    const Uint64 middle = (lowLow >> 32)
+                        + (lowHigh & 0xFFFFFFFF)
+                        + (highLow & 0xFFFFFFFF);
+
+    *low  = (middle << 32) | (lowLow & 0xFFFFFFFF);
+    *high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#endif
+}
+
+inline
+int floorShift(Int64 value, int shift)
+    // Return 'floor(value / 2^shift)' for the specified 'value' and 'shift',
+    // without relying on the implementation-defined right shift of negative
+    // numbers.
+{
+    return static_cast<int>(0 <= value ? value >> shift
+                                       : ~(~value >> shift));
+}
+
+inline
+int floorLog10Pow2(int exponent)
+    // Return 'floor(log10(2^exponent))' for the specified 'exponent', which
+    // must be small in magnitude (as are all floating-point exponents).
+{
+    return floorShift(exponent * 661971961083LL, 41);
+}
+
+inline
+int floorLog10ThreeQuartersPow2(int exponent)
+    // Return 'floor(log10(3/4 * 2^exponent))' for the specified 'exponent',
+    // which must be small in magnitude.
+{
+    return floorShift(exponent * 661971961083LL - 274743187321LL, 41);
+}
+
+inline
+int floorLog2Pow10(int exponent)
+    // Return 'floor(log2(10^exponent))' for the specified 'exponent', which
+    // must be small in magnitude.
+{
+    return floorShift(exponent * 913124641741LL, 38);
+}
+
+                     // ===================================
+                     // floating-point support: decomposing
+                     // ===================================
+
+template <class FLOAT_TYPE>
+struct FloatingPointTraits;
+    // This 'struct' template provides the parameters of the IEEE-754 binary
+    // format of 'FLOAT_TYPE' needed to format it.
+
+template <>
+struct FloatingPointTraits<float> {
+    // This 'struct' provides the parameters of the IEEE-754 binary format of
+    // 'float'.
+
+    // TYPES
+    typedef unsigned Bits;
+
+    enum {
+        k_FRACTION_BITS    = 23,     // explicitly stored significand bits
+        k_EXPONENT_MASK    = 0xFF,   // biased exponent of 'inf' and 'nan'
+        k_MIN_EXPONENT     = -149,   // binary exponent of subnormals
+        k_MAX_INTEGER_DIGITS = 39    // decimal digits of the largest value
+    };
+};
+
+template <>
+struct FloatingPointTraits<double> {
+    // This 'struct' provides the parameters of the IEEE-754 binary format of
+    // 'double'.
+
+    // TYPES
+    typedef Uint64 Bits;
+
+    enum {
+        k_FRACTION_BITS      = 52,
+        k_EXPONENT_MASK      = 0x7FF,
+        k_MIN_EXPONENT       = -1074,
+        k_MAX_INTEGER_DIGITS = 309
+    };
+};
+
+enum Category {
+    // This enumeration classifies floating-point values for formatting.
+
+    e_FINITE,
+    e_INFINITE,
+    e_NAN
+};
+
+template <class FLOAT_TYPE>
+Category decompose(bool       *isNegative,
+                   Uint64     *significand,
+                   int        *exponent,
+                   FLOAT_TYPE  value)
+    // Load into the specified 'isNegative' whether the sign bit of the
+    // specified 'value' is set, and return its category.  If 'value' is
+    // finite, also load into the specified 'significand' and 'exponent'
+    // integers such that the magnitude of 'value' is
+    // 'significand * 2^exponent', and 'significand' has the bit
+    // '1 << k_FRACTION_BITS' set unless 'value' is zero or subnormal.
+{
+    typedef FloatingPointTraits<FLOAT_TYPE> Traits;
+    typedef typename Traits::Bits           Bits;
+
+    BSLMF_ASSERT(sizeof(Bits) == sizeof(FLOAT_TYPE));
+
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof bits);
+
+    const int  k_BITS = static_cast<int>(sizeof(Bits) * 8);
+    const Bits k_ONE  = 1;
+
+    *isNegative = 0 != bits >> (k_BITS - 1);
+
+    const Bits fraction = bits & ((k_ONE << Traits::k_FRACTION_BITS) - 1);
+    const int  biased   = static_cast<int>(bits >> Traits::k_FRACTION_BITS)
+                        & Traits::k_EXPONENT_MASK;
+
+    if (Traits::k_EXPONENT_MASK == biased) {
+        return 0 == fraction ? e_INFINITE : e_NAN;                    // RETURN
+    }
+
+    if (0 == biased) {
+        *significand = fraction;
+        *exponent    = Traits::k_MIN_EXPONENT;
+    }
+    else {
+        *significand = fraction | (k_ONE << Traits::k_FRACTION_BITS);
+        *exponent    = Traits::k_MIN_EXPONENT + biased - 1;
+    }
+    return e_FINITE;
+}
+
+                      // ================================
+                      // floating-point support: shortest
+                      // ================================
+
+inline
+Uint64 roundToOdd(const Uint64 *g, Uint64 cp)
+    // Return the integer part of 'g * cp / 2^127', with its least significant
+    // bit set if the fractional part is not zero, where 'g' is the 126-bit
+    // number whose high and low 63 bits are 'g[0]' and 'g[1]'.
+{
+    Uint64 x1, x0;
+    multiply(&x1, &x0, g[1], cp);
+
+    Uint64 y1, y0;
+    multiply(&y1, &y0, g[0], cp);
+
+    const Uint64 k_MASK_63 = (static_cast<Uint64>(1) << 63) - 1;
+
+    const Uint64 z   = (y0 >> 1) + x1;
+    const Uint64 vbp = y1 + (z >> 63);
+
+    return vbp | (((z & k_MASK_63) + k_MASK_63) >> 63);
+}
+
+inline
+unsigned roundToOdd(Uint64 g, Uint64 cp)
+    // Return the integer part of 'g * cp / 2^95', with its least significant
+    // bit set if the fractional part (of the high 64 bits of the product) is
+    // not zero.
+{
+    Uint64 x1, x0;
+    multiply(&x1, &x0, g, cp);
+
+    const Uint64 k_MASK_32 = 0xFFFFFFFF;
+
+    return static_cast<unsigned>((x1 >> 31)
+                               | (((x1 & k_MASK_32) + k_MASK_32) >> 32));
+}
+
+void shortestDecimal(Uint64 *decimalSignificand,
+                     int    *decimalExponent,
+                     Uint64  significand,
+                     int     exponent,
+                     double  *)
+    // Load into the specified 'decimalSignificand' and 'decimalExponent' the
+    // decimal 'd * 10^e' having the fewest significant digits that rounds to
+    // the positive 'double' 'significand * 2^exponent', choosing the closest
+    // such decimal (and the one with an even last digit on a tie).  The
+    // behavior is undefined unless 'significand' and 'exponent' are as
+    // produced by 'decompose' for a positive finite 'double'.
+{
+    typedef FloatingPointTraits<double> Traits;
+
+    const Uint64 k_MIN_NORMAL = static_cast<Uint64>(1)
+                                                    << Traits::k_FRACTION_BITS;
+
+    // Values that are integers are their own shortest representation.
+
+    if (exponent < 0 && -exponent <= Traits::k_FRACTION_BITS) {
+        const Uint64 integer = significand >> -exponent;
+        if (integer << -exponent == significand) {
+            *decimalSignificand = integer;
+            *decimalExponent    = 0;
+            return;                                                   // RETURN
+        }
+    }
+
+    // The value is 'c * 2^q', and the values halfway to its neighbors are
+    // 'cbl * 2^(q - 2)' and 'cbr * 2^(q - 2)'.  The decimal 's * 10^k' is
+    // computed such that '10^k' is no larger than the distance between those
+    // halfway points, so at most one multiple of '10^(k + 1)', and at least
+    // one multiple of '10^k', lies between them.
+
+    const Uint64 c   = significand;
+    const int    q   = exponent;
+    const Uint64 out = c & 1;
+    const Uint64 cb  = c << 2;
+    const Uint64 cbr = cb + 2;
+
+    Uint64 cbl;
+    int    k;
+    if (c != k_MIN_NORMAL || q == Traits::k_MIN_EXPONENT) {
+        cbl = cb - 2;
+        k   = floorLog10Pow2(q);
+    }
+    else {
+        // The next smaller value is closer than the next larger one.
+
+        cbl = cb - 1;
+        k   = floorLog10ThreeQuartersPow2(q);
+    }
+    const int h = q + floorLog2Pow10(-k) + 2;
+
+    BSLS_ASSERT_SAFE(k_SMALLEST_POWER_OF_TEN <= k);
+    BSLS_ASSERT_SAFE(k <= k_LARGEST_POWER_OF_TEN);
+
+    const Uint64 *g = k_POWERS_OF_TEN[k - k_SMALLEST_POWER_OF_TEN];
+
+    const Uint64 vb  = roundToOdd(g, cb  << h);
+    const Uint64 vbl = roundToOdd(g, cbl << h);
+    const Uint64 vbr = roundToOdd(g, cbr << h);
+
+    const Uint64 s = vb >> 2;
+
+    // First, try the (at most one) multiple of '10^(k + 1)' in range.
+
+    const Uint64 sp10 = s / 10 * 10;
+    const Uint64 tp10 = sp10 + 10;
+    const bool   upin = vbl + out <= sp10 << 2;
+    const bool   wpin = (tp10 << 2) + out <= vbr;
+    if (upin != wpin) {
+        *decimalSignificand = upin ? sp10 : tp10;
+        *decimalExponent    = k;
+        return;                                                       // RETURN
+    }
+
+    // Otherwise, choose between the multiples of '10^k' surrounding the
+    // value.
+
+    const Uint64 t   = s + 1;
+    const bool   uin = vbl + out <= s << 2;
+    const bool   win = (t << 2) + out <= vbr;
+    if (uin != win) {
+        *decimalSignificand = uin ? s : t;
+        *decimalExponent    = k;
+        return;                                                       // RETURN
+    }
+
+    const Uint64 twiceMidpoint = (s + t) << 1;
+    *decimalSignificand = vb < twiceMidpoint
+                       || (vb == twiceMidpoint && 0 == (s & 1)) ? s : t;
+    *decimalExponent    = k;
+}
+
+void shortestDecimal(Uint64 *decimalSignificand,
+                     int    *decimalExponent,
+                     Uint64  significand,
+                     int     exponent,
+                     float  *)
+    // Load into the specified 'decimalSignificand' and 'decimalExponent' the
+    // decimal 'd * 10^e' having the fewest significant digits that rounds to
+    // the positive 'float' 'significand * 2^exponent', choosing the closest
+    // such decimal (and the one with an even last digit on a tie).  The
+    // behavior is undefined unless 'significand' and 'exponent' are as
+    // produced by 'decompose' for a positive finite 'float'.
+{
+    typedef FloatingPointTraits<float> Traits;
+
+    const Uint64 k_MIN_NORMAL = static_cast<Uint64>(1)
+                                                    << Traits::k_FRACTION_BITS;
+
+    if (exponent < 0 && -exponent <= Traits::k_FRACTION_BITS) {
+        const Uint64 integer = significand >> -exponent;
+        if (integer << -exponent == significand) {
+            *decimalSignificand = integer;
+            *decimalExponent    = 0;
+            return;                                                   // RETURN
+        }
+    }
+
+    // This is the algorithm for 'double' (above), using only the high 63
+    // bits of the table entries, which suffice for the narrower 'float'.
+
+    const Uint64 c   = significand;
+    const int    q   = exponent;
+    const unsigned out = static_cast<unsigned>(c & 1);
+    const Uint64 cb  = c << 2;
+    const Uint64 cbr = cb + 2;
+
+    Uint64 cbl;
+    int    k;
+    if (c != k_MIN_NORMAL || q == Traits::k_MIN_EXPONENT) {
+        cbl = cb - 2;
+        k   = floorLog10Pow2(q);
+    }
+    else {
+        cbl = cb - 1;
+        k   = floorLog10ThreeQuartersPow2(q);
+    }
+    const int h = q + floorLog2Pow10(-k) + 33;
+
+    const Uint64 g = k_POWERS_OF_TEN[k - k_SMALLEST_POWER_OF_TEN][0] + 1;
+
+    const unsigned vb  = roundToOdd(g, cb  << h);
+    const unsigned vbl = roundToOdd(g, cbl << h);
+    const unsigned vbr = roundToOdd(g, cbr << h);
+
+    const unsigned s = vb >> 2;
+
+    const unsigned sp10 = s / 10 * 10;
+    const unsigned tp10 = sp10 + 10;
+    const bool     upin = vbl + out <= sp10 << 2;
+    const bool     wpin = (tp10 << 2) + out <= vbr;
+    if (upin != wpin) {
+        *decimalSignificand = upin ? sp10 : tp10;
+        *decimalExponent    = k;
+        return;                                                       // RETURN
+    }
+
+    const unsigned t   = s + 1;
+    const bool     uin = vbl + out <= s << 2;
+    const bool     win = (t << 2) + out <= vbr;
+    if (uin != win) {
+        *decimalSignificand = uin ? s : t;
+        *decimalExponent    = k;
+        return;                                                       // RETURN
+    }
+
+    const unsigned twiceMidpoint = (s + t) << 1;
+    *decimalSignificand = vb < twiceMidpoint
+                       || (vb == twiceMidpoint && 0 == (s & 1)) ? s : t;
+    *decimalExponent    = k;
+}
+
+                       // =============================
+                       // floating-point support: exact
+                       // =============================
+
+enum {
+    k_MAX_INTEGER_LIMBS = 34,  // 32-bit words of the largest 'double'
+    k_MAX_FRACTION_LIMBS = 35, // 32-bit words of the smallest 'double'
+    k_MAX_EXACT_DIGITS  = 1 + 309 + 1075
+                               // carry, integer digits, and fraction digits
+                               // of any 'double' (or 'float')
+};
+
+int integerDigits(char *result, Uint64 significand, int exponent)
+    // Write to the specified 'result' the decimal digits, without leading
+    // zeros, of the integer part of 'significand * 2^exponent' for the
+    // specified 'significand' and 'exponent', and return the number of
+    // digits written (0 if the integer part is zero).  The behavior is
+    // undefined unless 'significand < 2^53', 'exponent <= 971', and
+    // 'result' has room for 309 digits.
+{
+    if (exponent <= 0) {
+        const Uint64 integer = -exponent < 64 ? significand >> -exponent : 0;
+
+        return integer ? static_cast<int>(
+                                  toCharsBase10Uint64(result,
+                                                      result + 20,
+                                                      integer) - result)
+                       : 0;                                           // RETURN
+    }
+
+    if (exponent < 64 && 0 == significand >> (64 - exponent)) {
+        return static_cast<int>(toCharsBase10Uint64(result,
+                                                    result + 20,
+                                                    significand << exponent)
+                                - result);                            // RETURN
+    }
+
+    // Load the product into 32-bit words, least significant first.  Note
+    // that 'significand << bitShift' has at most 84 bits.
+
+    unsigned  limbs[k_MAX_INTEGER_LIMBS];
+    const int wordShift = exponent / 32;
+    const int bitShift  = exponent % 32;
+
+    BSLS_ASSERT_SAFE(wordShift + 3 <= k_MAX_INTEGER_LIMBS);
+
+    std::fill(limbs, limbs + wordShift, 0u);
+
+    const Uint64 low    = (significand & 0xFFFFFFFF) << bitShift;
+    const Uint64 middle = (low >> 32) + ((significand >> 32) << bitShift);
+
+    limbs[wordShift]     = static_cast<unsigned>(low);
+    limbs[wordShift + 1] = static_cast<unsigned>(middle);
+    limbs[wordShift + 2] = static_cast<unsigned>(middle >> 32);
+
+    int numLimbs = wordShift + 3;
+    while (0 == limbs[numLimbs - 1]) {
+        --numLimbs;
+    }
+
+    // Divide by 10^9 repeatedly, collecting the remainders, which are the
+    // groups of nine digits from least to most significant.
+
+    const unsigned k_BILLION = 1000 * 1000 * 1000;
+
+    unsigned groups[(k_MAX_INTEGER_LIMBS * 32 + 28) / 29];
+    int      numGroups = 0;
+    while (0 < numLimbs) {
+        Uint64 remainder = 0;
+        for (int i = numLimbs - 1; 0 <= i; --i) {
+            const Uint64 dividend = (remainder << 32) | limbs[i];
+
+            limbs[i]  = static_cast<unsigned>(dividend / k_BILLION);
+            remainder = dividend % k_BILLION;
+        }
+        groups[numGroups++] = static_cast<unsigned>(remainder);
+
+        while (0 < numLimbs && 0 == limbs[numLimbs - 1]) {
+            --numLimbs;
+        }
+    }
+
+    char *end = toCharsBase10Uint32(result, result + 10, groups[--numGroups]);
+    while (0 < numGroups) {
+        unsigned group = groups[--numGroups];
+        for (int i = 8; 0 <= i; --i) {
+            end[i] = static_cast<char>('0' + group % 10);
+            group /= 10;
+        }
+        end += 9;
+    }
+    return static_cast<int>(end - result);
+}
+
+class FractionDigits {
+    // This mechanism generates, in order, the decimal digits of the
+    // fractional part of a binary floating-point value.  Note that the
+    // fraction of a value with 'n' fraction bits has exactly 'n' decimal
+    // digits.
+
+    // DATA
+    Uint64   d_small;       // fraction, times '2^d_numBits', if it is "small"
+    int      d_numBits;     // number of fraction bits if "small", or 0
+
+    unsigned d_limbs[k_MAX_FRACTION_LIMBS];
+                            // fraction, as the sum of 'd_limbs[i]' times
+                            // '2^(-32 * (i + 1))', if it is not "small"
+
+    int      d_numLimbs;    // number of leading limbs that may be non-zero
+
+    char     d_digits[9];   // digits generated, but not yet returned
+    int      d_digitIndex;  // index of the next digit in 'd_digits' to return
+
+  private:
+    // NOT IMPLEMENTED
+    FractionDigits(const FractionDigits&);
+    FractionDigits& operator=(const FractionDigits&);
+
+  public:
+    // CREATORS
+    FractionDigits(Uint64 significand, int exponent);
+        // Create an object generating the digits of the fractional part of
+        // 'significand * 2^exponent' for the specified 'significand' and
+        // 'exponent'.  The behavior is undefined unless
+        // 'significand < 2^53' and '-1074 <= exponent'.
+
+    // MANIPULATORS
+    int nextDigit();
+        // Return the next digit of the fraction.
+
+    // ACCESSORS
+    bool isZero() const;
+        // Return 'true' if all remaining digits of the fraction are zero,
+        // and 'false' otherwise.
+};
+
+                            // --------------------
+                            // class FractionDigits
+                            // --------------------
+
+// CREATORS
+FractionDigits::FractionDigits(Uint64 significand, int exponent)
+: d_small(0)
+, d_numBits(0)
+, d_numLimbs(0)
+, d_digitIndex(9)
+{
+    // A fraction of up to 60 bits can be multiplied by 10 without overflow.
+
+    if (0 <= exponent) {
+        return;                                                       // RETURN
+    }
+
+    const int numBits = -exponent;
+    if (numBits <= 60) {
+        d_numBits = numBits;
+        d_small   = significand & ((static_cast<Uint64>(1) << numBits) - 1);
+        return;                                                       // RETURN
+    }
+
+    // Here, the whole 'significand' is fractional.  Align it so that the
+    // fraction ends at the end of a limb.
+
+    const int numLimbs = (numBits + 31) / 32;
+    const int shift    = numLimbs * 32 - numBits;
+
+    BSLS_ASSERT_SAFE(numLimbs <= k_MAX_FRACTION_LIMBS);
+
+    const Uint64 low    = (significand & 0xFFFFFFFF) << shift;
+    const Uint64 middle = (low >> 32) + ((significand >> 32) << shift);
+
+    std::fill(d_limbs, d_limbs + numLimbs, 0u);
+
+    d_limbs[numLimbs - 1] = static_cast<unsigned>(low);
+    d_limbs[numLimbs - 2] = static_cast<unsigned>(middle);
+    if (2 < numLimbs) {
+        d_limbs[numLimbs - 3] = static_cast<unsigned>(middle >> 32);
+    }
+    d_numLimbs = numLimbs;
+    while (0 < d_numLimbs && 0 == d_limbs[d_numLimbs - 1]) {
+        --d_numLimbs;
+    }
+}
+
+// MANIPULATORS
+int FractionDigits::nextDigit()
+{
+    if (d_numBits) {
+        d_small *= 10;
+
+        const int digit = static_cast<int>(d_small >> d_numBits);
+        d_small &= (static_cast<Uint64>(1) << d_numBits) - 1;
+        return digit;                                                 // RETURN
+    }
+
+    if (9 == d_digitIndex) {
+        // Multiply the fraction by 10^9: the integer part of the product is
+        // the next nine digits.
+
+        Uint64 carry = 0;
+        for (int i = d_numLimbs - 1; 0 <= i; --i) {
+            const Uint64 product = static_cast<Uint64>(d_limbs[i])
+                                                      * 1000000000 + carry;
+
+            d_limbs[i] = static_cast<unsigned>(product);
+            carry      = product >> 32;
+        }
+        while (0 < d_numLimbs && 0 == d_limbs[d_numLimbs - 1]) {
+            --d_numLimbs;
+        }
+
+        for (int i = 8; 0 <= i; --i) {
+            d_digits[i] = static_cast<char>(carry % 10);
+            carry /= 10;
+        }
+        d_digitIndex = 0;
+    }
+    return d_digits[d_digitIndex++];
+}
+
+// ACCESSORS
+bool FractionDigits::isZero() const
+{
+    if (d_numBits) {
+        return 0 == d_small;                                          // RETURN
+    }
+
+    if (0 < d_numLimbs) {
+        return false;                                                 // RETURN
+    }
+
+    for (int i = d_digitIndex; i < 9; ++i) {
+        if (d_digits[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+const char *exactDigits(char   *buffer,
+                        int    *numDigits,
+                        int    *decimalExponent,
+                        Uint64  significand,
+                        int     exponent,
+                        int     precision,
+                        bool    isFixed)
+    // Round the value 'significand * 2^exponent', for the specified
+    // 'significand' and 'exponent', to a decimal, exactly and with ties
+    // rounded to even, and write its digits to the specified 'buffer', which
+    // must have room for 'k_MAX_EXACT_DIGITS' digits.  If the specified
+    // 'isFixed' is 'true', round to the specified 'precision' fraction
+    // digits, and round to 'precision' significant digits otherwise.  Return
+    // the address of the first digit, and load into the specified
+    // 'numDigits' the number of digits and into the specified
+    // 'decimalExponent' the power of ten of the first digit.  Digits beyond
+    // the last one written are zero.  If 'isFixed' is 'true', the first digit
+    // is the most significant digit of the integer part, or, if that is
+    // zero, the first fraction digit; otherwise the first digit is non-zero
+    // unless the value is zero.  The behavior is undefined unless
+    // '0 <= precision', and '0 < precision' if 'isFixed' is 'false'.
+{
+    char *digits = buffer + 1;  // leave room for a carry
+    int   count  = integerDigits(digits, significand, exponent);
+    int   point;
+    int   numKept;
+
+    FractionDigits fraction(significand, exponent);
+
+    if (isFixed) {
+        point   = count ? count - 1 : -1;
+        numKept = point + 1 + precision;
+    }
+    else {
+        if (0 == count) {
+            if (fraction.isZero()) {
+                digits[0]        = '0';
+                *numDigits       = 1;
+                *decimalExponent = 0;
+                return digits;                                        // RETURN
+            }
+
+            // Skip the leading zeros of the fraction.
+
+            int digit;
+            point = -1;
+            while (0 == (digit = fraction.nextDigit())) {
+                --point;
+            }
+            digits[count++] = static_cast<char>('0' + digit);
+        }
+        else {
+            point = count - 1;
+        }
+        numKept = precision;
+    }
+
+    while (count < numKept && !fraction.isZero()) {
+        digits[count++] = static_cast<char>('0' + fraction.nextDigit());
+    }
+
+    if (count < numKept) {
+        // The value is exact.
+
+        *numDigits       = count;
+        *decimalExponent = point;
+        return digits;                                                // RETURN
+    }
+
+    // Round to 'numKept' digits, considering the next digit and whether any
+    // digit after it is non-zero.
+
+    int  roundingDigit;
+    bool isSticky = !fraction.isZero();
+    if (numKept < count) {
+        roundingDigit = digits[numKept] - '0';
+        for (int i = numKept + 1; i < count && !isSticky; ++i) {
+            isSticky = '0' != digits[i];
+        }
+    }
+    else {
+        roundingDigit = isSticky ? fraction.nextDigit() : 0;
+        isSticky      = !fraction.isZero();
+    }
+    count = numKept;
+
+    const bool isOdd = 0 < count && ((digits[count - 1] - '0') & 1);
+    if (5 < roundingDigit || (5 == roundingDigit && (isSticky || isOdd))) {
+        int i = count - 1;
+        while (0 <= i && '9' == digits[i]) {
+            digits[i--] = '0';
+        }
+        if (0 <= i) {
+            ++digits[i];
+        }
+        else {
+            // All digits were nines: the value is now a power of ten.
+
+            *--digits = '1';
+            ++point;
+            if (isFixed) {
+                ++count;
+            }
+        }
+    }
+
+    *numDigits       = count;
+    *decimalExponent = point;
+    return digits;
+}
+
+                       // ==============================
+                       // floating-point support: layout
+                       // ==============================
+
+inline
+int exponentLength(int exponent)
+    // Return the number of characters of the exponent suffix, such as
+    // "e+05", for the specified decimal 'exponent'.
+{
+    const int magnitude = exponent < 0 ? -exponent : exponent;
+    return 2 + (100 <= magnitude ? 3 : 2);
+}
+
+char *writeScientific(char       *first,
+                      char       *last,
+                      bool        isNegative,
+                      const char *digits,
+                      int         numDigits,
+                      int         exponent,
+                      int         numFractionDigits)
+    // Write to the buffer '[ first .. last )' the number having the specified
+    // sign 'isNegative', the specified 'numDigits' 'digits' (followed by
+    // zeros), and the power of ten 'exponent' of the first digit, in
+    // scientific notation with the specified 'numFractionDigits' digits after
+    // the decimal point (which is omitted if 'numFractionDigits' is 0), and
+    // return the end of the written characters, or 0 if they do not fit.
+{
+    const int length = isNegative
+                     + 1
+                     + (numFractionDigits ? 1 + numFractionDigits : 0)
+                     + exponentLength(exponent);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(last - first < length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        return 0;                                                     // RETURN
+    }
+
+    if (isNegative) {
+        *first++ = '-';
+    }
+    *first++ = 0 < numDigits ? digits[0] : '0';
+
+    if (numFractionDigits) {
+        *first++ = '.';
+
+        const int numCopied = std::max(
+                             std::min(numDigits - 1, numFractionDigits), 0);
+
+        std::memcpy(first, digits + 1, numCopied);
+        first += numCopied;
+
+        const int numZeros = numFractionDigits - numCopied;
+        std::memset(first, '0', numZeros);
+        first += numZeros;
+    }
+
+    *first++ = 'e';
+    *first++ = exponent < 0 ? '-' : '+';
+
+    unsigned magnitude = exponent < 0 ? -exponent : exponent;
+    if (100 <= magnitude) {
+        *first++ = static_cast<char>('0' + magnitude / 100);
+        magnitude %= 100;
+    }
+    *first++ = twoDigitStrings[magnitude * 2];
+    *first++ = twoDigitStrings[magnitude * 2 + 1];
+
+    return first;
+}
+
+char *writeFixed(char       *first,
+                 char       *last,
+                 bool        isNegative,
+                 const char *digits,
+                 int         numDigits,
+                 int         exponent,
+                 int         numFractionDigits)
+    // Write to the buffer '[ first .. last )' the number having the specified
+    // sign 'isNegative', the specified 'numDigits' 'digits' (followed by
+    // zeros), and the power of ten 'exponent' of the first digit, in fixed
+    // notation with the specified 'numFractionDigits' digits after the
+    // decimal point (which is omitted if 'numFractionDigits' is 0), and
+    // return the end of the written characters, or 0 if they do not fit.
+    // The behavior is undefined unless '-1 <= exponent' or the digits are
+    // all fraction digits.
+{
+    const int integerLength = 0 <= exponent ? exponent + 1 : 1;
+    const int length        = isNegative
+                            + integerLength
+                            + (numFractionDigits ? 1 + numFractionDigits : 0);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(last - first < length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        return 0;                                                     // RETURN
+    }
+
+    if (isNegative) {
+        *first++ = '-';
+    }
+
+    // 'position' is the index in 'digits' of the next digit to write, which
+    // is negative while leading zeros of the fraction are written.
+
+    int position;
+    if (0 <= exponent) {
+        const int numCopied = std::min(numDigits, integerLength);
+
+        std::memcpy(first, digits, numCopied);
+        std::memset(first + numCopied, '0', integerLength - numCopied);
+        first    += integerLength;
+        position  = integerLength;
+    }
+    else {
+        *first++ = '0';
+        position = exponent + 1;
+    }
+
+    if (numFractionDigits) {
+        *first++ = '.';
+
+        char *const end = first + numFractionDigits;
+
+        if (position < 0) {
+            const int numZeros = std::min(-position, numFractionDigits);
+
+            std::memset(first, '0', numZeros);
+            first    += numZeros;
+            position += numZeros;
+        }
+        if (position < numDigits && first < end) {
+            const int numCopied = std::min(numDigits - position,
+                                           static_cast<int>(end - first));
+
+            std::memcpy(first, digits + position, numCopied);
+            first += numCopied;
+        }
+        std::memset(first, '0', end - first);
+        first = end;
+    }
+
+    return first;
+}
+
+char *writeSpecial(char *first, char *last, bool isNegative, Category category)
+    // Write to the buffer '[ first .. last )' the representation of the
+    // infinity or NaN of the specified 'category' having the sign
+    // 'isNegative', and return the end of the written characters, or 0 if
+    // they do not fit.
+{
+    const char *text = e_INFINITE == category ? "-inf" : "-nan";
+    if (!isNegative) {
+        ++text;
+    }
+
+    const int length = static_cast<int>(std::strlen(text));
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(last - first < length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        return 0;                                                     // RETURN
+    }
+
+    std::memcpy(first, text, length);
+    return first + length;
+}
+
+char *writeHex(char   *first,
+               char   *last,
+               bool    isNegative,
+               Uint64  significand,
+               int     exponent,
+               int     numFractionBits,
+               int     precision)
+    // Write to the buffer '[ first .. last )' the number having the specified
+    // sign 'isNegative' and the magnitude 'significand * 2^exponent', in
+    // hexadecimal notation having one digit before the (hexadecimal) point
+    // and, if the specified 'precision' is non-negative, 'precision' digits
+    // after it, or, otherwise, as few as are needed to represent the value
+    // exactly.  The specified 'numFractionBits' is the number of bits of
+    // 'significand' after the point.  Return the end of the written
+    // characters, or 0 if they do not fit.
+{
+    static const char k_HEX_DIGITS[] = "0123456789abcdef";
+
+    // Align the fraction to a whole number of hex digits.
+
+    const int numHexDigits = (numFractionBits + 3) / 4;
+    const int alignment    = numHexDigits * 4 - numFractionBits;
+
+    Uint64 leading  = significand >> numFractionBits;
+    Uint64 fraction = (significand
+                       & ((static_cast<Uint64>(1) << numFractionBits) - 1))
+                                                                  << alignment;
+    int    binaryExponent = 0 == significand ? 0 : exponent + numFractionBits;
+    int    numWritten;      // number of fraction digits to write
+
+    if (precision < 0) {
+        numWritten = numHexDigits;
+        while (0 < numWritten && 0 == (fraction & 0xF)) {
+            fraction >>= 4;
+            --numWritten;
+        }
+    }
+    else if (precision < numHexDigits) {
+        // Round, to even, the leading digit and fraction together.
+
+        const int    dropped  = (numHexDigits - precision) * 4;
+        const Uint64 half     = static_cast<Uint64>(1) << (dropped - 1);
+        const Uint64 rest     = fraction & ((half << 1) - 1);
+        Uint64       combined = (leading << (precision * 4))
+                              | (fraction >> dropped);
+
+        if (half < rest || (half == rest && (combined & 1))) {
+            ++combined;
+        }
+        leading    = combined >> (precision * 4);
+        fraction   = combined
+                   & ((static_cast<Uint64>(1) << (precision * 4)) - 1);
+        numWritten = precision;
+    }
+    else {
+        numWritten = numHexDigits;
+    }
+
+    const int numZeros  = 0 <= precision && numWritten < precision
+                        ? precision - numWritten
+                        : 0;
+    const int numPoint  = numWritten + numZeros ? 1 : 0;
+
+    const unsigned magnitude = binaryExponent < 0 ? -binaryExponent
+                                                  : binaryExponent;
+    char  exponentBuffer[8];
+    char *exponentEnd = toCharsBase10Uint32(exponentBuffer,
+                                            exponentBuffer + 8,
+                                            magnitude);
+    const int exponentDigits = static_cast<int>(exponentEnd - exponentBuffer);
+
+    const int length = isNegative + 1 + numPoint + numWritten + numZeros
+                     + 2 + exponentDigits;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(last - first < length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        return 0;                                                     // RETURN
+    }
+
+    if (isNegative) {
+        *first++ = '-';
+    }
+    *first++ = k_HEX_DIGITS[leading];
+    if (numPoint) {
+        *first++ = '.';
+    }
+    for (int i = numWritten - 1; 0 <= i; --i) {
+        *first++ = k_HEX_DIGITS[(fraction >> (i * 4)) & 0xF];
+    }
+    std::memset(first, '0', numZeros);
+    first += numZeros;
+
+    *first++ = 'p';
+    *first++ = binaryExponent < 0 ? '-' : '+';
+    std::memcpy(first, exponentBuffer, exponentDigits);
+
+    return first + exponentDigits;
+}
+
+                      // ================================
+                      // floating-point support: dispatch
+                      // ================================
+
+enum {
+    k_PLAIN = 0  // the format of 'toChars' when no format is specified
+};
+
+template <class FLOAT_TYPE>
+char *formatShortest(char       *first,
+                     char       *last,
+                     FLOAT_TYPE  value,
+                     int         format)
+    // Write to the buffer '[ first .. last )' the shortest representation of
+    // the specified 'value' in the specified 'format' (which is one of the
+    // 'NumericFormatterUtil::Format' enumerators, or 'k_PLAIN') that
+    // round-trips, and return the end of the written characters, or 0 if
+    // they do not fit.
+{
+    typedef FloatingPointTraits<FLOAT_TYPE> Traits;
+
+    bool   isNegative;
+    Uint64 significand;
+    int    exponent;
+
+    const Category category = decompose(&isNegative,
+                                        &significand,
+                                        &exponent,
+                                        value);
+    if (e_FINITE != category) {
+        return writeSpecial(first, last, isNegative, category);       // RETURN
+    }
+
+    if (bslalg::NumericFormatterUtil::e_HEX == format) {
+        return writeHex(first,
+                        last,
+                        isNegative,
+                        significand,
+                        exponent,
+                        Traits::k_FRACTION_BITS,
+                        -1);                                          // RETURN
+    }
+
+    char digits[20];
+    int  numDigits   = 1;
+    int  pointExponent = 0;  // power of ten of the first digit
+    if (0 == significand) {
+        digits[0] = '0';
+    }
+    else {
+        Uint64 decimalSignificand;
+        int    decimalExponent;
+        shortestDecimal(&decimalSignificand,
+                        &decimalExponent,
+                        significand,
+                        exponent,
+                        static_cast<FLOAT_TYPE *>(0));
+
+        numDigits = static_cast<int>(toCharsBase10Uint64(digits,
+                                                         digits + 20,
+                                                         decimalSignificand)
+                                     - digits);
+        pointExponent = decimalExponent + numDigits - 1;
+        while ('0' == digits[numDigits - 1]) {
+            --numDigits;
+        }
+    }
+
+    // Fixed notation cannot drop the digits of an integer, so the integers
+    // too large to be represented exactly by the shortest decimal (those
+    // with a positive binary exponent) are written exactly instead.
+
+    const bool isLargeInteger = 0 < exponent && 0 != significand;
+
+    bool isFixed;
+    switch (format) {
+      case bslalg::NumericFormatterUtil::e_FIXED: {
+        isFixed = true;
+      } break;
+      case bslalg::NumericFormatterUtil::e_SCIENTIFIC: {
+        isFixed = false;
+      } break;
+      case bslalg::NumericFormatterUtil::e_GENERAL: {
+        // As 'printf' with the "%g" conversion and its default precision.
+
+        isFixed = -4 <= pointExponent && pointExponent < 6;
+      } break;
+      default: {
+        // The shorter of fixed and scientific notation, preferring fixed.
+
+        const int scientificLength = numDigits
+                                   + (1 < numDigits)
+                                   + exponentLength(pointExponent);
+
+        if (isLargeInteger) {
+            // Note that the exact integer has at least as many digits as
+            // 'pointExponent'.
+
+            if (scientificLength < pointExponent) {
+                isFixed = false;
+            }
+            else {
+                char integer[Traits::k_MAX_INTEGER_DIGITS];
+                isFixed = integerDigits(integer, significand, exponent)
+                                                          <= scientificLength;
+            }
+        }
+        else {
+            const int fixedLength = 0 <= pointExponent
+                                  ? std::max(numDigits, pointExponent + 1)
+                                    + (pointExponent + 1 < numDigits)
+                                  : numDigits + 1 - pointExponent;
+
+            isFixed = fixedLength <= scientificLength;
+        }
+      } break;
+    }
+
+    if (!isFixed) {
+        return writeScientific(first,
+                               last,
+                               isNegative,
+                               digits,
+                               numDigits,
+                               pointExponent,
+                               numDigits - 1);                        // RETURN
+    }
+
+    if (isLargeInteger) {
+        char      integer[Traits::k_MAX_INTEGER_DIGITS];
+        const int numIntegerDigits = integerDigits(integer,
+                                                   significand,
+                                                   exponent);
+        return writeFixed(first,
+                          last,
+                          isNegative,
+                          integer,
+                          numIntegerDigits,
+                          numIntegerDigits - 1,
+                          0);                                         // RETURN
+    }
+
+    return writeFixed(first,
+                      last,
+                      isNegative,
+                      digits,
+                      numDigits,
+                      pointExponent,
+                      std::max(numDigits - 1 - pointExponent, 0));
+}
+
+template <class FLOAT_TYPE>
+char *formatWithPrecision(char       *first,
+                          char       *last,
+                          FLOAT_TYPE  value,
+                          int         format,
+                          int         precision)
+    // Write to the buffer '[ first .. last )' the specified 'value' in the
+    // specified 'format' (one of the 'NumericFormatterUtil::Format'
+    // enumerators) with the specified 'precision', as 'printf' would with the
+    // corresponding conversion ("%e", "%f", "%g", or "%a"), and return the
+    // end of the written characters, or 0 if they do not fit.  A negative
+    // 'precision' is treated as 'printf' treats an omitted one.
+{
+    typedef FloatingPointTraits<FLOAT_TYPE> Traits;
+
+    bool   isNegative;
+    Uint64 significand;
+    int    exponent;
+
+    const Category category = decompose(&isNegative,
+                                        &significand,
+                                        &exponent,
+                                        value);
+    if (e_FINITE != category) {
+        return writeSpecial(first, last, isNegative, category);       // RETURN
+    }
+
+    if (bslalg::NumericFormatterUtil::e_HEX == format) {
+        return writeHex(first,
+                        last,
+                        isNegative,
+                        significand,
+                        exponent,
+                        Traits::k_FRACTION_BITS,
+                        precision);                                   // RETURN
+    }
+
+    if (precision < 0) {
+        precision = 6;
+    }
+
+    char        buffer[k_MAX_EXACT_DIGITS];
+    int         numDigits;
+    int         pointExponent;
+    const char *digits;
+
+    switch (format) {
+      case bslalg::NumericFormatterUtil::e_FIXED: {
+        digits = exactDigits(buffer,
+                             &numDigits,
+                             &pointExponent,
+                             significand,
+                             exponent,
+                             precision,
+                             true);
+        return writeFixed(first,
+                          last,
+                          isNegative,
+                          digits,
+                          numDigits,
+                          pointExponent,
+                          precision);                                 // RETURN
+      } break;
+      case bslalg::NumericFormatterUtil::e_SCIENTIFIC: {
+        digits = exactDigits(buffer,
+                             &numDigits,
+                             &pointExponent,
+                             significand,
+                             exponent,
+                             precision + 1,
+                             false);
+        return writeScientific(first,
+                               last,
+                               isNegative,
+                               digits,
+                               numDigits,
+                               pointExponent,
+                               precision);                            // RETURN
+      } break;
+      default: {
+        BSLS_ASSERT_SAFE(bslalg::NumericFormatterUtil::e_GENERAL == format);
+      } break;
+    }
+
+    // Use fixed notation if the exponent in scientific notation would be
+    // less than the precision and at least -4, and drop trailing zeros.
+
+    const int numSignificant = precision ? precision : 1;
+
+    digits = exactDigits(buffer,
+                         &numDigits,
+                         &pointExponent,
+                         significand,
+                         exponent,
+                         numSignificant,
+                         false);
+    while (0 < numDigits && '0' == digits[numDigits - 1]) {
+        --numDigits;
+    }
+
+    if (-4 <= pointExponent && pointExponent < numSignificant) {
+        return writeFixed(first,
+                          last,
+                          isNegative,
+                          digits,
+                          numDigits,
+                          pointExponent,
+                          std::max(numDigits - 1 - pointExponent, 0));
+                                                                      // RETURN
+    }
+    return writeScientific(first,
+                           last,
+                           isNegative,
+                           digits,
+                           numDigits,
+                           pointExponent,
+                           std::max(numDigits - 1, 0));
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -470,6 +2388,66 @@ char *NumericFormatterUtil::toCharsImpl(char                *first,
     return u::toCharsArbitraryBaseUint64(first, last, value, base);
 }
 
+char *NumericFormatterUtil::toChars(char   *first,
+                                    char   *last,
+                                    double  value) BSLS_KEYWORD_NOEXCEPT
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    return u::formatShortest(first, last, value, u::k_PLAIN);
+}
+
+char *NumericFormatterUtil::toChars(char   *first,
+                                    char   *last,
+                                    float   value) BSLS_KEYWORD_NOEXCEPT
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    return u::formatShortest(first, last, value, u::k_PLAIN);
+}
+
+char *NumericFormatterUtil::toChars(char   *first,
+                                    char   *last,
+                                    double  value,
+                                    Format  format) BSLS_KEYWORD_NOEXCEPT
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    return u::formatShortest(first, last, value, format);
+}
+
+char *NumericFormatterUtil::toChars(char   *first,
+                                    char   *last,
+                                    float   value,
+                                    Format  format) BSLS_KEYWORD_NOEXCEPT
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    return u::formatShortest(first, last, value, format);
+}
+
+char *NumericFormatterUtil::toChars(char   *first,
+                                    char   *last,
+                                    double  value,
+                                    Format  format,
+                                    int     precision) BSLS_KEYWORD_NOEXCEPT
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    return u::formatWithPrecision(first, last, value, format, precision);
+}
+
+char *NumericFormatterUtil::toChars(char   *first,
+                                    char   *last,
+                                    float   value,
+                                    Format  format,
+                                    int     precision) BSLS_KEYWORD_NOEXCEPT
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    return u::formatWithPrecision(first, last, value, format, precision);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -13,7 +13,43 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component, 'bslalg_numericformatterutil' provides a
 // namespace 'struct', 'bslalg::NumericFormatterUtil', containing the template
 // function 'toChars', that translates integral fundamental types into ASCII
-// strings.
+// strings, and non-template overloads of 'toChars' that translate 'float'
+// and 'double' values into ASCII strings.
+//
+///Floating-Point Formatting
+///-------------------------
+// The floating-point overloads of 'toChars' provide the semantics of the
+// floating-point 'std::to_chars' functions of C++17.  Without a precision,
+// they write the shortest representation that round-trips: the fewest
+// significant digits that, when parsed (e.g., by 'strtod'), yield exactly
+// the original value, choosing, if several such representations have the
+// fewest digits, the one closest to the value.  The format is selected by an
+// optional 'NumericFormatterUtil::Format' argument:
+//: o No format: the shorter of fixed and scientific notation, preferring
+//:   fixed notation on a tie.
+//:
+//: o 'e_FIXED': fixed notation, e.g., "1234.5" (integers too large to be
+//:   represented exactly with the shortest digits are written exactly).
+//:
+//: o 'e_SCIENTIFIC': scientific notation, e.g., "1.2345e+03".
+//:
+//: o 'e_GENERAL': fixed notation if the decimal exponent is at least -4 and
+//:   less than 6, and scientific notation otherwise (as "%g" in 'printf').
+//:
+//: o 'e_HEX': hexadecimal notation without a "0x" prefix, e.g.,
+//:   "1.34a456d5cfaadp+10".
+//
+// With a precision, they write exactly what 'printf' would write with the
+// "%.*f", "%.*e", "%.*g", and "%.*a" conversions, respectively, in the "C"
+// locale: the value is rounded exactly, with ties rounded to even.  Infinity
+// is written as "inf" and NaN as "nan", preceded by '-' if the sign bit is
+// set.
+//
+// The shortest digits are computed by the Schubfach algorithm, which needs
+// only a few 64x128-bit multiplications against a table of powers of ten and
+// no loops, making 'toChars' several times faster than 'snprintf' for typical
+// values.  Note that formatting with a precision uses exact multi-precision
+// arithmetic, which is slower for very large precisions.
 //
 ///Usage
 ///-----
@@ -59,6 +95,53 @@ BSLS_IDENT("$Id: $")
 //      result->sputn(buffer, ret - buffer);
 //  }
 //..
+//
+///Example 2: Writing a 'double' That Round-Trips
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write a 'double' as text such that parsing the text
+// restores the same value, using as few characters as possible.
+//
+// First, we declare a buffer long enough for any 'double' in its shortest
+// form, which is 24 characters (e.g., "-2.2250738585072014e-308"):
+//..
+//  char buffer[24];
+//..
+// Then, we write a value that 'printf' with "%g" would render with too few
+// digits to round-trip:
+//..
+//  char *end = bslalg::NumericFormatterUtil::toChars(buffer,
+//                                                    buffer + sizeof buffer,
+//                                                    0.1 + 0.2);
+//  assert(19 == end - buffer);
+//  assert(0  == std::memcmp(buffer, "0.30000000000000004", 19));
+//..
+// Next, we observe that values that are short in decimal are written
+// briefly, choosing fixed or scientific notation, whichever is shorter:
+//..
+//  end = bslalg::NumericFormatterUtil::toChars(buffer,
+//                                              buffer + sizeof buffer,
+//                                              1e22);
+//  assert(5 == end - buffer);
+//  assert(0 == std::memcmp(buffer, "1e+22", 5));
+//
+//  end = bslalg::NumericFormatterUtil::toChars(buffer,
+//                                              buffer + sizeof buffer,
+//                                              1.5f);
+//  assert(3 == end - buffer);
+//  assert(0 == std::memcmp(buffer, "1.5", 3));
+//..
+// Finally, we write a value with a fixed number of decimal places, exactly as
+// 'printf' would with "%.2f", but without regard to the locale:
+//..
+//  end = bslalg::NumericFormatterUtil::toChars(
+//                                    buffer,
+//                                    buffer + sizeof buffer,
+//                                    2.675,
+//                                    bslalg::NumericFormatterUtil::e_FIXED,
+//                                    2);
+//  assert(4 == end - buffer);
+//  assert(0 == std::memcmp(buffer, "2.67", 4));  // 2.675 is 2.67499999...
+//..
 
 #include <bslscm_version.h>
 
@@ -81,6 +164,20 @@ namespace bslalg {
 class NumericFormatterUtil {
     // Namespace 'class' for free functions supporting 'to_chars'.
 
+  public:
+    // TYPES
+    enum Format {
+        // This enumeration selects the notation in which floating-point
+        // values are written.  Note that the values of the enumerators match
+        // those of 'bslstl::chars_format'.
+
+        e_SCIENTIFIC = 1,                      // "1.2345e+03"
+        e_FIXED      = 2,                      // "1234.5"
+        e_HEX        = 4,                      // "1.34a456d5cfaadp+10"
+        e_GENERAL    = e_FIXED | e_SCIENTIFIC  // as "%g" in 'printf'
+    };
+
+  private:
     // PRIVATE CLASS METHODS
     static char *toCharsImpl(char     *first,
                              char     *last,
@@ -127,6 +224,56 @@ class NumericFormatterUtil {
         // 'first' with leftover room following the return value.  The behavior
         // is undefined unless 'first < last' and 'base' is in the range
         // '[ 2 .. 36 ]'.
+
+    static char *toChars(char   *first,
+                         char   *last,
+                         double  value) BSLS_KEYWORD_NOEXCEPT;
+    static char *toChars(char   *first,
+                         char   *last,
+                         float   value) BSLS_KEYWORD_NOEXCEPT;
+        // Write the shortest representation of the specified 'value' that
+        // round-trips, in the shorter of fixed and scientific notation (see
+        // {Floating-Point Formatting}), into the character buffer starting at
+        // the specified 'first' and ending at the specified 'last'.  Return
+        // the address one past the last character written on success, or 0
+        // if the range '[ first, last )' is not large enough to contain the
+        // result.  The behavior is undefined unless 'first <= last'.
+
+    static char *toChars(char   *first,
+                         char   *last,
+                         double  value,
+                         Format  format) BSLS_KEYWORD_NOEXCEPT;
+    static char *toChars(char   *first,
+                         char   *last,
+                         float   value,
+                         Format  format) BSLS_KEYWORD_NOEXCEPT;
+        // Write the shortest representation of the specified 'value' that
+        // round-trips, in the specified 'format' (see {Floating-Point
+        // Formatting}), into the character buffer starting at the specified
+        // 'first' and ending at the specified 'last'.  Return the address one
+        // past the last character written on success, or 0 if the range
+        // '[ first, last )' is not large enough to contain the result.  The
+        // behavior is undefined unless 'first <= last'.
+
+    static char *toChars(char   *first,
+                         char   *last,
+                         double  value,
+                         Format  format,
+                         int     precision) BSLS_KEYWORD_NOEXCEPT;
+    static char *toChars(char   *first,
+                         char   *last,
+                         float   value,
+                         Format  format,
+                         int     precision) BSLS_KEYWORD_NOEXCEPT;
+        // Write the specified 'value' in the specified 'format' with the
+        // specified 'precision', exactly as 'printf' would in the "C" locale
+        // with the corresponding conversion (see {Floating-Point
+        // Formatting}), into the character buffer starting at the specified
+        // 'first' and ending at the specified 'last'.  A negative 'precision'
+        // is treated as 'printf' treats an omitted one.  Return the address
+        // one past the last character written on success, or 0 if the range
+        // '[ first, last )' is not large enough to contain the result.  The
+        // behavior is undefined unless 'first <= last'.
 };
 
 // ============================================================================
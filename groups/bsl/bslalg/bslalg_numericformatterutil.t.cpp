@@ -15,8 +15,10 @@
 #include <string>
 #include <sstream>
 #include <streambuf>
+#include <vector>
 
 #include <climits>
+#include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -36,15 +38,19 @@ using std::numeric_limits;
 //                             --------
 //
 // In the following cases, 'TYPE' means every integral fundamental type, signed
-// or unsigned, up to 64 bits long.
+// or unsigned, up to 64 bits long, and 'FLOAT' means 'float' and 'double'.
 // ----------------------------------------------------------------------------
 // [ 5] char *toChars(char *, char *, TYPE, int); // Random Unsigned
 // [ 4] char *toChars(char *, char *, TYPE, int); // Random Signed
 // [ 3] char *toChars(char *, char *, TYPE, int); // Corner Cases
 // [ 2] char *toChars(char *, char *, TYPE, int); // Table-Driven
+// [ 6] char *toChars(char *, char *, FLOAT);
+// [ 6] char *toChars(char *, char *, FLOAT, Format);
+// [ 6] char *toChars(char *, char *, FLOAT, Format, int);
+// [ 7] char *toChars(char *, char *, FLOAT, ...);  // Random
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BSL ASSERT TEST FUNCTION
@@ -599,6 +605,32 @@ void testValueMeta(Uint64 num, unsigned base)
 
 const Uint64 uint64Max = ~0ULL;    // max value a 'Uint64' can represent
 
+std::string toString(char *first, char *last)
+    // Return the string in the range '[ first .. last )', or "<FAIL>" if
+    // 'last' is 0.
+{
+    return last ? std::string(first, last) : std::string("<FAIL>");
+}
+
+std::string printfFormat(double value, char conversion, int precision)
+    // Return the result of formatting the specified 'value' with 'snprintf'
+    // using the specified 'conversion' and 'precision', without a "0x"
+    // prefix for "%a".
+{
+    char format[] = { '%', '.', '*', conversion, 0 };
+    char buffer[2048];
+
+    const int length = snprintf(buffer, sizeof buffer, format, precision,
+                                                                       value);
+    std::string result(buffer, length);
+
+    const std::string::size_type prefix = result.find("0x");
+    if ('a' == conversion && std::string::npos != prefix) {
+        result.erase(prefix, 2);
+    }
+    return result;
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -665,7 +697,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 6: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -702,6 +734,516 @@ int main(int argc, char *argv[])
 
         writeJsonScalar(sb, -1234567890);    // worst case int, max string len
         ASSERT("-1234567890" == oss.str());
+
+        if (verbose) printf("Example 2\n");
+
+///Example 2: Writing a 'double' That Round-Trips
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write a 'double' as text such that parsing the text
+// restores the same value, using as few characters as possible.
+//
+// First, we declare a buffer long enough for any 'double' in its shortest
+// form, which is 24 characters (e.g., "-2.2250738585072014e-308"):
+//..
+        char buffer[24];
+//..
+// Then, we write a value that 'printf' with "%g" would render with too few
+// digits to round-trip:
+//..
+        char *end = bslalg::NumericFormatterUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        0.1 + 0.2);
+        ASSERT(19 == end - buffer);
+        ASSERT(0  == std::memcmp(buffer, "0.30000000000000004", 19));
+//..
+// Next, we observe that values that are short in decimal are written
+// briefly, choosing fixed or scientific notation, whichever is shorter:
+//..
+        end = bslalg::NumericFormatterUtil::toChars(buffer,
+                                                    buffer + sizeof buffer,
+                                                    1e22);
+        ASSERT(5 == end - buffer);
+        ASSERT(0 == std::memcmp(buffer, "1e+22", 5));
+
+        end = bslalg::NumericFormatterUtil::toChars(buffer,
+                                                    buffer + sizeof buffer,
+                                                    1.5f);
+        ASSERT(3 == end - buffer);
+        ASSERT(0 == std::memcmp(buffer, "1.5", 3));
+//..
+// Finally, we write a value with a fixed number of decimal places, exactly as
+// 'printf' would with "%.2f", but without regard to the locale:
+//..
+        end = bslalg::NumericFormatterUtil::toChars(
+                                         buffer,
+                                         buffer + sizeof buffer,
+                                         2.675,
+                                         bslalg::NumericFormatterUtil::e_FIXED,
+                                         2);
+        ASSERT(4 == end - buffer);
+        ASSERT(0 == std::memcmp(buffer, "2.67", 4));  // 2.675 is 2.67499999...
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // FLOATING-POINT RANDOM VALUES TEST
+        //
+        // Concerns:
+        //: 1 The shortest representation of any finite value, in any format,
+        //:   parses back to the same value.
+        //:
+        //: 2 The shortest representation has no more significant digits than
+        //:   '%.17g' (or '%.9g' for 'float') needs to round-trip, and its
+        //:   last digit cannot be dropped.
+        //:
+        //: 3 The output with a precision is identical to that of 'printf'.
+        //:
+        //: 4 If 'std::to_chars' for floating-point types is available, the
+        //:   output of all overloads is identical to it.
+        //:
+        //: 5 A buffer one character too short is reported as a failure.
+        //
+        // Plan:
+        //: 1 Generate random bit patterns for 'double' and 'float', and
+        //:   random integers and short decimals, with an MMIX-style random
+        //:   number generator.  (C-1..5)
+        //:
+        //: 2 Parse each shortest output with 'strtod' and compare it with the
+        //:   original value.  (C-1)
+        //:
+        //: 3 Check that rounding the value to one fewer significant digit
+        //:   with '%.*e' does not round-trip.  (C-2)
+        //:
+        //: 4 Compare the output with a precision with that of 'snprintf' with
+        //:   the corresponding conversion.  (C-3)
+        //:
+        //: 5 If available, compare with the output of 'std::to_chars'.  (C-4)
+        //:
+        //: 6 Format into a buffer one character shorter than needed.  (C-5)
+        //
+        // Testing:
+        //   char *toChars(char *, char *, FLOAT, ...);  // Random
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("FLOATING-POINT RANDOM VALUES TEST\n"
+                            "=================================\n");
+
+        int iterations = 100 * 1000;
+        if (verbose) {
+            const int it = std::atoi(argv[2]);
+            if (it) {
+                iterations = it;
+                P(iterations);
+            }
+        }
+
+        const Util::Format FORMATS[] = { Util::e_SCIENTIFIC,
+                                         Util::e_FIXED,
+                                         Util::e_HEX,
+                                         Util::e_GENERAL };
+        const char         CONVERSIONS[] = { 'e', 'f', 'a', 'g' };
+        const int          PRECISIONS[]  = { 0, 1, 3, 6, 10, 17, 25 };
+
+        enum { k_NUM_FORMATS    = sizeof FORMATS / sizeof *FORMATS,
+               k_NUM_PRECISIONS = sizeof PRECISIONS / sizeof *PRECISIONS };
+
+        u::mmixRand64(true);
+
+        for (int ii = 0; ii < iterations; ++ii) {
+            const Uint64 BITS = u::mmixRand64();
+
+            double doubleValue;
+            float  floatValue;
+            switch (ii % 4) {
+              case 0: {
+                std::memcpy(&doubleValue, &BITS, sizeof doubleValue);
+              } break;
+              case 1: {
+                doubleValue = static_cast<double>(BITS >> (BITS % 64));
+              } break;
+              case 2: {
+                char text[32];
+                snprintf(text, sizeof text, "%de%d",
+                         static_cast<int>(BITS % 100000),
+                         static_cast<int>((BITS >> 32) % 600) - 300);
+                doubleValue = std::strtod(text, 0);
+              } break;
+              default: {
+                const unsigned FLOAT_BITS = static_cast<unsigned>(BITS);
+                std::memcpy(&floatValue, &FLOAT_BITS, sizeof floatValue);
+                doubleValue = floatValue;
+              } break;
+            }
+            const bool IS_FLOAT = 3 == ii % 4;
+
+            if (doubleValue != doubleValue
+             || doubleValue - doubleValue != 0) {
+                continue;  // 'nan' and 'inf' are tested in the table
+            }
+
+            char buffer[2048];
+            char *end;
+
+            for (int ff = -1; ff < k_NUM_FORMATS; ++ff) {
+                const Util::Format FORMAT = 0 <= ff ? FORMATS[ff]
+                                                    : Util::e_GENERAL;
+
+                if (IS_FLOAT) {
+                    end = 0 <= ff
+                          ? Util::toChars(buffer, buffer + 2048,
+                                                          floatValue, FORMAT)
+                          : Util::toChars(buffer, buffer + 2048, floatValue);
+                }
+                else {
+                    end = 0 <= ff
+                          ? Util::toChars(buffer, buffer + 2048,
+                                                         doubleValue, FORMAT)
+                          : Util::toChars(buffer, buffer + 2048, doubleValue);
+                }
+                ASSERTV(doubleValue, ff, end);
+                if (!end) {
+                    continue;
+                }
+                const std::string RESULT(buffer, end);
+
+                // Parse back.
+
+                std::string text = RESULT;
+                if (0 <= ff && Util::e_HEX == FORMAT) {
+                    text.insert('-' == text[0] ? 1 : 0, "0x");
+                }
+                if (IS_FLOAT) {
+                    ASSERTV(RESULT.c_str(), floatValue,
+                            floatValue == std::strtof(text.c_str(), 0));
+                }
+                else {
+                    ASSERTV(RESULT.c_str(), doubleValue,
+                            doubleValue == std::strtod(text.c_str(), 0));
+                }
+
+                // One character too short.
+
+                end = IS_FLOAT
+                      ? (0 <= ff ? Util::toChars(buffer,
+                                                 buffer + RESULT.size() - 1,
+                                                 floatValue,
+                                                 FORMAT)
+                                 : Util::toChars(buffer,
+                                                 buffer + RESULT.size() - 1,
+                                                 floatValue))
+                      : (0 <= ff ? Util::toChars(buffer,
+                                                 buffer + RESULT.size() - 1,
+                                                 doubleValue,
+                                                 FORMAT)
+                                 : Util::toChars(buffer,
+                                                 buffer + RESULT.size() - 1,
+                                                 doubleValue));
+                ASSERTV(RESULT.c_str(), 0 == end);
+
+#if defined(BSLS_LIBRARYFEATURES_SUPPORT_CHARCONV) &&                        \
+    defined(__cpp_lib_to_chars)
+                std::to_chars_result expected;
+                if (0 <= ff) {
+                    const std::chars_format STD_FORMAT =
+                                static_cast<std::chars_format>(FORMAT);
+                    expected = IS_FLOAT
+                             ? std::to_chars(buffer, buffer + 2048,
+                                             floatValue, STD_FORMAT)
+                             : std::to_chars(buffer, buffer + 2048,
+                                             doubleValue, STD_FORMAT);
+                }
+                else {
+                    expected = IS_FLOAT
+                             ? std::to_chars(buffer, buffer + 2048,
+                                             floatValue)
+                             : std::to_chars(buffer, buffer + 2048,
+                                             doubleValue);
+                }
+                ASSERTV(RESULT.c_str(), ff,
+                        RESULT == std::string(buffer, expected.ptr));
+#endif
+            }
+
+            // The shortest representation is the shortest that round-trips.
+
+            end = IS_FLOAT
+                  ? Util::toChars(buffer, buffer + 2048, floatValue,
+                                                           Util::e_SCIENTIFIC)
+                  : Util::toChars(buffer, buffer + 2048, doubleValue,
+                                                           Util::e_SCIENTIFIC);
+            const int numDigits = static_cast<int>(
+                   std::strchr(buffer, 'e') - buffer)
+                 - ('-' == buffer[0])
+                 - (0 != std::memchr(buffer, '.', end - buffer));
+
+            ASSERTV(doubleValue, numDigits, numDigits <= (IS_FLOAT ? 9 : 17));
+            if (1 < numDigits) {
+                const std::string SHORTER = u::printfFormat(doubleValue,
+                                                            'e',
+                                                            numDigits - 2);
+                if (IS_FLOAT) {
+                    ASSERTV(floatValue, SHORTER.c_str(),
+                            floatValue != std::strtof(SHORTER.c_str(), 0));
+                }
+                else {
+                    ASSERTV(doubleValue, SHORTER.c_str(),
+                            doubleValue != std::strtod(SHORTER.c_str(), 0));
+                }
+            }
+
+            // Formats with a precision are as 'printf'.
+
+            for (int ff = 0; ff < k_NUM_FORMATS; ++ff) {
+                if (IS_FLOAT
+                 && Util::e_HEX == FORMATS[ff]
+                 && 0 != floatValue
+                 && std::fabs(floatValue) < numeric_limits<float>::min()) {
+                    continue;  // 'printf' normalizes the subnormal 'float'
+                }
+
+                for (int pp = 0; pp < k_NUM_PRECISIONS; ++pp) {
+                    const int PRECISION = PRECISIONS[pp];
+
+                    end = IS_FLOAT
+                          ? Util::toChars(buffer, buffer + 2048, floatValue,
+                                          FORMATS[ff], PRECISION)
+                          : Util::toChars(buffer, buffer + 2048, doubleValue,
+                                          FORMATS[ff], PRECISION);
+
+                    const std::string EXPECTED = u::printfFormat(
+                                                              doubleValue,
+                                                              CONVERSIONS[ff],
+                                                              PRECISION);
+                    ASSERTV(EXPECTED.c_str(),
+                            u::toString(buffer, end).c_str(),
+                            EXPECTED == u::toString(buffer, end));
+                }
+            }
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // FLOATING-POINT TABLE-DRIVEN TEST
+        //
+        // Concerns:
+        //: 1 Each floating-point overload writes the expected text for values
+        //:   that exercise its boundary cases: zero, negative zero, the
+        //:   smallest and largest subnormal and normal values, powers of two
+        //:   whose lower neighbor is closer, integers too large to be
+        //:   written exactly by the shortest digits, infinities, and NaNs.
+        //:
+        //: 2 Fixed, scientific, and general notation are chosen as specified.
+        //:
+        //: 3 Rounding with a precision is exact, and ties are rounded to
+        //:   even, including ties that carry into a new leading digit.
+        //:
+        //: 4 Negative precisions are treated as omitted precisions.
+        //:
+        //: 5 Output that does not fit in the buffer is reported as a failure
+        //:   and, for an empty buffer, without writing anything.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, format values of both types
+        //:   with every combination of format and precision in the table, and
+        //:   compare with the expected text.  (C-1..4)
+        //:
+        //: 2 Format each value into buffers of every length shorter than the
+        //:   expected text, and verify that 0 is returned.  (C-5)
+        //
+        // Testing:
+        //   char *toChars(char *, char *, FLOAT);
+        //   char *toChars(char *, char *, FLOAT, Format);
+        //   char *toChars(char *, char *, FLOAT, Format, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("FLOATING-POINT TABLE-DRIVEN TEST\n"
+                            "================================\n");
+
+        const double INF = std::numeric_limits<double>::infinity();
+        const double NAN_VALUE = std::numeric_limits<double>::quiet_NaN();
+
+        enum { k_PLAIN = 0, k_NONE = -100 };
+
+        const Util::Format S = Util::e_SCIENTIFIC;
+        const Util::Format F = Util::e_FIXED;
+        const Util::Format G = Util::e_GENERAL;
+        const Util::Format H = Util::e_HEX;
+
+        static const struct {
+            int          d_line;
+            bool         d_isFloat;    // format as 'float'
+            double       d_value;
+            int          d_format;     // 'Format', or 'k_PLAIN'
+            int          d_precision;  // precision, or 'k_NONE'
+            const char  *d_expected;
+        } DATA[] = {
+            //LN  FLT  VALUE                    FMT      PREC    EXPECTED
+            //--  ---  -----------------------  -------  ------  ------------
+            { L_, 0,   0.0,                     k_PLAIN, k_NONE, "0"         },
+            { L_, 0,   -0.0,                    k_PLAIN, k_NONE, "-0"        },
+            { L_, 0,   1.0,                     k_PLAIN, k_NONE, "1"         },
+            { L_, 0,   -1.5,                    k_PLAIN, k_NONE, "-1.5"      },
+            { L_, 0,   0.1,                     k_PLAIN, k_NONE, "0.1"       },
+            { L_, 0,   0.3,                     k_PLAIN, k_NONE, "0.3"       },
+            { L_, 0,   0.1 + 0.2,               k_PLAIN, k_NONE,
+                                                      "0.30000000000000004"  },
+            { L_, 0,   123456.0,                k_PLAIN, k_NONE, "123456"    },
+            { L_, 0,   1e22,                    k_PLAIN, k_NONE, "1e+22"     },
+            { L_, 0,   1e23,                    k_PLAIN, k_NONE, "1e+23"     },
+            { L_, 0,   123e18,                  k_PLAIN, k_NONE, "1.23e+20"  },
+            { L_, 0,   9007199254740993.0,      k_PLAIN, k_NONE,
+                                                         "9007199254740992"  },
+            { L_, 0,   1152921504606846976.0,   k_PLAIN, k_NONE,
+                                                      "1152921504606846976"  },
+            { L_, 0,   0.001,                   k_PLAIN, k_NONE, "0.001"     },
+            { L_, 0,   0.0001,                  k_PLAIN, k_NONE, "1e-04"     },
+            { L_, 0,   0.00001,                 k_PLAIN, k_NONE, "1e-05"     },
+            { L_, 0,   0.00012,                 k_PLAIN, k_NONE, "0.00012"   },
+            { L_, 0,   5e-324,                  k_PLAIN, k_NONE, "5e-324"    },
+            { L_, 0,   2.2250738585072009e-308, k_PLAIN, k_NONE,
+                                                 "2.225073858507201e-308"    },
+            { L_, 0,   2.2250738585072014e-308, k_PLAIN, k_NONE,
+                                                 "2.2250738585072014e-308"   },
+            { L_, 0,   1.7976931348623157e308,  k_PLAIN, k_NONE,
+                                                 "1.7976931348623157e+308"   },
+            { L_, 0,   9.5367431640625e-07,     k_PLAIN, k_NONE,
+                                                 "9.5367431640625e-07"       },
+            { L_, 0,   INF,                     k_PLAIN, k_NONE, "inf"       },
+            { L_, 0,   -INF,                    k_PLAIN, k_NONE, "-inf"      },
+            { L_, 0,   NAN_VALUE,               k_PLAIN, k_NONE, "nan"       },
+            { L_, 0,   -NAN_VALUE,              k_PLAIN, k_NONE, "-nan"      },
+
+            { L_, 1,   0.1,                     k_PLAIN, k_NONE, "0.1"       },
+            { L_, 1,   16777216.0,              k_PLAIN, k_NONE, "16777216"  },
+            { L_, 1,   1e10,                    k_PLAIN, k_NONE, "1e+10"     },
+            { L_, 1,   3.4028234663852886e38,   k_PLAIN, k_NONE,
+                                                          "3.4028235e+38"    },
+            { L_, 1,   1.1754943508222875e-38,  k_PLAIN, k_NONE,
+                                                          "1.1754944e-38"    },
+            { L_, 1,   1.4012984643248171e-45,  k_PLAIN, k_NONE, "1e-45"     },
+            { L_, 1,   -INF,                    k_PLAIN, k_NONE, "-inf"      },
+
+            { L_, 0,   0.0,                     S,       k_NONE, "0e+00"     },
+            { L_, 0,   1234.5,                  S,       k_NONE,
+                                                            "1.2345e+03"     },
+            { L_, 0,   1e100,                   S,       k_NONE, "1e+100"    },
+            { L_, 0,   -5e-324,                 S,       k_NONE, "-5e-324"   },
+            { L_, 0,   1234.5,                  F,       k_NONE, "1234.5"    },
+            { L_, 0,   1e-5,                    F,       k_NONE, "0.00001"   },
+            { L_, 0,   1e22,                    F,       k_NONE,
+                                                 "10000000000000000000000"   },
+            { L_, 0,   1e23,                    F,       k_NONE,
+                                                 "99999999999999991611392"   },
+            { L_, 0,   123456.0,                G,       k_NONE, "123456"    },
+            { L_, 0,   1234567.0,               G,       k_NONE,
+                                                            "1.234567e+06"   },
+            { L_, 0,   0.0001,                  G,       k_NONE, "0.0001"    },
+            { L_, 0,   0.00001,                 G,       k_NONE, "1e-05"     },
+            { L_, 0,   1234.5,                  H,       k_NONE, "1.34ap+10" },
+            { L_, 0,   1.0,                     H,       k_NONE, "1p+0"      },
+            { L_, 0,   -0.0,                    H,       k_NONE, "-0p+0"     },
+            { L_, 0,   5e-324,                  H,       k_NONE,
+                                                     "0.0000000000001p-1022" },
+            { L_, 1,   1.5,                     H,       k_NONE, "1.8p+0"    },
+            { L_, 1,   1.4012984643248171e-45,  H,       k_NONE,
+                                                            "0.000002p-126"  },
+            { L_, 0,   NAN_VALUE,               H,       k_NONE, "nan"       },
+
+            { L_, 0,   2.675,                   F,       2,      "2.67"      },
+            { L_, 0,   0.125,                   F,       2,      "0.12"      },
+            { L_, 0,   0.375,                   F,       2,      "0.38"      },
+            { L_, 0,   0.5,                     F,       0,      "0"         },
+            { L_, 0,   1.5,                     F,       0,      "2"         },
+            { L_, 0,   2.5,                     F,       0,      "2"         },
+            { L_, 0,   9.5,                     F,       0,      "10"        },
+            { L_, 0,   0.96,                    F,       1,      "1.0"       },
+            { L_, 0,   0.001,                   F,       1,      "0.0"       },
+            { L_, 0,   -0.001,                  F,       1,      "-0.0"      },
+            { L_, 0,   0.1,                     F,       20,
+                                                    "0.10000000000000000555" },
+            { L_, 0,   1e22,                    F,       1,
+                                               "10000000000000000000000.0"   },
+            { L_, 0,   1.0,                     F,       k_NONE - 1,
+                                                                 "1.000000"  },
+            { L_, 0,   0.0,                     S,       3,      "0.000e+00" },
+            { L_, 0,   1234.5,                  S,       0,      "1e+03"     },
+            { L_, 0,   1234.5,                  S,       3,      "1.234e+03" },
+            { L_, 0,   9.9999,                  S,       2,      "1.00e+01"  },
+            { L_, 0,  5e-324,                  S,       3,      "4.941e-324" },
+            { L_, 0,   0.0001,                  G,       0,      "0.0001"    },
+            { L_, 0,   123456.0,                G,       3,      "1.23e+05"  },
+            { L_, 0,   100.0,                   G,       3,      "100"       },
+            { L_, 0,   1000.0,                  G,       3,      "1e+03"     },
+            { L_, 0,   0.5,                     G,       6,      "0.5"       },
+            { L_, 0,   99999.95,                G,       6,      "99999.9"   },
+            { L_, 0,   999999.5,                G,       6,      "1e+06"     },
+            { L_, 0,   1.0,                     H,       0,      "1p+0"      },
+            { L_, 0,   1.5,                     H,       0,      "2p+0"      },
+            { L_, 0,   1.0,                     H,       2,      "1.00p+0"   },
+            { L_, 0,   1.03125,                 H,       1,      "1.0p+0"    },
+            { L_, 0,   1.09375,                 H,       1,      "1.2p+0"    },
+            { L_, 1,  0.1,                     F,       10,   "0.1000000015" },
+            { L_, 1,   0.1,                     H,       3,      "1.99ap-4"  },
+            { L_, 0,   -INF,                    F,       3,      "-inf"      },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            const int           LINE      = DATA[ti].d_line;
+            const bool          IS_FLOAT  = DATA[ti].d_isFloat;
+            const double        VALUE     = DATA[ti].d_value;
+            const int           FORMAT    = DATA[ti].d_format;
+            const int           PRECISION = DATA[ti].d_precision;
+            const std::string   EXPECTED  = DATA[ti].d_expected;
+            const Util::Format  FMT       = static_cast<Util::Format>(FORMAT);
+            const float         FLOAT_VALUE = static_cast<float>(VALUE);
+
+            if (veryVerbose) {
+                P_(LINE) P_(VALUE) P_(FORMAT) P_(PRECISION)
+                P(EXPECTED.c_str());
+            }
+
+            const int LENGTH = static_cast<int>(EXPECTED.size());
+
+            for (int length = LENGTH + 1; 0 <= length; --length) {
+                char  buffer[64];
+                char *end;
+
+                std::memset(buffer, '?', sizeof buffer);
+
+                if (k_PLAIN == FORMAT) {
+                    end = IS_FLOAT
+                        ? Util::toChars(buffer, buffer + length, FLOAT_VALUE)
+                        : Util::toChars(buffer, buffer + length, VALUE);
+                }
+                else if (k_NONE == PRECISION) {
+                    end = IS_FLOAT
+                        ? Util::toChars(buffer, buffer + length, FLOAT_VALUE,
+                                                                         FMT)
+                        : Util::toChars(buffer, buffer + length, VALUE, FMT);
+                }
+                else {
+                    end = IS_FLOAT
+                        ? Util::toChars(buffer, buffer + length, FLOAT_VALUE,
+                                                              FMT, PRECISION)
+                        : Util::toChars(buffer, buffer + length, VALUE, FMT,
+                                                                   PRECISION);
+                }
+
+                if (LENGTH <= length) {
+                    ASSERTV(LINE, EXPECTED.c_str(),
+                            u::toString(buffer, end).c_str(),
+                            EXPECTED == u::toString(buffer, end));
+                }
+                else {
+                    ASSERTV(LINE, length, 0 == end);
+                    if (0 == length) {
+                        ASSERTV(LINE, '?' == buffer[0]);
+                    }
+                }
+            }
+        }
       } break;
       case 5: {
         // --------------------------------------------------------------------
@@ -2086,6 +2628,102 @@ int main(int argc, char *argv[])
         }
       } break;
 #endif
+      case -2: {
+        // --------------------------------------------------------------------
+        // FLOATING-POINT SPEED TRIAL
+        //
+        // Concern:
+        //: 1 Measure how the performance of the floating-point 'toChars'
+        //:   compares to that of 'sprintf' (and 'std::to_chars', if
+        //:   available).
+        //
+        // Plan:
+        //: 1 Format a million pseudo-random 'double' values of typical
+        //:   magnitude (e.g., prices) repeatedly, with the shortest
+        //:   representation and with a precision of 15 in general notation,
+        //:   and time them using 'bsls_stopwatch'.
+        // --------------------------------------------------------------------
+
+        printf("FLOATING-POINT SPEED TRIAL\n"
+               "==========================\n");
+
+        enum { k_NUM_VALUES = 1000 * 1000, k_NUM_TRIALS = 10 };
+
+        std::vector<double> values(k_NUM_VALUES);
+
+        u::mmixRand64(true);
+        for (int ii = 0; ii < k_NUM_VALUES; ++ii) {
+            values[ii] = static_cast<double>(u::mmixRand64() % 100000000)
+                                                                       / 1000;
+        }
+
+        const double actions = 1.0 * k_NUM_VALUES * k_NUM_TRIALS;
+
+        bsls::Stopwatch sw;
+        for (int kk = 0; kk < 5; ++kk) {
+            static const char *const NAMES[] = {
+                "      toChars: shortest: ",
+                "sprintf %.17g: shortest: ",
+                "      toChars:    %.15g: ",
+                "sprintf %.15g:    %.15g: ",
+                "std::to_chars: shortest: "
+            };
+
+#if !defined(BSLS_LIBRARYFEATURES_SUPPORT_CHARCONV) ||                       \
+    !defined(__cpp_lib_to_chars)
+            if (4 == kk) {
+                break;
+            }
+#endif
+            printf("%s", NAMES[kk]);
+
+            sw.reset();
+            sw.start(true);
+
+            for (int ii = 0; ii < k_NUM_TRIALS; ++ii) {
+                for (int jj = 0; jj < k_NUM_VALUES; ++jj) {
+                    char buf[64];
+                    switch (kk) {
+                      case 0: {
+                        char *result = Util::toChars(buf,
+                                                     buf + 64,
+                                                     values[jj]);
+                        BSLS_ASSERT_OPT(result);
+                      } break;
+                      case 1: {
+                        sprintf(buf, "%.17g", values[jj]);
+                        BSLS_ASSERT_OPT(0 != *buf);
+                      } break;
+                      case 2: {
+                        char *result = Util::toChars(buf,
+                                                     buf + 64,
+                                                     values[jj],
+                                                     Util::e_GENERAL,
+                                                     15);
+                        BSLS_ASSERT_OPT(result);
+                      } break;
+                      case 3: {
+                        sprintf(buf, "%.15g", values[jj]);
+                        BSLS_ASSERT_OPT(0 != *buf);
+                      } break;
+#if defined(BSLS_LIBRARYFEATURES_SUPPORT_CHARCONV) &&                        \
+    defined(__cpp_lib_to_chars)
+                      case 4: {
+                        std::to_chars_result result =
+                                                     std::to_chars(buf,
+                                                                   buf + 64,
+                                                                   values[jj]);
+                        BSLS_ASSERT_OPT(result.ec == std::errc());
+                      } break;
+#endif
+                    }
+                }
+            }
+
+            sw.stop();
+            printf("%g nsec\n", 1e9 * sw.accumulatedUserTime() / actions);
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
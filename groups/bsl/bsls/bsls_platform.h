@@ -742,6 +742,9 @@ struct bsls_Platform_Assert;
     #define BSLS_PLATFORM_CPU_SSE  1
     #define BSLS_PLATFORM_CPU_SSE2 1
     #define BSLS_PLATFORM_CPU_SSE3 1
+    #if defined(__AVX2__)
+        #define BSLS_PLATFORM_CPU_AVX2 1
+    #endif
 #elif defined(__clang__) || defined(__GNUC__) || defined(__EDG__)
     #if defined(__SSE__)
         #define BSLS_PLATFORM_CPU_SSE  1
@@ -752,6 +755,9 @@ struct bsls_Platform_Assert;
     #if defined(__SSE3__)
         #define BSLS_PLATFORM_CPU_SSE3 1
     #endif
+    #if defined(__AVX2__)
+        #define BSLS_PLATFORM_CPU_AVX2 1
+    #endif
 #endif
 
 // ----------------------------------------------------------------------------
@@ -38,6 +38,7 @@ using namespace BloombergLP;
 // [ 2] BSLS_PLATFORM_IS_BIG_ENDIAN
 // [ 3] BSLS_PLATFORM_NO_64_BIT_LITERALS
 // [ 5] BSLS_PLATFORM_CPU_SSE*
+// [ 5] BSLS_PLATFORM_CPU_AVX2
 // ============================================================================
 
 // ============================================================================
@@ -1592,6 +1593,7 @@ static void printFlags()
 
 #ifdef _WIN32
     #define cpuid(info, x) __cpuidex(info, x, 0)
+    #define cpuidCount(info, x, y) __cpuidex(info, x, y)
 #elif defined(__clang__) || defined(__GNUC__) || defined(__EDG__)
     void cpuid(int info[4], int infoType)
         // Load into the specified 'info' the results of the intrinsic
@@ -1602,6 +1604,15 @@ static void printFlags()
     {
         __cpuid_count(infoType, 0, info[0], info[1], info[2], info[3]);
     }
+
+    void cpuidCount(int info[4], int infoType, int subleaf)
+        // Load into the specified 'info' the results of the intrinsic
+        // '__cpuid_count' command invoked with the specified 'infoType' for
+        // the 'level' parameter and the specified 'subleaf' for the 'count'
+        // parameter.
+    {
+        __cpuid_count(infoType, subleaf, info[0], info[1], info[2], info[3]);
+    }
 #else
     void cpuid(int info[4], int)
         // Load zero into each element of the specified 'info'.
@@ -1611,6 +1622,15 @@ static void printFlags()
         info[2] = 0;
         info[3] = 0;
     }
+
+    void cpuidCount(int info[4], int, int)
+        // Load zero into each element of the specified 'info'.
+    {
+        info[0] = 0;
+        info[1] = 0;
+        info[2] = 0;
+        info[3] = 0;
+    }
 #endif
 
 // ============================================================================
@@ -1639,12 +1659,17 @@ int main(int argc, char *argv[])
         //
         // Concerns:
         //: 1 Runtime detection of SSE availability matches macro definitions.
+        //:
+        //: 2 'BSLS_PLATFORM_CPU_AVX2' is defined only if the processor
+        //:   supports AVX2.  (The macro reflects the compilation options, so
+        //:   it may be undefined on a processor that supports AVX2.)
         //
         // Plan:
-        //: 1 Use 'cpuinfo' to verify macro settings.
+        //: 1 Use 'cpuinfo' to verify macro settings.  (C-1..2)
         //
         // Testing
         //   BSLS_PLATFORM_CPU_SSE*
+        //   BSLS_PLATFORM_CPU_AVX2
         // --------------------------------------------------------------------
 
         if (verbose) printf("\nTESTING SSE MACROS"
@@ -1675,6 +1700,17 @@ int main(int argc, char *argv[])
         #else
             ASSERT(0 == ((info[2] >>  0) & 0x1));
         #endif
+
+        #ifdef BSLS_PLATFORM_CPU_AVX2
+            cpuid(info, 0);
+            ASSERT(info[0] >= 0x00000007);
+
+            // The structured extended feature flags are reported by sub-leaf
+            // 0 of leaf 7; AVX2 is bit 5 of EBX.
+
+            cpuidCount(info, 0x00000007, 0);
+            ASSERT(1 == ((info[1] >>  5) & 0x1));
+        #endif
       } break;
       case 4: {
         // --------------------------------------------------------------------
@@ -22,6 +22,68 @@ BSLS_IDENT("$Id: $")
 // provides a safe and more performant alternative to 'snprintf' in contexts
 // where complex formatting options or locale are not important.
 //
+// 'from_chars' is the inverse of 'to_chars': it parses a value of integral or
+// floating-point type from the range '[ first .. last )', which need not be
+// null-terminated.  It too is locale-independent, non-allocating, and
+// non-throwing, and provides a safe and more performant alternative to
+// 'strtol' and 'strtod'.  Note that, as in the standard, neither leading
+// whitespace nor a leading '+' is accepted, and a '-' is accepted only when
+// parsing a signed or floating-point type.
+//
+// The standard library implementations of 'to_chars' and 'from_chars' for
+// floating-point types were delivered later than those for integral types
+// (e.g., in GCC 11), so the names 'to_chars', 'to_chars_result',
+// 'from_chars', 'from_chars_result', and 'chars_format' are imported from
+// 'std' into 'bsl' only if the standard library provides the floating-point
+// overloads (as indicated by '__cpp_lib_to_chars'), and the implementations
+// in this component are used otherwise.
+//
+///Floating-Point Formatting
+///-------------------------
+// A floating-point 'to_chars' without a precision writes the shortest
+// representation that round-trips: the fewest significant digits that
+// 'from_chars' parses back to exactly the original value.  If no format is
+// specified, the shorter of fixed and scientific notation is written;
+// otherwise 'chars_format' selects fixed, scientific, general ("%g"-style),
+// or hexadecimal (without a "0x" prefix) notation.  With a precision, the
+// output is exactly that of 'printf' with the corresponding conversion in
+// the "C" locale.  Infinity and NaN are written as "inf" and "nan".  See
+// 'bslalg_numericformatterutil', which implements these functions, for
+// details.
+//
+///Floating-Point Parsing
+///----------------------
+// A floating-point 'from_chars' returns the representable value nearest to
+// the parsed text, rounding halfway cases to even, for any number of digits.
+// Most inputs are converted with the Eisel-Lemire algorithm, which needs only
+// one or two 64x128-bit multiplications against a table of powers of five.
+// The rare inputs that algorithm cannot decide (and all inputs for a 'long
+// double' that is wider than 'double') are converted exactly by shifting a
+// decimal representation of the input by powers of two.  If the parsed value
+// is finite and non-zero, but its magnitude is too large to be represented,
+// or so small that it rounds to zero, 'errc::result_out_of_range' is returned
+// and the output value is not modified.  Note that 'long double' values are
+// rounded to at most 64 bits of precision, which is exact on all supported
+// platforms other than those whose 'long double' is wider than the 80-bit x87
+// format.
+//
+// As in the standard, 'chars_format' selects the accepted syntax:
+//: o 'chars_format::general' (the default): decimal, with an optional
+//:   exponent.
+//:
+//: o 'chars_format::fixed': decimal, without an exponent.
+//:
+//: o 'chars_format::scientific': decimal, with a required exponent.
+//:
+//: o 'chars_format::hex': hexadecimal digits, without a "0x" prefix, and with
+//:   an optional binary exponent introduced by 'p'.
+//
+// All formats also accept "inf", "infinity", "nan", and "nan(<chars>)",
+// ignoring case.  Note that, as with 'bsl::errc', 'bsl::chars_format' can be
+// used in C++03 only to qualify its enumerators (e.g.,
+// 'bsl::chars_format::fixed'); its type is 'bsl::chars_format::Enum' in
+// C++03 and 'bsl::chars_format' when imported from 'std'.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -68,6 +130,47 @@ BSLS_IDENT("$Id: $")
 //      result->sputn(buffer, sts.ptr - buffer);
 //  }
 //..
+//
+///Example 2: Parsing Numbers from a Delimited Record
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a record of comma-separated fields, held in a buffer that
+// is not null-terminated, that holds an 'int' quantity and a 'double' price.
+// We can use 'bsl::from_chars' to parse the fields in place, without copying
+// them and without regard to the current locale.
+//
+// First, we define the record:
+//..
+//  const char  record[] = { '1', '5', '0', ',', '9', '9', '.', '2', '5' };
+//  const char *end      = record + sizeof record;
+//..
+// Then, we parse the quantity, which leaves 'ptr' at the delimiter:
+//..
+//  int                    quantity = 0;
+//  bsl::from_chars_result sts      = bsl::from_chars(record, end, quantity);
+//
+//  assert(bsl::ErrcEnum() == sts.ec);
+//  assert(150             == quantity);
+//  assert(','             == *sts.ptr);
+//..
+// Next, we parse the price, which must consume the rest of the record:
+//..
+//  double price = 0;
+//
+//  sts = bsl::from_chars(sts.ptr + 1, end, price);
+//
+//  assert(bsl::ErrcEnum() == sts.ec);
+//  assert(99.25           == price);
+//  assert(end             == sts.ptr);
+//..
+// Finally, we observe that a field that does not begin with a number is
+// rejected without modifying the output:
+//..
+//  sts = bsl::from_chars(record + 3, end, quantity);
+//
+//  assert(bsl::errc::invalid_argument == sts.ec);
+//  assert(record + 3                  == sts.ptr);
+//  assert(150                         == quantity);
+//..
 
 #include <bslscm_version.h>
 
@@ -89,9 +192,81 @@ BSLS_IDENT("$Id: $")
 
 #endif
 
+#if defined(BSLS_LIBRARYFEATURES_SUPPORT_CHARCONV) &&                        \
+    defined(__cpp_lib_to_chars)
+#define BSLSTL_CHARCONV_NATIVE_FLOATING_POINT 1
+    // The standard library provides 'to_chars' and 'from_chars' for
+    // floating-point types.
+#endif
+
 namespace BloombergLP {
 namespace bslstl {
 
+                            // ===================
+                            // struct chars_format
+                            // ===================
+
+struct chars_format {
+    // This 'struct' provides a namespace for the enumeration of the syntaxes
+    // written by the floating-point 'to_chars' functions, and accepted by the
+    // floating-point 'from_chars' functions.  Note that
+    // 'std::chars_format' is a bitmask 'enum class', which cannot be emulated
+    // in C++03, so objects of this type must be declared as
+    // 'chars_format::Enum' (see 'bsl::errc').
+
+    // TYPES
+    enum Enum {
+        scientific = 1,                     // mantissa and exponent
+        fixed      = 2,                     // mantissa only
+        hex        = 4,                     // hexadecimal mantissa and binary
+                                            // exponent
+        general    = fixed | scientific     // mantissa and optional exponent
+    };
+};
+
+                           // ========================
+                           // struct from_chars_result
+                           // ========================
+
+struct from_chars_result {
+    // This 'struct' represents the result of the 'from_chars' function.  On a
+    // successful call to 'from_chars', 'ptr' is one past the last character
+    // parsed, and 'ec' is a default constructed 'ErrcEnum'.  If no number
+    // could be parsed, 'ptr' is the 'first' argument supplied to
+    // 'from_chars', and 'ec' is 'errc::invalid_argument'.  If the number
+    // parsed is out of the range of the output type, 'ptr' is one past the
+    // last character parsed, and 'ec' is 'errc::result_out_of_range'.
+
+    // PUBLIC DATA
+    const char    *ptr;
+    bsl::ErrcEnum  ec;
+};
+
+                         // =========================
+                         // struct CharConv_ParseUtil
+                         // =========================
+
+struct CharConv_ParseUtil {
+    // [!PRIVATE!] This 'struct' provides a namespace for the non-template
+    // implementation of the integral 'from_chars' functions.
+
+    // CLASS METHODS
+    static from_chars_result parseUnsigned(
+                                         bsls::Types::Uint64 *result,
+                                         const char          *first,
+                                         const char          *last,
+                                         bsls::Types::Uint64  maxValue,
+                                         int                  base);
+        // Parse the longest sequence of digits in the specified 'base' at the
+        // beginning of the range '[ first .. last )' and load its value into
+        // the specified 'result' if it does not exceed the specified
+        // 'maxValue'.  Return a 'from_chars_result' whose 'ptr' is the end of
+        // the sequence, and whose 'ec' is 'errc::invalid_argument' if the
+        // sequence is empty, 'errc::result_out_of_range' if its value exceeds
+        // 'maxValue', and a default constructed 'ErrcEnum' otherwise.  The
+        // behavior is undefined unless 'base' is in the range '[ 2 .. 36 ]'.
+};
+
                             // ========================
                             // struct 'to_chars_result'
                             // ========================
@@ -126,6 +301,107 @@ to_chars(char *first, char *last, INTEGRAL_TYPE value, int base = 10);
     // only failure mode.  The behavior is undefined unless 'first < last' and
     // 'base' is in the range '[ 2 .. 36 ]'.
 
+to_chars_result to_chars(char *first, char *last, float value);
+to_chars_result to_chars(char *first, char *last, double value);
+    // Write the shortest representation of the specified 'value' that
+    // round-trips, in the shorter of fixed and scientific notation (see
+    // {Floating-Point Formatting}), into the character buffer starting at the
+    // specified 'first' and ending at the specified 'last'.  Return a
+    // 'to_chars_result' 'struct' whose 'ptr' is the end of the written
+    // characters and whose 'ec' is a default constructed 'ErrcEnum' on
+    // success.  If the buffer is not large enough for the result, return a
+    // 'struct' with 'ptr' set to 'last' and 'ec' set to
+    // 'errc::value_too_large'.  The behavior is undefined unless
+    // 'first <= last'.
+
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         float               value,
+                         chars_format::Enum  fmt);
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         double              value,
+                         chars_format::Enum  fmt);
+    // Write the shortest representation of the specified 'value' that
+    // round-trips, in the notation specified by 'fmt' (see {Floating-Point
+    // Formatting}), into the character buffer starting at the specified
+    // 'first' and ending at the specified 'last'.  Return a 'to_chars_result'
+    // 'struct' whose 'ptr' is the end of the written characters and whose
+    // 'ec' is a default constructed 'ErrcEnum' on success.  If the buffer is
+    // not large enough for the result, return a 'struct' with 'ptr' set to
+    // 'last' and 'ec' set to 'errc::value_too_large'.  The behavior is
+    // undefined unless 'first <= last'.
+
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         float               value,
+                         chars_format::Enum  fmt,
+                         int                 precision);
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         double              value,
+                         chars_format::Enum  fmt,
+                         int                 precision);
+    // Write the specified 'value' in the notation specified by 'fmt' with the
+    // specified 'precision', as 'printf' would in the "C" locale with the
+    // corresponding conversion (see {Floating-Point Formatting}), into the
+    // character buffer starting at the specified 'first' and ending at the
+    // specified 'last'.  A negative 'precision' is treated as 'printf' treats
+    // an omitted one.  Return a 'to_chars_result' 'struct' whose 'ptr' is the
+    // end of the written characters and whose 'ec' is a default constructed
+    // 'ErrcEnum' on success.  If the buffer is not large enough for the
+    // result, return a 'struct' with 'ptr' set to 'last' and 'ec' set to
+    // 'errc::value_too_large'.  The behavior is undefined unless
+    // 'first <= last'.
+
+template <class INTEGRAL_TYPE>
+from_chars_result
+from_chars(const char    *first,
+           const char    *last,
+           INTEGRAL_TYPE& value,
+           int            base = 10);
+    // Parse the longest sequence of characters at the beginning of the range
+    // '[ first .. last )' that is an optional '-' (only if 'INTEGRAL_TYPE' is
+    // signed) followed by one or more digits in the optionally specified
+    // 'base', and load the corresponding number into the specified 'value'.
+    // If 'base' is not specified, decimal is used.  Digits greater than 9 are
+    // the letters 'a' to 'z', ignoring case.  Return a 'from_chars_result'
+    // 'struct' indicating success or failure, and the end of the parsed
+    // characters.  If no characters match, return '{ first,
+    // errc::invalid_argument }'; if the parsed number cannot be represented
+    // by 'INTEGRAL_TYPE', return a 'struct' with 'ptr' set to the end of the
+    // parsed characters and 'ec' set to 'errc::result_out_of_range'.  'value'
+    // is not modified on failure.  The behavior is undefined unless
+    // 'first <= last' and 'base' is in the range '[ 2 .. 36 ]'.
+
+from_chars_result
+from_chars(const char         *first,
+           const char         *last,
+           float&              value,
+           chars_format::Enum  fmt = chars_format::general);
+from_chars_result
+from_chars(const char         *first,
+           const char         *last,
+           double&             value,
+           chars_format::Enum  fmt = chars_format::general);
+from_chars_result
+from_chars(const char         *first,
+           const char         *last,
+           long double&        value,
+           chars_format::Enum  fmt = chars_format::general);
+    // Parse the longest sequence of characters at the beginning of the range
+    // '[ first .. last )' that is an optional '-' followed by a number in the
+    // syntax indicated by the optionally specified 'fmt' (see {Floating-Point
+    // Parsing}), and load the nearest representable value into the specified
+    // 'value'.  If 'fmt' is not specified, 'chars_format::general' is used.
+    // Return a 'from_chars_result' 'struct' indicating success or failure,
+    // and the end of the parsed characters.  If no characters match, return
+    // '{ first, errc::invalid_argument }'; if the parsed number is finite and
+    // non-zero, but cannot be represented as a finite, non-zero value, return
+    // a 'struct' with 'ptr' set to the end of the parsed characters and 'ec'
+    // set to 'errc::result_out_of_range'.  'value' is not modified on
+    // failure.  The behavior is undefined unless 'first <= last'.
+
 // ============================================================================
 //                         INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -158,6 +434,180 @@ to_chars(char *first, char *last, INTEGRAL_TYPE value, int base)
     return ret;
 }
 
+inline
+to_chars_result to_chars(char *first, char *last, float value)
+{
+    BSLS_ASSERT(first <= last);
+
+    char *end = bslalg::NumericFormatterUtil::toChars(first, last, value);
+    if (!end) {
+        const to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    const to_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+inline
+to_chars_result to_chars(char *first, char *last, double value)
+{
+    BSLS_ASSERT(first <= last);
+
+    char *end = bslalg::NumericFormatterUtil::toChars(first, last, value);
+    if (!end) {
+        const to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    const to_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+inline
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         float               value,
+                         chars_format::Enum  fmt)
+{
+    BSLS_ASSERT(first <= last);
+
+    typedef bslalg::NumericFormatterUtil Util;
+
+    char *end = Util::toChars(first,
+                              last,
+                              value,
+                              static_cast<Util::Format>(fmt));
+    if (!end) {
+        const to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    const to_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+inline
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         double              value,
+                         chars_format::Enum  fmt)
+{
+    BSLS_ASSERT(first <= last);
+
+    typedef bslalg::NumericFormatterUtil Util;
+
+    char *end = Util::toChars(first,
+                              last,
+                              value,
+                              static_cast<Util::Format>(fmt));
+    if (!end) {
+        const to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    const to_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+inline
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         float               value,
+                         chars_format::Enum  fmt,
+                         int                 precision)
+{
+    BSLS_ASSERT(first <= last);
+
+    typedef bslalg::NumericFormatterUtil Util;
+
+    char *end = Util::toChars(first,
+                              last,
+                              value,
+                              static_cast<Util::Format>(fmt),
+                              precision);
+    if (!end) {
+        const to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    const to_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+inline
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         double              value,
+                         chars_format::Enum  fmt,
+                         int                 precision)
+{
+    BSLS_ASSERT(first <= last);
+
+    typedef bslalg::NumericFormatterUtil Util;
+
+    char *end = Util::toChars(first,
+                              last,
+                              value,
+                              static_cast<Util::Format>(fmt),
+                              precision);
+    if (!end) {
+        const to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    const to_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+template <class INTEGRAL_TYPE>
+inline
+from_chars_result
+from_chars(const char *first, const char *last, INTEGRAL_TYPE& value, int base)
+{
+    BSLS_ASSERT(2 <= base);
+    BSLS_ASSERT(base <= 36);
+    BSLS_ASSERT(first <= last);
+
+    typedef bsls::Types::Uint64 Uint64;
+    typedef bsls::Types::Int64  Int64;
+
+    BSLMF_ASSERT(bsl::is_integral<INTEGRAL_TYPE>::value);
+    BSLMF_ASSERT(!(bsl::is_same<typename bsl::remove_cv<INTEGRAL_TYPE>::type,
+                                bool>::value));
+    BSLMF_ASSERT(sizeof(INTEGRAL_TYPE) <= sizeof(Uint64));
+
+    enum { k_IS_SIGNED = static_cast<INTEGRAL_TYPE>(-1) < 0,
+           k_BITS      = sizeof(INTEGRAL_TYPE) * 8 - k_IS_SIGNED };
+
+    const bool negative = k_IS_SIGNED && first != last && '-' == *first;
+
+    // The magnitude of the most negative value exceeds that of the most
+    // positive value by one.
+
+    const Uint64 maxMagnitude = (~static_cast<Uint64>(0) >> (64 - k_BITS))
+                              + negative;
+
+    Uint64            magnitude;
+    from_chars_result ret = CharConv_ParseUtil::parseUnsigned(
+                                                      &magnitude,
+                                                      first + negative,
+                                                      last,
+                                                      maxMagnitude,
+                                                      base);
+    if (bsl::ErrcEnum() != ret.ec) {
+        if (bsl::errc::invalid_argument == ret.ec) {
+            ret.ptr = first;
+        }
+        return ret;                                                   // RETURN
+    }
+
+    value = negative
+          ? static_cast<INTEGRAL_TYPE>(-static_cast<Int64>(magnitude - 1) - 1)
+          : static_cast<INTEGRAL_TYPE>(magnitude);
+    return ret;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -165,15 +615,21 @@ to_chars(char *first, char *last, INTEGRAL_TYPE value, int base)
 
 namespace bsl {
 
-#if defined(BSLS_LIBRARYFEATURES_SUPPORT_CHARCONV)
+#if defined(BSLSTL_CHARCONV_NATIVE_FLOATING_POINT)
 
+using std::chars_format;
 using std::to_chars_result;
 using std::to_chars;
+using std::from_chars_result;
+using std::from_chars;
 
 #else
 
+using BloombergLP::bslstl::chars_format;
 using BloombergLP::bslstl::to_chars_result;
 using BloombergLP::bslstl::to_chars;
+using BloombergLP::bslstl::from_chars_result;
+using BloombergLP::bslstl::from_chars;
 
 #endif
 
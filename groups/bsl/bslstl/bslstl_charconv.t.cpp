@@ -22,6 +22,7 @@
 #include <cstring>
 #include <limits>
 
+#include <errno.h>
 #include <limits.h>
 #include <stdio.h>
 
@@ -41,9 +42,12 @@ using std::numeric_limits;
 // Normally, a BDE component provides many functions, that are individually
 // fairly simple, individual test cases in test drivers test one, or a few,
 // functions per test case, and test those functions thoroughly.  This
-// component, however, provides only one function, and that function is a
-// template function with a potentially wide range of inputs, so ALL the test
-// cases here test that one function, and test it in different ways.
+// component, however, provides only two functions, 'to_chars' and
+// 'from_chars', each with a potentially wide range of inputs, so test cases 1
+// to 7 all test 'to_chars', and test it in different ways, and test cases 8 to
+// 10 all test 'from_chars'.  The floating-point 'to_chars' forwards to
+// 'bslalg::NumericFormatterUtil', which is tested thoroughly in its own
+// component, so test case 11 tests only the forwarding.
 //
 // ----------------------------------------------------------------------------
 // We have two "oracle" functions defined in this test driver:
@@ -90,13 +94,27 @@ using std::numeric_limits;
 // representing the value.
 //
 // ----------------------------------------------------------------------------
+// The floating-point 'from_chars' is tested against the C library:
+//
+//                       // u::fromCharsMatchesStrtod<TYPE>
+//
+// We have 'fromCharsMatchesStrtod<TYPE>' that, passed a null-terminated
+// string, parses it with 'from_chars' and with 'strtod', 'strtof', or
+// 'strtold' (depending on 'TYPE'), and returns 'true' if the results, and the
+// numbers of characters consumed, are identical.
+//
+// ----------------------------------------------------------------------------
 //                             // Random Tests
 //
 // The random tests are driven by the 64-bit 'mmixRand64' random number
 // generator.  The random tests of less than 8 bytes are done by masking the
 // result of 'mmixRand64' down to the appropriate number of bytes.
 // ----------------------------------------------------------------------------
-// [ 8] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
+// [11] FLOATING-POINT TO_CHARS TEST
+// [10] RANDOM FLOATING-POINT FROM_CHARS TEST
+// [ 9] FLOATING-POINT FROM_CHARS TEST
+// [ 8] INTEGRAL FROM_CHARS TEST
 // [ 7] RANDOM 8-BYTE VALUES TEST
 // [ 6] RANDOM 4-BYTE VALUES TEST
 // [ 5] RANDOM 2-BYTE VALUES TEST
@@ -487,6 +505,115 @@ Uint64 mmixRand64(Uint64 seed = 0)
     return hi | (randAccum >> 32);
 }
 
+void callStrtod(float *result, const char *input, char **end)
+    // Load into the specified 'result' the value of the specified 'input'
+    // parsed by 'strtof', and load into the specified 'end' the end of the
+    // parsed characters.
+{
+    *result = strtof(input, end);
+}
+
+void callStrtod(double *result, const char *input, char **end)
+    // Load into the specified 'result' the value of the specified 'input'
+    // parsed by 'strtod', and load into the specified 'end' the end of the
+    // parsed characters.
+{
+    *result = strtod(input, end);
+}
+
+void callStrtod(long double *result, const char *input, char **end)
+    // Load into the specified 'result' the value of the specified 'input'
+    // parsed by 'strtold', and load into the specified 'end' the end of the
+    // parsed characters.
+{
+    *result = strtold(input, end);
+}
+
+template <class TYPE>
+bool fromCharsMatchesStrtod(const char *input)
+    // Return 'true' if 'from_chars' parses the specified null-terminated
+    // 'input' as the floating-point 'TYPE' to the same value, consuming the
+    // same characters, as the C library, and reports as 'result_out_of_range'
+    // exactly the values that the C library parses as zero or infinity with
+    // 'ERANGE', and 'false' otherwise.  Note that the C library is assumed to
+    // be correctly rounding, and to use the "C" locale.
+{
+    namespace imp = BloombergLP::bslstl;
+
+    char *end;
+    TYPE  expected;
+    errno = 0;
+    callStrtod(&expected, input, &end);
+
+    const bool isOutOfRange = ERANGE == errno
+                           && (0 == expected
+                            || expected >  numeric_limits<TYPE>::max()
+                            || expected < -numeric_limits<TYPE>::max());
+
+    TYPE                   value = 42;
+    imp::from_chars_result sts   = imp::from_chars(input,
+                                                   input + std::strlen(input),
+                                                   value);
+    if (sts.ptr != end) {
+        return false;                                                 // RETURN
+    }
+    if (isOutOfRange) {
+        return bsl::errc::result_out_of_range == sts.ec && 42 == value;
+                                                                      // RETURN
+    }
+    return bsl::ErrcEnum() == sts.ec && expected == value;
+}
+
+template <class TYPE>
+bool testFromCharsBoundaries()
+    // Return 'true' if 'from_chars' parses the decimal representations of the
+    // minimum and maximum values of the integral 'TYPE', and reports as
+    // 'result_out_of_range' the values one beyond them, and 'false'
+    // otherwise.
+{
+    namespace imp = BloombergLP::bslstl;
+
+    const TYPE VALUES[] = { numeric_limits<TYPE>::max(),
+                            numeric_limits<TYPE>::min() };
+
+    bool result = true;
+    for (int ii = 0; ii < 2; ++ii) {
+        char                 buffer[30];
+        bsl::to_chars_result writeSts = bsl::to_chars(buffer,
+                                                      buffer + sizeof buffer,
+                                                      VALUES[ii]);
+
+        TYPE                   value = 0;
+        imp::from_chars_result sts   = imp::from_chars(buffer,
+                                                       writeSts.ptr,
+                                                       value);
+        result = result
+              && bsl::ErrcEnum() == sts.ec
+              && writeSts.ptr    == sts.ptr
+              && VALUES[ii]      == value;
+
+        if (0 == VALUES[ii]) {
+            // The minimum value of an unsigned type has no neighbor that can
+            // be written without a '-'.
+
+            continue;
+        }
+
+        // The last digit of the boundary values of all integral types is
+        // less than 9, and can be incremented to get the neighbor.
+
+        ++writeSts.ptr[-1];
+
+        value = 0;
+        sts   = imp::from_chars(buffer, writeSts.ptr, value);
+        result = result
+              && bsl::errc::result_out_of_range == sts.ec
+              && writeSts.ptr                   == sts.ptr
+              && 0                              == value;
+    }
+    return result;
+}
+
 const Uint64 uint64Max = ~0ULL;    // max value a 'Uint64' can represent
 
 }  // close namespace u
@@ -559,7 +686,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 8: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -570,6 +697,9 @@ int main(int argc, char *argv[])
         //: 1 The function 'writeJsonScalar' (above) demonstrates how the
         //:   component could be used to write a number, in ascii, to a
         //:   'streambuf'.
+        //:
+        //: 2 Parse the fields of a delimited record, as shown in the second
+        //:   usage example in the component header.
         //
         // Testing:
         //   USAGE EXAMPLE
@@ -596,6 +726,845 @@ int main(int argc, char *argv[])
 
         writeJsonScalar(sb, -1234567890);    // worst case int, max string len
         ASSERT("-1234567890" == oss.str());
+
+///Example 2: Parsing Numbers from a Delimited Record
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a record of comma-separated fields, held in a buffer that
+// is not null-terminated, that holds an 'int' quantity and a 'double' price.
+// We can use 'bsl::from_chars' to parse the fields in place, without copying
+// them and without regard to the current locale.
+//
+// First, we define the record:
+//..
+    const char  record[] = { '1', '5', '0', ',', '9', '9', '.', '2', '5' };
+    const char *end      = record + sizeof record;
+//..
+// Then, we parse the quantity, which leaves 'ptr' at the delimiter:
+//..
+    int                    quantity = 0;
+    bsl::from_chars_result sts      = bsl::from_chars(record, end, quantity);
+
+    ASSERT(bsl::ErrcEnum() == sts.ec);
+    ASSERT(150             == quantity);
+    ASSERT(','             == *sts.ptr);
+//..
+// Next, we parse the price, which must consume the rest of the record:
+//..
+    double price = 0;
+
+    sts = bsl::from_chars(sts.ptr + 1, end, price);
+
+    ASSERT(bsl::ErrcEnum() == sts.ec);
+    ASSERT(99.25           == price);
+    ASSERT(end             == sts.ptr);
+//..
+// Finally, we observe that a field that does not begin with a number is
+// rejected without modifying the output:
+//..
+    sts = bsl::from_chars(record + 3, end, quantity);
+
+    ASSERT(bsl::errc::invalid_argument == sts.ec);
+    ASSERT(record + 3                  == sts.ptr);
+    ASSERT(150                         == quantity);
+//..
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // FLOATING-POINT TO_CHARS TEST
+        //
+        // Concerns:
+        //: 1 Each floating-point overload writes the representation selected
+        //:   by its format and precision.
+        //:
+        //: 2 The 'chars_format' enumerators select the corresponding
+        //:   notations.
+        //:
+        //: 3 On success, 'ptr' is the end of the written characters and 'ec'
+        //:   is a default constructed 'ErrcEnum'.
+        //:
+        //: 4 If the buffer is too small, 'ptr' is 'last' and 'ec' is
+        //:   'errc::value_too_large'.
+        //:
+        //: 5 The shortest representation is parsed back to the same value by
+        //:   'from_chars'.
+        //:
+        //: 6 'bsl::to_chars' provides the same overloads.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, write values of both types
+        //:   with each overload, and compare with the expected text.
+        //:   (C-1..3)
+        //:
+        //: 2 Write each value into a buffer one character too short.  (C-4)
+        //:
+        //: 3 Parse the shortest representations with 'from_chars'.  (C-5)
+        //:
+        //: 4 Repeat the calls with 'bsl::to_chars'.  (C-6)
+        //
+        // Testing:
+        //   to_chars_result to_chars(char *, char *, FLOAT, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("FLOATING-POINT TO_CHARS TEST\n"
+                            "============================\n");
+
+        namespace imp = BloombergLP::bslstl;
+
+        typedef imp::chars_format Fmt;
+
+#if defined(BSLSTL_CHARCONV_NATIVE_FLOATING_POINT)
+        typedef std::chars_format       BslFmt;
+#else
+        typedef bsl::chars_format::Enum BslFmt;
+#endif
+
+        enum { k_PLAIN = 0, k_NONE = -100 };
+
+        static const struct {
+            int          d_line;
+            bool         d_isFloat;    // write as 'float'
+            double       d_value;
+            int          d_format;     // 'chars_format::Enum', or 'k_PLAIN'
+            int          d_precision;  // precision, or 'k_NONE'
+            const char  *d_expected;
+        } DATA[] = {
+            //LN  FLT  VALUE      FORMAT           PREC    EXPECTED
+            //--  ---  ---------  ---------------  ------  ---------------
+            { L_, 0,   0.0,       k_PLAIN,         k_NONE, "0"             },
+            { L_, 0,   -0.25,     k_PLAIN,         k_NONE, "-0.25"         },
+            { L_, 0,   0.3,       k_PLAIN,         k_NONE, "0.3"           },
+            { L_, 0,   1e22,      k_PLAIN,         k_NONE, "1e+22"         },
+            { L_, 0,   123456.0,  k_PLAIN,         k_NONE, "123456"        },
+            { L_, 0,   5e-324,    k_PLAIN,         k_NONE, "5e-324"        },
+            { L_, 1,   0.3,       k_PLAIN,         k_NONE, "0.3"           },
+            { L_, 1,   1e10,      k_PLAIN,         k_NONE, "1e+10"         },
+            { L_, 0,   1234.5,    Fmt::scientific, k_NONE, "1.2345e+03"    },
+            { L_, 0,   1e-5,      Fmt::fixed,      k_NONE, "0.00001"       },
+            { L_, 0,   1234567.0, Fmt::general,    k_NONE, "1.234567e+06"  },
+            { L_, 0,   1.5,       Fmt::hex,        k_NONE, "1.8p+0"        },
+            { L_, 1,   0.1,       Fmt::scientific, k_NONE, "1e-01"         },
+            { L_, 0,   2.675,     Fmt::fixed,      2,      "2.67"          },
+            { L_, 0,   2.5,       Fmt::fixed,      0,      "2"             },
+            { L_, 0,   1234.5,    Fmt::scientific, 2,      "1.23e+03"      },
+            { L_, 0,   0.0001,    Fmt::general,    3,      "0.0001"        },
+            { L_, 0,   123456.0,  Fmt::general,    3,      "1.23e+05"      },
+            { L_, 0,   1.0,       Fmt::hex,        2,      "1.00p+0"       },
+            { L_, 1,   0.1,       Fmt::fixed,      10,     "0.1000000015"  },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            const int          LINE        = DATA[ti].d_line;
+            const bool         IS_FLOAT    = DATA[ti].d_isFloat;
+            const double       VALUE       = DATA[ti].d_value;
+            const int          FORMAT      = DATA[ti].d_format;
+            const int          PRECISION   = DATA[ti].d_precision;
+            const char        *EXPECTED    = DATA[ti].d_expected;
+            const Fmt::Enum    FMT         = static_cast<Fmt::Enum>(FORMAT);
+            const float        FLOAT_VALUE = static_cast<float>(VALUE);
+            const std::size_t  LENGTH      = std::strlen(EXPECTED);
+
+            if (veryVerbose) {
+                P_(LINE) P_(VALUE) P_(FORMAT) P_(PRECISION) P(EXPECTED);
+            }
+
+            for (int ii = 0; ii < 2; ++ii) {
+                const std::size_t SIZE = ii ? LENGTH - 1 : LENGTH;
+
+                char buffer[32];
+                std::memset(buffer, '?', sizeof buffer);
+
+                imp::to_chars_result sts;
+                if (k_PLAIN == FORMAT) {
+                    sts = IS_FLOAT
+                        ? imp::to_chars(buffer, buffer + SIZE, FLOAT_VALUE)
+                        : imp::to_chars(buffer, buffer + SIZE, VALUE);
+                }
+                else if (k_NONE == PRECISION) {
+                    sts = IS_FLOAT
+                        ? imp::to_chars(buffer, buffer + SIZE, FLOAT_VALUE,
+                                                                          FMT)
+                        : imp::to_chars(buffer, buffer + SIZE, VALUE, FMT);
+                }
+                else {
+                    sts = IS_FLOAT
+                        ? imp::to_chars(buffer, buffer + SIZE, FLOAT_VALUE,
+                                                               FMT, PRECISION)
+                        : imp::to_chars(buffer, buffer + SIZE, VALUE, FMT,
+                                                                    PRECISION);
+                }
+
+                if (ii) {
+                    ASSERTV(LINE, buffer + SIZE == sts.ptr);
+                    ASSERTV(LINE, bsl::errc::value_too_large == sts.ec);
+                    continue;
+                }
+
+                ASSERTV(LINE, bsl::ErrcEnum() == sts.ec);
+                ASSERTV(LINE, buffer + LENGTH == sts.ptr);
+                ASSERTV(LINE, EXPECTED, buffer,
+                        0 == std::memcmp(buffer, EXPECTED, LENGTH));
+
+                if (k_NONE == PRECISION && Fmt::hex != FORMAT) {
+                    if (IS_FLOAT) {
+                        float parsed = 0;
+                        imp::from_chars(buffer, sts.ptr, parsed);
+                        ASSERTV(LINE, FLOAT_VALUE == parsed);
+                    }
+                    else {
+                        double parsed = 0;
+                        imp::from_chars(buffer, sts.ptr, parsed);
+                        ASSERTV(LINE, VALUE == parsed);
+                    }
+                }
+            }
+
+            // 'bsl::to_chars' has the same overloads.
+
+            char                 buffer[32];
+            bsl::to_chars_result bslSts;
+            if (k_PLAIN == FORMAT) {
+                bslSts = IS_FLOAT
+                       ? bsl::to_chars(buffer, buffer + 32, FLOAT_VALUE)
+                       : bsl::to_chars(buffer, buffer + 32, VALUE);
+            }
+            else if (k_NONE == PRECISION) {
+                bslSts = IS_FLOAT
+                       ? bsl::to_chars(buffer, buffer + 32, FLOAT_VALUE,
+                                       static_cast<BslFmt>(FORMAT))
+                       : bsl::to_chars(buffer, buffer + 32, VALUE,
+                                       static_cast<BslFmt>(FORMAT));
+            }
+            else {
+                bslSts = IS_FLOAT
+                       ? bsl::to_chars(buffer, buffer + 32, FLOAT_VALUE,
+                                       static_cast<BslFmt>(FORMAT),
+                                       PRECISION)
+                       : bsl::to_chars(buffer, buffer + 32, VALUE,
+                                       static_cast<BslFmt>(FORMAT),
+                                       PRECISION);
+            }
+            ASSERTV(LINE, buffer + LENGTH == bslSts.ptr);
+            ASSERTV(LINE, EXPECTED, 0 == std::memcmp(buffer, EXPECTED,
+                                                                     LENGTH));
+        }
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // RANDOM FLOATING-POINT FROM_CHARS TEST
+        //
+        // Concerns:
+        //: 1 Floating-point 'from_chars' returns the correctly rounded value
+        //:   for the decimal representations of arbitrary values, whether
+        //:   shortest, round-tripping, or longer than the precision of the
+        //:   type.
+        //:
+        //: 2 Values very close to halfway between two representable values
+        //:   are rounded correctly, which requires the exact (slow) path.
+        //:
+        //: 3 Input having more digits than are used by the fast path is
+        //:   rounded correctly.
+        //
+        // Plan:
+        //: 1 Generate random bit patterns, reinterpret them as 'double' and
+        //:   'float', and format them with 'sprintf' using 17 (or 9)
+        //:   significant digits, and a random number of digits.  Parse them
+        //:   with 'from_chars' and 'strtod' (or 'strtof') and compare the
+        //:   results, which must be identical.  (C-1)
+        //:
+        //: 2 Format the exact midpoints of adjacent 'float' values, which are
+        //:   representable as 'double', and compare as in P-1.  (C-2)
+        //:
+        //: 3 Generate random strings of up to 40 digits, with a random
+        //:   decimal point and exponent, and compare the results of parsing
+        //:   them as 'float', 'double', and (if it has at most 64 bits of
+        //:   precision) 'long double' with those of the C library.  (C-3)
+        //
+        // Testing:
+        //   from_chars(const char *, const char *, float&, chars_format);
+        //   from_chars(const char *, const char *, double&, chars_format);
+        //   from_chars(const char *, const char *, long double&, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("RANDOM FLOATING-POINT FROM_CHARS TEST\n"
+                            "=====================================\n");
+
+        namespace imp = BloombergLP::bslstl;
+
+        const int iterations = 20000 * multiplier;
+        ASSERT(0 < iterations);
+
+        if (verbose) P(iterations);
+
+        u::mmixRand64(12345);
+
+        char buffer[200];
+
+        if (verbose) printf("Random 'double' and 'float' values\n");
+        for (int ii = 0; ii < iterations; ++ii) {
+            const Uint64 bits = u::mmixRand64();
+
+            double doubleValue;
+            float  floatValue;
+            unsigned int floatBits = static_cast<unsigned int>(bits);
+            std::memcpy(&doubleValue, &bits, sizeof doubleValue);
+            std::memcpy(&floatValue, &floatBits, sizeof floatValue);
+
+            if (doubleValue == doubleValue) {
+                const int precision = ii % 2 ? 17 : 1 + ii % 17;
+                sprintf(buffer, "%.*g", precision, doubleValue);
+
+                ASSERTV(buffer, u::fromCharsMatchesStrtod<double>(buffer));
+                ASSERTV(buffer, u::fromCharsMatchesStrtod<float>(buffer));
+            }
+            if (floatValue == floatValue) {
+                sprintf(buffer, "%.9g", floatValue);
+
+                ASSERTV(buffer, u::fromCharsMatchesStrtod<float>(buffer));
+            }
+        }
+
+        if (verbose) printf("Midpoints of adjacent 'float' values\n");
+        for (int ii = 0; ii < iterations; ++ii) {
+            unsigned int bits = static_cast<unsigned int>(u::mmixRand64())
+                              & 0x7f7fffff;
+            float lower;
+            float upper;
+            std::memcpy(&lower, &bits, sizeof lower);
+            ++bits;
+            std::memcpy(&upper, &bits, sizeof upper);
+
+            sprintf(buffer,
+                    "%.120g",
+                    (static_cast<double>(lower) + upper) / 2);
+
+            ASSERTV(buffer, u::fromCharsMatchesStrtod<float>(buffer));
+        }
+
+        if (verbose) printf("Random digit strings\n");
+        for (int ii = 0; ii < iterations; ++ii) {
+            const int numDigits = 1 + static_cast<int>(u::mmixRand64() % 40);
+            const int point     = static_cast<int>(u::mmixRand64()
+                                                       % (numDigits + 1));
+            const int exponent  = static_cast<int>(u::mmixRand64() % 700)
+                                - 350;
+
+            char *iter = buffer;
+            for (int jj = 0; jj < numDigits; ++jj) {
+                if (jj == point) {
+                    *iter++ = '.';
+                }
+                *iter++ = static_cast<char>('0' + u::mmixRand64() % 10);
+            }
+            sprintf(iter, "e%d", exponent);
+
+            ASSERTV(buffer, u::fromCharsMatchesStrtod<double>(buffer));
+            ASSERTV(buffer, u::fromCharsMatchesStrtod<float>(buffer));
+            if (numeric_limits<long double>::digits <= 64) {
+                ASSERTV(buffer,
+                        u::fromCharsMatchesStrtod<long double>(buffer));
+            }
+        }
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // FLOATING-POINT FROM_CHARS TEST
+        //
+        // Concerns:
+        //: 1 Floating-point 'from_chars' parses the longest prefix matching
+        //:   the format selected by 'fmt', and returns a pointer to the end of
+        //:   that prefix.
+        //:
+        //: 2 'fixed' does not accept an exponent, 'scientific' requires one,
+        //:   and 'general' accepts either.  An 'e' that is not followed by
+        //:   exponent digits is not consumed.
+        //:
+        //: 3 'hex' parses a hexadecimal significand, without a '0x' prefix,
+        //:   and an optional binary exponent introduced by 'p'.
+        //:
+        //: 4 Infinity and NaN are parsed, ignoring case, in every format.
+        //:
+        //: 5 A leading '+' or whitespace, and input without digits, are
+        //:   rejected with 'invalid_argument', and 'ptr' equal to 'first'.
+        //:
+        //: 6 Values that overflow or underflow are rejected with
+        //:   'result_out_of_range', and 'ptr' past the number.
+        //:
+        //: 7 Boundary values (the smallest subnormal, the largest finite
+        //:   value, and halfway cases) are rounded correctly.
+        //:
+        //: 8 The output is not modified on failure.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a variety of inputs as
+        //:   'double' in each format and verify the result, 'ec', and 'ptr'.
+        //:   Verify that the value is unchanged on failure.  (C-1..8)
+        //:
+        //: 2 Parse some of the inputs as 'float' and 'long double'.  (C-6..7)
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("FLOATING-POINT FROM_CHARS TEST\n"
+                            "==============================\n");
+
+        namespace imp = BloombergLP::bslstl;
+
+        typedef imp::chars_format Fmt;
+
+        const double INF  = numeric_limits<double>::infinity();
+        const double DMAX = numeric_limits<double>::max();
+        const double DMIN = numeric_limits<double>::denorm_min();
+
+        const Fmt::Enum G = Fmt::general;
+        const Fmt::Enum F = Fmt::fixed;
+        const Fmt::Enum S = Fmt::scientific;
+        const Fmt::Enum H = Fmt::hex;
+
+        enum { OK, INV, RNG };
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_input_p;   // input
+            Fmt::Enum   d_fmt;       // format
+            int         d_length;    // expected number of characters parsed
+            int         d_status;    // expected 'ec' ('OK', 'INV', 'RNG')
+            double      d_exp;       // expected value, if 'OK'
+        } DATA[] = {
+            //LINE  INPUT                       FMT  LEN  STATUS  EXP
+            //----  --------------------------  ---  ---  ------  ---------
+            { L_,   "0",                        G,    1,  OK,     0.0      },
+            { L_,   "-0",                       G,    2,  OK,     -0.0     },
+            { L_,   "1",                        G,    1,  OK,     1.0      },
+            { L_,   "1.",                       G,    2,  OK,     1.0      },
+            { L_,   ".5",                       G,    2,  OK,     0.5      },
+            { L_,   "-.5",                      G,    3,  OK,     -0.5     },
+            { L_,   "007.250",                  G,    7,  OK,     7.25     },
+            { L_,   "12.5e-1",                  G,    7,  OK,     1.25     },
+            { L_,   "1e5",                      G,    3,  OK,     1e5      },
+            { L_,   "1E+5",                     G,    4,  OK,     1e5      },
+            { L_,   "1e",                       G,    1,  OK,     1.0      },
+            { L_,   "1e+",                      G,    1,  OK,     1.0      },
+            { L_,   "1.5e5x",                   G,    5,  OK,     1.5e5    },
+            { L_,   "1,5",                      G,    1,  OK,     1.0      },
+            { L_,   "0.1",                      G,    3,  OK,     0.1      },
+            { L_,   "9007199254740993",         G,   16,  OK,
+                                                         9007199254740992.0 },
+            { L_,   "9007199254740995",         G,   16,  OK,
+                                                         9007199254740996.0 },
+            { L_,   "123456789012345678901234567890",
+                                                G,   30,  OK,
+                                          123456789012345678901234567890.0 },
+            { L_,   "0.000000000000000000000000000000000001",
+                                                G,   38,  OK,     1e-36    },
+
+            { L_,   "1e5",                      F,    1,  OK,     1.0      },
+            { L_,   "1.5",                      F,    3,  OK,     1.5      },
+            { L_,   "1e5",                      S,    3,  OK,     1e5      },
+            { L_,   "1.5",                      S,    0,  INV,    0        },
+            { L_,   "1e",                       S,    0,  INV,    0        },
+
+            { L_,   "1p4",                      H,    3,  OK,     16.0     },
+            { L_,   "a.8",                      H,    3,  OK,     10.5     },
+            { L_,   "A.8P-1",                   H,    6,  OK,     5.25     },
+            { L_,   "-ffp+0",                   H,    6,  OK,     -255.0   },
+            { L_,   "1p",                       H,    1,  OK,     1.0      },
+            { L_,   "1e1",                      H,    3,  OK,     481.0    },
+            { L_,   "0x1p4",                    H,    1,  OK,     0.0      },
+            { L_,   "1.0000000000008p0",        H,   17,  OK,
+                                                        1.0000000000000018 },
+            { L_,   "1.00000000000080000001",   H,   22,  OK,
+                                                        1.0000000000000018 },
+            { L_,   "1.0000000000000800",       H,   18,  OK,     1.0      },
+            { L_,   "1.0000000000000800000001", H,   24,  OK,
+                                                        1.0000000000000002 },
+            { L_,   "1p-1075",                  H,    7,  RNG,    0        },
+            { L_,   "1.00000001p-1075",         H,   16,  OK,     DMIN     },
+            { L_,   "1p1024",                   H,    6,  RNG,    0        },
+
+            { L_,   "inf",                      G,    3,  OK,     INF      },
+            { L_,   "-INF",                     F,    4,  OK,     -INF     },
+            { L_,   "Infinity",                 S,    8,  OK,     INF      },
+            { L_,   "infinit",                  H,    3,  OK,     INF      },
+            { L_,   "in",                       G,    0,  INV,    0        },
+
+            { L_,   "",                         G,    0,  INV,    0        },
+            { L_,   "-",                        G,    0,  INV,    0        },
+            { L_,   ".",                        G,    0,  INV,    0        },
+            { L_,   "-.e1",                     G,    0,  INV,    0        },
+            { L_,   "e5",                       G,    0,  INV,    0        },
+            { L_,   "+1",                       G,    0,  INV,    0        },
+            { L_,   " 1",                       G,    0,  INV,    0        },
+            { L_,   "--1",                      G,    0,  INV,    0        },
+            { L_,   "x",                        H,    0,  INV,    0        },
+
+            { L_,   "1e309",                    G,    5,  RNG,    0        },
+            { L_,   "-1e309",                   G,    6,  RNG,    0        },
+            { L_,   "1e-400",                   G,    6,  RNG,    0        },
+            { L_,   "1e99999999999",            G,   13,  RNG,    0        },
+            { L_,   "0e99999999999",            G,   13,  OK,     0.0      },
+            { L_,   "1e-99999999999",           G,   14,  RNG,    0        },
+            { L_,   "1.7976931348623157e308",   G,   22,  OK,     DMAX     },
+            { L_,   "1.7976931348623158e308",   G,   22,  OK,     DMAX     },
+            { L_,   "1.7976931348623159e308",   G,   22,  RNG,    0        },
+            { L_,   "4.9406564584124654e-324",  G,   23,  OK,     DMIN     },
+            { L_,   "2.4703282292062328e-324",  G,   23,  OK,     DMIN     },
+            { L_,   "2.4703282292062327e-324",  G,   23,  RNG,    0        },
+            { L_,   "2.2250738585072011e-308",  G,   23,  OK,
+                                                   2.2250738585072011e-308 },
+            { L_,   "2.2250738585072012e-308",  G,   23,  OK,
+                                                   2.2250738585072012e-308 },
+
+            // 1 + 2^-53, exactly halfway between 1 and the next 'double',
+            // and values just above and below it
+
+            { L_,   "1.00000000000000011102230246251565404236316680908203125",
+                                                G,   55,  OK,     1.0      },
+            { L_,   "1.00000000000000011102230246251565404236316680908203126",
+                                                G,   55,  OK,
+                                                        1.0000000000000002 },
+            { L_,   "1.000000000000000111022302462515654042363166809082031250"
+                    "000000000000000000000000000000000000000000000000000001",
+                                                G,  110,  OK,
+                                                        1.0000000000000002 },
+            { L_,   "1.00000000000000011102230246251565404236316680908203124",
+                                                G,   55,  OK,     1.0      },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char       *INPUT  = DATA[ti].d_input_p;
+            const Fmt::Enum   FMT    = DATA[ti].d_fmt;
+            const int         LENGTH = DATA[ti].d_length;
+            const int         STATUS = DATA[ti].d_status;
+            const double      EXP    = DATA[ti].d_exp;
+
+            const char *end = INPUT + std::strlen(INPUT);
+
+            if (veryVerbose) { P_(LINE) P_(INPUT) P(FMT) }
+
+            const bsl::ErrcEnum EXP_EC =
+                                  OK  == STATUS ? bsl::ErrcEnum()
+                                : INV == STATUS ? bsl::errc::invalid_argument
+                                : bsl::errc::result_out_of_range;
+
+            double                 value = 42.0;
+            imp::from_chars_result sts   = imp::from_chars(INPUT,
+                                                           end,
+                                                           value,
+                                                           FMT);
+
+            ASSERTV(LINE, EXP_EC == sts.ec);
+            ASSERTV(LINE, sts.ptr - INPUT, LENGTH == sts.ptr - INPUT);
+            if (OK == STATUS) {
+                ASSERTV(LINE, value, EXP, EXP == value);
+                ASSERTV(LINE, (EXP < 0 || 1 / EXP < 0) == (value < 0
+                                                            || 1 / value < 0));
+            }
+            else {
+                ASSERTV(LINE, value, 42.0 == value);
+            }
+
+            if (G == FMT && OK == STATUS) {
+                // The 'std' implementation, if any, agrees.
+
+                double         bslValue = 42.0;
+                bsl::from_chars_result bslSts = bsl::from_chars(INPUT,
+                                                                end,
+                                                                bslValue);
+                ASSERTV(LINE, bsl::ErrcEnum() == bslSts.ec);
+                ASSERTV(LINE, bslValue, EXP == bslValue);
+            }
+        }
+
+        if (verbose) printf("NaN\n");
+        {
+            static const struct {
+                int         d_line;      // source line number
+                const char *d_input_p;   // input
+                int         d_length;    // expected number of characters
+                bool        d_negative;  // expected sign
+            } NANS[] = {
+                //LINE  INPUT           LEN  NEG
+                //----  -------------   ---  ---
+                { L_,   "nan",            3, false },
+                { L_,   "-NaN",           4, true  },
+                { L_,   "nan()",          5, false },
+                { L_,   "nan(abc_123)",  12, false },
+                { L_,   "nan(abc",        3, false },
+                { L_,   "nan(a b)",       3, false },
+                { L_,   "-nanx",          4, true  },
+            };
+            enum { k_NUM_NANS = sizeof NANS / sizeof *NANS };
+
+            for (int ti = 0; ti < k_NUM_NANS; ++ti) {
+                const int   LINE     = NANS[ti].d_line;
+                const char *INPUT    = NANS[ti].d_input_p;
+                const int   LENGTH   = NANS[ti].d_length;
+                const bool  NEGATIVE = NANS[ti].d_negative;
+
+                double                 value = 0;
+                imp::from_chars_result sts   = imp::from_chars(
+                                                   INPUT,
+                                                   INPUT + std::strlen(INPUT),
+                                                   value);
+
+                ASSERTV(LINE, bsl::ErrcEnum() == sts.ec);
+                ASSERTV(LINE, LENGTH == sts.ptr - INPUT);
+                ASSERTV(LINE, value != value);
+
+                Uint64 bits;
+                std::memcpy(&bits, &value, sizeof bits);
+                ASSERTV(LINE, NEGATIVE == (0 != (bits >> 63)));
+            }
+        }
+
+        if (verbose) printf("'float' and 'long double'\n");
+        {
+            const char *input = "3.4028235e38";
+            float       floatValue;
+            imp::from_chars(input, input + 12, floatValue);
+            ASSERT(numeric_limits<float>::max() == floatValue);
+
+            input = "3.4028236e38";
+            imp::from_chars_result sts = imp::from_chars(input,
+                                                         input + 12,
+                                                         floatValue);
+            ASSERT(bsl::errc::result_out_of_range == sts.ec);
+
+            input = "1.4e-45";
+            imp::from_chars(input, input + 7, floatValue);
+            ASSERT(numeric_limits<float>::denorm_min() == floatValue);
+
+            input = "7e-46";
+            floatValue = 1.0f;
+            sts = imp::from_chars(input, input + 5, floatValue);
+            ASSERT(bsl::errc::result_out_of_range == sts.ec);
+            ASSERT(1.0f == floatValue);
+
+            input = "0.1";
+            long double longDoubleValue;
+            sts = imp::from_chars(input, input + 3, longDoubleValue);
+            ASSERT(bsl::ErrcEnum() == sts.ec);
+            ASSERT(0.1L == longDoubleValue);
+
+            input = "1e309";
+            sts = imp::from_chars(input, input + 5, longDoubleValue);
+            ASSERT((numeric_limits<long double>::max_exponent10 < 309) ==
+                                   (bsl::errc::result_out_of_range == sts.ec));
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // INTEGRAL FROM_CHARS TEST
+        //
+        // Concerns:
+        //: 1 Integral 'from_chars' parses the longest sequence of digits in
+        //:   the specified base, preceded by an optional '-' only for signed
+        //:   types, and returns a pointer to the end of that sequence.
+        //:
+        //: 2 Letters are accepted as digits, ignoring case, in bases above 10.
+        //:
+        //: 3 Input not beginning with a digit (including a leading '+' or
+        //:   whitespace) is rejected with 'invalid_argument', and 'ptr' equal
+        //:   to 'first'.
+        //:
+        //: 4 Values out of the range of the type, including the most negative
+        //:   value minus one, are rejected with 'result_out_of_range' and
+        //:   'ptr' past all the digits.
+        //:
+        //: 5 The output is not modified on failure.
+        //:
+        //: 6 Any value written by 'to_chars' is parsed back to the same value.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a variety of inputs as
+        //:   'int' and 'unsigned', and verify the result, 'ec', and 'ptr'.
+        //:   (C-1..5)
+        //:
+        //: 2 Verify the boundaries of each integral type.  (C-4)
+        //:
+        //: 3 Write random values with 'to_chars' in all bases, and parse them
+        //:   back.  (C-6)
+        //
+        // Testing:
+        //   from_chars(const char *, const char *, INTEGRAL_TYPE&, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("INTEGRAL FROM_CHARS TEST\n"
+                            "========================\n");
+
+        namespace imp = BloombergLP::bslstl;
+
+        enum { OK, INV, RNG };
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_input_p;   // input
+            int         d_base;      // base
+            int         d_length;    // expected number of characters parsed
+            int         d_status;    // expected 'int' status
+            int         d_exp;       // expected 'int' value, if 'OK'
+            int         d_uStatus;   // expected 'unsigned' status
+        } DATA[] = {
+            //LINE  INPUT            BASE LEN  STATUS  EXP          USTATUS
+            //----  ---------------  ---- ---  ------  -----------  -------
+            { L_,   "0",              10,  1,  OK,     0,           OK   },
+            { L_,   "-0",             10,  2,  OK,     0,           INV  },
+            { L_,   "123",            10,  3,  OK,     123,         OK   },
+            { L_,   "-123",           10,  4,  OK,     -123,        INV  },
+            { L_,   "00123abc",       10,  5,  OK,     123,         OK   },
+            { L_,   "12 3",           10,  2,  OK,     12,          OK   },
+            { L_,   "777",             8,  3,  OK,     511,         OK   },
+            { L_,   "789",             8,  1,  OK,     7,           OK   },
+            { L_,   "1012",            2,  3,  OK,     5,           OK   },
+            { L_,   "ff",             16,  2,  OK,     255,         OK   },
+            { L_,   "-Ff",            16,  3,  OK,     -255,        INV  },
+            { L_,   "0x1f",           16,  1,  OK,     0,           OK   },
+            { L_,   "zZ",             36,  2,  OK,     1295,        OK   },
+            { L_,   "2147483647",     10, 10,  OK,     2147483647,  OK   },
+            { L_,   "-2147483648",    10, 11,  OK,     INT_MIN,     INV  },
+            { L_,   "2147483648",     10, 10,  RNG,    0,           OK   },
+            { L_,   "-2147483649",    10, 11,  RNG,    0,           INV  },
+            { L_,   "4294967295",     10, 10,  RNG,    0,           OK   },
+            { L_,   "4294967296",     10, 10,  RNG,    0,           RNG  },
+            { L_,   "99999999999999999999999x",
+                                      10, 23,  RNG,    0,           RNG  },
+            { L_,   "7fffffff",       16,  8,  OK,     INT_MAX,     OK   },
+            { L_,   "-80000000",      16,  9,  OK,     INT_MIN,     INV  },
+            { L_,   "",               10,  0,  INV,    0,           INV  },
+            { L_,   "-",              10,  0,  INV,    0,           INV  },
+            { L_,   "+1",             10,  0,  INV,    0,           INV  },
+            { L_,   " 1",             10,  0,  INV,    0,           INV  },
+            { L_,   "--1",            10,  0,  INV,    0,           INV  },
+            { L_,   "a",              10,  0,  INV,    0,           INV  },
+            { L_,   "8",               8,  0,  INV,    0,           INV  },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            const int   LINE    = DATA[ti].d_line;
+            const char *INPUT   = DATA[ti].d_input_p;
+            const int   BASE    = DATA[ti].d_base;
+            const int   LENGTH  = DATA[ti].d_length;
+            const int   STATUS  = DATA[ti].d_status;
+            const int   EXP     = DATA[ti].d_exp;
+            const int   USTATUS = DATA[ti].d_uStatus;
+
+            const char *end = INPUT + std::strlen(INPUT);
+
+            if (veryVerbose) { P_(LINE) P_(INPUT) P(BASE) }
+
+            int                    value = 42;
+            imp::from_chars_result sts   = imp::from_chars(INPUT,
+                                                           end,
+                                                           value,
+                                                           BASE);
+            switch (STATUS) {
+              case OK: {
+                ASSERTV(LINE, bsl::ErrcEnum() == sts.ec);
+                ASSERTV(LINE, value, EXP == value);
+              } break;
+              case INV: {
+                ASSERTV(LINE, bsl::errc::invalid_argument == sts.ec);
+                ASSERTV(LINE, 42 == value);
+              } break;
+              default: {
+                ASSERTV(LINE, bsl::errc::result_out_of_range == sts.ec);
+                ASSERTV(LINE, 42 == value);
+              } break;
+            }
+            ASSERTV(LINE, sts.ptr - INPUT, LENGTH == sts.ptr - INPUT);
+
+            unsigned uValue = 42;
+            sts = imp::from_chars(INPUT, end, uValue, BASE);
+            switch (USTATUS) {
+              case OK: {
+                ASSERTV(LINE, bsl::ErrcEnum() == sts.ec);
+                ASSERTV(LINE, uValue, RNG == STATUS
+                                   || static_cast<unsigned>(EXP) == uValue);
+              } break;
+              case INV: {
+                ASSERTV(LINE, bsl::errc::invalid_argument == sts.ec);
+                ASSERTV(LINE, sts.ptr == INPUT);
+                ASSERTV(LINE, 42 == uValue);
+              } break;
+              default: {
+                ASSERTV(LINE, bsl::errc::result_out_of_range == sts.ec);
+                ASSERTV(LINE, 42 == uValue);
+              } break;
+            }
+
+            // The 'std' implementation, if any, agrees.
+
+            int                    bslValue = 42;
+            bsl::from_chars_result bslSts   = bsl::from_chars(INPUT,
+                                                              end,
+                                                              bslValue,
+                                                              BASE);
+            ASSERTV(LINE, sts.ptr - INPUT, bslSts.ptr == INPUT + LENGTH);
+            ASSERTV(LINE, bslValue, value == bslValue);
+        }
+
+        if (verbose) printf("Type boundaries\n");
+        {
+            ASSERT(u::testFromCharsBoundaries<char>());
+            ASSERT(u::testFromCharsBoundaries<signed char>());
+            ASSERT(u::testFromCharsBoundaries<unsigned char>());
+            ASSERT(u::testFromCharsBoundaries<short>());
+            ASSERT(u::testFromCharsBoundaries<unsigned short>());
+            ASSERT(u::testFromCharsBoundaries<int>());
+            ASSERT(u::testFromCharsBoundaries<unsigned>());
+            ASSERT(u::testFromCharsBoundaries<long>());
+            ASSERT(u::testFromCharsBoundaries<unsigned long>());
+            ASSERT(u::testFromCharsBoundaries<Int64>());
+            ASSERT(u::testFromCharsBoundaries<Uint64>());
+        }
+
+        if (verbose) printf("Round trip of random values\n");
+        {
+            const int iterations = 2000 * multiplier;
+
+            for (int ii = 0; ii < iterations; ++ii) {
+                const Uint64 uValue = u::mmixRand64() >> (ii % 64);
+                const Int64  value  = ii % 2
+                                    ? static_cast<Int64>(uValue)
+                                    : -static_cast<Int64>(uValue >> 1);
+
+                for (int base = 2; base <= 36; ++base) {
+                    char buffer[70];
+
+                    bsl::to_chars_result writeSts = bsl::to_chars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        value,
+                                                        base);
+                    ASSERT(bsl::ErrcEnum() == writeSts.ec);
+
+                    Int64                  result = 0;
+                    imp::from_chars_result sts    = imp::from_chars(
+                                                                buffer,
+                                                                writeSts.ptr,
+                                                                result,
+                                                                base);
+                    ASSERTV(value, base, bsl::ErrcEnum() == sts.ec);
+                    ASSERTV(value, base, writeSts.ptr == sts.ptr);
+                    ASSERTV(value, base, result, value == result);
+
+                    writeSts = bsl::to_chars(buffer,
+                                             buffer + sizeof buffer,
+                                             uValue,
+                                             base);
+
+                    Uint64 uResult = 0;
+                    sts = imp::from_chars(buffer,
+                                          writeSts.ptr,
+                                          uResult,
+                                          base);
+                    ASSERTV(uValue, base, bsl::ErrcEnum() == sts.ec);
+                    ASSERTV(uValue, base, uResult, uValue == uResult);
+                }
+            }
+        }
       } break;
       case 7: {
         // --------------------------------------------------------------------